@@ -61,6 +61,8 @@ void augment_xylist_init(augment_xylist_t* axy) {
     axy->parity = PARITY_BOTH;
     axy->uniformize = 10;
     axy->verify_uniformize = TRUE;
+    axy->preverify_nref = -1;
+    axy->preverify_min_match = -1;
 }
 
 void augment_xylist_free_contents(augment_xylist_t* axy) {
@@ -182,6 +184,10 @@ static an_option_t options[] = {
      "don't uniformize the field stars during verification"},
     {'\x83', "no-verify-dedup", no_argument, NULL,
      "don't deduplicate the field stars during verification"},
+    {'\x96', "preverify-stars", required_argument, "int",
+     "before verifying a match, check whether this many of the brightest reference stars in the image have field stars nearby (0=disable; default 10)"},
+    {'\x97', "preverify-matches", required_argument, "int",
+     "reject a match before verification unless this many more of those reference stars match than expected by chance (default 2)"},
     {'C', "cancel",                required_argument, "filename",
      "filename whose creation signals the process to stop"},
     {'S', "solved",                required_argument, "filename",
@@ -287,6 +293,12 @@ int augment_xylist_parse_option(char argchar, char* optarg,
     case '\x83':
         axy->verify_dedup = FALSE;
         break;
+    case '\x96':
+        axy->preverify_nref = atoi(optarg);
+        break;
+    case '\x97':
+        axy->preverify_min_match = atoi(optarg);
+        break;
         /*
          case '\x86':
          axy->predistort = sip_read_header_file(optarg, NULL);
@@ -1202,6 +1214,10 @@ int augment_xylist(augment_xylist_t* axy,
 
     qfits_header_add(hdr, "ANVERUNI", axy->verify_uniformize ? "T":"F", "Uniformize field during verification", NULL);
     qfits_header_add(hdr, "ANVERDUP", axy->verify_dedup ? "T":"F", "Deduplicate field during verification", NULL);
+    if (axy->preverify_nref >= 0)
+        fits_header_add_int(hdr, "ANPVNREF", axy->preverify_nref, "Reference stars to check before verification");
+    if (axy->preverify_min_match >= 0)
+        fits_header_add_int(hdr, "ANPVMIN", axy->preverify_min_match, "Matches above chance to pass that check");
 
     if (axy->odds_to_tune_up)
         fits_header_add_double(hdr, "ANODDSTU", axy->odds_to_tune_up, "Odds ratio to tune up a match");
@@ -1523,6 +1539,8 @@ static void delete_existing_an_headers(qfits_header* hdr) {
     qfits_header_del(hdr, "ANRDSORT");
     qfits_header_del(hdr, "ANVERUNI");
     qfits_header_del(hdr, "ANVERDUP");
+    qfits_header_del(hdr, "ANPVNREF");
+    qfits_header_del(hdr, "ANPVMIN");
     qfits_header_del(hdr, "ANODDSTU");
     qfits_header_del(hdr, "ANODDSSL");
     qfits_header_del(hdr, "ANODDSBL");
@@ -0,0 +1,172 @@
+/*
+ # This file is part of the Astrometry.net suite.
+ # Licensed under a 3-clause BSD style license - see LICENSE
+ */
+
+/*
+ Benchmark for verify_hit() on false-positive matches: a random star
+ catalog and a field of random stars, verified against many random
+ WCS hypotheses, once matching the reference stars through the
+ field-star grid built by verify_field_preprocess() and once through
+ a kdtree built over the reference stars for each hypothesis.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "verify.h"
+#include "starkd.h"
+#include "starxy.h"
+#include "matchobj.h"
+#include "starutil.h"
+#include "mathutil.h"
+#include "tic.h"
+
+static const char* OPTIONS = "hn:f:k:w:s:";
+
+static void printHelp(char* progname) {
+	printf("Usage: %s\n"
+		   "   [-n <number of catalog stars>] (default 200000)\n"
+		   "   [-f <number of field stars>] (default 1000)\n"
+		   "   [-k <number of hypotheses>] (default 2000)\n"
+		   "   [-w <image width and height, pixels>] (default 2000)\n"
+		   "   [-s <pixel scale, arcsec>] (default 2)\n"
+		   "\n", progname);
+}
+
+static double uniform(double lo, double hi) {
+	return lo + (hi - lo) * rand() / (double)RAND_MAX;
+}
+
+static void random_hypothesis(MatchObj* mo, double W, double pixscale,
+							  double capradius) {
+	tan_t* wcs = &mo->wcstan;
+	double corner[3];
+	double theta = uniform(0, 2.0 * M_PI);
+	double s = arcsec2deg(pixscale);
+	int i;
+
+	memset(mo, 0, sizeof(MatchObj));
+	wcs->crval[0] = uniform(-capradius, capradius);
+	wcs->crval[1] = uniform(-capradius, capradius);
+	wcs->crpix[0] = wcs->crpix[1] = 0.5 * W;
+	wcs->cd[0][0] = -s * cos(theta);
+	wcs->cd[0][1] =  s * sin(theta);
+	wcs->cd[1][0] =  s * sin(theta);
+	wcs->cd[1][1] =  s * cos(theta);
+	wcs->imagew = wcs->imageh = W;
+	mo->wcs_valid = TRUE;
+	mo->scale = pixscale;
+	mo->dimquads = 4;
+	for (i=0; i<4; i++) {
+		// field stars 0-3 play the quad; no ref star does.
+		mo->field[i] = i;
+		mo->star[i] = -1;
+	}
+	tan_pixelxy2xyzarr(wcs, 0.5 * W, 0.5 * W, mo->center);
+	tan_pixelxy2xyzarr(wcs, 0, 0, corner);
+	mo->radius = sqrt(distsq(mo->center, corner, 3));
+}
+
+static double run(startree_t* skdt, const verify_field_t* vf,
+				  const MatchObj* hyps, int K, double W, double* p_sumodds) {
+	double t0 = timenow();
+	double sumodds = 0.0;
+	int k;
+	for (k=0; k<K; k++) {
+		MatchObj mo = hyps[k];
+		verify_hit(skdt, 8, &mo, NULL, vf, 1.0, 0.25, W, W,
+				   log(1e-100), log(1e9), HUGE_VAL, TRUE, FALSE);
+		if (isfinite(mo.logodds))
+			sumodds += mo.logodds;
+		verify_free_matchobj(&mo);
+	}
+	*p_sumodds = sumodds;
+	return timenow() - t0;
+}
+
+int main(int argc, char** argv) {
+	int argchar;
+	int N = 200000;
+	int NF = 1000;
+	int K = 2000;
+	double W = 2000;
+	double pixscale = 2.0;
+	startree_t* skdt;
+	double* xyz;
+	starxy_t* field;
+	verify_field_t* vf;
+	struct verify_field_grid* grid;
+	MatchObj* hyps;
+	double capradius, tgrid, ttree, oddsgrid, oddstree;
+	int i;
+
+	while ((argchar = getopt(argc, argv, OPTIONS)) != -1)
+		switch (argchar) {
+		case 'n':
+			N = atoi(optarg);
+			break;
+		case 'f':
+			NF = atoi(optarg);
+			break;
+		case 'k':
+			K = atoi(optarg);
+			break;
+		case 'w':
+			W = atof(optarg);
+			break;
+		case 's':
+			pixscale = atof(optarg);
+			break;
+		case 'h':
+		default:
+			printHelp(argv[0]);
+			exit(-1);
+		}
+
+	srand(0);
+	// catalog: a patch of sky a few fields across, around RA,Dec = 0,0.
+	capradius = 2.0 * arcsec2deg(pixscale) * W;
+	xyz = malloc((size_t)N * 3 * sizeof(double));
+	for (i=0; i<N; i++)
+		radecdeg2xyzarr(uniform(-1.5 * capradius, 1.5 * capradius),
+						uniform(-1.5 * capradius, 1.5 * capradius), xyz + 3*i);
+	skdt = startree_new();
+	skdt->tree = kdtree_build(NULL, xyz, N, 3, 10, KDTT_DOUBLE,
+							  KD_BUILD_BBOX | KD_BUILD_SPLIT);
+	skdt->sweep = malloc(N);
+	for (i=0; i<N; i++)
+		skdt->sweep[i] = rand() % 50;
+
+	field = starxy_new(NF, FALSE, FALSE);
+	for (i=0; i<NF; i++)
+		starxy_set(field, i, uniform(0, W), uniform(0, W));
+	vf = verify_field_preprocess(field);
+
+	hyps = malloc(K * sizeof(MatchObj));
+	for (i=0; i<K; i++)
+		random_hypothesis(hyps + i, W, pixscale, capradius);
+
+	printf("%i catalog stars, %i field stars, %i hypotheses, %g x %g pixels.\n",
+		   N, NF, K, W, W);
+
+	tgrid = run(skdt, vf, hyps, K, W, &oddsgrid);
+	printf("  field grid: %8.3f s, %8.1f us per hypothesis (sum of log-odds %g)\n",
+		   tgrid, 1e6 * tgrid / K, oddsgrid);
+
+	grid = vf->grid;
+	vf->grid = NULL;
+	ttree = run(skdt, vf, hyps, K, W, &oddstree);
+	vf->grid = grid;
+	printf("  ref kdtree: %8.3f s, %8.1f us per hypothesis (sum of log-odds %g)\n",
+		   ttree, 1e6 * ttree / K, oddstree);
+	printf("  speedup %.2f\n", ttree / tgrid);
+
+	free(hyps);
+	verify_field_free(vf);
+	starxy_free(field);
+	startree_close(skdt);
+	return 0;
+}
@@ -161,9 +161,10 @@ static anbool grab_field_tagalong_data(MatchObj* mo, xylist_t* xy, int N) {
  but we should probably just assert that only one of these can be used.
  **/
 static index_t* get_index(blind_t* bp, size_t i) {
+    index_t* ind;
     if (i < sl_size(bp->indexnames)) {
         char* fn = sl_get(bp->indexnames, i);
-        index_t* ind = index_load(fn, bp->index_options, NULL);
+        ind = index_load(fn, bp->index_options, NULL);
         if (!ind) {
             ERROR("Failed to load index %s", fn);
             exit( -1);
@@ -171,7 +172,20 @@ static index_t* get_index(blind_t* bp, size_t i) {
         return ind;
     }
     i -= sl_size(bp->indexnames);
-    return pl_get(bp->indexes, i);
+    ind = pl_get(bp->indexes, i);
+    if (bp->index_acquire && !bp->indexes_inparallel &&
+        bp->index_acquire(ind, bp->index_token)) {
+        ERROR("Failed to load index %s", ind->indexname);
+        exit( -1);
+    }
+    return ind;
+}
+// The index's metadata, without loading it; NULL if it is only known by
+// filename (and has to be loaded to find out).
+static index_t* peek_index(blind_t* bp, size_t i) {
+    if (i < sl_size(bp->indexnames))
+        return NULL;
+    return pl_get(bp->indexes, i - sl_size(bp->indexnames));
 }
 static char* get_index_name(blind_t* bp, size_t i) {
     index_t* index;
@@ -186,6 +200,8 @@ static char* get_index_name(blind_t* bp, size_t i) {
 static void done_with_index(blind_t* bp, size_t i, index_t* ind) {
     if (i < sl_size(bp->indexnames)) {
         index_close(ind);
+    } else if (bp->index_release && !bp->indexes_inparallel) {
+        bp->index_release(ind, bp->index_token);
     }
 }
 static size_t n_indexes(blind_t* bp) {
@@ -323,7 +339,7 @@ static void check_time_limits(blind_t* bp) {
 		bp->hit_total_cpulimit ||
 		bp->hit_timelimit ||
 		bp->hit_cpulimit)
-		bp->solver.quit_now = TRUE;
+		solver_set_quit(&bp->solver);
 }
 
 void blind_run(blind_t* bp) {
@@ -400,7 +416,11 @@ void blind_run(blind_t* bp) {
 				   arcsec2arcmin(quadlo), arcsec2arcmin(quadhi));
 
 			for (I=0; I<Nindexes; I++) {
-                index_t* index = get_index(bp, I);
+                index_t* index = peek_index(bp, I);
+                // (don't load indexes of the wrong scale just to skip them.)
+                if (index && !index_overlaps_scale_range(index, quadlo, quadhi))
+                    continue;
+                index = get_index(bp, I);
                 if (!index_overlaps_scale_range(index, quadlo, quadhi)) {
                     done_with_index(bp, I, index);
                     continue;
@@ -442,6 +462,9 @@ void blind_run(blind_t* bp) {
             solver_add_index(sp, index);
 		}
 
+		// With several threads, search each index in its own thread.
+		sp->thread_per_index = TRUE;
+
 		// Record current CPU usage.
 		bp->cpu_start = get_cpu_usage();
 		// Record current wall-clock time.
@@ -535,7 +558,7 @@ int blind_parameters_are_sane(blind_t* bp, solver_t* sp) {
 		logerr("You must set a \"distractors\" proportion.\n");
 		return 0;
 	}
-	if (!(sl_size(bp->indexnames) || (bp->indexes_inparallel && pl_size(bp->indexes)))) {
+	if (!(sl_size(bp->indexnames) || pl_size(bp->indexes))) {
 		logerr("You must specify one or more indexes.\n");
 		return 0;
 	}
@@ -970,6 +993,8 @@ static void solve_fields(blind_t* bp, sip_t* verify_wcs) {
 		sp->numscaleok = 0;
 		sp->num_cxdx_skipped = 0;
 		sp->num_verified = 0;
+		sp->num_preverify_rejected = 0;
+		sp->num_verify_rejected = 0;
 		sp->quit_now = FALSE;
 		sp->mo_template = &template ;
 		sp->record_match_callback = record_match_callback;
@@ -46,6 +46,7 @@
 #include "log.h"
 #include "errors.h"
 #include "engine.h"
+#include "engine-server.h"
 #include "an-opts.h"
 #include "gslutils.h"
 
@@ -70,8 +71,16 @@ static an_option_t myopts[] = {
 	 "use the given index files (in addition to any specified in the config file); put in quotes to use wildcards, eg: \" -i 'index-*.fits' \""},
 	{'p', "in-parallel", no_argument, NULL,
 	 "run the index files in parallel"},
+	{'j', "threads", required_argument, "n",
+	 "use this many threads to search for quads in each field"},
 	{'D', "data-log file", required_argument, "file",
 	 "log data to the given filename"},
+	{'l', "listen", required_argument, "socket",
+	 "keep the indexes loaded and serve jobs over this UNIX-domain socket (eg, from solve-field --engine-socket) until interrupted.  Whoever can connect can run jobs as this user, reading and writing files wherever this user can, so by default only this user can connect"},
+	{'W', "max-jobs", required_argument, "n",
+	 "with --listen, run at most this many jobs at once (default 4)"},
+	{'m', "listen-mode", required_argument, "mode",
+	 "with --listen, give the socket these (octal) permissions, eg 660 to let this user's group connect too (default 600)"},
 };
 
 static void print_help(const char* progname, bl* opts) {
@@ -90,9 +99,6 @@ static void close_datalogfid() {
 }
 
 int main(int argc, char** args) {
-    char* default_configfn = "astrometry.cfg";
-    char* default_config_path = "../etc";
-
 	int c;
 	char* configfn = NULL;
 	int i;
@@ -109,6 +115,9 @@ int main(int argc, char** args) {
     char* infn = NULL;
     FILE* fin = NULL;
     anbool fromstdin = FALSE;
+    char* socketpath = NULL;
+    int maxjobs = 4;
+    int socketmode = ENGINE_SOCKET_MODE;
 
 	bl* opts = opts_from_array(myopts, sizeof(myopts)/sizeof(an_option_t), NULL);
 	sl* inds = sl_new(4);
@@ -125,9 +134,22 @@ int main(int argc, char** args) {
 		case 'D':
 			datalog = optarg;
 			break;
+		case 'l':
+			socketpath = optarg;
+			engine->keep_indexes_loaded = TRUE;
+			break;
+		case 'W':
+			maxjobs = atoi(optarg);
+			break;
+		case 'm':
+			socketmode = strtol(optarg, NULL, 8);
+			break;
 		case 'p':
 			engine->inparallel = TRUE;
 			break;
+		case 'j':
+			engine->nthreads = atoi(optarg);
+			break;
 		case 'i':
 			sl_append(inds, optarg);
 			break;
@@ -163,7 +185,7 @@ int main(int argc, char** args) {
 		}
 	}
 
-	if (optind == argc && !infn) {
+	if (optind == argc && !infn && !socketpath) {
 		// Need extra args: filename
 		printf("You must specify at least one input file!\n\n");
 		help = TRUE;
@@ -213,34 +235,8 @@ int main(int argc, char** args) {
     free(me);
 
 	// Read config file
-    if (!configfn) {
-        int i;
-        sl* trycf = sl_new(4);
-        sl_appendf(trycf, "%s/%s/%s", mydir, default_config_path, default_configfn);
-        // if I'm in /usr/bin, look for config file in /etc
-        if (streq(mydir, "/usr/bin")) {
-            sl_appendf(trycf, "/etc/%s", default_configfn);
-        }
-        sl_appendf(trycf, "%s/%s", mydir, default_configfn);
-        sl_appendf(trycf, "./%s", default_configfn);
-        sl_appendf(trycf, "./%s/%s", default_config_path, default_configfn);
-        for (i=0; i<sl_size(trycf); i++) {
-            char* cf = sl_get(trycf, i);
-            if (file_exists(cf)) {
-                configfn = strdup(cf);
-                logverb("Using config file \"%s\"\n", cf);
-                break;
-            } else {
-                logverb("Config file \"%s\" doesn't exist.\n", cf);
-            }
-        }
-        if (!configfn) {
-            char* cflist = sl_join(trycf, "\n  ");
-            logerr("Couldn't find config file: tried:\n  %s\n", cflist);
-            free(cflist);
-        }
-        sl_free2(trycf);
-    }
+	if (!configfn)
+		configfn = engine_find_config_file(mydir);
 
 	if (!streq(configfn, "none")) {
 		if (engine_parse_config_file(engine, configfn)) {
@@ -269,32 +265,23 @@ int main(int argc, char** args) {
 		}
 	}
 
-	if (!pl_size(engine->indexes)) {
-		logerr("\n\n"
-			   "---------------------------------------------------------------------\n"
-			   "You must list at least one index in the config file (%s)\n\n"
-			   "See http://astrometry.net/use.html about how to get some index files.\n"
-			   "---------------------------------------------------------------------\n"
-			   "\n", configfn);
+	if (engine_finish_config(engine, configfn))
 		exit(-1);
-	}
-
-	if (engine->minwidth <= 0.0 || engine->maxwidth <= 0.0) {
-		logerr("\"minwidth\" and \"maxwidth\" in the config file %s must be positive!\n", configfn);
-		exit(-1);
-	}
 
     free(configfn);
 
-    if (!il_size(engine->default_depths)) {
-        parse_depth_string(engine->default_depths,
-                           "10 20 30 40 50 60 70 80 90 100 "
-                           "110 120 130 140 150 160 170 180 190 200");
-    }
-
     engine->cancelfn = cancelfn;
     engine->solvedfn = solvedfn;
 
+    if (socketpath) {
+        if (engine_serve(engine, socketpath, maxjobs, socketmode))
+            exit(-1);
+        engine_free(engine);
+        sl_free2(strings);
+        sl_free2(inds);
+        return 0;
+    }
+
     i = optind;
     while (1) {
 		char* jobfn;
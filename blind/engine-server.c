@@ -0,0 +1,344 @@
+/*
+ # This file is part of the Astrometry.net suite.
+ # Licensed under a 3-clause BSD style license - see LICENSE
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "engine-server.h"
+#include "engine.h"
+#include "ioutils.h"
+#include "fileutils.h"
+#include "tic.h"
+#include "log.h"
+#include "errors.h"
+
+static volatile sig_atomic_t server_quit = 0;
+
+static void handle_quit(int sig) {
+	server_quit = 1;
+}
+
+static int make_address(const char* socketpath, struct sockaddr_un* addr) {
+	memset(addr, 0, sizeof(struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+	if (strlen(socketpath) >= sizeof(addr->sun_path)) {
+		ERROR("Socket path \"%s\" is too long", socketpath);
+		return -1;
+	}
+	strcpy(addr->sun_path, socketpath);
+	return 0;
+}
+
+// Copies an "axy-data" payload to a temp file; returns its name.
+static char* receive_axy(FILE* fin, size_t nbytes) {
+	char* fn;
+	FILE* fout;
+	char buf[65536];
+
+	fn = create_temp_file("engine-axy", NULL);
+	if (!fn)
+		return NULL;
+	fout = fopen(fn, "wb");
+	if (!fout) {
+		SYSERROR("Failed to open temp file \"%s\"", fn);
+		free(fn);
+		return NULL;
+	}
+	while (nbytes) {
+		size_t n = MIN(nbytes, sizeof(buf));
+		if (fread(buf, 1, n, fin) != n) {
+			ERROR("Request ended in the middle of axy data");
+			fclose(fout);
+			unlink(fn);
+			free(fn);
+			return NULL;
+		}
+		if (fwrite(buf, 1, n, fout) != n) {
+			SYSERROR("Failed to write temp file \"%s\"", fn);
+			fclose(fout);
+			unlink(fn);
+			free(fn);
+			return NULL;
+		}
+		nbytes -= n;
+	}
+	if (fclose(fout)) {
+		SYSERROR("Failed to close temp file \"%s\"", fn);
+		unlink(fn);
+		free(fn);
+		return NULL;
+	}
+	return fn;
+}
+
+/*
+ Runs in the forked child, with stdout and stderr on the connection.
+ Returns the number of failed jobs, or -1 if the request was bad.
+ */
+static int serve_request(engine_t* engine, FILE* fin) {
+	sl* jobfns = sl_new(4);
+	sl* tempfns = sl_new(4);
+	char* outdir = NULL;
+	int loglvl = log_get_level();
+	int nfailed = 0;
+	int i;
+
+	while (1) {
+		char* line;
+		char* arg;
+		line = read_string_terminated(fin, "\n", 1, FALSE);
+		if (!line || !strlen(line)) {
+			ERROR("Request ended without \"solve\"");
+			free(line);
+			nfailed = -1;
+			goto bailout;
+		}
+		if (streq(line, "solve")) {
+			free(line);
+			break;
+		} else if (is_word(line, "cwd ", &arg)) {
+			if (chdir(arg)) {
+				SYSERROR("Failed to change to directory \"%s\"", arg);
+				free(line);
+				nfailed = -1;
+				goto bailout;
+			}
+		} else if (is_word(line, "dir ", &arg)) {
+			free(outdir);
+			outdir = strdup(arg);
+		} else if (is_word(line, "verbose ", &arg)) {
+			loglvl = atoi(arg);
+		} else if (is_word(line, "axy ", &arg)) {
+			sl_append(jobfns, arg);
+		} else if (is_word(line, "axy-data ", &arg)) {
+			char* fn = receive_axy(fin, (size_t)atol(arg));
+			if (!fn) {
+				free(line);
+				nfailed = -1;
+				goto bailout;
+			}
+			sl_append(jobfns, fn);
+			sl_append_nocopy(tempfns, fn);
+		} else {
+			ERROR("Unknown request line: \"%s\"", line);
+			free(line);
+			nfailed = -1;
+			goto bailout;
+		}
+		free(line);
+	}
+
+	log_set_level(loglvl);
+	for (i=0; i<sl_size(jobfns); i++) {
+		double t0 = timenow();
+		if (engine_run_job_file(engine, sl_get(jobfns, i), outdir))
+			nfailed++;
+		logverb("Spent %g seconds on this field.\n", timenow() - t0);
+	}
+
+ bailout:
+	for (i=0; i<sl_size(tempfns); i++)
+		unlink(sl_get(tempfns, i));
+	sl_free2(tempfns);
+	sl_free2(jobfns);
+	free(outdir);
+	return nfailed;
+}
+
+static void reap_children(int* nrunning, anbool block) {
+	while (*nrunning > 0) {
+		pid_t pid = waitpid(-1, NULL, block ? 0 : WNOHANG);
+		if (pid > 0) {
+			(*nrunning)--;
+			block = FALSE;
+			continue;
+		}
+		if (pid == -1 && errno == EINTR && !server_quit)
+			continue;
+		break;
+	}
+}
+
+int engine_serve(engine_t* engine, const char* socketpath, int maxjobs,
+				 int socketmode) {
+	struct sockaddr_un addr;
+	struct sigaction sa;
+	int sock;
+	int nrunning = 0;
+	mode_t oldmask;
+	int rtn;
+
+	if (maxjobs < 1)
+		maxjobs = 1;
+	if (make_address(socketpath, &addr))
+		return -1;
+
+	sock = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock == -1) {
+		SYSERROR("Failed to create socket");
+		return -1;
+	}
+	// a socket left behind by an engine that didn't shut down cleanly.
+	unlink(socketpath);
+	// nobody else may connect before the chmod.
+	oldmask = umask(0177);
+	rtn = bind(sock, (struct sockaddr*)&addr, sizeof(addr));
+	umask(oldmask);
+	if (rtn) {
+		SYSERROR("Failed to bind socket \"%s\"", socketpath);
+		close(sock);
+		return -1;
+	}
+	if (chmod(socketpath, socketmode)) {
+		SYSERROR("Failed to set the permissions of socket \"%s\" to %o",
+				 socketpath, socketmode);
+		close(sock);
+		unlink(socketpath);
+		return -1;
+	}
+	if (listen(sock, 16)) {
+		SYSERROR("Failed to listen on socket \"%s\"", socketpath);
+		close(sock);
+		unlink(socketpath);
+		return -1;
+	}
+
+	// no SA_RESTART: the signal has to interrupt accept().
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = handle_quit;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	// a client that hangs up early shouldn't kill its job's process.
+	signal(SIGPIPE, SIG_IGN);
+
+	logmsg("Listening on \"%s\" (mode %03o; up to %i jobs at once)\n",
+		   socketpath, socketmode, maxjobs);
+
+	while (!server_quit) {
+		int conn;
+		pid_t pid;
+
+		reap_children(&nrunning, FALSE);
+		if (nrunning >= maxjobs) {
+			reap_children(&nrunning, TRUE);
+			continue;
+		}
+		conn = accept(sock, NULL, NULL);
+		if (conn == -1) {
+			if (errno == EINTR)
+				continue;
+			SYSERROR("Failed to accept connection");
+			break;
+		}
+		fflush(NULL);
+		pid = fork();
+		if (pid == -1) {
+			SYSERROR("Failed to fork");
+			close(conn);
+			continue;
+		}
+		if (pid == 0) {
+			FILE* fin;
+			int nfailed;
+			close(sock);
+			signal(SIGINT, SIG_DFL);
+			signal(SIGTERM, SIG_DFL);
+			fin = fdopen(conn, "rb");
+			if (!fin ||
+				dup2(conn, STDOUT_FILENO) == -1 ||
+				dup2(conn, STDERR_FILENO) == -1) {
+				SYSERROR("Failed to set up connection");
+				_exit(-1);
+			}
+			log_to(stdout);
+			nfailed = serve_request(engine, fin);
+			printf("ENGINE-DONE %i\n", (nfailed < 0) ? 1 : nfailed);
+			fflush(stdout);
+			_exit(0);
+		}
+		nrunning++;
+		close(conn);
+		debug("Started job process %i; %i running\n", (int)pid, nrunning);
+	}
+
+	logmsg("Shutting down; waiting for %i running job%s\n", nrunning,
+		   (nrunning == 1) ? "" : "s");
+	close(sock);
+	unlink(socketpath);
+	server_quit = 0;
+	reap_children(&nrunning, TRUE);
+	return 0;
+}
+
+int engine_client_solve(const char* socketpath, const sl* axyfns,
+						int loglevel, FILE* fout) {
+	struct sockaddr_un addr;
+	int sock;
+	FILE* fsock;
+	char* cwd;
+	int i;
+	int nfailed = -1;
+
+	if (make_address(socketpath, &addr))
+		return -1;
+	sock = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock == -1) {
+		SYSERROR("Failed to create socket");
+		return -1;
+	}
+	if (connect(sock, (struct sockaddr*)&addr, sizeof(addr))) {
+		SYSERROR("Failed to connect to astrometry-engine at \"%s\"", socketpath);
+		close(sock);
+		return -1;
+	}
+	fsock = fdopen(sock, "r+b");
+	if (!fsock) {
+		SYSERROR("Failed to fdopen socket");
+		close(sock);
+		return -1;
+	}
+
+	cwd = getcwd(NULL, 0);
+	if (cwd)
+		fprintf(fsock, "cwd %s\n", cwd);
+	free(cwd);
+	fprintf(fsock, "verbose %i\n", loglevel);
+	for (i=0; i<sl_size(axyfns); i++)
+		fprintf(fsock, "axy %s\n", sl_get_const(axyfns, i));
+	fprintf(fsock, "solve\n");
+	if (fflush(fsock)) {
+		SYSERROR("Failed to send request to astrometry-engine");
+		fclose(fsock);
+		return -1;
+	}
+
+	while (1) {
+		char* line = read_string_terminated(fsock, "\n", 1, TRUE);
+		if (!line || !strlen(line)) {
+			free(line);
+			ERROR("astrometry-engine closed the connection before finishing");
+			break;
+		}
+		if (starts_with(line, "ENGINE-DONE ")) {
+			nfailed = atoi(line + strlen("ENGINE-DONE "));
+			free(line);
+			break;
+		}
+		fputs(line, fout);
+		fflush(fout);
+		free(line);
+	}
+	fclose(fsock);
+	return nfailed;
+}
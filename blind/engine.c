@@ -39,6 +39,8 @@
 #include "healpix.h"
 #include "sip-utils.h"
 #include "multiindex.h"
+#include "permutedsort.h"
+#include "bl-sort.h"
 
 void engine_add_search_path(engine_t* engine, const char* path) {
     sl_append(engine->index_paths, path);
@@ -130,6 +132,242 @@ int engine_autoindex_search_paths(engine_t* engine) {
     return 0;
 }
 
+/*
+ With "indexmem", the metadata-only indexes are loaded on first use and
+ stay loaded until the memory budget forces them out, least-recently-
+ used first.
+ */
+struct index_residency {
+	index_t* index;
+	// mmapped size while loaded
+	size_t nbytes;
+	unsigned int lastuse;
+	// number of blind runs currently searching it
+	int nusers;
+	int nhits;
+	int nloads;
+};
+
+static struct index_residency* find_residency(engine_t* engine,
+											  const index_t* index) {
+	int i;
+	if (!engine->residency)
+		return NULL;
+	for (i=0; i<bl_size(engine->residency); i++) {
+		struct index_residency* r = bl_access(engine->residency, i);
+		if (r->index == index)
+			return r;
+	}
+	return NULL;
+}
+
+static void trim_resident_indexes(engine_t* engine) {
+	size_t budget = (size_t)engine->indexmem * 1024 * 1024;
+	while (engine->resident_bytes > budget) {
+		struct index_residency* lru = NULL;
+		int i;
+		for (i=0; i<bl_size(engine->residency); i++) {
+			struct index_residency* r = bl_access(engine->residency, i);
+			if (!r->nbytes || r->nusers)
+				continue;
+			if (!lru || r->lastuse < lru->lastuse)
+				lru = r;
+		}
+		// everything that's loaded is in use.
+		if (!lru)
+			break;
+		logverb("Unloading index %s (%.1f MB)\n", lru->index->indexname,
+				lru->nbytes * 1e-6);
+		index_unload(lru->index);
+		engine->resident_bytes -= lru->nbytes;
+		lru->nbytes = 0;
+	}
+}
+
+static int acquire_index(index_t* index, void* token) {
+	engine_t* engine = token;
+	struct index_residency* r = find_residency(engine, index);
+	if (!r)
+		return 0;
+	r->lastuse = ++engine->residency_clock;
+	if (r->nbytes) {
+		r->nhits++;
+	} else {
+		double t0 = timenow();
+		if (index_reload(index) || index_close_fds(index))
+			return -1;
+		r->nloads++;
+		r->nbytes = index_get_mapped_size(index);
+		engine->resident_bytes += r->nbytes;
+		logverb("Loaded index %s (%.1f MB) in %g s; %.1f MB of indexes loaded\n",
+				index->indexname, r->nbytes * 1e-6, timenow() - t0,
+				engine->resident_bytes * 1e-6);
+	}
+	r->nusers++;
+	trim_resident_indexes(engine);
+	return 0;
+}
+
+static void release_index(index_t* index, void* token) {
+	engine_t* engine = token;
+	struct index_residency* r = find_residency(engine, index);
+	if (!r)
+		return;
+	r->nusers--;
+	trim_resident_indexes(engine);
+}
+
+static void log_index_residency(engine_t* engine) {
+	int i;
+	if (!engine->residency)
+		return;
+	logverb("Index residency (budget %i MB, %.1f MB loaded):\n",
+			engine->indexmem, engine->resident_bytes * 1e-6);
+	for (i=0; i<bl_size(engine->residency); i++) {
+		struct index_residency* r = bl_access(engine->residency, i);
+		if (!r->nhits && !r->nloads)
+			continue;
+		logverb("  %s: used %i times, loaded %i times%s\n", r->index->indexname,
+				r->nhits + r->nloads, r->nloads, r->nbytes ? " (loaded)" : "");
+	}
+}
+
+/*
+ For jobs with an RA,Dec hint: the indexes grouped by scale band (their
+ range of quad sizes), and within each band, by healpix, so that the
+ indexes near the hint are found without checking every index.
+ */
+struct index_band {
+	double scale_lower;
+	double scale_upper;
+	// healpix Nside of the band's healpix-split indexes; 0 if none.
+	int nside;
+	// for each healpix at "nside": il* of positions in engine->indexes
+	il** byhealpix;
+	// all-sky indexes, and any with another Nside: checked one by one
+	il* others;
+};
+
+static void free_index_bands(engine_t* engine) {
+	int i, j;
+	if (!engine->index_bands)
+		return;
+	for (i=0; i<bl_size(engine->index_bands); i++) {
+		struct index_band* band = bl_access(engine->index_bands, i);
+		if (band->byhealpix) {
+			for (j=0; j<12*band->nside*band->nside; j++)
+				if (band->byhealpix[j])
+					il_free(band->byhealpix[j]);
+			free(band->byhealpix);
+		}
+		il_free(band->others);
+	}
+	bl_free(engine->index_bands);
+	engine->index_bands = NULL;
+	engine->index_bands_n = 0;
+}
+
+static void build_index_bands(engine_t* engine) {
+	int i, j;
+	free_index_bands(engine);
+	engine->index_bands = bl_new(16, sizeof(struct index_band));
+	for (i=0; i<pl_size(engine->indexes); i++) {
+		index_t* index = pl_get(engine->indexes, i);
+		struct index_band* band = NULL;
+		for (j=0; j<bl_size(engine->index_bands); j++) {
+			band = bl_access(engine->index_bands, j);
+			if (band->scale_lower == index->index_scale_lower &&
+				band->scale_upper == index->index_scale_upper)
+				break;
+			band = NULL;
+		}
+		if (!band) {
+			struct index_band newband;
+			memset(&newband, 0, sizeof(newband));
+			newband.scale_lower = index->index_scale_lower;
+			newband.scale_upper = index->index_scale_upper;
+			newband.others = il_new(16);
+			band = bl_append(engine->index_bands, &newband);
+		}
+		if (index->healpix >= 0 && !band->nside) {
+			band->nside = index->hpnside;
+			band->byhealpix = calloc(12 * band->nside * band->nside, sizeof(il*));
+		}
+		if (index->healpix >= 0 && index->hpnside == band->nside &&
+			index->healpix < 12 * band->nside * band->nside) {
+			if (!band->byhealpix[index->healpix])
+				band->byhealpix[index->healpix] = il_new(4);
+			il_append(band->byhealpix[index->healpix], i);
+		} else
+			il_append(band->others, i);
+	}
+	engine->index_bands_n = pl_size(engine->indexes);
+	logverb("Grouped %i indexes into %zu scale bands\n",
+			engine->index_bands_n, bl_size(engine->index_bands));
+}
+
+int engine_find_indexes_near(engine_t* engine, double fmin, double fmax,
+							  double ra, double dec, double radius,
+							  il* indexlist) {
+	il* queue;
+	int noverlap = 0;
+	int i, j;
+
+	if (engine->index_bands_n != pl_size(engine->indexes))
+		build_index_bands(engine);
+	queue = il_new(256);
+	for (i=0; i<bl_size(engine->index_bands); i++) {
+		struct index_band* band = bl_access(engine->index_bands, i);
+		uint8_t* visited;
+		int npix;
+
+		if (fmin > band->scale_upper || fmax < band->scale_lower)
+			continue;
+
+		for (j=0; j<il_size(band->others); j++) {
+			int k = il_get(band->others, j);
+			noverlap++;
+			if (index_is_within_range(pl_get(engine->indexes, k), ra, dec, radius))
+				il_append(indexlist, k);
+		}
+		if (!band->nside)
+			continue;
+		for (j=0; j<12*band->nside*band->nside; j++)
+			if (band->byhealpix[j])
+				noverlap += il_size(band->byhealpix[j]);
+
+		// flood-fill out from the healpix containing the hint, through the
+		// healpixes within range.
+		npix = 12 * band->nside * band->nside;
+		visited = calloc(npix, 1);
+		il_remove_all(queue);
+		j = radecdegtohealpix(ra, dec, band->nside);
+		il_append(queue, j);
+		visited[j] = 1;
+		while (il_size(queue)) {
+			int neigh[8];
+			int nn, n;
+			int hp = il_pop(queue);
+			if (healpix_distance_to_radec(hp, band->nside, ra, dec, NULL) > radius)
+				continue;
+			if (band->byhealpix[hp])
+				il_append_list(indexlist, band->byhealpix[hp]);
+			nn = healpix_get_neighbours(hp, neigh, band->nside);
+			for (n=0; n<nn; n++) {
+				if (visited[neigh[n]])
+					continue;
+				visited[neigh[n]] = 1;
+				il_append(queue, neigh[n]);
+			}
+		}
+		free(visited);
+	}
+	il_free(queue);
+	// same order as a scan of engine->indexes.
+	bl_sort(indexlist, compare_ints_asc);
+	return noverlap;
+}
+
 static int add_index(engine_t* engine, index_t* ind) {
 	int k;
     // check that an index with the same id and healpix isn't already listed.
@@ -172,6 +410,7 @@ int engine_add_index(engine_t* engine, char* path) {
     char* quadpath = index_get_quad_filename(path);
     char* base = basename_safe(quadpath);
 	double t0;
+	int flags;
     free(quadpath);
 
     // check that an index with the same filename hasn't already been added.
@@ -189,8 +428,15 @@ int engine_add_index(engine_t* engine, char* path) {
     }
     free(base);
 
+	flags = ((engine->inparallel || engine->keep_indexes_loaded) ?
+			 0 : INDEX_ONLY_LOAD_METADATA) | engine->index_prefetch;
 	t0 = timenow();
-	ind = index_load(path, engine->inparallel ? 0 : INDEX_ONLY_LOAD_METADATA, NULL);
+	if (engine->indexcatfn && (flags & INDEX_ONLY_LOAD_METADATA)) {
+		if (!engine->indexcat)
+			engine->indexcat = index_catalog_open(engine->indexcatfn);
+		ind = index_catalog_load(engine->indexcat, path, flags);
+	} else
+		ind = index_load(path, flags, NULL);
 	debug("index_load(\"%s\") took %g ms\n", path, 1000 * (timenow() - t0));
 	if (!ind) {
 		ERROR("Failed to load index from path %s", path);
@@ -201,6 +447,15 @@ int engine_add_index(engine_t* engine, char* path) {
 		return -1;
 	}
 	pl_append(engine->free_indexes, ind);
+	if (engine->indexmem > 0 && !engine->inparallel &&
+		!engine->keep_indexes_loaded) {
+		struct index_residency r;
+		memset(&r, 0, sizeof(r));
+		r.index = ind;
+		if (!engine->residency)
+			engine->residency = bl_new(16, sizeof(struct index_residency));
+		bl_append(engine->residency, &r);
+	}
     return 0;
 }
 
@@ -208,13 +463,48 @@ static void add_index_to_blind(engine_t* engine, blind_t* bp,
                                int i) {
 	index_t* index;
 	index = pl_get(engine->indexes, i);
-    if (engine->inparallel) {
+    if (engine->inparallel || engine->keep_indexes_loaded ||
+        find_residency(engine, index)) {
         blind_add_loaded_index(bp, index);
     } else {
         blind_add_index(bp, index->indexname);
     }
 }
 
+// "ckdt-nodes skdt-data quads" -> INDEX_PREFETCH_* flags; empty: all.
+static int parse_prefetch_string(const char* str, int* flags) {
+	sl* words = sl_split(NULL, str, " ");
+	int i;
+	int rtn = 0;
+	*flags = 0;
+	for (i=0; i<sl_size(words); i++) {
+		char* w = sl_get(words, i);
+		if (!strlen(w))
+			continue;
+		if (streq(w, "all"))
+			*flags |= INDEX_PREFETCH_ALL;
+		else if (streq(w, "ckdt-nodes"))
+			*flags |= INDEX_PREFETCH_CODEKD_NODES;
+		else if (streq(w, "ckdt-data"))
+			*flags |= INDEX_PREFETCH_CODEKD_DATA;
+		else if (streq(w, "skdt-nodes"))
+			*flags |= INDEX_PREFETCH_STARKD_NODES;
+		else if (streq(w, "skdt-data"))
+			*flags |= INDEX_PREFETCH_STARKD_DATA;
+		else if (streq(w, "quads"))
+			*flags |= INDEX_PREFETCH_QUADS;
+		else {
+			logerr("Unknown index prefetch table type \"%s\": expected all, "
+				   "ckdt-nodes, ckdt-data, skdt-nodes, skdt-data, or quads\n", w);
+			rtn = -1;
+		}
+	}
+	if (!*flags)
+		*flags = INDEX_PREFETCH_ALL;
+	sl_free2(words);
+	return rtn;
+}
+
 int engine_parse_config_file(engine_t* engine, const char* fn) {
 	FILE* fconf;
     int rtn;
@@ -228,6 +518,64 @@ int engine_parse_config_file(engine_t* engine, const char* fn) {
     return rtn;
 }
 
+char* engine_find_config_file(const char* mydir) {
+    char* default_configfn = "astrometry.cfg";
+    char* default_config_path = "../etc";
+    char* configfn = NULL;
+    sl* trycf = sl_new(4);
+    int i;
+
+    sl_appendf(trycf, "%s/%s/%s", mydir, default_config_path, default_configfn);
+    // if I'm in /usr/bin, look for config file in /etc
+    if (streq(mydir, "/usr/bin")) {
+        sl_appendf(trycf, "/etc/%s", default_configfn);
+    }
+    sl_appendf(trycf, "%s/%s", mydir, default_configfn);
+    sl_appendf(trycf, "./%s", default_configfn);
+    sl_appendf(trycf, "./%s/%s", default_config_path, default_configfn);
+    for (i=0; i<sl_size(trycf); i++) {
+        char* cf = sl_get(trycf, i);
+        if (file_exists(cf)) {
+            configfn = strdup(cf);
+            logverb("Using config file \"%s\"\n", cf);
+            break;
+        } else {
+            logverb("Config file \"%s\" doesn't exist.\n", cf);
+        }
+    }
+    if (!configfn) {
+        char* cflist = sl_join(trycf, "\n  ");
+        logerr("Couldn't find config file: tried:\n  %s\n", cflist);
+        free(cflist);
+    }
+    sl_free2(trycf);
+    return configfn;
+}
+
+int engine_finish_config(engine_t* engine, const char* configfn) {
+	if (!pl_size(engine->indexes)) {
+		logerr("\n\n"
+			   "---------------------------------------------------------------------\n"
+			   "You must list at least one index in the config file (%s)\n\n"
+			   "See http://astrometry.net/use.html about how to get some index files.\n"
+			   "---------------------------------------------------------------------\n"
+			   "\n", configfn);
+		return -1;
+	}
+
+	if (engine->minwidth <= 0.0 || engine->maxwidth <= 0.0) {
+		logerr("\"minwidth\" and \"maxwidth\" in the config file %s must be positive!\n", configfn);
+		return -1;
+	}
+
+    if (!il_size(engine->default_depths)) {
+        parse_depth_string(engine->default_depths,
+                           "10 20 30 40 50 60 70 80 90 100 "
+                           "110 120 130 140 150 160 170 180 190 200");
+    }
+    return 0;
+}
+
 int engine_parse_config_file_stream(engine_t* engine, FILE* fconf) {
     sl* indices = sl_new(16);
     sl* mindices = sl_new(16);
@@ -272,6 +620,30 @@ int engine_parse_config_file_stream(engine_t* engine, FILE* fconf) {
             auto_index = TRUE;
 		} else if (is_word(line, "inparallel", &nextword)) {
 			engine->inparallel = TRUE;
+		} else if (is_word(line, "nthreads ", &nextword)) {
+			engine->nthreads = atoi(nextword);
+		} else if (is_word(line, "pquadmem ", &nextword)) {
+			engine->pquadmem = atoi(nextword);
+		} else if (is_word(line, "verifycache ", &nextword)) {
+			engine->verify_cache_size = atoi(nextword);
+		} else if (is_word(line, "preverify ", &nextword)) {
+			if (sscanf(nextword, "%i %i", &engine->preverify_nref,
+					   &engine->preverify_min_match) < 1 ||
+				engine->preverify_nref < 0 || engine->preverify_min_match < 0) {
+				ERROR("Failed to parse preverify line: \"%s\"", line);
+				rtn = -1;
+				goto done;
+			}
+		} else if (is_word(line, "prefetch", &nextword)) {
+			if (parse_prefetch_string(nextword, &engine->index_prefetch)) {
+				rtn = -1;
+				goto done;
+			}
+		} else if (is_word(line, "indexcatalog ", &nextword)) {
+			free(engine->indexcatfn);
+			engine->indexcatfn = strdup(nextword);
+		} else if (is_word(line, "indexmem ", &nextword)) {
+			engine->indexmem = atoi(nextword);
 		} else if (is_word(line, "minwidth ", &nextword)) {
 			engine->minwidth = atof(nextword);
 		} else if (is_word(line, "maxwidth ", &nextword)) {
@@ -374,6 +746,9 @@ int engine_parse_config_file_stream(engine_t* engine, FILE* fconf) {
         engine_autoindex_search_paths(engine);
     }
 
+    if (engine->indexcat)
+        index_catalog_write(engine->indexcat);
+
  done:
     sl_free2(indices);
     sl_free2(mindices);
@@ -424,6 +799,18 @@ int engine_run_job(engine_t* engine, job_t* job) {
 
     if (engine->inparallel)
         bp->indexes_inparallel = TRUE;
+    if (engine->nthreads > 1)
+        sp->nthreads = engine->nthreads;
+    if (engine->pquadmem > 0)
+        sp->pquad_mem_max = (size_t)engine->pquadmem * 1024 * 1024;
+    if (engine->verify_cache_size > 0)
+        sp->verify_cache_size = engine->verify_cache_size;
+    bp->index_options |= engine->index_prefetch;
+    if (engine->residency) {
+        bp->index_acquire = acquire_index;
+        bp->index_release = release_index;
+        bp->index_token = engine;
+    }
 
 	if (job->use_radec_center) {
 		logmsg("Only searching for solutions within %g degrees of RA,Dec (%g,%g)\n",
@@ -452,6 +839,7 @@ int engine_run_job(engine_t* engine, job_t* job) {
 			double app_max, app_min;
             int k;
             il* indexlist;
+            int noverlap;
 
 			// arcsec per pixel range
 			app_min = dl_get(job->scales, j * 2);
@@ -480,15 +868,24 @@ int engine_run_job(engine_t* engine, job_t* job) {
 
 			// Select the indices that should be checked.
             indexlist = il_new(16);
-			for (k = 0; k < pl_size(engine->indexes); k++) {
-				index_t* index = pl_get(engine->indexes, k);
-                if (!index_overlaps_scale_range(index, fmin, fmax))
-                    continue;
-                il_append(indexlist, k);
+			if (job->use_radec_center) {
+				noverlap = engine_find_indexes_near(engine, fmin, fmax,
+													job->ra_center,
+													job->dec_center,
+													job->search_radius,
+													indexlist);
+			} else {
+				for (k = 0; k < pl_size(engine->indexes); k++) {
+					index_t* index = pl_get(engine->indexes, k);
+					if (!index_overlaps_scale_range(index, fmin, fmax))
+						continue;
+					il_append(indexlist, k);
+				}
+				noverlap = il_size(indexlist);
 			}
 
 			// Use the (list of) smallest or largest indices if no other one fits.
-			if (!il_size(indexlist)) {
+			if (!noverlap) {
                 il* list = NULL;
                 if (fmin > engine->sizebiggest) {
                     list = engine->ibiggest;
@@ -541,6 +938,9 @@ int engine_run_job(engine_t* engine, job_t* job) {
 	logverb("meanx constraints: %i\n", sp->num_meanx_skipped);
 	logverb("RA,Dec constraints: %i\n", sp->num_radec_skipped);
 	logverb("AB scale constraints: %i\n", sp->num_abscale_skipped);
+	if (engine->residency)
+		logverb("%.1f MB of indexes loaded (budget %i MB)\n",
+				engine->resident_bytes * 1e-6, engine->indexmem);
 
  finish:
     solver_cleanup(sp);
@@ -624,6 +1024,9 @@ static anbool parse_job_from_qfits_header(const qfits_header* hdr, job_t* job) {
 
 	sp->verify_uniformize = qfits_header_getboolean(hdr, "ANVERUNI", sp->verify_uniformize);
 	sp->verify_dedup = qfits_header_getboolean(hdr, "ANVERDUP", sp->verify_dedup);
+	// (-1: the engine's default; see engine_read_job_file().)
+	sp->preverify_nref = qfits_header_getint(hdr, "ANPVNREF", -1);
+	sp->preverify_min_match = qfits_header_getint(hdr, "ANPVMIN", -1);
 
     val = qfits_header_getdouble(hdr, "ANPOSERR", 0.0);
     if (val > 0.0)
@@ -920,6 +1323,8 @@ engine_t* engine_new() {
 	engine->minwidth = 0.1;
 	engine->maxwidth = 180.0;
     engine->cpulimit = 600.0;
+	engine->preverify_nref = DEFAULT_PREVERIFY_NREF;
+	engine->preverify_min_match = DEFAULT_PREVERIFY_MIN_MATCH;
 	return engine;
 }
 
@@ -927,6 +1332,16 @@ void engine_free(engine_t* engine) {
 	int i;
     if (!engine)
         return;
+    log_index_residency(engine);
+    free_index_bands(engine);
+    if (engine->residency)
+        bl_free(engine->residency);
+    if (engine->indexcat) {
+        // (for indexes added after the config file)
+        index_catalog_write(engine->indexcat);
+        index_catalog_free(engine->indexcat);
+    }
+    free(engine->indexcatfn);
     if (engine->free_indexes) {
         for (i=0; i<pl_size(engine->free_indexes); i++) {
             index_t* ind = pl_get(engine->free_indexes, i);
@@ -986,6 +1401,12 @@ job_t* engine_read_job_file(engine_t* engine, const char* jobfn) {
         dl_append(job->scales, arcsecperpix);
     }
 
+    // If the job didn't set the quick check's bar, use the engine's.
+    if (bp->solver.preverify_nref < 0)
+        bp->solver.preverify_nref = engine->preverify_nref;
+    if (bp->solver.preverify_min_match < 0)
+        bp->solver.preverify_min_match = engine->preverify_min_match;
+
     // The job can only decrease the CPU limit.
     if ((bp->cpulimit == 0.0) || bp->cpulimit > engine->cpulimit) {
         logverb("Decreasing CPU time limit to the engine's limit of %g seconds\n",
@@ -1016,6 +1437,28 @@ job_t* engine_read_job_file(engine_t* engine, const char* jobfn) {
     return job;
 }
 
+int engine_run_job_file(engine_t* engine, const char* jobfn,
+						const char* outdir) {
+	job_t* job;
+	int rtn = 0;
+	logmsg("Reading file \"%s\"...\n", jobfn);
+	job = engine_read_job_file(engine, jobfn);
+	if (!job) {
+		ERROR("Failed to read job file \"%s\"", jobfn);
+		return -1;
+	}
+	if (outdir) {
+		logverb("Setting job's output base directory to %s\n", outdir);
+		job_set_output_base_dir(job, outdir);
+	}
+	if (engine_run_job(engine, job)) {
+		ERROR("Failed to run job \"%s\"", jobfn);
+		rtn = -1;
+	}
+	job_free(job);
+	return rtn;
+}
+
 void job_set_cancel_file(job_t* job, const char* fn) {
     blind_set_cancel_file(&(job->bp), fn);
 }
@@ -14,6 +14,7 @@
 #include "os-features.h"
 #include "image2xy-files.h"
 #include "image2xy.h"
+#include "anqfits.h"
 #include "fitsio.h"
 #include "ioutils.h"
 #include "simplexy.h"
@@ -34,6 +35,8 @@ int image2xy_files(const char* infn, const char* outfn,
 	int nhdus, hdutype, nimgs;
     char* str;
 	simplexy_t myparams;
+	// for reading the image in bands.
+	anqfits_t* anq = NULL;
 
 	if (params == NULL) {
 		memset(&myparams, 0, sizeof(simplexy_t));
@@ -142,36 +145,61 @@ int image2xy_files(const char* infn, const char* outfn,
 		else if (naxis > 2)
             logmsg("This looks like a multi-color image: processing the first image plane only.  (NAXIS=%i)\n", naxis);
 		
-        if (bitpix == 8 && do_u8 && !downsample) {
-			simplexy_fill_in_defaults_u8(params);
-
-            // u8 image.
-            params->image_u8 = malloc(naxisn[0] * naxisn[1]);
-            if (!params->image_u8) {
-                SYSERROR("Failed to allocate u8 image array");
-                goto bailout;
+		if (params->bandrows > 0) {
+			int pnum = (naxis == 3) ? fpixel[2] - 1 : 0;
+			free(fpixel);
+			// the bands are read as floats, but a u8 image still gets the
+			// u8 detection thresholds, as it would unbanded.
+			if (bitpix == 8 && do_u8)
+				simplexy_fill_in_defaults_u8(params);
+			else
+				simplexy_fill_in_defaults(params);
+			if (!anq) {
+				anq = anqfits_open(infn);
+				if (!anq) {
+					ERROR("Failed to open FITS input file %s", infn);
+					goto bailout;
+				}
+			}
+			if (downsample || downsample_as_required)
+				logmsg("Not downsampling: the image is read in bands of %i rows.\n",
+					   params->bandrows);
+			if (image2xy_run_stream(params, anq, kk - 1, pnum)) {
+				ERROR("Failed to find sources in HDU %i", kk);
+				goto bailout;
+			}
+		} else {
+            if (bitpix == 8 && do_u8 && !downsample) {
+				simplexy_fill_in_defaults_u8(params);
+
+                // u8 image.
+                params->image_u8 = malloc(naxisn[0] * naxisn[1]);
+                if (!params->image_u8) {
+                    SYSERROR("Failed to allocate u8 image array");
+                    goto bailout;
+                }
+                fits_read_pix(fptr, TBYTE, fpixel, naxisn[0]*naxisn[1], NULL,
+                              params->image_u8, NULL, &status);
+
+            } else {
+				simplexy_fill_in_defaults(params);
+
+                params->image = malloc(naxisn[0] * naxisn[1] * sizeof(float));
+                if (!params->image) {
+                    SYSERROR("Failed to allocate image array");
+                    goto bailout;
+                }
+                fits_read_pix(fptr, TFLOAT, fpixel, naxisn[0]*naxisn[1], NULL,
+                              params->image, NULL, &status);
             }
-            fits_read_pix(fptr, TBYTE, fpixel, naxisn[0]*naxisn[1], NULL,
-                          params->image_u8, NULL, &status);
+			free(fpixel);
+            CFITS_CHECK("Failed to read image pixels");
 
-        } else {
-			simplexy_fill_in_defaults(params);
+			params->nx = naxisn[0];
+			params->ny = naxisn[1];
 
-            params->image = malloc(naxisn[0] * naxisn[1] * sizeof(float));
-            if (!params->image) {
-                SYSERROR("Failed to allocate image array");
-                goto bailout;
-            }
-            fits_read_pix(fptr, TFLOAT, fpixel, naxisn[0]*naxisn[1], NULL,
-                          params->image, NULL, &status);
-        }
-		free(fpixel);
-        CFITS_CHECK("Failed to read image pixels");
-
-		params->nx = naxisn[0];
-		params->ny = naxisn[1];
-
-		image2xy_run(params, downsample, downsample_as_required);
+			image2xy_run(params, downsample, downsample_as_required);
+		}
 
 		if (params->Lorder)
 			ncols = 6;
@@ -263,12 +291,17 @@ int image2xy_files(const char* infn, const char* outfn,
 	fits_close_file(ofptr, &status);
     CFITS_CHECK("Failed to close FITS output file");
 
+    if (anq)
+        anqfits_close(anq);
+
     // for valgrind
 	simplexy_clean_cache();
 
 	return 0;
 
  bailout:
+    if (anq)
+        anqfits_close(anq);
     if (fptr)
         fits_close_file(fptr, &status);
     if (ofptr)
@@ -8,22 +8,25 @@
 #include <unistd.h>
 #include <assert.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "os-features.h"
 #include "image2xy-files.h"
+#include "dimage.h"
 #include "log.h"
 #include "errors.h"
 #include "ioutils.h"
 
-static const char* OPTIONS = "hi:Oo:8Hd:D:ve:B:S:M:s:p:P:bU:g:C:m:a:G:w:L:";
+static const char* OPTIONS = "hi:Oo:8Hd:D:ve:B:S:M:s:p:P:bU:g:C:m:a:G:w:L:t:R:fj:";
 
 static void printHelp() {
 	fprintf(stderr,
-			"Usage: image2xy [options] fitsname.fits \n"
+			"Usage: image2xy [options] fitsname.fits [more.fits ...]\n"
 			"\n"
 			"Read a FITS file, find objects, and write out \n"
 			"X, Y, FLUX to   fitsname.xy.fits .\n"
+			"Given several files, write an xylist for each.\n"
 			"\n"
             "   [-e <extension>]: read from a single FITS extension\n"
 			"   [-O]  overwrite existing output file.\n"
@@ -40,8 +43,13 @@ static void printHelp() {
 			"   [-a <saddle-sigmas>]: set \"saddle\" level joining peaks (default %g sigmas)\n"
 			"   [-P <image plane>]: pull out a single plane of a multi-color image (default: first plane)\n"
 			"   [-b]: don't do (median-based) background subtraction\n"
+			"   [-f]: estimate the background from binned (approximate) medians: faster\n"
 			"   [-G <background>]: subtract this 'global' background value; implies -b\n"
 			"   [-m]: set maximum extended object size for deblending (default %i pixels)\n"
+			"   [-t <threads>]: run the source extraction on this many threads (default 1)\n"
+			"   [-j <workers>]: process several input files this many at a time (default 1)\n"
+			"   [-R <rows>]: read the image in bands of this many rows, to save memory on\n"
+			"                very large images (no downsampling or intermediate images)\n"
 			"\n"
 			"   [-S <background-subtracted image>]: save background-subtracted image to this filename (FITS float image)\n"
 			"   [-B <background image>]: save background image to filename\n"
@@ -63,10 +71,129 @@ static void printHelp() {
 }
 
 
+// What to do to each input file.
+struct image2xy_opts {
+	int overwrite;
+	anbool do_u8;
+	int downsample;
+	int downsample_as_reqd;
+	int extension;
+	int plane;
+	simplexy_t params;
+};
+
+static int process_file(const char* infn, const char* outfn,
+						const struct image2xy_opts* opts,
+						simplexy_workspace_t* ws) {
+	char* deffn = NULL;
+	// a fresh copy of the parameters, so that what's found in one file
+	// (eg, the noise level) isn't assumed in the next.
+	simplexy_t params = opts->params;
+	int rtn;
+
+	logverb("infile=%s\n", infn);
+	if (!outfn) {
+		// Create xylist filename (by trimming '.fits')
+		asprintf_safe(&deffn, "%.*s.xy.fits", (int)(strlen(infn)-5), infn);
+		outfn = deffn;
+		logverb("outfile=%s\n", outfn);
+	}
+
+	if (opts->overwrite && file_exists(outfn)) {
+		logverb("Deleting existing output file \"%s\"...\n", outfn);
+		if (unlink(outfn)) {
+			SYSERROR("Failed to delete existing output file \"%s\"", outfn);
+			free(deffn);
+			return -1;
+		}
+	}
+
+	if (opts->downsample)
+		logverb("Downsampling by %i\n", opts->downsample);
+
+	params.workspace = ws;
+	rtn = image2xy_files(infn, outfn, opts->do_u8, opts->downsample,
+						 opts->downsample_as_reqd, opts->extension, opts->plane,
+						 &params);
+	free(deffn);
+	return rtn;
+}
+
+// Processes every "step"th file, starting with "first", reusing one set
+// of simplexy buffers.  Returns the number that failed.
+static int process_files(char** infns, int ninputs, int first, int step,
+						 const struct image2xy_opts* opts) {
+	simplexy_workspace_t* ws = simplexy_workspace_new();
+	int nfailed = 0;
+	int i;
+	for (i=first; i<ninputs; i+=step) {
+		if (process_file(infns[i], NULL, opts, ws)) {
+			ERROR("image2xy failed on \"%s\"", infns[i]);
+			nfailed++;
+		}
+	}
+	simplexy_workspace_free(ws);
+	return nfailed;
+}
+
+/*
+ Deals the input files out to "nworkers" forked processes (rather than
+ threads, since CFITSIO can't be assumed to be thread-safe).  Returns
+ the number of files that failed.
+ */
+static int process_batch(char** infns, int ninputs, int nworkers,
+						 const struct image2xy_opts* opts) {
+	pid_t* pids;
+	int nfailed = 0;
+	int w;
+
+	nworkers = MAX(1, MIN(nworkers, ninputs));
+	if (nworkers == 1)
+		return process_files(infns, ninputs, 0, 1, opts);
+
+	logverb("Processing %i files in %i worker processes\n", ninputs, nworkers);
+	pids = malloc(nworkers * sizeof(pid_t));
+	fflush(NULL);
+	for (w=0; w<nworkers; w++) {
+		pids[w] = fork();
+		if (pids[w] == 0) {
+			int n = process_files(infns, ninputs, w, nworkers, opts);
+			_exit(MIN(n, 255));
+		}
+		if (pids[w] == -1) {
+			SYSERROR("Failed to fork; processing worker %i's files here", w);
+			nfailed += process_files(infns, ninputs, w, nworkers, opts);
+			fflush(NULL);
+		}
+	}
+	for (w=0; w<nworkers; w++) {
+		int status;
+		if (pids[w] == -1)
+			continue;
+		if (waitpid(pids[w], &status, 0) == -1) {
+			SYSERROR("Failed to wait for worker process %i", (int)pids[w]);
+			nfailed++;
+			continue;
+		}
+		if (WIFEXITED(status))
+			nfailed += WEXITSTATUS(status);
+		else {
+			// it didn't say how far it got.
+			ERROR("Worker process %i was killed", (int)pids[w]);
+			nfailed++;
+		}
+	}
+	free(pids);
+	return nfailed;
+}
+
 int main(int argc, char *argv[]) {
     int argchar;
 	char* outfn = NULL;
-	char* infn;
+	int ninputs;
+	int nworkers = 1;
+	int nfailed;
+	struct image2xy_opts opts;
 	int overwrite = 0;
     int loglvl = LOG_MSG;
     anbool do_u8 = TRUE;
@@ -80,11 +207,23 @@ int main(int argc, char *argv[]) {
 
     memset(params, 0, sizeof(simplexy_t));
 
-    while ((argchar = getopt (argc, argv, OPTIONS)) != -1)
+    while ((argchar = getopt (argc, argv, OPTIONS)) != -1) {
         switch (argchar) {
 		case 'L':
 			params->Lorder = atoi(optarg);
 			break;
+		case 'j':
+			nworkers = atoi(optarg);
+			break;
+		case 't':
+			params->nthreads = atoi(optarg);
+			break;
+		case 'R':
+			params->bandrows = atoi(optarg);
+			break;
+		case 'f':
+			params->bgmedian = DMEDSMOOTH_BINNED;
+			break;
 		case 'w':
 			params->dpsf = atof(optarg);
 			break;
@@ -157,39 +296,43 @@ int main(int argc, char *argv[]) {
 			printHelp();
 			exit(0);
 		}
+    }
 
-	if (optind != argc - 1) {
+	ninputs = argc - optind;
+	if (ninputs < 1) {
 		printHelp();
 		exit(-1);
 	}
 
-	infn = argv[optind];
+	log_init(loglvl);
 
-    log_init(loglvl);
-    logverb("infile=%s\n", infn);
+	memset(&opts, 0, sizeof(opts));
+	opts.overwrite = overwrite;
+	opts.do_u8 = do_u8;
+	opts.downsample = downsample;
+	opts.downsample_as_reqd = downsample_as_reqd;
+	opts.extension = extension;
+	opts.plane = plane;
+	opts.params = *params;
 
-	if (!outfn) {
-		// Create xylist filename (by trimming '.fits')
-		asprintf_safe(&outfn, "%.*s.xy.fits", (int)(strlen(infn)-5), infn);
-        logverb("outfile=%s\n", outfn);
+	if (ninputs == 1) {
+		if (process_file(argv[optind], outfn, &opts, NULL)) {
+			ERROR("image2xy failed.");
+			exit(-1);
+		}
+		free(outfn);
+		return 0;
 	}
 
-	if (overwrite && file_exists(outfn)) {
-        logverb("Deleting existing output file \"%s\"...\n", outfn);
-        if (unlink(outfn)) {
-            SYSERROR("Failed to delete existing output file \"%s\"", outfn);
-            exit(-1);
-        }
+	if (outfn || params->bgimgfn || params->bgsubimgfn || params->maskimgfn ||
+		params->smoothimgfn || params->blobimgfn) {
+		ERROR("-o, -B, -S, -M, -U and -C take a single input file");
+		exit(-1);
+	}
+	nfailed = process_batch(argv + optind, ninputs, nworkers, &opts);
+	if (nfailed) {
+		ERROR("image2xy failed on %i of %i files.", nfailed, ninputs);
+		exit(-1);
 	}
-
-    if (downsample)
-        logverb("Downsampling by %i\n", downsample);
-
-    if (image2xy_files(infn, outfn, do_u8, downsample, downsample_as_reqd,
-					   extension, plane, params)) {
-        ERROR("image2xy failed.");
-        exit(-1);
-    }
-    free(outfn);
 	return 0;
 }
@@ -6,6 +6,8 @@
 #ifndef PQUAD_H
 #define PQUAD_H
 
+#include <stdint.h>
+
 /**
  This file is just required for testing purposes (of solver.c)
  */
@@ -19,9 +21,13 @@ struct potential_quad
 	double costheta, sintheta;
 	// (field pixel noise / quad scale in pixels)^2
 	double rel_field_noise2;
-	anbool* inbox;
+	// bit i of "inbox" is set if star i can be star C or D; its position
+	// in the code frame of AB is then (x[i], y[i]).  Only the stars in
+	// [0, ninbox) have been checked.
+	uint64_t* inbox;
 	int ninbox;
-	double* xy;
+	double* x;
+	double* y;
 };
 typedef struct potential_quad pquad;
 
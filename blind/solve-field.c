@@ -39,6 +39,8 @@
 #include "wcs-rd2xy.h"
 #include "new-wcs.h"
 #include "scamp.h"
+#include "engine-server.h"
+#include "engine.h"
 
 static an_option_t options[] = {
 	{'h', "help",		   no_argument, NULL,
@@ -56,6 +58,10 @@ static an_option_t options[] = {
      "use this config file for the \"astrometry-engine\" program"},
 	{'(', "batch",  no_argument, NULL,
 	 "run astrometry-engine once, rather than once per input file"},
+	{'\x94', "engine-socket", required_argument, "socket",
+	 "send the jobs to an \"astrometry-engine --listen\" running at this socket, rather than starting a new astrometry-engine"},
+	{'\x95', "in-process", no_argument, NULL,
+	 "solve in this process, reading the engine's config and index files once for all the input files, rather than starting astrometry-engine"},
 	{'f', "files-on-stdin", no_argument, NULL,
      "read filenames to solve on stdin, one per line"},
 	{'p', "no-plots",       no_argument, NULL,
@@ -508,8 +514,70 @@ static char* none_is_null(char* in) {
     return streq(in, "none") ? NULL : in;
 }
 
-static void run_engine(sl* engineargs) {
+/*
+ For --in-process: sets up the engine the way astrometry-engine would
+ (it lives alongside us, so looks for its config file in the same
+ places).
+ */
+static engine_t* start_engine(const char* configfn, const char* me) {
+	engine_t* engine = engine_new();
+	char* foundfn = NULL;
+	if (!configfn) {
+		char* mydir = (me ? dirname_safe(me) : strdup("."));
+		configfn = foundfn = engine_find_config_file(mydir);
+		free(mydir);
+		if (!configfn) {
+			engine_free(engine);
+			return NULL;
+		}
+	}
+	if (!streq(configfn, "none") && engine_parse_config_file(engine, configfn)) {
+		ERROR("Failed to parse (or encountered an error while interpreting) config file \"%s\"", configfn);
+		engine_free(engine);
+		free(foundfn);
+		return NULL;
+	}
+	if (engine_finish_config(engine, configfn)) {
+		engine_free(engine);
+		free(foundfn);
+		return NULL;
+	}
+	free(foundfn);
+	return engine;
+}
+
+static void run_engine(sl* engineargs, engine_t* engine, const char* enginesock,
+					   const sl* engineaxys, int loglvl) {
 	char* cmd;
+	if (engine) {
+		int nfailed = 0;
+		int i;
+		logmsg("Solving...\n");
+		for (i=0; i<sl_size(engineaxys); i++)
+			if (engine_run_job_file(engine, sl_get_const(engineaxys, i), NULL))
+				nfailed++;
+		if (nfailed) {
+			ERROR("engine failed (%i job%s)", nfailed, (nfailed == 1) ? "" : "s");
+			exit(-1);
+		}
+		fflush(NULL);
+		return;
+	}
+	if (enginesock) {
+		int nfailed;
+		logmsg("Solving...\n");
+		logverb("Sending %zu job%s to astrometry-engine at %s\n",
+				sl_size(engineaxys), (sl_size(engineaxys) == 1) ? "" : "s",
+				enginesock);
+		fflush(NULL);
+		nfailed = engine_client_solve(enginesock, engineaxys, loglvl, stdout);
+		if (nfailed) {
+			ERROR("engine failed (%i job%s)", nfailed, (nfailed == 1) ? "" : "s");
+			exit(-1);
+		}
+		fflush(NULL);
+		return;
+	}
 	cmd = sl_implode(engineargs, " ");
 	logmsg("Solving...\n");
 	logverb("Running:\n  %s\n", cmd);
@@ -712,6 +780,13 @@ int main(int argc, char** args) {
 	int rtn;
 	sl* engineargs;
 	int nbeargs;
+	// with --engine-socket: the (unescaped) axy filenames for the engine
+	sl* engineaxys;
+	char* enginesock = NULL;
+	// with --in-process
+	anbool inprocess = FALSE;
+	char* configfn = NULL;
+	engine_t* engine = NULL;
 	anbool fromstdin = FALSE;
 	anbool overwrite = FALSE;
 	anbool cont = FALSE;
@@ -754,6 +829,7 @@ int main(int argc, char** args) {
 
 	engineargs = sl_new(16);
 	append_executable(engineargs, "astrometry-engine", me);
+	engineaxys = sl_new(4);
 
 	// output filenames.
 	outfiles = sl_new(16);
@@ -825,6 +901,12 @@ int main(int argc, char** args) {
         case '\x91':
             allaxy->axyfn = optarg;
             break;
+		case '\x94':
+			enginesock = optarg;
+			break;
+		case '\x95':
+			inprocess = TRUE;
+			break;
         case '\x90':
             tempaxy = TRUE;
             break;
@@ -880,6 +962,7 @@ int main(int argc, char** args) {
 		case '\x89':
 			sl_append(engineargs, "--config");
 			append_escape(engineargs, optarg);
+			configfn = optarg;
 			break;
 		case 'f':
 			fromstdin = TRUE;
@@ -960,6 +1043,18 @@ int main(int argc, char** args) {
         }
 	}
 
+	if (inprocess && !just_augment) {
+		if (enginesock) {
+			ERROR("--in-process and --engine-socket can't be used together");
+			exit(-1);
+		}
+		engine = start_engine(configfn, me);
+		if (!engine) {
+			ERROR("Failed to set up the engine");
+			exit(-1);
+		}
+	}
+
 	// number of engine args not specific to a particular file
 	nbeargs = sl_size(engineargs);
 
@@ -1019,6 +1114,7 @@ int main(int argc, char** args) {
 		if (!engine_batch) {
 			// Remove arguments that might have been added in previous trips through this loop
 			sl_remove_from(engineargs,  nbeargs);
+			sl_remove_all(engineaxys);
 		}
 
 		// Choose the base path/filename for output files.
@@ -1296,6 +1392,7 @@ int main(int argc, char** args) {
         }
 
 		append_escape(engineargs, axy->axyfn);
+		sl_append(engineaxys, axy->axyfn);
 
 		if (file_readable(axy->wcsfn))
 			axy->wcs_last_mod = file_get_last_modified_time(axy->wcsfn);
@@ -1303,7 +1400,7 @@ int main(int argc, char** args) {
 			axy->wcs_last_mod = 0;
 
 		if (!engine_batch) {
-			run_engine(engineargs);
+			run_engine(engineargs, engine, enginesock, engineaxys, loglvl);
 			after_solved(axy, sf, makeplots, me, verbose,
 						 axy->tempdir, tempdirs, tempfiles, plotscale, bgfn);
 		} else {
@@ -1334,7 +1431,7 @@ int main(int argc, char** args) {
 	}
 
 	if (engine_batch) {
-		run_engine(engineargs);
+		run_engine(engineargs, engine, enginesock, engineaxys, loglvl);
 		for (i=0; i<bl_size(batchaxy); i++) {
 			augment_xylist_t* axy = bl_access(batchaxy, i);
 			solve_field_args_t* sf = bl_access(batchsf, i);
@@ -1365,6 +1462,8 @@ int main(int argc, char** args) {
 	sl_free2(tempfiles2);
 	sl_free2(tempdirs);
 	sl_free2(engineargs);
+	sl_free2(engineaxys);
+	engine_free(engine);
     free(me);
     augment_xylist_free_contents(allaxy);
 
@@ -10,6 +10,8 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <stdarg.h>
+#include <stddef.h>
+#include <pthread.h>
 
 #include "os-features.h"
 #include "ioutils.h"
@@ -29,6 +31,8 @@
 #include "quad-utils.h"
 #include "errors.h"
 #include "tweak2.h"
+#include "an-thread.h"
+#include "permutedsort.h"
 
 #if TESTING_TRYALLCODES
 #define DEBUGSOLVER 1
@@ -308,12 +312,6 @@ static const int NBACK = 2;
 
 static void find_field_boundaries(solver_t* solver);
 
-static inline double getx(const double* d, int ind) {
-	return d[ind*2];
-}
-static inline double gety(const double* d, int ind) {
-	return d[ind*2 + 1];
-}
 static inline void setx(double* d, int ind, double val) {
 	d[ind*2] = val;
 }
@@ -358,8 +356,32 @@ static void get_field_ll_corner(solver_t* s, double* lx, double* ly) {
     *ly = s->field_miny;
 }
 
+/*
+ The quit_now flags are set by one thread and polled by others (see
+ solver_run()), so they're only touched atomically.
+ */
+static inline anbool get_quit(const solver_t* s) {
+	return __atomic_load_n(&s->quit_now, __ATOMIC_RELAXED);
+}
+
+static inline void set_quit(solver_t* s, anbool quit) {
+	__atomic_store_n(&s->quit_now, quit, __ATOMIC_RELAXED);
+}
+
+void solver_set_quit(solver_t* s) {
+	set_quit(s, TRUE);
+}
+
+/*
+ Should we bail out?  Worker threads (see solver_run()) also have to
+ watch their parent's flag, since that's the one the callbacks set.
+ */
+static inline anbool solver_quitting(const solver_t* s) {
+	return get_quit(s) || (s->parent && get_quit(s->parent));
+}
+
 void solver_reset_counters(solver_t* s) {
-	s->quit_now = FALSE;
+	set_quit(s, FALSE);
 	s->have_best_match = FALSE;
 	s->best_match_solves = FALSE;
 	s->numtries = 0;
@@ -370,6 +392,8 @@ void solver_reset_counters(solver_t* s) {
 	s->num_radec_skipped = 0;
 	s->num_abscale_skipped = 0;
 	s->num_verified = 0;
+	s->num_preverify_rejected = 0;
+	s->num_verify_rejected = 0;
 }
 
 double solver_field_width(const solver_t* s) {
@@ -528,17 +552,42 @@ static void try_all_codes(const pquad* pq,
                           const int* fieldstars, int dimquad,
                           solver_t* solver, double tol2);
 
+/*
+ All the permutations of a quad's stars (for both parities, and both
+ orderings of the backbone stars) whose codes we look up in the code
+ tree with one batched range search.  With DQMAX = 5 there are at most
+ 2 x 2 x 3! of them.
+ */
+#define CODE_BATCH_MAX (2 * 2 * 6)
+struct code_batch {
+	int n;
+	int stars[CODE_BATCH_MAX][DQMAX];
+	double codes[CODE_BATCH_MAX * DCMAX];
+	anbool parity[CODE_BATCH_MAX];
+};
+typedef struct code_batch code_batch_t;
+
 static void try_all_codes_2(const int* fieldstars, int dimquad,
                             const double* code, solver_t* solver,
-                            anbool current_parity, double tol2);
+                            anbool current_parity, code_batch_t* batch);
 
 static void try_permutations(const int* origstars, int dimquad,
 							 const double* origcode,
 							 solver_t* solver, anbool current_parity,
-							 double tol2,
 							 int* stars, double* code,
 							 int slot, anbool* placed,
-							 kdtree_qres_t** presult);
+							 code_batch_t* batch);
+
+static void search_code_batch(const code_batch_t* batch, int dimquad,
+							  solver_t* solver, double tol2);
+
+static void free_code_results(kdtree_qres_t** results) {
+	int k;
+	for (k=0; k<CODE_BATCH_MAX; k++) {
+		kdtree_free_query(results[k]);
+		results[k] = NULL;
+	}
+}
 
 static void resolve_matches(kdtree_qres_t* krez, const double *field,
                             const int* fstars, int dimquads,
@@ -562,37 +611,174 @@ static void check_scale(pquad* pq, solver_t* s) {
 	pq->scale_ok = TRUE;
 }
 
+/*
+ The "inbox" bitmask: one bit per field star, 64 to a word.
+ */
+#define INBOX_WORD(i) ((i) >> 6)
+#define INBOX_BIT(i)  ((uint64_t)1 << ((i) & 63))
+
+static inline anbool inbox_get(const pquad* pq, int i) {
+	return (pq->inbox[INBOX_WORD(i)] & INBOX_BIT(i)) ? TRUE : FALSE;
+}
+static inline void inbox_set(pquad* pq, int i) {
+	pq->inbox[INBOX_WORD(i)] |= INBOX_BIT(i);
+}
+static inline void inbox_clear(pquad* pq, int i) {
+	pq->inbox[INBOX_WORD(i)] &= ~INBOX_BIT(i);
+}
+
+#if defined(__GNUC__)
+static inline int inbox_ctz(uint64_t w) {
+	return __builtin_ctzll(w);
+}
+static inline int inbox_popcount(uint64_t w) {
+	return __builtin_popcountll(w);
+}
+#else
+static inline int inbox_ctz(uint64_t w) {
+	int n = 0;
+	while (!(w & 1)) {
+		w >>= 1;
+		n++;
+	}
+	return n;
+}
+static inline int inbox_popcount(uint64_t w) {
+	int n = 0;
+	for (; w; w &= w - 1)
+		n++;
+	return n;
+}
+#endif
+
+// The number of inbox stars in [lo, hi).
+static int inbox_count(const pquad* pq, int lo, int hi) {
+	int w, wlo, whi, n = 0;
+	uint64_t bits;
+	if (lo >= hi)
+		return 0;
+	wlo = INBOX_WORD(lo);
+	whi = INBOX_WORD(hi - 1);
+	for (w = wlo; w <= whi; w++) {
+		bits = pq->inbox[w];
+		if (w == wlo)
+			bits &= ~(uint64_t)0 << (lo & 63);
+		if (w == whi && (hi & 63))
+			bits &= ~(~(uint64_t)0 << (hi & 63));
+		n += inbox_popcount(bits);
+	}
+	return n;
+}
+
+/*
+ check_inbox() works on blocks of PQ_BLOCK stars, so the "x" and "y"
+ arrays are padded to a multiple of that; PQ_BLOCK divides 64, so a
+ block never straddles two words of the bitmask.
+ */
+#define PQ_BLOCK 4
+
+static int pquad_padded_n(int numxy) {
+	return (numxy + PQ_BLOCK - 1) / PQ_BLOCK * PQ_BLOCK;
+}
+
+static size_t pquad_item_size(int numxy) {
+	int n = pquad_padded_n(numxy);
+	return 2 * n * sizeof(double) + (INBOX_WORD(n - 1) + 1) * sizeof(uint64_t);
+}
+
+/*
+ Projects the PQ_BLOCK stars at (fx, fy) into the code frame of the AB
+ pair: A at the origin, rotated and scaled by (costheta, sintheta).
+ Stores the projected positions in (x, y) and returns a bitmask of the
+ ones that lie inside the circle through A and B.
+ */
+#if defined(__GNUC__)
+typedef double pq_vec __attribute__((vector_size(PQ_BLOCK * sizeof(double))));
+typedef int64_t pq_mask __attribute__((vector_size(PQ_BLOCK * sizeof(int64_t))));
+
+static inline unsigned int project_block(const double* fx, const double* fy,
+										 double Ax, double Ay,
+										 double costheta, double sintheta,
+										 double maxr, double* x, double* y) {
+	pq_vec cx, cy, px, py, r;
+	pq_mask ok;
+	unsigned int bits = 0;
+	int j;
+	memcpy(&cx, fx, sizeof(pq_vec));
+	memcpy(&cy, fy, sizeof(pq_vec));
+	cx -= Ax;
+	cy -= Ay;
+	px = cx * costheta + cy * sintheta;
+	py = -cx * sintheta + cy * costheta;
+	r = (px * px - px) + (py * py - py);
+	ok = (r <= maxr);
+	memcpy(x, &px, sizeof(pq_vec));
+	memcpy(y, &py, sizeof(pq_vec));
+	for (j=0; j<PQ_BLOCK; j++)
+		bits |= (ok[j] & 1) << j;
+	return bits;
+}
+#else
+static inline unsigned int project_block(const double* fx, const double* fy,
+										 double Ax, double Ay,
+										 double costheta, double sintheta,
+										 double maxr, double* x, double* y) {
+	unsigned int bits = 0;
+	int j;
+	for (j=0; j<PQ_BLOCK; j++) {
+		double cx = fx[j] - Ax;
+		double cy = fy[j] - Ay;
+		double r;
+		x[j] = cx * costheta + cy * sintheta;
+		y[j] = -cx * sintheta + cy * costheta;
+		r = (x[j] * x[j] - x[j]) + (y[j] * y[j] - y[j]);
+		if (r <= maxr)
+			bits |= 1 << j;
+	}
+	return bits;
+}
+#endif
+
+/*
+ Checks which of the inbox stars in [start, ninbox) are inside the
+ circle, clearing the bits of the ones that aren't.  Whole blocks are
+ projected, so a few stars before "start" may be recomputed (with the
+ same results).
+ */
 static void check_inbox(pquad* pq, int start, solver_t* solver) {
+	const double* fx = solver->fieldxy->x;
+	const double* fy = solver->fieldxy->y;
+	int N = starxy_n(solver->fieldxy);
+	double Ax, Ay, tol, maxr;
 	int i;
-	double Ax, Ay;
 	field_getxy(solver, pq->fieldA, &Ax, &Ay);
-	// check which C, D points are inside the circle.
-	for (i = start; i < pq->ninbox; i++) {
-		double r;
-		double Cx, Cy, xxtmp;
-		double tol = solver->codetol;
-		if (!pq->inbox[i])
-			continue;
-		field_getxy(solver, i, &Cx, &Cy);
-		Cx -= Ax;
-		Cy -= Ay;
-		xxtmp = Cx;
-		Cx = Cx * pq->costheta + Cy * pq->sintheta;
-		Cy = -xxtmp * pq->sintheta + Cy * pq->costheta;
-
-		// make sure it's in the circle centered at (0.5, 0.5)
-		// with radius 1/sqrt(2) (plus codetol for fudge):
-		// (x-1/2)^2 + (y-1/2)^2   <=   (r + codetol)^2
-		// x^2-x+1/4 + y^2-y+1/4   <=   (1/sqrt(2) + codetol)^2
-		// x^2-x + y^2-y + 1/2     <=   1/2 + sqrt(2)*codetol + codetol^2
-		// x^2-x + y^2-y           <=   sqrt(2)*codetol + codetol^2
-		r = (Cx * Cx - Cx) + (Cy * Cy - Cy);
-		if (r > (tol * (M_SQRT2 + tol))) {
-			pq->inbox[i] = FALSE;
+	// make sure it's in the circle centered at (0.5, 0.5)
+	// with radius 1/sqrt(2) (plus codetol for fudge):
+	// (x-1/2)^2 + (y-1/2)^2   <=   (r + codetol)^2
+	// x^2-x+1/4 + y^2-y+1/4   <=   (1/sqrt(2) + codetol)^2
+	// x^2-x + y^2-y + 1/2     <=   1/2 + sqrt(2)*codetol + codetol^2
+	// x^2-x + y^2-y           <=   sqrt(2)*codetol + codetol^2
+	tol = solver->codetol;
+	maxr = tol * (M_SQRT2 + tol);
+	for (i = start - (start % PQ_BLOCK); i < pq->ninbox; i += PQ_BLOCK) {
+		unsigned int ok;
+		uint64_t* word = pq->inbox + INBOX_WORD(i);
+		if (!((*word >> (i & 63)) & ((1 << PQ_BLOCK) - 1)))
 			continue;
+		if (i + PQ_BLOCK <= N)
+			ok = project_block(fx + i, fy + i, Ax, Ay, pq->costheta,
+							   pq->sintheta, maxr, pq->x + i, pq->y + i);
+		else {
+			// the last, partial block.
+			double bx[PQ_BLOCK], by[PQ_BLOCK];
+			memset(bx, 0, sizeof(bx));
+			memset(by, 0, sizeof(by));
+			memcpy(bx, fx + i, (N - i) * sizeof(double));
+			memcpy(by, fy + i, (N - i) * sizeof(double));
+			ok = project_block(bx, by, Ax, Ay, pq->costheta,
+							   pq->sintheta, maxr, pq->x + i, pq->y + i);
 		}
-		setx(pq->xy, i, Cx);
-		sety(pq->xy, i, Cy);
+		*word &= ~((uint64_t)(~ok & ((1 << PQ_BLOCK) - 1)) << (i & 63));
 	}
 }
 
@@ -601,7 +787,7 @@ static void print_inbox(pquad* pq) {
 	int i;
 	debug("[ ");
 	for (i = 0; i < pq->ninbox; i++) {
-		if (pq->inbox[i])
+		if (inbox_get(pq, i))
 			debug("%i ", i);
 	}
 	debug("] (n %i)\n", pq->ninbox);
@@ -610,6 +796,494 @@ static void print_inbox(pquad* pq) {
 static void print_inbox(pquad* pq) {}
 #endif
 
+/*
+ The AB-pair store.  Only the scale-OK pairs are kept: column A holds
+ the pairs (A,B), in order of B.  Each pair lives in a fixed-size slot
+ (its pquad followed by its "x", "y" and "inbox" arrays) carved out of
+ large blocks that are kept from field to field, so there is no heap
+ traffic per AB pair.
+
+ A slot only has room for the first "capacity" field stars.  All the
+ live pairs have the same "ninbox" (the stars seen so far), so they all
+ outgrow their slots at once: the capacity doubles, and the pairs are
+ moved to bigger slots, when the new star doesn't fit.  A deep field
+ only pays for slots as large as the stars it has reached.
+
+ The store is limited to "solver->pquad_mem_max" bytes.  When a new
+ "newpoint" might not fit, the oldest pairs (smallest B) are evicted,
+ a whole B at a time: after that, quads are only built from AB pairs
+ with B >= "Bmin", ie, within a window of the newest stars.
+ */
+#define PQUAD_ARENA_BLOCK (4 * 1024 * 1024)
+// the smallest slot capacity, in stars.
+#define PQUAD_MIN_CAPACITY 64
+
+struct pquad_arena {
+	// "ncolumns" lists of pquad*.
+	pl** columns;
+	int ncolumns;
+	// (single-threaded) the pairs (A, newpoint) for the possible A stars,
+	// or NULL.
+	pquad** diag;
+	// blocks of "blocksize" bytes, each holding whole slots.
+	pl* blocks;
+	size_t blocksize;
+	size_t slotsize;
+	// stars per slot, and the most a slot needs: the field's stars.
+	int capacity;
+	int maxcapacity;
+	// free slots, linked through their first word.
+	void* freeslots;
+	// the number of slots in use.
+	size_t nlive;
+	size_t maxmem;
+	// pairs with B < "Bmin" have been evicted.
+	int Bmin;
+	// the number of live pairs for each B.
+	int* nB;
+	int nnB;
+	// serializes allocations by the worker threads.
+	pthread_mutex_t lock;
+};
+
+static struct pquad_arena* pquad_arena_new() {
+	struct pquad_arena* arena = calloc(1, sizeof(struct pquad_arena));
+	arena->blocks = pl_new(16);
+	pthread_mutex_init(&arena->lock, NULL);
+	return arena;
+}
+
+static void pquad_free_blocks(pl* blocks) {
+	size_t i;
+	for (i=0; i<pl_size(blocks); i++)
+		free(pl_get(blocks, i));
+	pl_remove_all(blocks);
+}
+
+static void pquad_arena_free(struct pquad_arena* arena) {
+	int i;
+	if (!arena)
+		return;
+	pquad_free_blocks(arena->blocks);
+	pl_free(arena->blocks);
+	for (i=0; i<arena->ncolumns; i++)
+		pl_free(arena->columns[i]);
+	free(arena->columns);
+	free(arena->diag);
+	free(arena->nB);
+	pthread_mutex_destroy(&arena->lock);
+	free(arena);
+}
+
+static size_t pquad_slot_size(int capacity) {
+	return sizeof(pquad) + pquad_item_size(capacity);
+}
+
+// The slot capacity for pairs holding the first "ninbox" stars.
+static int pquad_arena_capacity(const struct pquad_arena* arena, int ninbox) {
+	int cap = PQUAD_MIN_CAPACITY;
+	while (cap < ninbox && cap < arena->maxcapacity)
+		cap *= 2;
+	return MIN(cap, arena->maxcapacity);
+}
+
+// Switches to (empty) slots of "capacity" stars.
+static void pquad_arena_set_capacity(struct pquad_arena* arena,
+									 int capacity) {
+	arena->capacity = capacity;
+	arena->slotsize = pquad_slot_size(capacity);
+	arena->blocksize = MAX(PQUAD_ARENA_BLOCK, arena->slotsize);
+	arena->freeslots = NULL;
+}
+
+/*
+ Readies the arena for a field with "numxy" stars, with room for at
+ most "maxmem" bytes of AB pairs.  Returns -1 if out of memory.
+ */
+static int pquad_arena_start(struct pquad_arena* arena, int numxy,
+							 size_t maxmem) {
+	size_t i;
+	int j;
+	if (numxy > arena->ncolumns) {
+		arena->columns = realloc(arena->columns, numxy * sizeof(pl*));
+		arena->diag = realloc(arena->diag, numxy * sizeof(pquad*));
+		arena->nB = realloc(arena->nB, numxy * sizeof(int));
+		if (!arena->columns || !arena->diag || !arena->nB) {
+			SYSERROR("Failed to allocate the AB-pair store for %i stars", numxy);
+			return -1;
+		}
+		for (j=arena->ncolumns; j<numxy; j++)
+			arena->columns[j] = pl_new(256);
+		arena->ncolumns = numxy;
+	}
+	for (j=0; j<numxy; j++) {
+		pl_remove_all(arena->columns[j]);
+		arena->diag[j] = NULL;
+		arena->nB[j] = 0;
+	}
+	arena->nnB = numxy;
+	// the blocks are kept if the smallest slots are the same size.
+	arena->maxcapacity = pquad_padded_n(MAX(numxy, 1));
+	j = pquad_arena_capacity(arena, 0);
+	if (pquad_slot_size(j) != arena->slotsize)
+		pquad_free_blocks(arena->blocks);
+	pquad_arena_set_capacity(arena, j);
+	// every slot is free again.
+	for (i=0; i<pl_size(arena->blocks); i++) {
+		char* block = pl_get(arena->blocks, i);
+		size_t k, nslots = arena->blocksize / arena->slotsize;
+		for (k=0; k<nslots; k++) {
+			void** slot = (void**)(block + k * arena->slotsize);
+			*slot = arena->freeslots;
+			arena->freeslots = slot;
+		}
+	}
+	arena->nlive = 0;
+	arena->maxmem = maxmem;
+	arena->Bmin = 0;
+	return 0;
+}
+
+// Takes a free slot, or returns NULL if out of memory.  (Call with the
+// arena locked.)
+static void* pquad_arena_take_slot(struct pquad_arena* arena) {
+	void** slot;
+	if (!arena->freeslots) {
+		size_t k, nslots = arena->blocksize / arena->slotsize;
+		char* block = malloc(arena->blocksize);
+		if (!block) {
+			SYSERROR("Failed to allocate a %zu-byte pquad block", arena->blocksize);
+			return NULL;
+		}
+		pl_append(arena->blocks, block);
+		for (k=0; k<nslots; k++) {
+			slot = (void**)(block + k * arena->slotsize);
+			*slot = arena->freeslots;
+			arena->freeslots = slot;
+		}
+	}
+	slot = arena->freeslots;
+	arena->freeslots = *slot;
+	return slot;
+}
+
+// Returns a slot for a pair with star "fieldB", or NULL if out of memory.
+static pquad* pquad_arena_alloc(struct pquad_arena* arena, int fieldB) {
+	pquad* pq;
+	pthread_mutex_lock(&arena->lock);
+	pq = pquad_arena_take_slot(arena);
+	if (pq) {
+		arena->nlive++;
+		arena->nB[fieldB]++;
+	}
+	pthread_mutex_unlock(&arena->lock);
+	return pq;
+}
+
+static void pquad_arena_release(struct pquad_arena* arena, pquad* pq) {
+	void** slot = (void**)pq;
+	pthread_mutex_lock(&arena->lock);
+	arena->nlive--;
+	arena->nB[pq->fieldB]--;
+	*slot = arena->freeslots;
+	arena->freeslots = slot;
+	pthread_mutex_unlock(&arena->lock);
+}
+
+// Points the pair's arrays into its slot, of "capacity" stars.
+static void pquad_set_arrays(pquad* pq, int capacity) {
+	pq->x = (double*)(pq + 1);
+	pq->y = pq->x + capacity;
+	pq->inbox = (uint64_t*)(pq->y + capacity);
+}
+
+/*
+ Moves all the live pairs into slots of "capacity" stars, and frees the
+ old blocks.  If that runs out of memory, all the pairs are evicted.
+ Not thread-safe; the workers must be idle.
+ */
+static void pquad_arena_grow(struct pquad_arena* arena, int capacity,
+							 int newpoint) {
+	pl* oldblocks = arena->blocks;
+	int oldcapacity = arena->capacity;
+	int A;
+	size_t j;
+
+	arena->blocks = pl_new(16);
+	pquad_arena_set_capacity(arena, capacity);
+	for (A=0; A<arena->nnB; A++) {
+		pl* col = arena->columns[A];
+		for (j=0; j<pl_size(col); j++) {
+			pquad* old = pl_get(col, j);
+			pquad* pq = pquad_arena_take_slot(arena);
+			if (!pq)
+				goto nomem;
+			*pq = *old;
+			pquad_set_arrays(pq, capacity);
+			memcpy(pq->x, old->x, oldcapacity * sizeof(double));
+			memcpy(pq->y, old->y, oldcapacity * sizeof(double));
+			memset(pq->inbox, 0, (INBOX_WORD(capacity - 1) + 1) *
+				   sizeof(uint64_t));
+			memcpy(pq->inbox, old->inbox, (INBOX_WORD(oldcapacity - 1) + 1) *
+				   sizeof(uint64_t));
+			pl_set(col, j, pq);
+		}
+	}
+	pquad_free_blocks(oldblocks);
+	pl_free(oldblocks);
+	return;
+
+ nomem:
+	logverb("Failed to grow the AB-pair store; dropping all pairs\n");
+	for (A=0; A<arena->nnB; A++) {
+		pl_remove_all(arena->columns[A]);
+		arena->nB[A] = 0;
+	}
+	arena->nlive = 0;
+	arena->Bmin = newpoint;
+	pquad_free_blocks(oldblocks);
+	pl_free(oldblocks);
+	pquad_free_blocks(arena->blocks);
+	arena->freeslots = NULL;
+}
+
+/*
+ Called before the new star "newpoint" is added (which can create up
+ to "newpoint" pairs), after which the pairs hold "ninbox" stars:
+ evicts the pairs with the smallest B until they will fit, and moves
+ the rest to bigger slots if need be.  Not thread-safe; the workers
+ must be idle.
+ */
+static void pquad_arena_make_room(struct pquad_arena* arena, int newpoint,
+								  int ninbox) {
+	int capacity = pquad_arena_capacity(arena, ninbox);
+	size_t slotsize = pquad_slot_size(capacity);
+	// while the pairs are being moved, the old slots are still in use.
+	size_t movesize = (capacity == arena->capacity) ? 0 :
+		(slotsize + arena->slotsize);
+	int A;
+	while ((((arena->nlive + newpoint) * slotsize > arena->maxmem) ||
+			(arena->nlive * movesize > arena->maxmem)) &&
+		   (arena->Bmin < newpoint)) {
+		int B = arena->Bmin;
+		if (arena->nB[B]) {
+			for (A=0; A<B; A++) {
+				pl* col = arena->columns[A];
+				size_t n = 0;
+				while (n < pl_size(col) &&
+					   ((pquad*)pl_get(col, n))->fieldB == B) {
+					pquad_arena_release(arena, pl_get(col, n));
+					n++;
+				}
+				if (n)
+					pl_remove_index_range(col, 0, n);
+			}
+		}
+		if (B == 0)
+			logverb("AB-pair store is full (%zu pairs of %i stars): only "
+					"building quads from recent pairs\n", arena->nlive,
+					capacity);
+		arena->Bmin++;
+	}
+	if (capacity != arena->capacity)
+		pquad_arena_grow(arena, capacity, newpoint);
+}
+
+/*
+ Creates the "pquad" for the pair of stars A,B and adds it to column A
+ if its scale is acceptable: allocates the "inbox", "x" and "y" arrays
+ and checks which of the first "ninbox" stars are eligible to be star
+ C or D.  Returns NULL if the scale isn't acceptable (or we're out of
+ memory).
+ */
+static pquad* new_pquad(int fieldA, int fieldB, int ninbox,
+						solver_t* solver) {
+	struct pquad_arena* arena = solver->pqarena;
+	pquad tmp;
+	pquad* pq;
+	tmp.fieldA = fieldA;
+	tmp.fieldB = fieldB;
+	debug("  trying A=%i, B=%i\n", fieldA, fieldB);
+	check_scale(&tmp, solver);
+	if (!tmp.scale_ok) {
+		debug("    bad scale for A=%i, B=%i\n", fieldA, fieldB);
+		return NULL;
+	}
+	pq = pquad_arena_alloc(arena, fieldB);
+	if (!pq)
+		// treat it like a bad scale.
+		return NULL;
+	*pq = tmp;
+	pquad_set_arrays(pq, arena->capacity);
+	// all the stars in [0, ninbox)...
+	memset(pq->inbox, 0, (INBOX_WORD(arena->capacity - 1) + 1) *
+		   sizeof(uint64_t));
+	memset(pq->inbox, 0xff, INBOX_WORD(ninbox) * sizeof(uint64_t));
+	if (ninbox & 63)
+		pq->inbox[INBOX_WORD(ninbox)] = ~(~(uint64_t)0 << (ninbox & 63));
+	pq->ninbox = ninbox;
+	// -except A and B.
+	inbox_clear(pq, fieldA);
+	inbox_clear(pq, fieldB);
+	check_inbox(pq, 0, solver);
+	debug("    inbox(A=%i, B=%i): ", fieldA, fieldB);
+	print_inbox(pq);
+	pl_append(arena->columns[fieldA], pq);
+	return pq;
+}
+
+/*
+ A grid over the field stars, for finding the stars that can be star A
+ for a given star B: those whose distance from B is within the range
+ of quad scales, [sqrt(minminAB2), sqrt(maxmaxAB2)].  Each cell lists
+ its stars in order, so the stars seen so far (< B) come first.
+ */
+struct star_grid {
+	double x0, y0;
+	double cellsize;
+	int nx, ny;
+	// the stars in cell c are cellstars[cellstart[c]] to
+	// cellstars[cellstart[c+1] - 1].
+	int* cellstart;
+	int* cellstars;
+};
+
+static int star_grid_cell(const struct star_grid* g, double x, double y) {
+	int cx = (int)floor((x - g->x0) / g->cellsize);
+	int cy = (int)floor((y - g->y0) / g->cellsize);
+	cx = MAX(0, MIN(g->nx - 1, cx));
+	cy = MAX(0, MIN(g->ny - 1, cy));
+	return cy * g->nx + cx;
+}
+
+static int star_grid_init(struct star_grid* g, solver_t* solver, int numxy) {
+	double minx = HUGE_VAL, maxx = -HUGE_VAL, miny = HUGE_VAL, maxy = -HUGE_VAL;
+	double rmax, w, h;
+	int i, ncells;
+
+	memset(g, 0, sizeof(struct star_grid));
+	for (i=0; i<numxy; i++) {
+		double x, y;
+		field_getxy(solver, i, &x, &y);
+		minx = MIN(minx, x);
+		maxx = MAX(maxx, x);
+		miny = MIN(miny, y);
+		maxy = MAX(maxy, y);
+	}
+	w = maxx - minx;
+	h = maxy - miny;
+	if (!isfinite(w) || !isfinite(h))
+		return -1;
+	// cells a quarter of the largest quad, but not many more cells than
+	// stars.
+	rmax = sqrt(solver->maxmaxAB2);
+	if (!isfinite(rmax) || (rmax > hypot(w, h)))
+		rmax = hypot(w, h);
+	g->cellsize = MAX(rmax / 4.0, sqrt(w * h / MAX(numxy, 1)));
+	g->cellsize = MAX(g->cellsize, MAX(w, h) / 1024.0);
+	if (!(g->cellsize > 0.0))
+		g->cellsize = 1.0;
+	g->x0 = minx;
+	g->y0 = miny;
+	g->nx = (int)(w / g->cellsize) + 1;
+	g->ny = (int)(h / g->cellsize) + 1;
+	ncells = g->nx * g->ny;
+
+	g->cellstart = calloc(ncells + 1, sizeof(int));
+	g->cellstars = malloc(MAX(numxy, 1) * sizeof(int));
+	if (!g->cellstart || !g->cellstars) {
+		free(g->cellstart);
+		free(g->cellstars);
+		return -1;
+	}
+	// counting sort, keeping the stars in order within each cell.
+	for (i=0; i<numxy; i++)
+		g->cellstart[star_grid_cell(g, field_getx(solver, i),
+									field_gety(solver, i)) + 1]++;
+	for (i=0; i<ncells; i++)
+		g->cellstart[i+1] += g->cellstart[i];
+	for (i=0; i<numxy; i++) {
+		int c = star_grid_cell(g, field_getx(solver, i), field_gety(solver, i));
+		g->cellstars[g->cellstart[c]++] = i;
+	}
+	for (i=ncells; i>0; i--)
+		g->cellstart[i] = g->cellstart[i-1];
+	g->cellstart[0] = 0;
+	return 0;
+}
+
+static void star_grid_free(struct star_grid* g) {
+	free(g->cellstart);
+	free(g->cellstars);
+	g->cellstart = g->cellstars = NULL;
+}
+
+/*
+ Writes into "cands", in increasing order, the stars A < "fieldB" that
+ might be at a scale-OK distance from star B: a superset of the ones
+ check_scale() accepts.  Returns the number of them.
+ */
+static int star_grid_find_A(const struct star_grid* g, solver_t* solver,
+							int fieldB, int* cands) {
+	double Bx, By, rmax;
+	int cx0, cx1, cy0, cy1, cx, cy;
+	int n = 0;
+	// be generous at the cell edges, so rounding can't lose a star.
+	double slack = 1e-6 * g->cellsize;
+
+	if (!g->cellstart) {
+		// no grid: all of them.
+		for (n = 0; n < fieldB; n++)
+			cands[n] = n;
+		return n;
+	}
+	field_getxy(solver, fieldB, &Bx, &By);
+	rmax = sqrt(solver->maxmaxAB2);
+	if (isfinite(rmax)) {
+		cx0 = (int)floor((Bx - rmax - g->x0) / g->cellsize);
+		cx1 = (int)floor((Bx + rmax - g->x0) / g->cellsize);
+		cy0 = (int)floor((By - rmax - g->y0) / g->cellsize);
+		cy1 = (int)floor((By + rmax - g->y0) / g->cellsize);
+		cx0 = MAX(cx0, 0);
+		cy0 = MAX(cy0, 0);
+		cx1 = MIN(cx1, g->nx - 1);
+		cy1 = MIN(cy1, g->ny - 1);
+	} else {
+		cx0 = cy0 = 0;
+		cx1 = g->nx - 1;
+		cy1 = g->ny - 1;
+	}
+	for (cy = cy0; cy <= cy1; cy++) {
+		for (cx = cx0; cx <= cx1; cx++) {
+			// the cell, including the stars clamped into the edge cells.
+			double lx = (cx == 0) ? -HUGE_VAL : g->x0 + cx * g->cellsize - slack;
+			double hx = (cx == g->nx-1) ? HUGE_VAL : g->x0 + (cx+1) * g->cellsize + slack;
+			double ly = (cy == 0) ? -HUGE_VAL : g->y0 + cy * g->cellsize - slack;
+			double hy = (cy == g->ny-1) ? HUGE_VAL : g->y0 + (cy+1) * g->cellsize + slack;
+			double dx, dy;
+			int c = cy * g->nx + cx;
+			int k;
+			// nearest point of the cell to B...
+			dx = MAX(0, MAX(lx - Bx, Bx - hx));
+			dy = MAX(0, MAX(ly - By, By - hy));
+			if (dx*dx + dy*dy > solver->maxmaxAB2)
+				continue;
+			// ... and farthest.
+			dx = MAX(Bx - lx, hx - Bx);
+			dy = MAX(By - ly, hy - By);
+			if (dx*dx + dy*dy < solver->minminAB2)
+				continue;
+			for (k = g->cellstart[c]; k < g->cellstart[c+1]; k++) {
+				if (g->cellstars[k] >= fieldB)
+					break;
+				cands[n++] = g->cellstars[k];
+			}
+		}
+	}
+	qsort(cands, n, sizeof(int), compare_ints_asc);
+	return n;
+}
+
 
 void solver_reset_field_size(solver_t* s) {
 	s->field_minx = s->field_maxx = s->field_miny = s->field_maxy = 0;
@@ -640,6 +1314,9 @@ void solver_preprocess_field(solver_t* solver) {
 
 	solver->vf->do_uniformize = solver->verify_uniformize;
 	solver->vf->do_dedup = solver->verify_dedup;
+	if (!solver->refcache && solver->verify_cache_size > 0)
+		solver->refcache = verify_refcache_new(solver->verify_cache_size);
+	solver->vf->refcache = solver->refcache;
 }
 
 void solver_free_field(solver_t* solver) {
@@ -687,7 +1364,7 @@ static void add_stars(const pquad* pq, int* field, int fieldoffset,
                       int n_to_add, int adding, int fieldtop,
                       int dimquad,
                       solver_t* solver, double tol2) {
-    int bottom;
+    int bottom, w;
     int* f = field + fieldoffset;
     // When we're adding the first star, we start from index zero.
     // When we're adding subsequent stars, we start from the previous value
@@ -697,36 +1374,497 @@ static void add_stars(const pquad* pq, int* field, int fieldoffset,
     // It looks funny that we're using f[adding] as a loop variable, but
     // it's required because try_all_codes needs to know which field stars
     // were used to create the quad (which are stored in the "f" array)
-    for (f[adding]=bottom; f[adding]<fieldtop; f[adding]++) {
-        if (!pq->inbox[f[adding]])
-            continue;
-        if (unlikely(solver->quit_now))
-            return;
-
-        // If we've hit the end of the recursion (we're adding the last star),
-        // call try_all_codes to try the quad we've built.
-        if (adding == n_to_add-1) {
-            // (when not testing, TRY_ALL_CODES is just try_all_codes.)
-            TRY_ALL_CODES(pq, field, dimquad, solver, tol2);
-        } else {
-            // Else recurse.
-            add_stars(pq, field, fieldoffset, n_to_add, adding+1,
-                      fieldtop, dimquad, solver, tol2);
+    //
+    // Only the inbox stars are visited: we walk the set bits of each
+    // word of the bitmask.
+    //
+    // There's no point going on if there aren't enough inbox stars left
+    // to finish the quad.
+    if (inbox_count(pq, bottom, fieldtop) < n_to_add - adding)
+        return;
+    for (w = INBOX_WORD(bottom); w <= INBOX_WORD(fieldtop - 1); w++) {
+        uint64_t bits = pq->inbox[w];
+        if (w == INBOX_WORD(bottom))
+            bits &= ~(uint64_t)0 << (bottom & 63);
+        for (; bits; bits &= bits - 1) {
+            f[adding] = w * 64 + inbox_ctz(bits);
+            if (f[adding] >= fieldtop)
+                return;
+            if (unlikely(solver_quitting(solver)))
+                return;
+
+            // If we've hit the end of the recursion (we're adding the last star),
+            // call try_all_codes to try the quad we've built.
+            if (adding == n_to_add-1) {
+                // (when not testing, TRY_ALL_CODES is just try_all_codes.)
+                TRY_ALL_CODES(pq, field, dimquad, solver, tol2);
+            } else {
+                // Else recurse.
+                add_stars(pq, field, fieldoffset, n_to_add, adding+1,
+                          fieldtop, dimquad, solver, tol2);
+            }
         }
     }
 }
 
+/*
+ The body of the "newpoint" loop in solver_run(), for a single star A,
+ as run by the worker threads: builds the pquad for A and the new star
+ (as star B), tries all quads with that backbone, then tries all quads
+ with A on the backbone and the new star as star C.
+
+ Only the pairs in column A are touched, so different A values can be
+ handled concurrently.
+ */
+static void try_newpoint_with_A(solver_t* solver, int numxy, int newpoint,
+                                int fieldA, const double* minAB2s,
+                                const double* maxAB2s) {
+	size_t i, num_indexes = pl_size(solver->indexes);
+	pl* column = solver->pqarena->columns[fieldA];
+	size_t j, ncol;
+	int field[DQMAX];
+	double tol2;
+	pquad* pq;
+
+	memset(field, 0, sizeof(field));
+	field[A] = fieldA;
+
+	// (the pairs already in the column, with B < newpoint.)
+	ncol = pl_size(column);
+
+	// quads with the new star on the diagonal:
+	field[B] = newpoint;
+	pq = new_pquad(field[A], field[B], newpoint + 1, solver);
+	if (pq) {
+		for (i = 0; i < num_indexes; i++) {
+			index_t* index = pl_get(solver->indexes, i);
+			int dimquads;
+			if ((pq->scale < minAB2s[i]) ||
+				(pq->scale > maxAB2s[i]))
+				continue;
+			set_index(solver, index);
+			dimquads = index_dimquads(index);
+			solver->rel_field_noise2 = pq->rel_field_noise2;
+			tol2 = get_tolerance(solver);
+			add_stars(pq, field, C, dimquads-2, 0, newpoint, dimquads, solver, tol2);
+			if (solver_quitting(solver))
+				return;
+		}
+	}
+
+	// quads with the new star not on the diagonal:
+	field[C] = newpoint;
+	for (j = 0; j < ncol; j++) {
+		pq = pl_get(column, j);
+		field[B] = pq->fieldB;
+		inbox_set(pq, field[C]);
+		pq->ninbox = field[C] + 1;
+		check_inbox(pq, field[C], solver);
+		if (!inbox_get(pq, field[C]))
+			continue;
+		solver->rel_field_noise2 = pq->rel_field_noise2;
+		for (i = 0; i < num_indexes; i++) {
+			index_t* index = pl_get(solver->indexes, i);
+			int dimquads;
+			if ((pq->scale < minAB2s[i]) ||
+				(pq->scale > maxAB2s[i]))
+				continue;
+			set_index(solver, index);
+			dimquads = index_dimquads(index);
+			tol2 = get_tolerance(solver);
+			if (dimquads > 3) {
+				add_stars(pq, field, D, dimquads-3, 0, newpoint, dimquads, solver, tol2);
+			} else {
+				TRY_ALL_CODES(pq, field, dimquads, solver, tol2);
+			}
+			if (solver_quitting(solver))
+				return;
+		}
+	}
+}
+
+// The solver_t counters that the worker threads increment.
+static const size_t solver_counter_offsets[] = {
+	offsetof(solver_t, numtries),
+	offsetof(solver_t, nummatches),
+	offsetof(solver_t, numscaleok),
+	offsetof(solver_t, num_cxdx_skipped),
+	offsetof(solver_t, num_meanx_skipped),
+	offsetof(solver_t, num_radec_skipped),
+	offsetof(solver_t, num_abscale_skipped),
+	offsetof(solver_t, num_verified),
+	offsetof(solver_t, num_preverify_rejected),
+	offsetof(solver_t, num_verify_rejected),
+};
+#define N_SOLVER_COUNTERS (sizeof(solver_counter_offsets) / sizeof(size_t))
+#define SOLVER_COUNTER(s, i) (*(int*)((char*)(s) + solver_counter_offsets[i]))
+
+struct solver_pool;
+
+struct solver_worker {
+	struct solver_pool* pool;
+	pthread_t thread;
+	// shallow copy of the parent solver, with its own scratch state.
+	solver_t solver;
+};
+
+/*
+ A pool of threads that, for each "newpoint", share out the A stars
+ (and hence the AB pairs) among themselves -- or, if "per_index" is
+ set, that each take whole indexes and run a complete search on them.
+ */
+struct solver_pool {
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	struct solver_worker* workers;
+	int nworkers;
+	// number of workers started
+	int nstarted;
+	// incremented each time a new round of work is posted.
+	int round;
+	// number of workers still working on this round.
+	int nbusy;
+	anbool finished;
+	anbool per_index;
+	// (per_index) the next index to hand out.
+	int nextindex;
+
+	// The current round of work.
+	int numxy;
+	int newpoint;
+	int nextA;
+	const double* minAB2s;
+	const double* maxAB2s;
+};
+typedef struct solver_pool solver_pool_t;
+
+// Serializes the record-match callback and best-match bookkeeping.
+AN_THREAD_DECLARE_STATIC_MUTEX(solver_hit_lock);
+
+/*
+ Has the search tried "maxquads" quads or found "maxmatches" matches?
+ A per-index instance (see solver_run_index_threads()) first adds what
+ it has done since the last call to its parent's shared totals, and
+ checks those.
+ */
+static anbool solver_hit_limits(solver_t* s) {
+	int ntries = s->numtries;
+	int nmatches = s->nummatches;
+	if (s->parent) {
+		solver_t* p = s->parent;
+		ntries = __atomic_add_fetch(&p->shared_numtries,
+									s->numtries - s->synced_numtries,
+									__ATOMIC_RELAXED);
+		nmatches = __atomic_add_fetch(&p->shared_nummatches,
+									  s->nummatches - s->synced_nummatches,
+									  __ATOMIC_RELAXED);
+		s->synced_numtries = s->numtries;
+		s->synced_nummatches = s->nummatches;
+	}
+	return ((s->maxquads && (ntries >= s->maxquads)) ||
+			(s->maxmatches && (nmatches >= s->maxmatches)));
+}
+
+static void* solver_worker_main(void* arg) {
+	struct solver_worker* w = arg;
+	solver_pool_t* pool = w->pool;
+	int lastround = 0;
+	kdtree_qres_t* coderesults[CODE_BATCH_MAX];
+
+	memset(coderesults, 0, sizeof(coderesults));
+	w->solver.coderesults = coderesults;
+
+	pthread_mutex_lock(&pool->lock);
+	while (1) {
+		while (pool->round == lastround && !pool->finished)
+			pthread_cond_wait(&pool->start, &pool->lock);
+		if (pool->finished)
+			break;
+		lastround = pool->round;
+		while ((pool->nextA < pool->newpoint) &&
+			   !solver_quitting(&w->solver)) {
+			int fieldA = pool->nextA++;
+			pthread_mutex_unlock(&pool->lock);
+			try_newpoint_with_A(&w->solver, pool->numxy, pool->newpoint,
+								fieldA, pool->minAB2s, pool->maxAB2s);
+			pthread_mutex_lock(&pool->lock);
+		}
+		pool->nbusy--;
+		if (pool->nbusy == 0)
+			pthread_cond_signal(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	free_code_results(coderesults);
+	return NULL;
+}
+
+/*
+ Worker thread for the "per_index" mode: repeatedly grab the next index
+ and run a whole (single-threaded) solver_run() on it, with our own
+ solver_t and pquad arrays.  The index itself is shared read-only.
+ */
+static void* solver_index_worker_main(void* arg) {
+	struct solver_worker* w = arg;
+	solver_pool_t* pool = w->pool;
+	solver_t* parent = w->solver.parent;
+	int nindexes = pl_size(parent->indexes);
+
+	while (1) {
+		int i;
+		pthread_mutex_lock(&pool->lock);
+		i = pool->nextindex++;
+		pthread_mutex_unlock(&pool->lock);
+		if (i >= nindexes || solver_quitting(&w->solver) ||
+			solver_hit_limits(&w->solver))
+			break;
+		pl_remove_all(w->solver.indexes);
+		pl_append(w->solver.indexes, pl_get(parent->indexes, i));
+		logverb("Solver thread: trying index %s\n",
+				((index_t*)pl_get(parent->indexes, i))->indexname);
+		solver_run(&w->solver);
+	}
+
+	pthread_mutex_lock(&pool->lock);
+	pool->nbusy--;
+	if (pool->nbusy == 0)
+		pthread_cond_signal(&pool->done);
+	pthread_mutex_unlock(&pool->lock);
+	return NULL;
+}
+
+static void solver_pool_free(solver_pool_t* pool) {
+	int i;
+	if (!pool)
+		return;
+	pthread_mutex_lock(&pool->lock);
+	pool->finished = TRUE;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+	for (i=0; i<pool->nstarted; i++)
+		pthread_join(pool->workers[i].thread, NULL);
+	if (pool->per_index)
+		for (i=0; i<pool->nworkers; i++) {
+			pl_free(pool->workers[i].solver.indexes);
+			pquad_arena_free(pool->workers[i].solver.pqarena);
+		}
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->done);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool->workers);
+	free(pool);
+}
+
+/*
+ Creates a pool of "nthreads" workers.  If "per_index" is set, the
+ workers start searching the indexes immediately (and "numxy",
+ "minAB2s" and "maxAB2s" are unused); otherwise they wait for
+ solver_pool_run() to hand them work.
+ */
+static solver_pool_t* solver_pool_new(solver_t* solver, int nthreads,
+									  anbool per_index, int numxy,
+									  const double* minAB2s,
+									  const double* maxAB2s) {
+	solver_pool_t* pool;
+	int i;
+
+	pool = calloc(1, sizeof(solver_pool_t));
+	pool->workers = calloc(nthreads, sizeof(struct solver_worker));
+	pool->nworkers = nthreads;
+	pool->per_index = per_index;
+	pool->numxy = numxy;
+	pool->minAB2s = minAB2s;
+	pool->maxAB2s = maxAB2s;
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+
+	for (i=0; i<nthreads; i++) {
+		struct solver_worker* w = pool->workers + i;
+		w->pool = pool;
+		memcpy(&w->solver, solver, sizeof(solver_t));
+		w->solver.parent = solver;
+		// the parent keeps the best match.
+		w->solver.have_best_match = FALSE;
+		if (per_index) {
+			w->solver.indexes = pl_new(1);
+			// each worker's solver_run() needs its own AB-pair store;
+			// they share the memory budget.
+			w->solver.pqarena = NULL;
+			w->solver.pquad_mem_max = solver->pquad_mem_max / nthreads;
+			// (the counters start from the parent's.)
+			w->solver.synced_numtries = solver->numtries;
+			w->solver.synced_nummatches = solver->nummatches;
+			// each worker searches single-threaded; the parent polls the timer.
+			w->solver.nthreads = 0;
+			w->solver.timer_callback = NULL;
+		}
+	}
+
+	pthread_mutex_lock(&pool->lock);
+	if (per_index)
+		pool->nbusy = nthreads;
+	for (i=0; i<nthreads; i++) {
+		struct solver_worker* w = pool->workers + i;
+		if (pthread_create(&w->thread, NULL, per_index ?
+						   solver_index_worker_main : solver_worker_main, w)) {
+			SYSERROR("Failed to create solver worker thread %i", i);
+			break;
+		}
+		pool->nstarted++;
+	}
+	if (per_index)
+		pool->nbusy -= (nthreads - pool->nstarted);
+	pthread_mutex_unlock(&pool->lock);
+
+	if (!pool->nstarted) {
+		solver_pool_free(pool);
+		return NULL;
+	}
+	if (!per_index)
+		pool->nworkers = pool->nstarted;
+	return pool;
+}
+
+/*
+ Adds the workers' counter increments (relative to the parent's
+ values, which they started from) back into the parent.
+ */
+static void solver_pool_merge_counters(solver_pool_t* pool, solver_t* solver) {
+	int i, k;
+	int totals[N_SOLVER_COUNTERS];
+	for (k=0; k<N_SOLVER_COUNTERS; k++)
+		totals[k] = SOLVER_COUNTER(solver, k);
+	for (i=0; i<pool->nstarted; i++) {
+		solver_t* ws = &(pool->workers[i].solver);
+		for (k=0; k<N_SOLVER_COUNTERS; k++)
+			totals[k] += SOLVER_COUNTER(ws, k) - SOLVER_COUNTER(solver, k);
+	}
+	for (k=0; k<N_SOLVER_COUNTERS; k++)
+		SOLVER_COUNTER(solver, k) = totals[k];
+}
+
+/*
+ Runs one "newpoint" of solver_run() on the worker threads, and waits
+ for them to finish.  The workers' counters start from the parent's
+ values, and their increments are added back to the parent afterward.
+ */
+static void solver_pool_run(solver_pool_t* pool, solver_t* solver,
+							int newpoint) {
+	int i, k;
+
+	pthread_mutex_lock(&pool->lock);
+	for (i=0; i<pool->nworkers; i++) {
+		solver_t* ws = &(pool->workers[i].solver);
+		set_quit(ws, FALSE);
+		ws->last_examined_object = newpoint;
+		for (k=0; k<N_SOLVER_COUNTERS; k++)
+			SOLVER_COUNTER(ws, k) = SOLVER_COUNTER(solver, k);
+	}
+	pool->newpoint = newpoint;
+	pool->nextA = 0;
+	pool->nbusy = pool->nworkers;
+	pool->round++;
+	pthread_cond_broadcast(&pool->start);
+	while (pool->nbusy)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	solver_pool_merge_counters(pool, solver);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/*
+ Runs each index in its own solver instance, "solver->nthreads" at a
+ time.  The first match accepted by the record-match callback sets our
+ quit_now flag, which cancels the other instances.  While waiting, we
+ call the timer callback (on this thread) as solver_run() would.
+
+ Returns -1 if no threads could be started.
+ */
+static int solver_run_index_threads(solver_t* solver) {
+	solver_pool_t* pool;
+	int i, nthreads;
+	int nindexes = pl_size(solver->indexes);
+	time_t next_timer_callback_time = time(NULL) + 1;
+
+	nthreads = MIN(solver->nthreads, nindexes);
+	solver->shared_numtries = solver->numtries;
+	solver->shared_nummatches = solver->nummatches;
+	pool = solver_pool_new(solver, nthreads, TRUE, 0, NULL, NULL);
+	if (!pool)
+		return -1;
+	logverb("Running %i indexes on %i threads\n", nindexes, pool->nstarted);
+
+	pthread_mutex_lock(&pool->lock);
+	while (pool->nbusy) {
+		struct timespec ts;
+		time_t now;
+		if (!solver->timer_callback) {
+			pthread_cond_wait(&pool->done, &pool->lock);
+			continue;
+		}
+		ts.tv_sec = next_timer_callback_time;
+		ts.tv_nsec = 0;
+		pthread_cond_timedwait(&pool->done, &pool->lock, &ts);
+		now = time(NULL);
+		if (pool->nbusy && now >= next_timer_callback_time) {
+			time_t delay;
+			pthread_mutex_unlock(&pool->lock);
+			// the callback shares the caller's state with record_match_callback.
+			AN_THREAD_LOCK(solver_hit_lock);
+			update_timeused(solver);
+			delay = solver->timer_callback(solver->userdata);
+			if (delay == 0) // Canceled
+				set_quit(solver, TRUE);
+			AN_THREAD_UNLOCK(solver_hit_lock);
+			next_timer_callback_time = now + MAX(delay, 1);
+			pthread_mutex_lock(&pool->lock);
+		}
+	}
+	solver_pool_merge_counters(pool, solver);
+	for (i=0; i<pool->nstarted; i++)
+		solver->last_examined_object = MAX(solver->last_examined_object,
+										   pool->workers[i].solver.last_examined_object);
+	pthread_mutex_unlock(&pool->lock);
+	solver_pool_free(pool);
+	if (nindexes)
+		set_index(solver, pl_get(solver->indexes, nindexes - 1));
+	return 0;
+}
 
 // The real deal
+static void log_verify_counts(solver_t* solver) {
+	int nhit, nmiss;
+	int nchecked = solver->num_verified + solver->num_preverify_rejected;
+	if (solver->parent)
+		return;
+	if (nchecked)
+		logverb("Verification: %i matches; %i (%.1f%%) rejected by the quick check, "
+				"%i (%.1f%%) by full verification.\n", nchecked,
+				solver->num_preverify_rejected,
+				100.0 * solver->num_preverify_rejected / nchecked,
+				solver->num_verify_rejected,
+				100.0 * solver->num_verify_rejected / nchecked);
+	if (!solver->refcache)
+		return;
+	verify_refcache_get_counts(solver->refcache, &nhit, &nmiss);
+	logverb("Verification reference-star cache: %i hits, %i misses.\n",
+			nhit, nmiss);
+}
+
 void solver_run(solver_t* solver) {
 	int numxy, newpoint;
 	double usertime, systime;
 	// first timer callback is called after 1 second
 	time_t next_timer_callback_time = time(NULL) + 1;
-	pquad* pquads;
+	struct pquad_arena* store;
+	struct star_grid grid;
+	// the possible A stars for the current B.
+	int* cands = NULL;
+	int ncands, k;
 	size_t i, num_indexes;
     double tol2;
     int field[DQMAX];
+	solver_pool_t* pool = NULL;
 
 	get_resource_stats(&usertime, &systime, NULL);
 
@@ -742,10 +1880,6 @@ void solver_run(solver_t* solver) {
 		numxy = solver->endobj;
 	if (solver->startobj >= numxy)
 		return;
-	if (numxy >= 1000) {
-		logverb("Limiting search to first 1000 objects\n");
-		numxy = 1000;
-	}
 
 	if (solver->set_crpix && solver->set_crpix_center) {
         solver->crpix[0] = wcs_pixel_center_for_size(solver_field_width(solver));
@@ -756,8 +1890,18 @@ void solver_run(solver_t* solver) {
 	}
 
 	num_indexes = pl_size(solver->indexes);
+
+	if (solver->nthreads > 1 && solver->thread_per_index &&
+		num_indexes > 1 && !solver->parent) {
+		if (solver_run_index_threads(solver) == 0) {
+			log_verify_counts(solver);
+			return;
+		}
+	}
+
 	{
 		double minAB2s[num_indexes];
+		kdtree_qres_t* coderesults[CODE_BATCH_MAX];
 		double maxAB2s[num_indexes];
 		solver->minminAB2 = HUGE_VAL;
 		solver->maxmaxAB2 = -HUGE_VAL;
@@ -798,24 +1942,44 @@ void solver_run(solver_t* solver) {
 		 MIN(M_PI, arcsec2rad(field_diag * solver->funits_upper)) ...
 		 */
 
-		pquads = calloc(numxy * numxy, sizeof(pquad));
+		if (!solver->pqarena)
+			solver->pqarena = pquad_arena_new();
+		store = solver->pqarena;
+		if (pquad_arena_start(store, numxy, solver->pquad_mem_max))
+			return;
 
-		/* We maintain an array of "potential quads" (pquad) structs, where
-		 * each struct corresponds to one choice of stars A and B; the struct
-		 * at index (B * numxy + A) holds information about quads that could be
-		 * created using stars A,B.
-		 *
-		 * (We only use the above-diagonal elements of this 2D array because
-		 * A<B.)
+		memset(coderesults, 0, sizeof(coderesults));
+		solver->coderesults = coderesults;
+
+		// rather than checking the scale of every pair, we only look at
+		// the A stars found in a grid.
+		if (star_grid_init(&grid, solver, numxy))
+			logverb("Failed to build a grid of the field stars; "
+					"checking all AB pairs.\n");
+		cands = malloc(MAX(numxy, 1) * sizeof(int));
+		if (!cands) {
+			SYSERROR("Failed to allocate %i candidate stars", numxy);
+			star_grid_free(&grid);
+			return;
+		}
+
+		/* We maintain a store of "potential quads" (pquad) structs, where
+		 * each struct corresponds to one choice of stars A and B, and holds
+		 * information about quads that could be created using stars A,B.
+		 * Only the AB pairs whose scale is acceptable are kept; "column" A
+		 * of the store lists the pairs (A,B), in order of B.  (A<B.)
 		 *
 		 * For each AB pair, we cache the scale and the rotation parameters,
-		 * and we keep an array "inbox" of length "numxy" of booleans, one for
+		 * and we keep a bitmask "inbox" of length "numxy", one bit for
 		 * each star, which say whether that star is eligible to be star C or D
 		 * of a quad with AB at the corners.  (Obviously A and B aren't
 		 * eligible).
 		 *
 		 * The "ninbox" parameter is somewhat misnamed - it says that "inbox"
 		 * elements in the range [0, ninbox) have been initialized.
+		 *
+		 * The store's memory is limited to "pquad_mem_max"; see
+		 * pquad_arena_make_room().
 		 */
 
 		/* (See explanatory paragraph below) If "solver->startobj" isn't zero,
@@ -824,29 +1988,20 @@ void solver_run(solver_t* solver) {
 		if (solver->startobj) {
 			debug("startobj > 0; priming pquad arrays.\n");
 			for (field[B] = 0; field[B] < solver->startobj; field[B]++) {
-				for (field[A] = 0; field[A] < field[B]; field[A]++) {
-					pquad* pq = pquads + field[B] * numxy + field[A];
-					pq->fieldA = field[A];
-					pq->fieldB = field[B];
-					debug("trying A=%i, B=%i\n", field[A], field[B]);
-					check_scale(pq, solver);
-					if (!pq->scale_ok) {
-						debug("  bad scale for A=%i, B=%i\n", field[A], field[B]);
-						continue;
-					}
-					pq->xy = malloc(numxy * 2 * sizeof(double));
-					pq->inbox = malloc(numxy * sizeof(anbool));
-					memset(pq->inbox, TRUE, solver->startobj);
-					pq->ninbox = solver->startobj;
-					pq->inbox[field[A]] = FALSE;
-					pq->inbox[field[B]] = FALSE;
-					check_inbox(pq, 0, solver);
-					debug("  inbox(A=%i, B=%i): ", field[A], field[B]);
-					print_inbox(pq);
-				}
+				pquad_arena_make_room(store, field[B], solver->startobj);
+				ncands = star_grid_find_A(&grid, solver, field[B], cands);
+				for (k = 0; k < ncands; k++)
+					new_pquad(cands[k], field[B], solver->startobj, solver);
 			}
 		}
 
+		if (solver->nthreads > 1) {
+			pool = solver_pool_new(solver, solver->nthreads, FALSE,
+								   numxy, minAB2s, maxAB2s);
+			if (pool)
+				logverb("Running solver with %i threads\n", pool->nworkers);
+		}
+
 		/* Each time through the "for" loop below, we consider a new star
 		 * ("newpoint").  First, we try building all quads that have the new
 		 * star on the diagonal (star B).  Then, we try building all quads that
@@ -877,35 +2032,30 @@ void solver_run(solver_t* solver) {
 			}
 
 			solver->last_examined_object = newpoint;
+
+			// make room for the pairs (A, newpoint).
+			pquad_arena_make_room(store, newpoint, newpoint + 1);
+
+			if (pool) {
+				// share out the A stars for this newpoint among the workers.
+				solver_pool_run(pool, solver, newpoint);
+				if (get_quit(solver))
+					goto quitnow;
+				goto next_newpoint;
+			}
+
 			// quads with the new star on the diagonal:
 			field[B] = newpoint;
 			debug("Trying quads with B=%i\n", newpoint);
 	
-            // first do an index-independent scale check...
-            for (field[A] = 0; field[A] < newpoint; field[A]++) {
-				// initialize the "pquad" struct for this AB combo.
-				pquad* pq = pquads + field[B] * numxy + field[A];
-				pq->fieldA = field[A];
-				pq->fieldB = field[B];
-				debug("  trying A=%i, B=%i\n", field[A], field[B]);
-				check_scale(pq, solver);
-				if (!pq->scale_ok) {
-					debug("    bad scale for A=%i, B=%i\n", field[A], field[B]);
-					continue;
-				}
-				// initialize the "inbox" array:
-				pq->inbox = malloc(numxy * sizeof(anbool));
-				pq->xy = malloc(numxy * 2 * sizeof(double));
-				// -try all stars up to "newpoint"...
-				assert(sizeof(anbool) == 1);
-				memset(pq->inbox, TRUE, newpoint + 1);
-				pq->ninbox = newpoint + 1;
-				// -except A and B.
-				pq->inbox[field[A]] = FALSE;
-				pq->inbox[field[B]] = FALSE;
-				check_inbox(pq, 0, solver);
-				debug("    inbox(A=%i, B=%i): ", field[A], field[B]);
-				print_inbox(pq);
+            // first do an index-independent scale check, of the A stars
+            // at about the right distance...
+			ncands = star_grid_find_A(&grid, solver, newpoint, cands);
+            for (k = 0; k < ncands; k++) {
+				// create the "pquad" struct for this AB combo;
+				// try all stars up to "newpoint".
+				store->diag[k] = new_pquad(cands[k], field[B], newpoint + 1,
+										   solver);
             }
 
             // Now iterate through the different indices
@@ -914,11 +2064,12 @@ void solver_run(solver_t* solver) {
                 int dimquads;
                 set_index(solver, index);
                 dimquads = index_dimquads(index);
-                for (field[A] = 0; field[A] < newpoint; field[A]++) {
-                    // initialize the "pquad" struct for this AB combo.
-                    pquad* pq = pquads + field[B] * numxy + field[A];
-					if (!pq->scale_ok)
+                for (k = 0; k < ncands; k++) {
+                    // grab the "pquad" struct for this AB combo.
+                    pquad* pq = store->diag[k];
+					if (!pq)
 						continue;
+					field[A] = cands[k];
                     if ((pq->scale < minAB2s[i]) ||
                         (pq->scale > maxAB2s[i]))
                         continue;
@@ -928,12 +2079,12 @@ void solver_run(solver_t* solver) {
 					// Now look at all sets of (C, D, ...) stars (subject to field[C] < field[D] < ...)
                     // ("dimquads - 2" because we've set stars A and B at this point)
                     add_stars(pq, field, C, dimquads-2, 0, newpoint, dimquads, solver, tol2);
-                    if (solver->quit_now)
+                    if (solver_quitting(solver))
                         goto quitnow;
 				}
 			}
 
-			if (solver->quit_now)
+			if (solver_quitting(solver))
 				goto quitnow;
 
 			// Now try building quads with the new star not on the diagonal:
@@ -941,18 +2092,21 @@ void solver_run(solver_t* solver) {
             // (in this loop field[C] > field[D])
 			debug("Trying quads with C=%i\n", newpoint);
 			for (field[A] = 0; field[A] < newpoint; field[A]++) {
-				for (field[B] = field[A] + 1; field[B] < newpoint; field[B]++) {
+				pl* column = store->columns[field[A]];
+				size_t j, ncol = pl_size(column);
+				// (the last pair in the column may be (A, newpoint).)
+				if (ncol &&
+					((pquad*)pl_get(column, ncol-1))->fieldB == newpoint)
+					ncol--;
+				for (j = 0; j < ncol; j++) {
 					// grab the "pquad" for this AB combo
-					pquad* pq = pquads + field[B] * numxy + field[A];
-					if (!pq->scale_ok) {
-						debug("  bad scale for A=%i, B=%i\n", field[A], field[B]);
-						continue;
-					}
+					pquad* pq = pl_get(column, j);
+					field[B] = pq->fieldB;
 					// test if this C is in the box:
-					pq->inbox[field[C]] = TRUE;
+					inbox_set(pq, field[C]);
 					pq->ninbox = field[C] + 1;
 					check_inbox(pq, field[C], solver);
-					if (!pq->inbox[field[C]]) {
+					if (!inbox_get(pq, field[C])) {
 						debug("  C is not in the box for A=%i, B=%i\n", field[A], field[B]);
 						continue;
 					}
@@ -980,27 +2134,29 @@ void solver_run(solver_t* solver) {
 						} else {
 							TRY_ALL_CODES(pq, field, dimquads, solver, tol2);
 						}
-						if (solver->quit_now)
+						if (solver_quitting(solver))
                             goto quitnow;
 					}
 				}
 			}
+		next_newpoint:
 			logverb("object %u of %u: %i quads tried, %i matched.\n",
 				   newpoint + 1, numxy, solver->numtries, solver->nummatches);
 
-			if ((solver->maxquads && (solver->numtries >= solver->maxquads))
-				|| (solver->maxmatches && (solver->nummatches >= solver->maxmatches))
-				|| solver->quit_now)
+			if (solver_hit_limits(solver) || solver_quitting(solver))
 				break;
 		}
 
 	quitnow:
-		for (i = 0; i < (numxy*numxy); i++) {
-			pquad* pq = pquads + i;
-			free(pq->inbox);
-			free(pq->xy);
-		}
-		free(pquads);
+		solver_pool_free(pool);
+		free_code_results(coderesults);
+		solver->coderesults = NULL;
+		if (pool && num_indexes)
+			set_index(solver, pl_get(solver->indexes, num_indexes - 1));
+		star_grid_free(&grid);
+		free(cands);
+		// the pair slots stay in the store for the next field.
+		log_verify_counts(solver);
 	}
 }
 
@@ -1015,6 +2171,7 @@ static void try_all_codes(const pquad* pq,
     double code[DCMAX];
     double flipcode[DCMAX];
     int i;
+	code_batch_t batch;
 
     solver->numtries++;
 
@@ -1025,10 +2182,12 @@ static void try_all_codes(const pquad* pq,
 	debug("]\n");
 
     for (i=0; i<dimquad-NBACK; i++) {
-        code[2*i  ] = getx(pq->xy, fieldstars[NBACK+i]);
-        code[2*i+1] = gety(pq->xy, fieldstars[NBACK+i]);
+        code[2*i  ] = pq->x[fieldstars[NBACK+i]];
+        code[2*i+1] = pq->y[fieldstars[NBACK+i]];
     }
 
+	batch.n = 0;
+
 	if (solver->parity == PARITY_NORMAL ||
 	        solver->parity == PARITY_BOTH) {
 
@@ -1037,7 +2196,7 @@ static void try_all_codes(const pquad* pq,
 			debug("%s%g", (i?", ":""), code[i]);
 		debug("].\n");
 
-		try_all_codes_2(fieldstars, dimquad, code, solver, FALSE, tol2);
+		try_all_codes_2(fieldstars, dimquad, code, solver, FALSE, &batch);
 	}
 	if (solver->parity == PARITY_FLIP ||
 	        solver->parity == PARITY_BOTH) {
@@ -1049,22 +2208,24 @@ static void try_all_codes(const pquad* pq,
 			debug("%s%g", (i?", ":""), flipcode[i]);
 		debug("].\n");
 
-		try_all_codes_2(fieldstars, dimquad, flipcode, solver, TRUE, tol2);
+		try_all_codes_2(fieldstars, dimquad, flipcode, solver, TRUE, &batch);
 	}
+
+	search_code_batch(&batch, dimquad, solver, tol2);
 }
 
 /**
- This function tries the quad with the "backbone" stars A and B in
- normal and flipped configurations.
+ Adds the permutations of this quad (for one parity) to the batch:
+ once with stars A,B as given, once with them swapped.
  */
 static void try_all_codes_2(const int* fieldstars, int dimquad,
                             const double* code, solver_t* solver,
-                            anbool current_parity, double tol2) {
+                            anbool current_parity, code_batch_t* batch) {
 	int i;
-	kdtree_qres_t* result = NULL;
     int dimcode = (dimquad - 2) * 2;
 	int stars[DQMAX];
 	double flipcode[DCMAX];
+	double permcode[DCMAX];
 
 	// We actually only use elements up to dimquads-2.
 	anbool placed[DQMAX];
@@ -1077,9 +2238,7 @@ static void try_all_codes_2(const int* fieldstars, int dimquad,
 		placed[i] = FALSE;
 
 	try_permutations(fieldstars, dimquad, code, solver, current_parity,
-					 tol2, stars, NULL, 0, placed, &result);
-	if (unlikely(solver->quit_now))
-		goto bailout;
+					 stars, permcode, 0, placed, batch);
 
 	// Flipped:
 	stars[0] = fieldstars[1];
@@ -1092,27 +2251,60 @@ static void try_all_codes_2(const int* fieldstars, int dimquad,
 		placed[i] = FALSE;
 
 	try_permutations(fieldstars, dimquad, flipcode, solver, current_parity,
-					 tol2, stars, NULL, 0, placed, &result);
+					 stars, permcode, 0, placed, batch);
+}
+
+/**
+ Looks up all the codes in the batch with a single walk of the code
+ tree, then resolves the matches in the order the permutations were
+ generated.
+ */
+static void search_code_batch(const code_batch_t* batch, int dimquad,
+							  solver_t* solver, double tol2) {
+	int options = KD_OPTIONS_SMALL_RADIUS | KD_OPTIONS_COMPUTE_DISTS |
+		KD_OPTIONS_NO_RESIZE_RESULTS | KD_OPTIONS_USE_SPLIT;
+	kdtree_qres_t** results = solver->coderesults;
+	int i, k;
+
+	if (!batch->n)
+		return;
+	assert(results);
+	if (kdtree_rangesearch_batch(solver->index->codekd->tree, results,
+								 batch->codes, batch->n, tol2, options)) {
+		ERROR("Failed to search the code tree");
+		return;
+	}
 
-bailout:
-	kdtree_free_query(result);
+	for (k=0; k<batch->n; k++) {
+		double pixvals[DQMAX*2];
+		const int* stars = batch->stars[k];
+		//debug("      trying ABCD = [%i %i %i %i]: %i results.\n",
+		//fstars[A], fstars[B], fstars[C], fstars[D], result->nres);
+		if (!results[k]->nres)
+			continue;
+		for (i=0; i<dimquad; i++) {
+			setx(pixvals, i, field_getx(solver, stars[i]));
+			sety(pixvals, i, field_gety(solver, stars[i]));
+		}
+		resolve_matches(results[k], pixvals, stars, dimquad, solver,
+						batch->parity[k]);
+		if (unlikely(solver_quitting(solver)))
+			break;
+	}
 }
 
 /**
  This functions tries different permutations of the non-backbone
- stars C [, D [,E ] ]
+ stars C [, D [,E ] ], adding each one that passes the invariant
+ checks to the batch of codes to search for.
  */
 static void try_permutations(const int* origstars, int dimquad,
 							 const double* origcode,
 							 solver_t* solver, anbool current_parity,
-							 double tol2,
 							 int* stars, double* code,
 							 int slot, anbool* placed,
-							 kdtree_qres_t** presult) {
+							 code_batch_t* batch) {
 	int i;
-	int options = KD_OPTIONS_SMALL_RADIUS | KD_OPTIONS_COMPUTE_DISTS |
-		KD_OPTIONS_NO_RESIZE_RESULTS | KD_OPTIONS_USE_SPLIT;
-	double mycode[DCMAX];
 	int Nstars = dimquad - NBACK;
 	int lastslot = dimquad - NBACK - 1;
 	/*
@@ -1143,9 +2335,6 @@ static void try_permutations(const int* origstars, int dimquad,
 	 elements are already filled by stars A and B.
 	 */
 
-	if (code == NULL)
-		code = mycode;
-
 	// We try putting each star that hasn't already been placed in
 	// this "slot".
 	for (i=0; i<Nstars; i++) {
@@ -1191,8 +2380,8 @@ static void try_permutations(const int* origstars, int dimquad,
 		if (slot < lastslot) {
 			placed[i] = TRUE;
 			try_permutations(origstars, dimquad, origcode, solver,
-							 current_parity, tol2, stars, code, 
-							 slot+1, placed, presult);
+							 current_parity, stars, code,
+							 slot+1, placed, batch);
 			placed[i] = FALSE;
 
 		} else {
@@ -1200,25 +2389,17 @@ static void try_permutations(const int* origstars, int dimquad,
 				TEST_TRY_PERMUTATIONS(stars, code, dimquad, solver);
 				continue;
 #endif
-				
-			// Search with the code we've built.
-			*presult = kdtree_rangesearch_options_reuse
-                (solver->index->codekd->tree, *presult, code, tol2, options);
-			//debug("      trying ABCD = [%i %i %i %i]: %i results.\n",
-            //fstars[A], fstars[B], fstars[C], fstars[D], result->nres);
-
-			if ((*presult)->nres) {
-				double pixvals[DQMAX*2];
-				int j;
-				for (j=0; j<dimquad; j++) {
-					setx(pixvals, j, field_getx(solver, stars[j]));
-					sety(pixvals, j, field_gety(solver, stars[j]));
-				}
-				resolve_matches(*presult, pixvals, stars, dimquad, solver,
-                                current_parity);
+
+			// Queue the code we've built for searching.
+			{
+				int n = batch->n;
+				assert(n < CODE_BATCH_MAX);
+				memcpy(batch->stars[n], stars, dimquad * sizeof(int));
+				memcpy(batch->codes + n * (2 * Nstars), code,
+					   2 * Nstars * sizeof(double));
+				batch->parity[n] = current_parity;
+				batch->n++;
 			}
-			if (unlikely(solver->quit_now))
-				return;
 		}
 	}
 }
@@ -1317,9 +2498,9 @@ static void resolve_matches(kdtree_qres_t* krez, const double *field,
 		set_center_and_radius(solver, &mo, &(mo.wcstan), NULL);
 
 		if (solver_handle_hit(solver, &mo, NULL, FALSE))
-			solver->quit_now = TRUE;
+			set_quit(solver, TRUE);
 
-		if (unlikely(solver->quit_now))
+		if (unlikely(solver_quitting(solver)))
 			return;
 	}
 }
@@ -1328,11 +2509,20 @@ void solver_inject_match(solver_t* solver, MatchObj* mo, sip_t* sip) {
 	solver_handle_hit(solver, mo, sip, TRUE);
 }
 
+static int solver_accept_hit(solver_t* sp, MatchObj* mo, sip_t* sip,
+                             anbool fake_match,
+                             double match_distance_in_pixels2);
+
+// How far (in sigmas) from its predicted position the quick check looks
+// for a field star near each reference star.
+#define PREVERIFY_NSIGMA 3.0
+
 static int solver_handle_hit(solver_t* sp, MatchObj* mo, sip_t* sip,
                              anbool fake_match) {
 	double match_distance_in_pixels2;
-    anbool solved;
 	double logaccept;
+	solver_t* parent;
+	int rtn;
 
 	mo->indexid = sp->index->indexid;
 	mo->healpix = sp->index->healpix;
@@ -1346,6 +2536,27 @@ static int solver_handle_hit(solver_t* sp, MatchObj* mo, sip_t* sip,
 
 	logaccept = MIN(sp->logratio_tokeep, sp->logratio_totune);
 
+	if (!sip && !fake_match && sp->preverify_nref > 0) {
+		int ntested;
+		double nchance;
+		int nmatch = verify_quick_check(sp->index->starkd, mo, sp->vf,
+										match_distance_in_pixels2,
+										sp->distance_from_quad_bonus,
+										sp->preverify_nref, PREVERIFY_NSIGMA,
+										&ntested, &nchance);
+		// the bar is on top of the matches expected by chance.  With no
+		// reference star to test, there's no evidence either way: leave it
+		// to the full verification.
+		if (ntested &&
+			nmatch < MIN(sp->preverify_min_match + floor(nchance), ntested)) {
+			debug("Quick check: %i of %i reference stars matched (%g by chance); "
+				  "rejecting.\n", nmatch, ntested, nchance);
+			sp->num_preverify_rejected++;
+			mo->logodds = -HUGE_VAL;
+			return FALSE;
+		}
+	}
+
 	verify_hit(sp->index->starkd, sp->index->cutnside,
 			   mo, sip, sp->vf, match_distance_in_pixels2,
 	           sp->distractor_ratio, sp->field_maxx, sp->field_maxy,
@@ -1353,6 +2564,40 @@ static int solver_handle_hit(solver_t* sp, MatchObj* mo, sip_t* sip,
 			   sp->logratio_stoplooking,
 			   sp->distance_from_quad_bonus, fake_match);
 	mo->nverified = sp->num_verified++;
+	if (mo->logodds < logaccept)
+		sp->num_verify_rejected++;
+
+	if (!sp->parent)
+		return solver_accept_hit(sp, mo, sip, fake_match,
+								 match_distance_in_pixels2);
+
+	// We're a worker thread: the callbacks and the best match belong
+	// to the parent solver, so take turns.
+	parent = sp->parent;
+	AN_THREAD_LOCK(solver_hit_lock);
+	if (get_quit(parent)) {
+		// someone else already solved it.
+		verify_free_matchobj(mo);
+		rtn = TRUE;
+	} else {
+		set_index(parent, sp->index);
+		rtn = solver_accept_hit(parent, mo, sip, fake_match,
+								match_distance_in_pixels2);
+		if (rtn)
+			set_quit(parent, TRUE);
+	}
+	AN_THREAD_UNLOCK(solver_hit_lock);
+	return rtn;
+}
+
+/*
+ The second half of solver_handle_hit(): the match has been verified;
+ tune it up, report it, and keep track of the best match.
+ */
+static int solver_accept_hit(solver_t* sp, MatchObj* mo, sip_t* sip,
+                             anbool fake_match,
+                             double match_distance_in_pixels2) {
+    anbool solved;
 
 	if (mo->logodds >= sp->best_logodds) {
 		sp->best_logodds = mo->logodds;
@@ -1568,6 +2813,10 @@ void solver_set_default_values(solver_t* solver) {
 	solver->logratio_totune = HUGE_VAL;
 	solver->parity = DEFAULT_PARITY;
 	solver->codetol = DEFAULT_CODE_TOL;
+	solver->pquad_mem_max = DEFAULT_PQUAD_MEM_MAX;
+	solver->verify_cache_size = DEFAULT_VERIFY_CACHE_SIZE;
+	solver->preverify_nref = DEFAULT_PREVERIFY_NREF;
+	solver->preverify_min_match = DEFAULT_PREVERIFY_MIN_MATCH;
     solver->distractor_ratio = DEFAULT_DISTRACTOR_RATIO;
     solver->verify_pix = DEFAULT_VERIFY_PIX;
 	solver->verify_uniformize = TRUE;
@@ -1580,10 +2829,16 @@ void solver_set_default_values(solver_t* solver) {
 void solver_clear_indexes(solver_t* solver) {
 	pl_remove_all(solver->indexes);
     solver->index = NULL;
+	// the indexes may be closed next.
+	verify_refcache_clear(solver->refcache);
 }
 
 void solver_cleanup(solver_t* solver) {
 	solver_free_field(solver);
+	pquad_arena_free(solver->pqarena);
+	solver->pqarena = NULL;
+	verify_refcache_free(solver->refcache);
+	solver->refcache = NULL;
 	pl_free(solver->indexes);
     solver->indexes = NULL;
 	if (solver->have_best_match) {
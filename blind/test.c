@@ -0,0 +1,79 @@
+
+
+/* This is auto-generated code. Edit at your own peril. */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "cutest.h"
+
+
+extern void test_read_matchfile(CuTest*);
+extern void test_depths(CuTest*);
+extern void test_sorting(CuTest*);
+extern void test_tweak_1(CuTest*);
+extern void test_tweak_2(CuTest*);
+extern void test_tchebytweak(CuTest*);
+extern void test_solve_multiindex(CuTest*);
+extern void test_threads_find_same_match(CuTest*);
+extern void test_threads_count_same_work(CuTest*);
+extern void test_verify_cache_same_work(CuTest*);
+extern void test_pquad_store_over_budget(CuTest*);
+extern void test_index_threads_share_limits(CuTest*);
+extern void test_preverify_brightest_missing(CuTest*);
+extern void test_preverify_nothing_to_test(CuTest*);
+extern void test_engine_server_solve(CuTest*);
+extern void test_engine_server_failures(CuTest*);
+extern void test_engine_server_max_jobs(CuTest*);
+extern void test_engine_server_socket_mode(CuTest*);
+extern void test_engine_indexes_near(CuTest*);
+extern void test_engine_index_residency(CuTest*);
+
+
+void RunAllTests(void) 
+{
+    CuString *output = CuStringNew();
+    CuSuite* suite = CuSuiteNew();
+
+
+    SUITE_ADD_TEST(suite, test_read_matchfile);
+    SUITE_ADD_TEST(suite, test_depths);
+    SUITE_ADD_TEST(suite, test_sorting);
+    SUITE_ADD_TEST(suite, test_tweak_1);
+    SUITE_ADD_TEST(suite, test_tweak_2);
+    SUITE_ADD_TEST(suite, test_tchebytweak);
+    SUITE_ADD_TEST(suite, test_solve_multiindex);
+    SUITE_ADD_TEST(suite, test_threads_find_same_match);
+    SUITE_ADD_TEST(suite, test_threads_count_same_work);
+    SUITE_ADD_TEST(suite, test_verify_cache_same_work);
+    SUITE_ADD_TEST(suite, test_pquad_store_over_budget);
+    SUITE_ADD_TEST(suite, test_index_threads_share_limits);
+    SUITE_ADD_TEST(suite, test_preverify_brightest_missing);
+    SUITE_ADD_TEST(suite, test_preverify_nothing_to_test);
+    SUITE_ADD_TEST(suite, test_engine_server_solve);
+    SUITE_ADD_TEST(suite, test_engine_server_failures);
+    SUITE_ADD_TEST(suite, test_engine_server_max_jobs);
+    SUITE_ADD_TEST(suite, test_engine_server_socket_mode);
+    SUITE_ADD_TEST(suite, test_engine_indexes_near);
+    SUITE_ADD_TEST(suite, test_engine_index_residency);
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+
+    printf("%s\n", output->buffer);
+
+    CuSuiteFree(suite);
+    CuStringFree(output);
+}
+
+int main(int argc, char** args)
+{
+    if (argc > 1 && !strcmp(args[1], "-d")) {
+        printf("Setting die on fail.\n");
+        CuDieOnFail();
+    }
+    RunAllTests();
+    return 0;
+}
@@ -0,0 +1,261 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "cutest.h"
+#include "engine.h"
+#include "index.h"
+#include "xylist.h"
+#include "anqfits.h"
+#include "fitsioutils.h"
+#include "ioutils.h"
+#include "healpix.h"
+#include "starutil.h"
+#include "bl.h"
+#include "log.h"
+
+static index_t* new_index(double lower, double upper, int healpix,
+						  int nside) {
+	index_t* ind = calloc(1, sizeof(index_t));
+	ind->index_scale_lower = lower;
+	ind->index_scale_upper = upper;
+	ind->healpix = healpix;
+	ind->hpnside = nside;
+	return ind;
+}
+
+// Adds the healpixes of a band, at Nside "nside", "every" apart.
+static void add_band(engine_t* engine, double lower, double upper, int nside,
+					 int every) {
+	int hp;
+	for (hp=0; hp<12*nside*nside; hp+=every)
+		pl_append(engine->indexes, new_index(lower, upper, hp, nside));
+}
+
+static double uniform(double lo, double hi) {
+	return lo + (hi - lo) * (rand() / (double)RAND_MAX);
+}
+
+// The lookup must find exactly what checking every index finds.
+static void check_query(CuTest* ct, engine_t* engine, double fmin, double fmax,
+						double ra, double dec, double radius) {
+	il* found = il_new(256);
+	il* expected = il_new(256);
+	int noverlap = 0;
+	int i;
+
+	for (i=0; i<pl_size(engine->indexes); i++) {
+		index_t* ind = pl_get(engine->indexes, i);
+		if (!index_overlaps_scale_range(ind, fmin, fmax))
+			continue;
+		noverlap++;
+		if (index_is_within_range(ind, ra, dec, radius))
+			il_append(expected, i);
+	}
+	CuAssertIntEquals(ct, noverlap,
+					  engine_find_indexes_near(engine, fmin, fmax, ra, dec,
+											   radius, found));
+	CuAssertIntEquals(ct, il_size(expected), il_size(found));
+	for (i=0; i<il_size(expected); i++)
+		CuAssertIntEquals(ct, il_get(expected, i), il_get(found, i));
+	il_free(found);
+	il_free(expected);
+}
+
+void test_engine_indexes_near(CuTest* ct) {
+	engine_t* engine;
+	int i;
+
+	log_init(LOG_MSG);
+	srand(0);
+	engine = engine_new();
+	// whole bands at a few Nsides, a band with gaps, all-sky indexes, and
+	// indexes whose Nside isn't their band's.
+	add_band(engine, 30, 60, 1, 1);
+	add_band(engine, 60, 120, 2, 1);
+	add_band(engine, 100, 200, 4, 3);
+	add_band(engine, 100, 200, 2, 5);
+	add_band(engine, 150, 300, 8, 7);
+	pl_append(engine->indexes, new_index(100, 200, -1, 1));
+	pl_append(engine->indexes, new_index(400, 800, -1, 1));
+	pl_append(engine->indexes, new_index(400, 800, -1, 1));
+
+	for (i=0; i<20000; i++) {
+		double fmin = exp(uniform(log(10), log(1000)));
+		double fmax = fmin * uniform(1, 4);
+		double ra = uniform(0, 360);
+		double dec = rad2deg(asin(uniform(-1, 1)));
+		double radius;
+		switch (i % 4) {
+		case 0: radius = 0; break;
+		case 1: radius = uniform(0, 5); break;
+		case 2: radius = uniform(0, 60); break;
+		default: radius = uniform(0, 180); break;
+		}
+		check_query(ct, engine, fmin, fmax, ra, dec, radius);
+	}
+
+	// the lookup is rebuilt when indexes are added.
+	pl_append(engine->indexes, new_index(2000, 4000, 5, 1));
+	check_query(ct, engine, 3000, 3000, 0, 0, 180);
+	check_query(ct, engine, 3000, 3000, 0, 0, 1);
+
+	for (i=0; i<pl_size(engine->indexes); i++)
+		free(pl_get(engine->indexes, i));
+	engine_free(engine);
+}
+
+/*
+ Index residency under "indexmem", with copies of the t10 index used
+ by test_multiindex2 (see there), put back together into single-file
+ indexes.
+ */
+static void write_indexes(CuTest* ct, const char* dir, int N, sl* fns) {
+	anqfits_t* fits;
+	char* ind;
+	char* skdt;
+	size_t nind, nskdt;
+	off_t start;
+	int i;
+
+	// t10.ind, then the star kdtree extensions of t10.skdt.
+	fits = anqfits_open("../util/t10.skdt");
+	CuAssertPtrNotNull(ct, fits);
+	start = anqfits_header_start(fits, 1);
+	anqfits_close(fits);
+	CuAssertTrue(ct, start > 0);
+	ind = file_get_contents("../util/t10.ind", &nind, FALSE);
+	skdt = file_get_contents("../util/t10.skdt", &nskdt, FALSE);
+	CuAssertPtrNotNull(ct, ind);
+	CuAssertPtrNotNull(ct, skdt);
+	for (i=0; i<N; i++) {
+		FILE* f;
+		char* fn;
+		asprintf_safe(&fn, "%s/index-%02i.fits", dir, i);
+		f = fopen(fn, "wb");
+		CuAssertPtrNotNull(ct, f);
+		CuAssertIntEquals(ct, 1, fwrite(ind, nind, 1, f));
+		CuAssertIntEquals(ct, 1, fwrite(skdt + start, nskdt - start, 1, f));
+		CuAssertIntEquals(ct, 0, fclose(f));
+		sl_append_nocopy(fns, fn);
+	}
+	free(ind);
+	free(skdt);
+}
+
+// The field of test_multiindex2, searched to a fixed depth without
+// being solved, so that every index is used.
+static void write_job(CuTest* ct, const char* fn) {
+	xylist_t* in;
+	xylist_t* out;
+	starxy_t* field;
+	qfits_header* hdr;
+
+	in = xylist_open("../util/t1.xy");
+	CuAssertPtrNotNull(ct, in);
+	field = xylist_read_field(in, NULL);
+	CuAssertPtrNotNull(ct, field);
+	xylist_close(in);
+
+	out = xylist_open_for_writing(fn);
+	CuAssertPtrNotNull(ct, out);
+	hdr = xylist_get_primary_header(out);
+	fits_header_add_int(hdr, "IMAGEW", 1000, NULL);
+	fits_header_add_int(hdr, "IMAGEH", 1000, NULL);
+	qfits_header_add(hdr, "ANRUN", "T", NULL, NULL);
+	fits_header_add_double(hdr, "ANAPPL1", 5.0, NULL);
+	fits_header_add_double(hdr, "ANAPPU1", 15.0, NULL);
+	fits_header_add_int(hdr, "ANDPL1", 1, NULL);
+	fits_header_add_int(hdr, "ANDPU1", 15, NULL);
+	fits_header_add_double(hdr, "ANODDSSL", 1e300, NULL);
+	CuAssertIntEquals(ct, 0, xylist_write_primary_header(out));
+	CuAssertIntEquals(ct, 0, xylist_write_header(out));
+	CuAssertIntEquals(ct, 0, xylist_write_field(out, field));
+	CuAssertIntEquals(ct, 0, xylist_fix_header(out));
+	CuAssertIntEquals(ct, 0, xylist_fix_primary_header(out));
+	CuAssertIntEquals(ct, 0, xylist_close(out));
+	starxy_free(field);
+}
+
+// Checks that engine->resident_bytes counts the loaded indexes; returns
+// how many are loaded.
+static int count_loaded(CuTest* ct, engine_t* engine) {
+	size_t nbytes = 0;
+	int nloaded = 0;
+	int i;
+	for (i=0; i<pl_size(engine->indexes); i++) {
+		index_t* ind = pl_get(engine->indexes, i);
+		size_t n = index_get_mapped_size(ind);
+		CuAssertTrue(ct, (n > 0) == (ind->starkd != NULL));
+		nbytes += n;
+		nloaded += (n > 0);
+	}
+	CuAssertIntEquals(ct, engine->resident_bytes, nbytes);
+	return nloaded;
+}
+
+void test_engine_index_residency(CuTest* ct) {
+	char* dir;
+	char* jobfn;
+	sl* fns = sl_new(16);
+	int N = 24;
+	int budgets[] = { 1, 100 };
+	int k, i;
+
+	// (the copies all have the same INDEXID, which the engine warns about)
+	log_init(LOG_ERROR);
+	dir = create_temp_dir("test-engine-indexes", NULL);
+	CuAssertPtrNotNull(ct, dir);
+	write_indexes(ct, dir, N, fns);
+	asprintf_safe(&jobfn, "%s/job.axy", dir);
+	write_job(ct, jobfn);
+
+	for (k=0; k<2; k++) {
+		engine_t* engine = engine_new();
+		startree_t* starkd[N];
+		int nloaded;
+
+		engine->indexmem = budgets[k];
+		for (i=0; i<N; i++)
+			CuAssertIntEquals(ct, 0, engine_add_index(engine, sl_get(fns, i)));
+		CuAssertIntEquals(ct, 0, engine_finish_config(engine, "test"));
+		CuAssertIntEquals(ct, 0, count_loaded(ct, engine));
+
+		CuAssertIntEquals(ct, 0, engine_run_job_file(engine, jobfn, NULL));
+		nloaded = count_loaded(ct, engine);
+		if (k == 0) {
+			// the last ones used stay loaded, within the budget.
+			CuAssertTrue(ct, nloaded > 0);
+			CuAssertTrue(ct, nloaded < N);
+			CuAssertTrue(ct, engine->resident_bytes <= 1024 * 1024);
+			for (i=0; i<N; i++) {
+				index_t* ind = pl_get(engine->indexes, i);
+				CuAssertIntEquals(ct, (i >= N - nloaded), ind->starkd != NULL);
+			}
+		} else {
+			// they all fit, and are used again without being reloaded.
+			CuAssertIntEquals(ct, N, nloaded);
+			for (i=0; i<N; i++)
+				starkd[i] = ((index_t*)pl_get(engine->indexes, i))->starkd;
+			CuAssertIntEquals(ct, 0, engine_run_job_file(engine, jobfn, NULL));
+			CuAssertIntEquals(ct, N, count_loaded(ct, engine));
+			for (i=0; i<N; i++)
+				CuAssertPtrEquals(ct, starkd[i],
+								  ((index_t*)pl_get(engine->indexes, i))->starkd);
+		}
+		engine_free(engine);
+	}
+
+	unlink(jobfn);
+	for (i=0; i<N; i++)
+		unlink(sl_get(fns, i));
+	rmdir(dir);
+	sl_free2(fns);
+	free(jobfn);
+	free(dir);
+}
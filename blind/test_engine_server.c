@@ -0,0 +1,353 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "cutest.h"
+#include "engine.h"
+#include "engine-server.h"
+#include "xylist.h"
+#include "fitsioutils.h"
+#include "ioutils.h"
+#include "log.h"
+#include "errors.h"
+
+/*
+ Talks to engine_serve() over its socket, as solve-field does.  The
+ server runs in a child process, with the indexes and field used by
+ test_multiindex2 (see there for how the files in util/ were made).
+ */
+
+struct server {
+	char* dir;
+	char* socketpath;
+	char* configfn;
+	char* axyfn;
+	pid_t pid;
+};
+
+// Writes the field as an augmented xylist that the indexes can solve.
+static void write_axy(CuTest* ct, const char* fn) {
+	xylist_t* in;
+	xylist_t* out;
+	starxy_t* field;
+	qfits_header* hdr;
+
+	in = xylist_open("../util/t1.xy");
+	CuAssertPtrNotNull(ct, in);
+	field = xylist_read_field(in, NULL);
+	CuAssertPtrNotNull(ct, field);
+	xylist_close(in);
+
+	out = xylist_open_for_writing(fn);
+	CuAssertPtrNotNull(ct, out);
+	hdr = xylist_get_primary_header(out);
+	fits_header_add_int(hdr, "IMAGEW", 1000, NULL);
+	fits_header_add_int(hdr, "IMAGEH", 1000, NULL);
+	qfits_header_add(hdr, "ANRUN", "T", NULL, NULL);
+	fits_header_add_double(hdr, "ANAPPL1", 5.0, NULL);
+	fits_header_add_double(hdr, "ANAPPU1", 15.0, NULL);
+	CuAssertIntEquals(ct, 0, xylist_write_primary_header(out));
+	CuAssertIntEquals(ct, 0, xylist_write_header(out));
+	CuAssertIntEquals(ct, 0, xylist_write_field(out, field));
+	CuAssertIntEquals(ct, 0, xylist_fix_header(out));
+	CuAssertIntEquals(ct, 0, xylist_fix_primary_header(out));
+	CuAssertIntEquals(ct, 0, xylist_close(out));
+	starxy_free(field);
+}
+
+static void write_config(CuTest* ct, const char* fn) {
+	FILE* f = fopen(fn, "w");
+	CuAssertPtrNotNull(ct, f);
+	fprintf(f, "inparallel\n"
+			"add_path ../util\n"
+			"multiindex t10.skdt t10.ind t11.ind t12.ind\n");
+	CuAssertIntEquals(ct, 0, fclose(f));
+}
+
+static void start_server_mode(CuTest* ct, struct server* srv, int maxjobs,
+							  int socketmode) {
+	memset(srv, 0, sizeof(struct server));
+	srv->dir = create_temp_dir("test-engine-server", NULL);
+	CuAssertPtrNotNull(ct, srv->dir);
+	asprintf_safe(&srv->socketpath, "%s/socket", srv->dir);
+	asprintf_safe(&srv->configfn, "%s/astrometry.cfg", srv->dir);
+	asprintf_safe(&srv->axyfn, "%s/field.axy", srv->dir);
+	write_config(ct, srv->configfn);
+	write_axy(ct, srv->axyfn);
+
+	fflush(NULL);
+	srv->pid = fork();
+	CuAssertTrue(ct, srv->pid != -1);
+	if (srv->pid == 0) {
+		engine_t* engine = engine_new();
+		log_init(LOG_ERROR);
+		if (engine_parse_config_file(engine, srv->configfn) ||
+			engine_finish_config(engine, srv->configfn) ||
+			engine_serve(engine, srv->socketpath, maxjobs, socketmode)) {
+			ERROR("Failed to start the server");
+			errors_print_stack(stderr);
+			_exit(1);
+		}
+		engine_free(engine);
+		_exit(0);
+	}
+}
+
+static void start_server(CuTest* ct, struct server* srv, int maxjobs) {
+	start_server_mode(ct, srv, maxjobs, ENGINE_SOCKET_MODE);
+}
+
+// Stops the server; it must exit cleanly and remove its socket.
+static void stop_server(CuTest* ct, struct server* srv) {
+	int status;
+	CuAssertIntEquals(ct, 0, kill(srv->pid, SIGTERM));
+	CuAssertIntEquals(ct, srv->pid, waitpid(srv->pid, &status, 0));
+	CuAssertTrue(ct, WIFEXITED(status));
+	CuAssertIntEquals(ct, 0, WEXITSTATUS(status));
+	CuAssertTrue(ct, !file_exists(srv->socketpath));
+	unlink(srv->configfn);
+	unlink(srv->axyfn);
+	rmdir(srv->dir);
+	free(srv->socketpath);
+	free(srv->configfn);
+	free(srv->axyfn);
+	free(srv->dir);
+}
+
+// Connects to the server, waiting up to 10 seconds for it to start.
+static int connect_server(CuTest* ct, struct server* srv) {
+	struct sockaddr_un addr;
+	int i;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	CuAssertTrue(ct, strlen(srv->socketpath) < sizeof(addr.sun_path));
+	strcpy(addr.sun_path, srv->socketpath);
+	for (i=0; i<1000; i++) {
+		int sock;
+		CuAssertIntEquals(ct, 0, waitpid(srv->pid, NULL, WNOHANG));
+		sock = socket(AF_UNIX, SOCK_STREAM, 0);
+		CuAssertTrue(ct, sock != -1);
+		if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) == 0)
+			return sock;
+		close(sock);
+		usleep(10000);
+	}
+	CuFail(ct, "Failed to connect to the server");
+	return -1;
+}
+
+static void send_text(CuTest* ct, int sock, const char* text) {
+	size_t n = strlen(text);
+	CuAssertTrue(ct, write(sock, text, n) == (ssize_t)n);
+}
+
+// Has the server replied (within "ms" milliseconds)?
+static anbool has_reply(int sock, int ms) {
+	struct pollfd p;
+	p.fd = sock;
+	p.events = POLLIN;
+	return (poll(&p, 1, ms) == 1);
+}
+
+// Reads everything the server sends until it hangs up, and closes the
+// connection.
+static char* read_reply(CuTest* ct, int sock) {
+	char* reply = NULL;
+	size_t n = 0;
+	while (1) {
+		char buf[4096];
+		ssize_t nr;
+		CuAssertTrue(ct, has_reply(sock, 60000));
+		nr = read(sock, buf, sizeof(buf));
+		CuAssertTrue(ct, nr >= 0);
+		if (nr == 0)
+			break;
+		reply = realloc(reply, n + nr + 1);
+		memcpy(reply + n, buf, nr);
+		n += nr;
+	}
+	close(sock);
+	reply = realloc(reply, n + 1);
+	reply[n] = '\0';
+	return reply;
+}
+
+// Sends a whole request; returns the reply.
+static char* request(CuTest* ct, struct server* srv, const char* text) {
+	int sock = connect_server(ct, srv);
+	send_text(ct, sock, text);
+	return read_reply(ct, sock);
+}
+
+// The reply ends with "ENGINE-DONE <nfailed>".
+static void assert_done(CuTest* ct, const char* reply, int nfailed) {
+	char last[64];
+	const char* p;
+	sprintf(last, "ENGINE-DONE %i\n", nfailed);
+	CuAssertTrue(ct, strlen(reply) >= strlen(last));
+	p = reply + strlen(reply) - strlen(last);
+	CuAssertStrEquals(ct, last, p);
+}
+
+void test_engine_server_solve(CuTest* ct) {
+	struct server srv;
+	char* text;
+	char* reply;
+
+	log_init(LOG_MSG);
+	start_server(ct, &srv, 1);
+
+	// a job, by name relative to "cwd".
+	asprintf_safe(&text, "cwd %s\nverbose %i\naxy field.axy\nsolve\n",
+				  srv.dir, LOG_MSG);
+	reply = request(ct, &srv, text);
+	assert_done(ct, reply, 0);
+	CuAssertPtrNotNull(ct, strstr(reply, "solved with index"));
+	free(reply);
+	free(text);
+
+	// the same field twice in one request, one of them sent inline.
+	{
+		char* data;
+		size_t len;
+		char* head;
+		int sock;
+		data = file_get_contents(srv.axyfn, &len, FALSE);
+		CuAssertPtrNotNull(ct, data);
+		asprintf_safe(&head, "verbose %i\naxy %s\naxy-data %zu\n",
+					  LOG_MSG, srv.axyfn, len);
+		sock = connect_server(ct, &srv);
+		send_text(ct, sock, head);
+		CuAssertTrue(ct, write(sock, data, len) == (ssize_t)len);
+		send_text(ct, sock, "solve\n");
+		reply = read_reply(ct, sock);
+		assert_done(ct, reply, 0);
+		text = strstr(reply, "solved with index");
+		CuAssertPtrNotNull(ct, text);
+		CuAssertPtrNotNull(ct, strstr(text + 1, "solved with index"));
+		free(reply);
+		free(head);
+		free(data);
+	}
+
+	stop_server(ct, &srv);
+}
+
+void test_engine_server_failures(CuTest* ct) {
+	struct server srv;
+	char* text;
+	char* reply;
+	int sock;
+
+	log_init(LOG_MSG);
+	start_server(ct, &srv, 1);
+
+	// each bad request gets a reply, and the server keeps going.
+	reply = request(ct, &srv, "verbose 1\nfrobnicate\nsolve\n");
+	assert_done(ct, reply, 1);
+	free(reply);
+
+	reply = request(ct, &srv, "cwd /nonexistent-directory\nsolve\n");
+	assert_done(ct, reply, 1);
+	free(reply);
+
+	// a job file that can't be read fails; the others still run.
+	asprintf_safe(&text, "axy %s/missing.axy\naxy %s\nsolve\n",
+				  srv.dir, srv.axyfn);
+	reply = request(ct, &srv, text);
+	assert_done(ct, reply, 1);
+	free(reply);
+	free(text);
+
+	// the client hangs up before "solve", or in the middle of the data.
+	sock = connect_server(ct, &srv);
+	send_text(ct, sock, "verbose 1\n");
+	CuAssertIntEquals(ct, 0, shutdown(sock, SHUT_WR));
+	reply = read_reply(ct, sock);
+	assert_done(ct, reply, 1);
+	free(reply);
+
+	sock = connect_server(ct, &srv);
+	send_text(ct, sock, "axy-data 1000\nSIMPLE  =");
+	CuAssertIntEquals(ct, 0, shutdown(sock, SHUT_WR));
+	reply = read_reply(ct, sock);
+	assert_done(ct, reply, 1);
+	free(reply);
+
+	// an empty request succeeds.
+	reply = request(ct, &srv, "solve\n");
+	assert_done(ct, reply, 0);
+	free(reply);
+
+	stop_server(ct, &srv);
+}
+
+void test_engine_server_max_jobs(CuTest* ct) {
+	int maxjobs;
+
+	log_init(LOG_MSG);
+	for (maxjobs=1; maxjobs<=2; maxjobs++) {
+		struct server srv;
+		int first, second;
+		char* reply;
+
+		start_server(ct, &srv, maxjobs);
+		// the first request stays open...
+		first = connect_server(ct, &srv);
+		send_text(ct, first, "verbose 1\n");
+		// ... so with one job at a time, the second waits for it.
+		second = connect_server(ct, &srv);
+		send_text(ct, second, "solve\n");
+		if (maxjobs == 1)
+			CuAssertTrue(ct, !has_reply(second, 1000));
+		else
+			CuAssertTrue(ct, has_reply(second, 60000));
+
+		send_text(ct, first, "solve\n");
+		reply = read_reply(ct, first);
+		assert_done(ct, reply, 0);
+		free(reply);
+		reply = read_reply(ct, second);
+		assert_done(ct, reply, 0);
+		free(reply);
+
+		stop_server(ct, &srv);
+	}
+}
+
+void test_engine_server_socket_mode(CuTest* ct) {
+	int modes[] = { ENGINE_SOCKET_MODE, 0660 };
+	mode_t oldmask;
+	int k;
+
+	log_init(LOG_MSG);
+	// the socket's permissions don't depend on the umask.
+	oldmask = umask(0);
+	for (k=0; k<2; k++) {
+		struct server srv;
+		struct stat st;
+		char* reply;
+		start_server_mode(ct, &srv, 1, modes[k]);
+		reply = request(ct, &srv, "solve\n");
+		assert_done(ct, reply, 0);
+		free(reply);
+		CuAssertIntEquals(ct, 0, stat(srv.socketpath, &st));
+		CuAssertTrue(ct, S_ISSOCK(st.st_mode));
+		CuAssertIntEquals(ct, modes[k], st.st_mode & 0777);
+		stop_server(ct, &srv);
+	}
+	umask(oldmask);
+}
@@ -0,0 +1,159 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cutest.h"
+#include "multiindex.h"
+#include "solver.h"
+#include "starkd.h"
+#include "xylist.h"
+#include "bl.h"
+#include "log.h"
+#include "errors.h"
+#include "mathutil.h"
+
+/*
+ The quick check before verification (solver_t's "preverify_nref"),
+ on the field used by test_multiindex2 (see there for how the index
+ files in util/ were made).  That field is the index stars themselves,
+ brightest first.
+ */
+
+// Reads the field, without its "nskip" brightest stars.
+static starxy_t* read_field_skipping(CuTest* ct, int nskip) {
+	xylist_t* xy;
+	starxy_t* all;
+	starxy_t* field;
+	int i, N;
+	xy = xylist_open("../util/t1.xy");
+	CuAssertPtrNotNull(ct, xy);
+	all = xylist_read_field(xy, NULL);
+	CuAssertPtrNotNull(ct, all);
+	xylist_close(xy);
+	N = starxy_n(all);
+	CuAssertTrue(ct, N > nskip);
+	field = starxy_new(N - nskip, FALSE, FALSE);
+	for (i=nskip; i<N; i++)
+		starxy_set(field, i - nskip, starxy_getx(all, i), starxy_gety(all, i));
+	starxy_free(all);
+	return field;
+}
+
+static solver_t* run_solver(CuTest* ct, multiindex_t* mi, int nskip,
+							int nref) {
+	solver_t* s;
+	int i;
+	s = solver_new();
+	s->funits_lower = 5.0;
+	s->funits_upper = 15.0;
+	s->preverify_nref = nref;
+	solver_set_field(s, read_field_skipping(ct, nskip));
+	solver_set_field_bounds(s, 0, 1000, 0, 1000);
+	for (i=0; i<multiindex_n(mi); i++)
+		solver_add_index(s, multiindex_get(mi, i));
+	solver_run(s);
+	return s;
+}
+
+static void free_solver(solver_t* s) {
+	if (solver_did_solve(s))
+		verify_free_matchobj(solver_get_best_match(s));
+	solver_cleanup_field(s);
+	solver_free(s);
+}
+
+static multiindex_t* open_indexes(void) {
+	multiindex_t* mi;
+	sl* fns = sl_new(4);
+	sl_append(fns, "../util/t10.ind");
+	sl_append(fns, "../util/t11.ind");
+	sl_append(fns, "../util/t12.ind");
+	mi = multiindex_open("../util/t10.skdt", fns, 0);
+	sl_free2(fns);
+	return mi;
+}
+
+// The brightest reference stars (here, the field's brightest ones) are
+// missing, as they are when saturated: the check must still let the
+// true matches through, so the solver finds the same solution after
+// trying the same quads as without it.
+void test_preverify_brightest_missing(CuTest* ct) {
+	multiindex_t* mi;
+	int nskips[] = { 0, 20, 40 };
+	int k;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	for (k=0; k<sizeof(nskips)/sizeof(int); k++) {
+		solver_t* off = run_solver(ct, mi, nskips[k], 0);
+		solver_t* on = run_solver(ct, mi, nskips[k], DEFAULT_PREVERIFY_NREF);
+		CuAssertTrue(ct, solver_did_solve(off));
+		CuAssertTrue(ct, solver_did_solve(on));
+		CuAssertIntEquals(ct, off->numtries, on->numtries);
+		CuAssertIntEquals(ct, solver_get_best_match(off)->quadno,
+						  solver_get_best_match(on)->quadno);
+		CuAssertDblEquals(ct, solver_get_best_match(off)->logodds,
+						  solver_get_best_match(on)->logodds, 1e-9);
+		free_solver(off);
+		free_solver(on);
+	}
+	multiindex_free(mi);
+}
+
+// Only the quad's own stars are as faint as the quad (by sweep number):
+// the check has nothing to test, so it must leave the match to the full
+// verification, which accepts it on the brighter stars.
+void test_preverify_nothing_to_test(CuTest* ct) {
+	multiindex_t* mi;
+	startree_t* skdt;
+	uint8_t* origsweep;
+	uint8_t* sweep;
+	solver_t* s;
+	solver_t* off;
+	solver_t* on;
+	MatchObj* mo;
+	int i, N;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	s = run_solver(ct, mi, 0, 0);
+	CuAssertTrue(ct, solver_did_solve(s));
+	mo = solver_get_best_match(s);
+
+	// (the indexes share their star tree)
+	skdt = multiindex_get(mi, 0)->starkd;
+	N = startree_N(skdt);
+	origsweep = skdt->sweep;
+	sweep = malloc(N);
+	for (i=0; i<N; i++)
+		sweep[i] = MIN(origsweep[i], 254);
+	for (i=0; i<mo->dimquads; i++)
+		sweep[mo->star[i]] = 255;
+	skdt->sweep = sweep;
+
+	off = run_solver(ct, mi, 0, 0);
+	on = run_solver(ct, mi, 0, DEFAULT_PREVERIFY_NREF);
+	CuAssertTrue(ct, solver_did_solve(off));
+	CuAssertTrue(ct, solver_did_solve(on));
+	CuAssertIntEquals(ct, mo->quadno, solver_get_best_match(off)->quadno);
+	CuAssertIntEquals(ct, mo->quadno, solver_get_best_match(on)->quadno);
+	CuAssertIntEquals(ct, off->numtries, on->numtries);
+	CuAssertDblEquals(ct, solver_get_best_match(off)->logodds,
+					  solver_get_best_match(on)->logodds, 1e-9);
+
+	skdt->sweep = origsweep;
+	free(sweep);
+	free_solver(s);
+	free_solver(off);
+	free_solver(on);
+	multiindex_free(mi);
+}
@@ -0,0 +1,49 @@
+
+
+/* This is auto-generated code. Edit at your own peril. */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "cutest.h"
+
+
+extern void test_threads_find_same_match(CuTest*);
+extern void test_threads_count_same_work(CuTest*);
+extern void test_verify_cache_same_work(CuTest*);
+extern void test_pquad_store_over_budget(CuTest*);
+extern void test_index_threads_share_limits(CuTest*);
+
+
+void RunAllTests(void) 
+{
+    CuString *output = CuStringNew();
+    CuSuite* suite = CuSuiteNew();
+
+
+    SUITE_ADD_TEST(suite, test_threads_find_same_match);
+    SUITE_ADD_TEST(suite, test_threads_count_same_work);
+    SUITE_ADD_TEST(suite, test_verify_cache_same_work);
+    SUITE_ADD_TEST(suite, test_pquad_store_over_budget);
+    SUITE_ADD_TEST(suite, test_index_threads_share_limits);
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+
+    printf("%s\n", output->buffer);
+
+    CuSuiteFree(suite);
+    CuStringFree(output);
+}
+
+int main(int argc, char** args)
+{
+    if (argc > 1 && !strcmp(args[1], "-d")) {
+        printf("Setting die on fail.\n");
+        CuDieOnFail();
+    }
+    RunAllTests();
+    return 0;
+}
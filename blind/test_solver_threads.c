@@ -0,0 +1,292 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+#include <stdio.h>
+#include <math.h>
+
+#include "cutest.h"
+#include "multiindex.h"
+#include "solver.h"
+#include "xylist.h"
+#include "bl.h"
+#include "log.h"
+#include "errors.h"
+#include "starutil.h"
+#include "mathutil.h"
+
+/*
+ Solves the field used by test_multiindex2 (see there for how the
+ index files in util/ were made) with different numbers of threads.
+ */
+
+static multiindex_t* open_indexes(void) {
+	multiindex_t* mi;
+	sl* fns = sl_new(4);
+	sl_append(fns, "../util/t10.ind");
+	sl_append(fns, "../util/t11.ind");
+	sl_append(fns, "../util/t12.ind");
+	mi = multiindex_open("../util/t10.skdt", fns, 0);
+	sl_free2(fns);
+	return mi;
+}
+
+static solver_t* new_solver(CuTest* ct, multiindex_t* mi, starxy_t* field,
+							int nthreads) {
+	solver_t* s;
+	int i;
+	s = solver_new();
+	s->funits_lower = 5.0;
+	s->funits_upper = 15.0;
+	s->nthreads = nthreads;
+	solver_set_field(s, field);
+	solver_set_field_bounds(s, 0, 1000, 0, 1000);
+	for (i=0; i<multiindex_n(mi); i++)
+		solver_add_index(s, multiindex_get(mi, i));
+	return s;
+}
+
+static starxy_t* read_field(CuTest* ct) {
+	xylist_t* xy;
+	starxy_t* field;
+	xy = xylist_open("../util/t1.xy");
+	CuAssertPtrNotNull(ct, xy);
+	field = xylist_read_field(xy, NULL);
+	CuAssertPtrNotNull(ct, field);
+	xylist_close(xy);
+	return field;
+}
+
+static void free_solver(solver_t* s) {
+	if (solver_did_solve(s))
+		verify_free_matchobj(solver_get_best_match(s));
+	solver_cleanup_field(s);
+	solver_free(s);
+}
+
+// Searches objects [0, endobj) (or all, if zero) without keeping any match.
+static solver_t* run_exhaustive(CuTest* ct, multiindex_t* mi, int nthreads,
+								int endobj) {
+	solver_t* s = new_solver(ct, mi, read_field(ct), nthreads);
+	solver_set_keep_logodds(s, HUGE_VAL);
+	s->logratio_toprint = HUGE_VAL;
+	s->endobj = endobj;
+	solver_run(s);
+	CuAssertTrue(ct, !solver_did_solve(s));
+	return s;
+}
+
+void test_threads_find_same_match(CuTest* ct) {
+	multiindex_t* mi;
+	solver_t* s1;
+	solver_t* s4;
+	MatchObj* m1;
+	MatchObj* m4;
+	solver_t* before;
+	solver_t* through;
+	int k;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	s1 = new_solver(ct, mi, read_field(ct), 1);
+	solver_run(s1);
+	s4 = new_solver(ct, mi, read_field(ct), 4);
+	solver_run(s4);
+
+	CuAssertTrue(ct, solver_did_solve(s1));
+	CuAssertTrue(ct, solver_did_solve(s4));
+	m1 = solver_get_best_match(s1);
+	m4 = solver_get_best_match(s4);
+	// When more than one quad built from the last field object solves
+	// the field, whichever thread gets there first wins; so compare the
+	// solutions rather than the quads.
+	CuAssertTrue(ct, m1->logodds >= s1->logratio_tokeep);
+	CuAssertTrue(ct, m4->logodds >= s4->logratio_tokeep);
+	CuAssertTrue(ct, dist2arcsec(sqrt(distsq(m1->center, m4->center, 3)))
+				 < m1->scale);
+	CuAssertDblEquals(ct, 1.0, m4->scale / m1->scale, 1e-3);
+
+	// Both stop at the same field object.  The threads try all the
+	// quads of the objects before it, and some of that object's.
+	k = s1->last_examined_object;
+	CuAssertIntEquals(ct, k, s4->last_examined_object);
+	before = run_exhaustive(ct, mi, 1, k);
+	through = run_exhaustive(ct, mi, 1, k + 1);
+	CuAssertTrue(ct, s4->numtries > before->numtries);
+	CuAssertTrue(ct, s4->numtries <= through->numtries);
+	CuAssertTrue(ct, s4->nummatches > before->nummatches);
+	CuAssertTrue(ct, s4->nummatches <= through->nummatches);
+	CuAssertTrue(ct, s1->numtries > before->numtries);
+	CuAssertTrue(ct, s1->numtries <= through->numtries);
+	free_solver(before);
+	free_solver(through);
+
+	free_solver(s1);
+	free_solver(s4);
+	multiindex_free(mi);
+}
+
+void test_threads_count_same_work(CuTest* ct) {
+	multiindex_t* mi;
+	solver_t* s[2];
+	int nthreads[2] = { 1, 4 };
+	int k;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	// With no match good enough to keep, the whole field is searched,
+	// so the merged counters must agree with the single-threaded ones.
+	for (k=0; k<2; k++)
+		s[k] = run_exhaustive(ct, mi, nthreads[k], 0);
+	CuAssertTrue(ct, s[0]->numtries > 0);
+	CuAssertIntEquals(ct, s[0]->numtries, s[1]->numtries);
+	CuAssertIntEquals(ct, s[0]->nummatches, s[1]->nummatches);
+	CuAssertIntEquals(ct, s[0]->numscaleok, s[1]->numscaleok);
+	CuAssertIntEquals(ct, s[0]->num_verified, s[1]->num_verified);
+	CuAssertDblEquals(ct, s[0]->best_logodds, s[1]->best_logodds, 1e-9);
+	CuAssertIntEquals(ct, s[0]->last_examined_object,
+					  s[1]->last_examined_object);
+
+	for (k=0; k<2; k++)
+		free_solver(s[k]);
+	multiindex_free(mi);
+}
+
+void test_verify_cache_same_work(CuTest* ct) {
+	multiindex_t* mi;
+	solver_t* s[2];
+	int cachesize[2] = { 0, 64 };
+	int k;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	// Verifying with the reference stars cached must score every match
+	// the same as searching the index each time.
+	for (k=0; k<2; k++) {
+		s[k] = new_solver(ct, mi, read_field(ct), 4);
+		s[k]->verify_cache_size = cachesize[k];
+		solver_set_keep_logodds(s[k], HUGE_VAL);
+		s[k]->logratio_toprint = HUGE_VAL;
+		solver_run(s[k]);
+	}
+	CuAssertTrue(ct, s[0]->num_verified > 0);
+	CuAssertIntEquals(ct, s[0]->numtries, s[1]->numtries);
+	CuAssertIntEquals(ct, s[0]->num_verified, s[1]->num_verified);
+	CuAssertDblEquals(ct, s[0]->best_logodds, s[1]->best_logodds, 1e-9);
+
+	for (k=0; k<2; k++)
+		free_solver(s[k]);
+	multiindex_free(mi);
+}
+
+// The field, followed by its mirror image: deeper than the smallest
+// AB-pair slots.
+static starxy_t* read_deep_field(CuTest* ct) {
+	starxy_t* field = read_field(ct);
+	starxy_t* deep;
+	int i, N = starxy_n(field);
+	deep = starxy_new(2 * N, FALSE, FALSE);
+	for (i=0; i<N; i++) {
+		starxy_set(deep, i, starxy_getx(field, i), starxy_gety(field, i));
+		starxy_set(deep, N + i, 1000 - starxy_getx(field, i),
+				   starxy_gety(field, i));
+	}
+	starxy_free(field);
+	return deep;
+}
+
+static solver_t* run_deep(CuTest* ct, multiindex_t* mi, int nthreads,
+						  size_t maxmem) {
+	solver_t* s = new_solver(ct, mi, read_deep_field(ct), nthreads);
+	solver_set_keep_logodds(s, HUGE_VAL);
+	s->logratio_toprint = HUGE_VAL;
+	s->endobj = 80;
+	s->pquad_mem_max = maxmem;
+	solver_run(s);
+	CuAssertTrue(ct, !solver_did_solve(s));
+	return s;
+}
+
+void test_pquad_store_over_budget(CuTest* ct) {
+	multiindex_t* mi;
+	solver_t* all[2];
+	solver_t* s[2];
+	int nthreads[2] = { 1, 4 };
+	int k;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	// Past the 64th object, the AB pairs are moved to bigger slots.  With
+	// room for only a few hundred of them, the oldest ones are dropped
+	// too, so fewer quads are tried; which ones is decided between field
+	// objects, so it doesn't depend on the number of threads.
+	for (k=0; k<2; k++) {
+		all[k] = run_deep(ct, mi, nthreads[k], DEFAULT_PQUAD_MEM_MAX);
+		s[k] = run_deep(ct, mi, nthreads[k], 256 * 1024);
+	}
+	CuAssertIntEquals(ct, 79, all[0]->last_examined_object);
+	CuAssertIntEquals(ct, 79, s[0]->last_examined_object);
+	CuAssertIntEquals(ct, all[0]->numtries, all[1]->numtries);
+	CuAssertIntEquals(ct, all[0]->nummatches, all[1]->nummatches);
+	CuAssertTrue(ct, s[0]->numtries > 0);
+	CuAssertTrue(ct, s[0]->numtries < all[0]->numtries);
+	CuAssertIntEquals(ct, s[0]->numtries, s[1]->numtries);
+	CuAssertIntEquals(ct, s[0]->nummatches, s[1]->nummatches);
+
+	for (k=0; k<2; k++) {
+		free_solver(s[k]);
+		free_solver(all[k]);
+	}
+	multiindex_free(mi);
+}
+
+void test_index_threads_share_limits(CuTest* ct) {
+	multiindex_t* mi;
+	solver_t* s;
+	solver_t* all;
+	int maxquads = 3000;
+	int maxmatches = 2;
+
+	log_init(LOG_MSG);
+	mi = open_indexes();
+	CuAssertPtrNotNull(ct, mi);
+
+	// One instance per index, three at once: the limits apply to all of
+	// them together, not to each.  Each instance checks the totals
+	// after each field object, so they can overshoot by a few objects'
+	// worth.
+	s = new_solver(ct, mi, read_field(ct), 3);
+	s->thread_per_index = TRUE;
+	solver_set_keep_logodds(s, HUGE_VAL);
+	s->logratio_toprint = HUGE_VAL;
+	s->maxquads = maxquads;
+	solver_run(s);
+	CuAssertTrue(ct, s->numtries >= maxquads);
+	CuAssertTrue(ct, s->numtries < 2 * maxquads);
+	free_solver(s);
+
+	// The whole search finds only a few more matches than the limit, so
+	// check that it stopped early by the number of quads tried.
+	all = run_exhaustive(ct, mi, 1, 0);
+	s = new_solver(ct, mi, read_field(ct), 3);
+	s->thread_per_index = TRUE;
+	solver_set_keep_logodds(s, HUGE_VAL);
+	s->logratio_toprint = HUGE_VAL;
+	s->maxmatches = maxmatches;
+	solver_run(s);
+	CuAssertTrue(ct, s->nummatches >= maxmatches);
+	CuAssertTrue(ct, s->nummatches <= all->nummatches);
+	CuAssertTrue(ct, s->numtries < all->numtries);
+	free_solver(s);
+	free_solver(all);
+
+	multiindex_free(mi);
+}
@@ -7,6 +7,7 @@
 #include <math.h>
 #include <string.h>
 #include <stdint.h>
+#include <pthread.h>
 
 #include "os-features.h"
 #include "verify.h"
@@ -57,12 +58,106 @@ struct verify_s {
 	double* testsigma; // actually sigma**2.
 	// temp storage
 	int* tbadguys;
+	// if non-NULL, a grid over "testxy" (ie, the field's).
+	const struct verify_field_grid* testgrid;
 
 };
 typedef struct verify_s verify_t;
 
 static anbool* verify_deduplicate_field_stars(verify_t* v, const verify_field_t* vf, double nsigmas);
 
+/*
+ A uniform grid over the field stars (about one star per cell), with the
+ stars of each cell stored contiguously.
+ */
+struct verify_field_grid {
+	double x0, y0;
+	double cellsize;
+	int W, H;
+	// stars in cell c are cellstars[cellstart[c] .. cellstart[c+1]-1]
+	int* cellstart;
+	int* cellstars;
+};
+
+static struct verify_field_grid* field_grid_new(const double* xy, int N) {
+	struct verify_field_grid* g;
+	double x1, y1;
+	int i, *cells;
+
+	g = calloc(1, sizeof(struct verify_field_grid));
+	g->x0 = g->y0 = HUGE_VAL;
+	x1 = y1 = -HUGE_VAL;
+	for (i=0; i<N; i++) {
+		g->x0 = MIN(g->x0, xy[2*i]);
+		g->y0 = MIN(g->y0, xy[2*i+1]);
+		x1 = MAX(x1, xy[2*i]);
+		y1 = MAX(y1, xy[2*i+1]);
+	}
+	if (!N)
+		g->x0 = g->y0 = x1 = y1 = 0.0;
+	g->cellsize = sqrt((x1 - g->x0) * (y1 - g->y0) / MAX(N, 1));
+	// collinear (or one) star(s).
+	g->cellsize = MAX(g->cellsize, MAX(x1 - g->x0, y1 - g->y0) / MAX(N, 1));
+	if (!(g->cellsize > 0.0))
+		g->cellsize = 1.0;
+	g->W = 1 + (int)((x1 - g->x0) / g->cellsize);
+	g->H = 1 + (int)((y1 - g->y0) / g->cellsize);
+
+	g->cellstart = calloc((size_t)g->W * g->H + 1, sizeof(int));
+	g->cellstars = malloc(MAX(N, 1) * sizeof(int));
+	cells = malloc(MAX(N, 1) * sizeof(int));
+	for (i=0; i<N; i++) {
+		int cx = MIN(g->W - 1, (int)((xy[2*i]   - g->x0) / g->cellsize));
+		int cy = MIN(g->H - 1, (int)((xy[2*i+1] - g->y0) / g->cellsize));
+		cells[i] = cy * g->W + cx;
+		g->cellstart[cells[i] + 1]++;
+	}
+	for (i=0; i<g->W * g->H; i++)
+		g->cellstart[i+1] += g->cellstart[i];
+	for (i=0; i<N; i++)
+		g->cellstars[g->cellstart[cells[i]]++] = i;
+	// (the fill above shifted each start to the next cell's)
+	for (i=g->W * g->H; i>0; i--)
+		g->cellstart[i] = g->cellstart[i-1];
+	g->cellstart[0] = 0;
+	free(cells);
+	return g;
+}
+
+static void field_grid_free(struct verify_field_grid* g) {
+	if (!g)
+		return;
+	free(g->cellstart);
+	free(g->cellstars);
+	free(g);
+}
+
+// Is there a star within distance^2 "r2" of "pos"?
+static anbool field_grid_has_star_near(const struct verify_field_grid* g,
+									   const double* xy, const double* pos,
+									   double r2) {
+	double r = sqrt(r2);
+	int cx0, cx1, cy0, cy1, cx, cy, k;
+	cx0 = (int)floor((pos[0] - r - g->x0) / g->cellsize);
+	cx1 = (int)floor((pos[0] + r - g->x0) / g->cellsize);
+	cy0 = (int)floor((pos[1] - r - g->y0) / g->cellsize);
+	cy1 = (int)floor((pos[1] + r - g->y0) / g->cellsize);
+	if (cx1 < 0 || cy1 < 0 || cx0 >= g->W || cy0 >= g->H)
+		return FALSE;
+	cx0 = MAX(cx0, 0);
+	cy0 = MAX(cy0, 0);
+	cx1 = MIN(cx1, g->W - 1);
+	cy1 = MIN(cy1, g->H - 1);
+	for (cy=cy0; cy<=cy1; cy++)
+		for (cx=cx0; cx<=cx1; cx++) {
+			int c = cy * g->W + cx;
+			for (k=g->cellstart[c]; k<g->cellstart[c+1]; k++)
+				if (distsq(xy + 2*g->cellstars[k], pos, 2) <= r2)
+					return TRUE;
+		}
+	return FALSE;
+}
+
 verify_field_t* verify_field_preprocess(const starxy_t* fieldxy) {
     verify_field_t* vf;
     int Nleaf = 5;
@@ -90,6 +185,8 @@ verify_field_t* verify_field_preprocess(const starxy_t* fieldxy) {
 	vf->do_uniformize = TRUE;
 	vf->do_dedup = TRUE;
 	vf->do_ror = TRUE;
+	vf->refcache = NULL;
+	vf->grid = field_grid_new(vf->xy, starxy_n(vf->field));
 
     return vf;
 }
@@ -98,15 +195,428 @@ void verify_field_free(verify_field_t* vf) {
     if (!vf)
         return;
     kdtree_free(vf->ftree);
+	field_grid_free(vf->grid);
 	free(vf->xy);
     free(vf->fieldcopy);
     free(vf);
 }
 
+/*
+ Reference-star cache.
+
+ Each entry holds the stars of one star kdtree within a circle around
+ the centre of a healpix; the healpix size is chosen from the field
+ radius, so field centres that are close together (for a given scale)
+ share an entry.  The circle is made large enough to cover any field
+ of that radius centred in the healpix, and a lookup only hits if the
+ requested field circle is actually inside it.
+ */
+// extra room for larger fields with the same healpix size.
+#define REFCACHE_MARGIN 1.25
+#define REFCACHE_MAX_NSIDE 8192
+
+struct refcache_entry {
+	const startree_t* skdt;
+	int nside;
+	int hp;
+	double center[3];
+	// radius of the circle, as a distance on the unit sphere.
+	double radius;
+	int N;
+	// sorted by sweep number.
+	double* xyz;
+	int* starid;
+	unsigned int lastuse;
+	// users of the entry (see refcache_acquire()); an entry that has
+	// been replaced is freed when the last one lets it go.
+	int nusers;
+	anbool replaced;
+};
+
+// an entry's key; see refcache_acquire().
+struct refcache_key {
+	const startree_t* skdt;
+	int nside;
+	int hp;
+};
+
+struct verify_refcache {
+	struct refcache_entry** entries;
+	int nentries;
+	int maxentries;
+	// ring of recently missed keys: an entry is only filled on its
+	// second miss.
+	struct refcache_key* missed;
+	int nmissed;
+	int imissed;
+	unsigned int clock;
+	int nhit;
+	int nmiss;
+	pthread_mutex_t lock;
+};
+
+// size of the ring of missed keys, per entry.
+#define REFCACHE_MISSED_PER_ENTRY 4
+
+verify_refcache_t* verify_refcache_new(int maxentries) {
+	verify_refcache_t* cache = calloc(1, sizeof(verify_refcache_t));
+	cache->maxentries = MAX(1, maxentries);
+	cache->entries = calloc(cache->maxentries, sizeof(struct refcache_entry*));
+	cache->missed = calloc(REFCACHE_MISSED_PER_ENTRY * cache->maxentries,
+						   sizeof(struct refcache_key));
+	pthread_mutex_init(&cache->lock, NULL);
+	return cache;
+}
+
+static void refcache_entry_free(struct refcache_entry* e) {
+	free(e->xyz);
+	free(e->starid);
+	free(e);
+}
+
+// Drops "e" from the cache (which must be locked).
+static void refcache_entry_replace(struct refcache_entry* e) {
+	if (e->nusers)
+		e->replaced = TRUE;
+	else
+		refcache_entry_free(e);
+}
+
+void verify_refcache_clear(verify_refcache_t* cache) {
+	int i;
+	if (!cache)
+		return;
+	pthread_mutex_lock(&cache->lock);
+	for (i=0; i<cache->nentries; i++) {
+		refcache_entry_replace(cache->entries[i]);
+		cache->entries[i] = NULL;
+	}
+	cache->nentries = 0;
+	cache->nmissed = 0;
+	cache->imissed = 0;
+	pthread_mutex_unlock(&cache->lock);
+}
+
+void verify_refcache_free(verify_refcache_t* cache) {
+	if (!cache)
+		return;
+	verify_refcache_clear(cache);
+	pthread_mutex_destroy(&cache->lock);
+	free(cache->missed);
+	free(cache->entries);
+	free(cache);
+}
+
+void verify_refcache_get_counts(verify_refcache_t* cache,
+								int* p_nhit, int* p_nmiss) {
+	pthread_mutex_lock(&cache->lock);
+	if (p_nhit)
+		*p_nhit = cache->nhit;
+	if (p_nmiss)
+		*p_nmiss = cache->nmiss;
+	pthread_mutex_unlock(&cache->lock);
+}
+
+// Healpix size (a power of two, so that similar scales share) for
+// fields of radius^2 "r2".
+static int refcache_nside(double r2) {
+	double nside = healpix_nside_for_side_length_arcmin(0.5 * rad2arcmin(distsq2rad(r2)));
+	int n = 1;
+	while (n*2 <= nside && n*2 <= REFCACHE_MAX_NSIDE)
+		n *= 2;
+	return n;
+}
+
+// Copies the stars of "e" within the circle (center, r2), keeping their order.
+static void refcache_entry_search(const struct refcache_entry* e,
+								  const double* center, double r2,
+								  double** p_xyz, int** p_starid, int* p_N) {
+	double* xyz = NULL;
+	int* starid = NULL;
+	int i, N = 0;
+	for (i=0; i<e->N; i++) {
+		if (distsq(e->xyz + 3*i, center, 3) > r2)
+			continue;
+		if (!xyz) {
+			xyz = malloc((size_t)(e->N - i) * 3 * sizeof(double));
+			starid = malloc((size_t)(e->N - i) * sizeof(int));
+		}
+		memcpy(xyz + 3*N, e->xyz + 3*i, 3 * sizeof(double));
+		starid[N] = e->starid[i];
+		N++;
+	}
+	*p_xyz = xyz;
+	*p_starid = starid;
+	*p_N = N;
+}
+
+// Searches the star kdtree around the centre of the healpix and sorts
+// the stars by sweep number, breaking ties by kdtree order.
+static void refcache_entry_fill(struct refcache_entry* e,
+								const startree_t* skdt, int nside, int hp,
+								const double* center, double r2) {
+	double corner[3];
+	double* xyz;
+	int* starid;
+	int64_t* keys;
+	int i, dx, dy;
+	double cellrad = 0.0;
+
+	e->skdt = skdt;
+	e->nside = nside;
+	e->hp = hp;
+	healpix_to_xyzarr(hp, nside, 0.5, 0.5, e->center);
+	for (dx=0; dx<2; dx++)
+		for (dy=0; dy<2; dy++) {
+			healpix_to_xyzarr(hp, nside, dx, dy, corner);
+			cellrad = MAX(cellrad, sqrt(distsq(corner, e->center, 3)));
+		}
+	e->radius = MAX(cellrad + REFCACHE_MARGIN * sqrt(r2),
+					sqrt(distsq(center, e->center, 3)) + sqrt(r2));
+
+	startree_search_for(skdt, e->center, square(e->radius), &xyz, NULL,
+						&starid, &e->N);
+	e->xyz = NULL;
+	e->starid = NULL;
+	if (!e->N)
+		return;
+	keys = malloc((size_t)e->N * sizeof(int64_t));
+	for (i=0; i<e->N; i++)
+		keys[i] = ((int64_t)skdt->sweep[starid[i]] << 32) | i;
+	qsort(keys, e->N, sizeof(int64_t), compare_int64_asc);
+	e->xyz = malloc((size_t)e->N * 3 * sizeof(double));
+	e->starid = malloc((size_t)e->N * sizeof(int));
+	for (i=0; i<e->N; i++) {
+		int j = (int)(keys[i] & 0xffffffff);
+		memcpy(e->xyz + 3*i, xyz + 3*j, 3 * sizeof(double));
+		e->starid[i] = starid[j];
+	}
+	free(keys);
+	free(xyz);
+	free(starid);
+}
+
+/*
+ Has "key" missed recently?  If not, remember that it has.  (Call with
+ the cache locked.)
+ */
+static anbool refcache_missed_before(verify_refcache_t* cache,
+									 const struct refcache_key* key) {
+	int i, nmax = REFCACHE_MISSED_PER_ENTRY * cache->maxentries;
+	for (i=0; i<cache->nmissed; i++) {
+		const struct refcache_key* k = cache->missed + i;
+		if (k->skdt == key->skdt && k->nside == key->nside && k->hp == key->hp)
+			return TRUE;
+	}
+	cache->missed[cache->imissed] = *key;
+	cache->imissed = (cache->imissed + 1) % nmax;
+	cache->nmissed = MIN(cache->nmissed + 1, nmax);
+	return FALSE;
+}
+
+/*
+ Returns the entry covering the circle (center, r2), filling it from the
+ star kdtree if necessary.  The entry is read-only, and stays valid
+ (without holding the cache's lock) until refcache_release().
+
+ Filling an entry costs more than searching for just the circle's
+ stars, and hypotheses for false matches are scattered over the sky,
+ so a key only gets an entry the second time it misses; the first
+ time, this returns NULL.
+ */
+static struct refcache_entry* refcache_acquire(verify_refcache_t* cache,
+											   const startree_t* skdt,
+											   const double* center, double r2) {
+	struct refcache_entry* fresh;
+	struct refcache_entry* e;
+	struct refcache_key key;
+	int nside, hp, i;
+	int slot = -1;
+
+	nside = refcache_nside(r2);
+	hp = xyzarrtohealpix(center, nside);
+	key.skdt = skdt;
+	key.nside = nside;
+	key.hp = hp;
+
+	pthread_mutex_lock(&cache->lock);
+	for (i=0; i<cache->nentries; i++) {
+		e = cache->entries[i];
+		if (e->skdt != skdt || e->nside != nside || e->hp != hp)
+			continue;
+		if (sqrt(distsq(center, e->center, 3)) + sqrt(r2) <= e->radius) {
+			e->lastuse = ++cache->clock;
+			e->nusers++;
+			cache->nhit++;
+			pthread_mutex_unlock(&cache->lock);
+			return e;
+		}
+		break;
+	}
+	cache->nmiss++;
+	if (!refcache_missed_before(cache, &key)) {
+		pthread_mutex_unlock(&cache->lock);
+		return NULL;
+	}
+	pthread_mutex_unlock(&cache->lock);
+
+	// search outside the lock; another thread may be doing the same.
+	fresh = calloc(1, sizeof(struct refcache_entry));
+	refcache_entry_fill(fresh, skdt, nside, hp, center, r2);
+	fresh->nusers = 1;
+
+	pthread_mutex_lock(&cache->lock);
+	fresh->lastuse = ++cache->clock;
+	for (i=0; i<cache->nentries; i++) {
+		e = cache->entries[i];
+		if (e->skdt == skdt && e->nside == nside && e->hp == hp) {
+			slot = i;
+			break;
+		}
+	}
+	if (slot == -1) {
+		if (cache->nentries < cache->maxentries)
+			slot = cache->nentries++;
+		else {
+			slot = 0;
+			for (i=1; i<cache->nentries; i++)
+				if (cache->entries[i]->lastuse < cache->entries[slot]->lastuse)
+					slot = i;
+		}
+	}
+	if (cache->entries[slot])
+		refcache_entry_replace(cache->entries[slot]);
+	cache->entries[slot] = fresh;
+	pthread_mutex_unlock(&cache->lock);
+	return fresh;
+}
+
+static void refcache_release(verify_refcache_t* cache,
+							 struct refcache_entry* e) {
+	pthread_mutex_lock(&cache->lock);
+	e->nusers--;
+	if (e->replaced && !e->nusers)
+		refcache_entry_free(e);
+	pthread_mutex_unlock(&cache->lock);
+}
+
+/*
+ Like startree_search_for(), but the stars come back sorted by sweep
+ number.  Returns FALSE (and does nothing) if the stars aren't cached.
+ */
+static anbool refcache_search(verify_refcache_t* cache, const startree_t* skdt,
+							  const double* center, double r2,
+							  double** p_xyz, int** p_starid, int* p_N) {
+	struct refcache_entry* e = refcache_acquire(cache, skdt, center, r2);
+	if (!e)
+		return FALSE;
+	refcache_entry_search(e, center, r2, p_xyz, p_starid, p_N);
+	refcache_release(cache, e);
+	return TRUE;
+}
+
 static double get_sigma2_at_radius(double verify_pix2, double r2, double quadr2) {
 	return verify_pix2 * (1.0 + r2/quadr2);
 }
 
+int verify_quick_check(const startree_t* skdt, const MatchObj* mo,
+					   const verify_field_t* vf, double verify_pix2,
+					   anbool distance_from_quad_bonus,
+					   int nref, double nsigma,
+					   int* p_ntested, double* p_nchance) {
+	sip_t wcs;
+	const double* center = mo->center;
+	double r2 = square(mo->radius);
+	double qc[2], Q2 = 0.0;
+	struct refcache_entry* e = NULL;
+	double* xyz = NULL;
+	int* starid = NULL;
+	int* perm = NULL;
+	int i, j, N;
+	int ntested = 0, nmatch = 0;
+	double nchance = 0.0;
+	double density;
+	int minsweep;
+
+	if (!vf->grid) {
+		if (p_ntested)
+			*p_ntested = 0;
+		if (p_nchance)
+			*p_nchance = 0.0;
+		return 0;
+	}
+	// field stars per square pixel.
+	density = starxy_n(vf->field) /
+		(vf->grid->W * vf->grid->H * square(vf->grid->cellsize));
+	sip_wrap_tan(&mo->wcstan, &wcs);
+	if (distance_from_quad_bonus)
+		verify_get_quad_center(vf, mo, qc, &Q2);
+	// The field need not contain the brightest reference stars (they may
+	// be saturated, or off the top of the image's range); the quad shows
+	// it reaches its own stars' depth, so start testing there.
+	minsweep = skdt->sweep[mo->star[0]];
+	for (j=1; j<mo->dimquads; j++)
+		minsweep = MIN(minsweep, skdt->sweep[mo->star[j]]);
+
+	if (vf->refcache)
+		e = refcache_acquire(vf->refcache, skdt, center, r2);
+	if (e) {
+		xyz = e->xyz;
+		starid = e->starid;
+		N = e->N;
+	} else {
+		int* sweep;
+		startree_search_for(skdt, center, r2, &xyz, NULL, &starid, &N);
+		sweep = malloc(MAX(N, 1) * sizeof(int));
+		for (i=0; i<N; i++)
+			sweep[i] = skdt->sweep[starid[i]];
+		perm = permuted_sort(sweep, sizeof(int), compare_ints_asc, NULL, N);
+		free(sweep);
+	}
+
+	for (i=0; i<N && ntested < nref; i++) {
+		int k = perm ? perm[i] : i;
+		double xy[2];
+		double sigma2;
+		anbool inquad = FALSE;
+		if (e && distsq(xyz + 3*k, center, 3) > r2)
+			continue;
+		if (skdt->sweep[starid[k]] < minsweep)
+			continue;
+		for (j=0; j<mo->dimquads; j++)
+			if (starid[k] == mo->star[j]) {
+				inquad = TRUE;
+				break;
+			}
+		if (inquad)
+			continue;
+		if (!sip_xyzarr2pixelxy(&wcs, xyz + 3*k, xy, xy+1) ||
+			!sip_pixel_is_inside_image(&wcs, xy[0], xy[1]))
+			continue;
+		ntested++;
+		if (distance_from_quad_bonus)
+			sigma2 = get_sigma2_at_radius(verify_pix2, distsq(xy, qc, 2), Q2);
+		else
+			sigma2 = verify_pix2;
+		if (field_grid_has_star_near(vf->grid, vf->xy, xy, square(nsigma) * sigma2))
+			nmatch++;
+		nchance += MIN(1.0, density * M_PI * square(nsigma) * sigma2);
+	}
+
+	if (e)
+		refcache_release(vf->refcache, e);
+	else {
+		free(xyz);
+		free(starid);
+		free(perm);
+	}
+	if (p_ntested)
+		*p_ntested = ntested;
+	if (p_nchance)
+		*p_nchance = nchance;
+	return nmatch;
+}
+
 static double* compute_sigma2s(const verify_field_t* vf,
 							   const double* xy, int NF,
 							   const double* qc, double Q2,
@@ -189,6 +699,7 @@ static void verify_get_test_stars(verify_t* v, const verify_field_t* vf, MatchOb
 
 	v->NTall = starxy_n(vf->field);
 	v->testxy = vf->xy;
+	v->testgrid = vf->grid;
 	v->NT = v->NTall;
 	v->testsigma = verify_compute_sigma2s(vf, mo, pix2, do_gamma);
 	v->testperm = permutation_init(NULL, v->NTall);
@@ -447,6 +958,50 @@ static void verify_apply_ror(verify_t* v,
 		*p_uninh = uni_nh;
 }
 
+/*
+ For each test star, finds the nearest good reference star within
+ "nsigma2" sigmas^2, by looking up the test stars around each reference
+ star in the field grid.  The reference stars are numbered by their
+ position in "refperm"; "nearest" (-1 for none) and "nearestd2" are
+ indexed like "testxy".
+ */
+static void nearest_refs_from_grid(const verify_t* v, double nsigma2,
+								   int* nearest, double* nearestd2) {
+	const struct verify_field_grid* g = v->testgrid;
+	double maxsig2 = 0.0;
+	double r;
+	int i, k, cx, cy;
+
+	for (i=0; i<v->NTall; i++)
+		nearest[i] = -1;
+	for (i=0; i<v->NT; i++)
+		maxsig2 = MAX(maxsig2, v->testsigma[v->testperm[i]]);
+	r = sqrt(nsigma2 * maxsig2);
+
+	for (i=0; i<v->NR; i++) {
+		const double* rxy = v->refxy + 2 * v->refperm[i];
+		int cx0, cx1, cy0, cy1;
+		cx0 = MAX(0,        (int)floor((rxy[0] - r - g->x0) / g->cellsize));
+		cx1 = MIN(g->W - 1, (int)floor((rxy[0] + r - g->x0) / g->cellsize));
+		cy0 = MAX(0,        (int)floor((rxy[1] - r - g->y0) / g->cellsize));
+		cy1 = MIN(g->H - 1, (int)floor((rxy[1] + r - g->y0) / g->cellsize));
+		for (cy=cy0; cy<=cy1; cy++)
+			for (cx=cx0; cx<=cx1; cx++) {
+				int c = cy * g->W + cx;
+				for (k=g->cellstart[c]; k<g->cellstart[c+1]; k++) {
+					int ti = g->cellstars[k];
+					double d2 = distsq(v->testxy + 2*ti, rxy, 2);
+					if (d2 > nsigma2 * v->testsigma[ti])
+						continue;
+					if (nearest[ti] == -1 || d2 < nearestd2[ti]) {
+						nearest[ti] = i;
+						nearestd2[ti] = d2;
+					}
+				}
+			}
+	}
+}
+
 static double real_verify_star_lists(verify_t* v,
 									 double effective_area,
 									 double distractors,
@@ -465,8 +1020,10 @@ static double real_verify_star_lists(verify_t* v,
 	double logbg;
 	double logd;
 	//double matchnsigma = 5.0;
-	double* refcopy;
-	kdtree_t* rtree;
+	double* refcopy = NULL;
+	kdtree_t* rtree = NULL;
+	int* nearest = NULL;
+	double* nearestd2 = NULL;
 	int Nleaf = 10;
 	int* rmatches;
 	double* rprobs;
@@ -480,21 +1037,31 @@ static double real_verify_star_lists(verify_t* v,
 		return -HUGE_VAL;
 	}
 
-	// Build a tree out of the index stars in pixel space...
-	// kdtree scrambles the data array so make a copy first.
-	refcopy = malloc(2 * v->NR * sizeof(double));
 	// we must pack/unpermute the refxys; remember this packing order in "rperm".
 	// we borrow storage for "rperm"...
 	if (!v->badguys)
 		v->badguys = malloc(v->NR * sizeof(int));
 	rperm = v->badguys;
-	for (i=0; i<v->NR; i++) {
-		int ri = v->refperm[i];
-		rperm[i] = ri;
-		refcopy[2*i+0] = v->refxy[2*ri+0];
-		refcopy[2*i+1] = v->refxy[2*ri+1];
+	for (i=0; i<v->NR; i++)
+		rperm[i] = v->refperm[i];
+
+	if (v->testgrid) {
+		// The test stars are the field's, which have a grid already:
+		// find each one's nearest ref star (within 5 sigma) up front.
+		nearest = malloc(v->NTall * sizeof(int));
+		nearestd2 = malloc(v->NTall * sizeof(double));
+		nearest_refs_from_grid(v, 25.0, nearest, nearestd2);
+	} else {
+		// Build a tree out of the index stars in pixel space...
+		// kdtree scrambles the data array so make a copy first.
+		refcopy = malloc(2 * v->NR * sizeof(double));
+		for (i=0; i<v->NR; i++) {
+			int ri = v->refperm[i];
+			refcopy[2*i+0] = v->refxy[2*ri+0];
+			refcopy[2*i+1] = v->refxy[2*ri+1];
+		}
+		rtree = kdtree_build(NULL, refcopy, v->NR, 2, Nleaf, KDTT_DOUBLE, KD_BUILD_SPLIT);
 	}
-	rtree = kdtree_build(NULL, refcopy, v->NR, 2, Nleaf, KDTT_DOUBLE, KD_BUILD_SPLIT);
 
 	rmatches = malloc(v->NR * sizeof(int));
 	for (i=0; i<v->NR; i++)
@@ -544,7 +1111,11 @@ static double real_verify_star_lists(verify_t* v,
 		debug2("test star %i: (%.1f,%.1f), sigma: %.1f\n", i, testxy[0], testxy[1], sqrt(sig2));
 
 		// find nearest ref star (within 5 sigma)
-        tmpi = kdtree_nearest_neighbour_within(rtree, testxy, sig2 * 25.0, &d2);
+		if (nearest) {
+			tmpi = nearest[ti];
+			d2 = nearestd2[ti];
+		} else
+			tmpi = kdtree_nearest_neighbour_within(rtree, testxy, sig2 * 25.0, &d2);
 		if (tmpi == -1) {
 			// no nearest neighbour within range.
 			debug2("  No nearest neighbour.\n");
@@ -553,7 +1124,7 @@ static double real_verify_star_lists(verify_t* v,
 		} else {
 			double loggmax;
 			// Note that "refi" is w.r.t. the "refcopy" array (not the original data).
-			refi = kdtree_permute(rtree, tmpi);
+			refi = nearest ? tmpi : kdtree_permute(rtree, tmpi);
 			// peak value of the Gaussian
 			loggmax = log((1.0 - distractors) / (2.0 * M_PI * sig2 * v->NR));
 			// FIXME - do something with uninformative hits?
@@ -768,8 +1339,11 @@ static double real_verify_star_lists(verify_t* v,
 
 	free(rprobs);
 
-	kdtree_free(rtree);
+	if (rtree)
+		kdtree_free(rtree);
 	free(refcopy);
+	free(nearest);
+	free(nearestd2);
 
 	return bestlogodds;
 }
@@ -1237,6 +1811,7 @@ void verify_hit(const startree_t* skdt, int index_cutnside, MatchObj* mo,
 	verify_t* v = &the_v;
 	int NRimage;
 	int ibailed, istopped;
+	anbool cached = FALSE;
 
 	assert(mo->wcs_valid || sip);
 	assert(isfinite(logaccept));
@@ -1289,7 +1864,11 @@ void verify_hit(const startree_t* skdt, int index_cutnside, MatchObj* mo,
 	 */
 	assert(skdt->sweep);
 	// Find all index stars within the bounding circle of the field.
-	startree_search_for(skdt, fieldcenter, fieldr2, &refxyz, NULL, &v->refstarid, &v->NRall);
+	if (vf && vf->refcache)
+		cached = refcache_search(vf->refcache, skdt, fieldcenter, fieldr2,
+								 &refxyz, &v->refstarid, &v->NRall);
+	if (!cached)
+		startree_search_for(skdt, fieldcenter, fieldr2, &refxyz, NULL, &v->refstarid, &v->NRall);
 	debug2("%i reference stars in the bounding circle\n", v->NRall);
 	if (!refxyz) {
 		// no stars in range.
@@ -1324,14 +1903,17 @@ void verify_hit(const startree_t* skdt, int index_cutnside, MatchObj* mo,
 	// bottom "NRimage" of the "refperm" array will be accessed in the
 	// permuted_sort below, so none of
 	// the elements between NRimage and NRall will be touched.)
-	sweep = malloc(v->NRall * sizeof(int));
-	for (i=0; i<v->NRall; i++)
-		sweep[i] = skdt->sweep[v->refstarid[i]];
-	// Note here that we're passing in an existing permutation array; it
-	// gets re-permuted during this call.
-	permuted_sort(sweep, sizeof(int), compare_ints_asc, v->refperm, v->NR);
-	free(sweep);
-	sweep = NULL;
+	// (Stars from the cache are already in sweep order.)
+	if (!cached) {
+		sweep = malloc(v->NRall * sizeof(int));
+		for (i=0; i<v->NRall; i++)
+			sweep[i] = skdt->sweep[v->refstarid[i]];
+		// Note here that we're passing in an existing permutation array; it
+		// gets re-permuted during this call.
+		permuted_sort(sweep, sizeof(int), compare_ints_asc, v->refperm, v->NR);
+		free(sweep);
+		sweep = NULL;
+	}
 	debug2("Found %i reference stars.\n", v->NR);
 
 	// "refstarids" are indices into the star kdtree and could be used to
@@ -0,0 +1,892 @@
+{ .is_ngc = TRUE,
+  .id = 104,
+  .name = "47 Tuc"
+},
+{ .is_ngc = TRUE,
+  .id = 4038,
+  .name = "Antennae"
+},
+{ .is_ngc = TRUE,
+  .id = 4039,
+  .name = "Antennae"
+},
+{ .is_ngc = TRUE,
+  .id = 6822,
+  .name = "Barnard's galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 7088,
+  .name = "Baxendell's unphotographable nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2537,
+  .name = "Bear Paw galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 2632,
+  .name = "Beehive cluster"
+},
+{ .is_ngc = TRUE,
+  .id = 4826,
+  .name = "Black-eye galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 6826,
+  .name = "Blinking planetary"
+},
+{ .is_ngc = TRUE,
+  .id = 7662,
+  .name = "Blue Snowball"
+},
+{ .is_ngc = TRUE,
+  .id = 3918,
+  .name = "Blue planetary"
+},
+{ .is_ngc = TRUE,
+  .id = 3031,
+  .name = "Bode's nebulae"
+},
+{ .is_ngc = TRUE,
+  .id = 3034,
+  .name = "Bode's nebulae"
+},
+{ .is_ngc = TRUE,
+  .id = 4169,
+  .name = "Box"
+},
+{ .is_ngc = TRUE,
+  .id = 4173,
+  .name = "Box"
+},
+{ .is_ngc = TRUE,
+  .id = 4174,
+  .name = "Box"
+},
+{ .is_ngc = TRUE,
+  .id = 4175,
+  .name = "Box"
+},
+{ .is_ngc = TRUE,
+  .id = 6309,
+  .name = "Box nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 7635,
+  .name = "Bubble nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6302,
+  .name = "Bug nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6405,
+  .name = "Butterfly cluster"
+},
+{ .is_ngc = FALSE,
+  .id = 2220,
+  .name = "Butterfly nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 1499,
+  .name = "California nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2264,
+  .name = "Christmas Tree cluster"
+},
+{ .is_ngc = FALSE,
+  .id = 5146,
+  .name = "Cocoon nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2264,
+  .name = "Cone nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 3745,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 3746,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 3748,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 3750,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 3751,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 3753,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 3754,
+  .name = "Copeland's Septet"
+},
+{ .is_ngc = TRUE,
+  .id = 1952,
+  .name = "Crab nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6888,
+  .name = "Crescent nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 869,
+  .name = "Double cluster"
+},
+{ .is_ngc = TRUE,
+  .id = 884,
+  .name = "Double cluster"
+},
+{ .is_ngc = TRUE,
+  .id = 6853,
+  .name = "Dumbbell nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6611,
+  .name = "Eagle nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 3132,
+  .name = "Eight-burst planetary"
+},
+{ .is_ngc = TRUE,
+  .id = 2392,
+  .name = "Eskimo nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 4435,
+  .name = "The Eyes"
+},
+{ .is_ngc = TRUE,
+  .id = 4438,
+  .name = "The Eyes"
+},
+{ .is_ngc = TRUE,
+  .id = 6960,
+  .name = "Filamentary nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 405,
+  .name = "Flaming Star nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 3242,
+  .name = "Ghost of Jupiter"
+},
+{ .is_ngc = TRUE,
+  .id = 6205,
+  .name = "Great Cluster in Hercules"
+},
+{ .is_ngc = TRUE,
+  .id = 224,
+  .name = "Great Nebula in Andromeda"
+},
+{ .is_ngc = TRUE,
+  .id = 1976,
+  .name = "Great Nebula in Orion"
+},
+{ .is_ngc = TRUE,
+  .id = 2685,
+  .name = "Helix galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 7293,
+  .name = "Helix nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 1555,
+  .name = "Hind's variable nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 434,
+  .name = "Horsehead nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6523,
+  .name = "Hourglass nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2261,
+  .name = "Hubble's variable neb"
+},
+{ .is_ngc = TRUE,
+  .id = 4755,
+  .name = "Jewel Box"
+},
+{ .is_ngc = TRUE,
+  .id = 6960,
+  .name = "Lace-work nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6523,
+  .name = "Lagoon nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 650,
+  .name = "Little Dumbbell"
+},
+{ .is_ngc = TRUE,
+  .id = 651,
+  .name = "Little Dumbbell"
+},
+{ .is_ngc = TRUE,
+  .id = 6445,
+  .name = "Little Gem"
+},
+{ .is_ngc = TRUE,
+  .id = 1952,
+  .name = "M 1"
+},
+{ .is_ngc = TRUE,
+  .id = 7089,
+  .name = "M 2"
+},
+{ .is_ngc = TRUE,
+  .id = 5272,
+  .name = "M 3"
+},
+{ .is_ngc = TRUE,
+  .id = 6121,
+  .name = "M 4"
+},
+{ .is_ngc = TRUE,
+  .id = 5904,
+  .name = "M 5"
+},
+{ .is_ngc = TRUE,
+  .id = 6405,
+  .name = "M 6"
+},
+{ .is_ngc = TRUE,
+  .id = 6475,
+  .name = "M 7"
+},
+{ .is_ngc = TRUE,
+  .id = 6523,
+  .name = "M 8"
+},
+{ .is_ngc = TRUE,
+  .id = 6333,
+  .name = "M 9"
+},
+{ .is_ngc = TRUE,
+  .id = 6254,
+  .name = "M 10"
+},
+{ .is_ngc = TRUE,
+  .id = 6705,
+  .name = "M 11"
+},
+{ .is_ngc = TRUE,
+  .id = 6218,
+  .name = "M 12"
+},
+{ .is_ngc = TRUE,
+  .id = 6205,
+  .name = "M 13"
+},
+{ .is_ngc = TRUE,
+  .id = 6402,
+  .name = "M 14"
+},
+{ .is_ngc = TRUE,
+  .id = 7078,
+  .name = "M 15"
+},
+{ .is_ngc = TRUE,
+  .id = 6611,
+  .name = "M 16"
+},
+{ .is_ngc = TRUE,
+  .id = 6618,
+  .name = "M 17"
+},
+{ .is_ngc = TRUE,
+  .id = 6613,
+  .name = "M 18"
+},
+{ .is_ngc = TRUE,
+  .id = 6273,
+  .name = "M 19"
+},
+{ .is_ngc = TRUE,
+  .id = 6514,
+  .name = "M 20"
+},
+{ .is_ngc = TRUE,
+  .id = 6531,
+  .name = "M 21"
+},
+{ .is_ngc = TRUE,
+  .id = 6656,
+  .name = "M 22"
+},
+{ .is_ngc = TRUE,
+  .id = 6494,
+  .name = "M 23"
+},
+{ .is_ngc = FALSE,
+  .id = 4725,
+  .name = "M 25"
+},
+{ .is_ngc = TRUE,
+  .id = 6694,
+  .name = "M 26"
+},
+{ .is_ngc = TRUE,
+  .id = 6853,
+  .name = "M 27"
+},
+{ .is_ngc = TRUE,
+  .id = 6626,
+  .name = "M 28"
+},
+{ .is_ngc = TRUE,
+  .id = 6913,
+  .name = "M 29"
+},
+{ .is_ngc = TRUE,
+  .id = 7099,
+  .name = "M 30"
+},
+{ .is_ngc = TRUE,
+  .id = 224,
+  .name = "M 31"
+},
+{ .is_ngc = TRUE,
+  .id = 221,
+  .name = "M 32"
+},
+{ .is_ngc = TRUE,
+  .id = 598,
+  .name = "M 33"
+},
+{ .is_ngc = TRUE,
+  .id = 1039,
+  .name = "M 34"
+},
+{ .is_ngc = TRUE,
+  .id = 2168,
+  .name = "M 35"
+},
+{ .is_ngc = TRUE,
+  .id = 1960,
+  .name = "M 36"
+},
+{ .is_ngc = TRUE,
+  .id = 2099,
+  .name = "M 37"
+},
+{ .is_ngc = TRUE,
+  .id = 1912,
+  .name = "M 38"
+},
+{ .is_ngc = TRUE,
+  .id = 7092,
+  .name = "M 39"
+},
+{ .is_ngc = TRUE,
+  .id = 2287,
+  .name = "M 41"
+},
+{ .is_ngc = TRUE,
+  .id = 1976,
+  .name = "M 42"
+},
+{ .is_ngc = TRUE,
+  .id = 1982,
+  .name = "M 43"
+},
+{ .is_ngc = TRUE,
+  .id = 2632,
+  .name = "M 44"
+},
+{ .is_ngc = TRUE,
+  .id = 2437,
+  .name = "M 46"
+},
+{ .is_ngc = TRUE,
+  .id = 2422,
+  .name = "M 47"
+},
+{ .is_ngc = TRUE,
+  .id = 2548,
+  .name = "M 48"
+},
+{ .is_ngc = TRUE,
+  .id = 4472,
+  .name = "M 49"
+},
+{ .is_ngc = TRUE,
+  .id = 2323,
+  .name = "M 50"
+},
+{ .is_ngc = TRUE,
+  .id = 5194,
+  .name = "M 51"
+},
+{ .is_ngc = TRUE,
+  .id = 5195,
+  .name = "M 51"
+},
+{ .is_ngc = TRUE,
+  .id = 7654,
+  .name = "M 52"
+},
+{ .is_ngc = TRUE,
+  .id = 5024,
+  .name = "M 53"
+},
+{ .is_ngc = TRUE,
+  .id = 6715,
+  .name = "M 54"
+},
+{ .is_ngc = TRUE,
+  .id = 6809,
+  .name = "M 55"
+},
+{ .is_ngc = TRUE,
+  .id = 6779,
+  .name = "M 56"
+},
+{ .is_ngc = TRUE,
+  .id = 6720,
+  .name = "M 57"
+},
+{ .is_ngc = TRUE,
+  .id = 4579,
+  .name = "M 58"
+},
+{ .is_ngc = TRUE,
+  .id = 4621,
+  .name = "M 59"
+},
+{ .is_ngc = TRUE,
+  .id = 4649,
+  .name = "M 60"
+},
+{ .is_ngc = TRUE,
+  .id = 4303,
+  .name = "M 61"
+},
+{ .is_ngc = TRUE,
+  .id = 6266,
+  .name = "M 62"
+},
+{ .is_ngc = TRUE,
+  .id = 5055,
+  .name = "M 63"
+},
+{ .is_ngc = TRUE,
+  .id = 4826,
+  .name = "M 64"
+},
+{ .is_ngc = TRUE,
+  .id = 3623,
+  .name = "M 65"
+},
+{ .is_ngc = TRUE,
+  .id = 3627,
+  .name = "M 66"
+},
+{ .is_ngc = TRUE,
+  .id = 2682,
+  .name = "M 67"
+},
+{ .is_ngc = TRUE,
+  .id = 4590,
+  .name = "M 68"
+},
+{ .is_ngc = TRUE,
+  .id = 6637,
+  .name = "M 69"
+},
+{ .is_ngc = TRUE,
+  .id = 6681,
+  .name = "M 70"
+},
+{ .is_ngc = TRUE,
+  .id = 6838,
+  .name = "M 71"
+},
+{ .is_ngc = TRUE,
+  .id = 6981,
+  .name = "M 72"
+},
+{ .is_ngc = TRUE,
+  .id = 6994,
+  .name = "M 73"
+},
+{ .is_ngc = TRUE,
+  .id = 628,
+  .name = "M 74"
+},
+{ .is_ngc = TRUE,
+  .id = 6864,
+  .name = "M 75"
+},
+{ .is_ngc = TRUE,
+  .id = 650,
+  .name = "M 76"
+},
+{ .is_ngc = TRUE,
+  .id = 651,
+  .name = "M 76"
+},
+{ .is_ngc = TRUE,
+  .id = 1068,
+  .name = "M 77"
+},
+{ .is_ngc = TRUE,
+  .id = 2068,
+  .name = "M 78"
+},
+{ .is_ngc = TRUE,
+  .id = 1904,
+  .name = "M 79"
+},
+{ .is_ngc = TRUE,
+  .id = 6093,
+  .name = "M 80"
+},
+{ .is_ngc = TRUE,
+  .id = 3031,
+  .name = "M 81"
+},
+{ .is_ngc = TRUE,
+  .id = 3034,
+  .name = "M 82"
+},
+{ .is_ngc = TRUE,
+  .id = 5236,
+  .name = "M 83"
+},
+{ .is_ngc = TRUE,
+  .id = 4374,
+  .name = "M 84"
+},
+{ .is_ngc = TRUE,
+  .id = 4382,
+  .name = "M 85"
+},
+{ .is_ngc = TRUE,
+  .id = 4406,
+  .name = "M 86"
+},
+{ .is_ngc = TRUE,
+  .id = 4486,
+  .name = "M 87"
+},
+{ .is_ngc = TRUE,
+  .id = 4501,
+  .name = "M 88"
+},
+{ .is_ngc = TRUE,
+  .id = 4552,
+  .name = "M 89"
+},
+{ .is_ngc = TRUE,
+  .id = 4569,
+  .name = "M 90"
+},
+{ .is_ngc = TRUE,
+  .id = 4548,
+  .name = "M 91"
+},
+{ .is_ngc = TRUE,
+  .id = 6341,
+  .name = "M 92"
+},
+{ .is_ngc = TRUE,
+  .id = 2447,
+  .name = "M 93"
+},
+{ .is_ngc = TRUE,
+  .id = 4736,
+  .name = "M 94"
+},
+{ .is_ngc = TRUE,
+  .id = 3351,
+  .name = "M 95"
+},
+{ .is_ngc = TRUE,
+  .id = 3368,
+  .name = "M 96"
+},
+{ .is_ngc = TRUE,
+  .id = 3587,
+  .name = "M 97"
+},
+{ .is_ngc = TRUE,
+  .id = 4192,
+  .name = "M 98"
+},
+{ .is_ngc = TRUE,
+  .id = 4254,
+  .name = "M 99"
+},
+{ .is_ngc = TRUE,
+  .id = 4321,
+  .name = "M 100"
+},
+{ .is_ngc = TRUE,
+  .id = 5457,
+  .name = "M 101"
+},
+{ .is_ngc = TRUE,
+  .id = 581,
+  .name = "M 103"
+},
+{ .is_ngc = TRUE,
+  .id = 4594,
+  .name = "M 104"
+},
+{ .is_ngc = TRUE,
+  .id = 3379,
+  .name = "M 105"
+},
+{ .is_ngc = TRUE,
+  .id = 4258,
+  .name = "M 106"
+},
+{ .is_ngc = TRUE,
+  .id = 6171,
+  .name = "M 107"
+},
+{ .is_ngc = TRUE,
+  .id = 3556,
+  .name = "M 108"
+},
+{ .is_ngc = TRUE,
+  .id = 3992,
+  .name = "M 109"
+},
+{ .is_ngc = TRUE,
+  .id = 205,
+  .name = "M 110"
+},
+{ .is_ngc = TRUE,
+  .id = 1432,
+  .name = "Maia nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 1435,
+  .name = "Merope nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 4676,
+  .name = "The Mice"
+},
+{ .is_ngc = TRUE,
+  .id = 6992,
+  .name = "Network nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6995,
+  .name = "Network nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 7000,
+  .name = "North America nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6618,
+  .name = "Omega nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 3587,
+  .name = "Owl nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 708,
+  .name = "Papillon"
+},
+{ .is_ngc = FALSE,
+  .id = 5067,
+  .name = "Pelican nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 5070,
+  .name = "Pelican nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 4254,
+  .name = "Pin-wheel nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2573,
+  .name = "Polarissima Australis"
+},
+{ .is_ngc = TRUE,
+  .id = 3172,
+  .name = "Polarissima Borealis"
+},
+{ .is_ngc = TRUE,
+  .id = 2632,
+  .name = "Praesepe"
+},
+{ .is_ngc = TRUE,
+  .id = 6720,
+  .name = "Ring nebula in Lyra"
+},
+{ .is_ngc = TRUE,
+  .id = 2237,
+  .name = "Rosette nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2238,
+  .name = "Rosette nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2239,
+  .name = "Rosette nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 2246,
+  .name = "Rosette nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 7009,
+  .name = "Saturn nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 253,
+  .name = "Sculptor galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 4567,
+  .name = "Siamese Twins"
+},
+{ .is_ngc = TRUE,
+  .id = 4568,
+  .name = "Siamese Twins"
+},
+{ .is_ngc = TRUE,
+  .id = 4594,
+  .name = "Sombrero galaxy"
+},
+{ .is_ngc = FALSE,
+  .id = 2602,
+  .name = "Southern Pleiades"
+},
+{ .is_ngc = TRUE,
+  .id = 3115,
+  .name = "Spindle galaxy"
+},
+{ .is_ngc = FALSE,
+  .id = 4703,
+  .name = "Star Queen nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 7317,
+  .name = "Stephan's Quintet"
+},
+{ .is_ngc = TRUE,
+  .id = 7318,
+  .name = "Stephan's Quintet"
+},
+{ .is_ngc = TRUE,
+  .id = 7319,
+  .name = "Stephan's Quintet"
+},
+{ .is_ngc = TRUE,
+  .id = 7320,
+  .name = "Stephan's Quintet"
+},
+{ .is_ngc = TRUE,
+  .id = 1554,
+  .name = "Struve's Lost nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 5055,
+  .name = "Sunflower galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 2070,
+  .name = "Tarantula nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 2220,
+  .name = "Toby Jug nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 598,
+  .name = "Triangulum galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 6514,
+  .name = "Trifid nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6960,
+  .name = "Veil nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6992,
+  .name = "Veil nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 6995,
+  .name = "Veil nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 5194,
+  .name = "Whirlpool galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 5195,
+  .name = "Whirlpool galaxy"
+},
+{ .is_ngc = TRUE,
+  .id = 6705,
+  .name = "Wild Duck cluster"
+},
+{ .is_ngc = FALSE,
+  .id = 2118,
+  .name = "Witch Head nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 3372,
+  .name = "eta Car nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 59,
+  .name = "gamma Cas nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 63,
+  .name = "gamma Cas nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 1318,
+  .name = "gamma Cyg nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 4755,
+  .name = "kappa Cru cluster"
+},
+{ .is_ngc = FALSE,
+  .id = 2944,
+  .name = "lambda Cen nebula"
+},
+{ .is_ngc = FALSE,
+  .id = 2948,
+  .name = "lambda Cen nebula"
+},
+{ .is_ngc = TRUE,
+  .id = 5139,
+  .name = "omega Cen"
+},
+{ .is_ngc = FALSE,
+  .id = 4604,
+  .name = "rho Oph nebula"
+},
@@ -0,0 +1,59900 @@
+{ .is_ngc = TRUE,
+  .id = 1,
+  .ra = 1.81596,
+  .dec = 27.7084,
+},
+{ .is_ngc = TRUE,
+  .id = 2,
+  .ra = 1.82104,
+  .dec = 27.6779,
+},
+{ .is_ngc = TRUE,
+  .id = 3,
+  .ra = 1.81992,
+  .dec = 8.30142,
+},
+{ .is_ngc = TRUE,
+  .id = 4,
+  .ra = 1.85171,
+  .dec = 8.37342,
+},
+{ .is_ngc = TRUE,
+  .id = 5,
+  .ra = 1.95386,
+  .dec = 35.3622,
+},
+{ .is_ngc = TRUE,
+  .id = 7,
+  .ra = 2.08658,
+  .dec = -29.9157,
+},
+{ .is_ngc = TRUE,
+  .id = 8,
+  .ra = 2.18887,
+  .dec = 23.8386,
+},
+{ .is_ngc = TRUE,
+  .id = 9,
+  .ra = 2.22771,
+  .dec = 23.8178,
+},
+{ .is_ngc = TRUE,
+  .id = 10,
+  .ra = 2.14292,
+  .dec = -33.8581,
+},
+{ .is_ngc = TRUE,
+  .id = 11,
+  .ra = 2.17679,
+  .dec = 37.4483,
+},
+{ .is_ngc = TRUE,
+  .id = 12,
+  .ra = 2.18671,
+  .dec = 4.61231,
+},
+{ .is_ngc = TRUE,
+  .id = 13,
+  .ra = 2.19933,
+  .dec = 33.4331,
+},
+{ .is_ngc = TRUE,
+  .id = 14,
+  .ra = 2.19279,
+  .dec = 15.8156,
+},
+{ .is_ngc = TRUE,
+  .id = 15,
+  .ra = 2.26038,
+  .dec = 21.6244,
+},
+{ .is_ngc = TRUE,
+  .id = 16,
+  .ra = 2.26763,
+  .dec = 27.7296,
+},
+{ .is_ngc = TRUE,
+  .id = 18,
+  .ra = 2.346,
+  .dec = 27.7316,
+},
+{ .is_ngc = TRUE,
+  .id = 19,
+  .ra = 2.67058,
+  .dec = 32.9829,
+},
+{ .is_ngc = TRUE,
+  .id = 22,
+  .ra = 2.45096,
+  .dec = 27.8319,
+},
+{ .is_ngc = TRUE,
+  .id = 23,
+  .ra = 2.47246,
+  .dec = 25.9239,
+},
+{ .is_ngc = TRUE,
+  .id = 24,
+  .ra = 2.48454,
+  .dec = -24.9644,
+},
+{ .is_ngc = TRUE,
+  .id = 25,
+  .ra = 2.49833,
+  .dec = -57.0203,
+},
+{ .is_ngc = TRUE,
+  .id = 26,
+  .ra = 2.60817,
+  .dec = 25.8321,
+},
+{ .is_ngc = TRUE,
+  .id = 27,
+  .ra = 2.63683,
+  .dec = 28.9966,
+},
+{ .is_ngc = TRUE,
+  .id = 28,
+  .ra = 2.60533,
+  .dec = -56.9891,
+},
+{ .is_ngc = TRUE,
+  .id = 30,
+  .ra = 2.71142,
+  .dec = 21.9772,
+},
+{ .is_ngc = TRUE,
+  .id = 31,
+  .ra = 2.66058,
+  .dec = -56.9859,
+},
+{ .is_ngc = TRUE,
+  .id = 32,
+  .ra = 2.72333,
+  .dec = 18.7957,
+},
+{ .is_ngc = TRUE,
+  .id = 33,
+  .ra = 2.736,
+  .dec = 3.67583,
+},
+{ .is_ngc = TRUE,
+  .id = 35,
+  .ra = 2.79357,
+  .dec = -12.0207,
+},
+{ .is_ngc = TRUE,
+  .id = 36,
+  .ra = 2.84321,
+  .dec = 6.38908,
+},
+{ .is_ngc = TRUE,
+  .id = 37,
+  .ra = 2.84592,
+  .dec = -56.9572,
+},
+{ .is_ngc = TRUE,
+  .id = 38,
+  .ra = 2.94583,
+  .dec = -5.58667,
+},
+{ .is_ngc = TRUE,
+  .id = 39,
+  .ra = 3.07904,
+  .dec = 31.0611,
+},
+{ .is_ngc = TRUE,
+  .id = 40,
+  .ra = 3.25388,
+  .dec = 72.522,
+},
+{ .is_ngc = TRUE,
+  .id = 41,
+  .ra = 3.20017,
+  .dec = 22.0236,
+},
+{ .is_ngc = TRUE,
+  .id = 42,
+  .ra = 3.23488,
+  .dec = 22.1003,
+},
+{ .is_ngc = TRUE,
+  .id = 43,
+  .ra = 3.25362,
+  .dec = 30.9152,
+},
+{ .is_ngc = TRUE,
+  .id = 44,
+  .ra = 3.30575,
+  .dec = 31.2863,
+},
+{ .is_ngc = TRUE,
+  .id = 45,
+  .ra = 3.51612,
+  .dec = -23.1813,
+},
+{ .is_ngc = TRUE,
+  .id = 46,
+  .ra = 3.54146,
+  .dec = 5.98714,
+},
+{ .is_ngc = TRUE,
+  .id = 48,
+  .ra = 3.50892,
+  .dec = 48.2346,
+},
+{ .is_ngc = TRUE,
+  .id = 49,
+  .ra = 3.59357,
+  .dec = 48.2465,
+},
+{ .is_ngc = TRUE,
+  .id = 50,
+  .ra = 3.68583,
+  .dec = -7.34528,
+},
+{ .is_ngc = TRUE,
+  .id = 51,
+  .ra = 3.64533,
+  .dec = 48.2556,
+},
+{ .is_ngc = TRUE,
+  .id = 52,
+  .ra = 3.66754,
+  .dec = 18.5811,
+},
+{ .is_ngc = TRUE,
+  .id = 53,
+  .ra = 3.67917,
+  .dec = -60.3283,
+},
+{ .is_ngc = TRUE,
+  .id = 54,
+  .ra = 3.78167,
+  .dec = -7.10722,
+},
+{ .is_ngc = TRUE,
+  .id = 55,
+  .ra = 3.78333,
+  .dec = -39.2172,
+},
+{ .is_ngc = TRUE,
+  .id = 56,
+  .ra = 3.83333,
+  .dec = 12.4353,
+},
+{ .is_ngc = TRUE,
+  .id = 57,
+  .ra = 3.87883,
+  .dec = 17.3279,
+},
+{ .is_ngc = TRUE,
+  .id = 59,
+  .ra = 3.85583,
+  .dec = -21.4439,
+},
+{ .is_ngc = TRUE,
+  .id = 60,
+  .ra = 3.99292,
+  .dec = -0.303889,
+},
+{ .is_ngc = TRUE,
+  .id = 62,
+  .ra = 4.2725,
+  .dec = -13.4864,
+},
+{ .is_ngc = TRUE,
+  .id = 63,
+  .ra = 4.4395,
+  .dec = 11.4497,
+},
+{ .is_ngc = TRUE,
+  .id = 64,
+  .ra = 4.37625,
+  .dec = -6.82528,
+},
+{ .is_ngc = TRUE,
+  .id = 65,
+  .ra = 4.74683,
+  .dec = -22.8805,
+},
+{ .is_ngc = TRUE,
+  .id = 66,
+  .ra = 4.76975,
+  .dec = -22.9369,
+},
+{ .is_ngc = TRUE,
+  .id = 68,
+  .ra = 4.57671,
+  .dec = 30.0716,
+},
+{ .is_ngc = TRUE,
+  .id = 69,
+  .ra = 4.5854,
+  .dec = 30.04,
+},
+{ .is_ngc = TRUE,
+  .id = 71,
+  .ra = 4.59825,
+  .dec = 30.063,
+},
+{ .is_ngc = TRUE,
+  .id = 72,
+  .ra = 4.61829,
+  .dec = 30.0403,
+},
+{ .is_ngc = TRUE,
+  .id = 73,
+  .ra = 4.66282,
+  .dec = -15.322,
+},
+{ .is_ngc = TRUE,
+  .id = 74,
+  .ra = 4.70587,
+  .dec = 30.0611,
+},
+{ .is_ngc = TRUE,
+  .id = 75,
+  .ra = 4.85982,
+  .dec = 6.44929,
+},
+{ .is_ngc = TRUE,
+  .id = 76,
+  .ra = 4.90729,
+  .dec = 29.934,
+},
+{ .is_ngc = TRUE,
+  .id = 77,
+  .ra = 5.00654,
+  .dec = -22.5325,
+},
+{ .is_ngc = TRUE,
+  .id = 79,
+  .ra = 5.26217,
+  .dec = 22.5668,
+},
+{ .is_ngc = TRUE,
+  .id = 80,
+  .ra = 5.29592,
+  .dec = 22.3573,
+},
+{ .is_ngc = TRUE,
+  .id = 81,
+  .ra = 5.30607,
+  .dec = 22.3828,
+},
+{ .is_ngc = TRUE,
+  .id = 82,
+  .ra = 5.32333,
+  .dec = 22.4603,
+},
+{ .is_ngc = TRUE,
+  .id = 83,
+  .ra = 5.344,
+  .dec = 22.434,
+},
+{ .is_ngc = TRUE,
+  .id = 84,
+  .ra = 5.33854,
+  .dec = 22.6197,
+},
+{ .is_ngc = TRUE,
+  .id = 86,
+  .ra = 5.36929,
+  .dec = 22.5561,
+},
+{ .is_ngc = TRUE,
+  .id = 87,
+  .ra = 5.31125,
+  .dec = -48.6292,
+},
+{ .is_ngc = TRUE,
+  .id = 88,
+  .ra = 5.34167,
+  .dec = -48.6403,
+},
+{ .is_ngc = TRUE,
+  .id = 89,
+  .ra = 5.35083,
+  .dec = -48.6656,
+},
+{ .is_ngc = TRUE,
+  .id = 90,
+  .ra = 5.46492,
+  .dec = 22.4,
+},
+{ .is_ngc = TRUE,
+  .id = 91,
+  .ra = 5.46567,
+  .dec = 22.3682,
+},
+{ .is_ngc = TRUE,
+  .id = 92,
+  .ra = 5.3825,
+  .dec = -48.625,
+},
+{ .is_ngc = TRUE,
+  .id = 93,
+  .ra = 5.51333,
+  .dec = 22.4081,
+},
+{ .is_ngc = TRUE,
+  .id = 94,
+  .ra = 5.55662,
+  .dec = 22.4829,
+},
+{ .is_ngc = TRUE,
+  .id = 95,
+  .ra = 5.55733,
+  .dec = 10.4917,
+},
+{ .is_ngc = TRUE,
+  .id = 96,
+  .ra = 5.57412,
+  .dec = 22.5463,
+},
+{ .is_ngc = TRUE,
+  .id = 97,
+  .ra = 5.625,
+  .dec = 29.7452,
+},
+{ .is_ngc = TRUE,
+  .id = 98,
+  .ra = 5.70542,
+  .dec = -45.2689,
+},
+{ .is_ngc = TRUE,
+  .id = 99,
+  .ra = 5.99804,
+  .dec = 15.7699,
+},
+{ .is_ngc = TRUE,
+  .id = 100,
+  .ra = 6.01108,
+  .dec = 16.486,
+},
+{ .is_ngc = TRUE,
+  .id = 101,
+  .ra = 5.97708,
+  .dec = -32.5364,
+},
+{ .is_ngc = TRUE,
+  .id = 102,
+  .ra = 6.15208,
+  .dec = -13.9567,
+},
+{ .is_ngc = TRUE,
+  .id = 103,
+  .ra = 6.31667,
+  .dec = 61.3178,
+},
+{ .is_ngc = TRUE,
+  .id = 104,
+  .ra = 6.02271,
+  .dec = -72.0811,
+},
+{ .is_ngc = TRUE,
+  .id = 105,
+  .ra = 6.32029,
+  .dec = 12.8839,
+},
+{ .is_ngc = TRUE,
+  .id = 106,
+  .ra = 6.18208,
+  .dec = -5.14917,
+},
+{ .is_ngc = TRUE,
+  .id = 107,
+  .ra = 6.42542,
+  .dec = -8.28389,
+},
+{ .is_ngc = TRUE,
+  .id = 108,
+  .ra = 6.49829,
+  .dec = 29.2116,
+},
+{ .is_ngc = TRUE,
+  .id = 109,
+  .ra = 6.56104,
+  .dec = 21.8072,
+},
+{ .is_ngc = TRUE,
+  .id = 110,
+  .ra = 6.85417,
+  .dec = 71.3833,
+},
+{ .is_ngc = TRUE,
+  .id = 111,
+  .ra = 6.65833,
+  .dec = -2.61806,
+},
+{ .is_ngc = TRUE,
+  .id = 112,
+  .ra = 6.70312,
+  .dec = 31.7032,
+},
+{ .is_ngc = TRUE,
+  .id = 113,
+  .ra = 6.72796,
+  .dec = -2.50083,
+},
+{ .is_ngc = TRUE,
+  .id = 114,
+  .ra = 6.74303,
+  .dec = -1.78598,
+},
+{ .is_ngc = TRUE,
+  .id = 115,
+  .ra = 6.69333,
+  .dec = -33.6764,
+},
+{ .is_ngc = TRUE,
+  .id = 116,
+  .ra = 6.7875,
+  .dec = -7.93417,
+},
+{ .is_ngc = TRUE,
+  .id = 116,
+  .ra = 6.77167,
+  .dec = -7.66889,
+},
+{ .is_ngc = TRUE,
+  .id = 117,
+  .ra = 6.79583,
+  .dec = 1.33361,
+},
+{ .is_ngc = TRUE,
+  .id = 118,
+  .ra = 6.81772,
+  .dec = -1.77998,
+},
+{ .is_ngc = TRUE,
+  .id = 119,
+  .ra = 6.73917,
+  .dec = -56.9781,
+},
+{ .is_ngc = TRUE,
+  .id = 120,
+  .ra = 6.87554,
+  .dec = -1.5135,
+},
+{ .is_ngc = TRUE,
+  .id = 121,
+  .ra = 6.69929,
+  .dec = -71.536,
+},
+{ .is_ngc = TRUE,
+  .id = 123,
+  .ra = 6.90083,
+  .dec = -1.59944,
+},
+{ .is_ngc = TRUE,
+  .id = 124,
+  .ra = 6.96808,
+  .dec = -1.81061,
+},
+{ .is_ngc = TRUE,
+  .id = 125,
+  .ra = 7.20942,
+  .dec = 2.83883,
+},
+{ .is_ngc = TRUE,
+  .id = 126,
+  .ra = 7.28388,
+  .dec = 2.81078,
+},
+{ .is_ngc = TRUE,
+  .id = 127,
+  .ra = 7.30135,
+  .dec = 2.87248,
+},
+{ .is_ngc = TRUE,
+  .id = 128,
+  .ra = 7.31275,
+  .dec = 2.86414,
+},
+{ .is_ngc = TRUE,
+  .id = 129,
+  .ra = 7.5,
+  .dec = 60.2169,
+},
+{ .is_ngc = TRUE,
+  .id = 130,
+  .ra = 7.32733,
+  .dec = 2.87036,
+},
+{ .is_ngc = TRUE,
+  .id = 131,
+  .ra = 7.40917,
+  .dec = -33.2592,
+},
+{ .is_ngc = TRUE,
+  .id = 132,
+  .ra = 7.54396,
+  .dec = 2.09289,
+},
+{ .is_ngc = TRUE,
+  .id = 133,
+  .ra = 7.82917,
+  .dec = 63.35,
+},
+{ .is_ngc = TRUE,
+  .id = 134,
+  .ra = 7.59129,
+  .dec = -33.2457,
+},
+{ .is_ngc = TRUE,
+  .id = 136,
+  .ra = 7.87917,
+  .dec = 61.5017,
+},
+{ .is_ngc = TRUE,
+  .id = 137,
+  .ra = 7.74213,
+  .dec = 10.2083,
+},
+{ .is_ngc = TRUE,
+  .id = 138,
+  .ra = 7.74708,
+  .dec = 5.15953,
+},
+{ .is_ngc = TRUE,
+  .id = 139,
+  .ra = 7.77683,
+  .dec = 5.07833,
+},
+{ .is_ngc = TRUE,
+  .id = 140,
+  .ra = 7.83546,
+  .dec = 30.7917,
+},
+{ .is_ngc = TRUE,
+  .id = 141,
+  .ra = 7.82333,
+  .dec = 5.17889,
+},
+{ .is_ngc = TRUE,
+  .id = 142,
+  .ra = 7.78542,
+  .dec = -22.6192,
+},
+{ .is_ngc = TRUE,
+  .id = 143,
+  .ra = 7.81625,
+  .dec = -22.5603,
+},
+{ .is_ngc = TRUE,
+  .id = 144,
+  .ra = 7.83708,
+  .dec = -22.6458,
+},
+{ .is_ngc = TRUE,
+  .id = 145,
+  .ra = 7.94042,
+  .dec = -5.15333,
+},
+{ .is_ngc = TRUE,
+  .id = 146,
+  .ra = 8.2625,
+  .dec = 63.3003,
+},
+{ .is_ngc = TRUE,
+  .id = 147,
+  .ra = 8.29971,
+  .dec = 48.5075,
+},
+{ .is_ngc = TRUE,
+  .id = 148,
+  .ra = 8.56458,
+  .dec = -31.7858,
+},
+{ .is_ngc = TRUE,
+  .id = 149,
+  .ra = 8.45942,
+  .dec = 30.7229,
+},
+{ .is_ngc = TRUE,
+  .id = 150,
+  .ra = 8.56542,
+  .dec = -27.8045,
+},
+{ .is_ngc = TRUE,
+  .id = 152,
+  .ra = 8.23667,
+  .dec = -73.1158,
+},
+{ .is_ngc = TRUE,
+  .id = 154,
+  .ra = 8.58089,
+  .dec = -12.6562,
+},
+{ .is_ngc = TRUE,
+  .id = 155,
+  .ra = 8.66731,
+  .dec = -10.7664,
+},
+{ .is_ngc = TRUE,
+  .id = 156,
+  .ra = 8.64808,
+  .dec = -8.33742,
+},
+{ .is_ngc = TRUE,
+  .id = 156,
+  .ra = 8.64917,
+  .dec = -8.33972,
+},
+{ .is_ngc = TRUE,
+  .id = 157,
+  .ra = 8.69425,
+  .dec = -8.39625,
+},
+{ .is_ngc = TRUE,
+  .id = 158,
+  .ra = 8.77271,
+  .dec = -8.34503,
+},
+{ .is_ngc = TRUE,
+  .id = 159,
+  .ra = 8.64958,
+  .dec = -55.7897,
+},
+{ .is_ngc = TRUE,
+  .id = 160,
+  .ra = 9.01737,
+  .dec = 23.9579,
+},
+{ .is_ngc = TRUE,
+  .id = 161,
+  .ra = 8.89147,
+  .dec = -2.84874,
+},
+{ .is_ngc = TRUE,
+  .id = 162,
+  .ra = 9.0385,
+  .dec = 23.962,
+},
+{ .is_ngc = TRUE,
+  .id = 163,
+  .ra = 8.99903,
+  .dec = -10.1216,
+},
+{ .is_ngc = TRUE,
+  .id = 164,
+  .ra = 9.1375,
+  .dec = 2.75,
+},
+{ .is_ngc = TRUE,
+  .id = 165,
+  .ra = 9.12042,
+  .dec = -10.1061,
+},
+{ .is_ngc = TRUE,
+  .id = 166,
+  .ra = 8.95292,
+  .dec = -13.6106,
+},
+{ .is_ngc = TRUE,
+  .id = 167,
+  .ra = 8.84625,
+  .dec = -23.3756,
+},
+{ .is_ngc = TRUE,
+  .id = 168,
+  .ra = 9.1625,
+  .dec = -22.5936,
+},
+{ .is_ngc = TRUE,
+  .id = 169,
+  .ra = 9.21583,
+  .dec = 23.9906,
+},
+{ .is_ngc = TRUE,
+  .id = 170,
+  .ra = 9.19112,
+  .dec = 1.88633,
+},
+{ .is_ngc = TRUE,
+  .id = 172,
+  .ra = 9.30833,
+  .dec = -22.5858,
+},
+{ .is_ngc = TRUE,
+  .id = 173,
+  .ra = 9.30196,
+  .dec = 1.94203,
+},
+{ .is_ngc = TRUE,
+  .id = 174,
+  .ra = 9.24542,
+  .dec = -29.4778,
+},
+{ .is_ngc = TRUE,
+  .id = 176,
+  .ra = 8.99375,
+  .dec = -73.1661,
+},
+{ .is_ngc = TRUE,
+  .id = 177,
+  .ra = 9.39563,
+  .dec = -22.5491,
+},
+{ .is_ngc = TRUE,
+  .id = 179,
+  .ra = 9.44292,
+  .dec = -17.8494,
+},
+{ .is_ngc = TRUE,
+  .id = 180,
+  .ra = 9.49008,
+  .dec = 8.63447,
+},
+{ .is_ngc = TRUE,
+  .id = 181,
+  .ra = 9.59708,
+  .dec = 29.4719,
+},
+{ .is_ngc = TRUE,
+  .id = 182,
+  .ra = 9.55183,
+  .dec = 2.72842,
+},
+{ .is_ngc = TRUE,
+  .id = 183,
+  .ra = 9.62254,
+  .dec = 29.5109,
+},
+{ .is_ngc = TRUE,
+  .id = 184,
+  .ra = 9.64958,
+  .dec = 29.4469,
+},
+{ .is_ngc = TRUE,
+  .id = 185,
+  .ra = 9.74008,
+  .dec = 48.3371,
+},
+{ .is_ngc = TRUE,
+  .id = 186,
+  .ra = 9.60537,
+  .dec = 3.16603,
+},
+{ .is_ngc = TRUE,
+  .id = 187,
+  .ra = 9.87625,
+  .dec = -14.6561,
+},
+{ .is_ngc = TRUE,
+  .id = 188,
+  .ra = 11.8667,
+  .dec = 85.2508,
+},
+{ .is_ngc = TRUE,
+  .id = 189,
+  .ra = 9.89583,
+  .dec = 61.0836,
+},
+{ .is_ngc = TRUE,
+  .id = 190,
+  .ra = 9.72796,
+  .dec = 7.06256,
+},
+{ .is_ngc = TRUE,
+  .id = 191,
+  .ra = 9.74721,
+  .dec = -9.00253,
+},
+{ .is_ngc = TRUE,
+  .id = 192,
+  .ra = 9.80621,
+  .dec = 0.863333,
+},
+{ .is_ngc = TRUE,
+  .id = 193,
+  .ra = 9.82713,
+  .dec = 3.33107,
+},
+{ .is_ngc = TRUE,
+  .id = 194,
+  .ra = 9.82654,
+  .dec = 3.03714,
+},
+{ .is_ngc = TRUE,
+  .id = 195,
+  .ra = 9.89889,
+  .dec = -9.19455,
+},
+{ .is_ngc = TRUE,
+  .id = 196,
+  .ra = 9.82421,
+  .dec = 0.912528,
+},
+{ .is_ngc = TRUE,
+  .id = 197,
+  .ra = 9.82828,
+  .dec = 0.891636,
+},
+{ .is_ngc = TRUE,
+  .id = 198,
+  .ra = 9.84563,
+  .dec = 2.79769,
+},
+{ .is_ngc = TRUE,
+  .id = 199,
+  .ra = 9.88825,
+  .dec = 3.13839,
+},
+{ .is_ngc = TRUE,
+  .id = 200,
+  .ra = 9.89496,
+  .dec = 2.88747,
+},
+{ .is_ngc = TRUE,
+  .id = 201,
+  .ra = 9.89583,
+  .dec = 0.859667,
+},
+{ .is_ngc = TRUE,
+  .id = 202,
+  .ra = 9.91596,
+  .dec = 3.53594,
+},
+{ .is_ngc = TRUE,
+  .id = 204,
+  .ra = 9.93433,
+  .dec = 3.29936,
+},
+{ .is_ngc = TRUE,
+  .id = 205,
+  .ra = 10.0923,
+  .dec = 41.6854,
+},
+{ .is_ngc = TRUE,
+  .id = 206,
+  .ra = 10.1329,
+  .dec = 40.7386,
+},
+{ .is_ngc = TRUE,
+  .id = 207,
+  .ra = 9.91917,
+  .dec = -14.2372,
+},
+{ .is_ngc = TRUE,
+  .id = 208,
+  .ra = 10.0733,
+  .dec = 2.75583,
+},
+{ .is_ngc = TRUE,
+  .id = 209,
+  .ra = 9.76547,
+  .dec = -18.6087,
+},
+{ .is_ngc = TRUE,
+  .id = 210,
+  .ra = 10.1452,
+  .dec = -13.8733,
+},
+{ .is_ngc = TRUE,
+  .id = 212,
+  .ra = 10.0546,
+  .dec = -56.1525,
+},
+{ .is_ngc = TRUE,
+  .id = 213,
+  .ra = 10.2915,
+  .dec = 16.469,
+},
+{ .is_ngc = TRUE,
+  .id = 214,
+  .ra = 10.3667,
+  .dec = 25.4995,
+},
+{ .is_ngc = TRUE,
+  .id = 215,
+  .ra = 10.2029,
+  .dec = -56.2142,
+},
+{ .is_ngc = TRUE,
+  .id = 216,
+  .ra = 10.3617,
+  .dec = -21.0453,
+},
+{ .is_ngc = TRUE,
+  .id = 217,
+  .ra = 10.3912,
+  .dec = -10.0219,
+},
+{ .is_ngc = TRUE,
+  .id = 218,
+  .ra = 10.4364,
+  .dec = 36.3593,
+},
+{ .is_ngc = TRUE,
+  .id = 219,
+  .ra = 10.5471,
+  .dec = 0.90425,
+},
+{ .is_ngc = TRUE,
+  .id = 220,
+  .ra = 10.1271,
+  .dec = -73.4033,
+},
+{ .is_ngc = TRUE,
+  .id = 221,
+  .ra = 10.6745,
+  .dec = 40.8651,
+},
+{ .is_ngc = TRUE,
+  .id = 222,
+  .ra = 10.1846,
+  .dec = -73.3844,
+},
+{ .is_ngc = TRUE,
+  .id = 224,
+  .ra = 10.6846,
+  .dec = 41.2689,
+},
+{ .is_ngc = TRUE,
+  .id = 225,
+  .ra = 10.9125,
+  .dec = 61.7681,
+},
+{ .is_ngc = TRUE,
+  .id = 226,
+  .ra = 10.7254,
+  .dec = 32.5802,
+},
+{ .is_ngc = TRUE,
+  .id = 227,
+  .ra = 10.6535,
+  .dec = -1.52922,
+},
+{ .is_ngc = TRUE,
+  .id = 228,
+  .ra = 10.727,
+  .dec = 23.5032,
+},
+{ .is_ngc = TRUE,
+  .id = 229,
+  .ra = 10.7695,
+  .dec = 23.5091,
+},
+{ .is_ngc = TRUE,
+  .id = 230,
+  .ra = 10.6133,
+  .dec = -23.6292,
+},
+{ .is_ngc = TRUE,
+  .id = 231,
+  .ra = 10.2767,
+  .dec = -73.3522,
+},
+{ .is_ngc = TRUE,
+  .id = 232,
+  .ra = 10.69,
+  .dec = -23.5615,
+},
+{ .is_ngc = TRUE,
+  .id = 233,
+  .ra = 10.9024,
+  .dec = 30.5868,
+},
+{ .is_ngc = TRUE,
+  .id = 234,
+  .ra = 10.8849,
+  .dec = 14.3424,
+},
+{ .is_ngc = TRUE,
+  .id = 236,
+  .ra = 10.8645,
+  .dec = 2.95775,
+},
+{ .is_ngc = TRUE,
+  .id = 237,
+  .ra = 10.8663,
+  .dec = -0.124806,
+},
+{ .is_ngc = TRUE,
+  .id = 238,
+  .ra = 10.8575,
+  .dec = -50.1835,
+},
+{ .is_ngc = TRUE,
+  .id = 239,
+  .ra = 11.1562,
+  .dec = -3.76,
+},
+{ .is_ngc = TRUE,
+  .id = 240,
+  .ra = 11.258,
+  .dec = 6.11275,
+},
+{ .is_ngc = TRUE,
+  .id = 243,
+  .ra = 11.5036,
+  .dec = 29.9592,
+},
+{ .is_ngc = TRUE,
+  .id = 244,
+  .ra = 11.4439,
+  .dec = -15.5974,
+},
+{ .is_ngc = TRUE,
+  .id = 245,
+  .ra = 11.5229,
+  .dec = -1.72328,
+},
+{ .is_ngc = TRUE,
+  .id = 246,
+  .ra = 11.7643,
+  .dec = -11.872,
+},
+{ .is_ngc = TRUE,
+  .id = 247,
+  .ra = 11.7849,
+  .dec = -20.7598,
+},
+{ .is_ngc = TRUE,
+  .id = 248,
+  .ra = 11.3508,
+  .dec = -73.3794,
+},
+{ .is_ngc = TRUE,
+  .id = 249,
+  .ra = 11.3833,
+  .dec = -73.0689,
+},
+{ .is_ngc = TRUE,
+  .id = 250,
+  .ra = 11.8167,
+  .dec = 7.90972,
+},
+{ .is_ngc = TRUE,
+  .id = 251,
+  .ra = 11.9751,
+  .dec = 19.5966,
+},
+{ .is_ngc = TRUE,
+  .id = 252,
+  .ra = 12.0067,
+  .dec = 27.6235,
+},
+{ .is_ngc = TRUE,
+  .id = 253,
+  .ra = 11.8877,
+  .dec = -25.2883,
+},
+{ .is_ngc = TRUE,
+  .id = 254,
+  .ra = 11.865,
+  .dec = -31.4211,
+},
+{ .is_ngc = TRUE,
+  .id = 255,
+  .ra = 11.9471,
+  .dec = -11.4683,
+},
+{ .is_ngc = TRUE,
+  .id = 256,
+  .ra = 11.4733,
+  .dec = -73.5069,
+},
+{ .is_ngc = TRUE,
+  .id = 257,
+  .ra = 12.0067,
+  .dec = 8.29656,
+},
+{ .is_ngc = TRUE,
+  .id = 258,
+  .ra = 12.0538,
+  .dec = 27.6566,
+},
+{ .is_ngc = TRUE,
+  .id = 259,
+  .ra = 12.0138,
+  .dec = -2.77611,
+},
+{ .is_ngc = TRUE,
+  .id = 260,
+  .ra = 12.1449,
+  .dec = 27.692,
+},
+{ .is_ngc = TRUE,
+  .id = 261,
+  .ra = 11.6167,
+  .dec = -73.1003,
+},
+{ .is_ngc = TRUE,
+  .id = 262,
+  .ra = 12.1964,
+  .dec = 31.9568,
+},
+{ .is_ngc = TRUE,
+  .id = 263,
+  .ra = 12.2017,
+  .dec = -13.1075,
+},
+{ .is_ngc = TRUE,
+  .id = 264,
+  .ra = 12.0875,
+  .dec = -38.2344,
+},
+{ .is_ngc = TRUE,
+  .id = 265,
+  .ra = 11.7963,
+  .dec = -73.4775,
+},
+{ .is_ngc = TRUE,
+  .id = 266,
+  .ra = 12.4499,
+  .dec = 32.2775,
+},
+{ .is_ngc = TRUE,
+  .id = 267,
+  .ra = 12.0083,
+  .dec = -73.2678,
+},
+{ .is_ngc = TRUE,
+  .id = 268,
+  .ra = 12.5392,
+  .dec = -5.19389,
+},
+{ .is_ngc = TRUE,
+  .id = 269,
+  .ra = 12.0875,
+  .dec = -73.5308,
+},
+{ .is_ngc = TRUE,
+  .id = 270,
+  .ra = 12.635,
+  .dec = -8.65194,
+},
+{ .is_ngc = TRUE,
+  .id = 271,
+  .ra = 12.6746,
+  .dec = -1.91006,
+},
+{ .is_ngc = TRUE,
+  .id = 272,
+  .ra = 12.85,
+  .dec = 35.8192,
+},
+{ .is_ngc = TRUE,
+  .id = 273,
+  .ra = 12.7017,
+  .dec = -6.88556,
+},
+{ .is_ngc = TRUE,
+  .id = 274,
+  .ra = 12.7576,
+  .dec = -7.05714,
+},
+{ .is_ngc = TRUE,
+  .id = 275,
+  .ra = 12.7684,
+  .dec = -7.06564,
+},
+{ .is_ngc = TRUE,
+  .id = 277,
+  .ra = 12.8217,
+  .dec = -8.59691,
+},
+{ .is_ngc = TRUE,
+  .id = 278,
+  .ra = 13.0185,
+  .dec = 47.5505,
+},
+{ .is_ngc = TRUE,
+  .id = 279,
+  .ra = 13.0373,
+  .dec = -2.21825,
+},
+{ .is_ngc = TRUE,
+  .id = 280,
+  .ra = 13.1255,
+  .dec = 24.3504,
+},
+{ .is_ngc = TRUE,
+  .id = 282,
+  .ra = 13.1754,
+  .dec = 30.6386,
+},
+{ .is_ngc = TRUE,
+  .id = 283,
+  .ra = 13.3052,
+  .dec = -13.164,
+},
+{ .is_ngc = TRUE,
+  .id = 284,
+  .ra = 13.351,
+  .dec = -13.1591,
+},
+{ .is_ngc = TRUE,
+  .id = 285,
+  .ra = 13.3745,
+  .dec = -13.1611,
+},
+{ .is_ngc = TRUE,
+  .id = 286,
+  .ra = 13.3766,
+  .dec = -13.1127,
+},
+{ .is_ngc = TRUE,
+  .id = 287,
+  .ra = 13.3679,
+  .dec = 32.4819,
+},
+{ .is_ngc = TRUE,
+  .id = 288,
+  .ra = 13.1892,
+  .dec = -26.5835,
+},
+{ .is_ngc = TRUE,
+  .id = 289,
+  .ra = 13.1748,
+  .dec = -31.2062,
+},
+{ .is_ngc = TRUE,
+  .id = 290,
+  .ra = 12.8108,
+  .dec = -73.1617,
+},
+{ .is_ngc = TRUE,
+  .id = 291,
+  .ra = 13.3742,
+  .dec = -8.76833,
+},
+{ .is_ngc = TRUE,
+  .id = 292,
+  .ra = 13.1583,
+  .dec = -72.8,
+},
+{ .is_ngc = TRUE,
+  .id = 293,
+  .ra = 13.5666,
+  .dec = -7.23586,
+},
+{ .is_ngc = TRUE,
+  .id = 294,
+  .ra = 13.2729,
+  .dec = -73.3803,
+},
+{ .is_ngc = TRUE,
+  .id = 295,
+  .ra = 13.7708,
+  .dec = 31.5189,
+},
+{ .is_ngc = TRUE,
+  .id = 296,
+  .ra = 13.7816,
+  .dec = 31.5423,
+},
+{ .is_ngc = TRUE,
+  .id = 297,
+  .ra = 13.7453,
+  .dec = -7.35003,
+},
+{ .is_ngc = TRUE,
+  .id = 298,
+  .ra = 13.7597,
+  .dec = -7.3335,
+},
+{ .is_ngc = TRUE,
+  .id = 299,
+  .ra = 13.3529,
+  .dec = -72.1967,
+},
+{ .is_ngc = TRUE,
+  .id = 300,
+  .ra = 13.7226,
+  .dec = -37.6842,
+},
+{ .is_ngc = TRUE,
+  .id = 301,
+  .ra = 14.0767,
+  .dec = -10.6736,
+},
+{ .is_ngc = TRUE,
+  .id = 302,
+  .ra = 14.1054,
+  .dec = -10.6628,
+},
+{ .is_ngc = TRUE,
+  .id = 304,
+  .ra = 14.0255,
+  .dec = 24.1264,
+},
+{ .is_ngc = TRUE,
+  .id = 305,
+  .ra = 14.0854,
+  .dec = 12.0656,
+},
+{ .is_ngc = TRUE,
+  .id = 306,
+  .ra = 13.5613,
+  .dec = -72.2417,
+},
+{ .is_ngc = TRUE,
+  .id = 307,
+  .ra = 14.1359,
+  .dec = -1.77189,
+},
+{ .is_ngc = TRUE,
+  .id = 308,
+  .ra = 14.1426,
+  .dec = -1.78392,
+},
+{ .is_ngc = TRUE,
+  .id = 309,
+  .ra = 14.1779,
+  .dec = -9.91389,
+},
+{ .is_ngc = TRUE,
+  .id = 310,
+  .ra = 14.1999,
+  .dec = -1.76578,
+},
+{ .is_ngc = TRUE,
+  .id = 311,
+  .ra = 14.3865,
+  .dec = 30.2802,
+},
+{ .is_ngc = TRUE,
+  .id = 312,
+  .ra = 14.0675,
+  .dec = -52.7831,
+},
+{ .is_ngc = TRUE,
+  .id = 313,
+  .ra = 14.4404,
+  .dec = 30.3664,
+},
+{ .is_ngc = TRUE,
+  .id = 314,
+  .ra = 14.2188,
+  .dec = -31.9631,
+},
+{ .is_ngc = TRUE,
+  .id = 315,
+  .ra = 14.4542,
+  .dec = 30.3523,
+},
+{ .is_ngc = TRUE,
+  .id = 316,
+  .ra = 14.4683,
+  .dec = 30.3541,
+},
+{ .is_ngc = TRUE,
+  .id = 318,
+  .ra = 14.522,
+  .dec = 30.4254,
+},
+{ .is_ngc = TRUE,
+  .id = 319,
+  .ra = 14.2393,
+  .dec = -43.8384,
+},
+{ .is_ngc = TRUE,
+  .id = 320,
+  .ra = 14.6933,
+  .dec = -20.8403,
+},
+{ .is_ngc = TRUE,
+  .id = 321,
+  .ra = 14.4135,
+  .dec = -5.08631,
+},
+{ .is_ngc = TRUE,
+  .id = 322,
+  .ra = 14.2921,
+  .dec = -43.7267,
+},
+{ .is_ngc = TRUE,
+  .id = 323,
+  .ra = 14.1729,
+  .dec = -52.9761,
+},
+{ .is_ngc = TRUE,
+  .id = 324,
+  .ra = 14.3108,
+  .dec = -40.9589,
+},
+{ .is_ngc = TRUE,
+  .id = 325,
+  .ra = 14.4495,
+  .dec = -5.11244,
+},
+{ .is_ngc = TRUE,
+  .id = 326,
+  .ra = 14.5945,
+  .dec = 26.8653,
+},
+{ .is_ngc = TRUE,
+  .id = 327,
+  .ra = 14.4804,
+  .dec = -5.13069,
+},
+{ .is_ngc = TRUE,
+  .id = 328,
+  .ra = 14.2388,
+  .dec = -52.9233,
+},
+{ .is_ngc = TRUE,
+  .id = 329,
+  .ra = 14.506,
+  .dec = -5.07161,
+},
+{ .is_ngc = TRUE,
+  .id = 330,
+  .ra = 14.0779,
+  .dec = -72.4628,
+},
+{ .is_ngc = TRUE,
+  .id = 331,
+  .ra = 11.7785,
+  .dec = -2.73097,
+},
+{ .is_ngc = TRUE,
+  .id = 332,
+  .ra = 14.7047,
+  .dec = 7.11114,
+},
+{ .is_ngc = TRUE,
+  .id = 334,
+  .ra = 14.7079,
+  .dec = -35.1156,
+},
+{ .is_ngc = TRUE,
+  .id = 335,
+  .ra = 14.8312,
+  .dec = -18.2339,
+},
+{ .is_ngc = TRUE,
+  .id = 336,
+  .ra = 14.5106,
+  .dec = -18.3857,
+},
+{ .is_ngc = TRUE,
+  .id = 337,
+  .ra = 14.9584,
+  .dec = -7.57756,
+},
+{ .is_ngc = TRUE,
+  .id = 338,
+  .ra = 15.1519,
+  .dec = 30.6689,
+},
+{ .is_ngc = TRUE,
+  .id = 339,
+  .ra = 14.4357,
+  .dec = -74.4723,
+},
+{ .is_ngc = TRUE,
+  .id = 340,
+  .ra = 15.1452,
+  .dec = -6.86656,
+},
+{ .is_ngc = TRUE,
+  .id = 342,
+  .ra = 15.208,
+  .dec = -6.77289,
+},
+{ .is_ngc = TRUE,
+  .id = 343,
+  .ra = 14.5999,
+  .dec = -23.2247,
+},
+{ .is_ngc = TRUE,
+  .id = 344,
+  .ra = 14.6058,
+  .dec = -23.2292,
+},
+{ .is_ngc = TRUE,
+  .id = 345,
+  .ra = 15.3422,
+  .dec = -6.88469,
+},
+{ .is_ngc = TRUE,
+  .id = 346,
+  .ra = 14.7708,
+  .dec = -72.1686,
+},
+{ .is_ngc = TRUE,
+  .id = 347,
+  .ra = 15.3967,
+  .dec = -6.73397,
+},
+{ .is_ngc = TRUE,
+  .id = 348,
+  .ra = 15.2154,
+  .dec = -53.2447,
+},
+{ .is_ngc = TRUE,
+  .id = 349,
+  .ra = 15.4614,
+  .dec = -6.80008,
+},
+{ .is_ngc = TRUE,
+  .id = 350,
+  .ra = 15.4863,
+  .dec = -6.79602,
+},
+{ .is_ngc = TRUE,
+  .id = 351,
+  .ra = 15.4911,
+  .dec = -1.93633,
+},
+{ .is_ngc = TRUE,
+  .id = 352,
+  .ra = 15.5379,
+  .dec = -4.24556,
+},
+{ .is_ngc = TRUE,
+  .id = 353,
+  .ra = 15.6027,
+  .dec = -1.95761,
+},
+{ .is_ngc = TRUE,
+  .id = 354,
+  .ra = 15.8186,
+  .dec = 22.3424,
+},
+{ .is_ngc = TRUE,
+  .id = 355,
+  .ra = 15.779,
+  .dec = -6.32421,
+},
+{ .is_ngc = TRUE,
+  .id = 356,
+  .ra = 15.7793,
+  .dec = -6.98844,
+},
+{ .is_ngc = TRUE,
+  .id = 357,
+  .ra = 15.8413,
+  .dec = -6.33861,
+},
+{ .is_ngc = TRUE,
+  .id = 358,
+  .ra = 16.2958,
+  .dec = 62.0206,
+},
+{ .is_ngc = TRUE,
+  .id = 359,
+  .ra = 16.0708,
+  .dec = -0.764833,
+},
+{ .is_ngc = TRUE,
+  .id = 360,
+  .ra = 15.7138,
+  .dec = -65.6094,
+},
+{ .is_ngc = TRUE,
+  .id = 361,
+  .ra = 15.5467,
+  .dec = -71.6067,
+},
+{ .is_ngc = TRUE,
+  .id = 362,
+  .ra = 15.8081,
+  .dec = -70.8483,
+},
+{ .is_ngc = TRUE,
+  .id = 363,
+  .ra = 16.5657,
+  .dec = -16.5428,
+},
+{ .is_ngc = TRUE,
+  .id = 364,
+  .ra = 16.1701,
+  .dec = -0.802917,
+},
+{ .is_ngc = TRUE,
+  .id = 365,
+  .ra = 16.0779,
+  .dec = -35.1214,
+},
+{ .is_ngc = TRUE,
+  .id = 366,
+  .ra = 16.6083,
+  .dec = 62.2189,
+},
+{ .is_ngc = TRUE,
+  .id = 367,
+  .ra = 16.4537,
+  .dec = -12.1286,
+},
+{ .is_ngc = TRUE,
+  .id = 368,
+  .ra = 16.0904,
+  .dec = -43.2758,
+},
+{ .is_ngc = TRUE,
+  .id = 369,
+  .ra = 16.2867,
+  .dec = -17.7586,
+},
+{ .is_ngc = TRUE,
+  .id = 370,
+  .ra = 16.6848,
+  .dec = 32.4278,
+},
+{ .is_ngc = TRUE,
+  .id = 371,
+  .ra = 15.8583,
+  .dec = -72.0525,
+},
+{ .is_ngc = TRUE,
+  .id = 372,
+  .ra = 16.6851,
+  .dec = 32.4287,
+},
+{ .is_ngc = TRUE,
+  .id = 373,
+  .ra = 16.7442,
+  .dec = 32.3083,
+},
+{ .is_ngc = TRUE,
+  .id = 374,
+  .ra = 16.774,
+  .dec = 32.7952,
+},
+{ .is_ngc = TRUE,
+  .id = 375,
+  .ra = 16.7761,
+  .dec = 32.3479,
+},
+{ .is_ngc = TRUE,
+  .id = 376,
+  .ra = 15.9733,
+  .dec = -72.8244,
+},
+{ .is_ngc = TRUE,
+  .id = 377,
+  .ra = 16.6459,
+  .dec = -20.332,
+},
+{ .is_ngc = TRUE,
+  .id = 378,
+  .ra = 16.5496,
+  .dec = -30.1781,
+},
+{ .is_ngc = TRUE,
+  .id = 379,
+  .ra = 16.8152,
+  .dec = 32.5206,
+},
+{ .is_ngc = TRUE,
+  .id = 380,
+  .ra = 16.8234,
+  .dec = 32.4831,
+},
+{ .is_ngc = TRUE,
+  .id = 381,
+  .ra = 17.0792,
+  .dec = 61.5833,
+},
+{ .is_ngc = TRUE,
+  .id = 382,
+  .ra = 16.8498,
+  .dec = 32.4039,
+},
+{ .is_ngc = TRUE,
+  .id = 383,
+  .ra = 16.8538,
+  .dec = 32.4125,
+},
+{ .is_ngc = TRUE,
+  .id = 384,
+  .ra = 16.8543,
+  .dec = 32.2927,
+},
+{ .is_ngc = TRUE,
+  .id = 385,
+  .ra = 16.8635,
+  .dec = 32.32,
+},
+{ .is_ngc = TRUE,
+  .id = 386,
+  .ra = 16.8803,
+  .dec = 32.362,
+},
+{ .is_ngc = TRUE,
+  .id = 387,
+  .ra = 16.8879,
+  .dec = 32.3911,
+},
+{ .is_ngc = TRUE,
+  .id = 388,
+  .ra = 16.9467,
+  .dec = 32.3099,
+},
+{ .is_ngc = TRUE,
+  .id = 389,
+  .ra = 17.1247,
+  .dec = 39.6947,
+},
+{ .is_ngc = TRUE,
+  .id = 390,
+  .ra = 16.9738,
+  .dec = 32.4331,
+},
+{ .is_ngc = TRUE,
+  .id = 391,
+  .ra = 16.8445,
+  .dec = 0.9255,
+},
+{ .is_ngc = TRUE,
+  .id = 392,
+  .ra = 17.0976,
+  .dec = 33.1334,
+},
+{ .is_ngc = TRUE,
+  .id = 393,
+  .ra = 17.1543,
+  .dec = 39.6437,
+},
+{ .is_ngc = TRUE,
+  .id = 394,
+  .ra = 17.1083,
+  .dec = 33.1475,
+},
+{ .is_ngc = TRUE,
+  .id = 395,
+  .ra = 16.2867,
+  .dec = -71.9922,
+},
+{ .is_ngc = TRUE,
+  .id = 396,
+  .ra = 17.0353,
+  .dec = 4.53083,
+},
+{ .is_ngc = TRUE,
+  .id = 397,
+  .ra = 17.1292,
+  .dec = 33.1095,
+},
+{ .is_ngc = TRUE,
+  .id = 398,
+  .ra = 17.2238,
+  .dec = 32.5145,
+},
+{ .is_ngc = TRUE,
+  .id = 399,
+  .ra = 17.2467,
+  .dec = 32.6341,
+},
+{ .is_ngc = TRUE,
+  .id = 400,
+  .ra = 17.2608,
+  .dec = 32.7325,
+},
+{ .is_ngc = TRUE,
+  .id = 401,
+  .ra = 17.2821,
+  .dec = 32.7597,
+},
+{ .is_ngc = TRUE,
+  .id = 402,
+  .ra = 17.3058,
+  .dec = 32.8056,
+},
+{ .is_ngc = TRUE,
+  .id = 403,
+  .ra = 17.3095,
+  .dec = 32.7521,
+},
+{ .is_ngc = TRUE,
+  .id = 404,
+  .ra = 17.3623,
+  .dec = 35.7181,
+},
+{ .is_ngc = TRUE,
+  .id = 405,
+  .ra = 17.1408,
+  .dec = -46.6683,
+},
+{ .is_ngc = TRUE,
+  .id = 406,
+  .ra = 16.8508,
+  .dec = -69.8764,
+},
+{ .is_ngc = TRUE,
+  .id = 407,
+  .ra = 17.6522,
+  .dec = 33.1258,
+},
+{ .is_ngc = TRUE,
+  .id = 408,
+  .ra = 17.7129,
+  .dec = 33.1513,
+},
+{ .is_ngc = TRUE,
+  .id = 409,
+  .ra = 17.3871,
+  .dec = -35.8056,
+},
+{ .is_ngc = TRUE,
+  .id = 410,
+  .ra = 17.7448,
+  .dec = 33.1513,
+},
+{ .is_ngc = TRUE,
+  .id = 411,
+  .ra = 16.9821,
+  .dec = -71.7686,
+},
+{ .is_ngc = TRUE,
+  .id = 412,
+  .ra = 17.5833,
+  .dec = -20.0025,
+},
+{ .is_ngc = TRUE,
+  .id = 413,
+  .ra = 18.131,
+  .dec = -2.79392,
+},
+{ .is_ngc = TRUE,
+  .id = 415,
+  .ra = 17.5229,
+  .dec = -35.4908,
+},
+{ .is_ngc = TRUE,
+  .id = 416,
+  .ra = 16.9942,
+  .dec = -72.3558,
+},
+{ .is_ngc = TRUE,
+  .id = 417,
+  .ra = 17.7737,
+  .dec = -18.1488,
+},
+{ .is_ngc = TRUE,
+  .id = 418,
+  .ra = 17.6489,
+  .dec = -30.2211,
+},
+{ .is_ngc = TRUE,
+  .id = 419,
+  .ra = 17.0731,
+  .dec = -72.8839,
+},
+{ .is_ngc = TRUE,
+  .id = 420,
+  .ra = 18.0406,
+  .dec = 32.123,
+},
+{ .is_ngc = TRUE,
+  .id = 421,
+  .ra = 18.0583,
+  .dec = 32.1178,
+},
+{ .is_ngc = TRUE,
+  .id = 422,
+  .ra = 17.3558,
+  .dec = -71.7667,
+},
+{ .is_ngc = TRUE,
+  .id = 423,
+  .ra = 17.8429,
+  .dec = -29.2344,
+},
+{ .is_ngc = TRUE,
+  .id = 424,
+  .ra = 17.8654,
+  .dec = -38.0828,
+},
+{ .is_ngc = TRUE,
+  .id = 425,
+  .ra = 18.261,
+  .dec = 38.7684,
+},
+{ .is_ngc = TRUE,
+  .id = 426,
+  .ra = 18.2028,
+  .dec = -0.290486,
+},
+{ .is_ngc = TRUE,
+  .id = 427,
+  .ra = 18.0817,
+  .dec = -32.0614,
+},
+{ .is_ngc = TRUE,
+  .id = 428,
+  .ra = 18.2318,
+  .dec = 0.981806,
+},
+{ .is_ngc = TRUE,
+  .id = 429,
+  .ra = 18.239,
+  .dec = -0.345583,
+},
+{ .is_ngc = TRUE,
+  .id = 430,
+  .ra = 18.2494,
+  .dec = -0.252667,
+},
+{ .is_ngc = TRUE,
+  .id = 431,
+  .ra = 18.5188,
+  .dec = 33.7041,
+},
+{ .is_ngc = TRUE,
+  .id = 432,
+  .ra = 17.9425,
+  .dec = -61.5269,
+},
+{ .is_ngc = TRUE,
+  .id = 433,
+  .ra = 18.7958,
+  .dec = 60.1183,
+},
+{ .is_ngc = TRUE,
+  .id = 434,
+  .ra = 18.0579,
+  .dec = -58.2469,
+},
+{ .is_ngc = TRUE,
+  .id = 435,
+  .ra = 18.4995,
+  .dec = 2.07075,
+},
+{ .is_ngc = TRUE,
+  .id = 436,
+  .ra = 18.9917,
+  .dec = 58.8019,
+},
+{ .is_ngc = TRUE,
+  .id = 437,
+  .ra = 18.5926,
+  .dec = 5.92642,
+},
+{ .is_ngc = TRUE,
+  .id = 438,
+  .ra = 18.3912,
+  .dec = -37.9017,
+},
+{ .is_ngc = TRUE,
+  .id = 439,
+  .ra = 18.4472,
+  .dec = -31.7473,
+},
+{ .is_ngc = TRUE,
+  .id = 440,
+  .ra = 18.2012,
+  .dec = -58.2822,
+},
+{ .is_ngc = TRUE,
+  .id = 441,
+  .ra = 18.4642,
+  .dec = -31.7881,
+},
+{ .is_ngc = TRUE,
+  .id = 442,
+  .ra = 18.6612,
+  .dec = -1.021,
+},
+{ .is_ngc = TRUE,
+  .id = 445,
+  .ra = 18.7204,
+  .dec = 1.9175,
+},
+{ .is_ngc = TRUE,
+  .id = 448,
+  .ra = 18.8186,
+  .dec = -1.62597,
+},
+{ .is_ngc = TRUE,
+  .id = 449,
+  .ra = 19.0303,
+  .dec = 33.0892,
+},
+{ .is_ngc = TRUE,
+  .id = 450,
+  .ra = 18.8771,
+  .dec = -0.861111,
+},
+{ .is_ngc = TRUE,
+  .id = 452,
+  .ra = 19.0626,
+  .dec = 31.0336,
+},
+{ .is_ngc = TRUE,
+  .id = 453,
+  .ra = 19.0725,
+  .dec = 33.0142,
+},
+{ .is_ngc = TRUE,
+  .id = 454,
+  .ra = 18.5967,
+  .dec = -55.3989,
+},
+{ .is_ngc = TRUE,
+  .id = 455,
+  .ra = 18.9897,
+  .dec = 5.17806,
+},
+{ .is_ngc = TRUE,
+  .id = 456,
+  .ra = 18.4379,
+  .dec = -73.2919,
+},
+{ .is_ngc = TRUE,
+  .id = 457,
+  .ra = 19.8958,
+  .dec = 58.2839,
+},
+{ .is_ngc = TRUE,
+  .id = 458,
+  .ra = 18.72,
+  .dec = -71.5503,
+},
+{ .is_ngc = TRUE,
+  .id = 459,
+  .ra = 19.5341,
+  .dec = 17.5621,
+},
+{ .is_ngc = TRUE,
+  .id = 460,
+  .ra = 18.6596,
+  .dec = -73.2908,
+},
+{ .is_ngc = TRUE,
+  .id = 461,
+  .ra = 19.3342,
+  .dec = -33.8408,
+},
+{ .is_ngc = TRUE,
+  .id = 462,
+  .ra = 19.5458,
+  .dec = 4.22599,
+},
+{ .is_ngc = TRUE,
+  .id = 463,
+  .ra = 19.7425,
+  .dec = 16.3254,
+},
+{ .is_ngc = TRUE,
+  .id = 464,
+  .ra = 19.8612,
+  .dec = 34.9557,
+},
+{ .is_ngc = TRUE,
+  .id = 465,
+  .ra = 18.9262,
+  .dec = -73.3281,
+},
+{ .is_ngc = TRUE,
+  .id = 466,
+  .ra = 19.3058,
+  .dec = -58.91,
+},
+{ .is_ngc = TRUE,
+  .id = 467,
+  .ra = 19.7925,
+  .dec = 3.30056,
+},
+{ .is_ngc = TRUE,
+  .id = 469,
+  .ra = 19.8875,
+  .dec = 14.8714,
+},
+{ .is_ngc = TRUE,
+  .id = 470,
+  .ra = 19.9368,
+  .dec = 3.40972,
+},
+{ .is_ngc = TRUE,
+  .id = 471,
+  .ra = 19.9985,
+  .dec = 14.7857,
+},
+{ .is_ngc = TRUE,
+  .id = 472,
+  .ra = 20.1198,
+  .dec = 32.7089,
+},
+{ .is_ngc = TRUE,
+  .id = 473,
+  .ra = 19.9795,
+  .dec = 16.5449,
+},
+{ .is_ngc = TRUE,
+  .id = 474,
+  .ra = 20.0277,
+  .dec = 3.41525,
+},
+{ .is_ngc = TRUE,
+  .id = 476,
+  .ra = 20.0829,
+  .dec = 16.0199,
+},
+{ .is_ngc = TRUE,
+  .id = 477,
+  .ra = 20.3348,
+  .dec = 40.4886,
+},
+{ .is_ngc = TRUE,
+  .id = 478,
+  .ra = 20.0383,
+  .dec = -22.3781,
+},
+{ .is_ngc = TRUE,
+  .id = 479,
+  .ra = 20.3158,
+  .dec = 3.86217,
+},
+{ .is_ngc = TRUE,
+  .id = 480,
+  .ra = 20.143,
+  .dec = -9.88033,
+},
+{ .is_ngc = TRUE,
+  .id = 481,
+  .ra = 20.3023,
+  .dec = -9.21139,
+},
+{ .is_ngc = TRUE,
+  .id = 482,
+  .ra = 20.0842,
+  .dec = -40.9656,
+},
+{ .is_ngc = TRUE,
+  .id = 483,
+  .ra = 20.4842,
+  .dec = 33.5216,
+},
+{ .is_ngc = TRUE,
+  .id = 484,
+  .ra = 19.895,
+  .dec = -58.5242,
+},
+{ .is_ngc = TRUE,
+  .id = 485,
+  .ra = 20.3652,
+  .dec = 7.01808,
+},
+{ .is_ngc = TRUE,
+  .id = 486,
+  .ra = 20.4311,
+  .dec = 5.34711,
+},
+{ .is_ngc = TRUE,
+  .id = 487,
+  .ra = 20.4796,
+  .dec = -16.3708,
+},
+{ .is_ngc = TRUE,
+  .id = 488,
+  .ra = 20.4451,
+  .dec = 5.25631,
+},
+{ .is_ngc = TRUE,
+  .id = 489,
+  .ra = 20.4747,
+  .dec = 9.20617,
+},
+{ .is_ngc = TRUE,
+  .id = 490,
+  .ra = 20.512,
+  .dec = 5.36716,
+},
+{ .is_ngc = TRUE,
+  .id = 491,
+  .ra = 20.3342,
+  .dec = -34.0633,
+},
+{ .is_ngc = TRUE,
+  .id = 492,
+  .ra = 20.5569,
+  .dec = 5.41675,
+},
+{ .is_ngc = TRUE,
+  .id = 493,
+  .ra = 20.5383,
+  .dec = 0.946111,
+},
+{ .is_ngc = TRUE,
+  .id = 494,
+  .ra = 20.7304,
+  .dec = 33.1736,
+},
+{ .is_ngc = TRUE,
+  .id = 495,
+  .ra = 20.7334,
+  .dec = 33.4715,
+},
+{ .is_ngc = TRUE,
+  .id = 496,
+  .ra = 20.7983,
+  .dec = 33.5291,
+},
+{ .is_ngc = TRUE,
+  .id = 497,
+  .ra = 20.5993,
+  .dec = -0.875444,
+},
+{ .is_ngc = TRUE,
+  .id = 498,
+  .ra = 20.7969,
+  .dec = 33.489,
+},
+{ .is_ngc = TRUE,
+  .id = 500,
+  .ra = 20.6641,
+  .dec = 5.38724,
+},
+{ .is_ngc = TRUE,
+  .id = 501,
+  .ra = 20.8435,
+  .dec = 33.4328,
+},
+{ .is_ngc = TRUE,
+  .id = 502,
+  .ra = 20.7315,
+  .dec = 9.04883,
+},
+{ .is_ngc = TRUE,
+  .id = 503,
+  .ra = 20.8686,
+  .dec = 33.3319,
+},
+{ .is_ngc = TRUE,
+  .id = 504,
+  .ra = 20.8667,
+  .dec = 33.2041,
+},
+{ .is_ngc = TRUE,
+  .id = 505,
+  .ra = 20.738,
+  .dec = 9.46864,
+},
+{ .is_ngc = TRUE,
+  .id = 506,
+  .ra = 20.8975,
+  .dec = 33.2439,
+},
+{ .is_ngc = TRUE,
+  .id = 507,
+  .ra = 20.9165,
+  .dec = 33.2559,
+},
+{ .is_ngc = TRUE,
+  .id = 508,
+  .ra = 20.9194,
+  .dec = 33.2803,
+},
+{ .is_ngc = TRUE,
+  .id = 509,
+  .ra = 20.8505,
+  .dec = 9.43344,
+},
+{ .is_ngc = TRUE,
+  .id = 510,
+  .ra = 20.9816,
+  .dec = 33.4966,
+},
+{ .is_ngc = TRUE,
+  .id = 511,
+  .ra = 20.878,
+  .dec = 11.2906,
+},
+{ .is_ngc = TRUE,
+  .id = 512,
+  .ra = 20.9992,
+  .dec = 33.9077,
+},
+{ .is_ngc = TRUE,
+  .id = 513,
+  .ra = 21.112,
+  .dec = 33.7993,
+},
+{ .is_ngc = TRUE,
+  .id = 514,
+  .ra = 21.0162,
+  .dec = 12.9173,
+},
+{ .is_ngc = TRUE,
+  .id = 515,
+  .ra = 21.1602,
+  .dec = 33.4729,
+},
+{ .is_ngc = TRUE,
+  .id = 516,
+  .ra = 21.0338,
+  .dec = 9.55153,
+},
+{ .is_ngc = TRUE,
+  .id = 517,
+  .ra = 21.1825,
+  .dec = 33.4294,
+},
+{ .is_ngc = TRUE,
+  .id = 518,
+  .ra = 21.0739,
+  .dec = 9.33094,
+},
+{ .is_ngc = TRUE,
+  .id = 519,
+  .ra = 21.1196,
+  .dec = -1.64139,
+},
+{ .is_ngc = TRUE,
+  .id = 520,
+  .ra = 21.1453,
+  .dec = 3.79183,
+},
+{ .is_ngc = TRUE,
+  .id = 521,
+  .ra = 21.1409,
+  .dec = 1.73125,
+},
+{ .is_ngc = TRUE,
+  .id = 522,
+  .ra = 21.191,
+  .dec = 9.99447,
+},
+{ .is_ngc = TRUE,
+  .id = 524,
+  .ra = 21.199,
+  .dec = 9.53914,
+},
+{ .is_ngc = TRUE,
+  .id = 525,
+  .ra = 21.2202,
+  .dec = 9.703,
+},
+{ .is_ngc = TRUE,
+  .id = 527,
+  .ra = 20.9917,
+  .dec = -35.1154,
+},
+{ .is_ngc = TRUE,
+  .id = 528,
+  .ra = 21.3904,
+  .dec = 33.6712,
+},
+{ .is_ngc = TRUE,
+  .id = 529,
+  .ra = 21.418,
+  .dec = 34.7129,
+},
+{ .is_ngc = TRUE,
+  .id = 531,
+  .ra = 21.5786,
+  .dec = 34.7539,
+},
+{ .is_ngc = TRUE,
+  .id = 532,
+  .ra = 21.3216,
+  .dec = 9.264,
+},
+{ .is_ngc = TRUE,
+  .id = 533,
+  .ra = 21.3812,
+  .dec = 1.75908,
+},
+{ .is_ngc = TRUE,
+  .id = 534,
+  .ra = 21.1862,
+  .dec = -38.1289,
+},
+{ .is_ngc = TRUE,
+  .id = 535,
+  .ra = 21.3798,
+  .dec = -1.40897,
+},
+{ .is_ngc = TRUE,
+  .id = 536,
+  .ra = 21.5907,
+  .dec = 34.7029,
+},
+{ .is_ngc = TRUE,
+  .id = 538,
+  .ra = 21.3589,
+  .dec = -1.55108,
+},
+{ .is_ngc = TRUE,
+  .id = 540,
+  .ra = 21.7868,
+  .dec = -20.0364,
+},
+{ .is_ngc = TRUE,
+  .id = 541,
+  .ra = 21.4349,
+  .dec = -1.37953,
+},
+{ .is_ngc = TRUE,
+  .id = 542,
+  .ra = 21.6288,
+  .dec = 34.6753,
+},
+{ .is_ngc = TRUE,
+  .id = 543,
+  .ra = 21.4583,
+  .dec = -1.29306,
+},
+{ .is_ngc = TRUE,
+  .id = 544,
+  .ra = 21.2996,
+  .dec = -38.0943,
+},
+{ .is_ngc = TRUE,
+  .id = 545,
+  .ra = 21.4965,
+  .dec = -1.34046,
+},
+{ .is_ngc = TRUE,
+  .id = 546,
+  .ra = 21.303,
+  .dec = -38.069,
+},
+{ .is_ngc = TRUE,
+  .id = 547,
+  .ra = 21.503,
+  .dec = -1.34524,
+},
+{ .is_ngc = TRUE,
+  .id = 548,
+  .ra = 21.5105,
+  .dec = -1.22597,
+},
+{ .is_ngc = TRUE,
+  .id = 549,
+  .ra = 21.2793,
+  .dec = -38.0073,
+},
+{ .is_ngc = TRUE,
+  .id = 550,
+  .ra = 21.6768,
+  .dec = 2.02208,
+},
+{ .is_ngc = TRUE,
+  .id = 551,
+  .ra = 21.9194,
+  .dec = 37.1827,
+},
+{ .is_ngc = TRUE,
+  .id = 552,
+  .ra = 21.5423,
+  .dec = 33.4059,
+},
+{ .is_ngc = TRUE,
+  .id = 553,
+  .ra = 21.5522,
+  .dec = 33.4051,
+},
+{ .is_ngc = TRUE,
+  .id = 555,
+  .ra = 21.7988,
+  .dec = -22.7622,
+},
+{ .is_ngc = TRUE,
+  .id = 556,
+  .ra = 21.8024,
+  .dec = -22.6976,
+},
+{ .is_ngc = TRUE,
+  .id = 558,
+  .ra = 21.817,
+  .dec = -1.97133,
+},
+{ .is_ngc = TRUE,
+  .id = 559,
+  .ra = 22.3792,
+  .dec = 63.3011,
+},
+{ .is_ngc = TRUE,
+  .id = 561,
+  .ra = 22.0782,
+  .dec = 34.3084,
+},
+{ .is_ngc = TRUE,
+  .id = 562,
+  .ra = 22.1223,
+  .dec = 48.3871,
+},
+{ .is_ngc = TRUE,
+  .id = 564,
+  .ra = 21.9506,
+  .dec = -1.87944,
+},
+{ .is_ngc = TRUE,
+  .id = 565,
+  .ra = 22.0422,
+  .dec = -1.30631,
+},
+{ .is_ngc = TRUE,
+  .id = 566,
+  .ra = 22.2624,
+  .dec = 32.332,
+},
+{ .is_ngc = TRUE,
+  .id = 567,
+  .ra = 21.7601,
+  .dec = -10.2654,
+},
+{ .is_ngc = TRUE,
+  .id = 569,
+  .ra = 22.2802,
+  .dec = 11.131,
+},
+{ .is_ngc = TRUE,
+  .id = 570,
+  .ra = 22.2444,
+  .dec = -0.949444,
+},
+{ .is_ngc = TRUE,
+  .id = 571,
+  .ra = 22.4837,
+  .dec = 32.5009,
+},
+{ .is_ngc = TRUE,
+  .id = 572,
+  .ra = 22.1513,
+  .dec = -39.3069,
+},
+{ .is_ngc = TRUE,
+  .id = 573,
+  .ra = 22.7054,
+  .dec = 41.2571,
+},
+{ .is_ngc = TRUE,
+  .id = 574,
+  .ra = 22.2621,
+  .dec = -35.5986,
+},
+{ .is_ngc = TRUE,
+  .id = 576,
+  .ra = 22.2383,
+  .dec = -51.5983,
+},
+{ .is_ngc = TRUE,
+  .id = 578,
+  .ra = 22.6192,
+  .dec = -22.6664,
+},
+{ .is_ngc = TRUE,
+  .id = 579,
+  .ra = 22.9438,
+  .dec = 33.6154,
+},
+{ .is_ngc = TRUE,
+  .id = 581,
+  .ra = 23.3458,
+  .dec = 60.65,
+},
+{ .is_ngc = TRUE,
+  .id = 582,
+  .ra = 22.9919,
+  .dec = 33.476,
+},
+{ .is_ngc = TRUE,
+  .id = 583,
+  .ra = 22.4342,
+  .dec = -18.3397,
+},
+{ .is_ngc = TRUE,
+  .id = 585,
+  .ra = 22.9258,
+  .dec = -0.932917,
+},
+{ .is_ngc = TRUE,
+  .id = 586,
+  .ra = 22.9036,
+  .dec = -6.89375,
+},
+{ .is_ngc = TRUE,
+  .id = 587,
+  .ra = 23.1393,
+  .dec = 35.3584,
+},
+{ .is_ngc = TRUE,
+  .id = 588,
+  .ra = 23.19,
+  .dec = 30.6489,
+},
+{ .is_ngc = TRUE,
+  .id = 589,
+  .ra = 23.1664,
+  .dec = -12.0429,
+},
+{ .is_ngc = TRUE,
+  .id = 590,
+  .ra = 23.4207,
+  .dec = 44.9287,
+},
+{ .is_ngc = TRUE,
+  .id = 591,
+  .ra = 23.3805,
+  .dec = 35.6681,
+},
+{ .is_ngc = TRUE,
+  .id = 592,
+  .ra = 23.3,
+  .dec = 30.6458,
+},
+{ .is_ngc = TRUE,
+  .id = 593,
+  .ra = 23.0862,
+  .dec = -12.3558,
+},
+{ .is_ngc = TRUE,
+  .id = 594,
+  .ra = 23.2371,
+  .dec = -16.5358,
+},
+{ .is_ngc = TRUE,
+  .id = 595,
+  .ra = 23.3908,
+  .dec = 30.6919,
+},
+{ .is_ngc = TRUE,
+  .id = 596,
+  .ra = 23.2167,
+  .dec = -7.03222,
+},
+{ .is_ngc = TRUE,
+  .id = 597,
+  .ra = 23.0617,
+  .dec = -33.4978,
+},
+{ .is_ngc = TRUE,
+  .id = 598,
+  .ra = 23.4621,
+  .dec = 30.6602,
+},
+{ .is_ngc = TRUE,
+  .id = 599,
+  .ra = 23.2242,
+  .dec = -12.191,
+},
+{ .is_ngc = TRUE,
+  .id = 600,
+  .ra = 23.2725,
+  .dec = -7.31222,
+},
+{ .is_ngc = TRUE,
+  .id = 601,
+  .ra = 23.2775,
+  .dec = -12.2089,
+},
+{ .is_ngc = TRUE,
+  .id = 602,
+  .ra = 22.3583,
+  .dec = -73.5514,
+},
+{ .is_ngc = TRUE,
+  .id = 603,
+  .ra = 23.6833,
+  .dec = 30.2322,
+},
+{ .is_ngc = TRUE,
+  .id = 604,
+  .ra = 23.6368,
+  .dec = 30.7839,
+},
+{ .is_ngc = TRUE,
+  .id = 605,
+  .ra = 23.7598,
+  .dec = 41.2479,
+},
+{ .is_ngc = TRUE,
+  .id = 606,
+  .ra = 23.7094,
+  .dec = 21.4176,
+},
+{ .is_ngc = TRUE,
+  .id = 607,
+  .ra = 23.5682,
+  .dec = -7.41244,
+},
+{ .is_ngc = TRUE,
+  .id = 609,
+  .ra = 24.0958,
+  .dec = 64.5342,
+},
+{ .is_ngc = TRUE,
+  .id = 610,
+  .ra = 23.5125,
+  .dec = -20.1333,
+},
+{ .is_ngc = TRUE,
+  .id = 611,
+  .ra = 23.5125,
+  .dec = -20.1167,
+},
+{ .is_ngc = TRUE,
+  .id = 612,
+  .ra = 23.4912,
+  .dec = -36.4929,
+},
+{ .is_ngc = TRUE,
+  .id = 613,
+  .ra = 23.576,
+  .dec = -29.4188,
+},
+{ .is_ngc = TRUE,
+  .id = 615,
+  .ra = 23.7733,
+  .dec = -7.34056,
+},
+{ .is_ngc = TRUE,
+  .id = 616,
+  .ra = 24.0175,
+  .dec = 33.7703,
+},
+{ .is_ngc = TRUE,
+  .id = 617,
+  .ra = 23.5106,
+  .dec = -9.77409,
+},
+{ .is_ngc = TRUE,
+  .id = 619,
+  .ra = 23.7163,
+  .dec = -36.4886,
+},
+{ .is_ngc = TRUE,
+  .id = 620,
+  .ra = 24.2491,
+  .dec = 42.3221,
+},
+{ .is_ngc = TRUE,
+  .id = 621,
+  .ra = 24.2045,
+  .dec = 35.512,
+},
+{ .is_ngc = TRUE,
+  .id = 622,
+  .ra = 24.0002,
+  .dec = 0.663722,
+},
+{ .is_ngc = TRUE,
+  .id = 623,
+  .ra = 23.7758,
+  .dec = -36.49,
+},
+{ .is_ngc = TRUE,
+  .id = 624,
+  .ra = 23.9629,
+  .dec = -10.0031,
+},
+{ .is_ngc = TRUE,
+  .id = 625,
+  .ra = 23.77,
+  .dec = -41.4369,
+},
+{ .is_ngc = TRUE,
+  .id = 626,
+  .ra = 23.7996,
+  .dec = -39.1472,
+},
+{ .is_ngc = TRUE,
+  .id = 628,
+  .ra = 24.1743,
+  .dec = 15.7835,
+},
+{ .is_ngc = TRUE,
+  .id = 629,
+  .ra = 24.7438,
+  .dec = 72.8669,
+},
+{ .is_ngc = TRUE,
+  .id = 630,
+  .ra = 23.9025,
+  .dec = -39.3589,
+},
+{ .is_ngc = TRUE,
+  .id = 631,
+  .ra = 24.1962,
+  .dec = 5.83521,
+},
+{ .is_ngc = TRUE,
+  .id = 632,
+  .ra = 24.323,
+  .dec = 5.87733,
+},
+{ .is_ngc = TRUE,
+  .id = 633,
+  .ra = 24.0988,
+  .dec = -37.3222,
+},
+{ .is_ngc = TRUE,
+  .id = 634,
+  .ra = 24.577,
+  .dec = 35.3649,
+},
+{ .is_ngc = TRUE,
+  .id = 635,
+  .ra = 24.5743,
+  .dec = -22.9289,
+},
+{ .is_ngc = TRUE,
+  .id = 636,
+  .ra = 24.7769,
+  .dec = -7.51253,
+},
+{ .is_ngc = TRUE,
+  .id = 637,
+  .ra = 25.7667,
+  .dec = 64.0344,
+},
+{ .is_ngc = TRUE,
+  .id = 638,
+  .ra = 24.9078,
+  .dec = 7.23706,
+},
+{ .is_ngc = TRUE,
+  .id = 639,
+  .ra = 24.7456,
+  .dec = -29.9252,
+},
+{ .is_ngc = TRUE,
+  .id = 640,
+  .ra = 24.8542,
+  .dec = -9.40139,
+},
+{ .is_ngc = TRUE,
+  .id = 641,
+  .ra = 24.6633,
+  .dec = -42.5269,
+},
+{ .is_ngc = TRUE,
+  .id = 642,
+  .ra = 24.7768,
+  .dec = -29.9152,
+},
+{ .is_ngc = TRUE,
+  .id = 643,
+  .ra = 23.7542,
+  .dec = -75.5567,
+},
+{ .is_ngc = TRUE,
+  .id = 644,
+  .ra = 24.7208,
+  .dec = -42.5853,
+},
+{ .is_ngc = TRUE,
+  .id = 645,
+  .ra = 25.0366,
+  .dec = 5.72658,
+},
+{ .is_ngc = TRUE,
+  .id = 646,
+  .ra = 24.3395,
+  .dec = -64.8955,
+},
+{ .is_ngc = TRUE,
+  .id = 647,
+  .ra = 24.9842,
+  .dec = -9.24246,
+},
+{ .is_ngc = TRUE,
+  .id = 649,
+  .ra = 25.0312,
+  .dec = -9.27222,
+},
+{ .is_ngc = TRUE,
+  .id = 650,
+  .ra = 25.5754,
+  .dec = 51.5708,
+},
+{ .is_ngc = TRUE,
+  .id = 651,
+  .ra = 25.5917,
+  .dec = 51.58,
+},
+{ .is_ngc = TRUE,
+  .id = 652,
+  .ra = 25.1803,
+  .dec = 7.98255,
+},
+{ .is_ngc = TRUE,
+  .id = 653,
+  .ra = 25.6071,
+  .dec = 35.6383,
+},
+{ .is_ngc = TRUE,
+  .id = 654,
+  .ra = 26,
+  .dec = 61.8836,
+},
+{ .is_ngc = TRUE,
+  .id = 655,
+  .ra = 25.4796,
+  .dec = -13.0822,
+},
+{ .is_ngc = TRUE,
+  .id = 656,
+  .ra = 25.614,
+  .dec = 26.1429,
+},
+{ .is_ngc = TRUE,
+  .id = 657,
+  .ra = 25.8333,
+  .dec = 55.8339,
+},
+{ .is_ngc = TRUE,
+  .id = 657,
+  .ra = 25.9458,
+  .dec = 55.8686,
+},
+{ .is_ngc = TRUE,
+  .id = 658,
+  .ra = 25.5407,
+  .dec = 12.6017,
+},
+{ .is_ngc = TRUE,
+  .id = 659,
+  .ra = 26.1,
+  .dec = 60.6678,
+},
+{ .is_ngc = TRUE,
+  .id = 660,
+  .ra = 25.7587,
+  .dec = 13.6443,
+},
+{ .is_ngc = TRUE,
+  .id = 661,
+  .ra = 26.0607,
+  .dec = 28.706,
+},
+{ .is_ngc = TRUE,
+  .id = 662,
+  .ra = 26.1478,
+  .dec = 37.6962,
+},
+{ .is_ngc = TRUE,
+  .id = 663,
+  .ra = 26.5375,
+  .dec = 61.2336,
+},
+{ .is_ngc = TRUE,
+  .id = 664,
+  .ra = 25.9412,
+  .dec = 4.22225,
+},
+{ .is_ngc = TRUE,
+  .id = 665,
+  .ra = 26.2336,
+  .dec = 10.4227,
+},
+{ .is_ngc = TRUE,
+  .id = 666,
+  .ra = 26.5259,
+  .dec = 34.3744,
+},
+{ .is_ngc = TRUE,
+  .id = 667,
+  .ra = 26.2375,
+  .dec = -22.9203,
+},
+{ .is_ngc = TRUE,
+  .id = 668,
+  .ra = 26.5945,
+  .dec = 36.4602,
+},
+{ .is_ngc = TRUE,
+  .id = 669,
+  .ra = 26.8172,
+  .dec = 35.5628,
+},
+{ .is_ngc = TRUE,
+  .id = 670,
+  .ra = 26.854,
+  .dec = 27.886,
+},
+{ .is_ngc = TRUE,
+  .id = 671,
+  .ra = 26.7467,
+  .dec = 13.1252,
+},
+{ .is_ngc = TRUE,
+  .id = 672,
+  .ra = 26.9752,
+  .dec = 27.4329,
+},
+{ .is_ngc = TRUE,
+  .id = 673,
+  .ra = 27.0939,
+  .dec = 11.5215,
+},
+{ .is_ngc = TRUE,
+  .id = 675,
+  .ra = 27.2858,
+  .dec = 13.0593,
+},
+{ .is_ngc = TRUE,
+  .id = 676,
+  .ra = 27.2389,
+  .dec = 5.90717,
+},
+{ .is_ngc = TRUE,
+  .id = 677,
+  .ra = 27.309,
+  .dec = 13.055,
+},
+{ .is_ngc = TRUE,
+  .id = 678,
+  .ra = 27.3539,
+  .dec = 21.9971,
+},
+{ .is_ngc = TRUE,
+  .id = 679,
+  .ra = 27.4323,
+  .dec = 35.7852,
+},
+{ .is_ngc = TRUE,
+  .id = 680,
+  .ra = 27.447,
+  .dec = 21.9707,
+},
+{ .is_ngc = TRUE,
+  .id = 681,
+  .ra = 27.295,
+  .dec = -10.4269,
+},
+{ .is_ngc = TRUE,
+  .id = 682,
+  .ra = 27.2683,
+  .dec = -14.9747,
+},
+{ .is_ngc = TRUE,
+  .id = 683,
+  .ra = 27.4446,
+  .dec = 11.7012,
+},
+{ .is_ngc = TRUE,
+  .id = 685,
+  .ra = 26.9287,
+  .dec = -52.7618,
+},
+{ .is_ngc = TRUE,
+  .id = 686,
+  .ra = 27.2342,
+  .dec = -23.7983,
+},
+{ .is_ngc = TRUE,
+  .id = 687,
+  .ra = 27.639,
+  .dec = 36.3706,
+},
+{ .is_ngc = TRUE,
+  .id = 688,
+  .ra = 27.6843,
+  .dec = 35.2844,
+},
+{ .is_ngc = TRUE,
+  .id = 689,
+  .ra = 27.4654,
+  .dec = -27.4661,
+},
+{ .is_ngc = TRUE,
+  .id = 690,
+  .ra = 26.9509,
+  .dec = -16.7216,
+},
+{ .is_ngc = TRUE,
+  .id = 691,
+  .ra = 27.674,
+  .dec = 21.7598,
+},
+{ .is_ngc = TRUE,
+  .id = 692,
+  .ra = 27.1758,
+  .dec = -48.6481,
+},
+{ .is_ngc = TRUE,
+  .id = 693,
+  .ra = 27.6287,
+  .dec = 6.14494,
+},
+{ .is_ngc = TRUE,
+  .id = 694,
+  .ra = 27.7437,
+  .dec = 21.9974,
+},
+{ .is_ngc = TRUE,
+  .id = 695,
+  .ra = 27.8092,
+  .dec = 22.5825,
+},
+{ .is_ngc = TRUE,
+  .id = 696,
+  .ra = 27.3798,
+  .dec = -34.9054,
+},
+{ .is_ngc = TRUE,
+  .id = 698,
+  .ra = 27.4314,
+  .dec = -34.8313,
+},
+{ .is_ngc = TRUE,
+  .id = 699,
+  .ra = 27.6825,
+  .dec = -12.0358,
+},
+{ .is_ngc = TRUE,
+  .id = 700,
+  .ra = 28.0702,
+  .dec = 36.0366,
+},
+{ .is_ngc = TRUE,
+  .id = 701,
+  .ra = 27.7658,
+  .dec = -9.70306,
+},
+{ .is_ngc = TRUE,
+  .id = 703,
+  .ra = 28.1652,
+  .dec = 36.1713,
+},
+{ .is_ngc = TRUE,
+  .id = 704,
+  .ra = 28.1577,
+  .dec = 36.1256,
+},
+{ .is_ngc = TRUE,
+  .id = 705,
+  .ra = 28.1735,
+  .dec = 36.1438,
+},
+{ .is_ngc = TRUE,
+  .id = 706,
+  .ra = 27.9606,
+  .dec = 6.29606,
+},
+{ .is_ngc = TRUE,
+  .id = 707,
+  .ra = 27.8633,
+  .dec = -8.50617,
+},
+{ .is_ngc = TRUE,
+  .id = 708,
+  .ra = 28.1935,
+  .dec = 36.1517,
+},
+{ .is_ngc = TRUE,
+  .id = 709,
+  .ra = 28.211,
+  .dec = 36.2228,
+},
+{ .is_ngc = TRUE,
+  .id = 710,
+  .ra = 28.2248,
+  .dec = 36.0531,
+},
+{ .is_ngc = TRUE,
+  .id = 711,
+  .ra = 28.1158,
+  .dec = 17.5127,
+},
+{ .is_ngc = TRUE,
+  .id = 712,
+  .ra = 28.2856,
+  .dec = 36.8198,
+},
+{ .is_ngc = TRUE,
+  .id = 713,
+  .ra = 28.8399,
+  .dec = -9.08367,
+},
+{ .is_ngc = TRUE,
+  .id = 714,
+  .ra = 28.3737,
+  .dec = 36.221,
+},
+{ .is_ngc = TRUE,
+  .id = 715,
+  .ra = 28.3017,
+  .dec = -12.8736,
+},
+{ .is_ngc = TRUE,
+  .id = 717,
+  .ra = 28.4796,
+  .dec = 36.2292,
+},
+{ .is_ngc = TRUE,
+  .id = 718,
+  .ra = 28.3052,
+  .dec = 4.19528,
+},
+{ .is_ngc = TRUE,
+  .id = 720,
+  .ra = 28.2517,
+  .dec = -13.7386,
+},
+{ .is_ngc = TRUE,
+  .id = 721,
+  .ra = 28.6897,
+  .dec = 39.383,
+},
+{ .is_ngc = TRUE,
+  .id = 722,
+  .ra = 28.6956,
+  .dec = 20.698,
+},
+{ .is_ngc = TRUE,
+  .id = 725,
+  .ra = 28.1479,
+  .dec = -16.5178,
+},
+{ .is_ngc = TRUE,
+  .id = 726,
+  .ra = 28.8829,
+  .dec = -10.8003,
+},
+{ .is_ngc = TRUE,
+  .id = 728,
+  .ra = 28.7558,
+  .dec = 4.22222,
+},
+{ .is_ngc = TRUE,
+  .id = 730,
+  .ra = 28.8251,
+  .dec = 5.63581,
+},
+{ .is_ngc = TRUE,
+  .id = 732,
+  .ra = 29.1155,
+  .dec = 36.8021,
+},
+{ .is_ngc = TRUE,
+  .id = 733,
+  .ra = 29.1405,
+  .dec = 33.0562,
+},
+{ .is_ngc = TRUE,
+  .id = 733,
+  .ra = 29.1028,
+  .dec = 33.0647,
+},
+{ .is_ngc = TRUE,
+  .id = 734,
+  .ra = 28.7383,
+  .dec = -17.0801,
+},
+{ .is_ngc = TRUE,
+  .id = 735,
+  .ra = 29.1583,
+  .dec = 34.1766,
+},
+{ .is_ngc = TRUE,
+  .id = 736,
+  .ra = 29.1707,
+  .dec = 33.044,
+},
+{ .is_ngc = TRUE,
+  .id = 737,
+  .ra = 29.17,
+  .dec = 33.05,
+},
+{ .is_ngc = TRUE,
+  .id = 738,
+  .ra = 29.1903,
+  .dec = 33.0587,
+},
+{ .is_ngc = TRUE,
+  .id = 739,
+  .ra = 29.2279,
+  .dec = 33.2667,
+},
+{ .is_ngc = TRUE,
+  .id = 740,
+  .ra = 29.2289,
+  .dec = 33.0154,
+},
+{ .is_ngc = TRUE,
+  .id = 742,
+  .ra = 29.1002,
+  .dec = 5.62622,
+},
+{ .is_ngc = TRUE,
+  .id = 743,
+  .ra = 29.6542,
+  .dec = 60.1508,
+},
+{ .is_ngc = TRUE,
+  .id = 744,
+  .ra = 29.6375,
+  .dec = 55.4678,
+},
+{ .is_ngc = TRUE,
+  .id = 745,
+  .ra = 28.5323,
+  .dec = -56.6937,
+},
+{ .is_ngc = TRUE,
+  .id = 746,
+  .ra = 29.463,
+  .dec = 44.9179,
+},
+{ .is_ngc = TRUE,
+  .id = 747,
+  .ra = 29.3768,
+  .dec = -9.46272,
+},
+{ .is_ngc = TRUE,
+  .id = 748,
+  .ra = 29.0908,
+  .dec = -4.4675,
+},
+{ .is_ngc = TRUE,
+  .id = 749,
+  .ra = 28.9212,
+  .dec = -29.9224,
+},
+{ .is_ngc = TRUE,
+  .id = 750,
+  .ra = 29.3857,
+  .dec = 33.2098,
+},
+{ .is_ngc = TRUE,
+  .id = 751,
+  .ra = 29.3874,
+  .dec = 33.2033,
+},
+{ .is_ngc = TRUE,
+  .id = 752,
+  .ra = 29.4208,
+  .dec = 37.7836,
+},
+{ .is_ngc = TRUE,
+  .id = 753,
+  .ra = 29.4268,
+  .dec = 35.9156,
+},
+{ .is_ngc = TRUE,
+  .id = 754,
+  .ra = 28.5871,
+  .dec = -56.7614,
+},
+{ .is_ngc = TRUE,
+  .id = 756,
+  .ra = 28.6215,
+  .dec = -16.708,
+},
+{ .is_ngc = TRUE,
+  .id = 758,
+  .ra = 28.9256,
+  .dec = -3.06661,
+},
+{ .is_ngc = TRUE,
+  .id = 759,
+  .ra = 29.4599,
+  .dec = 36.3427,
+},
+{ .is_ngc = TRUE,
+  .id = 760,
+  .ra = 29.4472,
+  .dec = 33.3556,
+},
+{ .is_ngc = TRUE,
+  .id = 761,
+  .ra = 29.457,
+  .dec = 33.3771,
+},
+{ .is_ngc = TRUE,
+  .id = 762,
+  .ra = 29.2408,
+  .dec = -5.40278,
+},
+{ .is_ngc = TRUE,
+  .id = 764,
+  .ra = 29.2633,
+  .dec = -16.0619,
+},
+{ .is_ngc = TRUE,
+  .id = 765,
+  .ra = 29.6997,
+  .dec = 24.8919,
+},
+{ .is_ngc = TRUE,
+  .id = 766,
+  .ra = 29.675,
+  .dec = 8.347,
+},
+{ .is_ngc = TRUE,
+  .id = 767,
+  .ra = 29.7117,
+  .dec = -9.58722,
+},
+{ .is_ngc = TRUE,
+  .id = 768,
+  .ra = 29.67,
+  .dec = 0.529056,
+},
+{ .is_ngc = TRUE,
+  .id = 769,
+  .ra = 29.8997,
+  .dec = 30.9095,
+},
+{ .is_ngc = TRUE,
+  .id = 770,
+  .ra = 29.8065,
+  .dec = 18.9548,
+},
+{ .is_ngc = TRUE,
+  .id = 771,
+  .ra = 30.8598,
+  .dec = 72.4211,
+},
+{ .is_ngc = TRUE,
+  .id = 772,
+  .ra = 29.8327,
+  .dec = 19.008,
+},
+{ .is_ngc = TRUE,
+  .id = 773,
+  .ra = 29.7171,
+  .dec = -11.5153,
+},
+{ .is_ngc = TRUE,
+  .id = 774,
+  .ra = 29.8949,
+  .dec = 14.0081,
+},
+{ .is_ngc = TRUE,
+  .id = 775,
+  .ra = 29.6358,
+  .dec = -26.2931,
+},
+{ .is_ngc = TRUE,
+  .id = 776,
+  .ra = 29.9773,
+  .dec = 23.644,
+},
+{ .is_ngc = TRUE,
+  .id = 777,
+  .ra = 30.0623,
+  .dec = 31.4295,
+},
+{ .is_ngc = TRUE,
+  .id = 778,
+  .ra = 30.081,
+  .dec = 31.313,
+},
+{ .is_ngc = TRUE,
+  .id = 779,
+  .ra = 29.9267,
+  .dec = -5.96417,
+},
+{ .is_ngc = TRUE,
+  .id = 780,
+  .ra = 30.1468,
+  .dec = 28.2252,
+},
+{ .is_ngc = TRUE,
+  .id = 781,
+  .ra = 30.0376,
+  .dec = 12.6555,
+},
+{ .is_ngc = TRUE,
+  .id = 782,
+  .ra = 29.4177,
+  .dec = -57.7906,
+},
+{ .is_ngc = TRUE,
+  .id = 784,
+  .ra = 30.3212,
+  .dec = 28.8373,
+},
+{ .is_ngc = TRUE,
+  .id = 786,
+  .ra = 30.3528,
+  .dec = 15.6465,
+},
+{ .is_ngc = TRUE,
+  .id = 787,
+  .ra = 30.2025,
+  .dec = -9.00261,
+},
+{ .is_ngc = TRUE,
+  .id = 788,
+  .ra = 30.2765,
+  .dec = -6.81571,
+},
+{ .is_ngc = TRUE,
+  .id = 789,
+  .ra = 30.6085,
+  .dec = 32.0721,
+},
+{ .is_ngc = TRUE,
+  .id = 790,
+  .ra = 30.34,
+  .dec = -5.37056,
+},
+{ .is_ngc = TRUE,
+  .id = 791,
+  .ra = 30.4344,
+  .dec = 8.49944,
+},
+{ .is_ngc = TRUE,
+  .id = 792,
+  .ra = 30.564,
+  .dec = 15.7121,
+},
+{ .is_ngc = TRUE,
+  .id = 793,
+  .ra = 30.7271,
+  .dec = 31.9811,
+},
+{ .is_ngc = TRUE,
+  .id = 795,
+  .ra = 29.9563,
+  .dec = -55.8247,
+},
+{ .is_ngc = TRUE,
+  .id = 796,
+  .ra = 29.1846,
+  .dec = -74.2194,
+},
+{ .is_ngc = TRUE,
+  .id = 797,
+  .ra = 30.8666,
+  .dec = 38.1171,
+},
+{ .is_ngc = TRUE,
+  .id = 798,
+  .ra = 30.8318,
+  .dec = 32.0774,
+},
+{ .is_ngc = TRUE,
+  .id = 799,
+  .ra = 30.5514,
+  .dec = -0.101139,
+},
+{ .is_ngc = TRUE,
+  .id = 800,
+  .ra = 30.5493,
+  .dec = -0.130667,
+},
+{ .is_ngc = TRUE,
+  .id = 801,
+  .ra = 30.9376,
+  .dec = 38.2592,
+},
+{ .is_ngc = TRUE,
+  .id = 802,
+  .ra = 29.7775,
+  .dec = -67.87,
+},
+{ .is_ngc = TRUE,
+  .id = 803,
+  .ra = 30.9372,
+  .dec = 16.0311,
+},
+{ .is_ngc = TRUE,
+  .id = 805,
+  .ra = 31.1233,
+  .dec = 28.8122,
+},
+{ .is_ngc = TRUE,
+  .id = 806,
+  .ra = 30.8804,
+  .dec = -9.93278,
+},
+{ .is_ngc = TRUE,
+  .id = 807,
+  .ra = 31.232,
+  .dec = 28.9878,
+},
+{ .is_ngc = TRUE,
+  .id = 808,
+  .ra = 30.9867,
+  .dec = -23.3131,
+},
+{ .is_ngc = TRUE,
+  .id = 809,
+  .ra = 31.0789,
+  .dec = -8.73539,
+},
+{ .is_ngc = TRUE,
+  .id = 811,
+  .ra = 30.9999,
+  .dec = -9.10581,
+},
+{ .is_ngc = TRUE,
+  .id = 812,
+  .ra = 31.7163,
+  .dec = 44.571,
+},
+{ .is_ngc = TRUE,
+  .id = 813,
+  .ra = 30.4021,
+  .dec = -68.4403,
+},
+{ .is_ngc = TRUE,
+  .id = 814,
+  .ra = 32.657,
+  .dec = -15.7736,
+},
+{ .is_ngc = TRUE,
+  .id = 815,
+  .ra = 32.664,
+  .dec = -15.813,
+},
+{ .is_ngc = TRUE,
+  .id = 816,
+  .ra = 32.037,
+  .dec = 29.256,
+},
+{ .is_ngc = TRUE,
+  .id = 817,
+  .ra = 31.8905,
+  .dec = 17.2018,
+},
+{ .is_ngc = TRUE,
+  .id = 818,
+  .ra = 32.1855,
+  .dec = 38.7767,
+},
+{ .is_ngc = TRUE,
+  .id = 819,
+  .ra = 32.1436,
+  .dec = 29.2338,
+},
+{ .is_ngc = TRUE,
+  .id = 820,
+  .ra = 32.1042,
+  .dec = 14.3492,
+},
+{ .is_ngc = TRUE,
+  .id = 821,
+  .ra = 32.088,
+  .dec = 10.9947,
+},
+{ .is_ngc = TRUE,
+  .id = 822,
+  .ra = 31.6633,
+  .dec = -41.1572,
+},
+{ .is_ngc = TRUE,
+  .id = 824,
+  .ra = 31.7208,
+  .dec = -36.4531,
+},
+{ .is_ngc = TRUE,
+  .id = 825,
+  .ra = 32.1348,
+  .dec = 6.32356,
+},
+{ .is_ngc = TRUE,
+  .id = 826,
+  .ra = 32.3547,
+  .dec = 30.7393,
+},
+{ .is_ngc = TRUE,
+  .id = 827,
+  .ra = 32.2347,
+  .dec = 7.97133,
+},
+{ .is_ngc = TRUE,
+  .id = 828,
+  .ra = 32.5398,
+  .dec = 39.1912,
+},
+{ .is_ngc = TRUE,
+  .id = 829,
+  .ra = 32.1754,
+  .dec = -7.79056,
+},
+{ .is_ngc = TRUE,
+  .id = 830,
+  .ra = 32.2446,
+  .dec = -7.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 831,
+  .ra = 32.394,
+  .dec = 6.09608,
+},
+{ .is_ngc = TRUE,
+  .id = 832,
+  .ra = 32.7534,
+  .dec = 35.5414,
+},
+{ .is_ngc = TRUE,
+  .id = 833,
+  .ra = 32.3367,
+  .dec = -10.1333,
+},
+{ .is_ngc = TRUE,
+  .id = 834,
+  .ra = 32.7557,
+  .dec = 37.6667,
+},
+{ .is_ngc = TRUE,
+  .id = 835,
+  .ra = 32.3529,
+  .dec = -10.136,
+},
+{ .is_ngc = TRUE,
+  .id = 836,
+  .ra = 32.604,
+  .dec = -22.055,
+},
+{ .is_ngc = TRUE,
+  .id = 837,
+  .ra = 32.5667,
+  .dec = -22.4306,
+},
+{ .is_ngc = TRUE,
+  .id = 838,
+  .ra = 32.4101,
+  .dec = -10.1465,
+},
+{ .is_ngc = TRUE,
+  .id = 839,
+  .ra = 32.4286,
+  .dec = -10.1839,
+},
+{ .is_ngc = TRUE,
+  .id = 840,
+  .ra = 32.5677,
+  .dec = 7.84512,
+},
+{ .is_ngc = TRUE,
+  .id = 841,
+  .ra = 32.8227,
+  .dec = 37.4972,
+},
+{ .is_ngc = TRUE,
+  .id = 842,
+  .ra = 32.4615,
+  .dec = -7.76264,
+},
+{ .is_ngc = TRUE,
+  .id = 843,
+  .ra = 32.784,
+  .dec = 32.0976,
+},
+{ .is_ngc = TRUE,
+  .id = 844,
+  .ra = 32.5595,
+  .dec = 6.04978,
+},
+{ .is_ngc = TRUE,
+  .id = 845,
+  .ra = 33.0823,
+  .dec = 37.4769,
+},
+{ .is_ngc = TRUE,
+  .id = 848,
+  .ra = 32.5729,
+  .dec = -10.3208,
+},
+{ .is_ngc = TRUE,
+  .id = 849,
+  .ra = 32.5464,
+  .dec = -22.3231,
+},
+{ .is_ngc = TRUE,
+  .id = 850,
+  .ra = 32.8065,
+  .dec = -1.48575,
+},
+{ .is_ngc = TRUE,
+  .id = 851,
+  .ra = 32.8007,
+  .dec = 3.77936,
+},
+{ .is_ngc = TRUE,
+  .id = 852,
+  .ra = 32.2304,
+  .dec = -56.7369,
+},
+{ .is_ngc = TRUE,
+  .id = 853,
+  .ra = 32.922,
+  .dec = -9.30536,
+},
+{ .is_ngc = TRUE,
+  .id = 854,
+  .ra = 32.8775,
+  .dec = -35.8364,
+},
+{ .is_ngc = TRUE,
+  .id = 855,
+  .ra = 33.5151,
+  .dec = 27.8771,
+},
+{ .is_ngc = TRUE,
+  .id = 857,
+  .ra = 33.1542,
+  .dec = -31.9444,
+},
+{ .is_ngc = TRUE,
+  .id = 858,
+  .ra = 33.1246,
+  .dec = -22.4714,
+},
+{ .is_ngc = TRUE,
+  .id = 860,
+  .ra = 33.7509,
+  .dec = 30.7786,
+},
+{ .is_ngc = TRUE,
+  .id = 861,
+  .ra = 33.9632,
+  .dec = 35.9132,
+},
+{ .is_ngc = TRUE,
+  .id = 862,
+  .ra = 33.2617,
+  .dec = -42.0333,
+},
+{ .is_ngc = TRUE,
+  .id = 864,
+  .ra = 33.865,
+  .dec = 6.002,
+},
+{ .is_ngc = TRUE,
+  .id = 865,
+  .ra = 34.0634,
+  .dec = 28.6001,
+},
+{ .is_ngc = TRUE,
+  .id = 869,
+  .ra = 34.75,
+  .dec = 57.1186,
+},
+{ .is_ngc = TRUE,
+  .id = 870,
+  .ra = 34.2883,
+  .dec = 14.5225,
+},
+{ .is_ngc = TRUE,
+  .id = 871,
+  .ra = 34.2943,
+  .dec = 14.5478,
+},
+{ .is_ngc = TRUE,
+  .id = 872,
+  .ra = 33.8552,
+  .dec = -17.7817,
+},
+{ .is_ngc = TRUE,
+  .id = 873,
+  .ra = 34.1346,
+  .dec = -11.3489,
+},
+{ .is_ngc = TRUE,
+  .id = 874,
+  .ra = 34.0079,
+  .dec = -23.3056,
+},
+{ .is_ngc = TRUE,
+  .id = 876,
+  .ra = 34.472,
+  .dec = 14.5209,
+},
+{ .is_ngc = TRUE,
+  .id = 877,
+  .ra = 34.4984,
+  .dec = 14.5441,
+},
+{ .is_ngc = TRUE,
+  .id = 878,
+  .ra = 34.4762,
+  .dec = -23.3839,
+},
+{ .is_ngc = TRUE,
+  .id = 879,
+  .ra = 34.2137,
+  .dec = -8.96361,
+},
+{ .is_ngc = TRUE,
+  .id = 880,
+  .ra = 34.6133,
+  .dec = -4.20556,
+},
+{ .is_ngc = TRUE,
+  .id = 881,
+  .ra = 34.6887,
+  .dec = -6.63972,
+},
+{ .is_ngc = TRUE,
+  .id = 882,
+  .ra = 34.9163,
+  .dec = 15.8141,
+},
+{ .is_ngc = TRUE,
+  .id = 883,
+  .ra = 34.7717,
+  .dec = -6.79128,
+},
+{ .is_ngc = TRUE,
+  .id = 884,
+  .ra = 35.575,
+  .dec = 57.1339,
+},
+{ .is_ngc = TRUE,
+  .id = 886,
+  .ra = 35.7938,
+  .dec = 63.7744,
+},
+{ .is_ngc = TRUE,
+  .id = 887,
+  .ra = 34.8858,
+  .dec = -16.0697,
+},
+{ .is_ngc = TRUE,
+  .id = 888,
+  .ra = 34.3642,
+  .dec = -59.8619,
+},
+{ .is_ngc = TRUE,
+  .id = 889,
+  .ra = 34.7783,
+  .dec = -41.7492,
+},
+{ .is_ngc = TRUE,
+  .id = 890,
+  .ra = 35.504,
+  .dec = 33.2654,
+},
+{ .is_ngc = TRUE,
+  .id = 891,
+  .ra = 35.6384,
+  .dec = 42.3483,
+},
+{ .is_ngc = TRUE,
+  .id = 892,
+  .ra = 35.2175,
+  .dec = -23.1136,
+},
+{ .is_ngc = TRUE,
+  .id = 893,
+  .ra = 34.995,
+  .dec = -41.4042,
+},
+{ .is_ngc = TRUE,
+  .id = 894,
+  .ra = 35.3942,
+  .dec = -5.51,
+},
+{ .is_ngc = TRUE,
+  .id = 895,
+  .ra = 35.4012,
+  .dec = -5.52139,
+},
+{ .is_ngc = TRUE,
+  .id = 896,
+  .ra = 36.3658,
+  .dec = 62.0192,
+},
+{ .is_ngc = TRUE,
+  .id = 897,
+  .ra = 35.2758,
+  .dec = -33.7214,
+},
+{ .is_ngc = TRUE,
+  .id = 898,
+  .ra = 35.8346,
+  .dec = 41.9514,
+},
+{ .is_ngc = TRUE,
+  .id = 899,
+  .ra = 35.4713,
+  .dec = -20.8233,
+},
+{ .is_ngc = TRUE,
+  .id = 900,
+  .ra = 35.8842,
+  .dec = 26.5113,
+},
+{ .is_ngc = TRUE,
+  .id = 901,
+  .ra = 35.8919,
+  .dec = 26.5564,
+},
+{ .is_ngc = TRUE,
+  .id = 902,
+  .ra = 35.5911,
+  .dec = -16.6792,
+},
+{ .is_ngc = TRUE,
+  .id = 903,
+  .ra = 36.0036,
+  .dec = 27.3562,
+},
+{ .is_ngc = TRUE,
+  .id = 904,
+  .ra = 36.0234,
+  .dec = 27.3422,
+},
+{ .is_ngc = TRUE,
+  .id = 905,
+  .ra = 35.6813,
+  .dec = -8.71933,
+},
+{ .is_ngc = TRUE,
+  .id = 906,
+  .ra = 36.3179,
+  .dec = 42.0899,
+},
+{ .is_ngc = TRUE,
+  .id = 907,
+  .ra = 35.7587,
+  .dec = -20.7128,
+},
+{ .is_ngc = TRUE,
+  .id = 908,
+  .ra = 35.7695,
+  .dec = -21.234,
+},
+{ .is_ngc = TRUE,
+  .id = 909,
+  .ra = 36.3448,
+  .dec = 42.0353,
+},
+{ .is_ngc = TRUE,
+  .id = 910,
+  .ra = 36.3616,
+  .dec = 41.8241,
+},
+{ .is_ngc = TRUE,
+  .id = 911,
+  .ra = 36.4267,
+  .dec = 41.9562,
+},
+{ .is_ngc = TRUE,
+  .id = 912,
+  .ra = 36.4277,
+  .dec = 41.7779,
+},
+{ .is_ngc = TRUE,
+  .id = 913,
+  .ra = 36.4358,
+  .dec = 41.7989,
+},
+{ .is_ngc = TRUE,
+  .id = 914,
+  .ra = 36.5215,
+  .dec = 42.144,
+},
+{ .is_ngc = TRUE,
+  .id = 915,
+  .ra = 36.44,
+  .dec = 27.2209,
+},
+{ .is_ngc = TRUE,
+  .id = 916,
+  .ra = 36.4486,
+  .dec = 27.2423,
+},
+{ .is_ngc = TRUE,
+  .id = 917,
+  .ra = 36.5321,
+  .dec = 31.912,
+},
+{ .is_ngc = TRUE,
+  .id = 918,
+  .ra = 36.4618,
+  .dec = 18.4958,
+},
+{ .is_ngc = TRUE,
+  .id = 919,
+  .ra = 36.5697,
+  .dec = 27.2116,
+},
+{ .is_ngc = TRUE,
+  .id = 920,
+  .ra = 36.9663,
+  .dec = 45.9467,
+},
+{ .is_ngc = TRUE,
+  .id = 921,
+  .ra = 36.6396,
+  .dec = -15.8475,
+},
+{ .is_ngc = TRUE,
+  .id = 922,
+  .ra = 36.2692,
+  .dec = -24.7906,
+},
+{ .is_ngc = TRUE,
+  .id = 923,
+  .ra = 36.8948,
+  .dec = 41.9778,
+},
+{ .is_ngc = TRUE,
+  .id = 924,
+  .ra = 36.6947,
+  .dec = 20.4974,
+},
+{ .is_ngc = TRUE,
+  .id = 925,
+  .ra = 36.8203,
+  .dec = 33.5788,
+},
+{ .is_ngc = TRUE,
+  .id = 926,
+  .ra = 36.5282,
+  .dec = -0.332,
+},
+{ .is_ngc = TRUE,
+  .id = 927,
+  .ra = 36.6553,
+  .dec = 12.1547,
+},
+{ .is_ngc = TRUE,
+  .id = 928,
+  .ra = 36.9206,
+  .dec = 27.2206,
+},
+{ .is_ngc = TRUE,
+  .id = 929,
+  .ra = 36.8258,
+  .dec = -12.0869,
+},
+{ .is_ngc = TRUE,
+  .id = 930,
+  .ra = 36.9625,
+  .dec = 20.3347,
+},
+{ .is_ngc = TRUE,
+  .id = 931,
+  .ra = 37.061,
+  .dec = 31.3112,
+},
+{ .is_ngc = TRUE,
+  .id = 932,
+  .ra = 36.9779,
+  .dec = 20.3323,
+},
+{ .is_ngc = TRUE,
+  .id = 933,
+  .ra = 37.3232,
+  .dec = 45.911,
+},
+{ .is_ngc = TRUE,
+  .id = 934,
+  .ra = 36.8869,
+  .dec = -0.244911,
+},
+{ .is_ngc = TRUE,
+  .id = 935,
+  .ra = 37.0465,
+  .dec = 19.5993,
+},
+{ .is_ngc = TRUE,
+  .id = 936,
+  .ra = 36.9057,
+  .dec = -1.15567,
+},
+{ .is_ngc = TRUE,
+  .id = 937,
+  .ra = 37.3672,
+  .dec = 42.2499,
+},
+{ .is_ngc = TRUE,
+  .id = 938,
+  .ra = 37.1394,
+  .dec = 20.2835,
+},
+{ .is_ngc = TRUE,
+  .id = 939,
+  .ra = 36.5879,
+  .dec = -44.4461,
+},
+{ .is_ngc = TRUE,
+  .id = 940,
+  .ra = 37.3648,
+  .dec = 31.6408,
+},
+{ .is_ngc = TRUE,
+  .id = 941,
+  .ra = 37.116,
+  .dec = -1.15131,
+},
+{ .is_ngc = TRUE,
+  .id = 942,
+  .ra = 37.2926,
+  .dec = -10.8362,
+},
+{ .is_ngc = TRUE,
+  .id = 943,
+  .ra = 37.2897,
+  .dec = -10.828,
+},
+{ .is_ngc = TRUE,
+  .id = 945,
+  .ra = 37.155,
+  .dec = -10.5386,
+},
+{ .is_ngc = TRUE,
+  .id = 946,
+  .ra = 37.6604,
+  .dec = 42.2323,
+},
+{ .is_ngc = TRUE,
+  .id = 947,
+  .ra = 37.1383,
+  .dec = -19.0416,
+},
+{ .is_ngc = TRUE,
+  .id = 948,
+  .ra = 37.1887,
+  .dec = -10.5133,
+},
+{ .is_ngc = TRUE,
+  .id = 949,
+  .ra = 37.704,
+  .dec = 37.1364,
+},
+{ .is_ngc = TRUE,
+  .id = 950,
+  .ra = 37.2983,
+  .dec = -11.0253,
+},
+{ .is_ngc = TRUE,
+  .id = 951,
+  .ra = 37.2375,
+  .dec = -22.35,
+},
+{ .is_ngc = TRUE,
+  .id = 952,
+  .ra = 37.825,
+  .dec = 34.7358,
+},
+{ .is_ngc = TRUE,
+  .id = 953,
+  .ra = 37.7909,
+  .dec = 29.5886,
+},
+{ .is_ngc = TRUE,
+  .id = 954,
+  .ra = 37.2154,
+  .dec = -41.4028,
+},
+{ .is_ngc = TRUE,
+  .id = 955,
+  .ra = 37.6388,
+  .dec = -1.10844,
+},
+{ .is_ngc = TRUE,
+  .id = 956,
+  .ra = 38.1267,
+  .dec = 44.5936,
+},
+{ .is_ngc = TRUE,
+  .id = 957,
+  .ra = 38.3375,
+  .dec = 57.5517,
+},
+{ .is_ngc = TRUE,
+  .id = 958,
+  .ra = 37.6782,
+  .dec = -2.939,
+},
+{ .is_ngc = TRUE,
+  .id = 959,
+  .ra = 38.0999,
+  .dec = 35.4944,
+},
+{ .is_ngc = TRUE,
+  .id = 960,
+  .ra = 37.9221,
+  .dec = -9.30028,
+},
+{ .is_ngc = TRUE,
+  .id = 962,
+  .ra = 38.1664,
+  .dec = 28.0705,
+},
+{ .is_ngc = TRUE,
+  .id = 965,
+  .ra = 38.1046,
+  .dec = -18.64,
+},
+{ .is_ngc = TRUE,
+  .id = 966,
+  .ra = 37.9458,
+  .dec = -19.8818,
+},
+{ .is_ngc = TRUE,
+  .id = 967,
+  .ra = 38.0534,
+  .dec = -17.2168,
+},
+{ .is_ngc = TRUE,
+  .id = 968,
+  .ra = 38.5259,
+  .dec = 34.4798,
+},
+{ .is_ngc = TRUE,
+  .id = 969,
+  .ra = 38.5332,
+  .dec = 32.9467,
+},
+{ .is_ngc = TRUE,
+  .id = 970,
+  .ra = 38.5491,
+  .dec = 32.9769,
+},
+{ .is_ngc = TRUE,
+  .id = 971,
+  .ra = 38.5661,
+  .dec = 32.9792,
+},
+{ .is_ngc = TRUE,
+  .id = 972,
+  .ra = 38.5556,
+  .dec = 29.3115,
+},
+{ .is_ngc = TRUE,
+  .id = 973,
+  .ra = 38.5837,
+  .dec = 32.5048,
+},
+{ .is_ngc = TRUE,
+  .id = 974,
+  .ra = 38.6081,
+  .dec = 32.9542,
+},
+{ .is_ngc = TRUE,
+  .id = 975,
+  .ra = 38.3451,
+  .dec = 9.60167,
+},
+{ .is_ngc = TRUE,
+  .id = 976,
+  .ra = 38.4995,
+  .dec = 20.9768,
+},
+{ .is_ngc = TRUE,
+  .id = 977,
+  .ra = 38.2642,
+  .dec = -10.7597,
+},
+{ .is_ngc = TRUE,
+  .id = 979,
+  .ra = 37.9108,
+  .dec = -44.5244,
+},
+{ .is_ngc = TRUE,
+  .id = 980,
+  .ra = 38.8276,
+  .dec = 40.9264,
+},
+{ .is_ngc = TRUE,
+  .id = 981,
+  .ra = 38.2496,
+  .dec = -10.9739,
+},
+{ .is_ngc = TRUE,
+  .id = 982,
+  .ra = 38.8535,
+  .dec = 40.8693,
+},
+{ .is_ngc = TRUE,
+  .id = 984,
+  .ra = 38.6794,
+  .dec = 23.4129,
+},
+{ .is_ngc = TRUE,
+  .id = 985,
+  .ra = 38.6573,
+  .dec = -8.7878,
+},
+{ .is_ngc = TRUE,
+  .id = 986,
+  .ra = 38.3922,
+  .dec = -39.0457,
+},
+{ .is_ngc = TRUE,
+  .id = 987,
+  .ra = 39.2068,
+  .dec = 33.3269,
+},
+{ .is_ngc = TRUE,
+  .id = 988,
+  .ra = 38.8657,
+  .dec = -9.35672,
+},
+{ .is_ngc = TRUE,
+  .id = 989,
+  .ra = 38.4418,
+  .dec = -16.5115,
+},
+{ .is_ngc = TRUE,
+  .id = 990,
+  .ra = 39.076,
+  .dec = 11.6418,
+},
+{ .is_ngc = TRUE,
+  .id = 991,
+  .ra = 38.8863,
+  .dec = -7.15444,
+},
+{ .is_ngc = TRUE,
+  .id = 992,
+  .ra = 39.3562,
+  .dec = 21.1004,
+},
+{ .is_ngc = TRUE,
+  .id = 995,
+  .ra = 39.6335,
+  .dec = 41.5289,
+},
+{ .is_ngc = TRUE,
+  .id = 996,
+  .ra = 39.6658,
+  .dec = 41.6473,
+},
+{ .is_ngc = TRUE,
+  .id = 998,
+  .ra = 39.3187,
+  .dec = 7.33547,
+},
+{ .is_ngc = TRUE,
+  .id = 999,
+  .ra = 39.698,
+  .dec = 41.6705,
+},
+{ .is_ngc = TRUE,
+  .id = 1000,
+  .ra = 39.7073,
+  .dec = 41.4598,
+},
+{ .is_ngc = TRUE,
+  .id = 1001,
+  .ra = 39.8027,
+  .dec = 41.6714,
+},
+{ .is_ngc = TRUE,
+  .id = 1003,
+  .ra = 39.8192,
+  .dec = 40.8722,
+},
+{ .is_ngc = TRUE,
+  .id = 1004,
+  .ra = 39.4242,
+  .dec = 1.97472,
+},
+{ .is_ngc = TRUE,
+  .id = 1005,
+  .ra = 39.865,
+  .dec = 41.493,
+},
+{ .is_ngc = TRUE,
+  .id = 1007,
+  .ra = 39.4676,
+  .dec = 2.15525,
+},
+{ .is_ngc = TRUE,
+  .id = 1008,
+  .ra = 39.4804,
+  .dec = 2.07935,
+},
+{ .is_ngc = TRUE,
+  .id = 1009,
+  .ra = 39.5794,
+  .dec = 2.30947,
+},
+{ .is_ngc = TRUE,
+  .id = 1011,
+  .ra = 39.412,
+  .dec = -11.0059,
+},
+{ .is_ngc = TRUE,
+  .id = 1012,
+  .ra = 39.812,
+  .dec = 30.1514,
+},
+{ .is_ngc = TRUE,
+  .id = 1013,
+  .ra = 39.4603,
+  .dec = -11.5074,
+},
+{ .is_ngc = TRUE,
+  .id = 1014,
+  .ra = 39.5033,
+  .dec = -9.57278,
+},
+{ .is_ngc = TRUE,
+  .id = 1015,
+  .ra = 39.5483,
+  .dec = -1.31869,
+},
+{ .is_ngc = TRUE,
+  .id = 1016,
+  .ra = 39.5815,
+  .dec = 2.11864,
+},
+{ .is_ngc = TRUE,
+  .id = 1017,
+  .ra = 39.4579,
+  .dec = -11.0108,
+},
+{ .is_ngc = TRUE,
+  .id = 1018,
+  .ra = 39.5431,
+  .dec = -9.54478,
+},
+{ .is_ngc = TRUE,
+  .id = 1019,
+  .ra = 39.6143,
+  .dec = 1.90725,
+},
+{ .is_ngc = TRUE,
+  .id = 1020,
+  .ra = 39.6837,
+  .dec = 2.23056,
+},
+{ .is_ngc = TRUE,
+  .id = 1021,
+  .ra = 39.6996,
+  .dec = 2.21667,
+},
+{ .is_ngc = TRUE,
+  .id = 1022,
+  .ra = 39.6362,
+  .dec = -6.67761,
+},
+{ .is_ngc = TRUE,
+  .id = 1023,
+  .ra = 40.0999,
+  .dec = 39.0629,
+},
+{ .is_ngc = TRUE,
+  .id = 1024,
+  .ra = 39.7997,
+  .dec = 10.8471,
+},
+{ .is_ngc = TRUE,
+  .id = 1025,
+  .ra = 39.0829,
+  .dec = -54.8644,
+},
+{ .is_ngc = TRUE,
+  .id = 1026,
+  .ra = 39.8301,
+  .dec = 6.54386,
+},
+{ .is_ngc = TRUE,
+  .id = 1028,
+  .ra = 39.9046,
+  .dec = 10.8433,
+},
+{ .is_ngc = TRUE,
+  .id = 1029,
+  .ra = 39.902,
+  .dec = 10.793,
+},
+{ .is_ngc = TRUE,
+  .id = 1030,
+  .ra = 39.961,
+  .dec = 18.0241,
+},
+{ .is_ngc = TRUE,
+  .id = 1031,
+  .ra = 39.1612,
+  .dec = -54.8594,
+},
+{ .is_ngc = TRUE,
+  .id = 1032,
+  .ra = 39.8486,
+  .dec = 1.09331,
+},
+{ .is_ngc = TRUE,
+  .id = 1033,
+  .ra = 40.0672,
+  .dec = -8.77704,
+},
+{ .is_ngc = TRUE,
+  .id = 1034,
+  .ra = 39.5579,
+  .dec = -15.8094,
+},
+{ .is_ngc = TRUE,
+  .id = 1035,
+  .ra = 39.871,
+  .dec = -8.13281,
+},
+{ .is_ngc = TRUE,
+  .id = 1037,
+  .ra = 39.9917,
+  .dec = -1.73333,
+},
+{ .is_ngc = TRUE,
+  .id = 1037,
+  .ra = 39.4946,
+  .dec = -1.84395,
+},
+{ .is_ngc = TRUE,
+  .id = 1038,
+  .ra = 40.0263,
+  .dec = 1.5085,
+},
+{ .is_ngc = TRUE,
+  .id = 1039,
+  .ra = 40.5208,
+  .dec = 42.7519,
+},
+{ .is_ngc = TRUE,
+  .id = 1041,
+  .ra = 40.1052,
+  .dec = -5.4404,
+},
+{ .is_ngc = TRUE,
+  .id = 1042,
+  .ra = 40.0993,
+  .dec = -8.43367,
+},
+{ .is_ngc = TRUE,
+  .id = 1043,
+  .ra = 40.1937,
+  .dec = 1.34253,
+},
+{ .is_ngc = TRUE,
+  .id = 1045,
+  .ra = 40.1212,
+  .dec = -11.2781,
+},
+{ .is_ngc = TRUE,
+  .id = 1046,
+  .ra = 40.3032,
+  .dec = 8.71932,
+},
+{ .is_ngc = TRUE,
+  .id = 1047,
+  .ra = 40.1362,
+  .dec = -8.14694,
+},
+{ .is_ngc = TRUE,
+  .id = 1049,
+  .ra = 39.9515,
+  .dec = -34.2578,
+},
+{ .is_ngc = TRUE,
+  .id = 1050,
+  .ra = 40.6483,
+  .dec = 34.7631,
+},
+{ .is_ngc = TRUE,
+  .id = 1052,
+  .ra = 40.2699,
+  .dec = -8.25564,
+},
+{ .is_ngc = TRUE,
+  .id = 1054,
+  .ra = 40.5657,
+  .dec = 18.2174,
+},
+{ .is_ngc = TRUE,
+  .id = 1055,
+  .ra = 40.4385,
+  .dec = 0.442389,
+},
+{ .is_ngc = TRUE,
+  .id = 1056,
+  .ra = 40.7022,
+  .dec = 28.574,
+},
+{ .is_ngc = TRUE,
+  .id = 1057,
+  .ra = 40.7623,
+  .dec = 32.4912,
+},
+{ .is_ngc = TRUE,
+  .id = 1058,
+  .ra = 40.8747,
+  .dec = 37.3411,
+},
+{ .is_ngc = TRUE,
+  .id = 1059,
+  .ra = 40.6479,
+  .dec = 17.9958,
+},
+{ .is_ngc = TRUE,
+  .id = 1060,
+  .ra = 40.813,
+  .dec = 32.4248,
+},
+{ .is_ngc = TRUE,
+  .id = 1061,
+  .ra = 40.816,
+  .dec = 32.4667,
+},
+{ .is_ngc = TRUE,
+  .id = 1062,
+  .ra = 40.8501,
+  .dec = 32.4621,
+},
+{ .is_ngc = TRUE,
+  .id = 1063,
+  .ra = 40.5408,
+  .dec = -5.56861,
+},
+{ .is_ngc = TRUE,
+  .id = 1064,
+  .ra = 40.5975,
+  .dec = -9.36294,
+},
+{ .is_ngc = TRUE,
+  .id = 1065,
+  .ra = 40.526,
+  .dec = -15.0918,
+},
+{ .is_ngc = TRUE,
+  .id = 1066,
+  .ra = 40.9582,
+  .dec = 32.4747,
+},
+{ .is_ngc = TRUE,
+  .id = 1067,
+  .ra = 40.9607,
+  .dec = 32.5116,
+},
+{ .is_ngc = TRUE,
+  .id = 1068,
+  .ra = 40.6695,
+  .dec = -0.0133722,
+},
+{ .is_ngc = TRUE,
+  .id = 1069,
+  .ra = 40.75,
+  .dec = -8.28917,
+},
+{ .is_ngc = TRUE,
+  .id = 1070,
+  .ra = 40.8428,
+  .dec = 4.96797,
+},
+{ .is_ngc = TRUE,
+  .id = 1071,
+  .ra = 40.7833,
+  .dec = -8.77444,
+},
+{ .is_ngc = TRUE,
+  .id = 1073,
+  .ra = 40.9187,
+  .dec = 1.37586,
+},
+{ .is_ngc = TRUE,
+  .id = 1074,
+  .ra = 40.9,
+  .dec = -16.2969,
+},
+{ .is_ngc = TRUE,
+  .id = 1075,
+  .ra = 40.8897,
+  .dec = -16.2014,
+},
+{ .is_ngc = TRUE,
+  .id = 1076,
+  .ra = 40.8708,
+  .dec = -14.7547,
+},
+{ .is_ngc = TRUE,
+  .id = 1078,
+  .ra = 41.0334,
+  .dec = -9.45277,
+},
+{ .is_ngc = TRUE,
+  .id = 1079,
+  .ra = 40.9355,
+  .dec = -29.0034,
+},
+{ .is_ngc = TRUE,
+  .id = 1080,
+  .ra = 41.2915,
+  .dec = -4.71089,
+},
+{ .is_ngc = TRUE,
+  .id = 1081,
+  .ra = 41.2725,
+  .dec = -15.5878,
+},
+{ .is_ngc = TRUE,
+  .id = 1082,
+  .ra = 41.4218,
+  .dec = -8.1807,
+},
+{ .is_ngc = TRUE,
+  .id = 1083,
+  .ra = 41.4196,
+  .dec = -15.3575,
+},
+{ .is_ngc = TRUE,
+  .id = 1084,
+  .ra = 41.4992,
+  .dec = -7.57722,
+},
+{ .is_ngc = TRUE,
+  .id = 1085,
+  .ra = 41.6058,
+  .dec = 3.60691,
+},
+{ .is_ngc = TRUE,
+  .id = 1086,
+  .ra = 41.9845,
+  .dec = 41.246,
+},
+{ .is_ngc = TRUE,
+  .id = 1087,
+  .ra = 41.605,
+  .dec = -0.498833,
+},
+{ .is_ngc = TRUE,
+  .id = 1088,
+  .ra = 41.7668,
+  .dec = 16.1999,
+},
+{ .is_ngc = TRUE,
+  .id = 1089,
+  .ra = 41.5421,
+  .dec = -15.0736,
+},
+{ .is_ngc = TRUE,
+  .id = 1090,
+  .ra = 41.6415,
+  .dec = -0.247333,
+},
+{ .is_ngc = TRUE,
+  .id = 1091,
+  .ra = 41.3437,
+  .dec = -17.5336,
+},
+{ .is_ngc = TRUE,
+  .id = 1092,
+  .ra = 41.3734,
+  .dec = -17.5424,
+},
+{ .is_ngc = TRUE,
+  .id = 1093,
+  .ra = 42.0675,
+  .dec = 34.4196,
+},
+{ .is_ngc = TRUE,
+  .id = 1094,
+  .ra = 41.8656,
+  .dec = -0.285083,
+},
+{ .is_ngc = TRUE,
+  .id = 1095,
+  .ra = 41.9075,
+  .dec = 4.63739,
+},
+{ .is_ngc = TRUE,
+  .id = 1096,
+  .ra = 40.955,
+  .dec = -59.9133,
+},
+{ .is_ngc = TRUE,
+  .id = 1097,
+  .ra = 41.5793,
+  .dec = -30.2747,
+},
+{ .is_ngc = TRUE,
+  .id = 1098,
+  .ra = 41.2238,
+  .dec = -17.6596,
+},
+{ .is_ngc = TRUE,
+  .id = 1099,
+  .ra = 41.3244,
+  .dec = -17.7086,
+},
+{ .is_ngc = TRUE,
+  .id = 1100,
+  .ra = 41.3998,
+  .dec = -17.6885,
+},
+{ .is_ngc = TRUE,
+  .id = 1101,
+  .ra = 42.0618,
+  .dec = 4.57788,
+},
+{ .is_ngc = TRUE,
+  .id = 1102,
+  .ra = 41.8029,
+  .dec = -22.2086,
+},
+{ .is_ngc = TRUE,
+  .id = 1103,
+  .ra = 42.025,
+  .dec = -13.9597,
+},
+{ .is_ngc = TRUE,
+  .id = 1104,
+  .ra = 42.1611,
+  .dec = -0.271556,
+},
+{ .is_ngc = TRUE,
+  .id = 1106,
+  .ra = 42.6688,
+  .dec = 41.6717,
+},
+{ .is_ngc = TRUE,
+  .id = 1107,
+  .ra = 42.332,
+  .dec = 8.09264,
+},
+{ .is_ngc = TRUE,
+  .id = 1108,
+  .ra = 42.1604,
+  .dec = -7.95083,
+},
+{ .is_ngc = TRUE,
+  .id = 1110,
+  .ra = 42.2896,
+  .dec = -7.83833,
+},
+{ .is_ngc = TRUE,
+  .id = 1113,
+  .ra = 42.521,
+  .dec = 13.3274,
+},
+{ .is_ngc = TRUE,
+  .id = 1114,
+  .ra = 42.2796,
+  .dec = -16.9933,
+},
+{ .is_ngc = TRUE,
+  .id = 1115,
+  .ra = 42.6057,
+  .dec = 13.2662,
+},
+{ .is_ngc = TRUE,
+  .id = 1116,
+  .ra = 42.649,
+  .dec = 13.3346,
+},
+{ .is_ngc = TRUE,
+  .id = 1117,
+  .ra = 42.8047,
+  .dec = 13.1853,
+},
+{ .is_ngc = TRUE,
+  .id = 1118,
+  .ra = 42.4946,
+  .dec = -12.1642,
+},
+{ .is_ngc = TRUE,
+  .id = 1119,
+  .ra = 42.0712,
+  .dec = -17.9877,
+},
+{ .is_ngc = TRUE,
+  .id = 1121,
+  .ra = 42.663,
+  .dec = -1.73386,
+},
+{ .is_ngc = TRUE,
+  .id = 1124,
+  .ra = 42.8996,
+  .dec = -25.7008,
+},
+{ .is_ngc = TRUE,
+  .id = 1126,
+  .ra = 43.0779,
+  .dec = -1.29611,
+},
+{ .is_ngc = TRUE,
+  .id = 1127,
+  .ra = 43.2162,
+  .dec = 13.2565,
+},
+{ .is_ngc = TRUE,
+  .id = 1129,
+  .ra = 43.6141,
+  .dec = 41.5794,
+},
+{ .is_ngc = TRUE,
+  .id = 1130,
+  .ra = 43.6018,
+  .dec = 41.6055,
+},
+{ .is_ngc = TRUE,
+  .id = 1130,
+  .ra = 43.6267,
+  .dec = 41.6105,
+},
+{ .is_ngc = TRUE,
+  .id = 1131,
+  .ra = 43.6416,
+  .dec = 41.5588,
+},
+{ .is_ngc = TRUE,
+  .id = 1132,
+  .ra = 43.2157,
+  .dec = -1.27497,
+},
+{ .is_ngc = TRUE,
+  .id = 1133,
+  .ra = 43.1758,
+  .dec = -8.80444,
+},
+{ .is_ngc = TRUE,
+  .id = 1134,
+  .ra = 43.4216,
+  .dec = 13.0145,
+},
+{ .is_ngc = TRUE,
+  .id = 1135,
+  .ra = 42.6967,
+  .dec = -54.9289,
+},
+{ .is_ngc = TRUE,
+  .id = 1136,
+  .ra = 42.7242,
+  .dec = -54.9756,
+},
+{ .is_ngc = TRUE,
+  .id = 1137,
+  .ra = 43.5112,
+  .dec = 2.96172,
+},
+{ .is_ngc = TRUE,
+  .id = 1138,
+  .ra = 44.1515,
+  .dec = 43.0472,
+},
+{ .is_ngc = TRUE,
+  .id = 1139,
+  .ra = 43.195,
+  .dec = -14.5295,
+},
+{ .is_ngc = TRUE,
+  .id = 1140,
+  .ra = 43.6396,
+  .dec = -10.0281,
+},
+{ .is_ngc = TRUE,
+  .id = 1145,
+  .ra = 43.6392,
+  .dec = -18.6358,
+},
+{ .is_ngc = TRUE,
+  .id = 1146,
+  .ra = 44.4042,
+  .dec = 46.4183,
+},
+{ .is_ngc = TRUE,
+  .id = 1146,
+  .ra = 44.4038,
+  .dec = 46.4375,
+},
+{ .is_ngc = TRUE,
+  .id = 1147,
+  .ra = 43.7875,
+  .dec = -9.11722,
+},
+{ .is_ngc = TRUE,
+  .id = 1148,
+  .ra = 44.2683,
+  .dec = -7.686,
+},
+{ .is_ngc = TRUE,
+  .id = 1149,
+  .ra = 44.3494,
+  .dec = -0.309525,
+},
+{ .is_ngc = TRUE,
+  .id = 1150,
+  .ra = 44.2555,
+  .dec = -15.0486,
+},
+{ .is_ngc = TRUE,
+  .id = 1151,
+  .ra = 44.2691,
+  .dec = -15.0133,
+},
+{ .is_ngc = TRUE,
+  .id = 1152,
+  .ra = 44.39,
+  .dec = -7.75917,
+},
+{ .is_ngc = TRUE,
+  .id = 1153,
+  .ra = 44.5434,
+  .dec = 3.36161,
+},
+{ .is_ngc = TRUE,
+  .id = 1154,
+  .ra = 44.5317,
+  .dec = -10.3636,
+},
+{ .is_ngc = TRUE,
+  .id = 1155,
+  .ra = 44.5542,
+  .dec = -10.3503,
+},
+{ .is_ngc = TRUE,
+  .id = 1156,
+  .ra = 44.9267,
+  .dec = 25.2379,
+},
+{ .is_ngc = TRUE,
+  .id = 1157,
+  .ra = 44.5275,
+  .dec = -15.1189,
+},
+{ .is_ngc = TRUE,
+  .id = 1158,
+  .ra = 44.2977,
+  .dec = -14.3957,
+},
+{ .is_ngc = TRUE,
+  .id = 1159,
+  .ra = 45.1936,
+  .dec = 43.1625,
+},
+{ .is_ngc = TRUE,
+  .id = 1160,
+  .ra = 45.3057,
+  .dec = 44.9548,
+},
+{ .is_ngc = TRUE,
+  .id = 1161,
+  .ra = 45.3091,
+  .dec = 44.8971,
+},
+{ .is_ngc = TRUE,
+  .id = 1162,
+  .ra = 44.7329,
+  .dec = -12.3986,
+},
+{ .is_ngc = TRUE,
+  .id = 1163,
+  .ra = 45.0912,
+  .dec = -17.1528,
+},
+{ .is_ngc = TRUE,
+  .id = 1164,
+  .ra = 45.4992,
+  .dec = 42.5851,
+},
+{ .is_ngc = TRUE,
+  .id = 1165,
+  .ra = 44.6979,
+  .dec = -32.0986,
+},
+{ .is_ngc = TRUE,
+  .id = 1166,
+  .ra = 45.1458,
+  .dec = 11.8424,
+},
+{ .is_ngc = TRUE,
+  .id = 1167,
+  .ra = 45.4264,
+  .dec = 35.2054,
+},
+{ .is_ngc = TRUE,
+  .id = 1168,
+  .ra = 45.196,
+  .dec = 11.7721,
+},
+{ .is_ngc = TRUE,
+  .id = 1169,
+  .ra = 45.8949,
+  .dec = 46.3856,
+},
+{ .is_ngc = TRUE,
+  .id = 1170,
+  .ra = 45.6083,
+  .dec = 27.0678,
+},
+{ .is_ngc = TRUE,
+  .id = 1171,
+  .ra = 45.9955,
+  .dec = 43.3982,
+},
+{ .is_ngc = TRUE,
+  .id = 1172,
+  .ra = 45.4,
+  .dec = -14.8364,
+},
+{ .is_ngc = TRUE,
+  .id = 1173,
+  .ra = 45.9904,
+  .dec = 42.3836,
+},
+{ .is_ngc = TRUE,
+  .id = 1175,
+  .ra = 46.1353,
+  .dec = 42.3396,
+},
+{ .is_ngc = TRUE,
+  .id = 1176,
+  .ra = 46.1454,
+  .dec = 42.3933,
+},
+{ .is_ngc = TRUE,
+  .id = 1178,
+  .ra = 46.1618,
+  .dec = 42.3135,
+},
+{ .is_ngc = TRUE,
+  .id = 1179,
+  .ra = 45.66,
+  .dec = -18.8983,
+},
+{ .is_ngc = TRUE,
+  .id = 1180,
+  .ra = 45.4627,
+  .dec = -15.0303,
+},
+{ .is_ngc = TRUE,
+  .id = 1181,
+  .ra = 45.4283,
+  .dec = -15.0528,
+},
+{ .is_ngc = TRUE,
+  .id = 1183,
+  .ra = 46.1923,
+  .dec = 42.3689,
+},
+{ .is_ngc = TRUE,
+  .id = 1184,
+  .ra = 49.1881,
+  .dec = 80.7929,
+},
+{ .is_ngc = TRUE,
+  .id = 1185,
+  .ra = 45.7475,
+  .dec = -9.13278,
+},
+{ .is_ngc = TRUE,
+  .id = 1187,
+  .ra = 45.6565,
+  .dec = -22.8675,
+},
+{ .is_ngc = TRUE,
+  .id = 1188,
+  .ra = 45.9309,
+  .dec = -15.4849,
+},
+{ .is_ngc = TRUE,
+  .id = 1189,
+  .ra = 45.8512,
+  .dec = -15.6234,
+},
+{ .is_ngc = TRUE,
+  .id = 1190,
+  .ra = 45.8588,
+  .dec = -15.6623,
+},
+{ .is_ngc = TRUE,
+  .id = 1191,
+  .ra = 45.8787,
+  .dec = -15.6856,
+},
+{ .is_ngc = TRUE,
+  .id = 1192,
+  .ra = 45.8945,
+  .dec = -15.679,
+},
+{ .is_ngc = TRUE,
+  .id = 1193,
+  .ra = 46.4792,
+  .dec = 44.3833,
+},
+{ .is_ngc = TRUE,
+  .id = 1194,
+  .ra = 45.955,
+  .dec = -1.10378,
+},
+{ .is_ngc = TRUE,
+  .id = 1195,
+  .ra = 45.8868,
+  .dec = -12.0397,
+},
+{ .is_ngc = TRUE,
+  .id = 1196,
+  .ra = 45.8968,
+  .dec = -12.0762,
+},
+{ .is_ngc = TRUE,
+  .id = 1197,
+  .ra = 46.5583,
+  .dec = 44.0519,
+},
+{ .is_ngc = TRUE,
+  .id = 1199,
+  .ra = 45.9104,
+  .dec = -15.614,
+},
+{ .is_ngc = TRUE,
+  .id = 1200,
+  .ra = 45.9772,
+  .dec = -11.9919,
+},
+{ .is_ngc = TRUE,
+  .id = 1201,
+  .ra = 46.0329,
+  .dec = -26.0694,
+},
+{ .is_ngc = TRUE,
+  .id = 1202,
+  .ra = 46.2603,
+  .dec = -6.49214,
+},
+{ .is_ngc = TRUE,
+  .id = 1203,
+  .ra = 46.309,
+  .dec = -14.3809,
+},
+{ .is_ngc = TRUE,
+  .id = 1204,
+  .ra = 46.1668,
+  .dec = -12.3417,
+},
+{ .is_ngc = TRUE,
+  .id = 1206,
+  .ra = 46.5406,
+  .dec = -8.83321,
+},
+{ .is_ngc = TRUE,
+  .id = 1207,
+  .ra = 47.064,
+  .dec = 38.3821,
+},
+{ .is_ngc = TRUE,
+  .id = 1208,
+  .ra = 46.5492,
+  .dec = -9.54111,
+},
+{ .is_ngc = TRUE,
+  .id = 1209,
+  .ra = 46.5125,
+  .dec = -15.6114,
+},
+{ .is_ngc = TRUE,
+  .id = 1210,
+  .ra = 46.6887,
+  .dec = -25.7181,
+},
+{ .is_ngc = TRUE,
+  .id = 1211,
+  .ra = 46.7185,
+  .dec = -0.795083,
+},
+{ .is_ngc = TRUE,
+  .id = 1214,
+  .ra = 46.7334,
+  .dec = -9.54464,
+},
+{ .is_ngc = TRUE,
+  .id = 1215,
+  .ra = 46.79,
+  .dec = -9.59344,
+},
+{ .is_ngc = TRUE,
+  .id = 1216,
+  .ra = 46.8272,
+  .dec = -9.61272,
+},
+{ .is_ngc = TRUE,
+  .id = 1217,
+  .ra = 46.5262,
+  .dec = -39.0358,
+},
+{ .is_ngc = TRUE,
+  .id = 1218,
+  .ra = 47.1094,
+  .dec = 4.11102,
+},
+{ .is_ngc = TRUE,
+  .id = 1219,
+  .ra = 47.1168,
+  .dec = 2.10811,
+},
+{ .is_ngc = TRUE,
+  .id = 1220,
+  .ra = 47.9167,
+  .dec = 53.3353,
+},
+{ .is_ngc = TRUE,
+  .id = 1221,
+  .ra = 47.065,
+  .dec = -4.25972,
+},
+{ .is_ngc = TRUE,
+  .id = 1222,
+  .ra = 47.2367,
+  .dec = -2.955,
+},
+{ .is_ngc = TRUE,
+  .id = 1223,
+  .ra = 47.0829,
+  .dec = -4.13861,
+},
+{ .is_ngc = TRUE,
+  .id = 1224,
+  .ra = 47.8066,
+  .dec = 41.3633,
+},
+{ .is_ngc = TRUE,
+  .id = 1225,
+  .ra = 47.1971,
+  .dec = -4.10167,
+},
+{ .is_ngc = TRUE,
+  .id = 1226,
+  .ra = 47.7725,
+  .dec = 35.3865,
+},
+{ .is_ngc = TRUE,
+  .id = 1227,
+  .ra = 47.7822,
+  .dec = 35.3244,
+},
+{ .is_ngc = TRUE,
+  .id = 1228,
+  .ra = 47.0487,
+  .dec = -22.9229,
+},
+{ .is_ngc = TRUE,
+  .id = 1229,
+  .ra = 47.0457,
+  .dec = -22.9607,
+},
+{ .is_ngc = TRUE,
+  .id = 1230,
+  .ra = 47.0677,
+  .dec = -22.9842,
+},
+{ .is_ngc = TRUE,
+  .id = 1231,
+  .ra = 46.6221,
+  .dec = -15.5694,
+},
+{ .is_ngc = TRUE,
+  .id = 1232,
+  .ra = 47.4387,
+  .dec = -20.5796,
+},
+{ .is_ngc = TRUE,
+  .id = 1234,
+  .ra = 47.4128,
+  .dec = -7.8465,
+},
+{ .is_ngc = TRUE,
+  .id = 1236,
+  .ra = 47.8667,
+  .dec = 10.8083,
+},
+{ .is_ngc = TRUE,
+  .id = 1237,
+  .ra = 47.5375,
+  .dec = -8.69222,
+},
+{ .is_ngc = TRUE,
+  .id = 1238,
+  .ra = 47.7194,
+  .dec = -10.7479,
+},
+{ .is_ngc = TRUE,
+  .id = 1239,
+  .ra = 47.7239,
+  .dec = -2.55332,
+},
+{ .is_ngc = TRUE,
+  .id = 1240,
+  .ra = 48.3613,
+  .dec = 30.5069,
+},
+{ .is_ngc = TRUE,
+  .id = 1241,
+  .ra = 47.8115,
+  .dec = -8.92242,
+},
+{ .is_ngc = TRUE,
+  .id = 1242,
+  .ra = 47.8306,
+  .dec = -8.90267,
+},
+{ .is_ngc = TRUE,
+  .id = 1243,
+  .ra = 47.8562,
+  .dec = -8.94556,
+},
+{ .is_ngc = TRUE,
+  .id = 1244,
+  .ra = 46.6275,
+  .dec = -66.7756,
+},
+{ .is_ngc = TRUE,
+  .id = 1245,
+  .ra = 48.675,
+  .dec = 47.2339,
+},
+{ .is_ngc = TRUE,
+  .id = 1246,
+  .ra = 46.7571,
+  .dec = -66.9378,
+},
+{ .is_ngc = TRUE,
+  .id = 1247,
+  .ra = 48.0592,
+  .dec = -10.4808,
+},
+{ .is_ngc = TRUE,
+  .id = 1248,
+  .ra = 48.2021,
+  .dec = -5.22472,
+},
+{ .is_ngc = TRUE,
+  .id = 1249,
+  .ra = 47.5049,
+  .dec = -53.3361,
+},
+{ .is_ngc = TRUE,
+  .id = 1250,
+  .ra = 48.8381,
+  .dec = 41.3551,
+},
+{ .is_ngc = TRUE,
+  .id = 1251,
+  .ra = 48.538,
+  .dec = 1.45644,
+},
+{ .is_ngc = TRUE,
+  .id = 1252,
+  .ra = 47.6833,
+  .dec = -57.7514,
+},
+{ .is_ngc = TRUE,
+  .id = 1252,
+  .ra = 47.6542,
+  .dec = -58.1808,
+},
+{ .is_ngc = TRUE,
+  .id = 1253,
+  .ra = 48.5383,
+  .dec = -2.82278,
+},
+{ .is_ngc = TRUE,
+  .id = 1254,
+  .ra = 48.5992,
+  .dec = 2.6775,
+},
+{ .is_ngc = TRUE,
+  .id = 1255,
+  .ra = 48.3829,
+  .dec = -25.7247,
+},
+{ .is_ngc = TRUE,
+  .id = 1256,
+  .ra = 48.4929,
+  .dec = -21.9864,
+},
+{ .is_ngc = TRUE,
+  .id = 1257,
+  .ra = 49.2479,
+  .dec = 41.5289,
+},
+{ .is_ngc = TRUE,
+  .id = 1258,
+  .ra = 48.5213,
+  .dec = -21.7744,
+},
+{ .is_ngc = TRUE,
+  .id = 1259,
+  .ra = 49.3217,
+  .dec = 41.3858,
+},
+{ .is_ngc = TRUE,
+  .id = 1260,
+  .ra = 49.3638,
+  .dec = 41.405,
+},
+{ .is_ngc = TRUE,
+  .id = 1261,
+  .ra = 48.0655,
+  .dec = -55.2159,
+},
+{ .is_ngc = TRUE,
+  .id = 1262,
+  .ra = 48.89,
+  .dec = -15.88,
+},
+{ .is_ngc = TRUE,
+  .id = 1263,
+  .ra = 48.9146,
+  .dec = -15.0986,
+},
+{ .is_ngc = TRUE,
+  .id = 1264,
+  .ra = 49.4982,
+  .dec = 41.5201,
+},
+{ .is_ngc = TRUE,
+  .id = 1265,
+  .ra = 49.5657,
+  .dec = 41.8577,
+},
+{ .is_ngc = TRUE,
+  .id = 1266,
+  .ra = 49.0029,
+  .dec = -2.42694,
+},
+{ .is_ngc = TRUE,
+  .id = 1267,
+  .ra = 49.687,
+  .dec = 41.4676,
+},
+{ .is_ngc = TRUE,
+  .id = 1268,
+  .ra = 49.6885,
+  .dec = 41.4887,
+},
+{ .is_ngc = TRUE,
+  .id = 1270,
+  .ra = 49.7425,
+  .dec = 41.4701,
+},
+{ .is_ngc = TRUE,
+  .id = 1271,
+  .ra = 49.7971,
+  .dec = 41.3529,
+},
+{ .is_ngc = TRUE,
+  .id = 1272,
+  .ra = 49.8387,
+  .dec = 41.4906,
+},
+{ .is_ngc = TRUE,
+  .id = 1273,
+  .ra = 49.8617,
+  .dec = 41.5401,
+},
+{ .is_ngc = TRUE,
+  .id = 1274,
+  .ra = 49.9193,
+  .dec = 41.549,
+},
+{ .is_ngc = TRUE,
+  .id = 1275,
+  .ra = 49.951,
+  .dec = 41.5117,
+},
+{ .is_ngc = TRUE,
+  .id = 1276,
+  .ra = 49.9633,
+  .dec = 41.6419,
+},
+{ .is_ngc = TRUE,
+  .id = 1277,
+  .ra = 49.9649,
+  .dec = 41.5734,
+},
+{ .is_ngc = TRUE,
+  .id = 1279,
+  .ra = 49.9955,
+  .dec = 41.4796,
+},
+{ .is_ngc = TRUE,
+  .id = 1280,
+  .ra = 49.4879,
+  .dec = -0.169778,
+},
+{ .is_ngc = TRUE,
+  .id = 1281,
+  .ra = 50.0255,
+  .dec = 41.6296,
+},
+{ .is_ngc = TRUE,
+  .id = 1282,
+  .ra = 50.0505,
+  .dec = 41.3669,
+},
+{ .is_ngc = TRUE,
+  .id = 1283,
+  .ra = 50.0645,
+  .dec = 41.3983,
+},
+{ .is_ngc = TRUE,
+  .id = 1284,
+  .ra = 49.4396,
+  .dec = -10.289,
+},
+{ .is_ngc = TRUE,
+  .id = 1285,
+  .ra = 49.4725,
+  .dec = -7.29806,
+},
+{ .is_ngc = TRUE,
+  .id = 1286,
+  .ra = 49.4524,
+  .dec = -7.61713,
+},
+{ .is_ngc = TRUE,
+  .id = 1287,
+  .ra = 49.6392,
+  .dec = -2.73083,
+},
+{ .is_ngc = TRUE,
+  .id = 1288,
+  .ra = 49.3058,
+  .dec = -32.5767,
+},
+{ .is_ngc = TRUE,
+  .id = 1290,
+  .ra = 49.8549,
+  .dec = -13.9897,
+},
+{ .is_ngc = TRUE,
+  .id = 1292,
+  .ra = 49.5621,
+  .dec = -27.6106,
+},
+{ .is_ngc = TRUE,
+  .id = 1293,
+  .ra = 50.4022,
+  .dec = 41.3926,
+},
+{ .is_ngc = TRUE,
+  .id = 1294,
+  .ra = 50.4167,
+  .dec = 41.3602,
+},
+{ .is_ngc = TRUE,
+  .id = 1295,
+  .ra = 50.0137,
+  .dec = -13.9983,
+},
+{ .is_ngc = TRUE,
+  .id = 1296,
+  .ra = 49.7071,
+  .dec = -13.0625,
+},
+{ .is_ngc = TRUE,
+  .id = 1297,
+  .ra = 49.8092,
+  .dec = -19.1,
+},
+{ .is_ngc = TRUE,
+  .id = 1298,
+  .ra = 50.0543,
+  .dec = -2.11378,
+},
+{ .is_ngc = TRUE,
+  .id = 1299,
+  .ra = 50.0404,
+  .dec = -6.26167,
+},
+{ .is_ngc = TRUE,
+  .id = 1300,
+  .ra = 49.9204,
+  .dec = -19.4115,
+},
+{ .is_ngc = TRUE,
+  .id = 1301,
+  .ra = 50.1471,
+  .dec = -18.7158,
+},
+{ .is_ngc = TRUE,
+  .id = 1302,
+  .ra = 49.9621,
+  .dec = -26.0606,
+},
+{ .is_ngc = TRUE,
+  .id = 1303,
+  .ra = 50.1701,
+  .dec = -7.39474,
+},
+{ .is_ngc = TRUE,
+  .id = 1305,
+  .ra = 50.3462,
+  .dec = -2.31708,
+},
+{ .is_ngc = TRUE,
+  .id = 1306,
+  .ra = 50.2625,
+  .dec = -25.5125,
+},
+{ .is_ngc = TRUE,
+  .id = 1308,
+  .ra = 50.6187,
+  .dec = -2.75722,
+},
+{ .is_ngc = TRUE,
+  .id = 1309,
+  .ra = 50.5267,
+  .dec = -15.4002,
+},
+{ .is_ngc = TRUE,
+  .id = 1310,
+  .ra = 50.2651,
+  .dec = -37.1019,
+},
+{ .is_ngc = TRUE,
+  .id = 1311,
+  .ra = 50.0279,
+  .dec = -52.1872,
+},
+{ .is_ngc = TRUE,
+  .id = 1312,
+  .ra = 50.9239,
+  .dec = 1.18467,
+},
+{ .is_ngc = TRUE,
+  .id = 1313,
+  .ra = 49.5655,
+  .dec = -66.4977,
+},
+{ .is_ngc = TRUE,
+  .id = 1314,
+  .ra = 50.6714,
+  .dec = -4.187,
+},
+{ .is_ngc = TRUE,
+  .id = 1315,
+  .ra = 50.7774,
+  .dec = -21.3753,
+},
+{ .is_ngc = TRUE,
+  .id = 1316,
+  .ra = 50.6737,
+  .dec = -37.2083,
+},
+{ .is_ngc = TRUE,
+  .id = 1319,
+  .ra = 50.9842,
+  .dec = -21.5275,
+},
+{ .is_ngc = TRUE,
+  .id = 1320,
+  .ra = 51.2025,
+  .dec = -3.04222,
+},
+{ .is_ngc = TRUE,
+  .id = 1321,
+  .ra = 51.2029,
+  .dec = -3.01556,
+},
+{ .is_ngc = TRUE,
+  .id = 1322,
+  .ra = 51.2278,
+  .dec = -2.9192,
+},
+{ .is_ngc = TRUE,
+  .id = 1323,
+  .ra = 51.2335,
+  .dec = -2.82204,
+},
+{ .is_ngc = TRUE,
+  .id = 1324,
+  .ra = 51.2575,
+  .dec = -5.74556,
+},
+{ .is_ngc = TRUE,
+  .id = 1325,
+  .ra = 51.105,
+  .dec = -21.5444,
+},
+{ .is_ngc = TRUE,
+  .id = 1326,
+  .ra = 50.9846,
+  .dec = -36.4642,
+},
+{ .is_ngc = TRUE,
+  .id = 1327,
+  .ra = 51.3473,
+  .dec = -25.6798,
+},
+{ .is_ngc = TRUE,
+  .id = 1327,
+  .ra = 51.1992,
+  .dec = -25.64,
+},
+{ .is_ngc = TRUE,
+  .id = 1328,
+  .ra = 51.4127,
+  .dec = -4.12491,
+},
+{ .is_ngc = TRUE,
+  .id = 1329,
+  .ra = 51.51,
+  .dec = -17.5914,
+},
+{ .is_ngc = TRUE,
+  .id = 1330,
+  .ra = 52.2675,
+  .dec = 41.6753,
+},
+{ .is_ngc = TRUE,
+  .id = 1332,
+  .ra = 51.5709,
+  .dec = -21.3343,
+},
+{ .is_ngc = TRUE,
+  .id = 1334,
+  .ra = 52.5072,
+  .dec = 41.8323,
+},
+{ .is_ngc = TRUE,
+  .id = 1335,
+  .ra = 52.5812,
+  .dec = 41.5728,
+},
+{ .is_ngc = TRUE,
+  .id = 1336,
+  .ra = 51.6333,
+  .dec = -35.7128,
+},
+{ .is_ngc = TRUE,
+  .id = 1337,
+  .ra = 52.024,
+  .dec = -8.38936,
+},
+{ .is_ngc = TRUE,
+  .id = 1338,
+  .ra = 52.2267,
+  .dec = -12.1533,
+},
+{ .is_ngc = TRUE,
+  .id = 1339,
+  .ra = 52.0271,
+  .dec = -32.2856,
+},
+{ .is_ngc = TRUE,
+  .id = 1341,
+  .ra = 51.9925,
+  .dec = -37.1486,
+},
+{ .is_ngc = TRUE,
+  .id = 1342,
+  .ra = 52.9083,
+  .dec = 37.3683,
+},
+{ .is_ngc = TRUE,
+  .id = 1343,
+  .ra = 54.4576,
+  .dec = 72.5712,
+},
+{ .is_ngc = TRUE,
+  .id = 1345,
+  .ra = 52.3821,
+  .dec = -17.7789,
+},
+{ .is_ngc = TRUE,
+  .id = 1346,
+  .ra = 52.5551,
+  .dec = -5.54319,
+},
+{ .is_ngc = TRUE,
+  .id = 1347,
+  .ra = 52.4241,
+  .dec = -22.2791,
+},
+{ .is_ngc = TRUE,
+  .id = 1348,
+  .ra = 53.525,
+  .dec = 51.4014,
+},
+{ .is_ngc = TRUE,
+  .id = 1349,
+  .ra = 52.8646,
+  .dec = 4.38076,
+},
+{ .is_ngc = TRUE,
+  .id = 1350,
+  .ra = 52.7839,
+  .dec = -33.6285,
+},
+{ .is_ngc = TRUE,
+  .id = 1351,
+  .ra = 52.6454,
+  .dec = -34.8536,
+},
+{ .is_ngc = TRUE,
+  .id = 1352,
+  .ra = 52.8873,
+  .dec = -19.2783,
+},
+{ .is_ngc = TRUE,
+  .id = 1353,
+  .ra = 53.0129,
+  .dec = -20.8183,
+},
+{ .is_ngc = TRUE,
+  .id = 1354,
+  .ra = 53.1217,
+  .dec = -15.2217,
+},
+{ .is_ngc = TRUE,
+  .id = 1355,
+  .ra = 53.3479,
+  .dec = -4.99889,
+},
+{ .is_ngc = TRUE,
+  .id = 1356,
+  .ra = 52.6697,
+  .dec = -50.3093,
+},
+{ .is_ngc = TRUE,
+  .id = 1357,
+  .ra = 53.3217,
+  .dec = -13.6642,
+},
+{ .is_ngc = TRUE,
+  .id = 1358,
+  .ra = 53.4152,
+  .dec = -5.08965,
+},
+{ .is_ngc = TRUE,
+  .id = 1359,
+  .ra = 53.4492,
+  .dec = -19.4917,
+},
+{ .is_ngc = TRUE,
+  .id = 1360,
+  .ra = 53.3111,
+  .dec = -25.872,
+},
+{ .is_ngc = TRUE,
+  .id = 1361,
+  .ra = 53.5738,
+  .dec = -6.26495,
+},
+{ .is_ngc = TRUE,
+  .id = 1362,
+  .ra = 53.4709,
+  .dec = -20.2823,
+},
+{ .is_ngc = TRUE,
+  .id = 1363,
+  .ra = 53.7062,
+  .dec = -9.8425,
+},
+{ .is_ngc = TRUE,
+  .id = 1364,
+  .ra = 53.7458,
+  .dec = -9.83889,
+},
+{ .is_ngc = TRUE,
+  .id = 1365,
+  .ra = 53.401,
+  .dec = -36.1402,
+},
+{ .is_ngc = TRUE,
+  .id = 1366,
+  .ra = 53.4729,
+  .dec = -31.1933,
+},
+{ .is_ngc = TRUE,
+  .id = 1368,
+  .ra = 53.7453,
+  .dec = -15.656,
+},
+{ .is_ngc = TRUE,
+  .id = 1369,
+  .ra = 54.1879,
+  .dec = -36.2558,
+},
+{ .is_ngc = TRUE,
+  .id = 1370,
+  .ra = 53.8104,
+  .dec = -20.3733,
+},
+{ .is_ngc = TRUE,
+  .id = 1372,
+  .ra = 54.2489,
+  .dec = -15.8819,
+},
+{ .is_ngc = TRUE,
+  .id = 1373,
+  .ra = 53.7458,
+  .dec = -35.1706,
+},
+{ .is_ngc = TRUE,
+  .id = 1374,
+  .ra = 53.8196,
+  .dec = -35.2261,
+},
+{ .is_ngc = TRUE,
+  .id = 1375,
+  .ra = 53.8196,
+  .dec = -35.2658,
+},
+{ .is_ngc = TRUE,
+  .id = 1376,
+  .ra = 54.275,
+  .dec = -5.04333,
+},
+{ .is_ngc = TRUE,
+  .id = 1377,
+  .ra = 54.1625,
+  .dec = -20.9011,
+},
+{ .is_ngc = TRUE,
+  .id = 1378,
+  .ra = 53.9925,
+  .dec = -35.2111,
+},
+{ .is_ngc = TRUE,
+  .id = 1379,
+  .ra = 54.0162,
+  .dec = -35.4414,
+},
+{ .is_ngc = TRUE,
+  .id = 1380,
+  .ra = 54.115,
+  .dec = -34.9757,
+},
+{ .is_ngc = TRUE,
+  .id = 1381,
+  .ra = 54.1317,
+  .dec = -35.295,
+},
+{ .is_ngc = TRUE,
+  .id = 1383,
+  .ra = 54.4133,
+  .dec = -18.3394,
+},
+{ .is_ngc = TRUE,
+  .id = 1384,
+  .ra = 54.8064,
+  .dec = 15.8192,
+},
+{ .is_ngc = TRUE,
+  .id = 1385,
+  .ra = 54.3699,
+  .dec = -24.502,
+},
+{ .is_ngc = TRUE,
+  .id = 1386,
+  .ra = 54.1942,
+  .dec = -35.9992,
+},
+{ .is_ngc = TRUE,
+  .id = 1387,
+  .ra = 54.2375,
+  .dec = -35.5064,
+},
+{ .is_ngc = TRUE,
+  .id = 1388,
+  .ra = 54.5502,
+  .dec = -15.8998,
+},
+{ .is_ngc = TRUE,
+  .id = 1389,
+  .ra = 54.2987,
+  .dec = -35.745,
+},
+{ .is_ngc = TRUE,
+  .id = 1390,
+  .ra = 54.4671,
+  .dec = -19.0081,
+},
+{ .is_ngc = TRUE,
+  .id = 1391,
+  .ra = 54.721,
+  .dec = -18.3541,
+},
+{ .is_ngc = TRUE,
+  .id = 1392,
+  .ra = 54.3762,
+  .dec = -37.1347,
+},
+{ .is_ngc = TRUE,
+  .id = 1393,
+  .ra = 54.6608,
+  .dec = -18.4278,
+},
+{ .is_ngc = TRUE,
+  .id = 1394,
+  .ra = 54.7783,
+  .dec = -18.2925,
+},
+{ .is_ngc = TRUE,
+  .id = 1395,
+  .ra = 54.6236,
+  .dec = -23.0274,
+},
+{ .is_ngc = TRUE,
+  .id = 1396,
+  .ra = 54.5267,
+  .dec = -35.4394,
+},
+{ .is_ngc = TRUE,
+  .id = 1397,
+  .ra = 54.9464,
+  .dec = -4.67047,
+},
+{ .is_ngc = TRUE,
+  .id = 1398,
+  .ra = 54.7167,
+  .dec = -26.3374,
+},
+{ .is_ngc = TRUE,
+  .id = 1399,
+  .ra = 54.6211,
+  .dec = -35.4503,
+},
+{ .is_ngc = TRUE,
+  .id = 1400,
+  .ra = 54.8783,
+  .dec = -18.6881,
+},
+{ .is_ngc = TRUE,
+  .id = 1401,
+  .ra = 54.8408,
+  .dec = -22.7244,
+},
+{ .is_ngc = TRUE,
+  .id = 1402,
+  .ra = 54.8771,
+  .dec = -18.5267,
+},
+{ .is_ngc = TRUE,
+  .id = 1403,
+  .ra = 54.7957,
+  .dec = -22.3888,
+},
+{ .is_ngc = TRUE,
+  .id = 1404,
+  .ra = 54.7162,
+  .dec = -35.5934,
+},
+{ .is_ngc = TRUE,
+  .id = 1405,
+  .ra = 55.079,
+  .dec = -15.5309,
+},
+{ .is_ngc = TRUE,
+  .id = 1406,
+  .ra = 54.8458,
+  .dec = -31.3219,
+},
+{ .is_ngc = TRUE,
+  .id = 1407,
+  .ra = 55.0493,
+  .dec = -18.58,
+},
+{ .is_ngc = TRUE,
+  .id = 1408,
+  .ra = 54.8333,
+  .dec = -35.5181,
+},
+{ .is_ngc = TRUE,
+  .id = 1408,
+  .ra = 54.8221,
+  .dec = -35.5006,
+},
+{ .is_ngc = TRUE,
+  .id = 1409,
+  .ra = 55.2936,
+  .dec = -1.30229,
+},
+{ .is_ngc = TRUE,
+  .id = 1410,
+  .ra = 55.2948,
+  .dec = -1.29886,
+},
+{ .is_ngc = TRUE,
+  .id = 1413,
+  .ra = 55.0481,
+  .dec = -15.611,
+},
+{ .is_ngc = TRUE,
+  .id = 1414,
+  .ra = 55.2371,
+  .dec = -21.7133,
+},
+{ .is_ngc = TRUE,
+  .id = 1416,
+  .ra = 55.2619,
+  .dec = -22.7191,
+},
+{ .is_ngc = TRUE,
+  .id = 1417,
+  .ra = 55.4892,
+  .dec = -4.70583,
+},
+{ .is_ngc = TRUE,
+  .id = 1418,
+  .ra = 55.5675,
+  .dec = -4.73167,
+},
+{ .is_ngc = TRUE,
+  .id = 1419,
+  .ra = 55.175,
+  .dec = -37.5103,
+},
+{ .is_ngc = TRUE,
+  .id = 1420,
+  .ra = 55.6662,
+  .dec = -5.8525,
+},
+{ .is_ngc = TRUE,
+  .id = 1421,
+  .ra = 55.6225,
+  .dec = -13.4886,
+},
+{ .is_ngc = TRUE,
+  .id = 1422,
+  .ra = 55.3808,
+  .dec = -21.6808,
+},
+{ .is_ngc = TRUE,
+  .id = 1423,
+  .ra = 55.6671,
+  .dec = -6.38194,
+},
+{ .is_ngc = TRUE,
+  .id = 1424,
+  .ra = 55.8083,
+  .dec = -4.73061,
+},
+{ .is_ngc = TRUE,
+  .id = 1426,
+  .ra = 55.7046,
+  .dec = -22.1092,
+},
+{ .is_ngc = TRUE,
+  .id = 1427,
+  .ra = 55.5804,
+  .dec = -35.3931,
+},
+{ .is_ngc = TRUE,
+  .id = 1428,
+  .ra = 55.595,
+  .dec = -35.1533,
+},
+{ .is_ngc = TRUE,
+  .id = 1429,
+  .ra = 56.0167,
+  .dec = -4.71694,
+},
+{ .is_ngc = TRUE,
+  .id = 1429,
+  .ra = 56.0012,
+  .dec = -4.71472,
+},
+{ .is_ngc = TRUE,
+  .id = 1430,
+  .ra = 55.855,
+  .dec = -18.225,
+},
+{ .is_ngc = TRUE,
+  .id = 1431,
+  .ra = 56.1701,
+  .dec = 2.83473,
+},
+{ .is_ngc = TRUE,
+  .id = 1432,
+  .ra = 56.4564,
+  .dec = 24.3684,
+},
+{ .is_ngc = TRUE,
+  .id = 1433,
+  .ra = 55.5057,
+  .dec = -47.2219,
+},
+{ .is_ngc = TRUE,
+  .id = 1434,
+  .ra = 56.5533,
+  .dec = -9.68278,
+},
+{ .is_ngc = TRUE,
+  .id = 1435,
+  .ra = 56.5417,
+  .dec = 23.7525,
+},
+{ .is_ngc = TRUE,
+  .id = 1438,
+  .ra = 56.3212,
+  .dec = -23.0025,
+},
+{ .is_ngc = TRUE,
+  .id = 1439,
+  .ra = 56.2079,
+  .dec = -21.9203,
+},
+{ .is_ngc = TRUE,
+  .id = 1441,
+  .ra = 56.4295,
+  .dec = -4.09206,
+},
+{ .is_ngc = TRUE,
+  .id = 1443,
+  .ra = 56.4712,
+  .dec = -4.0525,
+},
+{ .is_ngc = TRUE,
+  .id = 1444,
+  .ra = 57.3542,
+  .dec = 52.6514,
+},
+{ .is_ngc = TRUE,
+  .id = 1445,
+  .ra = 56.234,
+  .dec = -9.85581,
+},
+{ .is_ngc = TRUE,
+  .id = 1446,
+  .ra = 56.4894,
+  .dec = -4.11217,
+},
+{ .is_ngc = TRUE,
+  .id = 1447,
+  .ra = 56.4465,
+  .dec = -9.01887,
+},
+{ .is_ngc = TRUE,
+  .id = 1449,
+  .ra = 56.5123,
+  .dec = -4.13894,
+},
+{ .is_ngc = TRUE,
+  .id = 1450,
+  .ra = 56.4021,
+  .dec = -9.23472,
+},
+{ .is_ngc = TRUE,
+  .id = 1451,
+  .ra = 56.5294,
+  .dec = -4.07003,
+},
+{ .is_ngc = TRUE,
+  .id = 1453,
+  .ra = 56.613,
+  .dec = -3.96983,
+},
+{ .is_ngc = TRUE,
+  .id = 1454,
+  .ra = 56.4974,
+  .dec = -20.6522,
+},
+{ .is_ngc = TRUE,
+  .id = 1456,
+  .ra = 57.0346,
+  .dec = 22.5581,
+},
+{ .is_ngc = TRUE,
+  .id = 1458,
+  .ra = 56.7417,
+  .dec = -18.2347,
+},
+{ .is_ngc = TRUE,
+  .id = 1458,
+  .ra = 56.75,
+  .dec = -18.2497,
+},
+{ .is_ngc = TRUE,
+  .id = 1459,
+  .ra = 56.7417,
+  .dec = -25.5222,
+},
+{ .is_ngc = TRUE,
+  .id = 1460,
+  .ra = 56.5575,
+  .dec = -36.6958,
+},
+{ .is_ngc = TRUE,
+  .id = 1461,
+  .ra = 57.1129,
+  .dec = -16.3928,
+},
+{ .is_ngc = TRUE,
+  .id = 1463,
+  .ra = 56.565,
+  .dec = -59.81,
+},
+{ .is_ngc = TRUE,
+  .id = 1465,
+  .ra = 58.3833,
+  .dec = 32.4923,
+},
+{ .is_ngc = TRUE,
+  .id = 1466,
+  .ra = 56.1371,
+  .dec = -71.6711,
+},
+{ .is_ngc = TRUE,
+  .id = 1467,
+  .ra = 57.9698,
+  .dec = -8.83818,
+},
+{ .is_ngc = TRUE,
+  .id = 1468,
+  .ra = 58.0524,
+  .dec = -6.34923,
+},
+{ .is_ngc = TRUE,
+  .id = 1469,
+  .ra = 60.1158,
+  .dec = 68.5775,
+},
+{ .is_ngc = TRUE,
+  .id = 1470,
+  .ra = 58.0408,
+  .dec = -8.99967,
+},
+{ .is_ngc = TRUE,
+  .id = 1472,
+  .ra = 58.4472,
+  .dec = -8.56867,
+},
+{ .is_ngc = TRUE,
+  .id = 1473,
+  .ra = 56.8592,
+  .dec = -68.2208,
+},
+{ .is_ngc = TRUE,
+  .id = 1475,
+  .ra = 58.4573,
+  .dec = -8.13758,
+},
+{ .is_ngc = TRUE,
+  .id = 1476,
+  .ra = 58.0362,
+  .dec = -44.5319,
+},
+{ .is_ngc = TRUE,
+  .id = 1477,
+  .ra = 58.5119,
+  .dec = -8.5751,
+},
+{ .is_ngc = TRUE,
+  .id = 1478,
+  .ra = 58.5306,
+  .dec = -8.55565,
+},
+{ .is_ngc = TRUE,
+  .id = 1479,
+  .ra = 58.5833,
+  .dec = -10.2014,
+},
+{ .is_ngc = TRUE,
+  .id = 1480,
+  .ra = 58.6333,
+  .dec = -10.2514,
+},
+{ .is_ngc = TRUE,
+  .id = 1481,
+  .ra = 58.6212,
+  .dec = -20.4273,
+},
+{ .is_ngc = TRUE,
+  .id = 1482,
+  .ra = 58.6629,
+  .dec = -20.5028,
+},
+{ .is_ngc = TRUE,
+  .id = 1483,
+  .ra = 58.1988,
+  .dec = -47.4781,
+},
+{ .is_ngc = TRUE,
+  .id = 1484,
+  .ra = 58.5733,
+  .dec = -36.9708,
+},
+{ .is_ngc = TRUE,
+  .id = 1485,
+  .ra = 61.266,
+  .dec = 70.9966,
+},
+{ .is_ngc = TRUE,
+  .id = 1486,
+  .ra = 59.0783,
+  .dec = -21.8208,
+},
+{ .is_ngc = TRUE,
+  .id = 1487,
+  .ra = 58.9383,
+  .dec = -42.3681,
+},
+{ .is_ngc = TRUE,
+  .id = 1488,
+  .ra = 60.0179,
+  .dec = 18.5672,
+},
+{ .is_ngc = TRUE,
+  .id = 1489,
+  .ra = 59.4088,
+  .dec = -19.2172,
+},
+{ .is_ngc = TRUE,
+  .id = 1490,
+  .ra = 58.3929,
+  .dec = -66.0178,
+},
+{ .is_ngc = TRUE,
+  .id = 1491,
+  .ra = 60.8067,
+  .dec = 51.3158,
+},
+{ .is_ngc = TRUE,
+  .id = 1492,
+  .ra = 59.5558,
+  .dec = -35.4461,
+},
+{ .is_ngc = TRUE,
+  .id = 1493,
+  .ra = 59.365,
+  .dec = -46.2111,
+},
+{ .is_ngc = TRUE,
+  .id = 1494,
+  .ra = 59.4275,
+  .dec = -48.9086,
+},
+{ .is_ngc = TRUE,
+  .id = 1495,
+  .ra = 59.5883,
+  .dec = -44.4661,
+},
+{ .is_ngc = TRUE,
+  .id = 1496,
+  .ra = 61.1333,
+  .dec = 52.6519,
+},
+{ .is_ngc = TRUE,
+  .id = 1497,
+  .ra = 60.5288,
+  .dec = 23.1328,
+},
+{ .is_ngc = TRUE,
+  .id = 1498,
+  .ra = 60.0808,
+  .dec = -12.0197,
+},
+{ .is_ngc = TRUE,
+  .id = 1499,
+  .ra = 60.8083,
+  .dec = 36.3667,
+},
+{ .is_ngc = TRUE,
+  .id = 1500,
+  .ra = 59.5583,
+  .dec = -52.3283,
+},
+{ .is_ngc = TRUE,
+  .id = 1501,
+  .ra = 61.7473,
+  .dec = 60.9207,
+},
+{ .is_ngc = TRUE,
+  .id = 1502,
+  .ra = 61.9583,
+  .dec = 62.3192,
+},
+{ .is_ngc = TRUE,
+  .id = 1503,
+  .ra = 59.1388,
+  .dec = -66.0406,
+},
+{ .is_ngc = TRUE,
+  .id = 1504,
+  .ra = 60.6236,
+  .dec = -9.33571,
+},
+{ .is_ngc = TRUE,
+  .id = 1505,
+  .ra = 60.6515,
+  .dec = -9.32276,
+},
+{ .is_ngc = TRUE,
+  .id = 1506,
+  .ra = 60.0908,
+  .dec = -52.5736,
+},
+{ .is_ngc = TRUE,
+  .id = 1507,
+  .ra = 61.1133,
+  .dec = -2.18861,
+},
+{ .is_ngc = TRUE,
+  .id = 1508,
+  .ra = 61.4487,
+  .dec = 25.4084,
+},
+{ .is_ngc = TRUE,
+  .id = 1510,
+  .ra = 60.8857,
+  .dec = -43.4002,
+},
+{ .is_ngc = TRUE,
+  .id = 1511,
+  .ra = 59.9012,
+  .dec = -67.635,
+},
+{ .is_ngc = TRUE,
+  .id = 1512,
+  .ra = 60.976,
+  .dec = -43.3494,
+},
+{ .is_ngc = TRUE,
+  .id = 1513,
+  .ra = 62.4875,
+  .dec = 49.5025,
+},
+{ .is_ngc = TRUE,
+  .id = 1514,
+  .ra = 62.3206,
+  .dec = 30.7759,
+},
+{ .is_ngc = TRUE,
+  .id = 1515,
+  .ra = 61.0125,
+  .dec = -54.1003,
+},
+{ .is_ngc = TRUE,
+  .id = 1517,
+  .ra = 62.2994,
+  .dec = 8.64831,
+},
+{ .is_ngc = TRUE,
+  .id = 1518,
+  .ra = 61.7042,
+  .dec = -21.1789,
+},
+{ .is_ngc = TRUE,
+  .id = 1519,
+  .ra = 62.0317,
+  .dec = -17.1928,
+},
+{ .is_ngc = TRUE,
+  .id = 1520,
+  .ra = 59.3808,
+  .dec = -76.8333,
+},
+{ .is_ngc = TRUE,
+  .id = 1521,
+  .ra = 62.0788,
+  .dec = -21.0519,
+},
+{ .is_ngc = TRUE,
+  .id = 1522,
+  .ra = 61.5317,
+  .dec = -52.6697,
+},
+{ .is_ngc = TRUE,
+  .id = 1523,
+  .ra = 61.5446,
+  .dec = -54.0886,
+},
+{ .is_ngc = TRUE,
+  .id = 1526,
+  .ra = 61.3,
+  .dec = -65.8406,
+},
+{ .is_ngc = TRUE,
+  .id = 1527,
+  .ra = 62.1008,
+  .dec = -47.8969,
+},
+{ .is_ngc = TRUE,
+  .id = 1528,
+  .ra = 63.8458,
+  .dec = 51.2025,
+},
+{ .is_ngc = TRUE,
+  .id = 1529,
+  .ra = 61.8317,
+  .dec = -62.8997,
+},
+{ .is_ngc = TRUE,
+  .id = 1530,
+  .ra = 65.8623,
+  .dec = 75.2951,
+},
+{ .is_ngc = TRUE,
+  .id = 1531,
+  .ra = 62.9968,
+  .dec = -32.8504,
+},
+{ .is_ngc = TRUE,
+  .id = 1532,
+  .ra = 63.0178,
+  .dec = -32.8738,
+},
+{ .is_ngc = TRUE,
+  .id = 1533,
+  .ra = 62.465,
+  .dec = -56.1192,
+},
+{ .is_ngc = TRUE,
+  .id = 1534,
+  .ra = 62.1912,
+  .dec = -62.7967,
+},
+{ .is_ngc = TRUE,
+  .id = 1535,
+  .ra = 63.5657,
+  .dec = -12.7394,
+},
+{ .is_ngc = TRUE,
+  .id = 1536,
+  .ra = 62.7529,
+  .dec = -56.4856,
+},
+{ .is_ngc = TRUE,
+  .id = 1537,
+  .ra = 63.42,
+  .dec = -31.6456,
+},
+{ .is_ngc = TRUE,
+  .id = 1539,
+  .ra = 64.7582,
+  .dec = 26.8269,
+},
+{ .is_ngc = TRUE,
+  .id = 1541,
+  .ra = 64.2509,
+  .dec = 0.834778,
+},
+{ .is_ngc = TRUE,
+  .id = 1542,
+  .ra = 64.3091,
+  .dec = 4.78167,
+},
+{ .is_ngc = TRUE,
+  .id = 1543,
+  .ra = 63.1795,
+  .dec = -57.7376,
+},
+{ .is_ngc = TRUE,
+  .id = 1544,
+  .ra = 75.6435,
+  .dec = 86.2217,
+},
+{ .is_ngc = TRUE,
+  .id = 1545,
+  .ra = 65.2375,
+  .dec = 50.2506,
+},
+{ .is_ngc = TRUE,
+  .id = 1546,
+  .ra = 63.653,
+  .dec = -56.0607,
+},
+{ .is_ngc = TRUE,
+  .id = 1547,
+  .ra = 64.3017,
+  .dec = -17.8572,
+},
+{ .is_ngc = TRUE,
+  .id = 1548,
+  .ra = 65.3058,
+  .dec = 36.9169,
+},
+{ .is_ngc = TRUE,
+  .id = 1549,
+  .ra = 63.9377,
+  .dec = -55.592,
+},
+{ .is_ngc = TRUE,
+  .id = 1552,
+  .ra = 65.0733,
+  .dec = -0.693083,
+},
+{ .is_ngc = TRUE,
+  .id = 1553,
+  .ra = 64.0435,
+  .dec = -55.7803,
+},
+{ .is_ngc = TRUE,
+  .id = 1554,
+  .ra = 65.4315,
+  .dec = 19.5206,
+},
+{ .is_ngc = TRUE,
+  .id = 1555,
+  .ra = 65.4867,
+  .dec = 19.5342,
+},
+{ .is_ngc = TRUE,
+  .id = 1556,
+  .ra = 64.4375,
+  .dec = -50.1639,
+},
+{ .is_ngc = TRUE,
+  .id = 1557,
+  .ra = 63.3083,
+  .dec = -70.5014,
+},
+{ .is_ngc = TRUE,
+  .id = 1558,
+  .ra = 65.0662,
+  .dec = -45.0314,
+},
+{ .is_ngc = TRUE,
+  .id = 1559,
+  .ra = 64.4033,
+  .dec = -62.7842,
+},
+{ .is_ngc = TRUE,
+  .id = 1560,
+  .ra = 68.2003,
+  .dec = 71.8797,
+},
+{ .is_ngc = TRUE,
+  .id = 1561,
+  .ra = 65.7544,
+  .dec = -15.8462,
+},
+{ .is_ngc = TRUE,
+  .id = 1562,
+  .ra = 65.4485,
+  .dec = -15.7555,
+},
+{ .is_ngc = TRUE,
+  .id = 1563,
+  .ra = 65.7246,
+  .dec = -15.7332,
+},
+{ .is_ngc = TRUE,
+  .id = 1564,
+  .ra = 65.7538,
+  .dec = -15.7395,
+},
+{ .is_ngc = TRUE,
+  .id = 1565,
+  .ra = 65.8482,
+  .dec = -15.7445,
+},
+{ .is_ngc = TRUE,
+  .id = 1566,
+  .ra = 65.0021,
+  .dec = -54.938,
+},
+{ .is_ngc = TRUE,
+  .id = 1567,
+  .ra = 65.2862,
+  .dec = -48.2547,
+},
+{ .is_ngc = TRUE,
+  .id = 1569,
+  .ra = 67.7043,
+  .dec = 64.8481,
+},
+{ .is_ngc = TRUE,
+  .id = 1572,
+  .ra = 65.6775,
+  .dec = -40.6003,
+},
+{ .is_ngc = TRUE,
+  .id = 1573,
+  .ra = 68.7647,
+  .dec = 73.2628,
+},
+{ .is_ngc = TRUE,
+  .id = 1574,
+  .ra = 65.4954,
+  .dec = -56.9742,
+},
+{ .is_ngc = TRUE,
+  .id = 1576,
+  .ra = 66.5779,
+  .dec = -3.62139,
+},
+{ .is_ngc = TRUE,
+  .id = 1578,
+  .ra = 65.9446,
+  .dec = -51.5994,
+},
+{ .is_ngc = TRUE,
+  .id = 1579,
+  .ra = 67.5592,
+  .dec = 35.2797,
+},
+{ .is_ngc = TRUE,
+  .id = 1580,
+  .ra = 67.0771,
+  .dec = -5.17944,
+},
+{ .is_ngc = TRUE,
+  .id = 1581,
+  .ra = 66.1883,
+  .dec = -54.9417,
+},
+{ .is_ngc = TRUE,
+  .id = 1582,
+  .ra = 67.9708,
+  .dec = 43.8167,
+},
+{ .is_ngc = TRUE,
+  .id = 1583,
+  .ra = 67.0859,
+  .dec = -17.5958,
+},
+{ .is_ngc = TRUE,
+  .id = 1584,
+  .ra = 67.0427,
+  .dec = -17.5238,
+},
+{ .is_ngc = TRUE,
+  .id = 1585,
+  .ra = 66.8875,
+  .dec = -42.165,
+},
+{ .is_ngc = TRUE,
+  .id = 1586,
+  .ra = 67.6591,
+  .dec = -0.304611,
+},
+{ .is_ngc = TRUE,
+  .id = 1587,
+  .ra = 67.6664,
+  .dec = 0.661722,
+},
+{ .is_ngc = TRUE,
+  .id = 1588,
+  .ra = 67.6827,
+  .dec = 0.664817,
+},
+{ .is_ngc = TRUE,
+  .id = 1589,
+  .ra = 67.6897,
+  .dec = 0.863556,
+},
+{ .is_ngc = TRUE,
+  .id = 1590,
+  .ra = 67.793,
+  .dec = 7.63092,
+},
+{ .is_ngc = TRUE,
+  .id = 1591,
+  .ra = 67.3779,
+  .dec = -26.7131,
+},
+{ .is_ngc = TRUE,
+  .id = 1592,
+  .ra = 67.4189,
+  .dec = -27.4086,
+},
+{ .is_ngc = TRUE,
+  .id = 1595,
+  .ra = 67.0904,
+  .dec = -47.8156,
+},
+{ .is_ngc = TRUE,
+  .id = 1596,
+  .ra = 66.9075,
+  .dec = -55.0267,
+},
+{ .is_ngc = TRUE,
+  .id = 1597,
+  .ra = 67.8061,
+  .dec = -11.2906,
+},
+{ .is_ngc = TRUE,
+  .id = 1598,
+  .ra = 67.14,
+  .dec = -47.7819,
+},
+{ .is_ngc = TRUE,
+  .id = 1600,
+  .ra = 67.9163,
+  .dec = -5.0875,
+},
+{ .is_ngc = TRUE,
+  .id = 1601,
+  .ra = 67.9242,
+  .dec = -5.06054,
+},
+{ .is_ngc = TRUE,
+  .id = 1602,
+  .ra = 66.9746,
+  .dec = -55.0569,
+},
+{ .is_ngc = TRUE,
+  .id = 1603,
+  .ra = 67.9585,
+  .dec = -5.0944,
+},
+{ .is_ngc = TRUE,
+  .id = 1604,
+  .ra = 67.9941,
+  .dec = -5.37031,
+},
+{ .is_ngc = TRUE,
+  .id = 1605,
+  .ra = 68.7208,
+  .dec = 45.2672,
+},
+{ .is_ngc = TRUE,
+  .id = 1606,
+  .ra = 68.0143,
+  .dec = -5.03216,
+},
+{ .is_ngc = TRUE,
+  .id = 1607,
+  .ra = 68.0129,
+  .dec = -4.46056,
+},
+{ .is_ngc = TRUE,
+  .id = 1609,
+  .ra = 68.188,
+  .dec = -4.37309,
+},
+{ .is_ngc = TRUE,
+  .id = 1610,
+  .ra = 68.1833,
+  .dec = -4.56917,
+},
+{ .is_ngc = TRUE,
+  .id = 1611,
+  .ra = 68.2747,
+  .dec = -4.2975,
+},
+{ .is_ngc = TRUE,
+  .id = 1612,
+  .ra = 68.3047,
+  .dec = -4.17264,
+},
+{ .is_ngc = TRUE,
+  .id = 1613,
+  .ra = 68.3556,
+  .dec = -4.26563,
+},
+{ .is_ngc = TRUE,
+  .id = 1614,
+  .ra = 68.5,
+  .dec = -8.57931,
+},
+{ .is_ngc = TRUE,
+  .id = 1615,
+  .ra = 69.0078,
+  .dec = 19.9506,
+},
+{ .is_ngc = TRUE,
+  .id = 1616,
+  .ra = 68.1737,
+  .dec = -43.7153,
+},
+{ .is_ngc = TRUE,
+  .id = 1617,
+  .ra = 67.9145,
+  .dec = -54.6017,
+},
+{ .is_ngc = TRUE,
+  .id = 1618,
+  .ra = 69.0275,
+  .dec = -3.14917,
+},
+{ .is_ngc = TRUE,
+  .id = 1619,
+  .ra = 69.0458,
+  .dec = -4.81917,
+},
+{ .is_ngc = TRUE,
+  .id = 1620,
+  .ra = 69.1554,
+  .dec = -0.143917,
+},
+{ .is_ngc = TRUE,
+  .id = 1622,
+  .ra = 69.1522,
+  .dec = -3.18908,
+},
+{ .is_ngc = TRUE,
+  .id = 1623,
+  .ra = 68.8845,
+  .dec = -13.5565,
+},
+{ .is_ngc = TRUE,
+  .id = 1624,
+  .ra = 70.15,
+  .dec = 50.4519,
+},
+{ .is_ngc = TRUE,
+  .id = 1625,
+  .ra = 69.2763,
+  .dec = -3.30417,
+},
+{ .is_ngc = TRUE,
+  .id = 1627,
+  .ra = 69.4083,
+  .dec = -4.88861,
+},
+{ .is_ngc = TRUE,
+  .id = 1628,
+  .ra = 69.4008,
+  .dec = -4.71639,
+},
+{ .is_ngc = TRUE,
+  .id = 1629,
+  .ra = 67.4004,
+  .dec = -71.8381,
+},
+{ .is_ngc = TRUE,
+  .id = 1630,
+  .ra = 69.3143,
+  .dec = -18.902,
+},
+{ .is_ngc = TRUE,
+  .id = 1631,
+  .ra = 69.6008,
+  .dec = -20.6497,
+},
+{ .is_ngc = TRUE,
+  .id = 1633,
+  .ra = 70.0379,
+  .dec = 7.349,
+},
+{ .is_ngc = TRUE,
+  .id = 1634,
+  .ra = 70.0408,
+  .dec = 7.33833,
+},
+{ .is_ngc = TRUE,
+  .id = 1635,
+  .ra = 70.0331,
+  .dec = -0.547667,
+},
+{ .is_ngc = TRUE,
+  .id = 1636,
+  .ra = 70.1675,
+  .dec = -8.60778,
+},
+{ .is_ngc = TRUE,
+  .id = 1637,
+  .ra = 70.3673,
+  .dec = -2.85786,
+},
+{ .is_ngc = TRUE,
+  .id = 1638,
+  .ra = 70.4015,
+  .dec = -1.80906,
+},
+{ .is_ngc = TRUE,
+  .id = 1639,
+  .ra = 70.2179,
+  .dec = -16.9911,
+},
+{ .is_ngc = TRUE,
+  .id = 1640,
+  .ra = 70.56,
+  .dec = -20.435,
+},
+{ .is_ngc = TRUE,
+  .id = 1641,
+  .ra = 68.9083,
+  .dec = -65.7669,
+},
+{ .is_ngc = TRUE,
+  .id = 1641,
+  .ra = 69.0208,
+  .dec = -65.7692,
+},
+{ .is_ngc = TRUE,
+  .id = 1642,
+  .ra = 70.7285,
+  .dec = 0.618417,
+},
+{ .is_ngc = TRUE,
+  .id = 1643,
+  .ra = 70.9333,
+  .dec = -5.31917,
+},
+{ .is_ngc = TRUE,
+  .id = 1644,
+  .ra = 69.4133,
+  .dec = -66.1981,
+},
+{ .is_ngc = TRUE,
+  .id = 1645,
+  .ra = 71.0268,
+  .dec = -5.46572,
+},
+{ .is_ngc = TRUE,
+  .id = 1647,
+  .ra = 71.4792,
+  .dec = 19.1025,
+},
+{ .is_ngc = TRUE,
+  .id = 1648,
+  .ra = 71.1449,
+  .dec = -8.47904,
+},
+{ .is_ngc = TRUE,
+  .id = 1649,
+  .ra = 69.5289,
+  .dec = -68.7779,
+},
+{ .is_ngc = TRUE,
+  .id = 1650,
+  .ra = 71.2977,
+  .dec = -15.8703,
+},
+{ .is_ngc = TRUE,
+  .id = 1651,
+  .ra = 69.3839,
+  .dec = -70.5851,
+},
+{ .is_ngc = TRUE,
+  .id = 1653,
+  .ra = 71.4475,
+  .dec = -2.39275,
+},
+{ .is_ngc = TRUE,
+  .id = 1654,
+  .ra = 71.4522,
+  .dec = -2.08378,
+},
+{ .is_ngc = TRUE,
+  .id = 1655,
+  .ra = 71.7958,
+  .dec = 20.9178,
+},
+{ .is_ngc = TRUE,
+  .id = 1656,
+  .ra = 71.4721,
+  .dec = -5.13667,
+},
+{ .is_ngc = TRUE,
+  .id = 1657,
+  .ra = 71.5302,
+  .dec = -2.07717,
+},
+{ .is_ngc = TRUE,
+  .id = 1658,
+  .ra = 71.0042,
+  .dec = -41.4636,
+},
+{ .is_ngc = TRUE,
+  .id = 1660,
+  .ra = 71.0458,
+  .dec = -41.4975,
+},
+{ .is_ngc = TRUE,
+  .id = 1661,
+  .ra = 71.7821,
+  .dec = -2.05461,
+},
+{ .is_ngc = TRUE,
+  .id = 1662,
+  .ra = 72.1125,
+  .dec = 10.9339,
+},
+{ .is_ngc = TRUE,
+  .id = 1663,
+  .ra = 72.3375,
+  .dec = 13.15,
+},
+{ .is_ngc = TRUE,
+  .id = 1664,
+  .ra = 72.775,
+  .dec = 43.6681,
+},
+{ .is_ngc = TRUE,
+  .id = 1665,
+  .ra = 72.0713,
+  .dec = -5.42774,
+},
+{ .is_ngc = TRUE,
+  .id = 1666,
+  .ra = 72.1368,
+  .dec = -6.57016,
+},
+{ .is_ngc = TRUE,
+  .id = 1668,
+  .ra = 71.5246,
+  .dec = -44.7328,
+},
+{ .is_ngc = TRUE,
+  .id = 1669,
+  .ra = 70.7525,
+  .dec = -65.8139,
+},
+{ .is_ngc = TRUE,
+  .id = 1670,
+  .ra = 72.4275,
+  .dec = -2.76061,
+},
+{ .is_ngc = TRUE,
+  .id = 1672,
+  .ra = 71.427,
+  .dec = -59.248,
+},
+{ .is_ngc = TRUE,
+  .id = 1673,
+  .ra = 70.6633,
+  .dec = -69.8192,
+},
+{ .is_ngc = TRUE,
+  .id = 1674,
+  .ra = 73.1,
+  .dec = 23.9014,
+},
+{ .is_ngc = TRUE,
+  .id = 1675,
+  .ra = 73.1,
+  .dec = 23.9014,
+},
+{ .is_ngc = TRUE,
+  .id = 1676,
+  .ra = 70.9721,
+  .dec = -68.8269,
+},
+{ .is_ngc = TRUE,
+  .id = 1678,
+  .ra = 72.8975,
+  .dec = -2.62333,
+},
+{ .is_ngc = TRUE,
+  .id = 1679,
+  .ra = 72.4792,
+  .dec = -31.9663,
+},
+{ .is_ngc = TRUE,
+  .id = 1680,
+  .ra = 72.14,
+  .dec = -47.8169,
+},
+{ .is_ngc = TRUE,
+  .id = 1681,
+  .ra = 72.9587,
+  .dec = -5.80333,
+},
+{ .is_ngc = TRUE,
+  .id = 1682,
+  .ra = 73.0826,
+  .dec = -3.10573,
+},
+{ .is_ngc = TRUE,
+  .id = 1683,
+  .ra = 73.0734,
+  .dec = -3.02439,
+},
+{ .is_ngc = TRUE,
+  .id = 1684,
+  .ra = 73.1296,
+  .dec = -3.10583,
+},
+{ .is_ngc = TRUE,
+  .id = 1685,
+  .ra = 73.1428,
+  .dec = -2.94946,
+},
+{ .is_ngc = TRUE,
+  .id = 1686,
+  .ra = 73.2279,
+  .dec = -15.3467,
+},
+{ .is_ngc = TRUE,
+  .id = 1687,
+  .ra = 72.8392,
+  .dec = -33.9389,
+},
+{ .is_ngc = TRUE,
+  .id = 1688,
+  .ra = 72.0975,
+  .dec = -59.8003,
+},
+{ .is_ngc = TRUE,
+  .id = 1690,
+  .ra = 73.5807,
+  .dec = 1.64028,
+},
+{ .is_ngc = TRUE,
+  .id = 1691,
+  .ra = 73.6597,
+  .dec = 3.26797,
+},
+{ .is_ngc = TRUE,
+  .id = 1692,
+  .ra = 73.8487,
+  .dec = -20.5713,
+},
+{ .is_ngc = TRUE,
+  .id = 1693,
+  .ra = 71.9137,
+  .dec = -69.3431,
+},
+{ .is_ngc = TRUE,
+  .id = 1694,
+  .ra = 73.82,
+  .dec = -4.65321,
+},
+{ .is_ngc = TRUE,
+  .id = 1695,
+  .ra = 71.9363,
+  .dec = -69.3739,
+},
+{ .is_ngc = TRUE,
+  .id = 1696,
+  .ra = 72.1262,
+  .dec = -68.2425,
+},
+{ .is_ngc = TRUE,
+  .id = 1697,
+  .ra = 72.1525,
+  .dec = -68.5592,
+},
+{ .is_ngc = TRUE,
+  .id = 1698,
+  .ra = 72.2667,
+  .dec = -69.1144,
+},
+{ .is_ngc = TRUE,
+  .id = 1699,
+  .ra = 74.2479,
+  .dec = -4.75667,
+},
+{ .is_ngc = TRUE,
+  .id = 1700,
+  .ra = 74.2346,
+  .dec = -4.865,
+},
+{ .is_ngc = TRUE,
+  .id = 1701,
+  .ra = 73.9625,
+  .dec = -29.8836,
+},
+{ .is_ngc = TRUE,
+  .id = 1702,
+  .ra = 72.3629,
+  .dec = -69.8514,
+},
+{ .is_ngc = TRUE,
+  .id = 1703,
+  .ra = 73.2163,
+  .dec = -59.7428,
+},
+{ .is_ngc = TRUE,
+  .id = 1704,
+  .ra = 72.4813,
+  .dec = -69.755,
+},
+{ .is_ngc = TRUE,
+  .id = 1705,
+  .ra = 73.5583,
+  .dec = -53.3617,
+},
+{ .is_ngc = TRUE,
+  .id = 1706,
+  .ra = 73.1296,
+  .dec = -62.9858,
+},
+{ .is_ngc = TRUE,
+  .id = 1708,
+  .ra = 75.8625,
+  .dec = 52.8333,
+},
+{ .is_ngc = TRUE,
+  .id = 1711,
+  .ra = 72.6538,
+  .dec = -69.9844,
+},
+{ .is_ngc = TRUE,
+  .id = 1712,
+  .ra = 72.74,
+  .dec = -69.4069,
+},
+{ .is_ngc = TRUE,
+  .id = 1713,
+  .ra = 74.7273,
+  .dec = -0.489278,
+},
+{ .is_ngc = TRUE,
+  .id = 1714,
+  .ra = 73.0304,
+  .dec = -66.9242,
+},
+{ .is_ngc = TRUE,
+  .id = 1715,
+  .ra = 73.0508,
+  .dec = -66.9086,
+},
+{ .is_ngc = TRUE,
+  .id = 1716,
+  .ra = 74.5546,
+  .dec = -20.3639,
+},
+{ .is_ngc = TRUE,
+  .id = 1717,
+  .ra = 74.8306,
+  .dec = -0.22875,
+},
+{ .is_ngc = TRUE,
+  .id = 1718,
+  .ra = 73.1046,
+  .dec = -67.0511,
+},
+{ .is_ngc = TRUE,
+  .id = 1719,
+  .ra = 74.8935,
+  .dec = -0.260722,
+},
+{ .is_ngc = TRUE,
+  .id = 1720,
+  .ra = 74.8358,
+  .dec = -7.85889,
+},
+{ .is_ngc = TRUE,
+  .id = 1721,
+  .ra = 74.8227,
+  .dec = -11.1189,
+},
+{ .is_ngc = TRUE,
+  .id = 1722,
+  .ra = 72.9613,
+  .dec = -69.3989,
+},
+{ .is_ngc = TRUE,
+  .id = 1723,
+  .ra = 74.8579,
+  .dec = -10.9808,
+},
+{ .is_ngc = TRUE,
+  .id = 1724,
+  .ra = 75.8833,
+  .dec = 49.4847,
+},
+{ .is_ngc = TRUE,
+  .id = 1725,
+  .ra = 74.8454,
+  .dec = -11.1323,
+},
+{ .is_ngc = TRUE,
+  .id = 1726,
+  .ra = 74.9246,
+  .dec = -7.755,
+},
+{ .is_ngc = TRUE,
+  .id = 1727,
+  .ra = 73.0796,
+  .dec = -69.345,
+},
+{ .is_ngc = TRUE,
+  .id = 1728,
+  .ra = 74.8658,
+  .dec = -11.1231,
+},
+{ .is_ngc = TRUE,
+  .id = 1729,
+  .ra = 75.065,
+  .dec = -3.3525,
+},
+{ .is_ngc = TRUE,
+  .id = 1731,
+  .ra = 73.3787,
+  .dec = -66.9247,
+},
+{ .is_ngc = TRUE,
+  .id = 1732,
+  .ra = 73.2954,
+  .dec = -68.65,
+},
+{ .is_ngc = TRUE,
+  .id = 1733,
+  .ra = 73.52,
+  .dec = -66.6822,
+},
+{ .is_ngc = TRUE,
+  .id = 1734,
+  .ra = 73.3875,
+  .dec = -68.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 1735,
+  .ra = 73.5842,
+  .dec = -67.1,
+},
+{ .is_ngc = TRUE,
+  .id = 1736,
+  .ra = 73.2587,
+  .dec = -68.0528,
+},
+{ .is_ngc = TRUE,
+  .id = 1737,
+  .ra = 73.4925,
+  .dec = -69.1725,
+},
+{ .is_ngc = TRUE,
+  .id = 1738,
+  .ra = 75.4442,
+  .dec = -18.1581,
+},
+{ .is_ngc = TRUE,
+  .id = 1739,
+  .ra = 75.4475,
+  .dec = -18.1672,
+},
+{ .is_ngc = TRUE,
+  .id = 1740,
+  .ra = 75.478,
+  .dec = -3.29611,
+},
+{ .is_ngc = TRUE,
+  .id = 1742,
+  .ra = 75.5017,
+  .dec = -3.2875,
+},
+{ .is_ngc = TRUE,
+  .id = 1743,
+  .ra = 73.5133,
+  .dec = -69.201,
+},
+{ .is_ngc = TRUE,
+  .id = 1744,
+  .ra = 74.9901,
+  .dec = -26.0227,
+},
+{ .is_ngc = TRUE,
+  .id = 1745,
+  .ra = 73.5863,
+  .dec = -69.1594,
+},
+{ .is_ngc = TRUE,
+  .id = 1746,
+  .ra = 75.9583,
+  .dec = 23.7672,
+},
+{ .is_ngc = TRUE,
+  .id = 1747,
+  .ra = 73.7988,
+  .dec = -67.1725,
+},
+{ .is_ngc = TRUE,
+  .id = 1749,
+  .ra = 73.7329,
+  .dec = -68.1889,
+},
+{ .is_ngc = TRUE,
+  .id = 1750,
+  .ra = 75.9792,
+  .dec = 23.6586,
+},
+{ .is_ngc = TRUE,
+  .id = 1751,
+  .ra = 73.5512,
+  .dec = -69.8072,
+},
+{ .is_ngc = TRUE,
+  .id = 1752,
+  .ra = 75.5392,
+  .dec = -8.24114,
+},
+{ .is_ngc = TRUE,
+  .id = 1753,
+  .ra = 75.6346,
+  .dec = -3.34417,
+},
+{ .is_ngc = TRUE,
+  .id = 1754,
+  .ra = 73.5754,
+  .dec = -70.4414,
+},
+{ .is_ngc = TRUE,
+  .id = 1755,
+  .ra = 73.8117,
+  .dec = -68.205,
+},
+{ .is_ngc = TRUE,
+  .id = 1756,
+  .ra = 73.7068,
+  .dec = -69.2379,
+},
+{ .is_ngc = TRUE,
+  .id = 1757,
+  .ra = 75.6625,
+  .dec = -4.71778,
+},
+{ .is_ngc = TRUE,
+  .id = 1758,
+  .ra = 76.1458,
+  .dec = 23.7858,
+},
+{ .is_ngc = TRUE,
+  .id = 1759,
+  .ra = 75.2042,
+  .dec = -38.6742,
+},
+{ .is_ngc = TRUE,
+  .id = 1760,
+  .ra = 74.1504,
+  .dec = -66.5233,
+},
+{ .is_ngc = TRUE,
+  .id = 1761,
+  .ra = 74.1717,
+  .dec = -66.4792,
+},
+{ .is_ngc = TRUE,
+  .id = 1762,
+  .ra = 75.904,
+  .dec = 1.57308,
+},
+{ .is_ngc = TRUE,
+  .id = 1763,
+  .ra = 74.1875,
+  .dec = -66.4169,
+},
+{ .is_ngc = TRUE,
+  .id = 1764,
+  .ra = 74.1167,
+  .dec = -67.6956,
+},
+{ .is_ngc = TRUE,
+  .id = 1765,
+  .ra = 74.6017,
+  .dec = -62.0278,
+},
+{ .is_ngc = TRUE,
+  .id = 1766,
+  .ra = 73.9917,
+  .dec = -70.2258,
+},
+{ .is_ngc = TRUE,
+  .id = 1767,
+  .ra = 74.1138,
+  .dec = -69.4022,
+},
+{ .is_ngc = TRUE,
+  .id = 1768,
+  .ra = 74.2558,
+  .dec = -68.2486,
+},
+{ .is_ngc = TRUE,
+  .id = 1769,
+  .ra = 74.4358,
+  .dec = -66.4625,
+},
+{ .is_ngc = TRUE,
+  .id = 1770,
+  .ra = 74.3258,
+  .dec = -68.4153,
+},
+{ .is_ngc = TRUE,
+  .id = 1771,
+  .ra = 74.7308,
+  .dec = -63.2981,
+},
+{ .is_ngc = TRUE,
+  .id = 1772,
+  .ra = 74.2229,
+  .dec = -69.5567,
+},
+{ .is_ngc = TRUE,
+  .id = 1773,
+  .ra = 74.5517,
+  .dec = -66.3658,
+},
+{ .is_ngc = TRUE,
+  .id = 1774,
+  .ra = 74.5275,
+  .dec = -67.2419,
+},
+{ .is_ngc = TRUE,
+  .id = 1775,
+  .ra = 74.2229,
+  .dec = -70.4294,
+},
+{ .is_ngc = TRUE,
+  .id = 1776,
+  .ra = 74.6642,
+  .dec = -66.4294,
+},
+{ .is_ngc = TRUE,
+  .id = 1777,
+  .ra = 73.9514,
+  .dec = -74.2837,
+},
+{ .is_ngc = TRUE,
+  .id = 1778,
+  .ra = 77.0167,
+  .dec = 37.0178,
+},
+{ .is_ngc = TRUE,
+  .id = 1779,
+  .ra = 76.3246,
+  .dec = -9.14667,
+},
+{ .is_ngc = TRUE,
+  .id = 1780,
+  .ra = 76.5867,
+  .dec = -19.4672,
+},
+{ .is_ngc = TRUE,
+  .id = 1782,
+  .ra = 74.4633,
+  .dec = -69.3931,
+},
+{ .is_ngc = TRUE,
+  .id = 1783,
+  .ra = 74.7865,
+  .dec = -65.9867,
+},
+{ .is_ngc = TRUE,
+  .id = 1784,
+  .ra = 76.3621,
+  .dec = -11.8717,
+},
+{ .is_ngc = TRUE,
+  .id = 1786,
+  .ra = 74.7825,
+  .dec = -67.7453,
+},
+{ .is_ngc = TRUE,
+  .id = 1787,
+  .ra = 75.0083,
+  .dec = -65.7853,
+},
+{ .is_ngc = TRUE,
+  .id = 1788,
+  .ra = 76.7217,
+  .dec = -3.34083,
+},
+{ .is_ngc = TRUE,
+  .id = 1789,
+  .ra = 74.4638,
+  .dec = -71.9014,
+},
+{ .is_ngc = TRUE,
+  .id = 1790,
+  .ra = 77.78,
+  .dec = 52.0578,
+},
+{ .is_ngc = TRUE,
+  .id = 1791,
+  .ra = 74.7767,
+  .dec = -70.1675,
+},
+{ .is_ngc = TRUE,
+  .id = 1792,
+  .ra = 76.3089,
+  .dec = -37.9803,
+},
+{ .is_ngc = TRUE,
+  .id = 1793,
+  .ra = 74.9096,
+  .dec = -69.5575,
+},
+{ .is_ngc = TRUE,
+  .id = 1795,
+  .ra = 74.9458,
+  .dec = -69.8008,
+},
+{ .is_ngc = TRUE,
+  .id = 1796,
+  .ra = 75.6792,
+  .dec = -61.1394,
+},
+{ .is_ngc = TRUE,
+  .id = 1797,
+  .ra = 76.9371,
+  .dec = -8.01917,
+},
+{ .is_ngc = TRUE,
+  .id = 1798,
+  .ra = 77.9125,
+  .dec = 47.6847,
+},
+{ .is_ngc = TRUE,
+  .id = 1799,
+  .ra = 76.9358,
+  .dec = -7.96917,
+},
+{ .is_ngc = TRUE,
+  .id = 1800,
+  .ra = 76.6058,
+  .dec = -31.9539,
+},
+{ .is_ngc = TRUE,
+  .id = 1801,
+  .ra = 75.1463,
+  .dec = -69.6128,
+},
+{ .is_ngc = TRUE,
+  .id = 1802,
+  .ra = 77.5583,
+  .dec = 24.1014,
+},
+{ .is_ngc = TRUE,
+  .id = 1803,
+  .ra = 76.3604,
+  .dec = -49.5672,
+},
+{ .is_ngc = TRUE,
+  .id = 1804,
+  .ra = 75.2675,
+  .dec = -69.0836,
+},
+{ .is_ngc = TRUE,
+  .id = 1805,
+  .ra = 75.5883,
+  .dec = -66.1117,
+},
+{ .is_ngc = TRUE,
+  .id = 1806,
+  .ra = 75.5483,
+  .dec = -67.9854,
+},
+{ .is_ngc = TRUE,
+  .id = 1807,
+  .ra = 77.6792,
+  .dec = 16.5175,
+},
+{ .is_ngc = TRUE,
+  .id = 1808,
+  .ra = 76.9272,
+  .dec = -37.5132,
+},
+{ .is_ngc = TRUE,
+  .id = 1809,
+  .ra = 75.5229,
+  .dec = -69.5686,
+},
+{ .is_ngc = TRUE,
+  .id = 1810,
+  .ra = 75.8458,
+  .dec = -66.3825,
+},
+{ .is_ngc = TRUE,
+  .id = 1811,
+  .ra = 77.1783,
+  .dec = -29.2764,
+},
+{ .is_ngc = TRUE,
+  .id = 1812,
+  .ra = 77.2208,
+  .dec = -29.2519,
+},
+{ .is_ngc = TRUE,
+  .id = 1813,
+  .ra = 75.6688,
+  .dec = -70.3178,
+},
+{ .is_ngc = TRUE,
+  .id = 1814,
+  .ra = 75.9433,
+  .dec = -67.3028,
+},
+{ .is_ngc = TRUE,
+  .id = 1815,
+  .ra = 75.6129,
+  .dec = -70.62,
+},
+{ .is_ngc = TRUE,
+  .id = 1816,
+  .ra = 75.9633,
+  .dec = -67.2608,
+},
+{ .is_ngc = TRUE,
+  .id = 1817,
+  .ra = 78.0625,
+  .dec = 16.6844,
+},
+{ .is_ngc = TRUE,
+  .id = 1818,
+  .ra = 76.0588,
+  .dec = -66.435,
+},
+{ .is_ngc = TRUE,
+  .id = 1819,
+  .ra = 77.9423,
+  .dec = 5.20028,
+},
+{ .is_ngc = TRUE,
+  .id = 1820,
+  .ra = 76.0167,
+  .dec = -67.2675,
+},
+{ .is_ngc = TRUE,
+  .id = 1821,
+  .ra = 77.9421,
+  .dec = -15.135,
+},
+{ .is_ngc = TRUE,
+  .id = 1822,
+  .ra = 76.2854,
+  .dec = -66.2119,
+},
+{ .is_ngc = TRUE,
+  .id = 1823,
+  .ra = 75.8513,
+  .dec = -70.3358,
+},
+{ .is_ngc = TRUE,
+  .id = 1824,
+  .ra = 76.7338,
+  .dec = -59.7247,
+},
+{ .is_ngc = TRUE,
+  .id = 1825,
+  .ra = 76.0792,
+  .dec = -68.9264,
+},
+{ .is_ngc = TRUE,
+  .id = 1826,
+  .ra = 76.3907,
+  .dec = -66.2306,
+},
+{ .is_ngc = TRUE,
+  .id = 1827,
+  .ra = 77.5167,
+  .dec = -36.9594,
+},
+{ .is_ngc = TRUE,
+  .id = 1828,
+  .ra = 76.0866,
+  .dec = -69.3883,
+},
+{ .is_ngc = TRUE,
+  .id = 1829,
+  .ra = 76.2417,
+  .dec = -68.0583,
+},
+{ .is_ngc = TRUE,
+  .id = 1830,
+  .ra = 76.1624,
+  .dec = -69.3409,
+},
+{ .is_ngc = TRUE,
+  .id = 1831,
+  .ra = 76.5696,
+  .dec = -64.9185,
+},
+{ .is_ngc = TRUE,
+  .id = 1832,
+  .ra = 78.0133,
+  .dec = -15.6883,
+},
+{ .is_ngc = TRUE,
+  .id = 1833,
+  .ra = 76.0925,
+  .dec = -70.7319,
+},
+{ .is_ngc = TRUE,
+  .id = 1834,
+  .ra = 76.2992,
+  .dec = -69.2075,
+},
+{ .is_ngc = TRUE,
+  .id = 1835,
+  .ra = 76.2755,
+  .dec = -69.4039,
+},
+{ .is_ngc = TRUE,
+  .id = 1836,
+  .ra = 76.3979,
+  .dec = -68.6283,
+},
+{ .is_ngc = TRUE,
+  .id = 1837,
+  .ra = 76.2292,
+  .dec = -70.7167,
+},
+{ .is_ngc = TRUE,
+  .id = 1838,
+  .ra = 76.6958,
+  .dec = -68.4178,
+},
+{ .is_ngc = TRUE,
+  .id = 1839,
+  .ra = 76.5083,
+  .dec = -68.6186,
+},
+{ .is_ngc = TRUE,
+  .id = 1840,
+  .ra = 76.3312,
+  .dec = -71.7631,
+},
+{ .is_ngc = TRUE,
+  .id = 1841,
+  .ra = 71.3491,
+  .dec = -83.9983,
+},
+{ .is_ngc = TRUE,
+  .id = 1842,
+  .ra = 76.8275,
+  .dec = -67.2731,
+},
+{ .is_ngc = TRUE,
+  .id = 1843,
+  .ra = 78.5254,
+  .dec = -10.6269,
+},
+{ .is_ngc = TRUE,
+  .id = 1844,
+  .ra = 76.8775,
+  .dec = -67.3239,
+},
+{ .is_ngc = TRUE,
+  .id = 1845,
+  .ra = 76.4417,
+  .dec = -70.5836,
+},
+{ .is_ngc = TRUE,
+  .id = 1846,
+  .ra = 76.8929,
+  .dec = -67.4606,
+},
+{ .is_ngc = TRUE,
+  .id = 1847,
+  .ra = 76.7837,
+  .dec = -68.9717,
+},
+{ .is_ngc = TRUE,
+  .id = 1848,
+  .ra = 76.8667,
+  .dec = -71.1853,
+},
+{ .is_ngc = TRUE,
+  .id = 1849,
+  .ra = 77.3946,
+  .dec = -66.3164,
+},
+{ .is_ngc = TRUE,
+  .id = 1850,
+  .ra = 77.1888,
+  .dec = -68.7616,
+},
+{ .is_ngc = TRUE,
+  .id = 1851,
+  .ra = 78.5276,
+  .dec = -40.0463,
+},
+{ .is_ngc = TRUE,
+  .id = 1852,
+  .ra = 77.35,
+  .dec = -67.7786,
+},
+{ .is_ngc = TRUE,
+  .id = 1853,
+  .ra = 78.0675,
+  .dec = -57.3992,
+},
+{ .is_ngc = TRUE,
+  .id = 1854,
+  .ra = 77.335,
+  .dec = -68.8481,
+},
+{ .is_ngc = TRUE,
+  .id = 1855,
+  .ra = 77.3167,
+  .dec = -68.8353,
+},
+{ .is_ngc = TRUE,
+  .id = 1856,
+  .ra = 77.3754,
+  .dec = -69.1281,
+},
+{ .is_ngc = TRUE,
+  .id = 1857,
+  .ra = 80.0208,
+  .dec = 39.3181,
+},
+{ .is_ngc = TRUE,
+  .id = 1858,
+  .ra = 77.4792,
+  .dec = -68.8858,
+},
+{ .is_ngc = TRUE,
+  .id = 1859,
+  .ra = 77.885,
+  .dec = -65.2492,
+},
+{ .is_ngc = TRUE,
+  .id = 1860,
+  .ra = 77.6646,
+  .dec = -68.7531,
+},
+{ .is_ngc = TRUE,
+  .id = 1861,
+  .ra = 77.5896,
+  .dec = -70.7778,
+},
+{ .is_ngc = TRUE,
+  .id = 1862,
+  .ra = 78.1421,
+  .dec = -66.1547,
+},
+{ .is_ngc = TRUE,
+  .id = 1863,
+  .ra = 77.9167,
+  .dec = -68.7272,
+},
+{ .is_ngc = TRUE,
+  .id = 1864,
+  .ra = 78.17,
+  .dec = -67.6225,
+},
+{ .is_ngc = TRUE,
+  .id = 1865,
+  .ra = 78.105,
+  .dec = -68.7714,
+},
+{ .is_ngc = TRUE,
+  .id = 1866,
+  .ra = 78.4125,
+  .dec = -65.4644,
+},
+{ .is_ngc = TRUE,
+  .id = 1867,
+  .ra = 78.4258,
+  .dec = -66.2942,
+},
+{ .is_ngc = TRUE,
+  .id = 1868,
+  .ra = 78.6513,
+  .dec = -63.9547,
+},
+{ .is_ngc = TRUE,
+  .id = 1869,
+  .ra = 78.4642,
+  .dec = -67.3775,
+},
+{ .is_ngc = TRUE,
+  .id = 1869,
+  .ra = 78.3625,
+  .dec = -67.3675,
+},
+{ .is_ngc = TRUE,
+  .id = 1870,
+  .ra = 78.2954,
+  .dec = -69.1175,
+},
+{ .is_ngc = TRUE,
+  .id = 1871,
+  .ra = 78.4667,
+  .dec = -67.4525,
+},
+{ .is_ngc = TRUE,
+  .id = 1872,
+  .ra = 78.2978,
+  .dec = -69.314,
+},
+{ .is_ngc = TRUE,
+  .id = 1873,
+  .ra = 78.4825,
+  .dec = -67.3336,
+},
+{ .is_ngc = TRUE,
+  .id = 1873,
+  .ra = 78.5071,
+  .dec = -67.3314,
+},
+{ .is_ngc = TRUE,
+  .id = 1874,
+  .ra = 78.3,
+  .dec = -69.3764,
+},
+{ .is_ngc = TRUE,
+  .id = 1875,
+  .ra = 80.4411,
+  .dec = 6.68844,
+},
+{ .is_ngc = TRUE,
+  .id = 1876,
+  .ra = 78.3275,
+  .dec = -69.3631,
+},
+{ .is_ngc = TRUE,
+  .id = 1877,
+  .ra = 78.412,
+  .dec = -69.3838,
+},
+{ .is_ngc = TRUE,
+  .id = 1877,
+  .ra = 78.3292,
+  .dec = -69.3681,
+},
+{ .is_ngc = TRUE,
+  .id = 1878,
+  .ra = 78.2104,
+  .dec = -70.4717,
+},
+{ .is_ngc = TRUE,
+  .id = 1879,
+  .ra = 79.9508,
+  .dec = -32.1422,
+},
+{ .is_ngc = TRUE,
+  .id = 1880,
+  .ra = 78.4133,
+  .dec = -69.3811,
+},
+{ .is_ngc = TRUE,
+  .id = 1880,
+  .ra = 78.2875,
+  .dec = -69.3681,
+},
+{ .is_ngc = TRUE,
+  .id = 1881,
+  .ra = 78.4,
+  .dec = -69.2858,
+},
+{ .is_ngc = TRUE,
+  .id = 1882,
+  .ra = 78.8879,
+  .dec = -66.1303,
+},
+{ .is_ngc = TRUE,
+  .id = 1883,
+  .ra = 81.475,
+  .dec = 46.4844,
+},
+{ .is_ngc = TRUE,
+  .id = 1884,
+  .ra = 78.9917,
+  .dec = -66.1522,
+},
+{ .is_ngc = TRUE,
+  .id = 1885,
+  .ra = 78.7788,
+  .dec = -68.9783,
+},
+{ .is_ngc = TRUE,
+  .id = 1886,
+  .ra = 80.4517,
+  .dec = -23.8114,
+},
+{ .is_ngc = TRUE,
+  .id = 1887,
+  .ra = 79.0233,
+  .dec = -66.3192,
+},
+{ .is_ngc = TRUE,
+  .id = 1888,
+  .ra = 80.6437,
+  .dec = -11.5,
+},
+{ .is_ngc = TRUE,
+  .id = 1889,
+  .ra = 80.6471,
+  .dec = -11.4969,
+},
+{ .is_ngc = TRUE,
+  .id = 1890,
+  .ra = 78.4454,
+  .dec = -72.0786,
+},
+{ .is_ngc = TRUE,
+  .id = 1891,
+  .ra = 80.4333,
+  .dec = -35.7844,
+},
+{ .is_ngc = TRUE,
+  .id = 1891,
+  .ra = 80.35,
+  .dec = -35.7164,
+},
+{ .is_ngc = TRUE,
+  .id = 1892,
+  .ra = 79.2867,
+  .dec = -64.9606,
+},
+{ .is_ngc = TRUE,
+  .id = 1893,
+  .ra = 80.6875,
+  .dec = 33.4019,
+},
+{ .is_ngc = TRUE,
+  .id = 1894,
+  .ra = 78.9637,
+  .dec = -69.4692,
+},
+{ .is_ngc = TRUE,
+  .id = 1895,
+  .ra = 79.2125,
+  .dec = -67.3189,
+},
+{ .is_ngc = TRUE,
+  .id = 1896,
+  .ra = 81.3917,
+  .dec = 29.2517,
+},
+{ .is_ngc = TRUE,
+  .id = 1896,
+  .ra = 81.35,
+  .dec = 29.1514,
+},
+{ .is_ngc = TRUE,
+  .id = 1897,
+  .ra = 79.3825,
+  .dec = -67.4492,
+},
+{ .is_ngc = TRUE,
+  .id = 1898,
+  .ra = 79.175,
+  .dec = -69.6514,
+},
+{ .is_ngc = TRUE,
+  .id = 1899,
+  .ra = 79.4458,
+  .dec = -67.9003,
+},
+{ .is_ngc = TRUE,
+  .id = 1900,
+  .ra = 79.7879,
+  .dec = -63.0233,
+},
+{ .is_ngc = TRUE,
+  .id = 1901,
+  .ra = 79.5667,
+  .dec = -68.435,
+},
+{ .is_ngc = TRUE,
+  .id = 1902,
+  .ra = 79.5785,
+  .dec = -66.6265,
+},
+{ .is_ngc = TRUE,
+  .id = 1903,
+  .ra = 79.3442,
+  .dec = -69.3358,
+},
+{ .is_ngc = TRUE,
+  .id = 1904,
+  .ra = 81.0442,
+  .dec = -24.5248,
+},
+{ .is_ngc = TRUE,
+  .id = 1905,
+  .ra = 79.5958,
+  .dec = -67.2781,
+},
+{ .is_ngc = TRUE,
+  .id = 1906,
+  .ra = 81.1963,
+  .dec = -15.9429,
+},
+{ .is_ngc = TRUE,
+  .id = 1907,
+  .ra = 82.0208,
+  .dec = 35.3181,
+},
+{ .is_ngc = TRUE,
+  .id = 1908,
+  .ra = 81.4708,
+  .dec = -2.51861,
+},
+{ .is_ngc = TRUE,
+  .id = 1910,
+  .ra = 79.6392,
+  .dec = -69.2303,
+},
+{ .is_ngc = TRUE,
+  .id = 1910,
+  .ra = 79.5487,
+  .dec = -69.2217,
+},
+{ .is_ngc = TRUE,
+  .id = 1911,
+  .ra = 79.855,
+  .dec = -66.6817,
+},
+{ .is_ngc = TRUE,
+  .id = 1912,
+  .ra = 82.1667,
+  .dec = 35.8358,
+},
+{ .is_ngc = TRUE,
+  .id = 1913,
+  .ra = 79.5804,
+  .dec = -69.5367,
+},
+{ .is_ngc = TRUE,
+  .id = 1914,
+  .ra = 79.4137,
+  .dec = -71.2561,
+},
+{ .is_ngc = TRUE,
+  .id = 1915,
+  .ra = 79.9262,
+  .dec = -66.8214,
+},
+{ .is_ngc = TRUE,
+  .id = 1916,
+  .ra = 79.6542,
+  .dec = -69.4014,
+},
+{ .is_ngc = TRUE,
+  .id = 1916,
+  .ra = 79.3612,
+  .dec = -69.3758,
+},
+{ .is_ngc = TRUE,
+  .id = 1917,
+  .ra = 79.7542,
+  .dec = -68.9858,
+},
+{ .is_ngc = TRUE,
+  .id = 1918,
+  .ra = 79.7792,
+  .dec = -69.6519,
+},
+{ .is_ngc = TRUE,
+  .id = 1918,
+  .ra = 79.8167,
+  .dec = -69.6506,
+},
+{ .is_ngc = TRUE,
+  .id = 1920,
+  .ra = 80.1525,
+  .dec = -66.7789,
+},
+{ .is_ngc = TRUE,
+  .id = 1921,
+  .ra = 79.8375,
+  .dec = -69.7842,
+},
+{ .is_ngc = TRUE,
+  .id = 1922,
+  .ra = 79.9592,
+  .dec = -69.5017,
+},
+{ .is_ngc = TRUE,
+  .id = 1922,
+  .ra = 79.95,
+  .dec = -69.4358,
+},
+{ .is_ngc = TRUE,
+  .id = 1923,
+  .ra = 80.3896,
+  .dec = -65.4872,
+},
+{ .is_ngc = TRUE,
+  .id = 1924,
+  .ra = 82.0083,
+  .dec = -5.3107,
+},
+{ .is_ngc = TRUE,
+  .id = 1925,
+  .ra = 80.3708,
+  .dec = -65.8022,
+},
+{ .is_ngc = TRUE,
+  .id = 1925,
+  .ra = 80.4292,
+  .dec = -65.785,
+},
+{ .is_ngc = TRUE,
+  .id = 1926,
+  .ra = 80.145,
+  .dec = -69.5256,
+},
+{ .is_ngc = TRUE,
+  .id = 1927,
+  .ra = 82.175,
+  .dec = -8.36833,
+},
+{ .is_ngc = TRUE,
+  .id = 1928,
+  .ra = 80.2392,
+  .dec = -69.4783,
+},
+{ .is_ngc = TRUE,
+  .id = 1929,
+  .ra = 80.4042,
+  .dec = -67.9022,
+},
+{ .is_ngc = TRUE,
+  .id = 1930,
+  .ra = 81.4854,
+  .dec = -46.7286,
+},
+{ .is_ngc = TRUE,
+  .id = 1931,
+  .ra = 82.8542,
+  .dec = 34.2353,
+},
+{ .is_ngc = TRUE,
+  .id = 1932,
+  .ra = 80.5719,
+  .dec = -66.1543,
+},
+{ .is_ngc = TRUE,
+  .id = 1932,
+  .ra = 80.6142,
+  .dec = -66.1514,
+},
+{ .is_ngc = TRUE,
+  .id = 1933,
+  .ra = 80.614,
+  .dec = -66.1525,
+},
+{ .is_ngc = TRUE,
+  .id = 1933,
+  .ra = 80.5717,
+  .dec = -66.1539,
+},
+{ .is_ngc = TRUE,
+  .id = 1934,
+  .ra = 80.4708,
+  .dec = -67.9025,
+},
+{ .is_ngc = TRUE,
+  .id = 1934,
+  .ra = 80.4458,
+  .dec = -67.9339,
+},
+{ .is_ngc = TRUE,
+  .id = 1937,
+  .ra = 80.5962,
+  .dec = -67.8997,
+},
+{ .is_ngc = TRUE,
+  .id = 1937,
+  .ra = 80.6208,
+  .dec = -67.8853,
+},
+{ .is_ngc = TRUE,
+  .id = 1938,
+  .ra = 80.3496,
+  .dec = -69.9406,
+},
+{ .is_ngc = TRUE,
+  .id = 1938,
+  .ra = 80.3629,
+  .dec = -69.9497,
+},
+{ .is_ngc = TRUE,
+  .id = 1939,
+  .ra = 80.3595,
+  .dec = -69.95,
+},
+{ .is_ngc = TRUE,
+  .id = 1939,
+  .ra = 80.3512,
+  .dec = -69.9386,
+},
+{ .is_ngc = TRUE,
+  .id = 1940,
+  .ra = 80.6842,
+  .dec = -67.1861,
+},
+{ .is_ngc = TRUE,
+  .id = 1941,
+  .ra = 80.7788,
+  .dec = -66.3789,
+},
+{ .is_ngc = TRUE,
+  .id = 1942,
+  .ra = 81.1817,
+  .dec = -63.94,
+},
+{ .is_ngc = TRUE,
+  .id = 1943,
+  .ra = 80.6167,
+  .dec = -70.1506,
+},
+{ .is_ngc = TRUE,
+  .id = 1944,
+  .ra = 80.4887,
+  .dec = -72.4942,
+},
+{ .is_ngc = TRUE,
+  .id = 1945,
+  .ra = 81.225,
+  .dec = -66.4506,
+},
+{ .is_ngc = TRUE,
+  .id = 1946,
+  .ra = 81.3163,
+  .dec = -66.3939,
+},
+{ .is_ngc = TRUE,
+  .id = 1947,
+  .ra = 81.6973,
+  .dec = -63.7609,
+},
+{ .is_ngc = TRUE,
+  .id = 1948,
+  .ra = 81.4375,
+  .dec = -66.2667,
+},
+{ .is_ngc = TRUE,
+  .id = 1949,
+  .ra = 81.2742,
+  .dec = -68.4719,
+},
+{ .is_ngc = TRUE,
+  .id = 1950,
+  .ra = 81.1358,
+  .dec = -69.9019,
+},
+{ .is_ngc = TRUE,
+  .id = 1951,
+  .ra = 81.5279,
+  .dec = -66.5964,
+},
+{ .is_ngc = TRUE,
+  .id = 1952,
+  .ra = 83.6332,
+  .dec = 22.0145,
+},
+{ .is_ngc = TRUE,
+  .id = 1953,
+  .ra = 81.3625,
+  .dec = -68.8339,
+},
+{ .is_ngc = TRUE,
+  .id = 1954,
+  .ra = 83.2011,
+  .dec = -14.0628,
+},
+{ .is_ngc = TRUE,
+  .id = 1955,
+  .ra = 81.5363,
+  .dec = -67.4978,
+},
+{ .is_ngc = TRUE,
+  .id = 1956,
+  .ra = 79.8954,
+  .dec = -77.7303,
+},
+{ .is_ngc = TRUE,
+  .id = 1957,
+  .ra = 83.2295,
+  .dec = -14.1331,
+},
+{ .is_ngc = TRUE,
+  .id = 1958,
+  .ra = 81.3754,
+  .dec = -69.8358,
+},
+{ .is_ngc = TRUE,
+  .id = 1959,
+  .ra = 81.4017,
+  .dec = -69.9258,
+},
+{ .is_ngc = TRUE,
+  .id = 1960,
+  .ra = 84.075,
+  .dec = 34.1344,
+},
+{ .is_ngc = TRUE,
+  .id = 1962,
+  .ra = 81.5775,
+  .dec = -68.8375,
+},
+{ .is_ngc = TRUE,
+  .id = 1963,
+  .ra = 83.0667,
+  .dec = -36.3858,
+},
+{ .is_ngc = TRUE,
+  .id = 1964,
+  .ra = 83.3406,
+  .dec = -21.9462,
+},
+{ .is_ngc = TRUE,
+  .id = 1965,
+  .ra = 81.6217,
+  .dec = -68.8072,
+},
+{ .is_ngc = TRUE,
+  .id = 1966,
+  .ra = 81.6875,
+  .dec = -68.8025,
+},
+{ .is_ngc = TRUE,
+  .id = 1967,
+  .ra = 81.6825,
+  .dec = -69.1008,
+},
+{ .is_ngc = TRUE,
+  .id = 1968,
+  .ra = 81.85,
+  .dec = -67.4522,
+},
+{ .is_ngc = TRUE,
+  .id = 1968,
+  .ra = 81.9154,
+  .dec = -67.455,
+},
+{ .is_ngc = TRUE,
+  .id = 1969,
+  .ra = 81.6342,
+  .dec = -69.8414,
+},
+{ .is_ngc = TRUE,
+  .id = 1970,
+  .ra = 81.7208,
+  .dec = -68.8336,
+},
+{ .is_ngc = TRUE,
+  .id = 1970,
+  .ra = 81.6888,
+  .dec = -68.8303,
+},
+{ .is_ngc = TRUE,
+  .id = 1971,
+  .ra = 81.6879,
+  .dec = -69.8514,
+},
+{ .is_ngc = TRUE,
+  .id = 1972,
+  .ra = 81.6983,
+  .dec = -69.8375,
+},
+{ .is_ngc = TRUE,
+  .id = 1973,
+  .ra = 83.77,
+  .dec = -4.73186,
+},
+{ .is_ngc = TRUE,
+  .id = 1975,
+  .ra = 83.8254,
+  .dec = -4.68472,
+},
+{ .is_ngc = TRUE,
+  .id = 1976,
+  .ra = 83.8182,
+  .dec = -5.39022,
+},
+{ .is_ngc = TRUE,
+  .id = 1977,
+  .ra = 83.8167,
+  .dec = -4.82083,
+},
+{ .is_ngc = TRUE,
+  .id = 1978,
+  .ra = 82.1878,
+  .dec = -66.2366,
+},
+{ .is_ngc = TRUE,
+  .id = 1979,
+  .ra = 83.5045,
+  .dec = -23.3099,
+},
+{ .is_ngc = TRUE,
+  .id = 1980,
+  .ra = 83.853,
+  .dec = -5.91507,
+},
+{ .is_ngc = TRUE,
+  .id = 1981,
+  .ra = 83.7875,
+  .dec = -4.41917,
+},
+{ .is_ngc = TRUE,
+  .id = 1982,
+  .ra = 83.8806,
+  .dec = -5.2675,
+},
+{ .is_ngc = TRUE,
+  .id = 1983,
+  .ra = 81.9333,
+  .dec = -68.9833,
+},
+{ .is_ngc = TRUE,
+  .id = 1984,
+  .ra = 81.9167,
+  .dec = -69.1333,
+},
+{ .is_ngc = TRUE,
+  .id = 1985,
+  .ra = 84.4492,
+  .dec = 31.9888,
+},
+{ .is_ngc = TRUE,
+  .id = 1986,
+  .ra = 81.91,
+  .dec = -69.9722,
+},
+{ .is_ngc = TRUE,
+  .id = 1987,
+  .ra = 81.8192,
+  .dec = -70.7372,
+},
+{ .is_ngc = TRUE,
+  .id = 1988,
+  .ra = 84.3603,
+  .dec = 21.2182,
+},
+{ .is_ngc = TRUE,
+  .id = 1989,
+  .ra = 83.5971,
+  .dec = -30.8008,
+},
+{ .is_ngc = TRUE,
+  .id = 1990,
+  .ra = 84.0533,
+  .dec = -1.20193,
+},
+{ .is_ngc = TRUE,
+  .id = 1992,
+  .ra = 83.6329,
+  .dec = -30.8967,
+},
+{ .is_ngc = TRUE,
+  .id = 1993,
+  .ra = 83.8562,
+  .dec = -17.8153,
+},
+{ .is_ngc = TRUE,
+  .id = 1994,
+  .ra = 82.0942,
+  .dec = -69.1408,
+},
+{ .is_ngc = TRUE,
+  .id = 1995,
+  .ra = 83.2638,
+  .dec = -48.675,
+},
+{ .is_ngc = TRUE,
+  .id = 1996,
+  .ra = 84.5425,
+  .dec = 25.8172,
+},
+{ .is_ngc = TRUE,
+  .id = 1997,
+  .ra = 82.6446,
+  .dec = -63.2033,
+},
+{ .is_ngc = TRUE,
+  .id = 1998,
+  .ra = 83.3146,
+  .dec = -48.6956,
+},
+{ .is_ngc = TRUE,
+  .id = 1999,
+  .ra = 84.1057,
+  .dec = -6.71586,
+},
+{ .is_ngc = TRUE,
+  .id = 2000,
+  .ra = 81.8746,
+  .dec = -71.8797,
+},
+{ .is_ngc = TRUE,
+  .id = 2001,
+  .ra = 82.2583,
+  .dec = -68.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 2001,
+  .ra = 82.2842,
+  .dec = -68.7544,
+},
+{ .is_ngc = TRUE,
+  .id = 2002,
+  .ra = 82.5875,
+  .dec = -66.8839,
+},
+{ .is_ngc = TRUE,
+  .id = 2003,
+  .ra = 82.725,
+  .dec = -66.4667,
+},
+{ .is_ngc = TRUE,
+  .id = 2003,
+  .ra = 82.6704,
+  .dec = -67.2878,
+},
+{ .is_ngc = TRUE,
+  .id = 2004,
+  .ra = 82.6667,
+  .dec = -67.2842,
+},
+{ .is_ngc = TRUE,
+  .id = 2005,
+  .ra = 82.5442,
+  .dec = -69.7522,
+},
+{ .is_ngc = TRUE,
+  .id = 2006,
+  .ra = 82.8321,
+  .dec = -66.9725,
+},
+{ .is_ngc = TRUE,
+  .id = 2007,
+  .ra = 83.7458,
+  .dec = -50.9217,
+},
+{ .is_ngc = TRUE,
+  .id = 2008,
+  .ra = 83.7658,
+  .dec = -50.9667,
+},
+{ .is_ngc = TRUE,
+  .id = 2009,
+  .ra = 82.7488,
+  .dec = -69.1806,
+},
+{ .is_ngc = TRUE,
+  .id = 2010,
+  .ra = 82.645,
+  .dec = -70.8194,
+},
+{ .is_ngc = TRUE,
+  .id = 2011,
+  .ra = 83.0825,
+  .dec = -67.5228,
+},
+{ .is_ngc = TRUE,
+  .id = 2012,
+  .ra = 80.6458,
+  .dec = -79.8517,
+},
+{ .is_ngc = TRUE,
+  .id = 2013,
+  .ra = 86.0042,
+  .dec = 55.785,
+},
+{ .is_ngc = TRUE,
+  .id = 2014,
+  .ra = 83.0792,
+  .dec = -67.6842,
+},
+{ .is_ngc = TRUE,
+  .id = 2014,
+  .ra = 83.0904,
+  .dec = -67.6992,
+},
+{ .is_ngc = TRUE,
+  .id = 2015,
+  .ra = 83.025,
+  .dec = -69.235,
+},
+{ .is_ngc = TRUE,
+  .id = 2015,
+  .ra = 82.9917,
+  .dec = -69.235,
+},
+{ .is_ngc = TRUE,
+  .id = 2016,
+  .ra = 82.9,
+  .dec = -69.9347,
+},
+{ .is_ngc = TRUE,
+  .id = 2017,
+  .ra = 84.8163,
+  .dec = -17.8494,
+},
+{ .is_ngc = TRUE,
+  .id = 2018,
+  .ra = 82.8379,
+  .dec = -71.0697,
+},
+{ .is_ngc = TRUE,
+  .id = 2018,
+  .ra = 82.7983,
+  .dec = -71.0694,
+},
+{ .is_ngc = TRUE,
+  .id = 2019,
+  .ra = 82.9833,
+  .dec = -70.1517,
+},
+{ .is_ngc = TRUE,
+  .id = 2020,
+  .ra = 83.2958,
+  .dec = -67.7025,
+},
+{ .is_ngc = TRUE,
+  .id = 2021,
+  .ra = 83.3758,
+  .dec = -67.4528,
+},
+{ .is_ngc = TRUE,
+  .id = 2022,
+  .ra = 85.5257,
+  .dec = 9.08644,
+},
+{ .is_ngc = TRUE,
+  .id = 2023,
+  .ra = 85.4098,
+  .dec = -2.25911,
+},
+{ .is_ngc = TRUE,
+  .id = 2024,
+  .ra = 85.425,
+  .dec = -1.85111,
+},
+{ .is_ngc = TRUE,
+  .id = 2025,
+  .ra = 83.14,
+  .dec = -71.7172,
+},
+{ .is_ngc = TRUE,
+  .id = 2026,
+  .ra = 85.7583,
+  .dec = 20.1333,
+},
+{ .is_ngc = TRUE,
+  .id = 2027,
+  .ra = 83.7533,
+  .dec = -66.9161,
+},
+{ .is_ngc = TRUE,
+  .id = 2028,
+  .ra = 83.4542,
+  .dec = -69.9514,
+},
+{ .is_ngc = TRUE,
+  .id = 2029,
+  .ra = 83.9083,
+  .dec = -66.0333,
+},
+{ .is_ngc = TRUE,
+  .id = 2030,
+  .ra = 83.7521,
+  .dec = -67.555,
+},
+{ .is_ngc = TRUE,
+  .id = 2030,
+  .ra = 83.9212,
+  .dec = -66.0342,
+},
+{ .is_ngc = TRUE,
+  .id = 2031,
+  .ra = 83.4221,
+  .dec = -70.9864,
+},
+{ .is_ngc = TRUE,
+  .id = 2032,
+  .ra = 83.8329,
+  .dec = -67.5769,
+},
+{ .is_ngc = TRUE,
+  .id = 2032,
+  .ra = 83.8333,
+  .dec = -67.5669,
+},
+{ .is_ngc = TRUE,
+  .id = 2033,
+  .ra = 83.6262,
+  .dec = -69.78,
+},
+{ .is_ngc = TRUE,
+  .id = 2034,
+  .ra = 83.8833,
+  .dec = -66.9006,
+},
+{ .is_ngc = TRUE,
+  .id = 2034,
+  .ra = 83.9292,
+  .dec = -66.8856,
+},
+{ .is_ngc = TRUE,
+  .id = 2035,
+  .ra = 83.8808,
+  .dec = -67.5842,
+},
+{ .is_ngc = TRUE,
+  .id = 2036,
+  .ra = 83.6333,
+  .dec = -70.0658,
+},
+{ .is_ngc = TRUE,
+  .id = 2037,
+  .ra = 83.7229,
+  .dec = -69.7369,
+},
+{ .is_ngc = TRUE,
+  .id = 2038,
+  .ra = 83.6737,
+  .dec = -70.5617,
+},
+{ .is_ngc = TRUE,
+  .id = 2039,
+  .ra = 86,
+  .dec = 8.68472,
+},
+{ .is_ngc = TRUE,
+  .id = 2040,
+  .ra = 84.0254,
+  .dec = -67.5667,
+},
+{ .is_ngc = TRUE,
+  .id = 2041,
+  .ra = 84.1183,
+  .dec = -66.99,
+},
+{ .is_ngc = TRUE,
+  .id = 2042,
+  .ra = 84.04,
+  .dec = -68.9253,
+},
+{ .is_ngc = TRUE,
+  .id = 2043,
+  .ra = 83.9958,
+  .dec = -70.0681,
+},
+{ .is_ngc = TRUE,
+  .id = 2043,
+  .ra = 83.85,
+  .dec = -70.1175,
+},
+{ .is_ngc = TRUE,
+  .id = 2044,
+  .ra = 84.0263,
+  .dec = -69.1972,
+},
+{ .is_ngc = TRUE,
+  .id = 2045,
+  .ra = 86.2555,
+  .dec = 12.888,
+},
+{ .is_ngc = TRUE,
+  .id = 2046,
+  .ra = 83.9075,
+  .dec = -70.2414,
+},
+{ .is_ngc = TRUE,
+  .id = 2047,
+  .ra = 83.9733,
+  .dec = -70.1919,
+},
+{ .is_ngc = TRUE,
+  .id = 2048,
+  .ra = 83.9792,
+  .dec = -69.65,
+},
+{ .is_ngc = TRUE,
+  .id = 2049,
+  .ra = 85.8129,
+  .dec = -30.0783,
+},
+{ .is_ngc = TRUE,
+  .id = 2050,
+  .ra = 84.1667,
+  .dec = -69.3836,
+},
+{ .is_ngc = TRUE,
+  .id = 2050,
+  .ra = 84.2208,
+  .dec = -69.3678,
+},
+{ .is_ngc = TRUE,
+  .id = 2051,
+  .ra = 84.0321,
+  .dec = -71.0119,
+},
+{ .is_ngc = TRUE,
+  .id = 2052,
+  .ra = 84.3,
+  .dec = -69.7678,
+},
+{ .is_ngc = TRUE,
+  .id = 2053,
+  .ra = 84.4179,
+  .dec = -67.4136,
+},
+{ .is_ngc = TRUE,
+  .id = 2054,
+  .ra = 86.3146,
+  .dec = -10.0831,
+},
+{ .is_ngc = TRUE,
+  .id = 2055,
+  .ra = 84.2625,
+  .dec = -69.4192,
+},
+{ .is_ngc = TRUE,
+  .id = 2056,
+  .ra = 84.1425,
+  .dec = -70.6714,
+},
+{ .is_ngc = TRUE,
+  .id = 2057,
+  .ra = 84.2313,
+  .dec = -70.2703,
+},
+{ .is_ngc = TRUE,
+  .id = 2058,
+  .ra = 84.2267,
+  .dec = -70.1633,
+},
+{ .is_ngc = TRUE,
+  .id = 2059,
+  .ra = 84.2525,
+  .dec = -70.1292,
+},
+{ .is_ngc = TRUE,
+  .id = 2060,
+  .ra = 84.4458,
+  .dec = -69.1675,
+},
+{ .is_ngc = TRUE,
+  .id = 2061,
+  .ra = 85.6746,
+  .dec = -34.0044,
+},
+{ .is_ngc = TRUE,
+  .id = 2062,
+  .ra = 85.0138,
+  .dec = -66.8758,
+},
+{ .is_ngc = TRUE,
+  .id = 2063,
+  .ra = 86.6792,
+  .dec = 8.76917,
+},
+{ .is_ngc = TRUE,
+  .id = 2064,
+  .ra = 86.5766,
+  .dec = 0.00594444,
+},
+{ .is_ngc = TRUE,
+  .id = 2065,
+  .ra = 84.4038,
+  .dec = -70.2364,
+},
+{ .is_ngc = TRUE,
+  .id = 2066,
+  .ra = 84.4254,
+  .dec = -70.1667,
+},
+{ .is_ngc = TRUE,
+  .id = 2067,
+  .ra = 86.6292,
+  .dec = 0.119167,
+},
+{ .is_ngc = TRUE,
+  .id = 2067,
+  .ra = 86.6096,
+  .dec = 0.095,
+},
+{ .is_ngc = TRUE,
+  .id = 2068,
+  .ra = 86.6875,
+  .dec = 0.0688889,
+},
+{ .is_ngc = TRUE,
+  .id = 2069,
+  .ra = 84.6667,
+  .dec = -69.0008,
+},
+{ .is_ngc = TRUE,
+  .id = 2069,
+  .ra = 84.6917,
+  .dec = -68.9681,
+},
+{ .is_ngc = TRUE,
+  .id = 2070,
+  .ra = 84.6769,
+  .dec = -69.1009,
+},
+{ .is_ngc = TRUE,
+  .id = 2071,
+  .ra = 86.7803,
+  .dec = 0.29425,
+},
+{ .is_ngc = TRUE,
+  .id = 2072,
+  .ra = 84.6004,
+  .dec = -70.2339,
+},
+{ .is_ngc = TRUE,
+  .id = 2073,
+  .ra = 86.4742,
+  .dec = -21.9997,
+},
+{ .is_ngc = TRUE,
+  .id = 2074,
+  .ra = 84.7625,
+  .dec = -69.4858,
+},
+{ .is_ngc = TRUE,
+  .id = 2075,
+  .ra = 84.5862,
+  .dec = -70.6856,
+},
+{ .is_ngc = TRUE,
+  .id = 2076,
+  .ra = 86.6976,
+  .dec = -16.7822,
+},
+{ .is_ngc = TRUE,
+  .id = 2077,
+  .ra = 84.8971,
+  .dec = -69.6558,
+},
+{ .is_ngc = TRUE,
+  .id = 2078,
+  .ra = 84.9125,
+  .dec = -69.735,
+},
+{ .is_ngc = TRUE,
+  .id = 2079,
+  .ra = 84.9125,
+  .dec = -69.7678,
+},
+{ .is_ngc = TRUE,
+  .id = 2080,
+  .ra = 84.9358,
+  .dec = -69.6458,
+},
+{ .is_ngc = TRUE,
+  .id = 2081,
+  .ra = 85.0042,
+  .dec = -69.4006,
+},
+{ .is_ngc = TRUE,
+  .id = 2082,
+  .ra = 85.4628,
+  .dec = -64.3014,
+},
+{ .is_ngc = TRUE,
+  .id = 2083,
+  .ra = 84.9917,
+  .dec = -69.7339,
+},
+{ .is_ngc = TRUE,
+  .id = 2084,
+  .ra = 85.0292,
+  .dec = -69.7517,
+},
+{ .is_ngc = TRUE,
+  .id = 2085,
+  .ra = 85.0387,
+  .dec = -69.6731,
+},
+{ .is_ngc = TRUE,
+  .id = 2086,
+  .ra = 85.05,
+  .dec = -69.6669,
+},
+{ .is_ngc = TRUE,
+  .id = 2087,
+  .ra = 86.0658,
+  .dec = -55.5333,
+},
+{ .is_ngc = TRUE,
+  .id = 2088,
+  .ra = 85.2492,
+  .dec = -68.4644,
+},
+{ .is_ngc = TRUE,
+  .id = 2089,
+  .ra = 86.9642,
+  .dec = -17.6025,
+},
+{ .is_ngc = TRUE,
+  .id = 2090,
+  .ra = 86.7583,
+  .dec = -34.2511,
+},
+{ .is_ngc = TRUE,
+  .id = 2091,
+  .ra = 85.2417,
+  .dec = -69.4361,
+},
+{ .is_ngc = TRUE,
+  .id = 2092,
+  .ra = 85.3392,
+  .dec = -69.2233,
+},
+{ .is_ngc = TRUE,
+  .id = 2093,
+  .ra = 85.455,
+  .dec = -68.9197,
+},
+{ .is_ngc = TRUE,
+  .id = 2094,
+  .ra = 85.5308,
+  .dec = -68.3631,
+},
+{ .is_ngc = TRUE,
+  .id = 2094,
+  .ra = 85.55,
+  .dec = -68.9169,
+},
+{ .is_ngc = TRUE,
+  .id = 2095,
+  .ra = 85.7079,
+  .dec = -67.3197,
+},
+{ .is_ngc = TRUE,
+  .id = 2095,
+  .ra = 85.65,
+  .dec = -67.3169,
+},
+{ .is_ngc = TRUE,
+  .id = 2096,
+  .ra = 85.5717,
+  .dec = -68.4581,
+},
+{ .is_ngc = TRUE,
+  .id = 2097,
+  .ra = 86.0658,
+  .dec = -62.785,
+},
+{ .is_ngc = TRUE,
+  .id = 2098,
+  .ra = 85.6258,
+  .dec = -68.2742,
+},
+{ .is_ngc = TRUE,
+  .id = 2099,
+  .ra = 88.075,
+  .dec = 32.5506,
+},
+{ .is_ngc = TRUE,
+  .id = 2100,
+  .ra = 85.5354,
+  .dec = -69.2117,
+},
+{ .is_ngc = TRUE,
+  .id = 2101,
+  .ra = 86.5946,
+  .dec = -52.0897,
+},
+{ .is_ngc = TRUE,
+  .id = 2102,
+  .ra = 85.5829,
+  .dec = -69.4869,
+},
+{ .is_ngc = TRUE,
+  .id = 2103,
+  .ra = 85.4167,
+  .dec = -71.3192,
+},
+{ .is_ngc = TRUE,
+  .id = 2104,
+  .ra = 86.7683,
+  .dec = -51.5525,
+},
+{ .is_ngc = TRUE,
+  .id = 2105,
+  .ra = 86.0821,
+  .dec = -66.9172,
+},
+{ .is_ngc = TRUE,
+  .id = 2106,
+  .ra = 87.6929,
+  .dec = -21.5672,
+},
+{ .is_ngc = TRUE,
+  .id = 2107,
+  .ra = 85.8025,
+  .dec = -70.6411,
+},
+{ .is_ngc = TRUE,
+  .id = 2108,
+  .ra = 85.9825,
+  .dec = -69.1806,
+},
+{ .is_ngc = TRUE,
+  .id = 2109,
+  .ra = 86.0954,
+  .dec = -68.5478,
+},
+{ .is_ngc = TRUE,
+  .id = 2110,
+  .ra = 88.0471,
+  .dec = -7.45667,
+},
+{ .is_ngc = TRUE,
+  .id = 2111,
+  .ra = 86.1383,
+  .dec = -70.9944,
+},
+{ .is_ngc = TRUE,
+  .id = 2112,
+  .ra = 88.4375,
+  .dec = 0.401667,
+},
+{ .is_ngc = TRUE,
+  .id = 2113,
+  .ra = 86.3496,
+  .dec = -69.7744,
+},
+{ .is_ngc = TRUE,
+  .id = 2114,
+  .ra = 86.5521,
+  .dec = -68.0478,
+},
+{ .is_ngc = TRUE,
+  .id = 2116,
+  .ra = 86.8125,
+  .dec = -68.5072,
+},
+{ .is_ngc = TRUE,
+  .id = 2117,
+  .ra = 86.9429,
+  .dec = -67.4506,
+},
+{ .is_ngc = TRUE,
+  .id = 2118,
+  .ra = 86.9121,
+  .dec = -69.1317,
+},
+{ .is_ngc = TRUE,
+  .id = 2119,
+  .ra = 89.3621,
+  .dec = 11.9487,
+},
+{ .is_ngc = TRUE,
+  .id = 2120,
+  .ra = 87.645,
+  .dec = -63.6753,
+},
+{ .is_ngc = TRUE,
+  .id = 2121,
+  .ra = 87.0514,
+  .dec = -71.4808,
+},
+{ .is_ngc = TRUE,
+  .id = 2122,
+  .ra = 87.2208,
+  .dec = -70.0669,
+},
+{ .is_ngc = TRUE,
+  .id = 2123,
+  .ra = 87.9308,
+  .dec = -65.3219,
+},
+{ .is_ngc = TRUE,
+  .id = 2124,
+  .ra = 89.4679,
+  .dec = -20.0847,
+},
+{ .is_ngc = TRUE,
+  .id = 2125,
+  .ra = 87.7229,
+  .dec = -69.4786,
+},
+{ .is_ngc = TRUE,
+  .id = 2126,
+  .ra = 90.6333,
+  .dec = 49.8667,
+},
+{ .is_ngc = TRUE,
+  .id = 2127,
+  .ra = 87.8396,
+  .dec = -69.3608,
+},
+{ .is_ngc = TRUE,
+  .id = 2128,
+  .ra = 91.1428,
+  .dec = 57.6275,
+},
+{ .is_ngc = TRUE,
+  .id = 2129,
+  .ra = 90.275,
+  .dec = 23.3175,
+},
+{ .is_ngc = TRUE,
+  .id = 2130,
+  .ra = 88.0962,
+  .dec = -67.3339,
+},
+{ .is_ngc = TRUE,
+  .id = 2131,
+  .ra = 89.6967,
+  .dec = -26.6528,
+},
+{ .is_ngc = TRUE,
+  .id = 2132,
+  .ra = 88.7792,
+  .dec = -59.9167,
+},
+{ .is_ngc = TRUE,
+  .id = 2133,
+  .ra = 87.8704,
+  .dec = -71.1742,
+},
+{ .is_ngc = TRUE,
+  .id = 2134,
+  .ra = 87.9858,
+  .dec = -71.0978,
+},
+{ .is_ngc = TRUE,
+  .id = 2135,
+  .ra = 88.3946,
+  .dec = -67.4281,
+},
+{ .is_ngc = TRUE,
+  .id = 2136,
+  .ra = 88.2435,
+  .dec = -69.4926,
+},
+{ .is_ngc = TRUE,
+  .id = 2137,
+  .ra = 88.301,
+  .dec = -69.4828,
+},
+{ .is_ngc = TRUE,
+  .id = 2138,
+  .ra = 88.7067,
+  .dec = -65.8369,
+},
+{ .is_ngc = TRUE,
+  .id = 2140,
+  .ra = 88.5671,
+  .dec = -68.5994,
+},
+{ .is_ngc = TRUE,
+  .id = 2141,
+  .ra = 90.7292,
+  .dec = 10.4356,
+},
+{ .is_ngc = TRUE,
+  .id = 2142,
+  .ra = 90.4599,
+  .dec = -10.598,
+},
+{ .is_ngc = TRUE,
+  .id = 2143,
+  .ra = 90.7208,
+  .dec = 5.7025,
+},
+{ .is_ngc = TRUE,
+  .id = 2144,
+  .ra = 85.2371,
+  .dec = -82.1197,
+},
+{ .is_ngc = TRUE,
+  .id = 2145,
+  .ra = 88.5949,
+  .dec = -70.9014,
+},
+{ .is_ngc = TRUE,
+  .id = 2146,
+  .ra = 94.6591,
+  .dec = 78.3562,
+},
+{ .is_ngc = TRUE,
+  .id = 2147,
+  .ra = 88.9425,
+  .dec = -68.2033,
+},
+{ .is_ngc = TRUE,
+  .id = 2148,
+  .ra = 89.6908,
+  .dec = -59.1264,
+},
+{ .is_ngc = TRUE,
+  .id = 2149,
+  .ra = 90.8783,
+  .dec = -9.73056,
+},
+{ .is_ngc = TRUE,
+  .id = 2150,
+  .ra = 88.9433,
+  .dec = -69.5608,
+},
+{ .is_ngc = TRUE,
+  .id = 2151,
+  .ra = 89.0842,
+  .dec = -69.0181,
+},
+{ .is_ngc = TRUE,
+  .id = 2152,
+  .ra = 90.2292,
+  .dec = -50.7397,
+},
+{ .is_ngc = TRUE,
+  .id = 2153,
+  .ra = 89.4663,
+  .dec = -66.4,
+},
+{ .is_ngc = TRUE,
+  .id = 2154,
+  .ra = 89.41,
+  .dec = -67.2619,
+},
+{ .is_ngc = TRUE,
+  .id = 2155,
+  .ra = 89.6367,
+  .dec = -65.4769,
+},
+{ .is_ngc = TRUE,
+  .id = 2156,
+  .ra = 89.4579,
+  .dec = -68.4614,
+},
+{ .is_ngc = TRUE,
+  .id = 2157,
+  .ra = 89.3938,
+  .dec = -69.1972,
+},
+{ .is_ngc = TRUE,
+  .id = 2158,
+  .ra = 91.8542,
+  .dec = 24.0856,
+},
+{ .is_ngc = TRUE,
+  .id = 2159,
+  .ra = 89.5104,
+  .dec = -68.6242,
+},
+{ .is_ngc = TRUE,
+  .id = 2160,
+  .ra = 89.555,
+  .dec = -68.2892,
+},
+{ .is_ngc = TRUE,
+  .id = 2161,
+  .ra = 88.9279,
+  .dec = -74.3536,
+},
+{ .is_ngc = TRUE,
+  .id = 2162,
+  .ra = 90.1287,
+  .dec = -63.7217,
+},
+{ .is_ngc = TRUE,
+  .id = 2163,
+  .ra = 91.9564,
+  .dec = 18.6574,
+},
+{ .is_ngc = TRUE,
+  .id = 2164,
+  .ra = 89.73,
+  .dec = -68.5158,
+},
+{ .is_ngc = TRUE,
+  .id = 2165,
+  .ra = 92.7667,
+  .dec = 51.6683,
+},
+{ .is_ngc = TRUE,
+  .id = 2166,
+  .ra = 89.8883,
+  .dec = -67.9414,
+},
+{ .is_ngc = TRUE,
+  .id = 2167,
+  .ra = 91.7439,
+  .dec = -6.20247,
+},
+{ .is_ngc = TRUE,
+  .id = 2168,
+  .ra = 92.25,
+  .dec = 24.35,
+},
+{ .is_ngc = TRUE,
+  .id = 2169,
+  .ra = 92.1,
+  .dec = 13.9525,
+},
+{ .is_ngc = TRUE,
+  .id = 2170,
+  .ra = 91.8826,
+  .dec = -6.39931,
+},
+{ .is_ngc = TRUE,
+  .id = 2171,
+  .ra = 89.7458,
+  .dec = -70.7169,
+},
+{ .is_ngc = TRUE,
+  .id = 2171,
+  .ra = 86.0575,
+  .dec = -70.6692,
+},
+{ .is_ngc = TRUE,
+  .id = 2172,
+  .ra = 90.0225,
+  .dec = -68.6375,
+},
+{ .is_ngc = TRUE,
+  .id = 2173,
+  .ra = 89.4929,
+  .dec = -72.9792,
+},
+{ .is_ngc = TRUE,
+  .id = 2174,
+  .ra = 92.3483,
+  .dec = 20.6594,
+},
+{ .is_ngc = TRUE,
+  .id = 2175,
+  .ra = 92.4148,
+  .dec = 20.4876,
+},
+{ .is_ngc = TRUE,
+  .id = 2176,
+  .ra = 90.3296,
+  .dec = -66.8531,
+},
+{ .is_ngc = TRUE,
+  .id = 2177,
+  .ra = 90.3162,
+  .dec = -67.7342,
+},
+{ .is_ngc = TRUE,
+  .id = 2178,
+  .ra = 90.6983,
+  .dec = -63.7639,
+},
+{ .is_ngc = TRUE,
+  .id = 2179,
+  .ra = 92.0088,
+  .dec = -21.7467,
+},
+{ .is_ngc = TRUE,
+  .id = 2180,
+  .ra = 92.4,
+  .dec = 4.70194,
+},
+{ .is_ngc = TRUE,
+  .id = 2181,
+  .ra = 90.6812,
+  .dec = -65.2647,
+},
+{ .is_ngc = TRUE,
+  .id = 2182,
+  .ra = 92.3787,
+  .dec = -6.32639,
+},
+{ .is_ngc = TRUE,
+  .id = 2183,
+  .ra = 92.6955,
+  .dec = -6.21183,
+},
+{ .is_ngc = TRUE,
+  .id = 2184,
+  .ra = 92.75,
+  .dec = -3.48333,
+},
+{ .is_ngc = TRUE,
+  .id = 2185,
+  .ra = 92.75,
+  .dec = -6.21833,
+},
+{ .is_ngc = TRUE,
+  .id = 2186,
+  .ra = 93.0292,
+  .dec = 5.45139,
+},
+{ .is_ngc = TRUE,
+  .id = 2188,
+  .ra = 92.54,
+  .dec = -34.1056,
+},
+{ .is_ngc = TRUE,
+  .id = 2190,
+  .ra = 90.2613,
+  .dec = -74.7257,
+},
+{ .is_ngc = TRUE,
+  .id = 2191,
+  .ra = 92.0988,
+  .dec = -52.5117,
+},
+{ .is_ngc = TRUE,
+  .id = 2192,
+  .ra = 93.8208,
+  .dec = 39.8508,
+},
+{ .is_ngc = TRUE,
+  .id = 2193,
+  .ra = 91.5737,
+  .dec = -65.0992,
+},
+{ .is_ngc = TRUE,
+  .id = 2194,
+  .ra = 93.4375,
+  .dec = 12.8011,
+},
+{ .is_ngc = TRUE,
+  .id = 2195,
+  .ra = 93.641,
+  .dec = 17.6395,
+},
+{ .is_ngc = TRUE,
+  .id = 2196,
+  .ra = 93.0404,
+  .dec = -21.8064,
+},
+{ .is_ngc = TRUE,
+  .id = 2197,
+  .ra = 91.5329,
+  .dec = -67.0975,
+},
+{ .is_ngc = TRUE,
+  .id = 2198,
+  .ra = 93.475,
+  .dec = 0.985278,
+},
+{ .is_ngc = TRUE,
+  .id = 2199,
+  .ra = 91.1863,
+  .dec = -73.4008,
+},
+{ .is_ngc = TRUE,
+  .id = 2200,
+  .ra = 93.3217,
+  .dec = -43.6633,
+},
+{ .is_ngc = TRUE,
+  .id = 2201,
+  .ra = 93.3821,
+  .dec = -43.7053,
+},
+{ .is_ngc = TRUE,
+  .id = 2202,
+  .ra = 94.2083,
+  .dec = 5.98556,
+},
+{ .is_ngc = TRUE,
+  .id = 2203,
+  .ra = 91.1754,
+  .dec = -75.4375,
+},
+{ .is_ngc = TRUE,
+  .id = 2204,
+  .ra = 93.8875,
+  .dec = -18.6525,
+},
+{ .is_ngc = TRUE,
+  .id = 2205,
+  .ra = 92.6375,
+  .dec = -62.5389,
+},
+{ .is_ngc = TRUE,
+  .id = 2206,
+  .ra = 93.9975,
+  .dec = -26.765,
+},
+{ .is_ngc = TRUE,
+  .id = 2207,
+  .ra = 94.0915,
+  .dec = -21.3729,
+},
+{ .is_ngc = TRUE,
+  .id = 2208,
+  .ra = 95.6447,
+  .dec = 51.9093,
+},
+{ .is_ngc = TRUE,
+  .id = 2209,
+  .ra = 92.1421,
+  .dec = -73.8383,
+},
+{ .is_ngc = TRUE,
+  .id = 2210,
+  .ra = 92.8833,
+  .dec = -69.1219,
+},
+{ .is_ngc = TRUE,
+  .id = 2211,
+  .ra = 94.6263,
+  .dec = -18.5377,
+},
+{ .is_ngc = TRUE,
+  .id = 2212,
+  .ra = 94.6485,
+  .dec = -18.5198,
+},
+{ .is_ngc = TRUE,
+  .id = 2213,
+  .ra = 92.6754,
+  .dec = -71.5286,
+},
+{ .is_ngc = TRUE,
+  .id = 2214,
+  .ra = 93.2382,
+  .dec = -68.2602,
+},
+{ .is_ngc = TRUE,
+  .id = 2215,
+  .ra = 95.2042,
+  .dec = -7.28333,
+},
+{ .is_ngc = TRUE,
+  .id = 2216,
+  .ra = 95.3779,
+  .dec = -22.0869,
+},
+{ .is_ngc = TRUE,
+  .id = 2217,
+  .ra = 95.4158,
+  .dec = -27.2339,
+},
+{ .is_ngc = TRUE,
+  .id = 2218,
+  .ra = 96.1729,
+  .dec = 19.3411,
+},
+{ .is_ngc = TRUE,
+  .id = 2218,
+  .ra = 96.175,
+  .dec = 19.3442,
+},
+{ .is_ngc = TRUE,
+  .id = 2219,
+  .ra = 95.9333,
+  .dec = -4.66833,
+},
+{ .is_ngc = TRUE,
+  .id = 2220,
+  .ra = 95.2975,
+  .dec = -44.7589,
+},
+{ .is_ngc = TRUE,
+  .id = 2221,
+  .ra = 95.0642,
+  .dec = -57.5781,
+},
+{ .is_ngc = TRUE,
+  .id = 2222,
+  .ra = 95.0687,
+  .dec = -57.5322,
+},
+{ .is_ngc = TRUE,
+  .id = 2223,
+  .ra = 96.1488,
+  .dec = -22.8383,
+},
+{ .is_ngc = TRUE,
+  .id = 2224,
+  .ra = 96.8667,
+  .dec = 12.585,
+},
+{ .is_ngc = TRUE,
+  .id = 2225,
+  .ra = 96.6417,
+  .dec = -9.61889,
+},
+{ .is_ngc = TRUE,
+  .id = 2226,
+  .ra = 96.6567,
+  .dec = -9.6425,
+},
+{ .is_ngc = TRUE,
+  .id = 2227,
+  .ra = 96.4913,
+  .dec = -22.005,
+},
+{ .is_ngc = TRUE,
+  .id = 2228,
+  .ra = 95.3154,
+  .dec = -64.4592,
+},
+{ .is_ngc = TRUE,
+  .id = 2229,
+  .ra = 95.3483,
+  .dec = -64.9564,
+},
+{ .is_ngc = TRUE,
+  .id = 2230,
+  .ra = 95.3646,
+  .dec = -64.9928,
+},
+{ .is_ngc = TRUE,
+  .id = 2231,
+  .ra = 95.1817,
+  .dec = -67.5175,
+},
+{ .is_ngc = TRUE,
+  .id = 2232,
+  .ra = 97.0042,
+  .dec = -4.83556,
+},
+{ .is_ngc = TRUE,
+  .id = 2233,
+  .ra = 95.4146,
+  .dec = -65.0331,
+},
+{ .is_ngc = TRUE,
+  .id = 2234,
+  .ra = 97.3375,
+  .dec = 16.7178,
+},
+{ .is_ngc = TRUE,
+  .id = 2235,
+  .ra = 95.5913,
+  .dec = -64.9342,
+},
+{ .is_ngc = TRUE,
+  .id = 2236,
+  .ra = 97.4125,
+  .dec = 6.81889,
+},
+{ .is_ngc = TRUE,
+  .id = 2237,
+  .ra = 97.725,
+  .dec = 5.05,
+},
+{ .is_ngc = TRUE,
+  .id = 2238,
+  .ra = 97.6683,
+  .dec = 5.01306,
+},
+{ .is_ngc = TRUE,
+  .id = 2240,
+  .ra = 98.2917,
+  .dec = 35.25,
+},
+{ .is_ngc = TRUE,
+  .id = 2241,
+  .ra = 95.7204,
+  .dec = -68.9247,
+},
+{ .is_ngc = TRUE,
+  .id = 2242,
+  .ra = 98.5306,
+  .dec = 44.7772,
+},
+{ .is_ngc = TRUE,
+  .id = 2243,
+  .ra = 97.3917,
+  .dec = -31.2833,
+},
+{ .is_ngc = TRUE,
+  .id = 2245,
+  .ra = 98.1719,
+  .dec = 10.1566,
+},
+{ .is_ngc = TRUE,
+  .id = 2246,
+  .ra = 98.1408,
+  .dec = 5.12806,
+},
+{ .is_ngc = TRUE,
+  .id = 2247,
+  .ra = 98.2713,
+  .dec = 10.3215,
+},
+{ .is_ngc = TRUE,
+  .id = 2248,
+  .ra = 98.6479,
+  .dec = 26.3047,
+},
+{ .is_ngc = TRUE,
+  .id = 2249,
+  .ra = 96.4579,
+  .dec = -68.9203,
+},
+{ .is_ngc = TRUE,
+  .id = 2250,
+  .ra = 98.4542,
+  .dec = -5.08361,
+},
+{ .is_ngc = TRUE,
+  .id = 2251,
+  .ra = 98.6583,
+  .dec = 8.36667,
+},
+{ .is_ngc = TRUE,
+  .id = 2252,
+  .ra = 98.675,
+  .dec = 5.36667,
+},
+{ .is_ngc = TRUE,
+  .id = 2253,
+  .ra = 100.925,
+  .dec = 65.2062,
+},
+{ .is_ngc = TRUE,
+  .id = 2254,
+  .ra = 98.9542,
+  .dec = 7.66778,
+},
+{ .is_ngc = TRUE,
+  .id = 2255,
+  .ra = 98.4946,
+  .dec = -34.8125,
+},
+{ .is_ngc = TRUE,
+  .id = 2256,
+  .ra = 101.807,
+  .dec = 74.2363,
+},
+{ .is_ngc = TRUE,
+  .id = 2257,
+  .ra = 97.5529,
+  .dec = -64.3253,
+},
+{ .is_ngc = TRUE,
+  .id = 2258,
+  .ra = 101.943,
+  .dec = 74.4817,
+},
+{ .is_ngc = TRUE,
+  .id = 2259,
+  .ra = 99.5875,
+  .dec = 10.8833,
+},
+{ .is_ngc = TRUE,
+  .id = 2260,
+  .ra = 99.5125,
+  .dec = -1.46778,
+},
+{ .is_ngc = TRUE,
+  .id = 2261,
+  .ra = 99.7896,
+  .dec = 8.74433,
+},
+{ .is_ngc = TRUE,
+  .id = 2262,
+  .ra = 99.9083,
+  .dec = 1.135,
+},
+{ .is_ngc = TRUE,
+  .id = 2263,
+  .ra = 99.6187,
+  .dec = -24.8478,
+},
+{ .is_ngc = TRUE,
+  .id = 2264,
+  .ra = 100.242,
+  .dec = 9.88528,
+},
+{ .is_ngc = TRUE,
+  .id = 2265,
+  .ra = 100.421,
+  .dec = 11.9008,
+},
+{ .is_ngc = TRUE,
+  .id = 2266,
+  .ra = 100.829,
+  .dec = 26.9672,
+},
+{ .is_ngc = TRUE,
+  .id = 2267,
+  .ra = 100.215,
+  .dec = -32.4819,
+},
+{ .is_ngc = TRUE,
+  .id = 2268,
+  .ra = 108.574,
+  .dec = 84.382,
+},
+{ .is_ngc = TRUE,
+  .id = 2269,
+  .ra = 100.821,
+  .dec = 4.61806,
+},
+{ .is_ngc = TRUE,
+  .id = 2270,
+  .ra = 100.987,
+  .dec = 3.46861,
+},
+{ .is_ngc = TRUE,
+  .id = 2271,
+  .ra = 100.719,
+  .dec = -23.4758,
+},
+{ .is_ngc = TRUE,
+  .id = 2272,
+  .ra = 100.672,
+  .dec = -27.4592,
+},
+{ .is_ngc = TRUE,
+  .id = 2273,
+  .ra = 102.536,
+  .dec = 60.8458,
+},
+{ .is_ngc = TRUE,
+  .id = 2274,
+  .ra = 101.823,
+  .dec = 33.567,
+},
+{ .is_ngc = TRUE,
+  .id = 2275,
+  .ra = 101.825,
+  .dec = 33.599,
+},
+{ .is_ngc = TRUE,
+  .id = 2276,
+  .ra = 111.817,
+  .dec = 85.7546,
+},
+{ .is_ngc = TRUE,
+  .id = 2277,
+  .ra = 101.946,
+  .dec = 33.4511,
+},
+{ .is_ngc = TRUE,
+  .id = 2278,
+  .ra = 102.068,
+  .dec = 33.3944,
+},
+{ .is_ngc = TRUE,
+  .id = 2279,
+  .ra = 102.103,
+  .dec = 33.415,
+},
+{ .is_ngc = TRUE,
+  .id = 2280,
+  .ra = 101.205,
+  .dec = -27.6391,
+},
+{ .is_ngc = TRUE,
+  .id = 2281,
+  .ra = 102.071,
+  .dec = 41.0686,
+},
+{ .is_ngc = TRUE,
+  .id = 2284,
+  .ra = 102.29,
+  .dec = 33.1936,
+},
+{ .is_ngc = TRUE,
+  .id = 2284,
+  .ra = 87.3208,
+  .dec = 33.2389,
+},
+{ .is_ngc = TRUE,
+  .id = 2285,
+  .ra = 102.4,
+  .dec = 33.3644,
+},
+{ .is_ngc = TRUE,
+  .id = 2286,
+  .ra = 101.917,
+  .dec = -3.13583,
+},
+{ .is_ngc = TRUE,
+  .id = 2287,
+  .ra = 101.504,
+  .dec = -20.7511,
+},
+{ .is_ngc = TRUE,
+  .id = 2288,
+  .ra = 102.717,
+  .dec = 33.4623,
+},
+{ .is_ngc = TRUE,
+  .id = 2289,
+  .ra = 102.723,
+  .dec = 33.479,
+},
+{ .is_ngc = TRUE,
+  .id = 2290,
+  .ra = 102.737,
+  .dec = 33.4376,
+},
+{ .is_ngc = TRUE,
+  .id = 2291,
+  .ra = 102.744,
+  .dec = 33.5253,
+},
+{ .is_ngc = TRUE,
+  .id = 2292,
+  .ra = 101.915,
+  .dec = -26.7464,
+},
+{ .is_ngc = TRUE,
+  .id = 2293,
+  .ra = 101.929,
+  .dec = -26.7543,
+},
+{ .is_ngc = TRUE,
+  .id = 2294,
+  .ra = 102.797,
+  .dec = 33.5268,
+},
+{ .is_ngc = TRUE,
+  .id = 2295,
+  .ra = 101.847,
+  .dec = -26.7363,
+},
+{ .is_ngc = TRUE,
+  .id = 2297,
+  .ra = 101.103,
+  .dec = -63.7172,
+},
+{ .is_ngc = TRUE,
+  .id = 2298,
+  .ra = 102.247,
+  .dec = -36.0042,
+},
+{ .is_ngc = TRUE,
+  .id = 2300,
+  .ra = 113.086,
+  .dec = 85.7087,
+},
+{ .is_ngc = TRUE,
+  .id = 2301,
+  .ra = 102.938,
+  .dec = 0.451667,
+},
+{ .is_ngc = TRUE,
+  .id = 2303,
+  .ra = 104.073,
+  .dec = 45.493,
+},
+{ .is_ngc = TRUE,
+  .id = 2304,
+  .ra = 103.796,
+  .dec = 17.9842,
+},
+{ .is_ngc = TRUE,
+  .id = 2305,
+  .ra = 102.155,
+  .dec = -64.2731,
+},
+{ .is_ngc = TRUE,
+  .id = 2306,
+  .ra = 103.621,
+  .dec = -7.20056,
+},
+{ .is_ngc = TRUE,
+  .id = 2307,
+  .ra = 102.213,
+  .dec = -64.3344,
+},
+{ .is_ngc = TRUE,
+  .id = 2308,
+  .ra = 104.657,
+  .dec = 45.2106,
+},
+{ .is_ngc = TRUE,
+  .id = 2309,
+  .ra = 104.013,
+  .dec = -7.16806,
+},
+{ .is_ngc = TRUE,
+  .id = 2310,
+  .ra = 103.474,
+  .dec = -40.8628,
+},
+{ .is_ngc = TRUE,
+  .id = 2311,
+  .ra = 104.446,
+  .dec = -4.60194,
+},
+{ .is_ngc = TRUE,
+  .id = 2312,
+  .ra = 104.696,
+  .dec = 10.2853,
+},
+{ .is_ngc = TRUE,
+  .id = 2313,
+  .ra = 104.512,
+  .dec = -7.94503,
+},
+{ .is_ngc = TRUE,
+  .id = 2314,
+  .ra = 107.634,
+  .dec = 75.3269,
+},
+{ .is_ngc = TRUE,
+  .id = 2315,
+  .ra = 105.638,
+  .dec = 50.5906,
+},
+{ .is_ngc = TRUE,
+  .id = 2316,
+  .ra = 104.92,
+  .dec = -7.7775,
+},
+{ .is_ngc = TRUE,
+  .id = 2317,
+  .ra = 104.923,
+  .dec = -7.77444,
+},
+{ .is_ngc = TRUE,
+  .id = 2318,
+  .ra = 104.863,
+  .dec = -13.6858,
+},
+{ .is_ngc = TRUE,
+  .id = 2319,
+  .ra = 105.133,
+  .dec = 3.03472,
+},
+{ .is_ngc = TRUE,
+  .id = 2320,
+  .ra = 106.425,
+  .dec = 50.5806,
+},
+{ .is_ngc = TRUE,
+  .id = 2321,
+  .ra = 106.496,
+  .dec = 50.7559,
+},
+{ .is_ngc = TRUE,
+  .id = 2322,
+  .ra = 106.501,
+  .dec = 50.5101,
+},
+{ .is_ngc = TRUE,
+  .id = 2323,
+  .ra = 105.529,
+  .dec = -8.38333,
+},
+{ .is_ngc = TRUE,
+  .id = 2324,
+  .ra = 106.029,
+  .dec = 1.03528,
+},
+{ .is_ngc = TRUE,
+  .id = 2325,
+  .ra = 105.668,
+  .dec = -28.6981,
+},
+{ .is_ngc = TRUE,
+  .id = 2326,
+  .ra = 107.046,
+  .dec = 50.6817,
+},
+{ .is_ngc = TRUE,
+  .id = 2327,
+  .ra = 106.03,
+  .dec = -11.3139,
+},
+{ .is_ngc = TRUE,
+  .id = 2328,
+  .ra = 105.652,
+  .dec = -42.0686,
+},
+{ .is_ngc = TRUE,
+  .id = 2329,
+  .ra = 107.283,
+  .dec = 48.6154,
+},
+{ .is_ngc = TRUE,
+  .id = 2330,
+  .ra = 107.396,
+  .dec = 50.2353,
+},
+{ .is_ngc = TRUE,
+  .id = 2331,
+  .ra = 106.746,
+  .dec = 27.2519,
+},
+{ .is_ngc = TRUE,
+  .id = 2332,
+  .ra = 107.392,
+  .dec = 50.1819,
+},
+{ .is_ngc = TRUE,
+  .id = 2333,
+  .ra = 107.089,
+  .dec = 35.1696,
+},
+{ .is_ngc = TRUE,
+  .id = 2334,
+  .ra = 107.467,
+  .dec = 50.1925,
+},
+{ .is_ngc = TRUE,
+  .id = 2335,
+  .ra = 106.704,
+  .dec = -10.0186,
+},
+{ .is_ngc = TRUE,
+  .id = 2336,
+  .ra = 111.766,
+  .dec = 80.1781,
+},
+{ .is_ngc = TRUE,
+  .id = 2337,
+  .ra = 107.557,
+  .dec = 44.4568,
+},
+{ .is_ngc = TRUE,
+  .id = 2338,
+  .ra = 106.929,
+  .dec = -5.71667,
+},
+{ .is_ngc = TRUE,
+  .id = 2339,
+  .ra = 107.086,
+  .dec = 18.7802,
+},
+{ .is_ngc = TRUE,
+  .id = 2340,
+  .ra = 107.795,
+  .dec = 50.1743,
+},
+{ .is_ngc = TRUE,
+  .id = 2341,
+  .ra = 107.3,
+  .dec = 20.6023,
+},
+{ .is_ngc = TRUE,
+  .id = 2342,
+  .ra = 107.326,
+  .dec = 20.6362,
+},
+{ .is_ngc = TRUE,
+  .id = 2343,
+  .ra = 107.025,
+  .dec = -10.6167,
+},
+{ .is_ngc = TRUE,
+  .id = 2344,
+  .ra = 108.119,
+  .dec = 47.1666,
+},
+{ .is_ngc = TRUE,
+  .id = 2345,
+  .ra = 107.075,
+  .dec = -13.185,
+},
+{ .is_ngc = TRUE,
+  .id = 2346,
+  .ra = 107.343,
+  .dec = -0.806042,
+},
+{ .is_ngc = TRUE,
+  .id = 2347,
+  .ra = 109.017,
+  .dec = 64.7111,
+},
+{ .is_ngc = TRUE,
+  .id = 2348,
+  .ra = 105.758,
+  .dec = -67.4006,
+},
+{ .is_ngc = TRUE,
+  .id = 2349,
+  .ra = 107.7,
+  .dec = -8.585,
+},
+{ .is_ngc = TRUE,
+  .id = 2350,
+  .ra = 108.301,
+  .dec = 12.266,
+},
+{ .is_ngc = TRUE,
+  .id = 2351,
+  .ra = 108.379,
+  .dec = -10.4839,
+},
+{ .is_ngc = TRUE,
+  .id = 2352,
+  .ra = 108.274,
+  .dec = -24.0394,
+},
+{ .is_ngc = TRUE,
+  .id = 2353,
+  .ra = 108.625,
+  .dec = -10.2667,
+},
+{ .is_ngc = TRUE,
+  .id = 2354,
+  .ra = 108.542,
+  .dec = -25.6844,
+},
+{ .is_ngc = TRUE,
+  .id = 2357,
+  .ra = 109.421,
+  .dec = 23.3558,
+},
+{ .is_ngc = TRUE,
+  .id = 2358,
+  .ra = 109.233,
+  .dec = -17.1167,
+},
+{ .is_ngc = TRUE,
+  .id = 2358,
+  .ra = 109.175,
+  .dec = -17.0331,
+},
+{ .is_ngc = TRUE,
+  .id = 2359,
+  .ra = 109.625,
+  .dec = -13.2183,
+},
+{ .is_ngc = TRUE,
+  .id = 2360,
+  .ra = 109.429,
+  .dec = -15.6347,
+},
+{ .is_ngc = TRUE,
+  .id = 2361,
+  .ra = 109.599,
+  .dec = -13.2094,
+},
+{ .is_ngc = TRUE,
+  .id = 2362,
+  .ra = 109.671,
+  .dec = -24.9508,
+},
+{ .is_ngc = TRUE,
+  .id = 2363,
+  .ra = 112.124,
+  .dec = 69.1931,
+},
+{ .is_ngc = TRUE,
+  .id = 2364,
+  .ra = 110.192,
+  .dec = -7.55,
+},
+{ .is_ngc = TRUE,
+  .id = 2365,
+  .ra = 110.594,
+  .dec = 22.0831,
+},
+{ .is_ngc = TRUE,
+  .id = 2366,
+  .ra = 112.229,
+  .dec = 69.2161,
+},
+{ .is_ngc = TRUE,
+  .id = 2367,
+  .ra = 110.025,
+  .dec = -21.8692,
+},
+{ .is_ngc = TRUE,
+  .id = 2368,
+  .ra = 110.275,
+  .dec = -10.3675,
+},
+{ .is_ngc = TRUE,
+  .id = 2369,
+  .ra = 109.158,
+  .dec = -62.3442,
+},
+{ .is_ngc = TRUE,
+  .id = 2370,
+  .ra = 111.257,
+  .dec = 23.7832,
+},
+{ .is_ngc = TRUE,
+  .id = 2371,
+  .ra = 111.391,
+  .dec = 29.4882,
+},
+{ .is_ngc = TRUE,
+  .id = 2372,
+  .ra = 111.399,
+  .dec = 29.4914,
+},
+{ .is_ngc = TRUE,
+  .id = 2373,
+  .ra = 111.654,
+  .dec = 33.824,
+},
+{ .is_ngc = TRUE,
+  .id = 2374,
+  .ra = 110.983,
+  .dec = -13.2522,
+},
+{ .is_ngc = TRUE,
+  .id = 2375,
+  .ra = 111.79,
+  .dec = 33.8319,
+},
+{ .is_ngc = TRUE,
+  .id = 2376,
+  .ra = 111.65,
+  .dec = 23.0729,
+},
+{ .is_ngc = TRUE,
+  .id = 2377,
+  .ra = 111.237,
+  .dec = -9.66003,
+},
+{ .is_ngc = TRUE,
+  .id = 2378,
+  .ra = 111.85,
+  .dec = 33.8314,
+},
+{ .is_ngc = TRUE,
+  .id = 2379,
+  .ra = 111.86,
+  .dec = 33.8116,
+},
+{ .is_ngc = TRUE,
+  .id = 2381,
+  .ra = 109.989,
+  .dec = -63.0669,
+},
+{ .is_ngc = TRUE,
+  .id = 2383,
+  .ra = 111.167,
+  .dec = -20.9358,
+},
+{ .is_ngc = TRUE,
+  .id = 2384,
+  .ra = 111.292,
+  .dec = -21.0175,
+},
+{ .is_ngc = TRUE,
+  .id = 2385,
+  .ra = 112.118,
+  .dec = 33.8378,
+},
+{ .is_ngc = TRUE,
+  .id = 2386,
+  .ra = 112.159,
+  .dec = 33.7744,
+},
+{ .is_ngc = TRUE,
+  .id = 2388,
+  .ra = 112.223,
+  .dec = 33.8187,
+},
+{ .is_ngc = TRUE,
+  .id = 2389,
+  .ra = 112.27,
+  .dec = 33.8605,
+},
+{ .is_ngc = TRUE,
+  .id = 2390,
+  .ra = 112.268,
+  .dec = 33.8364,
+},
+{ .is_ngc = TRUE,
+  .id = 2391,
+  .ra = 112.281,
+  .dec = 33.8256,
+},
+{ .is_ngc = TRUE,
+  .id = 2392,
+  .ra = 112.295,
+  .dec = 20.9116,
+},
+{ .is_ngc = TRUE,
+  .id = 2393,
+  .ra = 112.52,
+  .dec = 34.0273,
+},
+{ .is_ngc = TRUE,
+  .id = 2394,
+  .ra = 112.15,
+  .dec = 7.08389,
+},
+{ .is_ngc = TRUE,
+  .id = 2395,
+  .ra = 111.8,
+  .dec = 13.6014,
+},
+{ .is_ngc = TRUE,
+  .id = 2396,
+  .ra = 112,
+  .dec = -11.7167,
+},
+{ .is_ngc = TRUE,
+  .id = 2397,
+  .ra = 110.334,
+  .dec = -69.0017,
+},
+{ .is_ngc = TRUE,
+  .id = 2398,
+  .ra = 112.568,
+  .dec = 24.4877,
+},
+{ .is_ngc = TRUE,
+  .id = 2399,
+  .ra = 112.458,
+  .dec = -0.214167,
+},
+{ .is_ngc = TRUE,
+  .id = 2400,
+  .ra = 112.479,
+  .dec = -0.214444,
+},
+{ .is_ngc = TRUE,
+  .id = 2401,
+  .ra = 112.35,
+  .dec = -13.9667,
+},
+{ .is_ngc = TRUE,
+  .id = 2403,
+  .ra = 114.213,
+  .dec = 65.6019,
+},
+{ .is_ngc = TRUE,
+  .id = 2404,
+  .ra = 114.279,
+  .dec = 65.6107,
+},
+{ .is_ngc = TRUE,
+  .id = 2405,
+  .ra = 113.058,
+  .dec = 25.9058,
+},
+{ .is_ngc = TRUE,
+  .id = 2406,
+  .ra = 112.949,
+  .dec = 18.2877,
+},
+{ .is_ngc = TRUE,
+  .id = 2407,
+  .ra = 112.986,
+  .dec = 18.3329,
+},
+{ .is_ngc = TRUE,
+  .id = 2408,
+  .ra = 115.021,
+  .dec = 71.6667,
+},
+{ .is_ngc = TRUE,
+  .id = 2409,
+  .ra = 112.906,
+  .dec = -17.1942,
+},
+{ .is_ngc = TRUE,
+  .id = 2410,
+  .ra = 113.76,
+  .dec = 32.8225,
+},
+{ .is_ngc = TRUE,
+  .id = 2411,
+  .ra = 113.651,
+  .dec = 18.2814,
+},
+{ .is_ngc = TRUE,
+  .id = 2412,
+  .ra = 113.59,
+  .dec = 8.54728,
+},
+{ .is_ngc = TRUE,
+  .id = 2413,
+  .ra = 113.317,
+  .dec = -13.0853,
+},
+{ .is_ngc = TRUE,
+  .id = 2414,
+  .ra = 113.3,
+  .dec = -15.4506,
+},
+{ .is_ngc = TRUE,
+  .id = 2415,
+  .ra = 114.236,
+  .dec = 35.2421,
+},
+{ .is_ngc = TRUE,
+  .id = 2416,
+  .ra = 113.923,
+  .dec = 11.6122,
+},
+{ .is_ngc = TRUE,
+  .id = 2417,
+  .ra = 112.55,
+  .dec = -62.2519,
+},
+{ .is_ngc = TRUE,
+  .id = 2418,
+  .ra = 114.157,
+  .dec = 17.884,
+},
+{ .is_ngc = TRUE,
+  .id = 2419,
+  .ra = 114.535,
+  .dec = 38.8816,
+},
+{ .is_ngc = TRUE,
+  .id = 2420,
+  .ra = 114.596,
+  .dec = 21.5678,
+},
+{ .is_ngc = TRUE,
+  .id = 2421,
+  .ra = 114.054,
+  .dec = -20.6019,
+},
+{ .is_ngc = TRUE,
+  .id = 2423,
+  .ra = 114.275,
+  .dec = -13.8675,
+},
+{ .is_ngc = TRUE,
+  .id = 2424,
+  .ra = 115.164,
+  .dec = 39.2328,
+},
+{ .is_ngc = TRUE,
+  .id = 2425,
+  .ra = 114.571,
+  .dec = -14.8686,
+},
+{ .is_ngc = TRUE,
+  .id = 2426,
+  .ra = 115.827,
+  .dec = 52.3181,
+},
+{ .is_ngc = TRUE,
+  .id = 2427,
+  .ra = 114.116,
+  .dec = -47.6356,
+},
+{ .is_ngc = TRUE,
+  .id = 2428,
+  .ra = 114.838,
+  .dec = -16.5186,
+},
+{ .is_ngc = TRUE,
+  .id = 2428,
+  .ra = 114.8,
+  .dec = -16.4997,
+},
+{ .is_ngc = TRUE,
+  .id = 2430,
+  .ra = 114.921,
+  .dec = -16.2856,
+},
+{ .is_ngc = TRUE,
+  .id = 2430,
+  .ra = 114.875,
+  .dec = -16.3456,
+},
+{ .is_ngc = TRUE,
+  .id = 2432,
+  .ra = 115.221,
+  .dec = -19.0683,
+},
+{ .is_ngc = TRUE,
+  .id = 2433,
+  .ra = 115.681,
+  .dec = 9.25944,
+},
+{ .is_ngc = TRUE,
+  .id = 2434,
+  .ra = 113.715,
+  .dec = -69.2842,
+},
+{ .is_ngc = TRUE,
+  .id = 2435,
+  .ra = 116.056,
+  .dec = 31.6507,
+},
+{ .is_ngc = TRUE,
+  .id = 2437,
+  .ra = 115.442,
+  .dec = -14.8017,
+},
+{ .is_ngc = TRUE,
+  .id = 2438,
+  .ra = 115.46,
+  .dec = -14.7352,
+},
+{ .is_ngc = TRUE,
+  .id = 2439,
+  .ra = 115.188,
+  .dec = -31.685,
+},
+{ .is_ngc = TRUE,
+  .id = 2440,
+  .ra = 115.481,
+  .dec = -18.2087,
+},
+{ .is_ngc = TRUE,
+  .id = 2441,
+  .ra = 117.978,
+  .dec = 73.0154,
+},
+{ .is_ngc = TRUE,
+  .id = 2442,
+  .ra = 114.079,
+  .dec = -69.5347,
+},
+{ .is_ngc = TRUE,
+  .id = 2443,
+  .ra = 114.125,
+  .dec = -69.5169,
+},
+{ .is_ngc = TRUE,
+  .id = 2444,
+  .ra = 116.721,
+  .dec = 39.0322,
+},
+{ .is_ngc = TRUE,
+  .id = 2445,
+  .ra = 116.729,
+  .dec = 39.0154,
+},
+{ .is_ngc = TRUE,
+  .id = 2446,
+  .ra = 117.164,
+  .dec = 54.6111,
+},
+{ .is_ngc = TRUE,
+  .id = 2447,
+  .ra = 116.125,
+  .dec = -23.8511,
+},
+{ .is_ngc = TRUE,
+  .id = 2448,
+  .ra = 116.144,
+  .dec = -24.6808,
+},
+{ .is_ngc = TRUE,
+  .id = 2449,
+  .ra = 116.835,
+  .dec = 26.9304,
+},
+{ .is_ngc = TRUE,
+  .id = 2450,
+  .ra = 116.884,
+  .dec = 27.0192,
+},
+{ .is_ngc = TRUE,
+  .id = 2451,
+  .ra = 116.312,
+  .dec = -37.9667,
+},
+{ .is_ngc = TRUE,
+  .id = 2452,
+  .ra = 116.859,
+  .dec = -27.3354,
+},
+{ .is_ngc = TRUE,
+  .id = 2453,
+  .ra = 116.896,
+  .dec = -27.1853,
+},
+{ .is_ngc = TRUE,
+  .id = 2454,
+  .ra = 117.646,
+  .dec = 16.3691,
+},
+{ .is_ngc = TRUE,
+  .id = 2455,
+  .ra = 117.254,
+  .dec = -21.3003,
+},
+{ .is_ngc = TRUE,
+  .id = 2456,
+  .ra = 118.545,
+  .dec = 55.4948,
+},
+{ .is_ngc = TRUE,
+  .id = 2457,
+  .ra = 118.69,
+  .dec = 55.5466,
+},
+{ .is_ngc = TRUE,
+  .id = 2458,
+  .ra = 118.964,
+  .dec = 56.71,
+},
+{ .is_ngc = TRUE,
+  .id = 2459,
+  .ra = 118.011,
+  .dec = 9.55722,
+},
+{ .is_ngc = TRUE,
+  .id = 2460,
+  .ra = 119.219,
+  .dec = 60.3494,
+},
+{ .is_ngc = TRUE,
+  .id = 2461,
+  .ra = 119.109,
+  .dec = 56.6733,
+},
+{ .is_ngc = TRUE,
+  .id = 2462,
+  .ra = 119.134,
+  .dec = 56.6871,
+},
+{ .is_ngc = TRUE,
+  .id = 2463,
+  .ra = 119.302,
+  .dec = 56.6766,
+},
+{ .is_ngc = TRUE,
+  .id = 2464,
+  .ra = 119.386,
+  .dec = 56.6906,
+},
+{ .is_ngc = TRUE,
+  .id = 2465,
+  .ra = 119.359,
+  .dec = 56.8225,
+},
+{ .is_ngc = TRUE,
+  .id = 2466,
+  .ra = 116.315,
+  .dec = -71.4097,
+},
+{ .is_ngc = TRUE,
+  .id = 2467,
+  .ra = 118.108,
+  .dec = -26.4339,
+},
+{ .is_ngc = TRUE,
+  .id = 2468,
+  .ra = 119.51,
+  .dec = 56.3591,
+},
+{ .is_ngc = TRUE,
+  .id = 2469,
+  .ra = 119.514,
+  .dec = 56.6803,
+},
+{ .is_ngc = TRUE,
+  .id = 2470,
+  .ra = 118.586,
+  .dec = 4.45953,
+},
+{ .is_ngc = TRUE,
+  .id = 2471,
+  .ra = 119.638,
+  .dec = 56.7761,
+},
+{ .is_ngc = TRUE,
+  .id = 2472,
+  .ra = 119.674,
+  .dec = 56.7011,
+},
+{ .is_ngc = TRUE,
+  .id = 2473,
+  .ra = 118.895,
+  .dec = 56.7359,
+},
+{ .is_ngc = TRUE,
+  .id = 2474,
+  .ra = 119.496,
+  .dec = 52.8569,
+},
+{ .is_ngc = TRUE,
+  .id = 2475,
+  .ra = 119.502,
+  .dec = 52.8617,
+},
+{ .is_ngc = TRUE,
+  .id = 2476,
+  .ra = 119.189,
+  .dec = 39.928,
+},
+{ .is_ngc = TRUE,
+  .id = 2477,
+  .ra = 118.042,
+  .dec = -38.5189,
+},
+{ .is_ngc = TRUE,
+  .id = 2479,
+  .ra = 118.775,
+  .dec = -17.7017,
+},
+{ .is_ngc = TRUE,
+  .id = 2480,
+  .ra = 119.294,
+  .dec = 23.7793,
+},
+{ .is_ngc = TRUE,
+  .id = 2481,
+  .ra = 119.307,
+  .dec = 23.7672,
+},
+{ .is_ngc = TRUE,
+  .id = 2482,
+  .ra = 118.8,
+  .dec = -24.2514,
+},
+{ .is_ngc = TRUE,
+  .id = 2483,
+  .ra = 118.913,
+  .dec = -27.8853,
+},
+{ .is_ngc = TRUE,
+  .id = 2484,
+  .ra = 119.617,
+  .dec = 37.7866,
+},
+{ .is_ngc = TRUE,
+  .id = 2485,
+  .ra = 119.203,
+  .dec = 7.47733,
+},
+{ .is_ngc = TRUE,
+  .id = 2486,
+  .ra = 119.484,
+  .dec = 25.1606,
+},
+{ .is_ngc = TRUE,
+  .id = 2487,
+  .ra = 119.585,
+  .dec = 25.1491,
+},
+{ .is_ngc = TRUE,
+  .id = 2488,
+  .ra = 120.442,
+  .dec = 56.5533,
+},
+{ .is_ngc = TRUE,
+  .id = 2489,
+  .ra = 119.062,
+  .dec = -30.0522,
+},
+{ .is_ngc = TRUE,
+  .id = 2490,
+  .ra = 119.825,
+  .dec = 27.0772,
+},
+{ .is_ngc = TRUE,
+  .id = 2491,
+  .ra = 119.614,
+  .dec = 7.98308,
+},
+{ .is_ngc = TRUE,
+  .id = 2491,
+  .ra = 119.558,
+  .dec = 8.14972,
+},
+{ .is_ngc = TRUE,
+  .id = 2492,
+  .ra = 119.874,
+  .dec = 27.026,
+},
+{ .is_ngc = TRUE,
+  .id = 2493,
+  .ra = 120.099,
+  .dec = 39.8305,
+},
+{ .is_ngc = TRUE,
+  .id = 2495,
+  .ra = 120.138,
+  .dec = 39.8396,
+},
+{ .is_ngc = TRUE,
+  .id = 2496,
+  .ra = 119.656,
+  .dec = 8.02858,
+},
+{ .is_ngc = TRUE,
+  .id = 2497,
+  .ra = 120.547,
+  .dec = 56.9421,
+},
+{ .is_ngc = TRUE,
+  .id = 2498,
+  .ra = 119.912,
+  .dec = 24.9826,
+},
+{ .is_ngc = TRUE,
+  .id = 2499,
+  .ra = 119.715,
+  .dec = 7.4925,
+},
+{ .is_ngc = TRUE,
+  .id = 2500,
+  .ra = 120.472,
+  .dec = 50.7374,
+},
+{ .is_ngc = TRUE,
+  .id = 2501,
+  .ra = 119.625,
+  .dec = -14.3547,
+},
+{ .is_ngc = TRUE,
+  .id = 2502,
+  .ra = 118.966,
+  .dec = -52.3072,
+},
+{ .is_ngc = TRUE,
+  .id = 2503,
+  .ra = 120.153,
+  .dec = 22.3997,
+},
+{ .is_ngc = TRUE,
+  .id = 2504,
+  .ra = 119.968,
+  .dec = 5.60783,
+},
+{ .is_ngc = TRUE,
+  .id = 2505,
+  .ra = 121.029,
+  .dec = 53.5491,
+},
+{ .is_ngc = TRUE,
+  .id = 2506,
+  .ra = 120.004,
+  .dec = -10.7672,
+},
+{ .is_ngc = TRUE,
+  .id = 2507,
+  .ra = 120.405,
+  .dec = 15.7098,
+},
+{ .is_ngc = TRUE,
+  .id = 2508,
+  .ra = 120.489,
+  .dec = 8.55186,
+},
+{ .is_ngc = TRUE,
+  .id = 2509,
+  .ra = 120.2,
+  .dec = -19.0503,
+},
+{ .is_ngc = TRUE,
+  .id = 2510,
+  .ra = 120.544,
+  .dec = 9.48586,
+},
+{ .is_ngc = TRUE,
+  .id = 2511,
+  .ra = 120.563,
+  .dec = 9.39456,
+},
+{ .is_ngc = TRUE,
+  .id = 2512,
+  .ra = 120.782,
+  .dec = 23.3914,
+},
+{ .is_ngc = TRUE,
+  .id = 2513,
+  .ra = 120.603,
+  .dec = 9.41322,
+},
+{ .is_ngc = TRUE,
+  .id = 2514,
+  .ra = 120.707,
+  .dec = 15.8079,
+},
+{ .is_ngc = TRUE,
+  .id = 2515,
+  .ra = 120.839,
+  .dec = 20.1875,
+},
+{ .is_ngc = TRUE,
+  .id = 2516,
+  .ra = 119.517,
+  .dec = -60.7506,
+},
+{ .is_ngc = TRUE,
+  .id = 2517,
+  .ra = 120.697,
+  .dec = -12.3183,
+},
+{ .is_ngc = TRUE,
+  .id = 2518,
+  .ra = 121.835,
+  .dec = 51.1315,
+},
+{ .is_ngc = TRUE,
+  .id = 2519,
+  .ra = 121.995,
+  .dec = 51.1283,
+},
+{ .is_ngc = TRUE,
+  .id = 2520,
+  .ra = 120.65,
+  .dec = -28.1831,
+},
+{ .is_ngc = TRUE,
+  .id = 2521,
+  .ra = 122.206,
+  .dec = 57.7695,
+},
+{ .is_ngc = TRUE,
+  .id = 2522,
+  .ra = 121.556,
+  .dec = 17.7066,
+},
+{ .is_ngc = TRUE,
+  .id = 2523,
+  .ra = 123.75,
+  .dec = 73.5789,
+},
+{ .is_ngc = TRUE,
+  .id = 2524,
+  .ra = 122.04,
+  .dec = 39.1574,
+},
+{ .is_ngc = TRUE,
+  .id = 2525,
+  .ra = 121.408,
+  .dec = -11.4281,
+},
+{ .is_ngc = TRUE,
+  .id = 2526,
+  .ra = 121.744,
+  .dec = 8.00389,
+},
+{ .is_ngc = TRUE,
+  .id = 2528,
+  .ra = 121.855,
+  .dec = 39.1944,
+},
+{ .is_ngc = TRUE,
+  .id = 2529,
+  .ra = 121.739,
+  .dec = 17.8286,
+},
+{ .is_ngc = TRUE,
+  .id = 2530,
+  .ra = 121.982,
+  .dec = 17.8182,
+},
+{ .is_ngc = TRUE,
+  .id = 2531,
+  .ra = 121.982,
+  .dec = 17.8342,
+},
+{ .is_ngc = TRUE,
+  .id = 2532,
+  .ra = 122.563,
+  .dec = 33.957,
+},
+{ .is_ngc = TRUE,
+  .id = 2533,
+  .ra = 121.767,
+  .dec = -29.8833,
+},
+{ .is_ngc = TRUE,
+  .id = 2534,
+  .ra = 123.225,
+  .dec = 55.6718,
+},
+{ .is_ngc = TRUE,
+  .id = 2535,
+  .ra = 122.806,
+  .dec = 25.2067,
+},
+{ .is_ngc = TRUE,
+  .id = 2536,
+  .ra = 122.817,
+  .dec = 25.1792,
+},
+{ .is_ngc = TRUE,
+  .id = 2537,
+  .ra = 123.311,
+  .dec = 45.9917,
+},
+{ .is_ngc = TRUE,
+  .id = 2538,
+  .ra = 122.846,
+  .dec = 3.63317,
+},
+{ .is_ngc = TRUE,
+  .id = 2539,
+  .ra = 122.654,
+  .dec = -12.8169,
+},
+{ .is_ngc = TRUE,
+  .id = 2540,
+  .ra = 123.193,
+  .dec = 26.3614,
+},
+{ .is_ngc = TRUE,
+  .id = 2541,
+  .ra = 123.668,
+  .dec = 49.0621,
+},
+{ .is_ngc = TRUE,
+  .id = 2542,
+  .ra = 122.818,
+  .dec = -12.927,
+},
+{ .is_ngc = TRUE,
+  .id = 2544,
+  .ra = 125.418,
+  .dec = 73.9882,
+},
+{ .is_ngc = TRUE,
+  .id = 2545,
+  .ra = 123.559,
+  .dec = 21.356,
+},
+{ .is_ngc = TRUE,
+  .id = 2546,
+  .ra = 123.062,
+  .dec = -37.5853,
+},
+{ .is_ngc = TRUE,
+  .id = 2547,
+  .ra = 122.537,
+  .dec = -49.2025,
+},
+{ .is_ngc = TRUE,
+  .id = 2548,
+  .ra = 123.429,
+  .dec = -5.75,
+},
+{ .is_ngc = TRUE,
+  .id = 2549,
+  .ra = 124.743,
+  .dec = 57.8027,
+},
+{ .is_ngc = TRUE,
+  .id = 2550,
+  .ra = 126.142,
+  .dec = 74.0115,
+},
+{ .is_ngc = TRUE,
+  .id = 2551,
+  .ra = 126.208,
+  .dec = 73.4125,
+},
+{ .is_ngc = TRUE,
+  .id = 2552,
+  .ra = 124.834,
+  .dec = 50.0085,
+},
+{ .is_ngc = TRUE,
+  .id = 2553,
+  .ra = 124.396,
+  .dec = 20.9029,
+},
+{ .is_ngc = TRUE,
+  .id = 2554,
+  .ra = 124.473,
+  .dec = 23.4716,
+},
+{ .is_ngc = TRUE,
+  .id = 2555,
+  .ra = 124.485,
+  .dec = 0.745,
+},
+{ .is_ngc = TRUE,
+  .id = 2556,
+  .ra = 124.754,
+  .dec = 20.9368,
+},
+{ .is_ngc = TRUE,
+  .id = 2557,
+  .ra = 124.795,
+  .dec = 21.4355,
+},
+{ .is_ngc = TRUE,
+  .id = 2558,
+  .ra = 124.804,
+  .dec = 20.5107,
+},
+{ .is_ngc = TRUE,
+  .id = 2559,
+  .ra = 124.275,
+  .dec = -27.4572,
+},
+{ .is_ngc = TRUE,
+  .id = 2560,
+  .ra = 124.966,
+  .dec = 20.9849,
+},
+{ .is_ngc = TRUE,
+  .id = 2561,
+  .ra = 124.904,
+  .dec = 4.65669,
+},
+{ .is_ngc = TRUE,
+  .id = 2562,
+  .ra = 125.099,
+  .dec = 21.1315,
+},
+{ .is_ngc = TRUE,
+  .id = 2563,
+  .ra = 125.149,
+  .dec = 21.0678,
+},
+{ .is_ngc = TRUE,
+  .id = 2564,
+  .ra = 124.625,
+  .dec = -21.8166,
+},
+{ .is_ngc = TRUE,
+  .id = 2565,
+  .ra = 124.951,
+  .dec = 22.0306,
+},
+{ .is_ngc = TRUE,
+  .id = 2566,
+  .ra = 124.69,
+  .dec = -25.4992,
+},
+{ .is_ngc = TRUE,
+  .id = 2567,
+  .ra = 124.633,
+  .dec = -30.6344,
+},
+{ .is_ngc = TRUE,
+  .id = 2568,
+  .ra = 124.575,
+  .dec = -37.1008,
+},
+{ .is_ngc = TRUE,
+  .id = 2569,
+  .ra = 125.338,
+  .dec = 20.8673,
+},
+{ .is_ngc = TRUE,
+  .id = 2570,
+  .ra = 125.344,
+  .dec = 20.9106,
+},
+{ .is_ngc = TRUE,
+  .id = 2571,
+  .ra = 124.733,
+  .dec = -29.75,
+},
+{ .is_ngc = TRUE,
+  .id = 2572,
+  .ra = 125.353,
+  .dec = 19.1473,
+},
+{ .is_ngc = TRUE,
+  .id = 2573,
+  .ra = 25.4512,
+  .dec = -89.3347,
+},
+{ .is_ngc = TRUE,
+  .id = 2574,
+  .ra = 125.201,
+  .dec = -8.91861,
+},
+{ .is_ngc = TRUE,
+  .id = 2575,
+  .ra = 125.687,
+  .dec = 24.2969,
+},
+{ .is_ngc = TRUE,
+  .id = 2576,
+  .ra = 125.741,
+  .dec = 25.7387,
+},
+{ .is_ngc = TRUE,
+  .id = 2577,
+  .ra = 125.681,
+  .dec = 22.553,
+},
+{ .is_ngc = TRUE,
+  .id = 2578,
+  .ra = 125.351,
+  .dec = -13.3178,
+},
+{ .is_ngc = TRUE,
+  .id = 2579,
+  .ra = 125.22,
+  .dec = -36.2167,
+},
+{ .is_ngc = TRUE,
+  .id = 2580,
+  .ra = 125.367,
+  .dec = -30.3,
+},
+{ .is_ngc = TRUE,
+  .id = 2581,
+  .ra = 126.129,
+  .dec = 18.5968,
+},
+{ .is_ngc = TRUE,
+  .id = 2583,
+  .ra = 125.783,
+  .dec = -5.00253,
+},
+{ .is_ngc = TRUE,
+  .id = 2584,
+  .ra = 125.814,
+  .dec = -4.97036,
+},
+{ .is_ngc = TRUE,
+  .id = 2585,
+  .ra = 125.859,
+  .dec = -4.91511,
+},
+{ .is_ngc = TRUE,
+  .id = 2586,
+  .ra = 125.881,
+  .dec = -4.95167,
+},
+{ .is_ngc = TRUE,
+  .id = 2587,
+  .ra = 125.854,
+  .dec = -29.5014,
+},
+{ .is_ngc = TRUE,
+  .id = 2588,
+  .ra = 125.792,
+  .dec = -32.9681,
+},
+{ .is_ngc = TRUE,
+  .id = 2589,
+  .ra = 126.121,
+  .dec = -8.76694,
+},
+{ .is_ngc = TRUE,
+  .id = 2591,
+  .ra = 129.357,
+  .dec = 78.0254,
+},
+{ .is_ngc = TRUE,
+  .id = 2592,
+  .ra = 126.784,
+  .dec = 25.9701,
+},
+{ .is_ngc = TRUE,
+  .id = 2593,
+  .ra = 126.699,
+  .dec = 17.3743,
+},
+{ .is_ngc = TRUE,
+  .id = 2594,
+  .ra = 126.822,
+  .dec = 25.8784,
+},
+{ .is_ngc = TRUE,
+  .id = 2595,
+  .ra = 126.925,
+  .dec = 21.479,
+},
+{ .is_ngc = TRUE,
+  .id = 2596,
+  .ra = 126.861,
+  .dec = 17.2839,
+},
+{ .is_ngc = TRUE,
+  .id = 2597,
+  .ra = 127.489,
+  .dec = 21.5019,
+},
+{ .is_ngc = TRUE,
+  .id = 2598,
+  .ra = 127.511,
+  .dec = 21.4887,
+},
+{ .is_ngc = TRUE,
+  .id = 2599,
+  .ra = 128.047,
+  .dec = 22.5603,
+},
+{ .is_ngc = TRUE,
+  .id = 2600,
+  .ra = 128.687,
+  .dec = 52.7153,
+},
+{ .is_ngc = TRUE,
+  .id = 2601,
+  .ra = 126.376,
+  .dec = -68.1181,
+},
+{ .is_ngc = TRUE,
+  .id = 2602,
+  .ra = 128.768,
+  .dec = 52.8314,
+},
+{ .is_ngc = TRUE,
+  .id = 2603,
+  .ra = 128.63,
+  .dec = 52.8401,
+},
+{ .is_ngc = TRUE,
+  .id = 2605,
+  .ra = 128.722,
+  .dec = 52.8042,
+},
+{ .is_ngc = TRUE,
+  .id = 2606,
+  .ra = 128.893,
+  .dec = 52.7886,
+},
+{ .is_ngc = TRUE,
+  .id = 2607,
+  .ra = 128.486,
+  .dec = 26.9727,
+},
+{ .is_ngc = TRUE,
+  .id = 2608,
+  .ra = 128.822,
+  .dec = 28.4734,
+},
+{ .is_ngc = TRUE,
+  .id = 2609,
+  .ra = 127.383,
+  .dec = -61.1017,
+},
+{ .is_ngc = TRUE,
+  .id = 2610,
+  .ra = 128.348,
+  .dec = -16.1492,
+},
+{ .is_ngc = TRUE,
+  .id = 2611,
+  .ra = 128.872,
+  .dec = 25.0272,
+},
+{ .is_ngc = TRUE,
+  .id = 2612,
+  .ra = 128.459,
+  .dec = -13.175,
+},
+{ .is_ngc = TRUE,
+  .id = 2613,
+  .ra = 128.345,
+  .dec = -22.9731,
+},
+{ .is_ngc = TRUE,
+  .id = 2614,
+  .ra = 130.699,
+  .dec = 72.9769,
+},
+{ .is_ngc = TRUE,
+  .id = 2615,
+  .ra = 128.639,
+  .dec = -2.54728,
+},
+{ .is_ngc = TRUE,
+  .id = 2616,
+  .ra = 128.892,
+  .dec = -1.85061,
+},
+{ .is_ngc = TRUE,
+  .id = 2617,
+  .ra = 128.912,
+  .dec = -4.08856,
+},
+{ .is_ngc = TRUE,
+  .id = 2618,
+  .ra = 128.973,
+  .dec = 0.706861,
+},
+{ .is_ngc = TRUE,
+  .id = 2619,
+  .ra = 129.386,
+  .dec = 28.7054,
+},
+{ .is_ngc = TRUE,
+  .id = 2620,
+  .ra = 129.368,
+  .dec = 24.9466,
+},
+{ .is_ngc = TRUE,
+  .id = 2621,
+  .ra = 129.404,
+  .dec = 24.9998,
+},
+{ .is_ngc = TRUE,
+  .id = 2622,
+  .ra = 129.545,
+  .dec = 24.895,
+},
+{ .is_ngc = TRUE,
+  .id = 2623,
+  .ra = 129.6,
+  .dec = 25.7542,
+},
+{ .is_ngc = TRUE,
+  .id = 2624,
+  .ra = 129.54,
+  .dec = 19.7255,
+},
+{ .is_ngc = TRUE,
+  .id = 2625,
+  .ra = 129.596,
+  .dec = 19.7159,
+},
+{ .is_ngc = TRUE,
+  .id = 2626,
+  .ra = 128.879,
+  .dec = -40.6675,
+},
+{ .is_ngc = TRUE,
+  .id = 2627,
+  .ra = 129.312,
+  .dec = -29.9508,
+},
+{ .is_ngc = TRUE,
+  .id = 2628,
+  .ra = 130.094,
+  .dec = 23.5396,
+},
+{ .is_ngc = TRUE,
+  .id = 2629,
+  .ra = 131.814,
+  .dec = 72.9852,
+},
+{ .is_ngc = TRUE,
+  .id = 2630,
+  .ra = 131.754,
+  .dec = 73,
+},
+{ .is_ngc = TRUE,
+  .id = 2631,
+  .ra = 131.754,
+  .dec = 73,
+},
+{ .is_ngc = TRUE,
+  .id = 2632,
+  .ra = 130.017,
+  .dec = 19.6667,
+},
+{ .is_ngc = TRUE,
+  .id = 2633,
+  .ra = 132.02,
+  .dec = 74.0988,
+},
+{ .is_ngc = TRUE,
+  .id = 2634,
+  .ra = 132.106,
+  .dec = 73.9669,
+},
+{ .is_ngc = TRUE,
+  .id = 2635,
+  .ra = 129.608,
+  .dec = -34.7672,
+},
+{ .is_ngc = TRUE,
+  .id = 2636,
+  .ra = 132.102,
+  .dec = 73.671,
+},
+{ .is_ngc = TRUE,
+  .id = 2637,
+  .ra = 130.306,
+  .dec = 19.6904,
+},
+{ .is_ngc = TRUE,
+  .id = 2638,
+  .ra = 130.608,
+  .dec = 37.2204,
+},
+{ .is_ngc = TRUE,
+  .id = 2639,
+  .ra = 130.908,
+  .dec = 50.2056,
+},
+{ .is_ngc = TRUE,
+  .id = 2640,
+  .ra = 129.353,
+  .dec = -55.1239,
+},
+{ .is_ngc = TRUE,
+  .id = 2641,
+  .ra = 131.989,
+  .dec = 72.8957,
+},
+{ .is_ngc = TRUE,
+  .id = 2642,
+  .ra = 130.185,
+  .dec = -4.12194,
+},
+{ .is_ngc = TRUE,
+  .id = 2644,
+  .ra = 130.383,
+  .dec = 4.98053,
+},
+{ .is_ngc = TRUE,
+  .id = 2645,
+  .ra = 129.762,
+  .dec = -46.2192,
+},
+{ .is_ngc = TRUE,
+  .id = 2646,
+  .ra = 132.592,
+  .dec = 73.4624,
+},
+{ .is_ngc = TRUE,
+  .id = 2647,
+  .ra = 130.68,
+  .dec = 19.6504,
+},
+{ .is_ngc = TRUE,
+  .id = 2648,
+  .ra = 130.666,
+  .dec = 14.2854,
+},
+{ .is_ngc = TRUE,
+  .id = 2649,
+  .ra = 131.034,
+  .dec = 34.7171,
+},
+{ .is_ngc = TRUE,
+  .id = 2650,
+  .ra = 132.493,
+  .dec = 70.2989,
+},
+{ .is_ngc = TRUE,
+  .id = 2651,
+  .ra = 130.98,
+  .dec = 11.7708,
+},
+{ .is_ngc = TRUE,
+  .id = 2652,
+  .ra = 130.804,
+  .dec = -3.60194,
+},
+{ .is_ngc = TRUE,
+  .id = 2653,
+  .ra = 133.732,
+  .dec = 78.3933,
+},
+{ .is_ngc = TRUE,
+  .id = 2654,
+  .ra = 132.3,
+  .dec = 60.2206,
+},
+{ .is_ngc = TRUE,
+  .id = 2655,
+  .ra = 133.909,
+  .dec = 78.2234,
+},
+{ .is_ngc = TRUE,
+  .id = 2656,
+  .ra = 131.971,
+  .dec = 53.8761,
+},
+{ .is_ngc = TRUE,
+  .id = 2657,
+  .ra = 131.316,
+  .dec = 9.64569,
+},
+{ .is_ngc = TRUE,
+  .id = 2658,
+  .ra = 130.863,
+  .dec = -32.6514,
+},
+{ .is_ngc = TRUE,
+  .id = 2659,
+  .ra = 130.654,
+  .dec = -44.9833,
+},
+{ .is_ngc = TRUE,
+  .id = 2660,
+  .ra = 130.658,
+  .dec = -47.2,
+},
+{ .is_ngc = TRUE,
+  .id = 2661,
+  .ra = 131.498,
+  .dec = 12.6199,
+},
+{ .is_ngc = TRUE,
+  .id = 2662,
+  .ra = 131.383,
+  .dec = -15.1215,
+},
+{ .is_ngc = TRUE,
+  .id = 2663,
+  .ra = 131.284,
+  .dec = -33.7947,
+},
+{ .is_ngc = TRUE,
+  .id = 2664,
+  .ra = 131.79,
+  .dec = 12.6028,
+},
+{ .is_ngc = TRUE,
+  .id = 2665,
+  .ra = 131.504,
+  .dec = -19.3031,
+},
+{ .is_ngc = TRUE,
+  .id = 2666,
+  .ra = 132.447,
+  .dec = 44.7045,
+},
+{ .is_ngc = TRUE,
+  .id = 2668,
+  .ra = 132.344,
+  .dec = 36.7101,
+},
+{ .is_ngc = TRUE,
+  .id = 2669,
+  .ra = 131.592,
+  .dec = -52.9358,
+},
+{ .is_ngc = TRUE,
+  .id = 2670,
+  .ra = 131.375,
+  .dec = -48.8,
+},
+{ .is_ngc = TRUE,
+  .id = 2671,
+  .ra = 131.554,
+  .dec = -41.8794,
+},
+{ .is_ngc = TRUE,
+  .id = 2672,
+  .ra = 132.342,
+  .dec = 19.0744,
+},
+{ .is_ngc = TRUE,
+  .id = 2673,
+  .ra = 132.351,
+  .dec = 19.074,
+},
+{ .is_ngc = TRUE,
+  .id = 2674,
+  .ra = 132.305,
+  .dec = -14.2944,
+},
+{ .is_ngc = TRUE,
+  .id = 2675,
+  .ra = 133.021,
+  .dec = 53.617,
+},
+{ .is_ngc = TRUE,
+  .id = 2676,
+  .ra = 132.898,
+  .dec = 47.5576,
+},
+{ .is_ngc = TRUE,
+  .id = 2677,
+  .ra = 132.505,
+  .dec = 19.0097,
+},
+{ .is_ngc = TRUE,
+  .id = 2678,
+  .ra = 132.508,
+  .dec = 11.3342,
+},
+{ .is_ngc = TRUE,
+  .id = 2679,
+  .ra = 132.887,
+  .dec = 30.865,
+},
+{ .is_ngc = TRUE,
+  .id = 2680,
+  .ra = 132.89,
+  .dec = 30.8653,
+},
+{ .is_ngc = TRUE,
+  .id = 2681,
+  .ra = 133.387,
+  .dec = 51.3135,
+},
+{ .is_ngc = TRUE,
+  .id = 2682,
+  .ra = 132.762,
+  .dec = 11.8,
+},
+{ .is_ngc = TRUE,
+  .id = 2683,
+  .ra = 133.173,
+  .dec = 33.4206,
+},
+{ .is_ngc = TRUE,
+  .id = 2684,
+  .ra = 133.725,
+  .dec = 49.1603,
+},
+{ .is_ngc = TRUE,
+  .id = 2685,
+  .ra = 133.895,
+  .dec = 58.7339,
+},
+{ .is_ngc = TRUE,
+  .id = 2688,
+  .ra = 133.798,
+  .dec = 49.1224,
+},
+{ .is_ngc = TRUE,
+  .id = 2689,
+  .ra = 133.856,
+  .dec = 49.115,
+},
+{ .is_ngc = TRUE,
+  .id = 2690,
+  .ra = 133.159,
+  .dec = -2.60342,
+},
+{ .is_ngc = TRUE,
+  .id = 2691,
+  .ra = 133.694,
+  .dec = 39.5387,
+},
+{ .is_ngc = TRUE,
+  .id = 2692,
+  .ra = 134.242,
+  .dec = 52.0657,
+},
+{ .is_ngc = TRUE,
+  .id = 2693,
+  .ra = 134.247,
+  .dec = 51.3466,
+},
+{ .is_ngc = TRUE,
+  .id = 2694,
+  .ra = 134.246,
+  .dec = 51.3311,
+},
+{ .is_ngc = TRUE,
+  .id = 2695,
+  .ra = 133.613,
+  .dec = -3.06722,
+},
+{ .is_ngc = TRUE,
+  .id = 2696,
+  .ra = 132.675,
+  .dec = -5.00968,
+},
+{ .is_ngc = TRUE,
+  .id = 2697,
+  .ra = 133.747,
+  .dec = -2.9875,
+},
+{ .is_ngc = TRUE,
+  .id = 2698,
+  .ra = 133.902,
+  .dec = -3.18417,
+},
+{ .is_ngc = TRUE,
+  .id = 2699,
+  .ra = 133.953,
+  .dec = -3.12797,
+},
+{ .is_ngc = TRUE,
+  .id = 2700,
+  .ra = 133.961,
+  .dec = -3.1165,
+},
+{ .is_ngc = TRUE,
+  .id = 2701,
+  .ra = 134.774,
+  .dec = 53.7703,
+},
+{ .is_ngc = TRUE,
+  .id = 2702,
+  .ra = 133.978,
+  .dec = -3.06533,
+},
+{ .is_ngc = TRUE,
+  .id = 2703,
+  .ra = 133.946,
+  .dec = -3.30692,
+},
+{ .is_ngc = TRUE,
+  .id = 2705,
+  .ra = 134,
+  .dec = -3.01489,
+},
+{ .is_ngc = TRUE,
+  .id = 2706,
+  .ra = 134.052,
+  .dec = -2.564,
+},
+{ .is_ngc = TRUE,
+  .id = 2707,
+  .ra = 134.024,
+  .dec = -3.06642,
+},
+{ .is_ngc = TRUE,
+  .id = 2709,
+  .ra = 134.054,
+  .dec = -3.24363,
+},
+{ .is_ngc = TRUE,
+  .id = 2710,
+  .ra = 134.952,
+  .dec = 55.7061,
+},
+{ .is_ngc = TRUE,
+  .id = 2711,
+  .ra = 134.348,
+  .dec = 17.2876,
+},
+{ .is_ngc = TRUE,
+  .id = 2712,
+  .ra = 134.877,
+  .dec = 44.9141,
+},
+{ .is_ngc = TRUE,
+  .id = 2713,
+  .ra = 134.336,
+  .dec = 2.92081,
+},
+{ .is_ngc = TRUE,
+  .id = 2714,
+  .ra = 133.373,
+  .dec = -59.2175,
+},
+{ .is_ngc = TRUE,
+  .id = 2715,
+  .ra = 137.026,
+  .dec = 78.0854,
+},
+{ .is_ngc = TRUE,
+  .id = 2716,
+  .ra = 134.399,
+  .dec = 3.08994,
+},
+{ .is_ngc = TRUE,
+  .id = 2717,
+  .ra = 134.256,
+  .dec = -24.6736,
+},
+{ .is_ngc = TRUE,
+  .id = 2718,
+  .ra = 134.71,
+  .dec = 6.29281,
+},
+{ .is_ngc = TRUE,
+  .id = 2719,
+  .ra = 135.065,
+  .dec = 35.7277,
+},
+{ .is_ngc = TRUE,
+  .id = 2720,
+  .ra = 134.784,
+  .dec = 11.1493,
+},
+{ .is_ngc = TRUE,
+  .id = 2721,
+  .ra = 134.736,
+  .dec = -4.90225,
+},
+{ .is_ngc = TRUE,
+  .id = 2723,
+  .ra = 135.06,
+  .dec = 3.17756,
+},
+{ .is_ngc = TRUE,
+  .id = 2724,
+  .ra = 135.257,
+  .dec = 35.7622,
+},
+{ .is_ngc = TRUE,
+  .id = 2725,
+  .ra = 135.263,
+  .dec = 11.0971,
+},
+{ .is_ngc = TRUE,
+  .id = 2726,
+  .ra = 136.237,
+  .dec = 59.9327,
+},
+{ .is_ngc = TRUE,
+  .id = 2728,
+  .ra = 135.421,
+  .dec = 11.0828,
+},
+{ .is_ngc = TRUE,
+  .id = 2729,
+  .ra = 135.37,
+  .dec = 3.72028,
+},
+{ .is_ngc = TRUE,
+  .id = 2730,
+  .ra = 135.566,
+  .dec = 16.8383,
+},
+{ .is_ngc = TRUE,
+  .id = 2731,
+  .ra = 135.535,
+  .dec = 8.30064,
+},
+{ .is_ngc = TRUE,
+  .id = 2732,
+  .ra = 138.354,
+  .dec = 79.1873,
+},
+{ .is_ngc = TRUE,
+  .id = 2734,
+  .ra = 135.757,
+  .dec = 16.8637,
+},
+{ .is_ngc = TRUE,
+  .id = 2735,
+  .ra = 135.661,
+  .dec = 25.9345,
+},
+{ .is_ngc = TRUE,
+  .id = 2736,
+  .ra = 135.067,
+  .dec = -45.9358,
+},
+{ .is_ngc = TRUE,
+  .id = 2737,
+  .ra = 135.999,
+  .dec = 21.906,
+},
+{ .is_ngc = TRUE,
+  .id = 2738,
+  .ra = 136.002,
+  .dec = 21.9679,
+},
+{ .is_ngc = TRUE,
+  .id = 2739,
+  .ra = 136.512,
+  .dec = 51.7444,
+},
+{ .is_ngc = TRUE,
+  .id = 2740,
+  .ra = 136.52,
+  .dec = 51.7351,
+},
+{ .is_ngc = TRUE,
+  .id = 2741,
+  .ra = 135.819,
+  .dec = 18.2614,
+},
+{ .is_ngc = TRUE,
+  .id = 2743,
+  .ra = 136.226,
+  .dec = 25.004,
+},
+{ .is_ngc = TRUE,
+  .id = 2745,
+  .ra = 136.164,
+  .dec = 18.2572,
+},
+{ .is_ngc = TRUE,
+  .id = 2746,
+  .ra = 136.498,
+  .dec = 35.3773,
+},
+{ .is_ngc = TRUE,
+  .id = 2747,
+  .ra = 136.326,
+  .dec = 18.4419,
+},
+{ .is_ngc = TRUE,
+  .id = 2748,
+  .ra = 138.43,
+  .dec = 76.4754,
+},
+{ .is_ngc = TRUE,
+  .id = 2749,
+  .ra = 136.339,
+  .dec = 18.3133,
+},
+{ .is_ngc = TRUE,
+  .id = 2750,
+  .ra = 136.45,
+  .dec = 25.4367,
+},
+{ .is_ngc = TRUE,
+  .id = 2751,
+  .ra = 136.385,
+  .dec = 18.2619,
+},
+{ .is_ngc = TRUE,
+  .id = 2752,
+  .ra = 136.429,
+  .dec = 18.3395,
+},
+{ .is_ngc = TRUE,
+  .id = 2754,
+  .ra = 136.296,
+  .dec = -19.0851,
+},
+{ .is_ngc = TRUE,
+  .id = 2755,
+  .ra = 136.993,
+  .dec = 41.7089,
+},
+{ .is_ngc = TRUE,
+  .id = 2756,
+  .ra = 137.255,
+  .dec = 53.8488,
+},
+{ .is_ngc = TRUE,
+  .id = 2757,
+  .ra = 136.358,
+  .dec = -19.0483,
+},
+{ .is_ngc = TRUE,
+  .id = 2758,
+  .ra = 136.38,
+  .dec = -19.0431,
+},
+{ .is_ngc = TRUE,
+  .id = 2759,
+  .ra = 137.156,
+  .dec = 37.6212,
+},
+{ .is_ngc = TRUE,
+  .id = 2760,
+  .ra = 138.921,
+  .dec = 76.3692,
+},
+{ .is_ngc = TRUE,
+  .id = 2761,
+  .ra = 136.878,
+  .dec = 18.4347,
+},
+{ .is_ngc = TRUE,
+  .id = 2762,
+  .ra = 137.477,
+  .dec = 50.4183,
+},
+{ .is_ngc = TRUE,
+  .id = 2763,
+  .ra = 136.705,
+  .dec = -15.5,
+},
+{ .is_ngc = TRUE,
+  .id = 2764,
+  .ra = 137.073,
+  .dec = 21.4436,
+},
+{ .is_ngc = TRUE,
+  .id = 2765,
+  .ra = 136.903,
+  .dec = 3.39256,
+},
+{ .is_ngc = TRUE,
+  .id = 2766,
+  .ra = 137.198,
+  .dec = 29.8648,
+},
+{ .is_ngc = TRUE,
+  .id = 2767,
+  .ra = 137.55,
+  .dec = 50.4013,
+},
+{ .is_ngc = TRUE,
+  .id = 2768,
+  .ra = 137.906,
+  .dec = 60.037,
+},
+{ .is_ngc = TRUE,
+  .id = 2769,
+  .ra = 137.634,
+  .dec = 50.4333,
+},
+{ .is_ngc = TRUE,
+  .id = 2770,
+  .ra = 137.39,
+  .dec = 33.1236,
+},
+{ .is_ngc = TRUE,
+  .id = 2771,
+  .ra = 137.666,
+  .dec = 50.3794,
+},
+{ .is_ngc = TRUE,
+  .id = 2772,
+  .ra = 136.924,
+  .dec = -23.6211,
+},
+{ .is_ngc = TRUE,
+  .id = 2773,
+  .ra = 137.434,
+  .dec = 7.17356,
+},
+{ .is_ngc = TRUE,
+  .id = 2774,
+  .ra = 137.666,
+  .dec = 18.6963,
+},
+{ .is_ngc = TRUE,
+  .id = 2775,
+  .ra = 137.584,
+  .dec = 7.03767,
+},
+{ .is_ngc = TRUE,
+  .id = 2776,
+  .ra = 138.061,
+  .dec = 44.9547,
+},
+{ .is_ngc = TRUE,
+  .id = 2777,
+  .ra = 137.675,
+  .dec = 7.20646,
+},
+{ .is_ngc = TRUE,
+  .id = 2778,
+  .ra = 138.102,
+  .dec = 35.0274,
+},
+{ .is_ngc = TRUE,
+  .id = 2779,
+  .ra = 138.118,
+  .dec = 35.0533,
+},
+{ .is_ngc = TRUE,
+  .id = 2780,
+  .ra = 138.185,
+  .dec = 34.9254,
+},
+{ .is_ngc = TRUE,
+  .id = 2781,
+  .ra = 137.865,
+  .dec = -14.8167,
+},
+{ .is_ngc = TRUE,
+  .id = 2782,
+  .ra = 138.522,
+  .dec = 40.1138,
+},
+{ .is_ngc = TRUE,
+  .id = 2784,
+  .ra = 138.081,
+  .dec = -24.1724,
+},
+{ .is_ngc = TRUE,
+  .id = 2785,
+  .ra = 138.814,
+  .dec = 40.9175,
+},
+{ .is_ngc = TRUE,
+  .id = 2786,
+  .ra = 138.4,
+  .dec = 12.4403,
+},
+{ .is_ngc = TRUE,
+  .id = 2787,
+  .ra = 139.828,
+  .dec = 69.2031,
+},
+{ .is_ngc = TRUE,
+  .id = 2788,
+  .ra = 137.264,
+  .dec = -67.9325,
+},
+{ .is_ngc = TRUE,
+  .id = 2789,
+  .ra = 138.749,
+  .dec = 29.73,
+},
+{ .is_ngc = TRUE,
+  .id = 2790,
+  .ra = 138.762,
+  .dec = 19.6972,
+},
+{ .is_ngc = TRUE,
+  .id = 2791,
+  .ra = 138.758,
+  .dec = 17.5925,
+},
+{ .is_ngc = TRUE,
+  .id = 2792,
+  .ra = 138.111,
+  .dec = -42.4281,
+},
+{ .is_ngc = TRUE,
+  .id = 2793,
+  .ra = 139.195,
+  .dec = 34.4308,
+},
+{ .is_ngc = TRUE,
+  .id = 2794,
+  .ra = 139.007,
+  .dec = 17.5896,
+},
+{ .is_ngc = TRUE,
+  .id = 2795,
+  .ra = 139.016,
+  .dec = 17.6282,
+},
+{ .is_ngc = TRUE,
+  .id = 2796,
+  .ra = 139.174,
+  .dec = 30.9157,
+},
+{ .is_ngc = TRUE,
+  .id = 2797,
+  .ra = 139.091,
+  .dec = 17.7271,
+},
+{ .is_ngc = TRUE,
+  .id = 2798,
+  .ra = 139.345,
+  .dec = 41.9999,
+},
+{ .is_ngc = TRUE,
+  .id = 2799,
+  .ra = 139.38,
+  .dec = 41.9939,
+},
+{ .is_ngc = TRUE,
+  .id = 2800,
+  .ra = 139.647,
+  .dec = 52.5139,
+},
+{ .is_ngc = TRUE,
+  .id = 2801,
+  .ra = 139.184,
+  .dec = 19.9346,
+},
+{ .is_ngc = TRUE,
+  .id = 2802,
+  .ra = 139.172,
+  .dec = 18.9633,
+},
+{ .is_ngc = TRUE,
+  .id = 2803,
+  .ra = 139.182,
+  .dec = 18.9542,
+},
+{ .is_ngc = TRUE,
+  .id = 2805,
+  .ra = 140.085,
+  .dec = 64.1031,
+},
+{ .is_ngc = TRUE,
+  .id = 2806,
+  .ra = 139.237,
+  .dec = 20.0706,
+},
+{ .is_ngc = TRUE,
+  .id = 2807,
+  .ra = 139.253,
+  .dec = 20.036,
+},
+{ .is_ngc = TRUE,
+  .id = 2808,
+  .ra = 138.011,
+  .dec = -64.8639,
+},
+{ .is_ngc = TRUE,
+  .id = 2809,
+  .ra = 139.278,
+  .dec = 20.0696,
+},
+{ .is_ngc = TRUE,
+  .id = 2811,
+  .ra = 139.047,
+  .dec = -16.3131,
+},
+{ .is_ngc = TRUE,
+  .id = 2812,
+  .ra = 139.42,
+  .dec = 19.9188,
+},
+{ .is_ngc = TRUE,
+  .id = 2813,
+  .ra = 139.439,
+  .dec = 19.9065,
+},
+{ .is_ngc = TRUE,
+  .id = 2814,
+  .ra = 140.299,
+  .dec = 64.2515,
+},
+{ .is_ngc = TRUE,
+  .id = 2815,
+  .ra = 139.081,
+  .dec = -23.6339,
+},
+{ .is_ngc = TRUE,
+  .id = 2817,
+  .ra = 139.294,
+  .dec = -4.75333,
+},
+{ .is_ngc = TRUE,
+  .id = 2818,
+  .ra = 139.006,
+  .dec = -36.6269,
+},
+{ .is_ngc = TRUE,
+  .id = 2819,
+  .ra = 139.539,
+  .dec = 16.198,
+},
+{ .is_ngc = TRUE,
+  .id = 2820,
+  .ra = 140.442,
+  .dec = 64.2583,
+},
+{ .is_ngc = TRUE,
+  .id = 2821,
+  .ra = 139.199,
+  .dec = -26.8167,
+},
+{ .is_ngc = TRUE,
+  .id = 2822,
+  .ra = 138.458,
+  .dec = -69.6451,
+},
+{ .is_ngc = TRUE,
+  .id = 2823,
+  .ra = 139.822,
+  .dec = 34.0078,
+},
+{ .is_ngc = TRUE,
+  .id = 2824,
+  .ra = 139.76,
+  .dec = 26.2695,
+},
+{ .is_ngc = TRUE,
+  .id = 2825,
+  .ra = 139.844,
+  .dec = 33.7424,
+},
+{ .is_ngc = TRUE,
+  .id = 2826,
+  .ra = 139.851,
+  .dec = 33.6238,
+},
+{ .is_ngc = TRUE,
+  .id = 2828,
+  .ra = 139.895,
+  .dec = 33.8881,
+},
+{ .is_ngc = TRUE,
+  .id = 2829,
+  .ra = 139.968,
+  .dec = 33.65,
+},
+{ .is_ngc = TRUE,
+  .id = 2829,
+  .ra = 139.91,
+  .dec = 33.6536,
+},
+{ .is_ngc = TRUE,
+  .id = 2830,
+  .ra = 139.923,
+  .dec = 33.7379,
+},
+{ .is_ngc = TRUE,
+  .id = 2831,
+  .ra = 139.94,
+  .dec = 33.7445,
+},
+{ .is_ngc = TRUE,
+  .id = 2832,
+  .ra = 139.945,
+  .dec = 33.7497,
+},
+{ .is_ngc = TRUE,
+  .id = 2833,
+  .ra = 139.991,
+  .dec = 33.9273,
+},
+{ .is_ngc = TRUE,
+  .id = 2834,
+  .ra = 140.01,
+  .dec = 33.7103,
+},
+{ .is_ngc = TRUE,
+  .id = 2835,
+  .ra = 139.47,
+  .dec = -22.355,
+},
+{ .is_ngc = TRUE,
+  .id = 2836,
+  .ra = 138.438,
+  .dec = -69.3339,
+},
+{ .is_ngc = TRUE,
+  .id = 2837,
+  .ra = 139.598,
+  .dec = -16.4818,
+},
+{ .is_ngc = TRUE,
+  .id = 2838,
+  .ra = 140.179,
+  .dec = 39.3159,
+},
+{ .is_ngc = TRUE,
+  .id = 2839,
+  .ra = 140.151,
+  .dec = 33.6507,
+},
+{ .is_ngc = TRUE,
+  .id = 2840,
+  .ra = 140.22,
+  .dec = 35.368,
+},
+{ .is_ngc = TRUE,
+  .id = 2841,
+  .ra = 140.51,
+  .dec = 50.9765,
+},
+{ .is_ngc = TRUE,
+  .id = 2842,
+  .ra = 138.902,
+  .dec = -63.07,
+},
+{ .is_ngc = TRUE,
+  .id = 2843,
+  .ra = 140.12,
+  .dec = 18.926,
+},
+{ .is_ngc = TRUE,
+  .id = 2844,
+  .ra = 140.45,
+  .dec = 40.1512,
+},
+{ .is_ngc = TRUE,
+  .id = 2845,
+  .ra = 139.654,
+  .dec = -38.0106,
+},
+{ .is_ngc = TRUE,
+  .id = 2846,
+  .ra = 139.919,
+  .dec = -14.6763,
+},
+{ .is_ngc = TRUE,
+  .id = 2847,
+  .ra = 140.036,
+  .dec = -16.5178,
+},
+{ .is_ngc = TRUE,
+  .id = 2848,
+  .ra = 140.04,
+  .dec = -16.5256,
+},
+{ .is_ngc = TRUE,
+  .id = 2849,
+  .ra = 139.846,
+  .dec = -40.5178,
+},
+{ .is_ngc = TRUE,
+  .id = 2850,
+  .ra = 140.238,
+  .dec = -4.94031,
+},
+{ .is_ngc = TRUE,
+  .id = 2851,
+  .ra = 140.126,
+  .dec = -16.4956,
+},
+{ .is_ngc = TRUE,
+  .id = 2852,
+  .ra = 140.81,
+  .dec = 40.1638,
+},
+{ .is_ngc = TRUE,
+  .id = 2853,
+  .ra = 140.822,
+  .dec = 40.1998,
+},
+{ .is_ngc = TRUE,
+  .id = 2854,
+  .ra = 141.012,
+  .dec = 49.2039,
+},
+{ .is_ngc = TRUE,
+  .id = 2855,
+  .ra = 140.364,
+  .dec = -11.91,
+},
+{ .is_ngc = TRUE,
+  .id = 2856,
+  .ra = 141.068,
+  .dec = 49.2486,
+},
+{ .is_ngc = TRUE,
+  .id = 2857,
+  .ra = 141.157,
+  .dec = 49.3566,
+},
+{ .is_ngc = TRUE,
+  .id = 2858,
+  .ra = 140.729,
+  .dec = 3.1568,
+},
+{ .is_ngc = TRUE,
+  .id = 2859,
+  .ra = 141.078,
+  .dec = 34.5132,
+},
+{ .is_ngc = TRUE,
+  .id = 2860,
+  .ra = 141.222,
+  .dec = 41.0598,
+},
+{ .is_ngc = TRUE,
+  .id = 2861,
+  .ra = 140.902,
+  .dec = 2.13656,
+},
+{ .is_ngc = TRUE,
+  .id = 2862,
+  .ra = 141.23,
+  .dec = 26.7754,
+},
+{ .is_ngc = TRUE,
+  .id = 2864,
+  .ra = 141.064,
+  .dec = 5.94044,
+},
+{ .is_ngc = TRUE,
+  .id = 2865,
+  .ra = 140.876,
+  .dec = -23.1608,
+},
+{ .is_ngc = TRUE,
+  .id = 2866,
+  .ra = 140.525,
+  .dec = -51.1006,
+},
+{ .is_ngc = TRUE,
+  .id = 2867,
+  .ra = 140.355,
+  .dec = -58.3116,
+},
+{ .is_ngc = TRUE,
+  .id = 2868,
+  .ra = 140.863,
+  .dec = -10.4296,
+},
+{ .is_ngc = TRUE,
+  .id = 2870,
+  .ra = 141.974,
+  .dec = 57.376,
+},
+{ .is_ngc = TRUE,
+  .id = 2871,
+  .ra = 141.414,
+  .dec = 11.4433,
+},
+{ .is_ngc = TRUE,
+  .id = 2872,
+  .ra = 141.428,
+  .dec = 11.4321,
+},
+{ .is_ngc = TRUE,
+  .id = 2873,
+  .ra = 141.452,
+  .dec = 11.4541,
+},
+{ .is_ngc = TRUE,
+  .id = 2874,
+  .ra = 141.448,
+  .dec = 11.4249,
+},
+{ .is_ngc = TRUE,
+  .id = 2875,
+  .ra = 141.453,
+  .dec = 11.4314,
+},
+{ .is_ngc = TRUE,
+  .id = 2876,
+  .ra = 141.308,
+  .dec = -6.71694,
+},
+{ .is_ngc = TRUE,
+  .id = 2877,
+  .ra = 141.446,
+  .dec = 2.22869,
+},
+{ .is_ngc = TRUE,
+  .id = 2878,
+  .ra = 141.448,
+  .dec = 2.08947,
+},
+{ .is_ngc = TRUE,
+  .id = 2879,
+  .ra = 141.344,
+  .dec = -11.6521,
+},
+{ .is_ngc = TRUE,
+  .id = 2880,
+  .ra = 142.395,
+  .dec = 62.4907,
+},
+{ .is_ngc = TRUE,
+  .id = 2882,
+  .ra = 141.65,
+  .dec = 7.95375,
+},
+{ .is_ngc = TRUE,
+  .id = 2883,
+  .ra = 141.327,
+  .dec = -34.1028,
+},
+{ .is_ngc = TRUE,
+  .id = 2884,
+  .ra = 141.602,
+  .dec = -11.5553,
+},
+{ .is_ngc = TRUE,
+  .id = 2886,
+  .ra = 141.661,
+  .dec = -21.7381,
+},
+{ .is_ngc = TRUE,
+  .id = 2887,
+  .ra = 140.851,
+  .dec = -63.8122,
+},
+{ .is_ngc = TRUE,
+  .id = 2888,
+  .ra = 141.582,
+  .dec = -28.0358,
+},
+{ .is_ngc = TRUE,
+  .id = 2889,
+  .ra = 141.802,
+  .dec = -11.6428,
+},
+{ .is_ngc = TRUE,
+  .id = 2890,
+  .ra = 141.624,
+  .dec = -14.5292,
+},
+{ .is_ngc = TRUE,
+  .id = 2891,
+  .ra = 141.736,
+  .dec = -24.7828,
+},
+{ .is_ngc = TRUE,
+  .id = 2892,
+  .ra = 143.221,
+  .dec = 67.6171,
+},
+{ .is_ngc = TRUE,
+  .id = 2893,
+  .ra = 142.571,
+  .dec = 29.5399,
+},
+{ .is_ngc = TRUE,
+  .id = 2894,
+  .ra = 142.376,
+  .dec = 7.71803,
+},
+{ .is_ngc = TRUE,
+  .id = 2895,
+  .ra = 143.104,
+  .dec = 57.4826,
+},
+{ .is_ngc = TRUE,
+  .id = 2896,
+  .ra = 142.57,
+  .dec = 23.6628,
+},
+{ .is_ngc = TRUE,
+  .id = 2897,
+  .ra = 142.441,
+  .dec = 2.2067,
+},
+{ .is_ngc = TRUE,
+  .id = 2898,
+  .ra = 142.443,
+  .dec = 2.06396,
+},
+{ .is_ngc = TRUE,
+  .id = 2899,
+  .ra = 141.763,
+  .dec = -56.1059,
+},
+{ .is_ngc = TRUE,
+  .id = 2900,
+  .ra = 142.563,
+  .dec = 4.14364,
+},
+{ .is_ngc = TRUE,
+  .id = 2901,
+  .ra = 143.025,
+  .dec = 31.1,
+},
+{ .is_ngc = TRUE,
+  .id = 2901,
+  .ra = 143.08,
+  .dec = 31.1192,
+},
+{ .is_ngc = TRUE,
+  .id = 2902,
+  .ra = 142.72,
+  .dec = -14.7356,
+},
+{ .is_ngc = TRUE,
+  .id = 2903,
+  .ra = 143.042,
+  .dec = 21.5011,
+},
+{ .is_ngc = TRUE,
+  .id = 2904,
+  .ra = 142.57,
+  .dec = -30.3842,
+},
+{ .is_ngc = TRUE,
+  .id = 2905,
+  .ra = 143.05,
+  .dec = 21.5178,
+},
+{ .is_ngc = TRUE,
+  .id = 2906,
+  .ra = 143.026,
+  .dec = 8.44186,
+},
+{ .is_ngc = TRUE,
+  .id = 2907,
+  .ra = 142.903,
+  .dec = -16.7359,
+},
+{ .is_ngc = TRUE,
+  .id = 2908,
+  .ra = 145.883,
+  .dec = 79.7009,
+},
+{ .is_ngc = TRUE,
+  .id = 2909,
+  .ra = 144.25,
+  .dec = 65.9406,
+},
+{ .is_ngc = TRUE,
+  .id = 2910,
+  .ra = 142.625,
+  .dec = -52.9169,
+},
+{ .is_ngc = TRUE,
+  .id = 2911,
+  .ra = 143.443,
+  .dec = 10.1526,
+},
+{ .is_ngc = TRUE,
+  .id = 2912,
+  .ra = 143.487,
+  .dec = 10.1925,
+},
+{ .is_ngc = TRUE,
+  .id = 2913,
+  .ra = 143.512,
+  .dec = 9.47858,
+},
+{ .is_ngc = TRUE,
+  .id = 2914,
+  .ra = 143.512,
+  .dec = 10.1087,
+},
+{ .is_ngc = TRUE,
+  .id = 2915,
+  .ra = 141.547,
+  .dec = -76.6267,
+},
+{ .is_ngc = TRUE,
+  .id = 2916,
+  .ra = 143.74,
+  .dec = 21.7055,
+},
+{ .is_ngc = TRUE,
+  .id = 2917,
+  .ra = 143.612,
+  .dec = -2.50425,
+},
+{ .is_ngc = TRUE,
+  .id = 2918,
+  .ra = 143.934,
+  .dec = 31.7054,
+},
+{ .is_ngc = TRUE,
+  .id = 2919,
+  .ra = 143.698,
+  .dec = 10.2837,
+},
+{ .is_ngc = TRUE,
+  .id = 2920,
+  .ra = 143.55,
+  .dec = -20.8594,
+},
+{ .is_ngc = TRUE,
+  .id = 2921,
+  .ra = 143.631,
+  .dec = -20.9206,
+},
+{ .is_ngc = TRUE,
+  .id = 2922,
+  .ra = 144.219,
+  .dec = 37.6941,
+},
+{ .is_ngc = TRUE,
+  .id = 2923,
+  .ra = 144.016,
+  .dec = 16.7604,
+},
+{ .is_ngc = TRUE,
+  .id = 2924,
+  .ra = 143.795,
+  .dec = -16.3984,
+},
+{ .is_ngc = TRUE,
+  .id = 2925,
+  .ra = 143.296,
+  .dec = -53.3858,
+},
+{ .is_ngc = TRUE,
+  .id = 2926,
+  .ra = 144.38,
+  .dec = 32.8413,
+},
+{ .is_ngc = TRUE,
+  .id = 2927,
+  .ra = 144.313,
+  .dec = 23.5902,
+},
+{ .is_ngc = TRUE,
+  .id = 2928,
+  .ra = 144.292,
+  .dec = 16.9772,
+},
+{ .is_ngc = TRUE,
+  .id = 2929,
+  .ra = 144.374,
+  .dec = 23.1608,
+},
+{ .is_ngc = TRUE,
+  .id = 2930,
+  .ra = 144.386,
+  .dec = 23.2029,
+},
+{ .is_ngc = TRUE,
+  .id = 2931,
+  .ra = 144.407,
+  .dec = 23.2405,
+},
+{ .is_ngc = TRUE,
+  .id = 2932,
+  .ra = 143.787,
+  .dec = -46.9167,
+},
+{ .is_ngc = TRUE,
+  .id = 2933,
+  .ra = 144.479,
+  .dec = 17.0146,
+},
+{ .is_ngc = TRUE,
+  .id = 2934,
+  .ra = 144.48,
+  .dec = 17.0542,
+},
+{ .is_ngc = TRUE,
+  .id = 2935,
+  .ra = 144.187,
+  .dec = -21.1283,
+},
+{ .is_ngc = TRUE,
+  .id = 2936,
+  .ra = 144.435,
+  .dec = 2.76017,
+},
+{ .is_ngc = TRUE,
+  .id = 2937,
+  .ra = 144.437,
+  .dec = 2.74745,
+},
+{ .is_ngc = TRUE,
+  .id = 2938,
+  .ra = 144.603,
+  .dec = 76.3191,
+},
+{ .is_ngc = TRUE,
+  .id = 2939,
+  .ra = 144.533,
+  .dec = 9.52294,
+},
+{ .is_ngc = TRUE,
+  .id = 2940,
+  .ra = 144.522,
+  .dec = 9.61664,
+},
+{ .is_ngc = TRUE,
+  .id = 2941,
+  .ra = 144.601,
+  .dec = 17.0441,
+},
+{ .is_ngc = TRUE,
+  .id = 2942,
+  .ra = 144.783,
+  .dec = 34.0059,
+},
+{ .is_ngc = TRUE,
+  .id = 2943,
+  .ra = 144.637,
+  .dec = 17.0314,
+},
+{ .is_ngc = TRUE,
+  .id = 2945,
+  .ra = 144.421,
+  .dec = -22.0344,
+},
+{ .is_ngc = TRUE,
+  .id = 2946,
+  .ra = 144.757,
+  .dec = 17.025,
+},
+{ .is_ngc = TRUE,
+  .id = 2948,
+  .ra = 144.747,
+  .dec = 6.95567,
+},
+{ .is_ngc = TRUE,
+  .id = 2950,
+  .ra = 145.646,
+  .dec = 58.8511,
+},
+{ .is_ngc = TRUE,
+  .id = 2952,
+  .ra = 144.404,
+  .dec = -10.1836,
+},
+{ .is_ngc = TRUE,
+  .id = 2953,
+  .ra = 145.079,
+  .dec = 14.8333,
+},
+{ .is_ngc = TRUE,
+  .id = 2954,
+  .ra = 145.101,
+  .dec = 14.9223,
+},
+{ .is_ngc = TRUE,
+  .id = 2955,
+  .ra = 145.319,
+  .dec = 35.8829,
+},
+{ .is_ngc = TRUE,
+  .id = 2956,
+  .ra = 144.821,
+  .dec = -19.1014,
+},
+{ .is_ngc = TRUE,
+  .id = 2958,
+  .ra = 145.174,
+  .dec = 11.8881,
+},
+{ .is_ngc = TRUE,
+  .id = 2959,
+  .ra = 146.288,
+  .dec = 68.5951,
+},
+{ .is_ngc = TRUE,
+  .id = 2960,
+  .ra = 145.152,
+  .dec = 3.57664,
+},
+{ .is_ngc = TRUE,
+  .id = 2962,
+  .ra = 145.225,
+  .dec = 5.16597,
+},
+{ .is_ngc = TRUE,
+  .id = 2963,
+  .ra = 146.959,
+  .dec = 72.9647,
+},
+{ .is_ngc = TRUE,
+  .id = 2964,
+  .ra = 145.726,
+  .dec = 31.8472,
+},
+{ .is_ngc = TRUE,
+  .id = 2965,
+  .ra = 145.83,
+  .dec = 36.2479,
+},
+{ .is_ngc = TRUE,
+  .id = 2966,
+  .ra = 145.548,
+  .dec = 4.67335,
+},
+{ .is_ngc = TRUE,
+  .id = 2967,
+  .ra = 145.515,
+  .dec = 0.33575,
+},
+{ .is_ngc = TRUE,
+  .id = 2968,
+  .ra = 145.8,
+  .dec = 31.9284,
+},
+{ .is_ngc = TRUE,
+  .id = 2969,
+  .ra = 145.477,
+  .dec = -8.60333,
+},
+{ .is_ngc = TRUE,
+  .id = 2970,
+  .ra = 145.879,
+  .dec = 31.9769,
+},
+{ .is_ngc = TRUE,
+  .id = 2971,
+  .ra = 145.942,
+  .dec = 36.1792,
+},
+{ .is_ngc = TRUE,
+  .id = 2973,
+  .ra = 145.395,
+  .dec = -30.0484,
+},
+{ .is_ngc = TRUE,
+  .id = 2973,
+  .ra = 145.385,
+  .dec = -30.0904,
+},
+{ .is_ngc = TRUE,
+  .id = 2974,
+  .ra = 145.638,
+  .dec = -3.69889,
+},
+{ .is_ngc = TRUE,
+  .id = 2975,
+  .ra = 145.317,
+  .dec = -16.6743,
+},
+{ .is_ngc = TRUE,
+  .id = 2976,
+  .ra = 146.815,
+  .dec = 67.9163,
+},
+{ .is_ngc = TRUE,
+  .id = 2977,
+  .ra = 145.944,
+  .dec = 74.8602,
+},
+{ .is_ngc = TRUE,
+  .id = 2978,
+  .ra = 145.82,
+  .dec = -9.74583,
+},
+{ .is_ngc = TRUE,
+  .id = 2980,
+  .ra = 145.8,
+  .dec = -9.61278,
+},
+{ .is_ngc = TRUE,
+  .id = 2981,
+  .ra = 146.235,
+  .dec = 31.0981,
+},
+{ .is_ngc = TRUE,
+  .id = 2982,
+  .ra = 145.504,
+  .dec = -44.0172,
+},
+{ .is_ngc = TRUE,
+  .id = 2983,
+  .ra = 145.921,
+  .dec = -20.4775,
+},
+{ .is_ngc = TRUE,
+  .id = 2985,
+  .ra = 147.59,
+  .dec = 72.2788,
+},
+{ .is_ngc = TRUE,
+  .id = 2986,
+  .ra = 146.067,
+  .dec = -21.2786,
+},
+{ .is_ngc = TRUE,
+  .id = 2987,
+  .ra = 146.423,
+  .dec = 4.94169,
+},
+{ .is_ngc = TRUE,
+  .id = 2988,
+  .ra = 146.699,
+  .dec = 22.0118,
+},
+{ .is_ngc = TRUE,
+  .id = 2989,
+  .ra = 146.355,
+  .dec = -18.3739,
+},
+{ .is_ngc = TRUE,
+  .id = 2990,
+  .ra = 146.573,
+  .dec = 5.709,
+},
+{ .is_ngc = TRUE,
+  .id = 2991,
+  .ra = 146.708,
+  .dec = 22.0138,
+},
+{ .is_ngc = TRUE,
+  .id = 2992,
+  .ra = 146.425,
+  .dec = -14.3268,
+},
+{ .is_ngc = TRUE,
+  .id = 2993,
+  .ra = 146.452,
+  .dec = -14.3686,
+},
+{ .is_ngc = TRUE,
+  .id = 2994,
+  .ra = 146.818,
+  .dec = 22.0892,
+},
+{ .is_ngc = TRUE,
+  .id = 2995,
+  .ra = 146,
+  .dec = -54.5833,
+},
+{ .is_ngc = TRUE,
+  .id = 2996,
+  .ra = 146.626,
+  .dec = -21.5719,
+},
+{ .is_ngc = TRUE,
+  .id = 2997,
+  .ra = 146.411,
+  .dec = -31.1907,
+},
+{ .is_ngc = TRUE,
+  .id = 2998,
+  .ra = 147.182,
+  .dec = 44.0812,
+},
+{ .is_ngc = TRUE,
+  .id = 3000,
+  .ra = 147.214,
+  .dec = 44.1305,
+},
+{ .is_ngc = TRUE,
+  .id = 3001,
+  .ra = 146.578,
+  .dec = -30.4378,
+},
+{ .is_ngc = TRUE,
+  .id = 3002,
+  .ra = 147.238,
+  .dec = 44.0567,
+},
+{ .is_ngc = TRUE,
+  .id = 3003,
+  .ra = 147.149,
+  .dec = 33.4214,
+},
+{ .is_ngc = TRUE,
+  .id = 3004,
+  .ra = 147.259,
+  .dec = 44.1111,
+},
+{ .is_ngc = TRUE,
+  .id = 3005,
+  .ra = 147.312,
+  .dec = 44.1298,
+},
+{ .is_ngc = TRUE,
+  .id = 3006,
+  .ra = 147.322,
+  .dec = 44.0257,
+},
+{ .is_ngc = TRUE,
+  .id = 3007,
+  .ra = 146.94,
+  .dec = -6.43861,
+},
+{ .is_ngc = TRUE,
+  .id = 3008,
+  .ra = 147.392,
+  .dec = 44.1018,
+},
+{ .is_ngc = TRUE,
+  .id = 3009,
+  .ra = 147.546,
+  .dec = 44.2948,
+},
+{ .is_ngc = TRUE,
+  .id = 3011,
+  .ra = 147.422,
+  .dec = 32.2208,
+},
+{ .is_ngc = TRUE,
+  .id = 3012,
+  .ra = 147.467,
+  .dec = 34.714,
+},
+{ .is_ngc = TRUE,
+  .id = 3013,
+  .ra = 147.539,
+  .dec = 33.5692,
+},
+{ .is_ngc = TRUE,
+  .id = 3014,
+  .ra = 147.282,
+  .dec = -4.74306,
+},
+{ .is_ngc = TRUE,
+  .id = 3015,
+  .ra = 147.345,
+  .dec = 1.14486,
+},
+{ .is_ngc = TRUE,
+  .id = 3016,
+  .ra = 147.461,
+  .dec = 12.6949,
+},
+{ .is_ngc = TRUE,
+  .id = 3017,
+  .ra = 147.262,
+  .dec = -2.82229,
+},
+{ .is_ngc = TRUE,
+  .id = 3018,
+  .ra = 147.423,
+  .dec = 0.622111,
+},
+{ .is_ngc = TRUE,
+  .id = 3019,
+  .ra = 147.53,
+  .dec = 12.7453,
+},
+{ .is_ngc = TRUE,
+  .id = 3020,
+  .ra = 147.528,
+  .dec = 12.8135,
+},
+{ .is_ngc = TRUE,
+  .id = 3021,
+  .ra = 147.739,
+  .dec = 33.5538,
+},
+{ .is_ngc = TRUE,
+  .id = 3022,
+  .ra = 147.413,
+  .dec = -5.16667,
+},
+{ .is_ngc = TRUE,
+  .id = 3023,
+  .ra = 147.469,
+  .dec = 0.619,
+},
+{ .is_ngc = TRUE,
+  .id = 3024,
+  .ra = 147.614,
+  .dec = 12.7655,
+},
+{ .is_ngc = TRUE,
+  .id = 3025,
+  .ra = 147.37,
+  .dec = -21.7425,
+},
+{ .is_ngc = TRUE,
+  .id = 3026,
+  .ra = 147.73,
+  .dec = 28.5508,
+},
+{ .is_ngc = TRUE,
+  .id = 3027,
+  .ra = 148.919,
+  .dec = 72.2034,
+},
+{ .is_ngc = TRUE,
+  .id = 3028,
+  .ra = 147.476,
+  .dec = -19.185,
+},
+{ .is_ngc = TRUE,
+  .id = 3029,
+  .ra = 147.224,
+  .dec = -8.05128,
+},
+{ .is_ngc = TRUE,
+  .id = 3030,
+  .ra = 147.544,
+  .dec = -12.2268,
+},
+{ .is_ngc = TRUE,
+  .id = 3031,
+  .ra = 148.889,
+  .dec = 69.0656,
+},
+{ .is_ngc = TRUE,
+  .id = 3032,
+  .ra = 148.034,
+  .dec = 29.2362,
+},
+{ .is_ngc = TRUE,
+  .id = 3033,
+  .ra = 147.154,
+  .dec = -56.4175,
+},
+{ .is_ngc = TRUE,
+  .id = 3034,
+  .ra = 148.97,
+  .dec = 69.6806,
+},
+{ .is_ngc = TRUE,
+  .id = 3035,
+  .ra = 147.979,
+  .dec = -6.82333,
+},
+{ .is_ngc = TRUE,
+  .id = 3036,
+  .ra = 147.317,
+  .dec = -62.6675,
+},
+{ .is_ngc = TRUE,
+  .id = 3037,
+  .ra = 147.85,
+  .dec = -27.0103,
+},
+{ .is_ngc = TRUE,
+  .id = 3038,
+  .ra = 147.815,
+  .dec = -32.7539,
+},
+{ .is_ngc = TRUE,
+  .id = 3039,
+  .ra = 148.123,
+  .dec = 2.15394,
+},
+{ .is_ngc = TRUE,
+  .id = 3041,
+  .ra = 148.28,
+  .dec = 16.6778,
+},
+{ .is_ngc = TRUE,
+  .id = 3042,
+  .ra = 148.334,
+  .dec = 0.697694,
+},
+{ .is_ngc = TRUE,
+  .id = 3043,
+  .ra = 149.06,
+  .dec = 59.3067,
+},
+{ .is_ngc = TRUE,
+  .id = 3044,
+  .ra = 148.42,
+  .dec = 1.57908,
+},
+{ .is_ngc = TRUE,
+  .id = 3045,
+  .ra = 148.324,
+  .dec = -18.6456,
+},
+{ .is_ngc = TRUE,
+  .id = 3046,
+  .ra = 148.333,
+  .dec = -27.3192,
+},
+{ .is_ngc = TRUE,
+  .id = 3047,
+  .ra = 148.633,
+  .dec = -1.29164,
+},
+{ .is_ngc = TRUE,
+  .id = 3049,
+  .ra = 148.707,
+  .dec = 9.27167,
+},
+{ .is_ngc = TRUE,
+  .id = 3052,
+  .ra = 148.617,
+  .dec = -18.6392,
+},
+{ .is_ngc = TRUE,
+  .id = 3053,
+  .ra = 148.89,
+  .dec = 16.4326,
+},
+{ .is_ngc = TRUE,
+  .id = 3054,
+  .ra = 148.62,
+  .dec = -25.7028,
+},
+{ .is_ngc = TRUE,
+  .id = 3055,
+  .ra = 148.825,
+  .dec = 4.26953,
+},
+{ .is_ngc = TRUE,
+  .id = 3056,
+  .ra = 148.637,
+  .dec = -28.2981,
+},
+{ .is_ngc = TRUE,
+  .id = 3057,
+  .ra = 151.414,
+  .dec = 80.2853,
+},
+{ .is_ngc = TRUE,
+  .id = 3059,
+  .ra = 147.535,
+  .dec = -73.9214,
+},
+{ .is_ngc = TRUE,
+  .id = 3060,
+  .ra = 149.081,
+  .dec = 16.8312,
+},
+{ .is_ngc = TRUE,
+  .id = 3061,
+  .ra = 149.05,
+  .dec = 75.8658,
+},
+{ .is_ngc = TRUE,
+  .id = 3062,
+  .ra = 149.149,
+  .dec = 1.42841,
+},
+{ .is_ngc = TRUE,
+  .id = 3063,
+  .ra = 150.424,
+  .dec = 72.1172,
+},
+{ .is_ngc = TRUE,
+  .id = 3064,
+  .ra = 148.923,
+  .dec = -6.36417,
+},
+{ .is_ngc = TRUE,
+  .id = 3065,
+  .ra = 150.477,
+  .dec = 72.1699,
+},
+{ .is_ngc = TRUE,
+  .id = 3066,
+  .ra = 150.543,
+  .dec = 72.125,
+},
+{ .is_ngc = TRUE,
+  .id = 3067,
+  .ra = 149.589,
+  .dec = 32.3695,
+},
+{ .is_ngc = TRUE,
+  .id = 3070,
+  .ra = 149.529,
+  .dec = 10.36,
+},
+{ .is_ngc = TRUE,
+  .id = 3071,
+  .ra = 149.721,
+  .dec = 31.6202,
+},
+{ .is_ngc = TRUE,
+  .id = 3072,
+  .ra = 149.35,
+  .dec = -19.355,
+},
+{ .is_ngc = TRUE,
+  .id = 3073,
+  .ra = 150.218,
+  .dec = 55.6183,
+},
+{ .is_ngc = TRUE,
+  .id = 3074,
+  .ra = 149.922,
+  .dec = 35.3926,
+},
+{ .is_ngc = TRUE,
+  .id = 3075,
+  .ra = 149.735,
+  .dec = 14.4187,
+},
+{ .is_ngc = TRUE,
+  .id = 3076,
+  .ra = 149.407,
+  .dec = -18.1786,
+},
+{ .is_ngc = TRUE,
+  .id = 3077,
+  .ra = 150.835,
+  .dec = 68.7338,
+},
+{ .is_ngc = TRUE,
+  .id = 3078,
+  .ra = 149.602,
+  .dec = -26.9261,
+},
+{ .is_ngc = TRUE,
+  .id = 3079,
+  .ra = 150.491,
+  .dec = 55.6807,
+},
+{ .is_ngc = TRUE,
+  .id = 3080,
+  .ra = 149.983,
+  .dec = 13.0434,
+},
+{ .is_ngc = TRUE,
+  .id = 3082,
+  .ra = 149.72,
+  .dec = -30.3569,
+},
+{ .is_ngc = TRUE,
+  .id = 3083,
+  .ra = 149.957,
+  .dec = -2.87806,
+},
+{ .is_ngc = TRUE,
+  .id = 3085,
+  .ra = 149.871,
+  .dec = -19.4928,
+},
+{ .is_ngc = TRUE,
+  .id = 3086,
+  .ra = 150.046,
+  .dec = -2.97656,
+},
+{ .is_ngc = TRUE,
+  .id = 3087,
+  .ra = 149.786,
+  .dec = -34.2253,
+},
+{ .is_ngc = TRUE,
+  .id = 3089,
+  .ra = 149.903,
+  .dec = -28.3308,
+},
+{ .is_ngc = TRUE,
+  .id = 3090,
+  .ra = 150.126,
+  .dec = -2.96925,
+},
+{ .is_ngc = TRUE,
+  .id = 3091,
+  .ra = 150.059,
+  .dec = -19.6365,
+},
+{ .is_ngc = TRUE,
+  .id = 3092,
+  .ra = 150.197,
+  .dec = -3.013,
+},
+{ .is_ngc = TRUE,
+  .id = 3093,
+  .ra = 150.223,
+  .dec = -2.9722,
+},
+{ .is_ngc = TRUE,
+  .id = 3094,
+  .ra = 150.358,
+  .dec = 15.7702,
+},
+{ .is_ngc = TRUE,
+  .id = 3095,
+  .ra = 150.025,
+  .dec = -31.5528,
+},
+{ .is_ngc = TRUE,
+  .id = 3096,
+  .ra = 150.138,
+  .dec = -19.6622,
+},
+{ .is_ngc = TRUE,
+  .id = 3097,
+  .ra = 151.067,
+  .dec = 60.1181,
+},
+{ .is_ngc = TRUE,
+  .id = 3098,
+  .ra = 150.57,
+  .dec = 24.7109,
+},
+{ .is_ngc = TRUE,
+  .id = 3101,
+  .ra = 150.397,
+  .dec = -2.99531,
+},
+{ .is_ngc = TRUE,
+  .id = 3102,
+  .ra = 151.131,
+  .dec = 60.1076,
+},
+{ .is_ngc = TRUE,
+  .id = 3104,
+  .ra = 150.989,
+  .dec = 40.7569,
+},
+{ .is_ngc = TRUE,
+  .id = 3105,
+  .ra = 150.163,
+  .dec = -54.7842,
+},
+{ .is_ngc = TRUE,
+  .id = 3106,
+  .ra = 151.022,
+  .dec = 31.1855,
+},
+{ .is_ngc = TRUE,
+  .id = 3107,
+  .ra = 151.094,
+  .dec = 13.6213,
+},
+{ .is_ngc = TRUE,
+  .id = 3108,
+  .ra = 150.622,
+  .dec = -31.6764,
+},
+{ .is_ngc = TRUE,
+  .id = 3109,
+  .ra = 150.773,
+  .dec = -26.1575,
+},
+{ .is_ngc = TRUE,
+  .id = 3111,
+  .ra = 151.532,
+  .dec = 47.2626,
+},
+{ .is_ngc = TRUE,
+  .id = 3112,
+  .ra = 150.997,
+  .dec = -20.782,
+},
+{ .is_ngc = TRUE,
+  .id = 3113,
+  .ra = 151.109,
+  .dec = -28.4439,
+},
+{ .is_ngc = TRUE,
+  .id = 3114,
+  .ra = 150.65,
+  .dec = -60.1172,
+},
+{ .is_ngc = TRUE,
+  .id = 3115,
+  .ra = 151.308,
+  .dec = -7.71878,
+},
+{ .is_ngc = TRUE,
+  .id = 3116,
+  .ra = 151.688,
+  .dec = 31.0978,
+},
+{ .is_ngc = TRUE,
+  .id = 3117,
+  .ra = 151.544,
+  .dec = 2.91222,
+},
+{ .is_ngc = TRUE,
+  .id = 3118,
+  .ra = 151.798,
+  .dec = 33.0277,
+},
+{ .is_ngc = TRUE,
+  .id = 3119,
+  .ra = 151.699,
+  .dec = 14.314,
+},
+{ .is_ngc = TRUE,
+  .id = 3120,
+  .ra = 151.345,
+  .dec = -34.2206,
+},
+{ .is_ngc = TRUE,
+  .id = 3123,
+  .ra = 151.754,
+  .dec = 0.0666667,
+},
+{ .is_ngc = TRUE,
+  .id = 3124,
+  .ra = 151.666,
+  .dec = -19.2219,
+},
+{ .is_ngc = TRUE,
+  .id = 3125,
+  .ra = 151.639,
+  .dec = -29.9358,
+},
+{ .is_ngc = TRUE,
+  .id = 3126,
+  .ra = 152.087,
+  .dec = 31.8628,
+},
+{ .is_ngc = TRUE,
+  .id = 3127,
+  .ra = 151.603,
+  .dec = -16.1264,
+},
+{ .is_ngc = TRUE,
+  .id = 3128,
+  .ra = 151.506,
+  .dec = -16.1228,
+},
+{ .is_ngc = TRUE,
+  .id = 3129,
+  .ra = 152.08,
+  .dec = 18.4306,
+},
+{ .is_ngc = TRUE,
+  .id = 3130,
+  .ra = 152.052,
+  .dec = 9.97647,
+},
+{ .is_ngc = TRUE,
+  .id = 3131,
+  .ra = 152.151,
+  .dec = 18.2308,
+},
+{ .is_ngc = TRUE,
+  .id = 3132,
+  .ra = 151.757,
+  .dec = -40.4364,
+},
+{ .is_ngc = TRUE,
+  .id = 3133,
+  .ra = 151.803,
+  .dec = -11.9653,
+},
+{ .is_ngc = TRUE,
+  .id = 3134,
+  .ra = 153.122,
+  .dec = 12.3771,
+},
+{ .is_ngc = TRUE,
+  .id = 3135,
+  .ra = 152.727,
+  .dec = 45.95,
+},
+{ .is_ngc = TRUE,
+  .id = 3136,
+  .ra = 151.45,
+  .dec = -67.3775,
+},
+{ .is_ngc = TRUE,
+  .id = 3137,
+  .ra = 152.281,
+  .dec = -29.0642,
+},
+{ .is_ngc = TRUE,
+  .id = 3138,
+  .ra = 152.319,
+  .dec = -11.9569,
+},
+{ .is_ngc = TRUE,
+  .id = 3139,
+  .ra = 152.522,
+  .dec = -11.7787,
+},
+{ .is_ngc = TRUE,
+  .id = 3140,
+  .ra = 152.366,
+  .dec = -16.6283,
+},
+{ .is_ngc = TRUE,
+  .id = 3141,
+  .ra = 152.333,
+  .dec = -16.6536,
+},
+{ .is_ngc = TRUE,
+  .id = 3142,
+  .ra = 152.527,
+  .dec = -8.48,
+},
+{ .is_ngc = TRUE,
+  .id = 3143,
+  .ra = 152.516,
+  .dec = -12.5817,
+},
+{ .is_ngc = TRUE,
+  .id = 3145,
+  .ra = 152.542,
+  .dec = -12.4344,
+},
+{ .is_ngc = TRUE,
+  .id = 3146,
+  .ra = 152.791,
+  .dec = -20.8708,
+},
+{ .is_ngc = TRUE,
+  .id = 3147,
+  .ra = 154.222,
+  .dec = 73.4006,
+},
+{ .is_ngc = TRUE,
+  .id = 3148,
+  .ra = 153.433,
+  .dec = 50.4963,
+},
+{ .is_ngc = TRUE,
+  .id = 3149,
+  .ra = 150.935,
+  .dec = -80.4222,
+},
+{ .is_ngc = TRUE,
+  .id = 3150,
+  .ra = 153.359,
+  .dec = 38.6574,
+},
+{ .is_ngc = TRUE,
+  .id = 3151,
+  .ra = 153.371,
+  .dec = 38.6196,
+},
+{ .is_ngc = TRUE,
+  .id = 3152,
+  .ra = 153.392,
+  .dec = 38.8429,
+},
+{ .is_ngc = TRUE,
+  .id = 3153,
+  .ra = 153.21,
+  .dec = 12.6662,
+},
+{ .is_ngc = TRUE,
+  .id = 3154,
+  .ra = 153.255,
+  .dec = 17.0343,
+},
+{ .is_ngc = TRUE,
+  .id = 3156,
+  .ra = 153.172,
+  .dec = 3.1295,
+},
+{ .is_ngc = TRUE,
+  .id = 3158,
+  .ra = 153.461,
+  .dec = 38.7646,
+},
+{ .is_ngc = TRUE,
+  .id = 3159,
+  .ra = 153.47,
+  .dec = 38.6541,
+},
+{ .is_ngc = TRUE,
+  .id = 3160,
+  .ra = 153.48,
+  .dec = 38.8424,
+},
+{ .is_ngc = TRUE,
+  .id = 3161,
+  .ra = 153.497,
+  .dec = 38.6569,
+},
+{ .is_ngc = TRUE,
+  .id = 3163,
+  .ra = 153.53,
+  .dec = 38.6523,
+},
+{ .is_ngc = TRUE,
+  .id = 3164,
+  .ra = 153.798,
+  .dec = 56.6722,
+},
+{ .is_ngc = TRUE,
+  .id = 3165,
+  .ra = 153.381,
+  .dec = 3.37522,
+},
+{ .is_ngc = TRUE,
+  .id = 3166,
+  .ra = 153.44,
+  .dec = 3.425,
+},
+{ .is_ngc = TRUE,
+  .id = 3167,
+  .ra = 153.646,
+  .dec = 29.5856,
+},
+{ .is_ngc = TRUE,
+  .id = 3168,
+  .ra = 154.096,
+  .dec = 60.2348,
+},
+{ .is_ngc = TRUE,
+  .id = 3169,
+  .ra = 153.561,
+  .dec = 3.46725,
+},
+{ .is_ngc = TRUE,
+  .id = 3170,
+  .ra = 154.06,
+  .dec = 46.6121,
+},
+{ .is_ngc = TRUE,
+  .id = 3171,
+  .ra = 153.903,
+  .dec = -20.6473,
+},
+{ .is_ngc = TRUE,
+  .id = 3172,
+  .ra = 176.814,
+  .dec = 89.093,
+},
+{ .is_ngc = TRUE,
+  .id = 3173,
+  .ra = 153.646,
+  .dec = -27.6928,
+},
+{ .is_ngc = TRUE,
+  .id = 3175,
+  .ra = 153.676,
+  .dec = -28.8717,
+},
+{ .is_ngc = TRUE,
+  .id = 3176,
+  .ra = 153.762,
+  .dec = -19.0167,
+},
+{ .is_ngc = TRUE,
+  .id = 3177,
+  .ra = 154.142,
+  .dec = 21.1234,
+},
+{ .is_ngc = TRUE,
+  .id = 3178,
+  .ra = 154.039,
+  .dec = -15.7914,
+},
+{ .is_ngc = TRUE,
+  .id = 3179,
+  .ra = 154.488,
+  .dec = 41.1142,
+},
+{ .is_ngc = TRUE,
+  .id = 3181,
+  .ra = 154.548,
+  .dec = 41.4125,
+},
+{ .is_ngc = TRUE,
+  .id = 3182,
+  .ra = 154.888,
+  .dec = 58.2057,
+},
+{ .is_ngc = TRUE,
+  .id = 3184,
+  .ra = 154.57,
+  .dec = 41.4242,
+},
+{ .is_ngc = TRUE,
+  .id = 3185,
+  .ra = 154.411,
+  .dec = 21.6881,
+},
+{ .is_ngc = TRUE,
+  .id = 3186,
+  .ra = 153.972,
+  .dec = 6.96358,
+},
+{ .is_ngc = TRUE,
+  .id = 3186,
+  .ra = 154.408,
+  .dec = 6.97109,
+},
+{ .is_ngc = TRUE,
+  .id = 3187,
+  .ra = 154.449,
+  .dec = 21.8734,
+},
+{ .is_ngc = TRUE,
+  .id = 3188,
+  .ra = 154.929,
+  .dec = 57.4229,
+},
+{ .is_ngc = TRUE,
+  .id = 3189,
+  .ra = 154.518,
+  .dec = 21.8316,
+},
+{ .is_ngc = TRUE,
+  .id = 3190,
+  .ra = 154.524,
+  .dec = 21.8324,
+},
+{ .is_ngc = TRUE,
+  .id = 3193,
+  .ra = 154.604,
+  .dec = 21.8939,
+},
+{ .is_ngc = TRUE,
+  .id = 3195,
+  .ra = 152.339,
+  .dec = -80.8586,
+},
+{ .is_ngc = TRUE,
+  .id = 3196,
+  .ra = 154.704,
+  .dec = 27.6684,
+},
+{ .is_ngc = TRUE,
+  .id = 3197,
+  .ra = 153.616,
+  .dec = 77.8201,
+},
+{ .is_ngc = TRUE,
+  .id = 3198,
+  .ra = 154.979,
+  .dec = 45.5501,
+},
+{ .is_ngc = TRUE,
+  .id = 3199,
+  .ra = 154.35,
+  .dec = -57.9175,
+},
+{ .is_ngc = TRUE,
+  .id = 3200,
+  .ra = 154.652,
+  .dec = -17.9825,
+},
+{ .is_ngc = TRUE,
+  .id = 3201,
+  .ra = 154.404,
+  .dec = -46.4126,
+},
+{ .is_ngc = TRUE,
+  .id = 3202,
+  .ra = 155.132,
+  .dec = 43.0211,
+},
+{ .is_ngc = TRUE,
+  .id = 3203,
+  .ra = 154.89,
+  .dec = -26.6986,
+},
+{ .is_ngc = TRUE,
+  .id = 3204,
+  .ra = 155.047,
+  .dec = 27.8168,
+},
+{ .is_ngc = TRUE,
+  .id = 3205,
+  .ra = 155.208,
+  .dec = 42.9714,
+},
+{ .is_ngc = TRUE,
+  .id = 3206,
+  .ra = 155.449,
+  .dec = 56.9301,
+},
+{ .is_ngc = TRUE,
+  .id = 3207,
+  .ra = 155.252,
+  .dec = 42.9852,
+},
+{ .is_ngc = TRUE,
+  .id = 3208,
+  .ra = 154.922,
+  .dec = -25.8139,
+},
+{ .is_ngc = TRUE,
+  .id = 3209,
+  .ra = 155.16,
+  .dec = 25.5044,
+},
+{ .is_ngc = TRUE,
+  .id = 3210,
+  .ra = 156.997,
+  .dec = 79.8326,
+},
+{ .is_ngc = TRUE,
+  .id = 3211,
+  .ra = 154.46,
+  .dec = -62.6703,
+},
+{ .is_ngc = TRUE,
+  .id = 3212,
+  .ra = 157.07,
+  .dec = 79.8233,
+},
+{ .is_ngc = TRUE,
+  .id = 3213,
+  .ra = 155.323,
+  .dec = 19.6516,
+},
+{ .is_ngc = TRUE,
+  .id = 3214,
+  .ra = 155.786,
+  .dec = 57.0385,
+},
+{ .is_ngc = TRUE,
+  .id = 3215,
+  .ra = 157.17,
+  .dec = 79.8128,
+},
+{ .is_ngc = TRUE,
+  .id = 3216,
+  .ra = 155.422,
+  .dec = 23.9228,
+},
+{ .is_ngc = TRUE,
+  .id = 3221,
+  .ra = 155.584,
+  .dec = 21.5684,
+},
+{ .is_ngc = TRUE,
+  .id = 3222,
+  .ra = 155.644,
+  .dec = 19.8869,
+},
+{ .is_ngc = TRUE,
+  .id = 3224,
+  .ra = 155.422,
+  .dec = -34.6961,
+},
+{ .is_ngc = TRUE,
+  .id = 3225,
+  .ra = 156.292,
+  .dec = 58.1498,
+},
+{ .is_ngc = TRUE,
+  .id = 3226,
+  .ra = 155.863,
+  .dec = 19.8984,
+},
+{ .is_ngc = TRUE,
+  .id = 3227,
+  .ra = 155.878,
+  .dec = 19.865,
+},
+{ .is_ngc = TRUE,
+  .id = 3228,
+  .ra = 155.342,
+  .dec = -51.7186,
+},
+{ .is_ngc = TRUE,
+  .id = 3229,
+  .ra = 155.852,
+  .dec = 0.0651667,
+},
+{ .is_ngc = TRUE,
+  .id = 3230,
+  .ra = 155.933,
+  .dec = 12.5674,
+},
+{ .is_ngc = TRUE,
+  .id = 3231,
+  .ra = 156.745,
+  .dec = 66.8117,
+},
+{ .is_ngc = TRUE,
+  .id = 3232,
+  .ra = 156.101,
+  .dec = 28.0276,
+},
+{ .is_ngc = TRUE,
+  .id = 3233,
+  .ra = 155.489,
+  .dec = -22.2678,
+},
+{ .is_ngc = TRUE,
+  .id = 3236,
+  .ra = 156.702,
+  .dec = 61.2729,
+},
+{ .is_ngc = TRUE,
+  .id = 3237,
+  .ra = 156.431,
+  .dec = 39.6464,
+},
+{ .is_ngc = TRUE,
+  .id = 3238,
+  .ra = 156.679,
+  .dec = 57.2262,
+},
+{ .is_ngc = TRUE,
+  .id = 3239,
+  .ra = 156.274,
+  .dec = 17.16,
+},
+{ .is_ngc = TRUE,
+  .id = 3240,
+  .ra = 156.128,
+  .dec = -21.7914,
+},
+{ .is_ngc = TRUE,
+  .id = 3241,
+  .ra = 156.071,
+  .dec = -32.4828,
+},
+{ .is_ngc = TRUE,
+  .id = 3242,
+  .ra = 156.192,
+  .dec = -18.6427,
+},
+{ .is_ngc = TRUE,
+  .id = 3243,
+  .ra = 156.59,
+  .dec = -2.62261,
+},
+{ .is_ngc = TRUE,
+  .id = 3244,
+  .ra = 156.371,
+  .dec = -39.8281,
+},
+{ .is_ngc = TRUE,
+  .id = 3245,
+  .ra = 156.826,
+  .dec = 28.5076,
+},
+{ .is_ngc = TRUE,
+  .id = 3246,
+  .ra = 156.674,
+  .dec = 3.86153,
+},
+{ .is_ngc = TRUE,
+  .id = 3247,
+  .ra = 156.054,
+  .dec = -57.7522,
+},
+{ .is_ngc = TRUE,
+  .id = 3248,
+  .ra = 156.939,
+  .dec = 22.8473,
+},
+{ .is_ngc = TRUE,
+  .id = 3249,
+  .ra = 156.592,
+  .dec = -34.9636,
+},
+{ .is_ngc = TRUE,
+  .id = 3250,
+  .ra = 156.635,
+  .dec = -39.9439,
+},
+{ .is_ngc = TRUE,
+  .id = 3252,
+  .ra = 158.594,
+  .dec = 73.7636,
+},
+{ .is_ngc = TRUE,
+  .id = 3253,
+  .ra = 157.114,
+  .dec = 12.7037,
+},
+{ .is_ngc = TRUE,
+  .id = 3254,
+  .ra = 157.333,
+  .dec = 29.4916,
+},
+{ .is_ngc = TRUE,
+  .id = 3255,
+  .ra = 156.629,
+  .dec = -60.6683,
+},
+{ .is_ngc = TRUE,
+  .id = 3256,
+  .ra = 156.964,
+  .dec = -43.9056,
+},
+{ .is_ngc = TRUE,
+  .id = 3257,
+  .ra = 157.196,
+  .dec = -35.6581,
+},
+{ .is_ngc = TRUE,
+  .id = 3258,
+  .ra = 157.223,
+  .dec = -35.6058,
+},
+{ .is_ngc = TRUE,
+  .id = 3259,
+  .ra = 158.145,
+  .dec = 65.0409,
+},
+{ .is_ngc = TRUE,
+  .id = 3260,
+  .ra = 157.275,
+  .dec = -35.5956,
+},
+{ .is_ngc = TRUE,
+  .id = 3261,
+  .ra = 157.256,
+  .dec = -44.6572,
+},
+{ .is_ngc = TRUE,
+  .id = 3262,
+  .ra = 157.276,
+  .dec = -44.1604,
+},
+{ .is_ngc = TRUE,
+  .id = 3263,
+  .ra = 157.306,
+  .dec = -44.1229,
+},
+{ .is_ngc = TRUE,
+  .id = 3264,
+  .ra = 158.083,
+  .dec = 56.0837,
+},
+{ .is_ngc = TRUE,
+  .id = 3265,
+  .ra = 157.778,
+  .dec = 28.7966,
+},
+{ .is_ngc = TRUE,
+  .id = 3266,
+  .ra = 158.322,
+  .dec = 64.7494,
+},
+{ .is_ngc = TRUE,
+  .id = 3267,
+  .ra = 157.452,
+  .dec = -35.3225,
+},
+{ .is_ngc = TRUE,
+  .id = 3268,
+  .ra = 157.502,
+  .dec = -35.3255,
+},
+{ .is_ngc = TRUE,
+  .id = 3269,
+  .ra = 157.489,
+  .dec = -35.2243,
+},
+{ .is_ngc = TRUE,
+  .id = 3270,
+  .ra = 157.875,
+  .dec = 24.8691,
+},
+{ .is_ngc = TRUE,
+  .id = 3272,
+  .ra = 157.951,
+  .dec = 28.4688,
+},
+{ .is_ngc = TRUE,
+  .id = 3273,
+  .ra = 157.622,
+  .dec = -35.6106,
+},
+{ .is_ngc = TRUE,
+  .id = 3274,
+  .ra = 158.071,
+  .dec = 27.6688,
+},
+{ .is_ngc = TRUE,
+  .id = 3275,
+  .ra = 157.715,
+  .dec = -36.7372,
+},
+{ .is_ngc = TRUE,
+  .id = 3276,
+  .ra = 157.789,
+  .dec = -39.9453,
+},
+{ .is_ngc = TRUE,
+  .id = 3277,
+  .ra = 158.231,
+  .dec = 28.5115,
+},
+{ .is_ngc = TRUE,
+  .id = 3278,
+  .ra = 157.898,
+  .dec = -39.9558,
+},
+{ .is_ngc = TRUE,
+  .id = 3281,
+  .ra = 157.967,
+  .dec = -34.8543,
+},
+{ .is_ngc = TRUE,
+  .id = 3282,
+  .ra = 158.092,
+  .dec = -22.3017,
+},
+{ .is_ngc = TRUE,
+  .id = 3283,
+  .ra = 157.797,
+  .dec = -46.251,
+},
+{ .is_ngc = TRUE,
+  .id = 3285,
+  .ra = 158.399,
+  .dec = -27.4544,
+},
+{ .is_ngc = TRUE,
+  .id = 3287,
+  .ra = 158.697,
+  .dec = 21.6487,
+},
+{ .is_ngc = TRUE,
+  .id = 3288,
+  .ra = 159.108,
+  .dec = 58.5564,
+},
+{ .is_ngc = TRUE,
+  .id = 3289,
+  .ra = 158.53,
+  .dec = -35.3233,
+},
+{ .is_ngc = TRUE,
+  .id = 3290,
+  .ra = 158.823,
+  .dec = -17.2764,
+},
+{ .is_ngc = TRUE,
+  .id = 3291,
+  .ra = 159.026,
+  .dec = 37.2746,
+},
+{ .is_ngc = TRUE,
+  .id = 3292,
+  .ra = 158.894,
+  .dec = -6.17914,
+},
+{ .is_ngc = TRUE,
+  .id = 3293,
+  .ra = 158.964,
+  .dec = -58.2297,
+},
+{ .is_ngc = TRUE,
+  .id = 3294,
+  .ra = 159.068,
+  .dec = 37.3246,
+},
+{ .is_ngc = TRUE,
+  .id = 3297,
+  .ra = 158.3,
+  .dec = -12.6721,
+},
+{ .is_ngc = TRUE,
+  .id = 3298,
+  .ra = 159.301,
+  .dec = 50.12,
+},
+{ .is_ngc = TRUE,
+  .id = 3299,
+  .ra = 159.1,
+  .dec = 12.7069,
+},
+{ .is_ngc = TRUE,
+  .id = 3300,
+  .ra = 159.16,
+  .dec = 14.1709,
+},
+{ .is_ngc = TRUE,
+  .id = 3302,
+  .ra = 158.948,
+  .dec = -32.3586,
+},
+{ .is_ngc = TRUE,
+  .id = 3303,
+  .ra = 159.248,
+  .dec = 18.1367,
+},
+{ .is_ngc = TRUE,
+  .id = 3304,
+  .ra = 159.408,
+  .dec = 37.4558,
+},
+{ .is_ngc = TRUE,
+  .id = 3305,
+  .ra = 159.049,
+  .dec = -27.1619,
+},
+{ .is_ngc = TRUE,
+  .id = 3306,
+  .ra = 159.293,
+  .dec = 12.6524,
+},
+{ .is_ngc = TRUE,
+  .id = 3307,
+  .ra = 159.072,
+  .dec = -27.5294,
+},
+{ .is_ngc = TRUE,
+  .id = 3308,
+  .ra = 159.093,
+  .dec = -27.4378,
+},
+{ .is_ngc = TRUE,
+  .id = 3309,
+  .ra = 159.149,
+  .dec = -27.5181,
+},
+{ .is_ngc = TRUE,
+  .id = 3310,
+  .ra = 159.691,
+  .dec = 53.5028,
+},
+{ .is_ngc = TRUE,
+  .id = 3311,
+  .ra = 159.179,
+  .dec = -27.5281,
+},
+{ .is_ngc = TRUE,
+  .id = 3313,
+  .ra = 159.356,
+  .dec = -25.3186,
+},
+{ .is_ngc = TRUE,
+  .id = 3314,
+  .ra = 159.304,
+  .dec = -27.6842,
+},
+{ .is_ngc = TRUE,
+  .id = 3315,
+  .ra = 159.33,
+  .dec = -27.1917,
+},
+{ .is_ngc = TRUE,
+  .id = 3316,
+  .ra = 159.405,
+  .dec = -27.5939,
+},
+{ .is_ngc = TRUE,
+  .id = 3317,
+  .ra = 159.43,
+  .dec = -27.5197,
+},
+{ .is_ngc = TRUE,
+  .id = 3318,
+  .ra = 159.314,
+  .dec = -41.6278,
+},
+{ .is_ngc = TRUE,
+  .id = 3319,
+  .ra = 159.79,
+  .dec = 41.6872,
+},
+{ .is_ngc = TRUE,
+  .id = 3320,
+  .ra = 159.902,
+  .dec = 47.3971,
+},
+{ .is_ngc = TRUE,
+  .id = 3323,
+  .ra = 159.913,
+  .dec = 25.3222,
+},
+{ .is_ngc = TRUE,
+  .id = 3324,
+  .ra = 159.33,
+  .dec = -58.6342,
+},
+{ .is_ngc = TRUE,
+  .id = 3325,
+  .ra = 159.835,
+  .dec = -0.200522,
+},
+{ .is_ngc = TRUE,
+  .id = 3326,
+  .ra = 159.882,
+  .dec = 5.10775,
+},
+{ .is_ngc = TRUE,
+  .id = 3327,
+  .ra = 159.991,
+  .dec = 24.0913,
+},
+{ .is_ngc = TRUE,
+  .id = 3328,
+  .ra = 159.976,
+  .dec = 9.30019,
+},
+{ .is_ngc = TRUE,
+  .id = 3328,
+  .ra = 159.917,
+  .dec = 9.21472,
+},
+{ .is_ngc = TRUE,
+  .id = 3330,
+  .ra = 159.692,
+  .dec = -54.1178,
+},
+{ .is_ngc = TRUE,
+  .id = 3331,
+  .ra = 160.037,
+  .dec = -23.8208,
+},
+{ .is_ngc = TRUE,
+  .id = 3333,
+  .ra = 159.957,
+  .dec = -36.0361,
+},
+{ .is_ngc = TRUE,
+  .id = 3334,
+  .ra = 160.38,
+  .dec = 37.3124,
+},
+{ .is_ngc = TRUE,
+  .id = 3335,
+  .ra = 159.892,
+  .dec = -23.9226,
+},
+{ .is_ngc = TRUE,
+  .id = 3336,
+  .ra = 160.07,
+  .dec = -27.7769,
+},
+{ .is_ngc = TRUE,
+  .id = 3337,
+  .ra = 160.448,
+  .dec = 4.98844,
+},
+{ .is_ngc = TRUE,
+  .id = 3338,
+  .ra = 160.532,
+  .dec = 13.747,
+},
+{ .is_ngc = TRUE,
+  .id = 3339,
+  .ra = 160.542,
+  .dec = -0.369,
+},
+{ .is_ngc = TRUE,
+  .id = 3340,
+  .ra = 160.575,
+  .dec = -0.376972,
+},
+{ .is_ngc = TRUE,
+  .id = 3341,
+  .ra = 160.631,
+  .dec = 5.04358,
+},
+{ .is_ngc = TRUE,
+  .id = 3343,
+  .ra = 161.543,
+  .dec = 73.3529,
+},
+{ .is_ngc = TRUE,
+  .id = 3344,
+  .ra = 160.879,
+  .dec = 24.9223,
+},
+{ .is_ngc = TRUE,
+  .id = 3345,
+  .ra = 160.883,
+  .dec = 11.985,
+},
+{ .is_ngc = TRUE,
+  .id = 3346,
+  .ra = 160.912,
+  .dec = 14.8719,
+},
+{ .is_ngc = TRUE,
+  .id = 3347,
+  .ra = 160.694,
+  .dec = -36.3537,
+},
+{ .is_ngc = TRUE,
+  .id = 3348,
+  .ra = 161.792,
+  .dec = 72.8397,
+},
+{ .is_ngc = TRUE,
+  .id = 3349,
+  .ra = 160.961,
+  .dec = 6.76289,
+},
+{ .is_ngc = TRUE,
+  .id = 3350,
+  .ra = 161.096,
+  .dec = 30.7249,
+},
+{ .is_ngc = TRUE,
+  .id = 3351,
+  .ra = 160.991,
+  .dec = 11.7036,
+},
+{ .is_ngc = TRUE,
+  .id = 3352,
+  .ra = 161.062,
+  .dec = 22.3708,
+},
+{ .is_ngc = TRUE,
+  .id = 3353,
+  .ra = 161.343,
+  .dec = 55.96,
+},
+{ .is_ngc = TRUE,
+  .id = 3354,
+  .ra = 160.761,
+  .dec = -36.3634,
+},
+{ .is_ngc = TRUE,
+  .id = 3355,
+  .ra = 160.888,
+  .dec = -23.2,
+},
+{ .is_ngc = TRUE,
+  .id = 3355,
+  .ra = 160.658,
+  .dec = -23.9356,
+},
+{ .is_ngc = TRUE,
+  .id = 3356,
+  .ra = 161.051,
+  .dec = 6.75867,
+},
+{ .is_ngc = TRUE,
+  .id = 3357,
+  .ra = 161.087,
+  .dec = 14.0841,
+},
+{ .is_ngc = TRUE,
+  .id = 3358,
+  .ra = 160.888,
+  .dec = -36.4109,
+},
+{ .is_ngc = TRUE,
+  .id = 3359,
+  .ra = 161.653,
+  .dec = 63.2236,
+},
+{ .is_ngc = TRUE,
+  .id = 3360,
+  .ra = 161.067,
+  .dec = -11.2428,
+},
+{ .is_ngc = TRUE,
+  .id = 3361,
+  .ra = 161.121,
+  .dec = -11.2079,
+},
+{ .is_ngc = TRUE,
+  .id = 3362,
+  .ra = 161.216,
+  .dec = 6.59618,
+},
+{ .is_ngc = TRUE,
+  .id = 3363,
+  .ra = 161.29,
+  .dec = 22.0784,
+},
+{ .is_ngc = TRUE,
+  .id = 3364,
+  .ra = 162.125,
+  .dec = 72.4246,
+},
+{ .is_ngc = TRUE,
+  .id = 3365,
+  .ra = 161.553,
+  .dec = 1.81292,
+},
+{ .is_ngc = TRUE,
+  .id = 3367,
+  .ra = 161.645,
+  .dec = 13.7501,
+},
+{ .is_ngc = TRUE,
+  .id = 3368,
+  .ra = 161.69,
+  .dec = 11.82,
+},
+{ .is_ngc = TRUE,
+  .id = 3369,
+  .ra = 161.686,
+  .dec = -25.2442,
+},
+{ .is_ngc = TRUE,
+  .id = 3370,
+  .ra = 161.767,
+  .dec = 17.2734,
+},
+{ .is_ngc = TRUE,
+  .id = 3372,
+  .ra = 161.283,
+  .dec = -59.8667,
+},
+{ .is_ngc = TRUE,
+  .id = 3374,
+  .ra = 162.005,
+  .dec = 43.1861,
+},
+{ .is_ngc = TRUE,
+  .id = 3375,
+  .ra = 161.753,
+  .dec = -9.94194,
+},
+{ .is_ngc = TRUE,
+  .id = 3376,
+  .ra = 161.861,
+  .dec = 6.04757,
+},
+{ .is_ngc = TRUE,
+  .id = 3377,
+  .ra = 161.926,
+  .dec = 13.9853,
+},
+{ .is_ngc = TRUE,
+  .id = 3378,
+  .ra = 161.68,
+  .dec = -40.0156,
+},
+{ .is_ngc = TRUE,
+  .id = 3379,
+  .ra = 161.957,
+  .dec = 12.5819,
+},
+{ .is_ngc = TRUE,
+  .id = 3380,
+  .ra = 162.051,
+  .dec = 28.6018,
+},
+{ .is_ngc = TRUE,
+  .id = 3381,
+  .ra = 162.103,
+  .dec = 34.7115,
+},
+{ .is_ngc = TRUE,
+  .id = 3382,
+  .ra = 162.107,
+  .dec = 36.7244,
+},
+{ .is_ngc = TRUE,
+  .id = 3383,
+  .ra = 161.83,
+  .dec = -24.4386,
+},
+{ .is_ngc = TRUE,
+  .id = 3385,
+  .ra = 162.049,
+  .dec = 4.92793,
+},
+{ .is_ngc = TRUE,
+  .id = 3386,
+  .ra = 162.05,
+  .dec = 4.99833,
+},
+{ .is_ngc = TRUE,
+  .id = 3387,
+  .ra = 162.07,
+  .dec = 4.96661,
+},
+{ .is_ngc = TRUE,
+  .id = 3390,
+  .ra = 162.018,
+  .dec = -31.5333,
+},
+{ .is_ngc = TRUE,
+  .id = 3391,
+  .ra = 162.235,
+  .dec = 14.2193,
+},
+{ .is_ngc = TRUE,
+  .id = 3392,
+  .ra = 162.762,
+  .dec = 65.7812,
+},
+{ .is_ngc = TRUE,
+  .id = 3393,
+  .ra = 162.098,
+  .dec = -25.1621,
+},
+{ .is_ngc = TRUE,
+  .id = 3394,
+  .ra = 162.665,
+  .dec = 65.7272,
+},
+{ .is_ngc = TRUE,
+  .id = 3396,
+  .ra = 162.482,
+  .dec = 32.9903,
+},
+{ .is_ngc = TRUE,
+  .id = 3399,
+  .ra = 162.365,
+  .dec = 16.2183,
+},
+{ .is_ngc = TRUE,
+  .id = 3400,
+  .ra = 162.69,
+  .dec = 28.4687,
+},
+{ .is_ngc = TRUE,
+  .id = 3401,
+  .ra = 162.579,
+  .dec = 5.80194,
+},
+{ .is_ngc = TRUE,
+  .id = 3403,
+  .ra = 163.478,
+  .dec = 73.6896,
+},
+{ .is_ngc = TRUE,
+  .id = 3407,
+  .ra = 163.074,
+  .dec = 61.3792,
+},
+{ .is_ngc = TRUE,
+  .id = 3408,
+  .ra = 163.049,
+  .dec = 58.4381,
+},
+{ .is_ngc = TRUE,
+  .id = 3409,
+  .ra = 162.585,
+  .dec = -17.0442,
+},
+{ .is_ngc = TRUE,
+  .id = 3410,
+  .ra = 162.974,
+  .dec = 51.0064,
+},
+{ .is_ngc = TRUE,
+  .id = 3412,
+  .ra = 162.722,
+  .dec = 13.4122,
+},
+{ .is_ngc = TRUE,
+  .id = 3413,
+  .ra = 162.837,
+  .dec = 32.7665,
+},
+{ .is_ngc = TRUE,
+  .id = 3414,
+  .ra = 162.818,
+  .dec = 27.9751,
+},
+{ .is_ngc = TRUE,
+  .id = 3415,
+  .ra = 162.928,
+  .dec = 43.7124,
+},
+{ .is_ngc = TRUE,
+  .id = 3416,
+  .ra = 162.951,
+  .dec = 43.764,
+},
+{ .is_ngc = TRUE,
+  .id = 3417,
+  .ra = 162.757,
+  .dec = 8.47278,
+},
+{ .is_ngc = TRUE,
+  .id = 3418,
+  .ra = 162.85,
+  .dec = 28.1119,
+},
+{ .is_ngc = TRUE,
+  .id = 3419,
+  .ra = 162.824,
+  .dec = 13.9458,
+},
+{ .is_ngc = TRUE,
+  .id = 3420,
+  .ra = 162.54,
+  .dec = -17.2427,
+},
+{ .is_ngc = TRUE,
+  .id = 3422,
+  .ra = 162.822,
+  .dec = -12.4025,
+},
+{ .is_ngc = TRUE,
+  .id = 3423,
+  .ra = 162.81,
+  .dec = 5.83989,
+},
+{ .is_ngc = TRUE,
+  .id = 3424,
+  .ra = 162.944,
+  .dec = 32.8999,
+},
+{ .is_ngc = TRUE,
+  .id = 3426,
+  .ra = 162.924,
+  .dec = 18.4809,
+},
+{ .is_ngc = TRUE,
+  .id = 3427,
+  .ra = 162.86,
+  .dec = 8.29803,
+},
+{ .is_ngc = TRUE,
+  .id = 3430,
+  .ra = 163.048,
+  .dec = 32.9507,
+},
+{ .is_ngc = TRUE,
+  .id = 3431,
+  .ra = 162.813,
+  .dec = -17.0085,
+},
+{ .is_ngc = TRUE,
+  .id = 3432,
+  .ra = 163.13,
+  .dec = 36.6194,
+},
+{ .is_ngc = TRUE,
+  .id = 3433,
+  .ra = 163.016,
+  .dec = 10.1481,
+},
+{ .is_ngc = TRUE,
+  .id = 3434,
+  .ra = 162.992,
+  .dec = 3.79161,
+},
+{ .is_ngc = TRUE,
+  .id = 3435,
+  .ra = 163.702,
+  .dec = 61.2893,
+},
+{ .is_ngc = TRUE,
+  .id = 3436,
+  .ra = 163.114,
+  .dec = 8.094,
+},
+{ .is_ngc = TRUE,
+  .id = 3437,
+  .ra = 163.148,
+  .dec = 22.9346,
+},
+{ .is_ngc = TRUE,
+  .id = 3438,
+  .ra = 163.108,
+  .dec = 10.5469,
+},
+{ .is_ngc = TRUE,
+  .id = 3439,
+  .ra = 163.107,
+  .dec = 8.55728,
+},
+{ .is_ngc = TRUE,
+  .id = 3440,
+  .ra = 163.457,
+  .dec = 57.1184,
+},
+{ .is_ngc = TRUE,
+  .id = 3441,
+  .ra = 163.129,
+  .dec = 7.22467,
+},
+{ .is_ngc = TRUE,
+  .id = 3442,
+  .ra = 163.284,
+  .dec = 33.9101,
+},
+{ .is_ngc = TRUE,
+  .id = 3443,
+  .ra = 163.251,
+  .dec = 17.5737,
+},
+{ .is_ngc = TRUE,
+  .id = 3444,
+  .ra = 163.248,
+  .dec = 10.2103,
+},
+{ .is_ngc = TRUE,
+  .id = 3445,
+  .ra = 163.65,
+  .dec = 56.99,
+},
+{ .is_ngc = TRUE,
+  .id = 3446,
+  .ra = 163.05,
+  .dec = -45.1358,
+},
+{ .is_ngc = TRUE,
+  .id = 3447,
+  .ra = 163.349,
+  .dec = 16.7723,
+},
+{ .is_ngc = TRUE,
+  .id = 3448,
+  .ra = 163.662,
+  .dec = 54.3053,
+},
+{ .is_ngc = TRUE,
+  .id = 3449,
+  .ra = 163.223,
+  .dec = -32.9269,
+},
+{ .is_ngc = TRUE,
+  .id = 3450,
+  .ra = 162.015,
+  .dec = -20.8492,
+},
+{ .is_ngc = TRUE,
+  .id = 3451,
+  .ra = 163.587,
+  .dec = 27.2393,
+},
+{ .is_ngc = TRUE,
+  .id = 3452,
+  .ra = 163.559,
+  .dec = -11.4053,
+},
+{ .is_ngc = TRUE,
+  .id = 3453,
+  .ra = 163.418,
+  .dec = -21.7933,
+},
+{ .is_ngc = TRUE,
+  .id = 3454,
+  .ra = 163.622,
+  .dec = 17.344,
+},
+{ .is_ngc = TRUE,
+  .id = 3455,
+  .ra = 163.63,
+  .dec = 17.2845,
+},
+{ .is_ngc = TRUE,
+  .id = 3456,
+  .ra = 163.515,
+  .dec = -16.0283,
+},
+{ .is_ngc = TRUE,
+  .id = 3458,
+  .ra = 164.007,
+  .dec = 57.1169,
+},
+{ .is_ngc = TRUE,
+  .id = 3459,
+  .ra = 163.685,
+  .dec = -17.0419,
+},
+{ .is_ngc = TRUE,
+  .id = 3461,
+  .ra = 163.73,
+  .dec = 17.7078,
+},
+{ .is_ngc = TRUE,
+  .id = 3462,
+  .ra = 163.838,
+  .dec = 7.69619,
+},
+{ .is_ngc = TRUE,
+  .id = 3463,
+  .ra = 163.806,
+  .dec = -26.1404,
+},
+{ .is_ngc = TRUE,
+  .id = 3464,
+  .ra = 163.667,
+  .dec = -21.0661,
+},
+{ .is_ngc = TRUE,
+  .id = 3465,
+  .ra = 164.881,
+  .dec = 75.1909,
+},
+{ .is_ngc = TRUE,
+  .id = 3466,
+  .ra = 164.065,
+  .dec = 9.75425,
+},
+{ .is_ngc = TRUE,
+  .id = 3467,
+  .ra = 164.184,
+  .dec = 9.75844,
+},
+{ .is_ngc = TRUE,
+  .id = 3468,
+  .ra = 164.38,
+  .dec = 40.9462,
+},
+{ .is_ngc = TRUE,
+  .id = 3469,
+  .ra = 164.24,
+  .dec = -14.3008,
+},
+{ .is_ngc = TRUE,
+  .id = 3470,
+  .ra = 164.688,
+  .dec = 59.5106,
+},
+{ .is_ngc = TRUE,
+  .id = 3471,
+  .ra = 164.788,
+  .dec = 61.5301,
+},
+{ .is_ngc = TRUE,
+  .id = 3472,
+  .ra = 164.342,
+  .dec = -19.6342,
+},
+{ .is_ngc = TRUE,
+  .id = 3473,
+  .ra = 164.522,
+  .dec = 17.1237,
+},
+{ .is_ngc = TRUE,
+  .id = 3474,
+  .ra = 164.537,
+  .dec = 17.0956,
+},
+{ .is_ngc = TRUE,
+  .id = 3475,
+  .ra = 164.605,
+  .dec = 24.2265,
+},
+{ .is_ngc = TRUE,
+  .id = 3477,
+  .ra = 164.552,
+  .dec = 9.2175,
+},
+{ .is_ngc = TRUE,
+  .id = 3478,
+  .ra = 164.865,
+  .dec = 46.1223,
+},
+{ .is_ngc = TRUE,
+  .id = 3481,
+  .ra = 164.86,
+  .dec = -7.54442,
+},
+{ .is_ngc = TRUE,
+  .id = 3482,
+  .ra = 164.642,
+  .dec = -46.5844,
+},
+{ .is_ngc = TRUE,
+  .id = 3483,
+  .ra = 164.75,
+  .dec = -28.4772,
+},
+{ .is_ngc = TRUE,
+  .id = 3484,
+  .ra = 165.771,
+  .dec = 75.8169,
+},
+{ .is_ngc = TRUE,
+  .id = 3485,
+  .ra = 165.01,
+  .dec = 14.8412,
+},
+{ .is_ngc = TRUE,
+  .id = 3486,
+  .ra = 165.1,
+  .dec = 28.975,
+},
+{ .is_ngc = TRUE,
+  .id = 3487,
+  .ra = 165.194,
+  .dec = 17.5869,
+},
+{ .is_ngc = TRUE,
+  .id = 3488,
+  .ra = 165.349,
+  .dec = 57.6771,
+},
+{ .is_ngc = TRUE,
+  .id = 3489,
+  .ra = 165.078,
+  .dec = 13.9012,
+},
+{ .is_ngc = TRUE,
+  .id = 3490,
+  .ra = 164.977,
+  .dec = 9.3618,
+},
+{ .is_ngc = TRUE,
+  .id = 3491,
+  .ra = 165.148,
+  .dec = 12.1617,
+},
+{ .is_ngc = TRUE,
+  .id = 3493,
+  .ra = 165.366,
+  .dec = 27.7194,
+},
+{ .is_ngc = TRUE,
+  .id = 3494,
+  .ra = 165.295,
+  .dec = 3.77431,
+},
+{ .is_ngc = TRUE,
+  .id = 3495,
+  .ra = 165.317,
+  .dec = 3.62703,
+},
+{ .is_ngc = TRUE,
+  .id = 3496,
+  .ra = 164.9,
+  .dec = -60.3339,
+},
+{ .is_ngc = TRUE,
+  .id = 3498,
+  .ra = 165.425,
+  .dec = 14.35,
+},
+{ .is_ngc = TRUE,
+  .id = 3499,
+  .ra = 165.797,
+  .dec = 56.2217,
+},
+{ .is_ngc = TRUE,
+  .id = 3500,
+  .ra = 165.464,
+  .dec = 75.2009,
+},
+{ .is_ngc = TRUE,
+  .id = 3501,
+  .ra = 165.697,
+  .dec = 17.9891,
+},
+{ .is_ngc = TRUE,
+  .id = 3503,
+  .ra = 165.321,
+  .dec = -59.8356,
+},
+{ .is_ngc = TRUE,
+  .id = 3504,
+  .ra = 165.797,
+  .dec = 27.9725,
+},
+{ .is_ngc = TRUE,
+  .id = 3506,
+  .ra = 165.804,
+  .dec = 11.0768,
+},
+{ .is_ngc = TRUE,
+  .id = 3507,
+  .ra = 165.856,
+  .dec = 18.1351,
+},
+{ .is_ngc = TRUE,
+  .id = 3509,
+  .ra = 166.098,
+  .dec = 4.82886,
+},
+{ .is_ngc = TRUE,
+  .id = 3510,
+  .ra = 165.932,
+  .dec = 28.8849,
+},
+{ .is_ngc = TRUE,
+  .id = 3511,
+  .ra = 165.849,
+  .dec = -23.0864,
+},
+{ .is_ngc = TRUE,
+  .id = 3512,
+  .ra = 166.012,
+  .dec = 28.0367,
+},
+{ .is_ngc = TRUE,
+  .id = 3513,
+  .ra = 165.941,
+  .dec = -23.2444,
+},
+{ .is_ngc = TRUE,
+  .id = 3514,
+  .ra = 166,
+  .dec = -18.7813,
+},
+{ .is_ngc = TRUE,
+  .id = 3515,
+  .ra = 166.155,
+  .dec = 28.2273,
+},
+{ .is_ngc = TRUE,
+  .id = 3516,
+  .ra = 166.698,
+  .dec = 72.5689,
+},
+{ .is_ngc = TRUE,
+  .id = 3517,
+  .ra = 166.404,
+  .dec = 56.525,
+},
+{ .is_ngc = TRUE,
+  .id = 3519,
+  .ra = 166.017,
+  .dec = -61.3669,
+},
+{ .is_ngc = TRUE,
+  .id = 3520,
+  .ra = 166.787,
+  .dec = -18.0242,
+},
+{ .is_ngc = TRUE,
+  .id = 3520,
+  .ra = 166.1,
+  .dec = -17.9431,
+},
+{ .is_ngc = TRUE,
+  .id = 3521,
+  .ra = 166.453,
+  .dec = -0.03625,
+},
+{ .is_ngc = TRUE,
+  .id = 3522,
+  .ra = 166.668,
+  .dec = 20.0854,
+},
+{ .is_ngc = TRUE,
+  .id = 3523,
+  .ra = 165.778,
+  .dec = 75.1159,
+},
+{ .is_ngc = TRUE,
+  .id = 3524,
+  .ra = 166.634,
+  .dec = 11.385,
+},
+{ .is_ngc = TRUE,
+  .id = 3527,
+  .ra = 166.826,
+  .dec = 28.527,
+},
+{ .is_ngc = TRUE,
+  .id = 3530,
+  .ra = 167.168,
+  .dec = 57.2298,
+},
+{ .is_ngc = TRUE,
+  .id = 3532,
+  .ra = 166.413,
+  .dec = -58.7506,
+},
+{ .is_ngc = TRUE,
+  .id = 3535,
+  .ra = 167.142,
+  .dec = 4.8318,
+},
+{ .is_ngc = TRUE,
+  .id = 3536,
+  .ra = 167.214,
+  .dec = 28.4754,
+},
+{ .is_ngc = TRUE,
+  .id = 3538,
+  .ra = 167.887,
+  .dec = 75.5706,
+},
+{ .is_ngc = TRUE,
+  .id = 3539,
+  .ra = 167.287,
+  .dec = 28.6719,
+},
+{ .is_ngc = TRUE,
+  .id = 3541,
+  .ra = 167.134,
+  .dec = -10.4918,
+},
+{ .is_ngc = TRUE,
+  .id = 3542,
+  .ra = 167.482,
+  .dec = 36.9462,
+},
+{ .is_ngc = TRUE,
+  .id = 3543,
+  .ra = 167.736,
+  .dec = 61.3472,
+},
+{ .is_ngc = TRUE,
+  .id = 3546,
+  .ra = 167.444,
+  .dec = -13.3814,
+},
+{ .is_ngc = TRUE,
+  .id = 3547,
+  .ra = 167.483,
+  .dec = 10.721,
+},
+{ .is_ngc = TRUE,
+  .id = 3549,
+  .ra = 167.736,
+  .dec = 53.3878,
+},
+{ .is_ngc = TRUE,
+  .id = 3550,
+  .ra = 167.66,
+  .dec = 28.7677,
+},
+{ .is_ngc = TRUE,
+  .id = 3551,
+  .ra = 167.435,
+  .dec = 21.7588,
+},
+{ .is_ngc = TRUE,
+  .id = 3552,
+  .ra = 167.679,
+  .dec = 28.6928,
+},
+{ .is_ngc = TRUE,
+  .id = 3553,
+  .ra = 167.669,
+  .dec = 28.6856,
+},
+{ .is_ngc = TRUE,
+  .id = 3554,
+  .ra = 167.7,
+  .dec = 28.6601,
+},
+{ .is_ngc = TRUE,
+  .id = 3555,
+  .ra = 167.46,
+  .dec = 21.8101,
+},
+{ .is_ngc = TRUE,
+  .id = 3556,
+  .ra = 167.879,
+  .dec = 55.674,
+},
+{ .is_ngc = TRUE,
+  .id = 3557,
+  .ra = 167.49,
+  .dec = -37.5392,
+},
+{ .is_ngc = TRUE,
+  .id = 3558,
+  .ra = 167.733,
+  .dec = 28.5435,
+},
+{ .is_ngc = TRUE,
+  .id = 3562,
+  .ra = 168.245,
+  .dec = 72.8789,
+},
+{ .is_ngc = TRUE,
+  .id = 3564,
+  .ra = 167.651,
+  .dec = -37.5482,
+},
+{ .is_ngc = TRUE,
+  .id = 3565,
+  .ra = 166.949,
+  .dec = -20.0216,
+},
+{ .is_ngc = TRUE,
+  .id = 3566,
+  .ra = 166.95,
+  .dec = -20.0224,
+},
+{ .is_ngc = TRUE,
+  .id = 3567,
+  .ra = 167.828,
+  .dec = 5.83639,
+},
+{ .is_ngc = TRUE,
+  .id = 3568,
+  .ra = 167.701,
+  .dec = -37.4489,
+},
+{ .is_ngc = TRUE,
+  .id = 3569,
+  .ra = 168.034,
+  .dec = 35.452,
+},
+{ .is_ngc = TRUE,
+  .id = 3570,
+  .ra = 168.014,
+  .dec = 27.5895,
+},
+{ .is_ngc = TRUE,
+  .id = 3572,
+  .ra = 167.596,
+  .dec = -60.2358,
+},
+{ .is_ngc = TRUE,
+  .id = 3573,
+  .ra = 167.827,
+  .dec = -36.8747,
+},
+{ .is_ngc = TRUE,
+  .id = 3574,
+  .ra = 168.05,
+  .dec = 27.6247,
+},
+{ .is_ngc = TRUE,
+  .id = 3576,
+  .ra = 167.886,
+  .dec = -61.3628,
+},
+{ .is_ngc = TRUE,
+  .id = 3577,
+  .ra = 168.437,
+  .dec = 48.2726,
+},
+{ .is_ngc = TRUE,
+  .id = 3578,
+  .ra = 168.217,
+  .dec = -15.9511,
+},
+{ .is_ngc = TRUE,
+  .id = 3579,
+  .ra = 167.995,
+  .dec = -61.2442,
+},
+{ .is_ngc = TRUE,
+  .id = 3580,
+  .ra = 168.316,
+  .dec = 3.65708,
+},
+{ .is_ngc = TRUE,
+  .id = 3581,
+  .ra = 168.004,
+  .dec = -61.3036,
+},
+{ .is_ngc = TRUE,
+  .id = 3582,
+  .ra = 168.042,
+  .dec = -61.2744,
+},
+{ .is_ngc = TRUE,
+  .id = 3583,
+  .ra = 168.546,
+  .dec = 48.3184,
+},
+{ .is_ngc = TRUE,
+  .id = 3584,
+  .ra = 168.081,
+  .dec = -61.2244,
+},
+{ .is_ngc = TRUE,
+  .id = 3585,
+  .ra = 168.321,
+  .dec = -26.7554,
+},
+{ .is_ngc = TRUE,
+  .id = 3586,
+  .ra = 168.123,
+  .dec = -61.3506,
+},
+{ .is_ngc = TRUE,
+  .id = 3587,
+  .ra = 168.699,
+  .dec = 55.0189,
+},
+{ .is_ngc = TRUE,
+  .id = 3589,
+  .ra = 168.807,
+  .dec = 60.7006,
+},
+{ .is_ngc = TRUE,
+  .id = 3590,
+  .ra = 168.246,
+  .dec = -60.7842,
+},
+{ .is_ngc = TRUE,
+  .id = 3591,
+  .ra = 168.513,
+  .dec = -14.088,
+},
+{ .is_ngc = TRUE,
+  .id = 3592,
+  .ra = 168.614,
+  .dec = 17.2593,
+},
+{ .is_ngc = TRUE,
+  .id = 3593,
+  .ra = 168.654,
+  .dec = 12.8174,
+},
+{ .is_ngc = TRUE,
+  .id = 3594,
+  .ra = 169.059,
+  .dec = 55.7041,
+},
+{ .is_ngc = TRUE,
+  .id = 3594,
+  .ra = 168.527,
+  .dec = 55.7107,
+},
+{ .is_ngc = TRUE,
+  .id = 3595,
+  .ra = 168.856,
+  .dec = 47.4468,
+},
+{ .is_ngc = TRUE,
+  .id = 3596,
+  .ra = 168.776,
+  .dec = 14.7867,
+},
+{ .is_ngc = TRUE,
+  .id = 3597,
+  .ra = 168.675,
+  .dec = -23.7283,
+},
+{ .is_ngc = TRUE,
+  .id = 3598,
+  .ra = 168.799,
+  .dec = 17.2623,
+},
+{ .is_ngc = TRUE,
+  .id = 3599,
+  .ra = 168.862,
+  .dec = 18.11,
+},
+{ .is_ngc = TRUE,
+  .id = 3600,
+  .ra = 168.967,
+  .dec = 41.5914,
+},
+{ .is_ngc = TRUE,
+  .id = 3601,
+  .ra = 168.888,
+  .dec = 5.11569,
+},
+{ .is_ngc = TRUE,
+  .id = 3602,
+  .ra = 168.951,
+  .dec = 17.4155,
+},
+{ .is_ngc = TRUE,
+  .id = 3603,
+  .ra = 168.779,
+  .dec = -61.2517,
+},
+{ .is_ngc = TRUE,
+  .id = 3605,
+  .ra = 169.194,
+  .dec = 18.0171,
+},
+{ .is_ngc = TRUE,
+  .id = 3606,
+  .ra = 169.065,
+  .dec = -33.8269,
+},
+{ .is_ngc = TRUE,
+  .id = 3607,
+  .ra = 169.228,
+  .dec = 18.0516,
+},
+{ .is_ngc = TRUE,
+  .id = 3608,
+  .ra = 169.246,
+  .dec = 18.1484,
+},
+{ .is_ngc = TRUE,
+  .id = 3609,
+  .ra = 169.46,
+  .dec = 26.6251,
+},
+{ .is_ngc = TRUE,
+  .id = 3610,
+  .ra = 169.606,
+  .dec = 58.7864,
+},
+{ .is_ngc = TRUE,
+  .id = 3612,
+  .ra = 169.561,
+  .dec = 26.6203,
+},
+{ .is_ngc = TRUE,
+  .id = 3613,
+  .ra = 169.651,
+  .dec = 58.0002,
+},
+{ .is_ngc = TRUE,
+  .id = 3614,
+  .ra = 169.589,
+  .dec = 45.7476,
+},
+{ .is_ngc = TRUE,
+  .id = 3615,
+  .ra = 169.528,
+  .dec = 23.397,
+},
+{ .is_ngc = TRUE,
+  .id = 3616,
+  .ra = 169.536,
+  .dec = 14.7653,
+},
+{ .is_ngc = TRUE,
+  .id = 3617,
+  .ra = 169.462,
+  .dec = -26.1344,
+},
+{ .is_ngc = TRUE,
+  .id = 3618,
+  .ra = 169.636,
+  .dec = 23.4686,
+},
+{ .is_ngc = TRUE,
+  .id = 3619,
+  .ra = 169.84,
+  .dec = 57.7586,
+},
+{ .is_ngc = TRUE,
+  .id = 3620,
+  .ra = 169.021,
+  .dec = -76.2165,
+},
+{ .is_ngc = TRUE,
+  .id = 3621,
+  .ra = 169.569,
+  .dec = -32.8138,
+},
+{ .is_ngc = TRUE,
+  .id = 3622,
+  .ra = 170.052,
+  .dec = 67.2412,
+},
+{ .is_ngc = TRUE,
+  .id = 3623,
+  .ra = 169.733,
+  .dec = 13.0921,
+},
+{ .is_ngc = TRUE,
+  .id = 3624,
+  .ra = 169.712,
+  .dec = 7.52086,
+},
+{ .is_ngc = TRUE,
+  .id = 3625,
+  .ra = 170.13,
+  .dec = 57.7814,
+},
+{ .is_ngc = TRUE,
+  .id = 3627,
+  .ra = 170.062,
+  .dec = 12.9907,
+},
+{ .is_ngc = TRUE,
+  .id = 3628,
+  .ra = 170.071,
+  .dec = 13.5887,
+},
+{ .is_ngc = TRUE,
+  .id = 3629,
+  .ra = 170.132,
+  .dec = 26.9627,
+},
+{ .is_ngc = TRUE,
+  .id = 3631,
+  .ra = 170.261,
+  .dec = 53.1697,
+},
+{ .is_ngc = TRUE,
+  .id = 3633,
+  .ra = 170.11,
+  .dec = 3.58592,
+},
+{ .is_ngc = TRUE,
+  .id = 3634,
+  .ra = 170.126,
+  .dec = -9.01389,
+},
+{ .is_ngc = TRUE,
+  .id = 3635,
+  .ra = 170.131,
+  .dec = -9.01367,
+},
+{ .is_ngc = TRUE,
+  .id = 3636,
+  .ra = 170.104,
+  .dec = -10.2819,
+},
+{ .is_ngc = TRUE,
+  .id = 3637,
+  .ra = 170.165,
+  .dec = -10.2575,
+},
+{ .is_ngc = TRUE,
+  .id = 3638,
+  .ra = 170.042,
+  .dec = -8.10606,
+},
+{ .is_ngc = TRUE,
+  .id = 3639,
+  .ra = 170.399,
+  .dec = 18.4584,
+},
+{ .is_ngc = TRUE,
+  .id = 3640,
+  .ra = 170.279,
+  .dec = 3.23489,
+},
+{ .is_ngc = TRUE,
+  .id = 3641,
+  .ra = 170.287,
+  .dec = 3.19461,
+},
+{ .is_ngc = TRUE,
+  .id = 3642,
+  .ra = 170.575,
+  .dec = 59.0747,
+},
+{ .is_ngc = TRUE,
+  .id = 3643,
+  .ra = 170.354,
+  .dec = 3.01364,
+},
+{ .is_ngc = TRUE,
+  .id = 3646,
+  .ra = 170.43,
+  .dec = 20.1699,
+},
+{ .is_ngc = TRUE,
+  .id = 3647,
+  .ra = 170.411,
+  .dec = 2.8915,
+},
+{ .is_ngc = TRUE,
+  .id = 3648,
+  .ra = 170.631,
+  .dec = 39.8766,
+},
+{ .is_ngc = TRUE,
+  .id = 3650,
+  .ra = 170.647,
+  .dec = 20.7038,
+},
+{ .is_ngc = TRUE,
+  .id = 3651,
+  .ra = 170.61,
+  .dec = 24.2988,
+},
+{ .is_ngc = TRUE,
+  .id = 3652,
+  .ra = 170.663,
+  .dec = 37.7648,
+},
+{ .is_ngc = TRUE,
+  .id = 3653,
+  .ra = 170.625,
+  .dec = 24.2792,
+},
+{ .is_ngc = TRUE,
+  .id = 3654,
+  .ra = 171.047,
+  .dec = 69.4128,
+},
+{ .is_ngc = TRUE,
+  .id = 3655,
+  .ra = 170.728,
+  .dec = 16.5895,
+},
+{ .is_ngc = TRUE,
+  .id = 3656,
+  .ra = 170.911,
+  .dec = 53.8419,
+},
+{ .is_ngc = TRUE,
+  .id = 3657,
+  .ra = 170.981,
+  .dec = 52.9208,
+},
+{ .is_ngc = TRUE,
+  .id = 3658,
+  .ra = 170.993,
+  .dec = 38.5627,
+},
+{ .is_ngc = TRUE,
+  .id = 3659,
+  .ra = 170.938,
+  .dec = 17.8171,
+},
+{ .is_ngc = TRUE,
+  .id = 3660,
+  .ra = 170.884,
+  .dec = -8.65833,
+},
+{ .is_ngc = TRUE,
+  .id = 3662,
+  .ra = 170.944,
+  .dec = -1.10464,
+},
+{ .is_ngc = TRUE,
+  .id = 3663,
+  .ra = 171,
+  .dec = -12.2961,
+},
+{ .is_ngc = TRUE,
+  .id = 3664,
+  .ra = 171.103,
+  .dec = 3.32694,
+},
+{ .is_ngc = TRUE,
+  .id = 3665,
+  .ra = 171.182,
+  .dec = 38.7626,
+},
+{ .is_ngc = TRUE,
+  .id = 3666,
+  .ra = 171.109,
+  .dec = 11.3423,
+},
+{ .is_ngc = TRUE,
+  .id = 3668,
+  .ra = 171.378,
+  .dec = 63.4456,
+},
+{ .is_ngc = TRUE,
+  .id = 3669,
+  .ra = 171.362,
+  .dec = 57.7211,
+},
+{ .is_ngc = TRUE,
+  .id = 3670,
+  .ra = 171.207,
+  .dec = 23.945,
+},
+{ .is_ngc = TRUE,
+  .id = 3671,
+  .ra = 171.469,
+  .dec = 60.4795,
+},
+{ .is_ngc = TRUE,
+  .id = 3672,
+  .ra = 171.26,
+  .dec = -9.795,
+},
+{ .is_ngc = TRUE,
+  .id = 3673,
+  .ra = 171.303,
+  .dec = -26.7367,
+},
+{ .is_ngc = TRUE,
+  .id = 3674,
+  .ra = 171.611,
+  .dec = 57.0486,
+},
+{ .is_ngc = TRUE,
+  .id = 3675,
+  .ra = 171.535,
+  .dec = 43.5857,
+},
+{ .is_ngc = TRUE,
+  .id = 3676,
+  .ra = 171.406,
+  .dec = -11.1397,
+},
+{ .is_ngc = TRUE,
+  .id = 3677,
+  .ra = 171.574,
+  .dec = 46.9738,
+},
+{ .is_ngc = TRUE,
+  .id = 3678,
+  .ra = 171.565,
+  .dec = 27.8666,
+},
+{ .is_ngc = TRUE,
+  .id = 3679,
+  .ra = 170.45,
+  .dec = -5.75797,
+},
+{ .is_ngc = TRUE,
+  .id = 3680,
+  .ra = 171.408,
+  .dec = -43.235,
+},
+{ .is_ngc = TRUE,
+  .id = 3681,
+  .ra = 171.624,
+  .dec = 16.8633,
+},
+{ .is_ngc = TRUE,
+  .id = 3682,
+  .ra = 171.924,
+  .dec = 66.5901,
+},
+{ .is_ngc = TRUE,
+  .id = 3683,
+  .ra = 171.883,
+  .dec = 56.8777,
+},
+{ .is_ngc = TRUE,
+  .id = 3684,
+  .ra = 171.797,
+  .dec = 17.03,
+},
+{ .is_ngc = TRUE,
+  .id = 3685,
+  .ra = 172.068,
+  .dec = 4.32783,
+},
+{ .is_ngc = TRUE,
+  .id = 3686,
+  .ra = 171.934,
+  .dec = 17.2235,
+},
+{ .is_ngc = TRUE,
+  .id = 3687,
+  .ra = 172.003,
+  .dec = 29.5109,
+},
+{ .is_ngc = TRUE,
+  .id = 3688,
+  .ra = 171.935,
+  .dec = -9.16566,
+},
+{ .is_ngc = TRUE,
+  .id = 3689,
+  .ra = 172.046,
+  .dec = 25.6609,
+},
+{ .is_ngc = TRUE,
+  .id = 3691,
+  .ra = 172.039,
+  .dec = 16.9202,
+},
+{ .is_ngc = TRUE,
+  .id = 3692,
+  .ra = 172.1,
+  .dec = 9.40694,
+},
+{ .is_ngc = TRUE,
+  .id = 3693,
+  .ra = 172.048,
+  .dec = -13.1952,
+},
+{ .is_ngc = TRUE,
+  .id = 3694,
+  .ra = 172.226,
+  .dec = 35.4138,
+},
+{ .is_ngc = TRUE,
+  .id = 3699,
+  .ra = 171.987,
+  .dec = -59.9575,
+},
+{ .is_ngc = TRUE,
+  .id = 3700,
+  .ra = 172.411,
+  .dec = 35.5145,
+},
+{ .is_ngc = TRUE,
+  .id = 3701,
+  .ra = 172.371,
+  .dec = 24.0932,
+},
+{ .is_ngc = TRUE,
+  .id = 3702,
+  .ra = 172.556,
+  .dec = -8.86339,
+},
+{ .is_ngc = TRUE,
+  .id = 3703,
+  .ra = 172.289,
+  .dec = -8.44631,
+},
+{ .is_ngc = TRUE,
+  .id = 3705,
+  .ra = 172.531,
+  .dec = 9.27653,
+},
+{ .is_ngc = TRUE,
+  .id = 3706,
+  .ra = 172.434,
+  .dec = -36.3919,
+},
+{ .is_ngc = TRUE,
+  .id = 3708,
+  .ra = 172.663,
+  .dec = -3.21778,
+},
+{ .is_ngc = TRUE,
+  .id = 3709,
+  .ra = 172.663,
+  .dec = -3.25111,
+},
+{ .is_ngc = TRUE,
+  .id = 3710,
+  .ra = 172.779,
+  .dec = 22.7678,
+},
+{ .is_ngc = TRUE,
+  .id = 3713,
+  .ra = 172.925,
+  .dec = 28.1534,
+},
+{ .is_ngc = TRUE,
+  .id = 3715,
+  .ra = 172.885,
+  .dec = -14.2319,
+},
+{ .is_ngc = TRUE,
+  .id = 3716,
+  .ra = 172.922,
+  .dec = 3.48758,
+},
+{ .is_ngc = TRUE,
+  .id = 3717,
+  .ra = 172.883,
+  .dec = -30.3083,
+},
+{ .is_ngc = TRUE,
+  .id = 3718,
+  .ra = 173.146,
+  .dec = 53.0677,
+},
+{ .is_ngc = TRUE,
+  .id = 3719,
+  .ra = 173.056,
+  .dec = 0.819528,
+},
+{ .is_ngc = TRUE,
+  .id = 3720,
+  .ra = 173.09,
+  .dec = 0.803917,
+},
+{ .is_ngc = TRUE,
+  .id = 3721,
+  .ra = 173.533,
+  .dec = -9.46708,
+},
+{ .is_ngc = TRUE,
+  .id = 3722,
+  .ra = 173.597,
+  .dec = -9.68005,
+},
+{ .is_ngc = TRUE,
+  .id = 3723,
+  .ra = 173.127,
+  .dec = -9.96968,
+},
+{ .is_ngc = TRUE,
+  .id = 3724,
+  .ra = 173.62,
+  .dec = -9.65992,
+},
+{ .is_ngc = TRUE,
+  .id = 3725,
+  .ra = 173.421,
+  .dec = 61.8881,
+},
+{ .is_ngc = TRUE,
+  .id = 3726,
+  .ra = 173.338,
+  .dec = 47.0286,
+},
+{ .is_ngc = TRUE,
+  .id = 3727,
+  .ra = 173.42,
+  .dec = -13.8788,
+},
+{ .is_ngc = TRUE,
+  .id = 3728,
+  .ra = 173.316,
+  .dec = 24.4468,
+},
+{ .is_ngc = TRUE,
+  .id = 3729,
+  .ra = 173.456,
+  .dec = 53.1256,
+},
+{ .is_ngc = TRUE,
+  .id = 3730,
+  .ra = 173.57,
+  .dec = -9.57617,
+},
+{ .is_ngc = TRUE,
+  .id = 3731,
+  .ra = 173.549,
+  .dec = 12.512,
+},
+{ .is_ngc = TRUE,
+  .id = 3732,
+  .ra = 173.558,
+  .dec = -9.84606,
+},
+{ .is_ngc = TRUE,
+  .id = 3733,
+  .ra = 173.757,
+  .dec = 54.8506,
+},
+{ .is_ngc = TRUE,
+  .id = 3734,
+  .ra = 173.669,
+  .dec = -14.0819,
+},
+{ .is_ngc = TRUE,
+  .id = 3735,
+  .ra = 173.989,
+  .dec = 70.5353,
+},
+{ .is_ngc = TRUE,
+  .id = 3736,
+  .ra = 173.923,
+  .dec = 73.4518,
+},
+{ .is_ngc = TRUE,
+  .id = 3737,
+  .ra = 173.901,
+  .dec = 54.949,
+},
+{ .is_ngc = TRUE,
+  .id = 3738,
+  .ra = 173.952,
+  .dec = 54.5236,
+},
+{ .is_ngc = TRUE,
+  .id = 3739,
+  .ra = 173.907,
+  .dec = 25.0883,
+},
+{ .is_ngc = TRUE,
+  .id = 3740,
+  .ra = 174.051,
+  .dec = 59.9761,
+},
+{ .is_ngc = TRUE,
+  .id = 3741,
+  .ra = 174.026,
+  .dec = 45.2845,
+},
+{ .is_ngc = TRUE,
+  .id = 3742,
+  .ra = 173.886,
+  .dec = -37.9572,
+},
+{ .is_ngc = TRUE,
+  .id = 3743,
+  .ra = 173.989,
+  .dec = 21.7232,
+},
+{ .is_ngc = TRUE,
+  .id = 3744,
+  .ra = 173.991,
+  .dec = 23.0115,
+},
+{ .is_ngc = TRUE,
+  .id = 3745,
+  .ra = 174.435,
+  .dec = 22.0211,
+},
+{ .is_ngc = TRUE,
+  .id = 3746,
+  .ra = 174.432,
+  .dec = 22.0093,
+},
+{ .is_ngc = TRUE,
+  .id = 3747,
+  .ra = 173.129,
+  .dec = 74.3786,
+},
+{ .is_ngc = TRUE,
+  .id = 3748,
+  .ra = 174.455,
+  .dec = 22.0257,
+},
+{ .is_ngc = TRUE,
+  .id = 3749,
+  .ra = 173.971,
+  .dec = -37.9972,
+},
+{ .is_ngc = TRUE,
+  .id = 3750,
+  .ra = 174.465,
+  .dec = 21.974,
+},
+{ .is_ngc = TRUE,
+  .id = 3751,
+  .ra = 174.475,
+  .dec = 21.9364,
+},
+{ .is_ngc = TRUE,
+  .id = 3752,
+  .ra = 173.134,
+  .dec = 74.6276,
+},
+{ .is_ngc = TRUE,
+  .id = 3753,
+  .ra = 174.475,
+  .dec = 21.9811,
+},
+{ .is_ngc = TRUE,
+  .id = 3754,
+  .ra = 174.479,
+  .dec = 21.9851,
+},
+{ .is_ngc = TRUE,
+  .id = 3755,
+  .ra = 174.139,
+  .dec = 36.4105,
+},
+{ .is_ngc = TRUE,
+  .id = 3756,
+  .ra = 174.202,
+  .dec = 54.2956,
+},
+{ .is_ngc = TRUE,
+  .id = 3757,
+  .ra = 174.263,
+  .dec = 58.415,
+},
+{ .is_ngc = TRUE,
+  .id = 3758,
+  .ra = 174.121,
+  .dec = 21.5967,
+},
+{ .is_ngc = TRUE,
+  .id = 3759,
+  .ra = 174.226,
+  .dec = 54.8234,
+},
+{ .is_ngc = TRUE,
+  .id = 3761,
+  .ra = 174.185,
+  .dec = 22.9916,
+},
+{ .is_ngc = TRUE,
+  .id = 3762,
+  .ra = 174.35,
+  .dec = 61.7593,
+},
+{ .is_ngc = TRUE,
+  .id = 3764,
+  .ra = 174.227,
+  .dec = 17.8885,
+},
+{ .is_ngc = TRUE,
+  .id = 3765,
+  .ra = 174.268,
+  .dec = 24.096,
+},
+{ .is_ngc = TRUE,
+  .id = 3766,
+  .ra = 174.058,
+  .dec = -61.6014,
+},
+{ .is_ngc = TRUE,
+  .id = 3767,
+  .ra = 174.315,
+  .dec = 16.8767,
+},
+{ .is_ngc = TRUE,
+  .id = 3768,
+  .ra = 174.31,
+  .dec = 17.8395,
+},
+{ .is_ngc = TRUE,
+  .id = 3769,
+  .ra = 174.434,
+  .dec = 47.8927,
+},
+{ .is_ngc = TRUE,
+  .id = 3770,
+  .ra = 174.496,
+  .dec = 59.6166,
+},
+{ .is_ngc = TRUE,
+  .id = 3771,
+  .ra = 174.775,
+  .dec = -9.34831,
+},
+{ .is_ngc = TRUE,
+  .id = 3772,
+  .ra = 174.452,
+  .dec = 22.6912,
+},
+{ .is_ngc = TRUE,
+  .id = 3773,
+  .ra = 174.554,
+  .dec = 12.1122,
+},
+{ .is_ngc = TRUE,
+  .id = 3774,
+  .ra = 174.626,
+  .dec = -8.97642,
+},
+{ .is_ngc = TRUE,
+  .id = 3775,
+  .ra = 174.611,
+  .dec = -10.6383,
+},
+{ .is_ngc = TRUE,
+  .id = 3776,
+  .ra = 174.575,
+  .dec = -3.35464,
+},
+{ .is_ngc = TRUE,
+  .id = 3777,
+  .ra = 174.028,
+  .dec = -12.5692,
+},
+{ .is_ngc = TRUE,
+  .id = 3778,
+  .ra = 174.59,
+  .dec = -50.7164,
+},
+{ .is_ngc = TRUE,
+  .id = 3780,
+  .ra = 174.844,
+  .dec = 56.27,
+},
+{ .is_ngc = TRUE,
+  .id = 3781,
+  .ra = 174.766,
+  .dec = 26.3617,
+},
+{ .is_ngc = TRUE,
+  .id = 3782,
+  .ra = 174.836,
+  .dec = 46.5133,
+},
+{ .is_ngc = TRUE,
+  .id = 3783,
+  .ra = 174.757,
+  .dec = -37.7387,
+},
+{ .is_ngc = TRUE,
+  .id = 3784,
+  .ra = 174.874,
+  .dec = 26.3092,
+},
+{ .is_ngc = TRUE,
+  .id = 3785,
+  .ra = 174.887,
+  .dec = 26.3022,
+},
+{ .is_ngc = TRUE,
+  .id = 3786,
+  .ra = 174.927,
+  .dec = 31.909,
+},
+{ .is_ngc = TRUE,
+  .id = 3787,
+  .ra = 174.908,
+  .dec = 20.4544,
+},
+{ .is_ngc = TRUE,
+  .id = 3788,
+  .ra = 174.936,
+  .dec = 31.9309,
+},
+{ .is_ngc = TRUE,
+  .id = 3789,
+  .ra = 174.538,
+  .dec = -9.60722,
+},
+{ .is_ngc = TRUE,
+  .id = 3790,
+  .ra = 174.947,
+  .dec = 17.7123,
+},
+{ .is_ngc = TRUE,
+  .id = 3791,
+  .ra = 174.924,
+  .dec = -9.36722,
+},
+{ .is_ngc = TRUE,
+  .id = 3792,
+  .ra = 174.91,
+  .dec = 5.09944,
+},
+{ .is_ngc = TRUE,
+  .id = 3793,
+  .ra = 175.008,
+  .dec = 31.8774,
+},
+{ .is_ngc = TRUE,
+  .id = 3795,
+  .ra = 175.029,
+  .dec = 58.6123,
+},
+{ .is_ngc = TRUE,
+  .id = 3796,
+  .ra = 175.129,
+  .dec = 60.2987,
+},
+{ .is_ngc = TRUE,
+  .id = 3797,
+  .ra = 175.056,
+  .dec = 31.9061,
+},
+{ .is_ngc = TRUE,
+  .id = 3798,
+  .ra = 175.058,
+  .dec = 24.6969,
+},
+{ .is_ngc = TRUE,
+  .id = 3799,
+  .ra = 175.039,
+  .dec = 15.3271,
+},
+{ .is_ngc = TRUE,
+  .id = 3800,
+  .ra = 175.055,
+  .dec = 15.3421,
+},
+{ .is_ngc = TRUE,
+  .id = 3801,
+  .ra = 175.07,
+  .dec = 17.7277,
+},
+{ .is_ngc = TRUE,
+  .id = 3802,
+  .ra = 175.078,
+  .dec = 17.7654,
+},
+{ .is_ngc = TRUE,
+  .id = 3803,
+  .ra = 175.072,
+  .dec = 17.8011,
+},
+{ .is_ngc = TRUE,
+  .id = 3805,
+  .ra = 175.174,
+  .dec = 20.343,
+},
+{ .is_ngc = TRUE,
+  .id = 3806,
+  .ra = 175.194,
+  .dec = 17.7956,
+},
+{ .is_ngc = TRUE,
+  .id = 3807,
+  .ra = 175.469,
+  .dec = 17.8204,
+},
+{ .is_ngc = TRUE,
+  .id = 3808,
+  .ra = 175.184,
+  .dec = 22.4291,
+},
+{ .is_ngc = TRUE,
+  .id = 3809,
+  .ra = 175.316,
+  .dec = 59.8859,
+},
+{ .is_ngc = TRUE,
+  .id = 3810,
+  .ra = 175.245,
+  .dec = 11.4715,
+},
+{ .is_ngc = TRUE,
+  .id = 3811,
+  .ra = 175.32,
+  .dec = 47.691,
+},
+{ .is_ngc = TRUE,
+  .id = 3812,
+  .ra = 175.282,
+  .dec = 24.8216,
+},
+{ .is_ngc = TRUE,
+  .id = 3813,
+  .ra = 175.327,
+  .dec = 36.5467,
+},
+{ .is_ngc = TRUE,
+  .id = 3814,
+  .ra = 175.365,
+  .dec = 24.8052,
+},
+{ .is_ngc = TRUE,
+  .id = 3815,
+  .ra = 175.414,
+  .dec = 24.8,
+},
+{ .is_ngc = TRUE,
+  .id = 3816,
+  .ra = 175.45,
+  .dec = 20.1036,
+},
+{ .is_ngc = TRUE,
+  .id = 3817,
+  .ra = 175.471,
+  .dec = 10.3038,
+},
+{ .is_ngc = TRUE,
+  .id = 3818,
+  .ra = 175.489,
+  .dec = -6.15583,
+},
+{ .is_ngc = TRUE,
+  .id = 3819,
+  .ra = 175.525,
+  .dec = 10.351,
+},
+{ .is_ngc = TRUE,
+  .id = 3820,
+  .ra = 175.52,
+  .dec = 10.3839,
+},
+{ .is_ngc = TRUE,
+  .id = 3821,
+  .ra = 175.538,
+  .dec = 20.3155,
+},
+{ .is_ngc = TRUE,
+  .id = 3823,
+  .ra = 175.563,
+  .dec = -13.8667,
+},
+{ .is_ngc = TRUE,
+  .id = 3824,
+  .ra = 175.687,
+  .dec = 52.7794,
+},
+{ .is_ngc = TRUE,
+  .id = 3827,
+  .ra = 175.651,
+  .dec = 18.8449,
+},
+{ .is_ngc = TRUE,
+  .id = 3828,
+  .ra = 175.743,
+  .dec = 16.4872,
+},
+{ .is_ngc = TRUE,
+  .id = 3829,
+  .ra = 175.864,
+  .dec = 52.7111,
+},
+{ .is_ngc = TRUE,
+  .id = 3831,
+  .ra = 175.827,
+  .dec = -12.878,
+},
+{ .is_ngc = TRUE,
+  .id = 3832,
+  .ra = 175.881,
+  .dec = 22.7252,
+},
+{ .is_ngc = TRUE,
+  .id = 3833,
+  .ra = 175.871,
+  .dec = 10.1615,
+},
+{ .is_ngc = TRUE,
+  .id = 3834,
+  .ra = 175.907,
+  .dec = 19.09,
+},
+{ .is_ngc = TRUE,
+  .id = 3835,
+  .ra = 176.021,
+  .dec = 60.1201,
+},
+{ .is_ngc = TRUE,
+  .id = 3837,
+  .ra = 175.985,
+  .dec = 19.8946,
+},
+{ .is_ngc = TRUE,
+  .id = 3838,
+  .ra = 176.058,
+  .dec = 57.948,
+},
+{ .is_ngc = TRUE,
+  .id = 3839,
+  .ra = 175.977,
+  .dec = 10.7841,
+},
+{ .is_ngc = TRUE,
+  .id = 3840,
+  .ra = 175.996,
+  .dec = 20.0769,
+},
+{ .is_ngc = TRUE,
+  .id = 3841,
+  .ra = 176.009,
+  .dec = 19.9716,
+},
+{ .is_ngc = TRUE,
+  .id = 3842,
+  .ra = 176.009,
+  .dec = 19.9495,
+},
+{ .is_ngc = TRUE,
+  .id = 3843,
+  .ra = 175.978,
+  .dec = 7.92561,
+},
+{ .is_ngc = TRUE,
+  .id = 3844,
+  .ra = 176.004,
+  .dec = 20.0292,
+},
+{ .is_ngc = TRUE,
+  .id = 3845,
+  .ra = 176.023,
+  .dec = 19.9956,
+},
+{ .is_ngc = TRUE,
+  .id = 3846,
+  .ra = 176.121,
+  .dec = 55.6516,
+},
+{ .is_ngc = TRUE,
+  .id = 3850,
+  .ra = 176.399,
+  .dec = 55.8863,
+},
+{ .is_ngc = TRUE,
+  .id = 3851,
+  .ra = 176.085,
+  .dec = 19.9806,
+},
+{ .is_ngc = TRUE,
+  .id = 3853,
+  .ra = 176.118,
+  .dec = 16.5579,
+},
+{ .is_ngc = TRUE,
+  .id = 3857,
+  .ra = 176.209,
+  .dec = 19.5326,
+},
+{ .is_ngc = TRUE,
+  .id = 3859,
+  .ra = 176.218,
+  .dec = 19.4542,
+},
+{ .is_ngc = TRUE,
+  .id = 3862,
+  .ra = 176.271,
+  .dec = 19.606,
+},
+{ .is_ngc = TRUE,
+  .id = 3863,
+  .ra = 176.273,
+  .dec = 8.46878,
+},
+{ .is_ngc = TRUE,
+  .id = 3864,
+  .ra = 176.315,
+  .dec = 19.3919,
+},
+{ .is_ngc = TRUE,
+  .id = 3867,
+  .ra = 176.374,
+  .dec = 19.4,
+},
+{ .is_ngc = TRUE,
+  .id = 3868,
+  .ra = 176.375,
+  .dec = 19.4445,
+},
+{ .is_ngc = TRUE,
+  .id = 3869,
+  .ra = 176.44,
+  .dec = 10.8242,
+},
+{ .is_ngc = TRUE,
+  .id = 3870,
+  .ra = 176.486,
+  .dec = 50.2,
+},
+{ .is_ngc = TRUE,
+  .id = 3872,
+  .ra = 176.454,
+  .dec = 13.7666,
+},
+{ .is_ngc = TRUE,
+  .id = 3873,
+  .ra = 176.442,
+  .dec = 19.7735,
+},
+{ .is_ngc = TRUE,
+  .id = 3874,
+  .ra = 176.407,
+  .dec = 8.57361,
+},
+{ .is_ngc = TRUE,
+  .id = 3875,
+  .ra = 176.456,
+  .dec = 19.7669,
+},
+{ .is_ngc = TRUE,
+  .id = 3876,
+  .ra = 176.361,
+  .dec = 9.16086,
+},
+{ .is_ngc = TRUE,
+  .id = 3877,
+  .ra = 176.532,
+  .dec = 47.4947,
+},
+{ .is_ngc = TRUE,
+  .id = 3878,
+  .ra = 176.574,
+  .dec = 33.2044,
+},
+{ .is_ngc = TRUE,
+  .id = 3879,
+  .ra = 176.706,
+  .dec = 69.3829,
+},
+{ .is_ngc = TRUE,
+  .id = 3880,
+  .ra = 176.593,
+  .dec = 33.1618,
+},
+{ .is_ngc = TRUE,
+  .id = 3881,
+  .ra = 176.643,
+  .dec = 33.1064,
+},
+{ .is_ngc = TRUE,
+  .id = 3882,
+  .ra = 176.525,
+  .dec = -56.39,
+},
+{ .is_ngc = TRUE,
+  .id = 3883,
+  .ra = 176.696,
+  .dec = 20.6756,
+},
+{ .is_ngc = TRUE,
+  .id = 3884,
+  .ra = 176.551,
+  .dec = 20.3914,
+},
+{ .is_ngc = TRUE,
+  .id = 3885,
+  .ra = 176.694,
+  .dec = -27.9222,
+},
+{ .is_ngc = TRUE,
+  .id = 3886,
+  .ra = 176.773,
+  .dec = 19.8371,
+},
+{ .is_ngc = TRUE,
+  .id = 3887,
+  .ra = 176.77,
+  .dec = -16.8544,
+},
+{ .is_ngc = TRUE,
+  .id = 3888,
+  .ra = 176.893,
+  .dec = 55.9671,
+},
+{ .is_ngc = TRUE,
+  .id = 3889,
+  .ra = 176.95,
+  .dec = 56.0181,
+},
+{ .is_ngc = TRUE,
+  .id = 3891,
+  .ra = 177.014,
+  .dec = 30.3594,
+},
+{ .is_ngc = TRUE,
+  .id = 3892,
+  .ra = 177.005,
+  .dec = -10.9628,
+},
+{ .is_ngc = TRUE,
+  .id = 3893,
+  .ra = 177.16,
+  .dec = 48.7108,
+},
+{ .is_ngc = TRUE,
+  .id = 3894,
+  .ra = 177.21,
+  .dec = 59.416,
+},
+{ .is_ngc = TRUE,
+  .id = 3895,
+  .ra = 177.267,
+  .dec = 59.4327,
+},
+{ .is_ngc = TRUE,
+  .id = 3896,
+  .ra = 177.235,
+  .dec = 48.6746,
+},
+{ .is_ngc = TRUE,
+  .id = 3897,
+  .ra = 177.248,
+  .dec = 35.0158,
+},
+{ .is_ngc = TRUE,
+  .id = 3898,
+  .ra = 177.314,
+  .dec = 56.0843,
+},
+{ .is_ngc = TRUE,
+  .id = 3900,
+  .ra = 177.289,
+  .dec = 27.022,
+},
+{ .is_ngc = TRUE,
+  .id = 3901,
+  .ra = 175.704,
+  .dec = 77.3725,
+},
+{ .is_ngc = TRUE,
+  .id = 3902,
+  .ra = 177.328,
+  .dec = 26.1218,
+},
+{ .is_ngc = TRUE,
+  .id = 3903,
+  .ra = 177.265,
+  .dec = -37.5169,
+},
+{ .is_ngc = TRUE,
+  .id = 3904,
+  .ra = 177.305,
+  .dec = -29.2767,
+},
+{ .is_ngc = TRUE,
+  .id = 3905,
+  .ra = 177.271,
+  .dec = -9.72944,
+},
+{ .is_ngc = TRUE,
+  .id = 3906,
+  .ra = 177.418,
+  .dec = 48.4257,
+},
+{ .is_ngc = TRUE,
+  .id = 3908,
+  .ra = 177.469,
+  .dec = 12.1856,
+},
+{ .is_ngc = TRUE,
+  .id = 3909,
+  .ra = 177.525,
+  .dec = -48.2356,
+},
+{ .is_ngc = TRUE,
+  .id = 3910,
+  .ra = 177.497,
+  .dec = 21.3332,
+},
+{ .is_ngc = TRUE,
+  .id = 3911,
+  .ra = 177.525,
+  .dec = 24.9202,
+},
+{ .is_ngc = TRUE,
+  .id = 3914,
+  .ra = 177.637,
+  .dec = 6.56769,
+},
+{ .is_ngc = TRUE,
+  .id = 3915,
+  .ra = 176.732,
+  .dec = -5.18819,
+},
+{ .is_ngc = TRUE,
+  .id = 3916,
+  .ra = 177.713,
+  .dec = 55.1435,
+},
+{ .is_ngc = TRUE,
+  .id = 3917,
+  .ra = 177.689,
+  .dec = 51.8248,
+},
+{ .is_ngc = TRUE,
+  .id = 3918,
+  .ra = 177.574,
+  .dec = -57.1823,
+},
+{ .is_ngc = TRUE,
+  .id = 3919,
+  .ra = 177.673,
+  .dec = 20.0149,
+},
+{ .is_ngc = TRUE,
+  .id = 3920,
+  .ra = 177.342,
+  .dec = 24.9385,
+},
+{ .is_ngc = TRUE,
+  .id = 3921,
+  .ra = 177.778,
+  .dec = 55.0788,
+},
+{ .is_ngc = TRUE,
+  .id = 3923,
+  .ra = 177.758,
+  .dec = -28.8064,
+},
+{ .is_ngc = TRUE,
+  .id = 3925,
+  .ra = 177.837,
+  .dec = 21.8889,
+},
+{ .is_ngc = TRUE,
+  .id = 3927,
+  .ra = 177.883,
+  .dec = 28.1344,
+},
+{ .is_ngc = TRUE,
+  .id = 3928,
+  .ra = 177.948,
+  .dec = 48.6828,
+},
+{ .is_ngc = TRUE,
+  .id = 3929,
+  .ra = 177.928,
+  .dec = 21.0026,
+},
+{ .is_ngc = TRUE,
+  .id = 3930,
+  .ra = 177.941,
+  .dec = 38.0146,
+},
+{ .is_ngc = TRUE,
+  .id = 3932,
+  .ra = 178.045,
+  .dec = 48.6203,
+},
+{ .is_ngc = TRUE,
+  .id = 3933,
+  .ra = 178.009,
+  .dec = 16.8096,
+},
+{ .is_ngc = TRUE,
+  .id = 3934,
+  .ra = 178.053,
+  .dec = 16.8516,
+},
+{ .is_ngc = TRUE,
+  .id = 3935,
+  .ra = 178.1,
+  .dec = 32.404,
+},
+{ .is_ngc = TRUE,
+  .id = 3936,
+  .ra = 178.085,
+  .dec = -26.9064,
+},
+{ .is_ngc = TRUE,
+  .id = 3937,
+  .ra = 178.178,
+  .dec = 20.6314,
+},
+{ .is_ngc = TRUE,
+  .id = 3938,
+  .ra = 178.206,
+  .dec = 44.1207,
+},
+{ .is_ngc = TRUE,
+  .id = 3940,
+  .ra = 178.194,
+  .dec = 20.9892,
+},
+{ .is_ngc = TRUE,
+  .id = 3941,
+  .ra = 178.23,
+  .dec = 36.9864,
+},
+{ .is_ngc = TRUE,
+  .id = 3942,
+  .ra = 177.875,
+  .dec = -11.4244,
+},
+{ .is_ngc = TRUE,
+  .id = 3943,
+  .ra = 178.236,
+  .dec = 20.4788,
+},
+{ .is_ngc = TRUE,
+  .id = 3944,
+  .ra = 178.272,
+  .dec = 26.207,
+},
+{ .is_ngc = TRUE,
+  .id = 3945,
+  .ra = 178.308,
+  .dec = 60.6758,
+},
+{ .is_ngc = TRUE,
+  .id = 3946,
+  .ra = 178.336,
+  .dec = 21.021,
+},
+{ .is_ngc = TRUE,
+  .id = 3947,
+  .ra = 178.334,
+  .dec = 20.7517,
+},
+{ .is_ngc = TRUE,
+  .id = 3948,
+  .ra = 178.403,
+  .dec = 20.9507,
+},
+{ .is_ngc = TRUE,
+  .id = 3949,
+  .ra = 178.423,
+  .dec = 47.859,
+},
+{ .is_ngc = TRUE,
+  .id = 3950,
+  .ra = 178.422,
+  .dec = 47.8846,
+},
+{ .is_ngc = TRUE,
+  .id = 3951,
+  .ra = 178.422,
+  .dec = 23.382,
+},
+{ .is_ngc = TRUE,
+  .id = 3953,
+  .ra = 178.454,
+  .dec = 52.3268,
+},
+{ .is_ngc = TRUE,
+  .id = 3954,
+  .ra = 178.424,
+  .dec = 20.8825,
+},
+{ .is_ngc = TRUE,
+  .id = 3955,
+  .ra = 178.488,
+  .dec = -23.1646,
+},
+{ .is_ngc = TRUE,
+  .id = 3956,
+  .ra = 178.503,
+  .dec = -20.5667,
+},
+{ .is_ngc = TRUE,
+  .id = 3958,
+  .ra = 178.641,
+  .dec = 58.3666,
+},
+{ .is_ngc = TRUE,
+  .id = 3959,
+  .ra = 178.657,
+  .dec = -7.75667,
+},
+{ .is_ngc = TRUE,
+  .id = 3960,
+  .ra = 177.638,
+  .dec = -55.6678,
+},
+{ .is_ngc = TRUE,
+  .id = 3961,
+  .ra = 178.74,
+  .dec = 69.3299,
+},
+{ .is_ngc = TRUE,
+  .id = 3962,
+  .ra = 178.666,
+  .dec = -13.9747,
+},
+{ .is_ngc = TRUE,
+  .id = 3963,
+  .ra = 178.746,
+  .dec = 58.4932,
+},
+{ .is_ngc = TRUE,
+  .id = 3964,
+  .ra = 178.723,
+  .dec = 28.2622,
+},
+{ .is_ngc = TRUE,
+  .id = 3965,
+  .ra = 178.779,
+  .dec = -10.8686,
+},
+{ .is_ngc = TRUE,
+  .id = 3967,
+  .ra = 178.794,
+  .dec = -7.84423,
+},
+{ .is_ngc = TRUE,
+  .id = 3968,
+  .ra = 178.87,
+  .dec = 11.968,
+},
+{ .is_ngc = TRUE,
+  .id = 3969,
+  .ra = 178.788,
+  .dec = -18.9272,
+},
+{ .is_ngc = TRUE,
+  .id = 3970,
+  .ra = 178.867,
+  .dec = -12.0613,
+},
+{ .is_ngc = TRUE,
+  .id = 3972,
+  .ra = 178.938,
+  .dec = 55.3201,
+},
+{ .is_ngc = TRUE,
+  .id = 3973,
+  .ra = 178.904,
+  .dec = 11.9967,
+},
+{ .is_ngc = TRUE,
+  .id = 3974,
+  .ra = 178.917,
+  .dec = -12.0272,
+},
+{ .is_ngc = TRUE,
+  .id = 3975,
+  .ra = 178.973,
+  .dec = 60.5286,
+},
+{ .is_ngc = TRUE,
+  .id = 3976,
+  .ra = 178.989,
+  .dec = 6.74883,
+},
+{ .is_ngc = TRUE,
+  .id = 3978,
+  .ra = 179.043,
+  .dec = 60.5222,
+},
+{ .is_ngc = TRUE,
+  .id = 3981,
+  .ra = 179.03,
+  .dec = -19.8965,
+},
+{ .is_ngc = TRUE,
+  .id = 3982,
+  .ra = 179.118,
+  .dec = 55.1252,
+},
+{ .is_ngc = TRUE,
+  .id = 3983,
+  .ra = 179.099,
+  .dec = 23.8674,
+},
+{ .is_ngc = TRUE,
+  .id = 3985,
+  .ra = 179.175,
+  .dec = 48.3346,
+},
+{ .is_ngc = TRUE,
+  .id = 3987,
+  .ra = 179.337,
+  .dec = 25.195,
+},
+{ .is_ngc = TRUE,
+  .id = 3988,
+  .ra = 179.351,
+  .dec = 27.8774,
+},
+{ .is_ngc = TRUE,
+  .id = 3989,
+  .ra = 179.361,
+  .dec = 25.2327,
+},
+{ .is_ngc = TRUE,
+  .id = 3990,
+  .ra = 179.399,
+  .dec = 55.4587,
+},
+{ .is_ngc = TRUE,
+  .id = 3991,
+  .ra = 179.378,
+  .dec = 32.3373,
+},
+{ .is_ngc = TRUE,
+  .id = 3992,
+  .ra = 179.4,
+  .dec = 53.3746,
+},
+{ .is_ngc = TRUE,
+  .id = 3993,
+  .ra = 179.407,
+  .dec = 25.2406,
+},
+{ .is_ngc = TRUE,
+  .id = 3994,
+  .ra = 179.403,
+  .dec = 32.2774,
+},
+{ .is_ngc = TRUE,
+  .id = 3995,
+  .ra = 179.434,
+  .dec = 32.294,
+},
+{ .is_ngc = TRUE,
+  .id = 3996,
+  .ra = 179.442,
+  .dec = 14.2972,
+},
+{ .is_ngc = TRUE,
+  .id = 3997,
+  .ra = 179.451,
+  .dec = 25.2706,
+},
+{ .is_ngc = TRUE,
+  .id = 3998,
+  .ra = 179.484,
+  .dec = 55.4535,
+},
+{ .is_ngc = TRUE,
+  .id = 3999,
+  .ra = 179.485,
+  .dec = 25.0681,
+},
+{ .is_ngc = TRUE,
+  .id = 4000,
+  .ra = 179.488,
+  .dec = 25.1442,
+},
+{ .is_ngc = TRUE,
+  .id = 4001,
+  .ra = 179.528,
+  .dec = 47.3349,
+},
+{ .is_ngc = TRUE,
+  .id = 4002,
+  .ra = 179.497,
+  .dec = 23.2018,
+},
+{ .is_ngc = TRUE,
+  .id = 4003,
+  .ra = 179.496,
+  .dec = 23.1246,
+},
+{ .is_ngc = TRUE,
+  .id = 4006,
+  .ra = 179.524,
+  .dec = -2.12039,
+},
+{ .is_ngc = TRUE,
+  .id = 4008,
+  .ra = 179.571,
+  .dec = 28.1922,
+},
+{ .is_ngc = TRUE,
+  .id = 4009,
+  .ra = 179.563,
+  .dec = 25.1901,
+},
+{ .is_ngc = TRUE,
+  .id = 4010,
+  .ra = 179.655,
+  .dec = 47.2604,
+},
+{ .is_ngc = TRUE,
+  .id = 4011,
+  .ra = 179.606,
+  .dec = 25.0975,
+},
+{ .is_ngc = TRUE,
+  .id = 4012,
+  .ra = 179.615,
+  .dec = 10.0213,
+},
+{ .is_ngc = TRUE,
+  .id = 4013,
+  .ra = 179.631,
+  .dec = 43.947,
+},
+{ .is_ngc = TRUE,
+  .id = 4016,
+  .ra = 179.621,
+  .dec = 27.5286,
+},
+{ .is_ngc = TRUE,
+  .id = 4017,
+  .ra = 179.69,
+  .dec = 27.4526,
+},
+{ .is_ngc = TRUE,
+  .id = 4018,
+  .ra = 179.669,
+  .dec = 25.3169,
+},
+{ .is_ngc = TRUE,
+  .id = 4020,
+  .ra = 179.735,
+  .dec = 30.4113,
+},
+{ .is_ngc = TRUE,
+  .id = 4021,
+  .ra = 179.761,
+  .dec = 25.0832,
+},
+{ .is_ngc = TRUE,
+  .id = 4022,
+  .ra = 179.754,
+  .dec = 25.2225,
+},
+{ .is_ngc = TRUE,
+  .id = 4023,
+  .ra = 179.773,
+  .dec = 24.9889,
+},
+{ .is_ngc = TRUE,
+  .id = 4024,
+  .ra = 179.631,
+  .dec = -18.3467,
+},
+{ .is_ngc = TRUE,
+  .id = 4025,
+  .ra = 179.792,
+  .dec = 37.7923,
+},
+{ .is_ngc = TRUE,
+  .id = 4026,
+  .ra = 179.855,
+  .dec = 50.9616,
+},
+{ .is_ngc = TRUE,
+  .id = 4027,
+  .ra = 179.876,
+  .dec = -19.2664,
+},
+{ .is_ngc = TRUE,
+  .id = 4029,
+  .ra = 180.014,
+  .dec = 8.18164,
+},
+{ .is_ngc = TRUE,
+  .id = 4030,
+  .ra = 180.098,
+  .dec = -1.10033,
+},
+{ .is_ngc = TRUE,
+  .id = 4031,
+  .ra = 180.13,
+  .dec = 31.9472,
+},
+{ .is_ngc = TRUE,
+  .id = 4032,
+  .ra = 180.137,
+  .dec = 20.0744,
+},
+{ .is_ngc = TRUE,
+  .id = 4033,
+  .ra = 180.145,
+  .dec = -17.8425,
+},
+{ .is_ngc = TRUE,
+  .id = 4034,
+  .ra = 180.374,
+  .dec = 69.3235,
+},
+{ .is_ngc = TRUE,
+  .id = 4035,
+  .ra = 180.122,
+  .dec = -15.9483,
+},
+{ .is_ngc = TRUE,
+  .id = 4036,
+  .ra = 180.362,
+  .dec = 61.8955,
+},
+{ .is_ngc = TRUE,
+  .id = 4037,
+  .ra = 180.349,
+  .dec = 13.4009,
+},
+{ .is_ngc = TRUE,
+  .id = 4038,
+  .ra = 180.471,
+  .dec = -18.8686,
+},
+{ .is_ngc = TRUE,
+  .id = 4039,
+  .ra = 180.474,
+  .dec = -18.8859,
+},
+{ .is_ngc = TRUE,
+  .id = 4040,
+  .ra = 180.523,
+  .dec = 17.8229,
+},
+{ .is_ngc = TRUE,
+  .id = 4041,
+  .ra = 180.55,
+  .dec = 62.1375,
+},
+{ .is_ngc = TRUE,
+  .id = 4042,
+  .ra = 180.695,
+  .dec = 20.1635,
+},
+{ .is_ngc = TRUE,
+  .id = 4043,
+  .ra = 180.596,
+  .dec = 4.32969,
+},
+{ .is_ngc = TRUE,
+  .id = 4044,
+  .ra = 180.623,
+  .dec = -0.212639,
+},
+{ .is_ngc = TRUE,
+  .id = 4047,
+  .ra = 180.712,
+  .dec = 48.6361,
+},
+{ .is_ngc = TRUE,
+  .id = 4049,
+  .ra = 180.727,
+  .dec = 18.7524,
+},
+{ .is_ngc = TRUE,
+  .id = 4050,
+  .ra = 180.725,
+  .dec = -16.3742,
+},
+{ .is_ngc = TRUE,
+  .id = 4051,
+  .ra = 180.79,
+  .dec = 44.5314,
+},
+{ .is_ngc = TRUE,
+  .id = 4052,
+  .ra = 180.504,
+  .dec = -63.2175,
+},
+{ .is_ngc = TRUE,
+  .id = 4052,
+  .ra = 180,
+  .dec = -63.2183,
+},
+{ .is_ngc = TRUE,
+  .id = 4053,
+  .ra = 180.798,
+  .dec = 19.7287,
+},
+{ .is_ngc = TRUE,
+  .id = 4056,
+  .ra = 180.99,
+  .dec = 20.3122,
+},
+{ .is_ngc = TRUE,
+  .id = 4058,
+  .ra = 180.954,
+  .dec = 3.54769,
+},
+{ .is_ngc = TRUE,
+  .id = 4060,
+  .ra = 181.004,
+  .dec = 20.3371,
+},
+{ .is_ngc = TRUE,
+  .id = 4062,
+  .ra = 181.016,
+  .dec = 31.8953,
+},
+{ .is_ngc = TRUE,
+  .id = 4063,
+  .ra = 181.025,
+  .dec = 1.84664,
+},
+{ .is_ngc = TRUE,
+  .id = 4064,
+  .ra = 181.046,
+  .dec = 18.4431,
+},
+{ .is_ngc = TRUE,
+  .id = 4066,
+  .ra = 181.039,
+  .dec = 20.3479,
+},
+{ .is_ngc = TRUE,
+  .id = 4067,
+  .ra = 181.048,
+  .dec = 10.8545,
+},
+{ .is_ngc = TRUE,
+  .id = 4069,
+  .ra = 181.026,
+  .dec = 20.3239,
+},
+{ .is_ngc = TRUE,
+  .id = 4071,
+  .ra = 181.064,
+  .dec = -67.3099,
+},
+{ .is_ngc = TRUE,
+  .id = 4072,
+  .ra = 181.058,
+  .dec = 20.2096,
+},
+{ .is_ngc = TRUE,
+  .id = 4073,
+  .ra = 181.113,
+  .dec = 1.89581,
+},
+{ .is_ngc = TRUE,
+  .id = 4074,
+  .ra = 181.124,
+  .dec = 20.3162,
+},
+{ .is_ngc = TRUE,
+  .id = 4075,
+  .ra = 181.158,
+  .dec = 2.07228,
+},
+{ .is_ngc = TRUE,
+  .id = 4076,
+  .ra = 181.136,
+  .dec = 20.2047,
+},
+{ .is_ngc = TRUE,
+  .id = 4079,
+  .ra = 181.208,
+  .dec = -2.38311,
+},
+{ .is_ngc = TRUE,
+  .id = 4080,
+  .ra = 181.216,
+  .dec = 26.9927,
+},
+{ .is_ngc = TRUE,
+  .id = 4081,
+  .ra = 181.14,
+  .dec = 64.437,
+},
+{ .is_ngc = TRUE,
+  .id = 4082,
+  .ra = 181.298,
+  .dec = 10.6705,
+},
+{ .is_ngc = TRUE,
+  .id = 4083,
+  .ra = 181.309,
+  .dec = 10.6131,
+},
+{ .is_ngc = TRUE,
+  .id = 4084,
+  .ra = 181.314,
+  .dec = 21.2143,
+},
+{ .is_ngc = TRUE,
+  .id = 4085,
+  .ra = 181.344,
+  .dec = 50.3533,
+},
+{ .is_ngc = TRUE,
+  .id = 4086,
+  .ra = 181.373,
+  .dec = 20.2468,
+},
+{ .is_ngc = TRUE,
+  .id = 4087,
+  .ra = 181.397,
+  .dec = -26.5219,
+},
+{ .is_ngc = TRUE,
+  .id = 4088,
+  .ra = 181.392,
+  .dec = 50.5396,
+},
+{ .is_ngc = TRUE,
+  .id = 4089,
+  .ra = 181.406,
+  .dec = 20.5557,
+},
+{ .is_ngc = TRUE,
+  .id = 4090,
+  .ra = 181.366,
+  .dec = 20.3086,
+},
+{ .is_ngc = TRUE,
+  .id = 4091,
+  .ra = 181.417,
+  .dec = 20.5556,
+},
+{ .is_ngc = TRUE,
+  .id = 4092,
+  .ra = 181.459,
+  .dec = 20.477,
+},
+{ .is_ngc = TRUE,
+  .id = 4093,
+  .ra = 181.465,
+  .dec = 20.5217,
+},
+{ .is_ngc = TRUE,
+  .id = 4094,
+  .ra = 181.475,
+  .dec = -14.5261,
+},
+{ .is_ngc = TRUE,
+  .id = 4095,
+  .ra = 181.476,
+  .dec = 20.5727,
+},
+{ .is_ngc = TRUE,
+  .id = 4096,
+  .ra = 181.505,
+  .dec = 47.478,
+},
+{ .is_ngc = TRUE,
+  .id = 4097,
+  .ra = 181.51,
+  .dec = 36.8633,
+},
+{ .is_ngc = TRUE,
+  .id = 4100,
+  .ra = 181.535,
+  .dec = 49.5825,
+},
+{ .is_ngc = TRUE,
+  .id = 4101,
+  .ra = 181.544,
+  .dec = 25.5568,
+},
+{ .is_ngc = TRUE,
+  .id = 4102,
+  .ra = 181.597,
+  .dec = 52.711,
+},
+{ .is_ngc = TRUE,
+  .id = 4103,
+  .ra = 181.667,
+  .dec = -61.25,
+},
+{ .is_ngc = TRUE,
+  .id = 4104,
+  .ra = 181.662,
+  .dec = 28.1742,
+},
+{ .is_ngc = TRUE,
+  .id = 4105,
+  .ra = 181.67,
+  .dec = -29.7608,
+},
+{ .is_ngc = TRUE,
+  .id = 4106,
+  .ra = 181.689,
+  .dec = -29.7683,
+},
+{ .is_ngc = TRUE,
+  .id = 4108,
+  .ra = 181.686,
+  .dec = 67.1627,
+},
+{ .is_ngc = TRUE,
+  .id = 4109,
+  .ra = 181.713,
+  .dec = 42.9956,
+},
+{ .is_ngc = TRUE,
+  .id = 4110,
+  .ra = 181.764,
+  .dec = 18.5314,
+},
+{ .is_ngc = TRUE,
+  .id = 4111,
+  .ra = 181.763,
+  .dec = 43.0658,
+},
+{ .is_ngc = TRUE,
+  .id = 4112,
+  .ra = 181.789,
+  .dec = -40.2075,
+},
+{ .is_ngc = TRUE,
+  .id = 4114,
+  .ra = 181.801,
+  .dec = -14.1851,
+},
+{ .is_ngc = TRUE,
+  .id = 4115,
+  .ra = 181.79,
+  .dec = 14.4067,
+},
+{ .is_ngc = TRUE,
+  .id = 4116,
+  .ra = 181.904,
+  .dec = 2.69097,
+},
+{ .is_ngc = TRUE,
+  .id = 4117,
+  .ra = 181.942,
+  .dec = 43.1263,
+},
+{ .is_ngc = TRUE,
+  .id = 4118,
+  .ra = 181.97,
+  .dec = 43.1116,
+},
+{ .is_ngc = TRUE,
+  .id = 4120,
+  .ra = 182.131,
+  .dec = 69.5445,
+},
+{ .is_ngc = TRUE,
+  .id = 4121,
+  .ra = 181.986,
+  .dec = 65.1138,
+},
+{ .is_ngc = TRUE,
+  .id = 4123,
+  .ra = 182.046,
+  .dec = 2.87794,
+},
+{ .is_ngc = TRUE,
+  .id = 4125,
+  .ra = 182.024,
+  .dec = 65.174,
+},
+{ .is_ngc = TRUE,
+  .id = 4126,
+  .ra = 182.156,
+  .dec = 16.1426,
+},
+{ .is_ngc = TRUE,
+  .id = 4127,
+  .ra = 182.11,
+  .dec = 76.8037,
+},
+{ .is_ngc = TRUE,
+  .id = 4128,
+  .ra = 182.136,
+  .dec = 68.7679,
+},
+{ .is_ngc = TRUE,
+  .id = 4131,
+  .ra = 182.198,
+  .dec = 29.3046,
+},
+{ .is_ngc = TRUE,
+  .id = 4132,
+  .ra = 182.256,
+  .dec = 29.2506,
+},
+{ .is_ngc = TRUE,
+  .id = 4133,
+  .ra = 182.208,
+  .dec = 74.9039,
+},
+{ .is_ngc = TRUE,
+  .id = 4134,
+  .ra = 182.292,
+  .dec = 29.1768,
+},
+{ .is_ngc = TRUE,
+  .id = 4135,
+  .ra = 182.288,
+  .dec = 44.0032,
+},
+{ .is_ngc = TRUE,
+  .id = 4136,
+  .ra = 182.324,
+  .dec = 29.9271,
+},
+{ .is_ngc = TRUE,
+  .id = 4137,
+  .ra = 182.323,
+  .dec = 44.09,
+},
+{ .is_ngc = TRUE,
+  .id = 4138,
+  .ra = 182.375,
+  .dec = 43.6852,
+},
+{ .is_ngc = TRUE,
+  .id = 4141,
+  .ra = 182.448,
+  .dec = 58.8488,
+},
+{ .is_ngc = TRUE,
+  .id = 4142,
+  .ra = 182.378,
+  .dec = 53.1037,
+},
+{ .is_ngc = TRUE,
+  .id = 4143,
+  .ra = 182.401,
+  .dec = 42.5344,
+},
+{ .is_ngc = TRUE,
+  .id = 4144,
+  .ra = 182.497,
+  .dec = 46.4569,
+},
+{ .is_ngc = TRUE,
+  .id = 4145,
+  .ra = 182.507,
+  .dec = 39.8825,
+},
+{ .is_ngc = TRUE,
+  .id = 4146,
+  .ra = 182.576,
+  .dec = 26.4308,
+},
+{ .is_ngc = TRUE,
+  .id = 4148,
+  .ra = 182.533,
+  .dec = 35.8777,
+},
+{ .is_ngc = TRUE,
+  .id = 4150,
+  .ra = 182.64,
+  .dec = 30.4017,
+},
+{ .is_ngc = TRUE,
+  .id = 4151,
+  .ra = 182.636,
+  .dec = 39.4058,
+},
+{ .is_ngc = TRUE,
+  .id = 4152,
+  .ra = 182.656,
+  .dec = 16.033,
+},
+{ .is_ngc = TRUE,
+  .id = 4155,
+  .ra = 182.69,
+  .dec = 19.0406,
+},
+{ .is_ngc = TRUE,
+  .id = 4156,
+  .ra = 182.706,
+  .dec = 39.4728,
+},
+{ .is_ngc = TRUE,
+  .id = 4157,
+  .ra = 182.768,
+  .dec = 50.4845,
+},
+{ .is_ngc = TRUE,
+  .id = 4158,
+  .ra = 182.792,
+  .dec = 20.1756,
+},
+{ .is_ngc = TRUE,
+  .id = 4159,
+  .ra = 182.723,
+  .dec = 76.1255,
+},
+{ .is_ngc = TRUE,
+  .id = 4160,
+  .ra = 183.049,
+  .dec = 43.7383,
+},
+{ .is_ngc = TRUE,
+  .id = 4160,
+  .ra = 183.007,
+  .dec = 43.7356,
+},
+{ .is_ngc = TRUE,
+  .id = 4161,
+  .ra = 182.889,
+  .dec = 57.7375,
+},
+{ .is_ngc = TRUE,
+  .id = 4162,
+  .ra = 182.969,
+  .dec = 24.1234,
+},
+{ .is_ngc = TRUE,
+  .id = 4164,
+  .ra = 183.023,
+  .dec = 13.2054,
+},
+{ .is_ngc = TRUE,
+  .id = 4166,
+  .ra = 183.04,
+  .dec = 17.7567,
+},
+{ .is_ngc = TRUE,
+  .id = 4168,
+  .ra = 183.072,
+  .dec = 13.2047,
+},
+{ .is_ngc = TRUE,
+  .id = 4169,
+  .ra = 183.078,
+  .dec = 29.1793,
+},
+{ .is_ngc = TRUE,
+  .id = 4170,
+  .ra = 183.054,
+  .dec = 29.1669,
+},
+{ .is_ngc = TRUE,
+  .id = 4171,
+  .ra = 183.16,
+  .dec = 29.2244,
+},
+{ .is_ngc = TRUE,
+  .id = 4172,
+  .ra = 183.062,
+  .dec = 56.177,
+},
+{ .is_ngc = TRUE,
+  .id = 4173,
+  .ra = 183.089,
+  .dec = 29.2076,
+},
+{ .is_ngc = TRUE,
+  .id = 4174,
+  .ra = 183.112,
+  .dec = 29.1491,
+},
+{ .is_ngc = TRUE,
+  .id = 4175,
+  .ra = 183.129,
+  .dec = 29.1684,
+},
+{ .is_ngc = TRUE,
+  .id = 4176,
+  .ra = 183.153,
+  .dec = -9.16056,
+},
+{ .is_ngc = TRUE,
+  .id = 4177,
+  .ra = 183.171,
+  .dec = -14.0136,
+},
+{ .is_ngc = TRUE,
+  .id = 4179,
+  .ra = 183.218,
+  .dec = 1.29953,
+},
+{ .is_ngc = TRUE,
+  .id = 4181,
+  .ra = 183.204,
+  .dec = 52.9034,
+},
+{ .is_ngc = TRUE,
+  .id = 4182,
+  .ra = 183.333,
+  .dec = 4.03664,
+},
+{ .is_ngc = TRUE,
+  .id = 4183,
+  .ra = 183.321,
+  .dec = 43.6982,
+},
+{ .is_ngc = TRUE,
+  .id = 4184,
+  .ra = 183.39,
+  .dec = -62.7142,
+},
+{ .is_ngc = TRUE,
+  .id = 4188,
+  .ra = 183.531,
+  .dec = -12.5864,
+},
+{ .is_ngc = TRUE,
+  .id = 4191,
+  .ra = 183.46,
+  .dec = 7.20058,
+},
+{ .is_ngc = TRUE,
+  .id = 4192,
+  .ra = 183.451,
+  .dec = 14.9002,
+},
+{ .is_ngc = TRUE,
+  .id = 4194,
+  .ra = 183.54,
+  .dec = 54.5268,
+},
+{ .is_ngc = TRUE,
+  .id = 4195,
+  .ra = 183.576,
+  .dec = 59.6151,
+},
+{ .is_ngc = TRUE,
+  .id = 4196,
+  .ra = 183.624,
+  .dec = 28.4236,
+},
+{ .is_ngc = TRUE,
+  .id = 4197,
+  .ra = 183.66,
+  .dec = 5.80558,
+},
+{ .is_ngc = TRUE,
+  .id = 4200,
+  .ra = 183.684,
+  .dec = 12.1803,
+},
+{ .is_ngc = TRUE,
+  .id = 4201,
+  .ra = 183.675,
+  .dec = -11.5833,
+},
+{ .is_ngc = TRUE,
+  .id = 4202,
+  .ra = 184.536,
+  .dec = -1.06506,
+},
+{ .is_ngc = TRUE,
+  .id = 4203,
+  .ra = 183.771,
+  .dec = 33.1974,
+},
+{ .is_ngc = TRUE,
+  .id = 4204,
+  .ra = 183.81,
+  .dec = 20.6591,
+},
+{ .is_ngc = TRUE,
+  .id = 4205,
+  .ra = 183.731,
+  .dec = 63.7817,
+},
+{ .is_ngc = TRUE,
+  .id = 4207,
+  .ra = 183.876,
+  .dec = 9.58525,
+},
+{ .is_ngc = TRUE,
+  .id = 4209,
+  .ra = 183.858,
+  .dec = 28.4682,
+},
+{ .is_ngc = TRUE,
+  .id = 4210,
+  .ra = 183.817,
+  .dec = 65.9855,
+},
+{ .is_ngc = TRUE,
+  .id = 4213,
+  .ra = 183.907,
+  .dec = 23.9819,
+},
+{ .is_ngc = TRUE,
+  .id = 4215,
+  .ra = 183.977,
+  .dec = 6.40114,
+},
+{ .is_ngc = TRUE,
+  .id = 4215,
+  .ra = 183.978,
+  .dec = 6.30056,
+},
+{ .is_ngc = TRUE,
+  .id = 4216,
+  .ra = 183.976,
+  .dec = 13.1497,
+},
+{ .is_ngc = TRUE,
+  .id = 4217,
+  .ra = 183.961,
+  .dec = 47.0914,
+},
+{ .is_ngc = TRUE,
+  .id = 4218,
+  .ra = 183.943,
+  .dec = 48.1314,
+},
+{ .is_ngc = TRUE,
+  .id = 4219,
+  .ra = 184.115,
+  .dec = -43.3236,
+},
+{ .is_ngc = TRUE,
+  .id = 4220,
+  .ra = 184.049,
+  .dec = 47.8832,
+},
+{ .is_ngc = TRUE,
+  .id = 4221,
+  .ra = 184.001,
+  .dec = 66.231,
+},
+{ .is_ngc = TRUE,
+  .id = 4222,
+  .ra = 184.094,
+  .dec = 13.3073,
+},
+{ .is_ngc = TRUE,
+  .id = 4224,
+  .ra = 184.141,
+  .dec = 7.46172,
+},
+{ .is_ngc = TRUE,
+  .id = 4225,
+  .ra = 184.16,
+  .dec = -12.3277,
+},
+{ .is_ngc = TRUE,
+  .id = 4226,
+  .ra = 184.11,
+  .dec = 47.0258,
+},
+{ .is_ngc = TRUE,
+  .id = 4227,
+  .ra = 184.141,
+  .dec = 33.5217,
+},
+{ .is_ngc = TRUE,
+  .id = 4229,
+  .ra = 184.162,
+  .dec = 33.5607,
+},
+{ .is_ngc = TRUE,
+  .id = 4230,
+  .ra = 184.287,
+  .dec = -55.2839,
+},
+{ .is_ngc = TRUE,
+  .id = 4231,
+  .ra = 184.204,
+  .dec = 47.4572,
+},
+{ .is_ngc = TRUE,
+  .id = 4232,
+  .ra = 184.204,
+  .dec = 47.4385,
+},
+{ .is_ngc = TRUE,
+  .id = 4233,
+  .ra = 184.282,
+  .dec = 7.62397,
+},
+{ .is_ngc = TRUE,
+  .id = 4234,
+  .ra = 184.288,
+  .dec = 3.68303,
+},
+{ .is_ngc = TRUE,
+  .id = 4236,
+  .ra = 184.178,
+  .dec = 69.464,
+},
+{ .is_ngc = TRUE,
+  .id = 4237,
+  .ra = 184.298,
+  .dec = 15.3236,
+},
+{ .is_ngc = TRUE,
+  .id = 4238,
+  .ra = 184.234,
+  .dec = 63.4101,
+},
+{ .is_ngc = TRUE,
+  .id = 4239,
+  .ra = 184.312,
+  .dec = 16.5312,
+},
+{ .is_ngc = TRUE,
+  .id = 4242,
+  .ra = 184.375,
+  .dec = 45.619,
+},
+{ .is_ngc = TRUE,
+  .id = 4244,
+  .ra = 184.374,
+  .dec = 37.8076,
+},
+{ .is_ngc = TRUE,
+  .id = 4245,
+  .ra = 184.404,
+  .dec = 29.6078,
+},
+{ .is_ngc = TRUE,
+  .id = 4247,
+  .ra = 184.492,
+  .dec = 7.27399,
+},
+{ .is_ngc = TRUE,
+  .id = 4248,
+  .ra = 184.46,
+  .dec = 47.409,
+},
+{ .is_ngc = TRUE,
+  .id = 4249,
+  .ra = 184.497,
+  .dec = 5.5985,
+},
+{ .is_ngc = TRUE,
+  .id = 4251,
+  .ra = 184.535,
+  .dec = 28.1749,
+},
+{ .is_ngc = TRUE,
+  .id = 4252,
+  .ra = 184.629,
+  .dec = 5.5595,
+},
+{ .is_ngc = TRUE,
+  .id = 4253,
+  .ra = 184.61,
+  .dec = 29.8127,
+},
+{ .is_ngc = TRUE,
+  .id = 4254,
+  .ra = 184.706,
+  .dec = 14.417,
+},
+{ .is_ngc = TRUE,
+  .id = 4255,
+  .ra = 184.734,
+  .dec = 4.78597,
+},
+{ .is_ngc = TRUE,
+  .id = 4256,
+  .ra = 184.679,
+  .dec = 65.8981,
+},
+{ .is_ngc = TRUE,
+  .id = 4257,
+  .ra = 184.778,
+  .dec = 5.72558,
+},
+{ .is_ngc = TRUE,
+  .id = 4258,
+  .ra = 184.74,
+  .dec = 47.3044,
+},
+{ .is_ngc = TRUE,
+  .id = 4259,
+  .ra = 184.843,
+  .dec = 5.37637,
+},
+{ .is_ngc = TRUE,
+  .id = 4260,
+  .ra = 184.843,
+  .dec = 6.09878,
+},
+{ .is_ngc = TRUE,
+  .id = 4261,
+  .ra = 184.847,
+  .dec = 5.8251,
+},
+{ .is_ngc = TRUE,
+  .id = 4262,
+  .ra = 184.878,
+  .dec = 14.8776,
+},
+{ .is_ngc = TRUE,
+  .id = 4264,
+  .ra = 184.899,
+  .dec = 5.84681,
+},
+{ .is_ngc = TRUE,
+  .id = 4266,
+  .ra = 184.926,
+  .dec = 5.53819,
+},
+{ .is_ngc = TRUE,
+  .id = 4267,
+  .ra = 184.939,
+  .dec = 12.7985,
+},
+{ .is_ngc = TRUE,
+  .id = 4268,
+  .ra = 184.947,
+  .dec = 5.28364,
+},
+{ .is_ngc = TRUE,
+  .id = 4269,
+  .ra = 184.955,
+  .dec = 6.01519,
+},
+{ .is_ngc = TRUE,
+  .id = 4270,
+  .ra = 184.956,
+  .dec = 5.46331,
+},
+{ .is_ngc = TRUE,
+  .id = 4271,
+  .ra = 184.887,
+  .dec = 56.7366,
+},
+{ .is_ngc = TRUE,
+  .id = 4272,
+  .ra = 184.949,
+  .dec = 30.3385,
+},
+{ .is_ngc = TRUE,
+  .id = 4273,
+  .ra = 184.984,
+  .dec = 5.34325,
+},
+{ .is_ngc = TRUE,
+  .id = 4274,
+  .ra = 184.961,
+  .dec = 29.614,
+},
+{ .is_ngc = TRUE,
+  .id = 4275,
+  .ra = 184.969,
+  .dec = 27.6209,
+},
+{ .is_ngc = TRUE,
+  .id = 4276,
+  .ra = 185.031,
+  .dec = 7.69111,
+},
+{ .is_ngc = TRUE,
+  .id = 4277,
+  .ra = 185.016,
+  .dec = 5.34133,
+},
+{ .is_ngc = TRUE,
+  .id = 4278,
+  .ra = 185.029,
+  .dec = 29.2806,
+},
+{ .is_ngc = TRUE,
+  .id = 4279,
+  .ra = 185.104,
+  .dec = -11.6668,
+},
+{ .is_ngc = TRUE,
+  .id = 4280,
+  .ra = 185.104,
+  .dec = -11.6856,
+},
+{ .is_ngc = TRUE,
+  .id = 4280,
+  .ra = 185.129,
+  .dec = -11.6503,
+},
+{ .is_ngc = TRUE,
+  .id = 4281,
+  .ra = 185.09,
+  .dec = 5.38658,
+},
+{ .is_ngc = TRUE,
+  .id = 4282,
+  .ra = 185.101,
+  .dec = 5.57309,
+},
+{ .is_ngc = TRUE,
+  .id = 4283,
+  .ra = 185.087,
+  .dec = 29.3103,
+},
+{ .is_ngc = TRUE,
+  .id = 4284,
+  .ra = 185.052,
+  .dec = 58.0928,
+},
+{ .is_ngc = TRUE,
+  .id = 4285,
+  .ra = 185.166,
+  .dec = -11.6422,
+},
+{ .is_ngc = TRUE,
+  .id = 4287,
+  .ra = 185.202,
+  .dec = 5.64013,
+},
+{ .is_ngc = TRUE,
+  .id = 4288,
+  .ra = 185.159,
+  .dec = 46.2924,
+},
+{ .is_ngc = TRUE,
+  .id = 4289,
+  .ra = 185.26,
+  .dec = 3.72222,
+},
+{ .is_ngc = TRUE,
+  .id = 4290,
+  .ra = 185.199,
+  .dec = 58.0926,
+},
+{ .is_ngc = TRUE,
+  .id = 4291,
+  .ra = 185.075,
+  .dec = 75.3707,
+},
+{ .is_ngc = TRUE,
+  .id = 4292,
+  .ra = 185.319,
+  .dec = 4.59564,
+},
+{ .is_ngc = TRUE,
+  .id = 4293,
+  .ra = 185.303,
+  .dec = 18.3828,
+},
+{ .is_ngc = TRUE,
+  .id = 4294,
+  .ra = 185.324,
+  .dec = 11.5096,
+},
+{ .is_ngc = TRUE,
+  .id = 4295,
+  .ra = 185.291,
+  .dec = 28.165,
+},
+{ .is_ngc = TRUE,
+  .id = 4296,
+  .ra = 185.368,
+  .dec = 6.65358,
+},
+{ .is_ngc = TRUE,
+  .id = 4297,
+  .ra = 185.364,
+  .dec = 6.67104,
+},
+{ .is_ngc = TRUE,
+  .id = 4298,
+  .ra = 185.386,
+  .dec = 14.6065,
+},
+{ .is_ngc = TRUE,
+  .id = 4299,
+  .ra = 185.42,
+  .dec = 11.5012,
+},
+{ .is_ngc = TRUE,
+  .id = 4300,
+  .ra = 185.423,
+  .dec = 5.38483,
+},
+{ .is_ngc = TRUE,
+  .id = 4302,
+  .ra = 185.426,
+  .dec = 14.5986,
+},
+{ .is_ngc = TRUE,
+  .id = 4303,
+  .ra = 185.479,
+  .dec = 4.47301,
+},
+{ .is_ngc = TRUE,
+  .id = 4304,
+  .ra = 185.553,
+  .dec = -33.4844,
+},
+{ .is_ngc = TRUE,
+  .id = 4305,
+  .ra = 185.515,
+  .dec = 12.7407,
+},
+{ .is_ngc = TRUE,
+  .id = 4306,
+  .ra = 185.517,
+  .dec = 12.7872,
+},
+{ .is_ngc = TRUE,
+  .id = 4307,
+  .ra = 185.523,
+  .dec = 9.04381,
+},
+{ .is_ngc = TRUE,
+  .id = 4308,
+  .ra = 185.487,
+  .dec = 30.0742,
+},
+{ .is_ngc = TRUE,
+  .id = 4309,
+  .ra = 185.552,
+  .dec = 7.14421,
+},
+{ .is_ngc = TRUE,
+  .id = 4311,
+  .ra = 185.608,
+  .dec = 29.2008,
+},
+{ .is_ngc = TRUE,
+  .id = 4312,
+  .ra = 185.631,
+  .dec = 15.538,
+},
+{ .is_ngc = TRUE,
+  .id = 4313,
+  .ra = 185.661,
+  .dec = 11.801,
+},
+{ .is_ngc = TRUE,
+  .id = 4314,
+  .ra = 185.633,
+  .dec = 29.8954,
+},
+{ .is_ngc = TRUE,
+  .id = 4315,
+  .ra = 185.689,
+  .dec = 9.3055,
+},
+{ .is_ngc = TRUE,
+  .id = 4315,
+  .ra = 185.665,
+  .dec = 9.28619,
+},
+{ .is_ngc = TRUE,
+  .id = 4316,
+  .ra = 185.677,
+  .dec = 9.33233,
+},
+{ .is_ngc = TRUE,
+  .id = 4317,
+  .ra = 185.671,
+  .dec = 31.0342,
+},
+{ .is_ngc = TRUE,
+  .id = 4318,
+  .ra = 185.68,
+  .dec = 8.19825,
+},
+{ .is_ngc = TRUE,
+  .id = 4320,
+  .ra = 185.741,
+  .dec = 10.5482,
+},
+{ .is_ngc = TRUE,
+  .id = 4321,
+  .ra = 185.729,
+  .dec = 15.8226,
+},
+{ .is_ngc = TRUE,
+  .id = 4322,
+  .ra = 185.675,
+  .dec = 15.9035,
+},
+{ .is_ngc = TRUE,
+  .id = 4323,
+  .ra = 185.757,
+  .dec = 15.9053,
+},
+{ .is_ngc = TRUE,
+  .id = 4324,
+  .ra = 185.775,
+  .dec = 5.24981,
+},
+{ .is_ngc = TRUE,
+  .id = 4326,
+  .ra = 185.799,
+  .dec = 6.07228,
+},
+{ .is_ngc = TRUE,
+  .id = 4327,
+  .ra = 185.781,
+  .dec = 15.7365,
+},
+{ .is_ngc = TRUE,
+  .id = 4328,
+  .ra = 185.833,
+  .dec = 15.8201,
+},
+{ .is_ngc = TRUE,
+  .id = 4329,
+  .ra = 185.837,
+  .dec = -12.5592,
+},
+{ .is_ngc = TRUE,
+  .id = 4330,
+  .ra = 185.82,
+  .dec = 11.3679,
+},
+{ .is_ngc = TRUE,
+  .id = 4331,
+  .ra = 185.65,
+  .dec = 76.1724,
+},
+{ .is_ngc = TRUE,
+  .id = 4332,
+  .ra = 185.695,
+  .dec = 65.8436,
+},
+{ .is_ngc = TRUE,
+  .id = 4333,
+  .ra = 185.843,
+  .dec = 6.04064,
+},
+{ .is_ngc = TRUE,
+  .id = 4334,
+  .ra = 185.85,
+  .dec = 7.47311,
+},
+{ .is_ngc = TRUE,
+  .id = 4335,
+  .ra = 185.758,
+  .dec = 58.4443,
+},
+{ .is_ngc = TRUE,
+  .id = 4337,
+  .ra = 186.017,
+  .dec = -58.1178,
+},
+{ .is_ngc = TRUE,
+  .id = 4339,
+  .ra = 185.895,
+  .dec = 6.08169,
+},
+{ .is_ngc = TRUE,
+  .id = 4340,
+  .ra = 185.897,
+  .dec = 16.7229,
+},
+{ .is_ngc = TRUE,
+  .id = 4343,
+  .ra = 185.912,
+  .dec = 6.95453,
+},
+{ .is_ngc = TRUE,
+  .id = 4344,
+  .ra = 185.907,
+  .dec = 17.541,
+},
+{ .is_ngc = TRUE,
+  .id = 4346,
+  .ra = 185.867,
+  .dec = 46.9936,
+},
+{ .is_ngc = TRUE,
+  .id = 4347,
+  .ra = 185.969,
+  .dec = -3.24017,
+},
+{ .is_ngc = TRUE,
+  .id = 4349,
+  .ra = 186.033,
+  .dec = -61.8675,
+},
+{ .is_ngc = TRUE,
+  .id = 4350,
+  .ra = 185.991,
+  .dec = 16.6933,
+},
+{ .is_ngc = TRUE,
+  .id = 4352,
+  .ra = 186.021,
+  .dec = 11.218,
+},
+{ .is_ngc = TRUE,
+  .id = 4358,
+  .ra = 186.009,
+  .dec = 58.385,
+},
+{ .is_ngc = TRUE,
+  .id = 4359,
+  .ra = 186.049,
+  .dec = 31.5215,
+},
+{ .is_ngc = TRUE,
+  .id = 4361,
+  .ra = 186.129,
+  .dec = -18.785,
+},
+{ .is_ngc = TRUE,
+  .id = 4363,
+  .ra = 185.87,
+  .dec = 74.9517,
+},
+{ .is_ngc = TRUE,
+  .id = 4365,
+  .ra = 186.118,
+  .dec = 7.31756,
+},
+{ .is_ngc = TRUE,
+  .id = 4366,
+  .ra = 186.196,
+  .dec = 7.35267,
+},
+{ .is_ngc = TRUE,
+  .id = 4367,
+  .ra = 186.147,
+  .dec = 12.1824,
+},
+{ .is_ngc = TRUE,
+  .id = 4369,
+  .ra = 186.151,
+  .dec = 39.383,
+},
+{ .is_ngc = TRUE,
+  .id = 4370,
+  .ra = 186.229,
+  .dec = 7.44417,
+},
+{ .is_ngc = TRUE,
+  .id = 4371,
+  .ra = 186.231,
+  .dec = 11.7038,
+},
+{ .is_ngc = TRUE,
+  .id = 4372,
+  .ra = 186.44,
+  .dec = -72.6579,
+},
+{ .is_ngc = TRUE,
+  .id = 4373,
+  .ra = 186.325,
+  .dec = -39.7606,
+},
+{ .is_ngc = TRUE,
+  .id = 4374,
+  .ra = 186.265,
+  .dec = 12.8868,
+},
+{ .is_ngc = TRUE,
+  .id = 4375,
+  .ra = 186.252,
+  .dec = 28.5583,
+},
+{ .is_ngc = TRUE,
+  .id = 4376,
+  .ra = 186.326,
+  .dec = 5.74111,
+},
+{ .is_ngc = TRUE,
+  .id = 4377,
+  .ra = 186.302,
+  .dec = 14.7626,
+},
+{ .is_ngc = TRUE,
+  .id = 4378,
+  .ra = 186.325,
+  .dec = 4.925,
+},
+{ .is_ngc = TRUE,
+  .id = 4379,
+  .ra = 186.312,
+  .dec = 15.6072,
+},
+{ .is_ngc = TRUE,
+  .id = 4380,
+  .ra = 186.342,
+  .dec = 10.0163,
+},
+{ .is_ngc = TRUE,
+  .id = 4382,
+  .ra = 186.351,
+  .dec = 18.1908,
+},
+{ .is_ngc = TRUE,
+  .id = 4383,
+  .ra = 186.356,
+  .dec = 16.4699,
+},
+{ .is_ngc = TRUE,
+  .id = 4384,
+  .ra = 186.3,
+  .dec = 54.5057,
+},
+{ .is_ngc = TRUE,
+  .id = 4385,
+  .ra = 186.428,
+  .dec = 0.572528,
+},
+{ .is_ngc = TRUE,
+  .id = 4386,
+  .ra = 186.118,
+  .dec = 75.529,
+},
+{ .is_ngc = TRUE,
+  .id = 4387,
+  .ra = 186.424,
+  .dec = 12.8103,
+},
+{ .is_ngc = TRUE,
+  .id = 4388,
+  .ra = 186.445,
+  .dec = 12.6617,
+},
+{ .is_ngc = TRUE,
+  .id = 4389,
+  .ra = 186.396,
+  .dec = 45.6847,
+},
+{ .is_ngc = TRUE,
+  .id = 4391,
+  .ra = 186.329,
+  .dec = 64.9336,
+},
+{ .is_ngc = TRUE,
+  .id = 4392,
+  .ra = 186.328,
+  .dec = 45.8471,
+},
+{ .is_ngc = TRUE,
+  .id = 4393,
+  .ra = 186.464,
+  .dec = 27.5613,
+},
+{ .is_ngc = TRUE,
+  .id = 4394,
+  .ra = 186.482,
+  .dec = 18.2139,
+},
+{ .is_ngc = TRUE,
+  .id = 4395,
+  .ra = 186.454,
+  .dec = 33.5471,
+},
+{ .is_ngc = TRUE,
+  .id = 4396,
+  .ra = 186.497,
+  .dec = 15.6708,
+},
+{ .is_ngc = TRUE,
+  .id = 4397,
+  .ra = 186.493,
+  .dec = 18.3008,
+},
+{ .is_ngc = TRUE,
+  .id = 4398,
+  .ra = 186.531,
+  .dec = 10.6859,
+},
+{ .is_ngc = TRUE,
+  .id = 4399,
+  .ra = 186.429,
+  .dec = 33.5161,
+},
+{ .is_ngc = TRUE,
+  .id = 4400,
+  .ra = 186.483,
+  .dec = 33.5148,
+},
+{ .is_ngc = TRUE,
+  .id = 4401,
+  .ra = 186.491,
+  .dec = 33.5276,
+},
+{ .is_ngc = TRUE,
+  .id = 4402,
+  .ra = 186.532,
+  .dec = 13.1126,
+},
+{ .is_ngc = TRUE,
+  .id = 4403,
+  .ra = 186.553,
+  .dec = -7.68472,
+},
+{ .is_ngc = TRUE,
+  .id = 4404,
+  .ra = 186.568,
+  .dec = -7.68054,
+},
+{ .is_ngc = TRUE,
+  .id = 4406,
+  .ra = 186.549,
+  .dec = 12.9462,
+},
+{ .is_ngc = TRUE,
+  .id = 4408,
+  .ra = 186.572,
+  .dec = 27.8711,
+},
+{ .is_ngc = TRUE,
+  .id = 4412,
+  .ra = 186.65,
+  .dec = 3.96472,
+},
+{ .is_ngc = TRUE,
+  .id = 4414,
+  .ra = 186.613,
+  .dec = 31.2228,
+},
+{ .is_ngc = TRUE,
+  .id = 4415,
+  .ra = 186.669,
+  .dec = 8.43556,
+},
+{ .is_ngc = TRUE,
+  .id = 4416,
+  .ra = 186.695,
+  .dec = 7.91889,
+},
+{ .is_ngc = TRUE,
+  .id = 4417,
+  .ra = 186.711,
+  .dec = 9.58392,
+},
+{ .is_ngc = TRUE,
+  .id = 4419,
+  .ra = 186.736,
+  .dec = 15.0471,
+},
+{ .is_ngc = TRUE,
+  .id = 4421,
+  .ra = 186.761,
+  .dec = 15.4613,
+},
+{ .is_ngc = TRUE,
+  .id = 4422,
+  .ra = 186.801,
+  .dec = -5.83104,
+},
+{ .is_ngc = TRUE,
+  .id = 4423,
+  .ra = 186.788,
+  .dec = 5.87981,
+},
+{ .is_ngc = TRUE,
+  .id = 4424,
+  .ra = 186.799,
+  .dec = 9.42031,
+},
+{ .is_ngc = TRUE,
+  .id = 4425,
+  .ra = 186.806,
+  .dec = 12.7348,
+},
+{ .is_ngc = TRUE,
+  .id = 4428,
+  .ra = 186.868,
+  .dec = -8.16803,
+},
+{ .is_ngc = TRUE,
+  .id = 4429,
+  .ra = 186.861,
+  .dec = 11.1075,
+},
+{ .is_ngc = TRUE,
+  .id = 4430,
+  .ra = 186.859,
+  .dec = 6.26247,
+},
+{ .is_ngc = TRUE,
+  .id = 4431,
+  .ra = 186.864,
+  .dec = 12.2903,
+},
+{ .is_ngc = TRUE,
+  .id = 4432,
+  .ra = 186.887,
+  .dec = 6.23286,
+},
+{ .is_ngc = TRUE,
+  .id = 4433,
+  .ra = 186.911,
+  .dec = -8.27947,
+},
+{ .is_ngc = TRUE,
+  .id = 4434,
+  .ra = 186.903,
+  .dec = 8.15433,
+},
+{ .is_ngc = TRUE,
+  .id = 4435,
+  .ra = 186.919,
+  .dec = 13.0792,
+},
+{ .is_ngc = TRUE,
+  .id = 4436,
+  .ra = 186.922,
+  .dec = 12.3158,
+},
+{ .is_ngc = TRUE,
+  .id = 4438,
+  .ra = 186.94,
+  .dec = 13.0089,
+},
+{ .is_ngc = TRUE,
+  .id = 4439,
+  .ra = 187.113,
+  .dec = -60.1008,
+},
+{ .is_ngc = TRUE,
+  .id = 4440,
+  .ra = 186.973,
+  .dec = 12.2931,
+},
+{ .is_ngc = TRUE,
+  .id = 4441,
+  .ra = 186.836,
+  .dec = 64.8015,
+},
+{ .is_ngc = TRUE,
+  .id = 4442,
+  .ra = 187.016,
+  .dec = 9.80389,
+},
+{ .is_ngc = TRUE,
+  .id = 4444,
+  .ra = 187.15,
+  .dec = -43.2619,
+},
+{ .is_ngc = TRUE,
+  .id = 4446,
+  .ra = 187.029,
+  .dec = 13.9117,
+},
+{ .is_ngc = TRUE,
+  .id = 4447,
+  .ra = 187.052,
+  .dec = 13.8991,
+},
+{ .is_ngc = TRUE,
+  .id = 4448,
+  .ra = 187.064,
+  .dec = 28.6205,
+},
+{ .is_ngc = TRUE,
+  .id = 4449,
+  .ra = 187.047,
+  .dec = 44.0937,
+},
+{ .is_ngc = TRUE,
+  .id = 4450,
+  .ra = 187.123,
+  .dec = 17.0849,
+},
+{ .is_ngc = TRUE,
+  .id = 4451,
+  .ra = 187.169,
+  .dec = 9.25878,
+},
+{ .is_ngc = TRUE,
+  .id = 4452,
+  .ra = 187.181,
+  .dec = 11.7549,
+},
+{ .is_ngc = TRUE,
+  .id = 4453,
+  .ra = 187.195,
+  .dec = 6.51174,
+},
+{ .is_ngc = TRUE,
+  .id = 4454,
+  .ra = 187.212,
+  .dec = -1.93994,
+},
+{ .is_ngc = TRUE,
+  .id = 4455,
+  .ra = 187.184,
+  .dec = 22.8219,
+},
+{ .is_ngc = TRUE,
+  .id = 4456,
+  .ra = 186.968,
+  .dec = -30.0981,
+},
+{ .is_ngc = TRUE,
+  .id = 4457,
+  .ra = 187.246,
+  .dec = 3.57058,
+},
+{ .is_ngc = TRUE,
+  .id = 4458,
+  .ra = 187.24,
+  .dec = 13.2419,
+},
+{ .is_ngc = TRUE,
+  .id = 4459,
+  .ra = 187.25,
+  .dec = 13.9785,
+},
+{ .is_ngc = TRUE,
+  .id = 4460,
+  .ra = 187.191,
+  .dec = 44.8635,
+},
+{ .is_ngc = TRUE,
+  .id = 4462,
+  .ra = 187.338,
+  .dec = -23.1664,
+},
+{ .is_ngc = TRUE,
+  .id = 4463,
+  .ra = 187.483,
+  .dec = -64.7844,
+},
+{ .is_ngc = TRUE,
+  .id = 4464,
+  .ra = 187.339,
+  .dec = 8.15667,
+},
+{ .is_ngc = TRUE,
+  .id = 4465,
+  .ra = 187.348,
+  .dec = 8.02611,
+},
+{ .is_ngc = TRUE,
+  .id = 4466,
+  .ra = 187.378,
+  .dec = 7.69639,
+},
+{ .is_ngc = TRUE,
+  .id = 4467,
+  .ra = 187.376,
+  .dec = 7.99289,
+},
+{ .is_ngc = TRUE,
+  .id = 4468,
+  .ra = 187.379,
+  .dec = 14.049,
+},
+{ .is_ngc = TRUE,
+  .id = 4469,
+  .ra = 187.367,
+  .dec = 8.75014,
+},
+{ .is_ngc = TRUE,
+  .id = 4471,
+  .ra = 187.425,
+  .dec = 7.89617,
+},
+{ .is_ngc = TRUE,
+  .id = 4471,
+  .ra = 187.419,
+  .dec = 7.91156,
+},
+{ .is_ngc = TRUE,
+  .id = 4472,
+  .ra = 187.445,
+  .dec = 8.00028,
+},
+{ .is_ngc = TRUE,
+  .id = 4473,
+  .ra = 187.454,
+  .dec = 13.4296,
+},
+{ .is_ngc = TRUE,
+  .id = 4474,
+  .ra = 187.473,
+  .dec = 14.0684,
+},
+{ .is_ngc = TRUE,
+  .id = 4475,
+  .ra = 187.448,
+  .dec = 27.2432,
+},
+{ .is_ngc = TRUE,
+  .id = 4476,
+  .ra = 187.496,
+  .dec = 12.3484,
+},
+{ .is_ngc = TRUE,
+  .id = 4477,
+  .ra = 187.509,
+  .dec = 13.6364,
+},
+{ .is_ngc = TRUE,
+  .id = 4478,
+  .ra = 187.573,
+  .dec = 12.3284,
+},
+{ .is_ngc = TRUE,
+  .id = 4479,
+  .ra = 187.577,
+  .dec = 13.5776,
+},
+{ .is_ngc = TRUE,
+  .id = 4480,
+  .ra = 187.611,
+  .dec = 4.24644,
+},
+{ .is_ngc = TRUE,
+  .id = 4481,
+  .ra = 187.453,
+  .dec = 64.0329,
+},
+{ .is_ngc = TRUE,
+  .id = 4483,
+  .ra = 187.669,
+  .dec = 9.01531,
+},
+{ .is_ngc = TRUE,
+  .id = 4484,
+  .ra = 187.22,
+  .dec = -11.6519,
+},
+{ .is_ngc = TRUE,
+  .id = 4485,
+  .ra = 187.631,
+  .dec = 41.6997,
+},
+{ .is_ngc = TRUE,
+  .id = 4486,
+  .ra = 187.706,
+  .dec = 12.3908,
+},
+{ .is_ngc = TRUE,
+  .id = 4487,
+  .ra = 187.768,
+  .dec = -8.05389,
+},
+{ .is_ngc = TRUE,
+  .id = 4488,
+  .ra = 187.714,
+  .dec = 8.36006,
+},
+{ .is_ngc = TRUE,
+  .id = 4489,
+  .ra = 187.718,
+  .dec = 16.7584,
+},
+{ .is_ngc = TRUE,
+  .id = 4490,
+  .ra = 187.652,
+  .dec = 41.6421,
+},
+{ .is_ngc = TRUE,
+  .id = 4491,
+  .ra = 187.738,
+  .dec = 11.4829,
+},
+{ .is_ngc = TRUE,
+  .id = 4493,
+  .ra = 187.785,
+  .dec = 0.613481,
+},
+{ .is_ngc = TRUE,
+  .id = 4494,
+  .ra = 187.851,
+  .dec = 25.7747,
+},
+{ .is_ngc = TRUE,
+  .id = 4494,
+  .ra = 187.845,
+  .dec = 25.7775,
+},
+{ .is_ngc = TRUE,
+  .id = 4495,
+  .ra = 187.846,
+  .dec = 29.1363,
+},
+{ .is_ngc = TRUE,
+  .id = 4498,
+  .ra = 187.915,
+  .dec = 16.8528,
+},
+{ .is_ngc = TRUE,
+  .id = 4499,
+  .ra = 188.021,
+  .dec = -39.9825,
+},
+{ .is_ngc = TRUE,
+  .id = 4500,
+  .ra = 187.842,
+  .dec = 57.9643,
+},
+{ .is_ngc = TRUE,
+  .id = 4501,
+  .ra = 187.997,
+  .dec = 14.4201,
+},
+{ .is_ngc = TRUE,
+  .id = 4502,
+  .ra = 188.013,
+  .dec = 16.6875,
+},
+{ .is_ngc = TRUE,
+  .id = 4503,
+  .ra = 188.026,
+  .dec = 11.1765,
+},
+{ .is_ngc = TRUE,
+  .id = 4504,
+  .ra = 188.072,
+  .dec = -7.56425,
+},
+{ .is_ngc = TRUE,
+  .id = 4506,
+  .ra = 188.044,
+  .dec = 13.4197,
+},
+{ .is_ngc = TRUE,
+  .id = 4507,
+  .ra = 188.903,
+  .dec = -39.9092,
+},
+{ .is_ngc = TRUE,
+  .id = 4508,
+  .ra = 188.073,
+  .dec = 5.81944,
+},
+{ .is_ngc = TRUE,
+  .id = 4509,
+  .ra = 188.278,
+  .dec = 32.0918,
+},
+{ .is_ngc = TRUE,
+  .id = 4510,
+  .ra = 187.948,
+  .dec = 64.2336,
+},
+{ .is_ngc = TRUE,
+  .id = 4511,
+  .ra = 188.034,
+  .dec = 56.4709,
+},
+{ .is_ngc = TRUE,
+  .id = 4513,
+  .ra = 188.006,
+  .dec = 66.3324,
+},
+{ .is_ngc = TRUE,
+  .id = 4514,
+  .ra = 188.179,
+  .dec = 29.7122,
+},
+{ .is_ngc = TRUE,
+  .id = 4515,
+  .ra = 188.27,
+  .dec = 16.2654,
+},
+{ .is_ngc = TRUE,
+  .id = 4516,
+  .ra = 188.282,
+  .dec = 14.5748,
+},
+{ .is_ngc = TRUE,
+  .id = 4519,
+  .ra = 188.376,
+  .dec = 8.65442,
+},
+{ .is_ngc = TRUE,
+  .id = 4522,
+  .ra = 188.416,
+  .dec = 9.17422,
+},
+{ .is_ngc = TRUE,
+  .id = 4523,
+  .ra = 188.45,
+  .dec = 15.1679,
+},
+{ .is_ngc = TRUE,
+  .id = 4524,
+  .ra = 188.477,
+  .dec = -12.0275,
+},
+{ .is_ngc = TRUE,
+  .id = 4525,
+  .ra = 188.464,
+  .dec = 30.2778,
+},
+{ .is_ngc = TRUE,
+  .id = 4527,
+  .ra = 188.535,
+  .dec = 2.65314,
+},
+{ .is_ngc = TRUE,
+  .id = 4528,
+  .ra = 188.526,
+  .dec = 11.3211,
+},
+{ .is_ngc = TRUE,
+  .id = 4529,
+  .ra = 188.215,
+  .dec = 20.1833,
+},
+{ .is_ngc = TRUE,
+  .id = 4530,
+  .ra = 188.449,
+  .dec = 41.3534,
+},
+{ .is_ngc = TRUE,
+  .id = 4531,
+  .ra = 188.566,
+  .dec = 13.0754,
+},
+{ .is_ngc = TRUE,
+  .id = 4532,
+  .ra = 188.581,
+  .dec = 6.46906,
+},
+{ .is_ngc = TRUE,
+  .id = 4533,
+  .ra = 188.592,
+  .dec = 2.32558,
+},
+{ .is_ngc = TRUE,
+  .id = 4534,
+  .ra = 188.523,
+  .dec = 35.5184,
+},
+{ .is_ngc = TRUE,
+  .id = 4535,
+  .ra = 188.584,
+  .dec = 8.19781,
+},
+{ .is_ngc = TRUE,
+  .id = 4536,
+  .ra = 188.613,
+  .dec = 2.18761,
+},
+{ .is_ngc = TRUE,
+  .id = 4538,
+  .ra = 188.67,
+  .dec = 3.32342,
+},
+{ .is_ngc = TRUE,
+  .id = 4539,
+  .ra = 188.645,
+  .dec = 18.2025,
+},
+{ .is_ngc = TRUE,
+  .id = 4540,
+  .ra = 188.712,
+  .dec = 15.551,
+},
+{ .is_ngc = TRUE,
+  .id = 4541,
+  .ra = 188.794,
+  .dec = -0.2215,
+},
+{ .is_ngc = TRUE,
+  .id = 4543,
+  .ra = 188.834,
+  .dec = 6.11498,
+},
+{ .is_ngc = TRUE,
+  .id = 4544,
+  .ra = 188.903,
+  .dec = 3.03461,
+},
+{ .is_ngc = TRUE,
+  .id = 4545,
+  .ra = 188.642,
+  .dec = 63.5248,
+},
+{ .is_ngc = TRUE,
+  .id = 4546,
+  .ra = 188.873,
+  .dec = -3.79306,
+},
+{ .is_ngc = TRUE,
+  .id = 4547,
+  .ra = 188.716,
+  .dec = 58.9165,
+},
+{ .is_ngc = TRUE,
+  .id = 4548,
+  .ra = 188.861,
+  .dec = 14.4964,
+},
+{ .is_ngc = TRUE,
+  .id = 4549,
+  .ra = 188.838,
+  .dec = 58.9496,
+},
+{ .is_ngc = TRUE,
+  .id = 4550,
+  .ra = 188.878,
+  .dec = 12.2206,
+},
+{ .is_ngc = TRUE,
+  .id = 4551,
+  .ra = 188.908,
+  .dec = 12.264,
+},
+{ .is_ngc = TRUE,
+  .id = 4552,
+  .ra = 188.916,
+  .dec = 12.5563,
+},
+{ .is_ngc = TRUE,
+  .id = 4553,
+  .ra = 189.032,
+  .dec = -39.4389,
+},
+{ .is_ngc = TRUE,
+  .id = 4556,
+  .ra = 188.941,
+  .dec = 26.9086,
+},
+{ .is_ngc = TRUE,
+  .id = 4557,
+  .ra = 188.959,
+  .dec = 27.0535,
+},
+{ .is_ngc = TRUE,
+  .id = 4558,
+  .ra = 188.97,
+  .dec = 26.9918,
+},
+{ .is_ngc = TRUE,
+  .id = 4559,
+  .ra = 188.991,
+  .dec = 27.9597,
+},
+{ .is_ngc = TRUE,
+  .id = 4563,
+  .ra = 189.053,
+  .dec = 26.941,
+},
+{ .is_ngc = TRUE,
+  .id = 4564,
+  .ra = 189.112,
+  .dec = 11.4392,
+},
+{ .is_ngc = TRUE,
+  .id = 4565,
+  .ra = 189.086,
+  .dec = 25.9877,
+},
+{ .is_ngc = TRUE,
+  .id = 4566,
+  .ra = 189.001,
+  .dec = 54.2204,
+},
+{ .is_ngc = TRUE,
+  .id = 4567,
+  .ra = 189.136,
+  .dec = 11.2579,
+},
+{ .is_ngc = TRUE,
+  .id = 4568,
+  .ra = 189.143,
+  .dec = 11.2382,
+},
+{ .is_ngc = TRUE,
+  .id = 4569,
+  .ra = 189.208,
+  .dec = 13.1632,
+},
+{ .is_ngc = TRUE,
+  .id = 4570,
+  .ra = 189.222,
+  .dec = 7.24672,
+},
+{ .is_ngc = TRUE,
+  .id = 4572,
+  .ra = 188.941,
+  .dec = 74.2457,
+},
+{ .is_ngc = TRUE,
+  .id = 4573,
+  .ra = 189.432,
+  .dec = -43.6208,
+},
+{ .is_ngc = TRUE,
+  .id = 4574,
+  .ra = 189.431,
+  .dec = -35.5172,
+},
+{ .is_ngc = TRUE,
+  .id = 4575,
+  .ra = 189.465,
+  .dec = -40.5372,
+},
+{ .is_ngc = TRUE,
+  .id = 4576,
+  .ra = 189.39,
+  .dec = 4.36753,
+},
+{ .is_ngc = TRUE,
+  .id = 4578,
+  .ra = 189.378,
+  .dec = 9.55492,
+},
+{ .is_ngc = TRUE,
+  .id = 4579,
+  .ra = 189.432,
+  .dec = 11.8183,
+},
+{ .is_ngc = TRUE,
+  .id = 4580,
+  .ra = 189.452,
+  .dec = 5.36833,
+},
+{ .is_ngc = TRUE,
+  .id = 4581,
+  .ra = 189.522,
+  .dec = 1.47772,
+},
+{ .is_ngc = TRUE,
+  .id = 4582,
+  .ra = 189.542,
+  .dec = 0.182667,
+},
+{ .is_ngc = TRUE,
+  .id = 4583,
+  .ra = 189.519,
+  .dec = 33.4585,
+},
+{ .is_ngc = TRUE,
+  .id = 4584,
+  .ra = 189.574,
+  .dec = 13.1098,
+},
+{ .is_ngc = TRUE,
+  .id = 4585,
+  .ra = 189.555,
+  .dec = 28.9369,
+},
+{ .is_ngc = TRUE,
+  .id = 4586,
+  .ra = 189.618,
+  .dec = 4.31867,
+},
+{ .is_ngc = TRUE,
+  .id = 4587,
+  .ra = 189.647,
+  .dec = 2.65728,
+},
+{ .is_ngc = TRUE,
+  .id = 4588,
+  .ra = 189.689,
+  .dec = 6.76769,
+},
+{ .is_ngc = TRUE,
+  .id = 4589,
+  .ra = 189.353,
+  .dec = 74.1918,
+},
+{ .is_ngc = TRUE,
+  .id = 4590,
+  .ra = 189.867,
+  .dec = -26.7421,
+},
+{ .is_ngc = TRUE,
+  .id = 4592,
+  .ra = 189.828,
+  .dec = -0.531639,
+},
+{ .is_ngc = TRUE,
+  .id = 4593,
+  .ra = 189.914,
+  .dec = -5.34447,
+},
+{ .is_ngc = TRUE,
+  .id = 4594,
+  .ra = 189.998,
+  .dec = -11.623,
+},
+{ .is_ngc = TRUE,
+  .id = 4595,
+  .ra = 189.966,
+  .dec = 15.2979,
+},
+{ .is_ngc = TRUE,
+  .id = 4596,
+  .ra = 189.984,
+  .dec = 10.176,
+},
+{ .is_ngc = TRUE,
+  .id = 4597,
+  .ra = 190.054,
+  .dec = -5.79944,
+},
+{ .is_ngc = TRUE,
+  .id = 4598,
+  .ra = 190.05,
+  .dec = 8.3835,
+},
+{ .is_ngc = TRUE,
+  .id = 4599,
+  .ra = 190.113,
+  .dec = 1.19636,
+},
+{ .is_ngc = TRUE,
+  .id = 4600,
+  .ra = 190.096,
+  .dec = 3.11739,
+},
+{ .is_ngc = TRUE,
+  .id = 4601,
+  .ra = 190.195,
+  .dec = -40.8931,
+},
+{ .is_ngc = TRUE,
+  .id = 4602,
+  .ra = 190.153,
+  .dec = -5.13222,
+},
+{ .is_ngc = TRUE,
+  .id = 4603,
+  .ra = 190.23,
+  .dec = -40.976,
+},
+{ .is_ngc = TRUE,
+  .id = 4604,
+  .ra = 190.188,
+  .dec = -5.30306,
+},
+{ .is_ngc = TRUE,
+  .id = 4605,
+  .ra = 190,
+  .dec = 61.6085,
+},
+{ .is_ngc = TRUE,
+  .id = 4606,
+  .ra = 190.24,
+  .dec = 11.9116,
+},
+{ .is_ngc = TRUE,
+  .id = 4607,
+  .ra = 190.301,
+  .dec = 11.8855,
+},
+{ .is_ngc = TRUE,
+  .id = 4608,
+  .ra = 190.306,
+  .dec = 10.1554,
+},
+{ .is_ngc = TRUE,
+  .id = 4609,
+  .ra = 190.575,
+  .dec = -62.9853,
+},
+{ .is_ngc = TRUE,
+  .id = 4612,
+  .ra = 190.387,
+  .dec = 7.31456,
+},
+{ .is_ngc = TRUE,
+  .id = 4613,
+  .ra = 190.371,
+  .dec = 26.0882,
+},
+{ .is_ngc = TRUE,
+  .id = 4614,
+  .ra = 190.381,
+  .dec = 26.0425,
+},
+{ .is_ngc = TRUE,
+  .id = 4615,
+  .ra = 190.406,
+  .dec = 26.0727,
+},
+{ .is_ngc = TRUE,
+  .id = 4616,
+  .ra = 190.569,
+  .dec = -40.6419,
+},
+{ .is_ngc = TRUE,
+  .id = 4617,
+  .ra = 190.275,
+  .dec = 50.393,
+},
+{ .is_ngc = TRUE,
+  .id = 4619,
+  .ra = 190.435,
+  .dec = 35.0626,
+},
+{ .is_ngc = TRUE,
+  .id = 4620,
+  .ra = 190.497,
+  .dec = 12.9429,
+},
+{ .is_ngc = TRUE,
+  .id = 4621,
+  .ra = 190.51,
+  .dec = 11.6466,
+},
+{ .is_ngc = TRUE,
+  .id = 4622,
+  .ra = 190.657,
+  .dec = -40.7442,
+},
+{ .is_ngc = TRUE,
+  .id = 4623,
+  .ra = 190.544,
+  .dec = 7.67675,
+},
+{ .is_ngc = TRUE,
+  .id = 4626,
+  .ra = 190.606,
+  .dec = -7.04456,
+},
+{ .is_ngc = TRUE,
+  .id = 4627,
+  .ra = 190.499,
+  .dec = 32.5737,
+},
+{ .is_ngc = TRUE,
+  .id = 4628,
+  .ra = 190.605,
+  .dec = -6.97111,
+},
+{ .is_ngc = TRUE,
+  .id = 4629,
+  .ra = 190.637,
+  .dec = -1.35092,
+},
+{ .is_ngc = TRUE,
+  .id = 4630,
+  .ra = 190.63,
+  .dec = 3.95867,
+},
+{ .is_ngc = TRUE,
+  .id = 4631,
+  .ra = 190.533,
+  .dec = 32.5414,
+},
+{ .is_ngc = TRUE,
+  .id = 4632,
+  .ra = 190.634,
+  .dec = -0.0816944,
+},
+{ .is_ngc = TRUE,
+  .id = 4634,
+  .ra = 190.67,
+  .dec = 14.2961,
+},
+{ .is_ngc = TRUE,
+  .id = 4635,
+  .ra = 190.662,
+  .dec = 19.9454,
+},
+{ .is_ngc = TRUE,
+  .id = 4636,
+  .ra = 190.708,
+  .dec = 2.68772,
+},
+{ .is_ngc = TRUE,
+  .id = 4637,
+  .ra = 190.726,
+  .dec = 11.4376,
+},
+{ .is_ngc = TRUE,
+  .id = 4639,
+  .ra = 190.718,
+  .dec = 13.2573,
+},
+{ .is_ngc = TRUE,
+  .id = 4641,
+  .ra = 190.782,
+  .dec = 12.0506,
+},
+{ .is_ngc = TRUE,
+  .id = 4642,
+  .ra = 190.824,
+  .dec = -0.644806,
+},
+{ .is_ngc = TRUE,
+  .id = 4643,
+  .ra = 190.834,
+  .dec = 1.97772,
+},
+{ .is_ngc = TRUE,
+  .id = 4645,
+  .ra = 191.041,
+  .dec = -41.75,
+},
+{ .is_ngc = TRUE,
+  .id = 4646,
+  .ra = 190.717,
+  .dec = 54.8561,
+},
+{ .is_ngc = TRUE,
+  .id = 4648,
+  .ra = 190.435,
+  .dec = 74.4211,
+},
+{ .is_ngc = TRUE,
+  .id = 4649,
+  .ra = 190.917,
+  .dec = 11.5522,
+},
+{ .is_ngc = TRUE,
+  .id = 4650,
+  .ra = 191.081,
+  .dec = -40.7323,
+},
+{ .is_ngc = TRUE,
+  .id = 4651,
+  .ra = 190.928,
+  .dec = 16.3934,
+},
+{ .is_ngc = TRUE,
+  .id = 4652,
+  .ra = 190.832,
+  .dec = 58.9646,
+},
+{ .is_ngc = TRUE,
+  .id = 4653,
+  .ra = 190.962,
+  .dec = -0.561444,
+},
+{ .is_ngc = TRUE,
+  .id = 4654,
+  .ra = 190.986,
+  .dec = 13.1261,
+},
+{ .is_ngc = TRUE,
+  .id = 4655,
+  .ra = 190.902,
+  .dec = 41.0183,
+},
+{ .is_ngc = TRUE,
+  .id = 4656,
+  .ra = 190.993,
+  .dec = 32.1714,
+},
+{ .is_ngc = TRUE,
+  .id = 4657,
+  .ra = 191.027,
+  .dec = 32.2084,
+},
+{ .is_ngc = TRUE,
+  .id = 4658,
+  .ra = 191.157,
+  .dec = -10.0844,
+},
+{ .is_ngc = TRUE,
+  .id = 4659,
+  .ra = 191.123,
+  .dec = 13.4983,
+},
+{ .is_ngc = TRUE,
+  .id = 4660,
+  .ra = 191.134,
+  .dec = 11.1903,
+},
+{ .is_ngc = TRUE,
+  .id = 4662,
+  .ra = 191.11,
+  .dec = 37.1207,
+},
+{ .is_ngc = TRUE,
+  .id = 4666,
+  .ra = 191.284,
+  .dec = -0.462444,
+},
+{ .is_ngc = TRUE,
+  .id = 4668,
+  .ra = 191.383,
+  .dec = -0.535833,
+},
+{ .is_ngc = TRUE,
+  .id = 4669,
+  .ra = 191.195,
+  .dec = 54.8758,
+},
+{ .is_ngc = TRUE,
+  .id = 4670,
+  .ra = 191.321,
+  .dec = 27.1254,
+},
+{ .is_ngc = TRUE,
+  .id = 4671,
+  .ra = 191.448,
+  .dec = -7.06944,
+},
+{ .is_ngc = TRUE,
+  .id = 4672,
+  .ra = 191.564,
+  .dec = -41.7061,
+},
+{ .is_ngc = TRUE,
+  .id = 4673,
+  .ra = 191.395,
+  .dec = 27.0606,
+},
+{ .is_ngc = TRUE,
+  .id = 4674,
+  .ra = 191.514,
+  .dec = -8.65583,
+},
+{ .is_ngc = TRUE,
+  .id = 4675,
+  .ra = 191.383,
+  .dec = 54.7373,
+},
+{ .is_ngc = TRUE,
+  .id = 4677,
+  .ra = 191.738,
+  .dec = -41.5828,
+},
+{ .is_ngc = TRUE,
+  .id = 4679,
+  .ra = 191.877,
+  .dec = -39.5711,
+},
+{ .is_ngc = TRUE,
+  .id = 4680,
+  .ra = 191.728,
+  .dec = -11.6364,
+},
+{ .is_ngc = TRUE,
+  .id = 4681,
+  .ra = 191.871,
+  .dec = -43.3347,
+},
+{ .is_ngc = TRUE,
+  .id = 4682,
+  .ra = 191.815,
+  .dec = -10.0635,
+},
+{ .is_ngc = TRUE,
+  .id = 4683,
+  .ra = 191.927,
+  .dec = -41.5283,
+},
+{ .is_ngc = TRUE,
+  .id = 4684,
+  .ra = 191.823,
+  .dec = -2.72742,
+},
+{ .is_ngc = TRUE,
+  .id = 4685,
+  .ra = 191.798,
+  .dec = 19.4641,
+},
+{ .is_ngc = TRUE,
+  .id = 4686,
+  .ra = 191.666,
+  .dec = 54.5338,
+},
+{ .is_ngc = TRUE,
+  .id = 4687,
+  .ra = 191.85,
+  .dec = 35.3521,
+},
+{ .is_ngc = TRUE,
+  .id = 4688,
+  .ra = 191.944,
+  .dec = 4.33578,
+},
+{ .is_ngc = TRUE,
+  .id = 4689,
+  .ra = 191.94,
+  .dec = 13.7626,
+},
+{ .is_ngc = TRUE,
+  .id = 4690,
+  .ra = 191.981,
+  .dec = -1.65622,
+},
+{ .is_ngc = TRUE,
+  .id = 4691,
+  .ra = 192.057,
+  .dec = -3.33294,
+},
+{ .is_ngc = TRUE,
+  .id = 4693,
+  .ra = 191.788,
+  .dec = 71.1764,
+},
+{ .is_ngc = TRUE,
+  .id = 4694,
+  .ra = 192.063,
+  .dec = 10.9839,
+},
+{ .is_ngc = TRUE,
+  .id = 4696,
+  .ra = 192.205,
+  .dec = -41.3116,
+},
+{ .is_ngc = TRUE,
+  .id = 4697,
+  .ra = 192.149,
+  .dec = -5.80053,
+},
+{ .is_ngc = TRUE,
+  .id = 4698,
+  .ra = 192.096,
+  .dec = 8.48761,
+},
+{ .is_ngc = TRUE,
+  .id = 4699,
+  .ra = 192.259,
+  .dec = -8.66472,
+},
+{ .is_ngc = TRUE,
+  .id = 4700,
+  .ra = 192.282,
+  .dec = -11.4119,
+},
+{ .is_ngc = TRUE,
+  .id = 4701,
+  .ra = 192.299,
+  .dec = 3.38894,
+},
+{ .is_ngc = TRUE,
+  .id = 4703,
+  .ra = 192.329,
+  .dec = -9.10861,
+},
+{ .is_ngc = TRUE,
+  .id = 4704,
+  .ra = 192.194,
+  .dec = 41.9211,
+},
+{ .is_ngc = TRUE,
+  .id = 4705,
+  .ra = 192.354,
+  .dec = -5.19583,
+},
+{ .is_ngc = TRUE,
+  .id = 4706,
+  .ra = 192.475,
+  .dec = -41.28,
+},
+{ .is_ngc = TRUE,
+  .id = 4707,
+  .ra = 192.096,
+  .dec = 51.1646,
+},
+{ .is_ngc = TRUE,
+  .id = 4708,
+  .ra = 192.423,
+  .dec = -11.0933,
+},
+{ .is_ngc = TRUE,
+  .id = 4709,
+  .ra = 192.516,
+  .dec = -41.3825,
+},
+{ .is_ngc = TRUE,
+  .id = 4710,
+  .ra = 192.412,
+  .dec = 15.1648,
+},
+{ .is_ngc = TRUE,
+  .id = 4712,
+  .ra = 192.393,
+  .dec = 25.4699,
+},
+{ .is_ngc = TRUE,
+  .id = 4713,
+  .ra = 192.491,
+  .dec = 5.31089,
+},
+{ .is_ngc = TRUE,
+  .id = 4714,
+  .ra = 192.58,
+  .dec = -13.3248,
+},
+{ .is_ngc = TRUE,
+  .id = 4715,
+  .ra = 192.491,
+  .dec = 27.8223,
+},
+{ .is_ngc = TRUE,
+  .id = 4716,
+  .ra = 192.638,
+  .dec = -9.45122,
+},
+{ .is_ngc = TRUE,
+  .id = 4717,
+  .ra = 192.644,
+  .dec = -9.46308,
+},
+{ .is_ngc = TRUE,
+  .id = 4719,
+  .ra = 192.536,
+  .dec = 33.1591,
+},
+{ .is_ngc = TRUE,
+  .id = 4720,
+  .ra = 192.678,
+  .dec = -4.15611,
+},
+{ .is_ngc = TRUE,
+  .id = 4721,
+  .ra = 192.582,
+  .dec = 27.3242,
+},
+{ .is_ngc = TRUE,
+  .id = 4723,
+  .ra = 192.762,
+  .dec = -13.2371,
+},
+{ .is_ngc = TRUE,
+  .id = 4724,
+  .ra = 192.724,
+  .dec = -14.332,
+},
+{ .is_ngc = TRUE,
+  .id = 4725,
+  .ra = 192.611,
+  .dec = 25.5007,
+},
+{ .is_ngc = TRUE,
+  .id = 4726,
+  .ra = 192.691,
+  .dec = -14.2685,
+},
+{ .is_ngc = TRUE,
+  .id = 4729,
+  .ra = 192.943,
+  .dec = -41.1319,
+},
+{ .is_ngc = TRUE,
+  .id = 4730,
+  .ra = 193.002,
+  .dec = -41.1469,
+},
+{ .is_ngc = TRUE,
+  .id = 4731,
+  .ra = 192.755,
+  .dec = -6.39244,
+},
+{ .is_ngc = TRUE,
+  .id = 4732,
+  .ra = 192.53,
+  .dec = 52.8499,
+},
+{ .is_ngc = TRUE,
+  .id = 4733,
+  .ra = 192.779,
+  .dec = 10.9118,
+},
+{ .is_ngc = TRUE,
+  .id = 4734,
+  .ra = 192.804,
+  .dec = 4.85878,
+},
+{ .is_ngc = TRUE,
+  .id = 4735,
+  .ra = 192.757,
+  .dec = 28.9279,
+},
+{ .is_ngc = TRUE,
+  .id = 4736,
+  .ra = 192.721,
+  .dec = 41.12,
+},
+{ .is_ngc = TRUE,
+  .id = 4737,
+  .ra = 192.72,
+  .dec = 34.1569,
+},
+{ .is_ngc = TRUE,
+  .id = 4738,
+  .ra = 192.787,
+  .dec = 28.7881,
+},
+{ .is_ngc = TRUE,
+  .id = 4739,
+  .ra = 192.905,
+  .dec = -8.41,
+},
+{ .is_ngc = TRUE,
+  .id = 4741,
+  .ra = 192.748,
+  .dec = 47.6715,
+},
+{ .is_ngc = TRUE,
+  .id = 4742,
+  .ra = 192.95,
+  .dec = -10.455,
+},
+{ .is_ngc = TRUE,
+  .id = 4743,
+  .ra = 193.065,
+  .dec = -41.39,
+},
+{ .is_ngc = TRUE,
+  .id = 4744,
+  .ra = 193.081,
+  .dec = -41.0603,
+},
+{ .is_ngc = TRUE,
+  .id = 4746,
+  .ra = 192.98,
+  .dec = 12.0832,
+},
+{ .is_ngc = TRUE,
+  .id = 4747,
+  .ra = 192.939,
+  .dec = 25.7746,
+},
+{ .is_ngc = TRUE,
+  .id = 4748,
+  .ra = 193.053,
+  .dec = -13.4139,
+},
+{ .is_ngc = TRUE,
+  .id = 4749,
+  .ra = 192.803,
+  .dec = 71.635,
+},
+{ .is_ngc = TRUE,
+  .id = 4750,
+  .ra = 192.529,
+  .dec = 72.8746,
+},
+{ .is_ngc = TRUE,
+  .id = 4751,
+  .ra = 193.213,
+  .dec = -42.66,
+},
+{ .is_ngc = TRUE,
+  .id = 4752,
+  .ra = 192.871,
+  .dec = 13.782,
+},
+{ .is_ngc = TRUE,
+  .id = 4753,
+  .ra = 193.092,
+  .dec = -1.20008,
+},
+{ .is_ngc = TRUE,
+  .id = 4754,
+  .ra = 193.073,
+  .dec = 11.3135,
+},
+{ .is_ngc = TRUE,
+  .id = 4755,
+  .ra = 193.412,
+  .dec = -60.3519,
+},
+{ .is_ngc = TRUE,
+  .id = 4756,
+  .ra = 193.219,
+  .dec = -15.4133,
+},
+{ .is_ngc = TRUE,
+  .id = 4757,
+  .ra = 193.209,
+  .dec = -10.3105,
+},
+{ .is_ngc = TRUE,
+  .id = 4758,
+  .ra = 193.184,
+  .dec = 15.8481,
+},
+{ .is_ngc = TRUE,
+  .id = 4760,
+  .ra = 193.28,
+  .dec = -10.4947,
+},
+{ .is_ngc = TRUE,
+  .id = 4761,
+  .ra = 193.291,
+  .dec = -9.19797,
+},
+{ .is_ngc = TRUE,
+  .id = 4762,
+  .ra = 193.233,
+  .dec = 11.2303,
+},
+{ .is_ngc = TRUE,
+  .id = 4763,
+  .ra = 193.363,
+  .dec = -17.0058,
+},
+{ .is_ngc = TRUE,
+  .id = 4764,
+  .ra = 193.277,
+  .dec = -9.25781,
+},
+{ .is_ngc = TRUE,
+  .id = 4765,
+  .ra = 193.311,
+  .dec = 4.46344,
+},
+{ .is_ngc = TRUE,
+  .id = 4766,
+  .ra = 193.284,
+  .dec = -10.3784,
+},
+{ .is_ngc = TRUE,
+  .id = 4767,
+  .ra = 193.471,
+  .dec = -39.7144,
+},
+{ .is_ngc = TRUE,
+  .id = 4768,
+  .ra = 193.322,
+  .dec = -9.53178,
+},
+{ .is_ngc = TRUE,
+  .id = 4769,
+  .ra = 193.326,
+  .dec = -9.53544,
+},
+{ .is_ngc = TRUE,
+  .id = 4770,
+  .ra = 193.384,
+  .dec = -9.54167,
+},
+{ .is_ngc = TRUE,
+  .id = 4771,
+  .ra = 193.338,
+  .dec = 1.26897,
+},
+{ .is_ngc = TRUE,
+  .id = 4772,
+  .ra = 193.371,
+  .dec = 2.16836,
+},
+{ .is_ngc = TRUE,
+  .id = 4775,
+  .ra = 193.441,
+  .dec = -6.62194,
+},
+{ .is_ngc = TRUE,
+  .id = 4777,
+  .ra = 193.494,
+  .dec = -8.77589,
+},
+{ .is_ngc = TRUE,
+  .id = 4779,
+  .ra = 193.462,
+  .dec = 9.70919,
+},
+{ .is_ngc = TRUE,
+  .id = 4780,
+  .ra = 193.522,
+  .dec = -8.62156,
+},
+{ .is_ngc = TRUE,
+  .id = 4781,
+  .ra = 193.598,
+  .dec = -10.5361,
+},
+{ .is_ngc = TRUE,
+  .id = 4782,
+  .ra = 193.649,
+  .dec = -12.5689,
+},
+{ .is_ngc = TRUE,
+  .id = 4783,
+  .ra = 193.652,
+  .dec = -12.5582,
+},
+{ .is_ngc = TRUE,
+  .id = 4784,
+  .ra = 193.654,
+  .dec = -10.6131,
+},
+{ .is_ngc = TRUE,
+  .id = 4785,
+  .ra = 193.363,
+  .dec = -48.7497,
+},
+{ .is_ngc = TRUE,
+  .id = 4786,
+  .ra = 193.635,
+  .dec = -6.85917,
+},
+{ .is_ngc = TRUE,
+  .id = 4787,
+  .ra = 193.523,
+  .dec = 27.0682,
+},
+{ .is_ngc = TRUE,
+  .id = 4788,
+  .ra = 193.567,
+  .dec = 27.3032,
+},
+{ .is_ngc = TRUE,
+  .id = 4789,
+  .ra = 193.579,
+  .dec = 27.0678,
+},
+{ .is_ngc = TRUE,
+  .id = 4790,
+  .ra = 193.716,
+  .dec = -10.2481,
+},
+{ .is_ngc = TRUE,
+  .id = 4791,
+  .ra = 193.683,
+  .dec = 8.05301,
+},
+{ .is_ngc = TRUE,
+  .id = 4792,
+  .ra = 193.765,
+  .dec = -12.497,
+},
+{ .is_ngc = TRUE,
+  .id = 4793,
+  .ra = 193.67,
+  .dec = 28.9379,
+},
+{ .is_ngc = TRUE,
+  .id = 4794,
+  .ra = 193.793,
+  .dec = -12.6089,
+},
+{ .is_ngc = TRUE,
+  .id = 4795,
+  .ra = 193.762,
+  .dec = 8.06577,
+},
+{ .is_ngc = TRUE,
+  .id = 4796,
+  .ra = 193.77,
+  .dec = 8.0667,
+},
+{ .is_ngc = TRUE,
+  .id = 4799,
+  .ra = 193.815,
+  .dec = 2.89628,
+},
+{ .is_ngc = TRUE,
+  .id = 4800,
+  .ra = 193.657,
+  .dec = 46.5309,
+},
+{ .is_ngc = TRUE,
+  .id = 4801,
+  .ra = 193.657,
+  .dec = 53.0899,
+},
+{ .is_ngc = TRUE,
+  .id = 4803,
+  .ra = 193.89,
+  .dec = 8.24003,
+},
+{ .is_ngc = TRUE,
+  .id = 4805,
+  .ra = 193.851,
+  .dec = 27.9805,
+},
+{ .is_ngc = TRUE,
+  .id = 4806,
+  .ra = 194.052,
+  .dec = -29.5033,
+},
+{ .is_ngc = TRUE,
+  .id = 4807,
+  .ra = 193.872,
+  .dec = 27.5208,
+},
+{ .is_ngc = TRUE,
+  .id = 4808,
+  .ra = 193.954,
+  .dec = 4.30378,
+},
+{ .is_ngc = TRUE,
+  .id = 4809,
+  .ra = 193.712,
+  .dec = 2.65269,
+},
+{ .is_ngc = TRUE,
+  .id = 4810,
+  .ra = 193.713,
+  .dec = 2.64028,
+},
+{ .is_ngc = TRUE,
+  .id = 4811,
+  .ra = 194.218,
+  .dec = -41.7972,
+},
+{ .is_ngc = TRUE,
+  .id = 4812,
+  .ra = 194.22,
+  .dec = -41.8128,
+},
+{ .is_ngc = TRUE,
+  .id = 4814,
+  .ra = 193.842,
+  .dec = 58.3438,
+},
+{ .is_ngc = TRUE,
+  .id = 4815,
+  .ra = 194.496,
+  .dec = -64.9517,
+},
+{ .is_ngc = TRUE,
+  .id = 4816,
+  .ra = 194.051,
+  .dec = 27.745,
+},
+{ .is_ngc = TRUE,
+  .id = 4817,
+  .ra = 194.124,
+  .dec = 27.9401,
+},
+{ .is_ngc = TRUE,
+  .id = 4818,
+  .ra = 194.204,
+  .dec = -8.525,
+},
+{ .is_ngc = TRUE,
+  .id = 4819,
+  .ra = 194.117,
+  .dec = 26.9871,
+},
+{ .is_ngc = TRUE,
+  .id = 4820,
+  .ra = 194.252,
+  .dec = -13.7192,
+},
+{ .is_ngc = TRUE,
+  .id = 4821,
+  .ra = 194.121,
+  .dec = 26.9566,
+},
+{ .is_ngc = TRUE,
+  .id = 4822,
+  .ra = 194.265,
+  .dec = -10.7622,
+},
+{ .is_ngc = TRUE,
+  .id = 4823,
+  .ra = 194.357,
+  .dec = -13.6989,
+},
+{ .is_ngc = TRUE,
+  .id = 4824,
+  .ra = 194.151,
+  .dec = 27.4328,
+},
+{ .is_ngc = TRUE,
+  .id = 4825,
+  .ra = 194.301,
+  .dec = -13.665,
+},
+{ .is_ngc = TRUE,
+  .id = 4826,
+  .ra = 194.182,
+  .dec = 21.6827,
+},
+{ .is_ngc = TRUE,
+  .id = 4827,
+  .ra = 194.182,
+  .dec = 27.1785,
+},
+{ .is_ngc = TRUE,
+  .id = 4828,
+  .ra = 194.179,
+  .dec = 28.0201,
+},
+{ .is_ngc = TRUE,
+  .id = 4829,
+  .ra = 194.352,
+  .dec = -13.7376,
+},
+{ .is_ngc = TRUE,
+  .id = 4830,
+  .ra = 194.366,
+  .dec = -19.6914,
+},
+{ .is_ngc = TRUE,
+  .id = 4831,
+  .ra = 194.403,
+  .dec = -27.2919,
+},
+{ .is_ngc = TRUE,
+  .id = 4832,
+  .ra = 194.447,
+  .dec = -39.7611,
+},
+{ .is_ngc = TRUE,
+  .id = 4833,
+  .ra = 194.897,
+  .dec = -70.8754,
+},
+{ .is_ngc = TRUE,
+  .id = 4834,
+  .ra = 194.105,
+  .dec = 52.2957,
+},
+{ .is_ngc = TRUE,
+  .id = 4835,
+  .ra = 194.532,
+  .dec = -46.2642,
+},
+{ .is_ngc = TRUE,
+  .id = 4836,
+  .ra = 194.393,
+  .dec = -12.7439,
+},
+{ .is_ngc = TRUE,
+  .id = 4838,
+  .ra = 194.484,
+  .dec = -13.0601,
+},
+{ .is_ngc = TRUE,
+  .id = 4839,
+  .ra = 194.351,
+  .dec = 27.4976,
+},
+{ .is_ngc = TRUE,
+  .id = 4840,
+  .ra = 194.387,
+  .dec = 27.6099,
+},
+{ .is_ngc = TRUE,
+  .id = 4843,
+  .ra = 194.504,
+  .dec = -3.62169,
+},
+{ .is_ngc = TRUE,
+  .id = 4844,
+  .ra = 194.535,
+  .dec = -13.0799,
+},
+{ .is_ngc = TRUE,
+  .id = 4844,
+  .ra = 194.492,
+  .dec = -13.0635,
+},
+{ .is_ngc = TRUE,
+  .id = 4846,
+  .ra = 194.449,
+  .dec = 36.3704,
+},
+{ .is_ngc = TRUE,
+  .id = 4847,
+  .ra = 194.621,
+  .dec = -13.1407,
+},
+{ .is_ngc = TRUE,
+  .id = 4848,
+  .ra = 194.523,
+  .dec = 28.2426,
+},
+{ .is_ngc = TRUE,
+  .id = 4850,
+  .ra = 194.591,
+  .dec = 27.9675,
+},
+{ .is_ngc = TRUE,
+  .id = 4852,
+  .ra = 195.037,
+  .dec = -59.6022,
+},
+{ .is_ngc = TRUE,
+  .id = 4853,
+  .ra = 194.647,
+  .dec = 27.596,
+},
+{ .is_ngc = TRUE,
+  .id = 4854,
+  .ra = 194.697,
+  .dec = 27.6741,
+},
+{ .is_ngc = TRUE,
+  .id = 4855,
+  .ra = 194.827,
+  .dec = -13.2308,
+},
+{ .is_ngc = TRUE,
+  .id = 4856,
+  .ra = 194.838,
+  .dec = -15.0422,
+},
+{ .is_ngc = TRUE,
+  .id = 4857,
+  .ra = 194.326,
+  .dec = 70.2033,
+},
+{ .is_ngc = TRUE,
+  .id = 4858,
+  .ra = 194.759,
+  .dec = 28.1155,
+},
+{ .is_ngc = TRUE,
+  .id = 4859,
+  .ra = 194.758,
+  .dec = 26.8153,
+},
+{ .is_ngc = TRUE,
+  .id = 4860,
+  .ra = 194.767,
+  .dec = 28.1229,
+},
+{ .is_ngc = TRUE,
+  .id = 4863,
+  .ra = 194.927,
+  .dec = -14.0296,
+},
+{ .is_ngc = TRUE,
+  .id = 4864,
+  .ra = 194.805,
+  .dec = 27.9767,
+},
+{ .is_ngc = TRUE,
+  .id = 4865,
+  .ra = 194.833,
+  .dec = 28.084,
+},
+{ .is_ngc = TRUE,
+  .id = 4866,
+  .ra = 194.863,
+  .dec = 14.171,
+},
+{ .is_ngc = TRUE,
+  .id = 4867,
+  .ra = 194.814,
+  .dec = 27.9706,
+},
+{ .is_ngc = TRUE,
+  .id = 4868,
+  .ra = 194.787,
+  .dec = 37.31,
+},
+{ .is_ngc = TRUE,
+  .id = 4869,
+  .ra = 194.847,
+  .dec = 27.9111,
+},
+{ .is_ngc = TRUE,
+  .id = 4870,
+  .ra = 194.824,
+  .dec = 37.0479,
+},
+{ .is_ngc = TRUE,
+  .id = 4871,
+  .ra = 194.875,
+  .dec = 27.9561,
+},
+{ .is_ngc = TRUE,
+  .id = 4872,
+  .ra = 194.892,
+  .dec = 27.9465,
+},
+{ .is_ngc = TRUE,
+  .id = 4873,
+  .ra = 194.887,
+  .dec = 27.9829,
+},
+{ .is_ngc = TRUE,
+  .id = 4874,
+  .ra = 194.899,
+  .dec = 27.9593,
+},
+{ .is_ngc = TRUE,
+  .id = 4875,
+  .ra = 194.908,
+  .dec = 27.9069,
+},
+{ .is_ngc = TRUE,
+  .id = 4876,
+  .ra = 194.935,
+  .dec = 27.9124,
+},
+{ .is_ngc = TRUE,
+  .id = 4877,
+  .ra = 195.11,
+  .dec = -15.2836,
+},
+{ .is_ngc = TRUE,
+  .id = 4878,
+  .ra = 195.084,
+  .dec = -6.10442,
+},
+{ .is_ngc = TRUE,
+  .id = 4878,
+  .ra = 193.81,
+  .dec = -6.12028,
+},
+{ .is_ngc = TRUE,
+  .id = 4879,
+  .ra = 195.107,
+  .dec = -6.11122,
+},
+{ .is_ngc = TRUE,
+  .id = 4880,
+  .ra = 195.044,
+  .dec = 12.4831,
+},
+{ .is_ngc = TRUE,
+  .id = 4881,
+  .ra = 194.991,
+  .dec = 28.2465,
+},
+{ .is_ngc = TRUE,
+  .id = 4883,
+  .ra = 194.983,
+  .dec = 28.034,
+},
+{ .is_ngc = TRUE,
+  .id = 4885,
+  .ra = 195.141,
+  .dec = -6.85333,
+},
+{ .is_ngc = TRUE,
+  .id = 4887,
+  .ra = 195.163,
+  .dec = -14.6666,
+},
+{ .is_ngc = TRUE,
+  .id = 4888,
+  .ra = 195.151,
+  .dec = -6.07528,
+},
+{ .is_ngc = TRUE,
+  .id = 4890,
+  .ra = 195.163,
+  .dec = -4.60417,
+},
+{ .is_ngc = TRUE,
+  .id = 4891,
+  .ra = 195.196,
+  .dec = -13.4259,
+},
+{ .is_ngc = TRUE,
+  .id = 4892,
+  .ra = 195.015,
+  .dec = 26.8977,
+},
+{ .is_ngc = TRUE,
+  .id = 4894,
+  .ra = 195.069,
+  .dec = 27.9669,
+},
+{ .is_ngc = TRUE,
+  .id = 4895,
+  .ra = 195.075,
+  .dec = 28.2019,
+},
+{ .is_ngc = TRUE,
+  .id = 4896,
+  .ra = 195.128,
+  .dec = 28.3456,
+},
+{ .is_ngc = TRUE,
+  .id = 4897,
+  .ra = 195.221,
+  .dec = -13.4503,
+},
+{ .is_ngc = TRUE,
+  .id = 4898,
+  .ra = 195.074,
+  .dec = 27.9551,
+},
+{ .is_ngc = TRUE,
+  .id = 4899,
+  .ra = 195.236,
+  .dec = -13.9447,
+},
+{ .is_ngc = TRUE,
+  .id = 4900,
+  .ra = 195.163,
+  .dec = 2.50014,
+},
+{ .is_ngc = TRUE,
+  .id = 4901,
+  .ra = 194.985,
+  .dec = 47.2055,
+},
+{ .is_ngc = TRUE,
+  .id = 4902,
+  .ra = 195.249,
+  .dec = -14.5139,
+},
+{ .is_ngc = TRUE,
+  .id = 4903,
+  .ra = 195.345,
+  .dec = -30.9344,
+},
+{ .is_ngc = TRUE,
+  .id = 4904,
+  .ra = 195.245,
+  .dec = -0.0278333,
+},
+{ .is_ngc = TRUE,
+  .id = 4905,
+  .ra = 195.377,
+  .dec = -30.8678,
+},
+{ .is_ngc = TRUE,
+  .id = 4906,
+  .ra = 195.165,
+  .dec = 27.9237,
+},
+{ .is_ngc = TRUE,
+  .id = 4907,
+  .ra = 195.203,
+  .dec = 28.1574,
+},
+{ .is_ngc = TRUE,
+  .id = 4908,
+  .ra = 195.227,
+  .dec = 28.0072,
+},
+{ .is_ngc = TRUE,
+  .id = 4909,
+  .ra = 195.507,
+  .dec = -42.7719,
+},
+{ .is_ngc = TRUE,
+  .id = 4911,
+  .ra = 195.234,
+  .dec = 27.7904,
+},
+{ .is_ngc = TRUE,
+  .id = 4912,
+  .ra = 195.192,
+  .dec = 37.3686,
+},
+{ .is_ngc = TRUE,
+  .id = 4913,
+  .ra = 195.192,
+  .dec = 37.3353,
+},
+{ .is_ngc = TRUE,
+  .id = 4914,
+  .ra = 195.179,
+  .dec = 37.3151,
+},
+{ .is_ngc = TRUE,
+  .id = 4915,
+  .ra = 195.366,
+  .dec = -4.54592,
+},
+{ .is_ngc = TRUE,
+  .id = 4916,
+  .ra = 195.225,
+  .dec = 37.3519,
+},
+{ .is_ngc = TRUE,
+  .id = 4917,
+  .ra = 195.232,
+  .dec = 47.2219,
+},
+{ .is_ngc = TRUE,
+  .id = 4918,
+  .ra = 195.461,
+  .dec = -4.50111,
+},
+{ .is_ngc = TRUE,
+  .id = 4919,
+  .ra = 195.323,
+  .dec = 27.8085,
+},
+{ .is_ngc = TRUE,
+  .id = 4921,
+  .ra = 195.359,
+  .dec = 27.8855,
+},
+{ .is_ngc = TRUE,
+  .id = 4922,
+  .ra = 195.354,
+  .dec = 29.3108,
+},
+{ .is_ngc = TRUE,
+  .id = 4923,
+  .ra = 195.382,
+  .dec = 27.847,
+},
+{ .is_ngc = TRUE,
+  .id = 4924,
+  .ra = 195.553,
+  .dec = -14.9694,
+},
+{ .is_ngc = TRUE,
+  .id = 4925,
+  .ra = 195.531,
+  .dec = -7.71056,
+},
+{ .is_ngc = TRUE,
+  .id = 4926,
+  .ra = 195.474,
+  .dec = 27.6242,
+},
+{ .is_ngc = TRUE,
+  .id = 4927,
+  .ra = 195.49,
+  .dec = 28.0055,
+},
+{ .is_ngc = TRUE,
+  .id = 4928,
+  .ra = 195.752,
+  .dec = -8.08472,
+},
+{ .is_ngc = TRUE,
+  .id = 4929,
+  .ra = 195.685,
+  .dec = 28.0449,
+},
+{ .is_ngc = TRUE,
+  .id = 4930,
+  .ra = 196.02,
+  .dec = -41.4114,
+},
+{ .is_ngc = TRUE,
+  .id = 4931,
+  .ra = 195.754,
+  .dec = 28.0322,
+},
+{ .is_ngc = TRUE,
+  .id = 4932,
+  .ra = 195.657,
+  .dec = 50.4386,
+},
+{ .is_ngc = TRUE,
+  .id = 4934,
+  .ra = 195.818,
+  .dec = 28.0297,
+},
+{ .is_ngc = TRUE,
+  .id = 4935,
+  .ra = 195.839,
+  .dec = 14.3774,
+},
+{ .is_ngc = TRUE,
+  .id = 4936,
+  .ra = 196.071,
+  .dec = -30.5264,
+},
+{ .is_ngc = TRUE,
+  .id = 4937,
+  .ra = 196.216,
+  .dec = -47.2193,
+},
+{ .is_ngc = TRUE,
+  .id = 4938,
+  .ra = 195.74,
+  .dec = 51.3184,
+},
+{ .is_ngc = TRUE,
+  .id = 4939,
+  .ra = 196.06,
+  .dec = -10.3402,
+},
+{ .is_ngc = TRUE,
+  .id = 4940,
+  .ra = 196.251,
+  .dec = -47.2366,
+},
+{ .is_ngc = TRUE,
+  .id = 4941,
+  .ra = 196.055,
+  .dec = -5.55182,
+},
+{ .is_ngc = TRUE,
+  .id = 4943,
+  .ra = 195.937,
+  .dec = 28.0835,
+},
+{ .is_ngc = TRUE,
+  .id = 4944,
+  .ra = 195.958,
+  .dec = 28.1854,
+},
+{ .is_ngc = TRUE,
+  .id = 4945,
+  .ra = 196.363,
+  .dec = -49.4673,
+},
+{ .is_ngc = TRUE,
+  .id = 4946,
+  .ra = 196.372,
+  .dec = -43.5914,
+},
+{ .is_ngc = TRUE,
+  .id = 4949,
+  .ra = 196.075,
+  .dec = 29.029,
+},
+{ .is_ngc = TRUE,
+  .id = 4950,
+  .ra = 196.401,
+  .dec = -43.5006,
+},
+{ .is_ngc = TRUE,
+  .id = 4951,
+  .ra = 196.282,
+  .dec = -6.49472,
+},
+{ .is_ngc = TRUE,
+  .id = 4953,
+  .ra = 196.543,
+  .dec = -37.586,
+},
+{ .is_ngc = TRUE,
+  .id = 4955,
+  .ra = 196.521,
+  .dec = -29.7544,
+},
+{ .is_ngc = TRUE,
+  .id = 4956,
+  .ra = 196.255,
+  .dec = 35.1778,
+},
+{ .is_ngc = TRUE,
+  .id = 4957,
+  .ra = 196.302,
+  .dec = 27.5694,
+},
+{ .is_ngc = TRUE,
+  .id = 4958,
+  .ra = 196.454,
+  .dec = -8.02083,
+},
+{ .is_ngc = TRUE,
+  .id = 4959,
+  .ra = 196.421,
+  .dec = 33.1789,
+},
+{ .is_ngc = TRUE,
+  .id = 4963,
+  .ra = 196.467,
+  .dec = 41.7214,
+},
+{ .is_ngc = TRUE,
+  .id = 4964,
+  .ra = 196.354,
+  .dec = 56.3224,
+},
+{ .is_ngc = TRUE,
+  .id = 4965,
+  .ra = 196.789,
+  .dec = -28.2286,
+},
+{ .is_ngc = TRUE,
+  .id = 4966,
+  .ra = 196.572,
+  .dec = 29.0629,
+},
+{ .is_ngc = TRUE,
+  .id = 4967,
+  .ra = 196.402,
+  .dec = 53.5641,
+},
+{ .is_ngc = TRUE,
+  .id = 4968,
+  .ra = 196.775,
+  .dec = -23.6778,
+},
+{ .is_ngc = TRUE,
+  .id = 4969,
+  .ra = 196.763,
+  .dec = 13.6361,
+},
+{ .is_ngc = TRUE,
+  .id = 4971,
+  .ra = 196.729,
+  .dec = 28.548,
+},
+{ .is_ngc = TRUE,
+  .id = 4974,
+  .ra = 196.483,
+  .dec = 53.6596,
+},
+{ .is_ngc = TRUE,
+  .id = 4975,
+  .ra = 196.96,
+  .dec = -5.01806,
+},
+{ .is_ngc = TRUE,
+  .id = 4976,
+  .ra = 197.156,
+  .dec = -49.506,
+},
+{ .is_ngc = TRUE,
+  .id = 4977,
+  .ra = 196.519,
+  .dec = 55.6559,
+},
+{ .is_ngc = TRUE,
+  .id = 4978,
+  .ra = 196.961,
+  .dec = 18.4153,
+},
+{ .is_ngc = TRUE,
+  .id = 4980,
+  .ra = 197.293,
+  .dec = -28.6417,
+},
+{ .is_ngc = TRUE,
+  .id = 4981,
+  .ra = 197.203,
+  .dec = -6.77861,
+},
+{ .is_ngc = TRUE,
+  .id = 4982,
+  .ra = 197.192,
+  .dec = -10.5886,
+},
+{ .is_ngc = TRUE,
+  .id = 4983,
+  .ra = 197.114,
+  .dec = 28.3204,
+},
+{ .is_ngc = TRUE,
+  .id = 4984,
+  .ra = 197.238,
+  .dec = -15.5166,
+},
+{ .is_ngc = TRUE,
+  .id = 4985,
+  .ra = 197.051,
+  .dec = 41.676,
+},
+{ .is_ngc = TRUE,
+  .id = 4986,
+  .ra = 197.102,
+  .dec = 35.206,
+},
+{ .is_ngc = TRUE,
+  .id = 4987,
+  .ra = 196.996,
+  .dec = 51.9291,
+},
+{ .is_ngc = TRUE,
+  .id = 4988,
+  .ra = 197.476,
+  .dec = -43.1058,
+},
+{ .is_ngc = TRUE,
+  .id = 4989,
+  .ra = 197.317,
+  .dec = -5.39667,
+},
+{ .is_ngc = TRUE,
+  .id = 4990,
+  .ra = 197.322,
+  .dec = -5.27278,
+},
+{ .is_ngc = TRUE,
+  .id = 4991,
+  .ra = 197.313,
+  .dec = 2.34728,
+},
+{ .is_ngc = TRUE,
+  .id = 4992,
+  .ra = 197.273,
+  .dec = 11.6337,
+},
+{ .is_ngc = TRUE,
+  .id = 4995,
+  .ra = 197.419,
+  .dec = -7.83328,
+},
+{ .is_ngc = TRUE,
+  .id = 4996,
+  .ra = 197.383,
+  .dec = 0.857033,
+},
+{ .is_ngc = TRUE,
+  .id = 4997,
+  .ra = 197.465,
+  .dec = -16.5161,
+},
+{ .is_ngc = TRUE,
+  .id = 4998,
+  .ra = 197.043,
+  .dec = 50.6639,
+},
+{ .is_ngc = TRUE,
+  .id = 4999,
+  .ra = 197.388,
+  .dec = 1.67269,
+},
+{ .is_ngc = TRUE,
+  .id = 5000,
+  .ra = 197.448,
+  .dec = 28.9068,
+},
+{ .is_ngc = TRUE,
+  .id = 5001,
+  .ra = 197.388,
+  .dec = 53.4939,
+},
+{ .is_ngc = TRUE,
+  .id = 5002,
+  .ra = 197.659,
+  .dec = 36.6342,
+},
+{ .is_ngc = TRUE,
+  .id = 5003,
+  .ra = 197.158,
+  .dec = 43.7375,
+},
+{ .is_ngc = TRUE,
+  .id = 5005,
+  .ra = 197.735,
+  .dec = 37.0584,
+},
+{ .is_ngc = TRUE,
+  .id = 5006,
+  .ra = 197.941,
+  .dec = -19.2618,
+},
+{ .is_ngc = TRUE,
+  .id = 5007,
+  .ra = 197.309,
+  .dec = 62.1747,
+},
+{ .is_ngc = TRUE,
+  .id = 5009,
+  .ra = 197.697,
+  .dec = 50.0924,
+},
+{ .is_ngc = TRUE,
+  .id = 5010,
+  .ra = 198.11,
+  .dec = -15.7975,
+},
+{ .is_ngc = TRUE,
+  .id = 5011,
+  .ra = 198.216,
+  .dec = -43.0967,
+},
+{ .is_ngc = TRUE,
+  .id = 5012,
+  .ra = 197.904,
+  .dec = 22.9159,
+},
+{ .is_ngc = TRUE,
+  .id = 5013,
+  .ra = 198.031,
+  .dec = 3.19872,
+},
+{ .is_ngc = TRUE,
+  .id = 5014,
+  .ra = 197.881,
+  .dec = 36.2821,
+},
+{ .is_ngc = TRUE,
+  .id = 5015,
+  .ra = 198.095,
+  .dec = -4.33722,
+},
+{ .is_ngc = TRUE,
+  .id = 5016,
+  .ra = 198.028,
+  .dec = 24.0951,
+},
+{ .is_ngc = TRUE,
+  .id = 5017,
+  .ra = 198.227,
+  .dec = -16.7661,
+},
+{ .is_ngc = TRUE,
+  .id = 5018,
+  .ra = 198.254,
+  .dec = -19.5189,
+},
+{ .is_ngc = TRUE,
+  .id = 5019,
+  .ra = 198.177,
+  .dec = 4.72936,
+},
+{ .is_ngc = TRUE,
+  .id = 5020,
+  .ra = 198.167,
+  .dec = 12.5994,
+},
+{ .is_ngc = TRUE,
+  .id = 5021,
+  .ra = 198.026,
+  .dec = 46.1959,
+},
+{ .is_ngc = TRUE,
+  .id = 5022,
+  .ra = 198.378,
+  .dec = -19.5472,
+},
+{ .is_ngc = TRUE,
+  .id = 5023,
+  .ra = 198.049,
+  .dec = 44.0382,
+},
+{ .is_ngc = TRUE,
+  .id = 5024,
+  .ra = 198.23,
+  .dec = 18.1687,
+},
+{ .is_ngc = TRUE,
+  .id = 5025,
+  .ra = 198.186,
+  .dec = 31.8088,
+},
+{ .is_ngc = TRUE,
+  .id = 5026,
+  .ra = 198.557,
+  .dec = -42.9614,
+},
+{ .is_ngc = TRUE,
+  .id = 5027,
+  .ra = 198.337,
+  .dec = 6.06131,
+},
+{ .is_ngc = TRUE,
+  .id = 5028,
+  .ra = 198.441,
+  .dec = -13.0427,
+},
+{ .is_ngc = TRUE,
+  .id = 5029,
+  .ra = 198.157,
+  .dec = 47.0631,
+},
+{ .is_ngc = TRUE,
+  .id = 5030,
+  .ra = 198.476,
+  .dec = -16.4911,
+},
+{ .is_ngc = TRUE,
+  .id = 5031,
+  .ra = 198.514,
+  .dec = -16.1239,
+},
+{ .is_ngc = TRUE,
+  .id = 5033,
+  .ra = 198.365,
+  .dec = 36.5938,
+},
+{ .is_ngc = TRUE,
+  .id = 5034,
+  .ra = 198.079,
+  .dec = 70.6495,
+},
+{ .is_ngc = TRUE,
+  .id = 5035,
+  .ra = 198.705,
+  .dec = -16.4934,
+},
+{ .is_ngc = TRUE,
+  .id = 5036,
+  .ra = 198.679,
+  .dec = -4.17924,
+},
+{ .is_ngc = TRUE,
+  .id = 5037,
+  .ra = 198.748,
+  .dec = -16.5906,
+},
+{ .is_ngc = TRUE,
+  .id = 5038,
+  .ra = 198.759,
+  .dec = -15.9517,
+},
+{ .is_ngc = TRUE,
+  .id = 5039,
+  .ra = 198.717,
+  .dec = -4.15844,
+},
+{ .is_ngc = TRUE,
+  .id = 5040,
+  .ra = 198.386,
+  .dec = 51.2583,
+},
+{ .is_ngc = TRUE,
+  .id = 5041,
+  .ra = 198.635,
+  .dec = 30.7055,
+},
+{ .is_ngc = TRUE,
+  .id = 5042,
+  .ra = 198.878,
+  .dec = -23.9838,
+},
+{ .is_ngc = TRUE,
+  .id = 5043,
+  .ra = 199.05,
+  .dec = -60.0517,
+},
+{ .is_ngc = TRUE,
+  .id = 5043,
+  .ra = 199.163,
+  .dec = -60.0347,
+},
+{ .is_ngc = TRUE,
+  .id = 5044,
+  .ra = 198.85,
+  .dec = -16.3853,
+},
+{ .is_ngc = TRUE,
+  .id = 5045,
+  .ra = 199.262,
+  .dec = -63.4025,
+},
+{ .is_ngc = TRUE,
+  .id = 5046,
+  .ra = 198.938,
+  .dec = -16.3268,
+},
+{ .is_ngc = TRUE,
+  .id = 5047,
+  .ra = 198.952,
+  .dec = -16.5189,
+},
+{ .is_ngc = TRUE,
+  .id = 5048,
+  .ra = 199.032,
+  .dec = -28.4108,
+},
+{ .is_ngc = TRUE,
+  .id = 5049,
+  .ra = 198.997,
+  .dec = -16.3972,
+},
+{ .is_ngc = TRUE,
+  .id = 5050,
+  .ra = 198.924,
+  .dec = 2.87861,
+},
+{ .is_ngc = TRUE,
+  .id = 5051,
+  .ra = 199.084,
+  .dec = -28.2858,
+},
+{ .is_ngc = TRUE,
+  .id = 5052,
+  .ra = 198.895,
+  .dec = 29.6758,
+},
+{ .is_ngc = TRUE,
+  .id = 5053,
+  .ra = 199.112,
+  .dec = 17.6978,
+},
+{ .is_ngc = TRUE,
+  .id = 5054,
+  .ra = 199.243,
+  .dec = -16.6347,
+},
+{ .is_ngc = TRUE,
+  .id = 5055,
+  .ra = 198.955,
+  .dec = 42.0294,
+},
+{ .is_ngc = TRUE,
+  .id = 5056,
+  .ra = 199.051,
+  .dec = 30.9497,
+},
+{ .is_ngc = TRUE,
+  .id = 5057,
+  .ra = 199.116,
+  .dec = 31.0314,
+},
+{ .is_ngc = TRUE,
+  .id = 5058,
+  .ra = 199.218,
+  .dec = 12.5484,
+},
+{ .is_ngc = TRUE,
+  .id = 5059,
+  .ra = 199.244,
+  .dec = 7.84442,
+},
+{ .is_ngc = TRUE,
+  .id = 5060,
+  .ra = 199.318,
+  .dec = 6.03719,
+},
+{ .is_ngc = TRUE,
+  .id = 5061,
+  .ra = 199.521,
+  .dec = -26.8367,
+},
+{ .is_ngc = TRUE,
+  .id = 5062,
+  .ra = 199.598,
+  .dec = -35.4583,
+},
+{ .is_ngc = TRUE,
+  .id = 5063,
+  .ra = 199.608,
+  .dec = -35.3531,
+},
+{ .is_ngc = TRUE,
+  .id = 5064,
+  .ra = 199.75,
+  .dec = -47.9106,
+},
+{ .is_ngc = TRUE,
+  .id = 5065,
+  .ra = 199.377,
+  .dec = 31.0927,
+},
+{ .is_ngc = TRUE,
+  .id = 5067,
+  .ra = 199.616,
+  .dec = -10.1453,
+},
+{ .is_ngc = TRUE,
+  .id = 5068,
+  .ra = 199.728,
+  .dec = -21.0389,
+},
+{ .is_ngc = TRUE,
+  .id = 5071,
+  .ra = 199.655,
+  .dec = 7.9355,
+},
+{ .is_ngc = TRUE,
+  .id = 5073,
+  .ra = 199.837,
+  .dec = -14.8469,
+},
+{ .is_ngc = TRUE,
+  .id = 5074,
+  .ra = 199.607,
+  .dec = 31.4686,
+},
+{ .is_ngc = TRUE,
+  .id = 5075,
+  .ra = 199.776,
+  .dec = 7.83113,
+},
+{ .is_ngc = TRUE,
+  .id = 5076,
+  .ra = 199.877,
+  .dec = -12.7411,
+},
+{ .is_ngc = TRUE,
+  .id = 5077,
+  .ra = 199.882,
+  .dec = -12.6571,
+},
+{ .is_ngc = TRUE,
+  .id = 5078,
+  .ra = 199.958,
+  .dec = -27.4095,
+},
+{ .is_ngc = TRUE,
+  .id = 5079,
+  .ra = 199.908,
+  .dec = -12.6994,
+},
+{ .is_ngc = TRUE,
+  .id = 5080,
+  .ra = 199.83,
+  .dec = 8.42904,
+},
+{ .is_ngc = TRUE,
+  .id = 5081,
+  .ra = 199.784,
+  .dec = 28.5061,
+},
+{ .is_ngc = TRUE,
+  .id = 5082,
+  .ra = 200.166,
+  .dec = -43.7,
+},
+{ .is_ngc = TRUE,
+  .id = 5083,
+  .ra = 199.763,
+  .dec = 39.589,
+},
+{ .is_ngc = TRUE,
+  .id = 5084,
+  .ra = 200.07,
+  .dec = -21.8278,
+},
+{ .is_ngc = TRUE,
+  .id = 5085,
+  .ra = 200.074,
+  .dec = -24.4397,
+},
+{ .is_ngc = TRUE,
+  .id = 5086,
+  .ra = 200.246,
+  .dec = -43.7333,
+},
+{ .is_ngc = TRUE,
+  .id = 5087,
+  .ra = 200.104,
+  .dec = -20.6108,
+},
+{ .is_ngc = TRUE,
+  .id = 5088,
+  .ra = 200.084,
+  .dec = -12.5719,
+},
+{ .is_ngc = TRUE,
+  .id = 5089,
+  .ra = 199.914,
+  .dec = 30.2562,
+},
+{ .is_ngc = TRUE,
+  .id = 5090,
+  .ra = 200.304,
+  .dec = -43.7051,
+},
+{ .is_ngc = TRUE,
+  .id = 5091,
+  .ra = 200.325,
+  .dec = -43.7201,
+},
+{ .is_ngc = TRUE,
+  .id = 5092,
+  .ra = 199.965,
+  .dec = 22.9996,
+},
+{ .is_ngc = TRUE,
+  .id = 5093,
+  .ra = 199.907,
+  .dec = 40.3863,
+},
+{ .is_ngc = TRUE,
+  .id = 5094,
+  .ra = 200.195,
+  .dec = -14.0809,
+},
+{ .is_ngc = TRUE,
+  .id = 5095,
+  .ra = 200.153,
+  .dec = -2.29,
+},
+{ .is_ngc = TRUE,
+  .id = 5097,
+  .ra = 200.248,
+  .dec = -12.4716,
+},
+{ .is_ngc = TRUE,
+  .id = 5099,
+  .ra = 200.331,
+  .dec = -13.0424,
+},
+{ .is_ngc = TRUE,
+  .id = 5101,
+  .ra = 200.443,
+  .dec = -27.4306,
+},
+{ .is_ngc = TRUE,
+  .id = 5102,
+  .ra = 200.49,
+  .dec = -36.6307,
+},
+{ .is_ngc = TRUE,
+  .id = 5103,
+  .ra = 200.125,
+  .dec = 43.0838,
+},
+{ .is_ngc = TRUE,
+  .id = 5104,
+  .ra = 200.346,
+  .dec = 0.341806,
+},
+{ .is_ngc = TRUE,
+  .id = 5105,
+  .ra = 200.455,
+  .dec = -13.2069,
+},
+{ .is_ngc = TRUE,
+  .id = 5107,
+  .ra = 200.353,
+  .dec = 38.538,
+},
+{ .is_ngc = TRUE,
+  .id = 5108,
+  .ra = 200.827,
+  .dec = -32.3414,
+},
+{ .is_ngc = TRUE,
+  .id = 5112,
+  .ra = 200.486,
+  .dec = 38.7346,
+},
+{ .is_ngc = TRUE,
+  .id = 5114,
+  .ra = 201.007,
+  .dec = -32.3442,
+},
+{ .is_ngc = TRUE,
+  .id = 5115,
+  .ra = 200.752,
+  .dec = 13.9508,
+},
+{ .is_ngc = TRUE,
+  .id = 5116,
+  .ra = 200.732,
+  .dec = 26.9809,
+},
+{ .is_ngc = TRUE,
+  .id = 5117,
+  .ra = 200.736,
+  .dec = 28.3165,
+},
+{ .is_ngc = TRUE,
+  .id = 5119,
+  .ra = 201.001,
+  .dec = -12.2767,
+},
+{ .is_ngc = TRUE,
+  .id = 5120,
+  .ra = 201.412,
+  .dec = -63.4514,
+},
+{ .is_ngc = TRUE,
+  .id = 5121,
+  .ra = 201.19,
+  .dec = -37.6831,
+},
+{ .is_ngc = TRUE,
+  .id = 5122,
+  .ra = 201.062,
+  .dec = -10.6546,
+},
+{ .is_ngc = TRUE,
+  .id = 5123,
+  .ra = 200.794,
+  .dec = 43.0859,
+},
+{ .is_ngc = TRUE,
+  .id = 5125,
+  .ra = 201.003,
+  .dec = 9.70956,
+},
+{ .is_ngc = TRUE,
+  .id = 5126,
+  .ra = 201.223,
+  .dec = -30.3337,
+},
+{ .is_ngc = TRUE,
+  .id = 5127,
+  .ra = 200.938,
+  .dec = 31.5653,
+},
+{ .is_ngc = TRUE,
+  .id = 5128,
+  .ra = 201.365,
+  .dec = -43.0189,
+},
+{ .is_ngc = TRUE,
+  .id = 5129,
+  .ra = 201.042,
+  .dec = 13.9762,
+},
+{ .is_ngc = TRUE,
+  .id = 5130,
+  .ra = 201.113,
+  .dec = -10.2106,
+},
+{ .is_ngc = TRUE,
+  .id = 5131,
+  .ra = 200.987,
+  .dec = 30.9876,
+},
+{ .is_ngc = TRUE,
+  .id = 5132,
+  .ra = 201.12,
+  .dec = 14.0921,
+},
+{ .is_ngc = TRUE,
+  .id = 5133,
+  .ra = 201.22,
+  .dec = -4.0825,
+},
+{ .is_ngc = TRUE,
+  .id = 5134,
+  .ra = 201.328,
+  .dec = -21.1342,
+},
+{ .is_ngc = TRUE,
+  .id = 5135,
+  .ra = 201.434,
+  .dec = -29.8337,
+},
+{ .is_ngc = TRUE,
+  .id = 5137,
+  .ra = 201.219,
+  .dec = 14.0758,
+},
+{ .is_ngc = TRUE,
+  .id = 5138,
+  .ra = 201.817,
+  .dec = -59.0333,
+},
+{ .is_ngc = TRUE,
+  .id = 5139,
+  .ra = 201.696,
+  .dec = -47.4815,
+},
+{ .is_ngc = TRUE,
+  .id = 5140,
+  .ra = 201.589,
+  .dec = -33.8683,
+},
+{ .is_ngc = TRUE,
+  .id = 5141,
+  .ra = 201.214,
+  .dec = 36.3782,
+},
+{ .is_ngc = TRUE,
+  .id = 5142,
+  .ra = 201.255,
+  .dec = 36.3994,
+},
+{ .is_ngc = TRUE,
+  .id = 5143,
+  .ra = 201.256,
+  .dec = 36.4372,
+},
+{ .is_ngc = TRUE,
+  .id = 5145,
+  .ra = 201.308,
+  .dec = 43.2669,
+},
+{ .is_ngc = TRUE,
+  .id = 5146,
+  .ra = 201.656,
+  .dec = -12.324,
+},
+{ .is_ngc = TRUE,
+  .id = 5147,
+  .ra = 201.582,
+  .dec = 2.10006,
+},
+{ .is_ngc = TRUE,
+  .id = 5148,
+  .ra = 201.661,
+  .dec = 2.31336,
+},
+{ .is_ngc = TRUE,
+  .id = 5149,
+  .ra = 201.538,
+  .dec = 35.9341,
+},
+{ .is_ngc = TRUE,
+  .id = 5150,
+  .ra = 201.902,
+  .dec = -29.5623,
+},
+{ .is_ngc = TRUE,
+  .id = 5151,
+  .ra = 201.67,
+  .dec = 16.8737,
+},
+{ .is_ngc = TRUE,
+  .id = 5152,
+  .ra = 201.964,
+  .dec = -29.6192,
+},
+{ .is_ngc = TRUE,
+  .id = 5153,
+  .ra = 201.977,
+  .dec = -29.6184,
+},
+{ .is_ngc = TRUE,
+  .id = 5154,
+  .ra = 201.619,
+  .dec = 36.0099,
+},
+{ .is_ngc = TRUE,
+  .id = 5156,
+  .ra = 202.184,
+  .dec = -48.9169,
+},
+{ .is_ngc = TRUE,
+  .id = 5157,
+  .ra = 201.821,
+  .dec = 32.0298,
+},
+{ .is_ngc = TRUE,
+  .id = 5158,
+  .ra = 201.946,
+  .dec = 17.779,
+},
+{ .is_ngc = TRUE,
+  .id = 5159,
+  .ra = 202.067,
+  .dec = 2.98297,
+},
+{ .is_ngc = TRUE,
+  .id = 5160,
+  .ra = 202.09,
+  .dec = 5.99528,
+},
+{ .is_ngc = TRUE,
+  .id = 5161,
+  .ra = 202.308,
+  .dec = -33.1743,
+},
+{ .is_ngc = TRUE,
+  .id = 5163,
+  .ra = 201.727,
+  .dec = 52.7535,
+},
+{ .is_ngc = TRUE,
+  .id = 5164,
+  .ra = 201.8,
+  .dec = 55.4868,
+},
+{ .is_ngc = TRUE,
+  .id = 5165,
+  .ra = 202.164,
+  .dec = 11.3868,
+},
+{ .is_ngc = TRUE,
+  .id = 5167,
+  .ra = 202.167,
+  .dec = 12.7108,
+},
+{ .is_ngc = TRUE,
+  .id = 5168,
+  .ra = 202.775,
+  .dec = -60.9344,
+},
+{ .is_ngc = TRUE,
+  .id = 5169,
+  .ra = 202.042,
+  .dec = 46.6718,
+},
+{ .is_ngc = TRUE,
+  .id = 5170,
+  .ra = 202.454,
+  .dec = -17.9656,
+},
+{ .is_ngc = TRUE,
+  .id = 5171,
+  .ra = 202.34,
+  .dec = 11.7348,
+},
+{ .is_ngc = TRUE,
+  .id = 5172,
+  .ra = 202.33,
+  .dec = 17.0517,
+},
+{ .is_ngc = TRUE,
+  .id = 5173,
+  .ra = 202.106,
+  .dec = 46.5918,
+},
+{ .is_ngc = TRUE,
+  .id = 5175,
+  .ra = 202.359,
+  .dec = 10.9952,
+},
+{ .is_ngc = TRUE,
+  .id = 5176,
+  .ra = 202.354,
+  .dec = 11.7814,
+},
+{ .is_ngc = TRUE,
+  .id = 5177,
+  .ra = 202.351,
+  .dec = 11.7969,
+},
+{ .is_ngc = TRUE,
+  .id = 5178,
+  .ra = 202.372,
+  .dec = 11.6246,
+},
+{ .is_ngc = TRUE,
+  .id = 5179,
+  .ra = 202.379,
+  .dec = 11.7459,
+},
+{ .is_ngc = TRUE,
+  .id = 5180,
+  .ra = 202.362,
+  .dec = 16.8254,
+},
+{ .is_ngc = TRUE,
+  .id = 5181,
+  .ra = 202.425,
+  .dec = 13.3037,
+},
+{ .is_ngc = TRUE,
+  .id = 5182,
+  .ra = 202.671,
+  .dec = -28.1504,
+},
+{ .is_ngc = TRUE,
+  .id = 5183,
+  .ra = 202.526,
+  .dec = -1.72086,
+},
+{ .is_ngc = TRUE,
+  .id = 5184,
+  .ra = 202.548,
+  .dec = -1.66319,
+},
+{ .is_ngc = TRUE,
+  .id = 5185,
+  .ra = 202.51,
+  .dec = 13.4159,
+},
+{ .is_ngc = TRUE,
+  .id = 5186,
+  .ra = 202.517,
+  .dec = 12.1742,
+},
+{ .is_ngc = TRUE,
+  .id = 5187,
+  .ra = 202.451,
+  .dec = 31.1301,
+},
+{ .is_ngc = TRUE,
+  .id = 5188,
+  .ra = 202.868,
+  .dec = -34.7953,
+},
+{ .is_ngc = TRUE,
+  .id = 5190,
+  .ra = 202.66,
+  .dec = 18.1341,
+},
+{ .is_ngc = TRUE,
+  .id = 5191,
+  .ra = 202.698,
+  .dec = 11.2004,
+},
+{ .is_ngc = TRUE,
+  .id = 5192,
+  .ra = 202.715,
+  .dec = -1.779,
+},
+{ .is_ngc = TRUE,
+  .id = 5193,
+  .ra = 202.973,
+  .dec = -33.2344,
+},
+{ .is_ngc = TRUE,
+  .id = 5194,
+  .ra = 202.469,
+  .dec = 47.1957,
+},
+{ .is_ngc = TRUE,
+  .id = 5195,
+  .ra = 202.497,
+  .dec = 47.2668,
+},
+{ .is_ngc = TRUE,
+  .id = 5196,
+  .ra = 202.832,
+  .dec = -1.61542,
+},
+{ .is_ngc = TRUE,
+  .id = 5197,
+  .ra = 202.855,
+  .dec = -1.69345,
+},
+{ .is_ngc = TRUE,
+  .id = 5198,
+  .ra = 202.547,
+  .dec = 46.6707,
+},
+{ .is_ngc = TRUE,
+  .id = 5199,
+  .ra = 202.678,
+  .dec = 34.8304,
+},
+{ .is_ngc = TRUE,
+  .id = 5200,
+  .ra = 202.927,
+  .dec = -0.03,
+},
+{ .is_ngc = TRUE,
+  .id = 5201,
+  .ra = 202.318,
+  .dec = 53.0816,
+},
+{ .is_ngc = TRUE,
+  .id = 5202,
+  .ra = 203.002,
+  .dec = -1.69922,
+},
+{ .is_ngc = TRUE,
+  .id = 5203,
+  .ra = 203.056,
+  .dec = -8.78611,
+},
+{ .is_ngc = TRUE,
+  .id = 5204,
+  .ra = 202.402,
+  .dec = 58.4191,
+},
+{ .is_ngc = TRUE,
+  .id = 5205,
+  .ra = 202.515,
+  .dec = 62.5117,
+},
+{ .is_ngc = TRUE,
+  .id = 5206,
+  .ra = 203.433,
+  .dec = -48.1517,
+},
+{ .is_ngc = TRUE,
+  .id = 5207,
+  .ra = 203.059,
+  .dec = 13.8915,
+},
+{ .is_ngc = TRUE,
+  .id = 5208,
+  .ra = 203.117,
+  .dec = 7.31634,
+},
+{ .is_ngc = TRUE,
+  .id = 5209,
+  .ra = 203.178,
+  .dec = 7.32682,
+},
+{ .is_ngc = TRUE,
+  .id = 5210,
+  .ra = 203.206,
+  .dec = 7.16986,
+},
+{ .is_ngc = TRUE,
+  .id = 5211,
+  .ra = 203.272,
+  .dec = -1.03575,
+},
+{ .is_ngc = TRUE,
+  .id = 5212,
+  .ra = 203.338,
+  .dec = 7.31194,
+},
+{ .is_ngc = TRUE,
+  .id = 5212,
+  .ra = 203.234,
+  .dec = 7.28811,
+},
+{ .is_ngc = TRUE,
+  .id = 5213,
+  .ra = 203.663,
+  .dec = 4.13028,
+},
+{ .is_ngc = TRUE,
+  .id = 5214,
+  .ra = 203.202,
+  .dec = 41.8721,
+},
+{ .is_ngc = TRUE,
+  .id = 5216,
+  .ra = 203.03,
+  .dec = 62.7004,
+},
+{ .is_ngc = TRUE,
+  .id = 5217,
+  .ra = 203.525,
+  .dec = 17.857,
+},
+{ .is_ngc = TRUE,
+  .id = 5218,
+  .ra = 203.044,
+  .dec = 62.7676,
+},
+{ .is_ngc = TRUE,
+  .id = 5220,
+  .ra = 203.985,
+  .dec = -33.4539,
+},
+{ .is_ngc = TRUE,
+  .id = 5221,
+  .ra = 203.733,
+  .dec = 13.8322,
+},
+{ .is_ngc = TRUE,
+  .id = 5222,
+  .ra = 203.733,
+  .dec = 13.7414,
+},
+{ .is_ngc = TRUE,
+  .id = 5223,
+  .ra = 203.605,
+  .dec = 34.6904,
+},
+{ .is_ngc = TRUE,
+  .id = 5224,
+  .ra = 203.787,
+  .dec = 6.48094,
+},
+{ .is_ngc = TRUE,
+  .id = 5225,
+  .ra = 203.334,
+  .dec = 51.4904,
+},
+{ .is_ngc = TRUE,
+  .id = 5226,
+  .ra = 203.765,
+  .dec = 13.9214,
+},
+{ .is_ngc = TRUE,
+  .id = 5227,
+  .ra = 203.852,
+  .dec = 1.41036,
+},
+{ .is_ngc = TRUE,
+  .id = 5228,
+  .ra = 203.646,
+  .dec = 34.7774,
+},
+{ .is_ngc = TRUE,
+  .id = 5229,
+  .ra = 203.512,
+  .dec = 47.9147,
+},
+{ .is_ngc = TRUE,
+  .id = 5230,
+  .ra = 203.883,
+  .dec = 13.6754,
+},
+{ .is_ngc = TRUE,
+  .id = 5231,
+  .ra = 203.951,
+  .dec = 2.99919,
+},
+{ .is_ngc = TRUE,
+  .id = 5232,
+  .ra = 204.034,
+  .dec = -8.49781,
+},
+{ .is_ngc = TRUE,
+  .id = 5233,
+  .ra = 203.806,
+  .dec = 34.6767,
+},
+{ .is_ngc = TRUE,
+  .id = 5234,
+  .ra = 204.374,
+  .dec = -49.8375,
+},
+{ .is_ngc = TRUE,
+  .id = 5235,
+  .ra = 204.006,
+  .dec = 6.58481,
+},
+{ .is_ngc = TRUE,
+  .id = 5236,
+  .ra = 204.251,
+  .dec = -29.8643,
+},
+{ .is_ngc = TRUE,
+  .id = 5237,
+  .ra = 204.412,
+  .dec = -42.8477,
+},
+{ .is_ngc = TRUE,
+  .id = 5238,
+  .ra = 203.678,
+  .dec = 51.6138,
+},
+{ .is_ngc = TRUE,
+  .id = 5239,
+  .ra = 204.109,
+  .dec = 7.36908,
+},
+{ .is_ngc = TRUE,
+  .id = 5240,
+  .ra = 203.98,
+  .dec = 35.5878,
+},
+{ .is_ngc = TRUE,
+  .id = 5241,
+  .ra = 204.166,
+  .dec = -8.40194,
+},
+{ .is_ngc = TRUE,
+  .id = 5242,
+  .ra = 204.279,
+  .dec = 2.76722,
+},
+{ .is_ngc = TRUE,
+  .id = 5243,
+  .ra = 204.063,
+  .dec = 38.3434,
+},
+{ .is_ngc = TRUE,
+  .id = 5245,
+  .ra = 204.347,
+  .dec = 3.89739,
+},
+{ .is_ngc = TRUE,
+  .id = 5246,
+  .ra = 204.372,
+  .dec = 4.10436,
+},
+{ .is_ngc = TRUE,
+  .id = 5247,
+  .ra = 204.513,
+  .dec = -17.8844,
+},
+{ .is_ngc = TRUE,
+  .id = 5248,
+  .ra = 204.384,
+  .dec = 8.88556,
+},
+{ .is_ngc = TRUE,
+  .id = 5249,
+  .ra = 204.406,
+  .dec = 15.9718,
+},
+{ .is_ngc = TRUE,
+  .id = 5250,
+  .ra = 204.03,
+  .dec = 51.2358,
+},
+{ .is_ngc = TRUE,
+  .id = 5251,
+  .ra = 204.353,
+  .dec = 27.4192,
+},
+{ .is_ngc = TRUE,
+  .id = 5252,
+  .ra = 204.566,
+  .dec = 4.54207,
+},
+{ .is_ngc = TRUE,
+  .id = 5253,
+  .ra = 204.983,
+  .dec = -31.6405,
+},
+{ .is_ngc = TRUE,
+  .id = 5254,
+  .ra = 204.908,
+  .dec = -11.4941,
+},
+{ .is_ngc = TRUE,
+  .id = 5255,
+  .ra = 204.325,
+  .dec = 57.109,
+},
+{ .is_ngc = TRUE,
+  .id = 5257,
+  .ra = 204.971,
+  .dec = 0.84,
+},
+{ .is_ngc = TRUE,
+  .id = 5258,
+  .ra = 204.991,
+  .dec = 0.832,
+},
+{ .is_ngc = TRUE,
+  .id = 5259,
+  .ra = 204.853,
+  .dec = 30.9907,
+},
+{ .is_ngc = TRUE,
+  .id = 5260,
+  .ra = 205.083,
+  .dec = -23.8581,
+},
+{ .is_ngc = TRUE,
+  .id = 5261,
+  .ra = 205.067,
+  .dec = 5.07632,
+},
+{ .is_ngc = TRUE,
+  .id = 5262,
+  .ra = 203.91,
+  .dec = 75.0391,
+},
+{ .is_ngc = TRUE,
+  .id = 5263,
+  .ra = 204.982,
+  .dec = 28.3998,
+},
+{ .is_ngc = TRUE,
+  .id = 5264,
+  .ra = 205.403,
+  .dec = -29.9132,
+},
+{ .is_ngc = TRUE,
+  .id = 5265,
+  .ra = 205.038,
+  .dec = 36.8609,
+},
+{ .is_ngc = TRUE,
+  .id = 5266,
+  .ra = 205.757,
+  .dec = -48.1697,
+},
+{ .is_ngc = TRUE,
+  .id = 5267,
+  .ra = 205.167,
+  .dec = 38.7939,
+},
+{ .is_ngc = TRUE,
+  .id = 5268,
+  .ra = 205.552,
+  .dec = -13.8596,
+},
+{ .is_ngc = TRUE,
+  .id = 5269,
+  .ra = 206.183,
+  .dec = -62.9025,
+},
+{ .is_ngc = TRUE,
+  .id = 5270,
+  .ra = 205.545,
+  .dec = 4.26219,
+},
+{ .is_ngc = TRUE,
+  .id = 5271,
+  .ra = 205.427,
+  .dec = 30.1247,
+},
+{ .is_ngc = TRUE,
+  .id = 5272,
+  .ra = 205.547,
+  .dec = 28.3764,
+},
+{ .is_ngc = TRUE,
+  .id = 5273,
+  .ra = 205.535,
+  .dec = 35.6538,
+},
+{ .is_ngc = TRUE,
+  .id = 5274,
+  .ra = 205.597,
+  .dec = 29.8475,
+},
+{ .is_ngc = TRUE,
+  .id = 5276,
+  .ra = 205.592,
+  .dec = 35.624,
+},
+{ .is_ngc = TRUE,
+  .id = 5277,
+  .ra = 205.66,
+  .dec = 29.9539,
+},
+{ .is_ngc = TRUE,
+  .id = 5278,
+  .ra = 205.416,
+  .dec = 55.6703,
+},
+{ .is_ngc = TRUE,
+  .id = 5279,
+  .ra = 205.432,
+  .dec = 55.6731,
+},
+{ .is_ngc = TRUE,
+  .id = 5280,
+  .ra = 205.732,
+  .dec = 29.8685,
+},
+{ .is_ngc = TRUE,
+  .id = 5281,
+  .ra = 206.646,
+  .dec = -62.9167,
+},
+{ .is_ngc = TRUE,
+  .id = 5282,
+  .ra = 205.854,
+  .dec = 30.0694,
+},
+{ .is_ngc = TRUE,
+  .id = 5283,
+  .ra = 205.274,
+  .dec = 67.6729,
+},
+{ .is_ngc = TRUE,
+  .id = 5284,
+  .ra = 206.767,
+  .dec = -59.1333,
+},
+{ .is_ngc = TRUE,
+  .id = 5285,
+  .ra = 206.107,
+  .dec = 2.11008,
+},
+{ .is_ngc = TRUE,
+  .id = 5286,
+  .ra = 206.611,
+  .dec = -51.375,
+},
+{ .is_ngc = TRUE,
+  .id = 5287,
+  .ra = 206.219,
+  .dec = 29.7707,
+},
+{ .is_ngc = TRUE,
+  .id = 5288,
+  .ra = 207.183,
+  .dec = -64.6836,
+},
+{ .is_ngc = TRUE,
+  .id = 5289,
+  .ra = 206.287,
+  .dec = 41.5033,
+},
+{ .is_ngc = TRUE,
+  .id = 5290,
+  .ra = 206.329,
+  .dec = 41.7132,
+},
+{ .is_ngc = TRUE,
+  .id = 5291,
+  .ra = 206.851,
+  .dec = -30.4072,
+},
+{ .is_ngc = TRUE,
+  .id = 5292,
+  .ra = 206.916,
+  .dec = -30.9403,
+},
+{ .is_ngc = TRUE,
+  .id = 5293,
+  .ra = 206.72,
+  .dec = 16.2726,
+},
+{ .is_ngc = TRUE,
+  .id = 5294,
+  .ra = 206.325,
+  .dec = 55.29,
+},
+{ .is_ngc = TRUE,
+  .id = 5295,
+  .ra = 204.663,
+  .dec = 79.4586,
+},
+{ .is_ngc = TRUE,
+  .id = 5297,
+  .ra = 206.599,
+  .dec = 43.8724,
+},
+{ .is_ngc = TRUE,
+  .id = 5298,
+  .ra = 207.152,
+  .dec = -30.4288,
+},
+{ .is_ngc = TRUE,
+  .id = 5298,
+  .ra = 207.047,
+  .dec = -30.4521,
+},
+{ .is_ngc = TRUE,
+  .id = 5299,
+  .ra = 207.533,
+  .dec = -60.4,
+},
+{ .is_ngc = TRUE,
+  .id = 5300,
+  .ra = 207.066,
+  .dec = 3.95064,
+},
+{ .is_ngc = TRUE,
+  .id = 5301,
+  .ra = 206.602,
+  .dec = 46.1072,
+},
+{ .is_ngc = TRUE,
+  .id = 5302,
+  .ra = 207.207,
+  .dec = -30.5117,
+},
+{ .is_ngc = TRUE,
+  .id = 5304,
+  .ra = 207.507,
+  .dec = -30.5783,
+},
+{ .is_ngc = TRUE,
+  .id = 5305,
+  .ra = 206.982,
+  .dec = 37.8259,
+},
+{ .is_ngc = TRUE,
+  .id = 5306,
+  .ra = 207.297,
+  .dec = -7.22403,
+},
+{ .is_ngc = TRUE,
+  .id = 5307,
+  .ra = 207.763,
+  .dec = -51.2054,
+},
+{ .is_ngc = TRUE,
+  .id = 5308,
+  .ra = 206.752,
+  .dec = 60.973,
+},
+{ .is_ngc = TRUE,
+  .id = 5309,
+  .ra = 207.479,
+  .dec = -15.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 5309,
+  .ra = 207.545,
+  .dec = -15.6182,
+},
+{ .is_ngc = TRUE,
+  .id = 5310,
+  .ra = 207.449,
+  .dec = 0.0688056,
+},
+{ .is_ngc = TRUE,
+  .id = 5311,
+  .ra = 207.233,
+  .dec = 39.9856,
+},
+{ .is_ngc = TRUE,
+  .id = 5312,
+  .ra = 207.461,
+  .dec = 33.622,
+},
+{ .is_ngc = TRUE,
+  .id = 5313,
+  .ra = 207.435,
+  .dec = 39.985,
+},
+{ .is_ngc = TRUE,
+  .id = 5314,
+  .ra = 206.547,
+  .dec = 70.3393,
+},
+{ .is_ngc = TRUE,
+  .id = 5315,
+  .ra = 208.487,
+  .dec = -66.514,
+},
+{ .is_ngc = TRUE,
+  .id = 5316,
+  .ra = 208.487,
+  .dec = -61.8669,
+},
+{ .is_ngc = TRUE,
+  .id = 5319,
+  .ra = 207.669,
+  .dec = 33.7619,
+},
+{ .is_ngc = TRUE,
+  .id = 5320,
+  .ra = 207.585,
+  .dec = 41.3663,
+},
+{ .is_ngc = TRUE,
+  .id = 5321,
+  .ra = 207.682,
+  .dec = 33.6327,
+},
+{ .is_ngc = TRUE,
+  .id = 5322,
+  .ra = 207.314,
+  .dec = 60.1906,
+},
+{ .is_ngc = TRUE,
+  .id = 5323,
+  .ra = 206.402,
+  .dec = 76.8276,
+},
+{ .is_ngc = TRUE,
+  .id = 5324,
+  .ra = 208.025,
+  .dec = -6.05822,
+},
+{ .is_ngc = TRUE,
+  .id = 5326,
+  .ra = 207.711,
+  .dec = 39.5743,
+},
+{ .is_ngc = TRUE,
+  .id = 5327,
+  .ra = 208.018,
+  .dec = -2.20636,
+},
+{ .is_ngc = TRUE,
+  .id = 5328,
+  .ra = 208.222,
+  .dec = -28.4894,
+},
+{ .is_ngc = TRUE,
+  .id = 5329,
+  .ra = 208.042,
+  .dec = 2.32488,
+},
+{ .is_ngc = TRUE,
+  .id = 5330,
+  .ra = 208.248,
+  .dec = -28.47,
+},
+{ .is_ngc = TRUE,
+  .id = 5332,
+  .ra = 208.033,
+  .dec = 16.9695,
+},
+{ .is_ngc = TRUE,
+  .id = 5333,
+  .ra = 208.601,
+  .dec = -48.5125,
+},
+{ .is_ngc = TRUE,
+  .id = 5335,
+  .ra = 208.236,
+  .dec = 2.81421,
+},
+{ .is_ngc = TRUE,
+  .id = 5336,
+  .ra = 208.041,
+  .dec = 43.2427,
+},
+{ .is_ngc = TRUE,
+  .id = 5337,
+  .ra = 208.096,
+  .dec = 39.6873,
+},
+{ .is_ngc = TRUE,
+  .id = 5338,
+  .ra = 208.36,
+  .dec = 5.2075,
+},
+{ .is_ngc = TRUE,
+  .id = 5339,
+  .ra = 208.501,
+  .dec = -7.93089,
+},
+{ .is_ngc = TRUE,
+  .id = 5340,
+  .ra = 207.25,
+  .dec = 72.6537,
+},
+{ .is_ngc = TRUE,
+  .id = 5341,
+  .ra = 208.133,
+  .dec = 37.8165,
+},
+{ .is_ngc = TRUE,
+  .id = 5342,
+  .ra = 207.858,
+  .dec = 59.8641,
+},
+{ .is_ngc = TRUE,
+  .id = 5343,
+  .ra = 208.549,
+  .dec = -7.58833,
+},
+{ .is_ngc = TRUE,
+  .id = 5344,
+  .ra = 207.55,
+  .dec = 73.953,
+},
+{ .is_ngc = TRUE,
+  .id = 5345,
+  .ra = 208.56,
+  .dec = -1.43674,
+},
+{ .is_ngc = TRUE,
+  .id = 5346,
+  .ra = 208.258,
+  .dec = 39.5807,
+},
+{ .is_ngc = TRUE,
+  .id = 5347,
+  .ra = 208.325,
+  .dec = 33.4906,
+},
+{ .is_ngc = TRUE,
+  .id = 5348,
+  .ra = 208.547,
+  .dec = 5.22686,
+},
+{ .is_ngc = TRUE,
+  .id = 5349,
+  .ra = 208.305,
+  .dec = 37.8827,
+},
+{ .is_ngc = TRUE,
+  .id = 5350,
+  .ra = 208.341,
+  .dec = 40.3636,
+},
+{ .is_ngc = TRUE,
+  .id = 5351,
+  .ra = 208.366,
+  .dec = 37.9143,
+},
+{ .is_ngc = TRUE,
+  .id = 5352,
+  .ra = 208.41,
+  .dec = 36.134,
+},
+{ .is_ngc = TRUE,
+  .id = 5353,
+  .ra = 208.361,
+  .dec = 40.283,
+},
+{ .is_ngc = TRUE,
+  .id = 5354,
+  .ra = 208.361,
+  .dec = 40.3025,
+},
+{ .is_ngc = TRUE,
+  .id = 5355,
+  .ra = 208.44,
+  .dec = 40.3383,
+},
+{ .is_ngc = TRUE,
+  .id = 5356,
+  .ra = 208.744,
+  .dec = 5.33333,
+},
+{ .is_ngc = TRUE,
+  .id = 5357,
+  .ra = 208.998,
+  .dec = -30.3415,
+},
+{ .is_ngc = TRUE,
+  .id = 5358,
+  .ra = 208.502,
+  .dec = 40.2772,
+},
+{ .is_ngc = TRUE,
+  .id = 5359,
+  .ra = 210.037,
+  .dec = -70.3847,
+},
+{ .is_ngc = TRUE,
+  .id = 5361,
+  .ra = 208.647,
+  .dec = 38.4493,
+},
+{ .is_ngc = TRUE,
+  .id = 5362,
+  .ra = 208.723,
+  .dec = 41.3137,
+},
+{ .is_ngc = TRUE,
+  .id = 5363,
+  .ra = 209.03,
+  .dec = 5.25447,
+},
+{ .is_ngc = TRUE,
+  .id = 5365,
+  .ra = 209.461,
+  .dec = -43.9311,
+},
+{ .is_ngc = TRUE,
+  .id = 5366,
+  .ra = 209.104,
+  .dec = -0.247778,
+},
+{ .is_ngc = TRUE,
+  .id = 5368,
+  .ra = 208.622,
+  .dec = 54.3307,
+},
+{ .is_ngc = TRUE,
+  .id = 5369,
+  .ra = 209.157,
+  .dec = -5.47028,
+},
+{ .is_ngc = TRUE,
+  .id = 5370,
+  .ra = 208.538,
+  .dec = 60.678,
+},
+{ .is_ngc = TRUE,
+  .id = 5372,
+  .ra = 208.692,
+  .dec = 58.6664,
+},
+{ .is_ngc = TRUE,
+  .id = 5373,
+  .ra = 209.281,
+  .dec = 5.25167,
+},
+{ .is_ngc = TRUE,
+  .id = 5374,
+  .ra = 209.373,
+  .dec = 6.09708,
+},
+{ .is_ngc = TRUE,
+  .id = 5376,
+  .ra = 208.816,
+  .dec = 59.5069,
+},
+{ .is_ngc = TRUE,
+  .id = 5377,
+  .ra = 209.07,
+  .dec = 47.2352,
+},
+{ .is_ngc = TRUE,
+  .id = 5378,
+  .ra = 209.212,
+  .dec = 37.7969,
+},
+{ .is_ngc = TRUE,
+  .id = 5379,
+  .ra = 208.894,
+  .dec = 59.743,
+},
+{ .is_ngc = TRUE,
+  .id = 5380,
+  .ra = 209.236,
+  .dec = 37.6099,
+},
+{ .is_ngc = TRUE,
+  .id = 5381,
+  .ra = 210.171,
+  .dec = -59.5839,
+},
+{ .is_ngc = TRUE,
+  .id = 5382,
+  .ra = 209.562,
+  .dec = 6.25794,
+},
+{ .is_ngc = TRUE,
+  .id = 5383,
+  .ra = 209.27,
+  .dec = 41.846,
+},
+{ .is_ngc = TRUE,
+  .id = 5384,
+  .ra = 209.554,
+  .dec = 6.518,
+},
+{ .is_ngc = TRUE,
+  .id = 5385,
+  .ra = 208.129,
+  .dec = 76.1522,
+},
+{ .is_ngc = TRUE,
+  .id = 5385,
+  .ra = 208.15,
+  .dec = 76.1581,
+},
+{ .is_ngc = TRUE,
+  .id = 5386,
+  .ra = 209.593,
+  .dec = 6.33853,
+},
+{ .is_ngc = TRUE,
+  .id = 5387,
+  .ra = 209.603,
+  .dec = 6.07058,
+},
+{ .is_ngc = TRUE,
+  .id = 5388,
+  .ra = 209.738,
+  .dec = -14.1503,
+},
+{ .is_ngc = TRUE,
+  .id = 5389,
+  .ra = 209.027,
+  .dec = 59.7415,
+},
+{ .is_ngc = TRUE,
+  .id = 5391,
+  .ra = 209.404,
+  .dec = 46.3181,
+},
+{ .is_ngc = TRUE,
+  .id = 5392,
+  .ra = 209.854,
+  .dec = -3.20889,
+},
+{ .is_ngc = TRUE,
+  .id = 5393,
+  .ra = 210.133,
+  .dec = -28.8749,
+},
+{ .is_ngc = TRUE,
+  .id = 5394,
+  .ra = 209.641,
+  .dec = 37.4536,
+},
+{ .is_ngc = TRUE,
+  .id = 5395,
+  .ra = 209.659,
+  .dec = 37.4249,
+},
+{ .is_ngc = TRUE,
+  .id = 5397,
+  .ra = 210.293,
+  .dec = -33.9453,
+},
+{ .is_ngc = TRUE,
+  .id = 5398,
+  .ra = 210.34,
+  .dec = -33.0628,
+},
+{ .is_ngc = TRUE,
+  .id = 5399,
+  .ra = 209.881,
+  .dec = 34.7732,
+},
+{ .is_ngc = TRUE,
+  .id = 5400,
+  .ra = 210.155,
+  .dec = -2.85778,
+},
+{ .is_ngc = TRUE,
+  .id = 5401,
+  .ra = 209.931,
+  .dec = 36.2377,
+},
+{ .is_ngc = TRUE,
+  .id = 5402,
+  .ra = 209.569,
+  .dec = 59.8143,
+},
+{ .is_ngc = TRUE,
+  .id = 5403,
+  .ra = 209.962,
+  .dec = 38.1823,
+},
+{ .is_ngc = TRUE,
+  .id = 5404,
+  .ra = 210.282,
+  .dec = 0.0856667,
+},
+{ .is_ngc = TRUE,
+  .id = 5405,
+  .ra = 210.289,
+  .dec = 7.70144,
+},
+{ .is_ngc = TRUE,
+  .id = 5406,
+  .ra = 210.084,
+  .dec = 38.915,
+},
+{ .is_ngc = TRUE,
+  .id = 5407,
+  .ra = 210.209,
+  .dec = 39.156,
+},
+{ .is_ngc = TRUE,
+  .id = 5408,
+  .ra = 210.838,
+  .dec = -41.3789,
+},
+{ .is_ngc = TRUE,
+  .id = 5409,
+  .ra = 210.442,
+  .dec = 9.49006,
+},
+{ .is_ngc = TRUE,
+  .id = 5410,
+  .ra = 210.227,
+  .dec = 40.9879,
+},
+{ .is_ngc = TRUE,
+  .id = 5411,
+  .ra = 210.496,
+  .dec = 8.93742,
+},
+{ .is_ngc = TRUE,
+  .id = 5412,
+  .ra = 209.306,
+  .dec = 73.6164,
+},
+{ .is_ngc = TRUE,
+  .id = 5413,
+  .ra = 209.474,
+  .dec = 64.9109,
+},
+{ .is_ngc = TRUE,
+  .id = 5414,
+  .ra = 210.515,
+  .dec = 9.92908,
+},
+{ .is_ngc = TRUE,
+  .id = 5415,
+  .ra = 209.237,
+  .dec = 70.7543,
+},
+{ .is_ngc = TRUE,
+  .id = 5416,
+  .ra = 210.548,
+  .dec = 9.4395,
+},
+{ .is_ngc = TRUE,
+  .id = 5417,
+  .ra = 210.554,
+  .dec = 8.03675,
+},
+{ .is_ngc = TRUE,
+  .id = 5418,
+  .ra = 210.573,
+  .dec = 7.68353,
+},
+{ .is_ngc = TRUE,
+  .id = 5419,
+  .ra = 210.911,
+  .dec = -33.9784,
+},
+{ .is_ngc = TRUE,
+  .id = 5420,
+  .ra = 211,
+  .dec = -14.6175,
+},
+{ .is_ngc = TRUE,
+  .id = 5421,
+  .ra = 210.423,
+  .dec = 33.8266,
+},
+{ .is_ngc = TRUE,
+  .id = 5422,
+  .ra = 210.175,
+  .dec = 55.1644,
+},
+{ .is_ngc = TRUE,
+  .id = 5423,
+  .ra = 210.703,
+  .dec = 9.34149,
+},
+{ .is_ngc = TRUE,
+  .id = 5424,
+  .ra = 210.733,
+  .dec = 9.42056,
+},
+{ .is_ngc = TRUE,
+  .id = 5425,
+  .ra = 210.2,
+  .dec = 48.4431,
+},
+{ .is_ngc = TRUE,
+  .id = 5426,
+  .ra = 210.854,
+  .dec = -6.06936,
+},
+{ .is_ngc = TRUE,
+  .id = 5427,
+  .ra = 210.858,
+  .dec = -6.031,
+},
+{ .is_ngc = TRUE,
+  .id = 5428,
+  .ra = 210.867,
+  .dec = -5.98447,
+},
+{ .is_ngc = TRUE,
+  .id = 5429,
+  .ra = 210.889,
+  .dec = -6.03828,
+},
+{ .is_ngc = TRUE,
+  .id = 5430,
+  .ra = 210.19,
+  .dec = 59.3287,
+},
+{ .is_ngc = TRUE,
+  .id = 5431,
+  .ra = 210.78,
+  .dec = 9.36269,
+},
+{ .is_ngc = TRUE,
+  .id = 5432,
+  .ra = 210.919,
+  .dec = -5.97519,
+},
+{ .is_ngc = TRUE,
+  .id = 5433,
+  .ra = 210.65,
+  .dec = 32.5098,
+},
+{ .is_ngc = TRUE,
+  .id = 5435,
+  .ra = 211.001,
+  .dec = -5.93125,
+},
+{ .is_ngc = TRUE,
+  .id = 5436,
+  .ra = 210.921,
+  .dec = 9.57328,
+},
+{ .is_ngc = TRUE,
+  .id = 5439,
+  .ra = 210.49,
+  .dec = 46.3115,
+},
+{ .is_ngc = TRUE,
+  .id = 5440,
+  .ra = 210.754,
+  .dec = 34.7572,
+},
+{ .is_ngc = TRUE,
+  .id = 5441,
+  .ra = 210.8,
+  .dec = 34.6843,
+},
+{ .is_ngc = TRUE,
+  .id = 5442,
+  .ra = 211.18,
+  .dec = -9.71306,
+},
+{ .is_ngc = TRUE,
+  .id = 5443,
+  .ra = 210.549,
+  .dec = 55.8143,
+},
+{ .is_ngc = TRUE,
+  .id = 5444,
+  .ra = 210.851,
+  .dec = 35.1319,
+},
+{ .is_ngc = TRUE,
+  .id = 5445,
+  .ra = 210.881,
+  .dec = 35.0249,
+},
+{ .is_ngc = TRUE,
+  .id = 5447,
+  .ra = 210.617,
+  .dec = 54.2759,
+},
+{ .is_ngc = TRUE,
+  .id = 5448,
+  .ra = 210.709,
+  .dec = 49.1726,
+},
+{ .is_ngc = TRUE,
+  .id = 5449,
+  .ra = 210.615,
+  .dec = 54.3303,
+},
+{ .is_ngc = TRUE,
+  .id = 5450,
+  .ra = 210.622,
+  .dec = 54.2714,
+},
+{ .is_ngc = TRUE,
+  .id = 5450,
+  .ra = 210.63,
+  .dec = 54.2336,
+},
+{ .is_ngc = TRUE,
+  .id = 5451,
+  .ra = 210.653,
+  .dec = 54.3625,
+},
+{ .is_ngc = TRUE,
+  .id = 5452,
+  .ra = 208.603,
+  .dec = 78.2204,
+},
+{ .is_ngc = TRUE,
+  .id = 5453,
+  .ra = 210.736,
+  .dec = 54.3076,
+},
+{ .is_ngc = TRUE,
+  .id = 5454,
+  .ra = 211.19,
+  .dec = 14.3821,
+},
+{ .is_ngc = TRUE,
+  .id = 5455,
+  .ra = 210.754,
+  .dec = 54.2415,
+},
+{ .is_ngc = TRUE,
+  .id = 5456,
+  .ra = 211.245,
+  .dec = 11.8709,
+},
+{ .is_ngc = TRUE,
+  .id = 5457,
+  .ra = 210.802,
+  .dec = 54.3489,
+},
+{ .is_ngc = TRUE,
+  .id = 5458,
+  .ra = 210.801,
+  .dec = 54.2985,
+},
+{ .is_ngc = TRUE,
+  .id = 5459,
+  .ra = 211.251,
+  .dec = 13.1322,
+},
+{ .is_ngc = TRUE,
+  .id = 5460,
+  .ra = 211.863,
+  .dec = -48.335,
+},
+{ .is_ngc = TRUE,
+  .id = 5461,
+  .ra = 210.921,
+  .dec = 54.3169,
+},
+{ .is_ngc = TRUE,
+  .id = 5462,
+  .ra = 210.971,
+  .dec = 54.3654,
+},
+{ .is_ngc = TRUE,
+  .id = 5464,
+  .ra = 211.768,
+  .dec = -30.0175,
+},
+{ .is_ngc = TRUE,
+  .id = 5465,
+  .ra = 211.614,
+  .dec = -5.50669,
+},
+{ .is_ngc = TRUE,
+  .id = 5466,
+  .ra = 211.365,
+  .dec = 28.5324,
+},
+{ .is_ngc = TRUE,
+  .id = 5468,
+  .ra = 211.645,
+  .dec = -5.45278,
+},
+{ .is_ngc = TRUE,
+  .id = 5469,
+  .ra = 213.125,
+  .dec = 8.6485,
+},
+{ .is_ngc = TRUE,
+  .id = 5470,
+  .ra = 211.633,
+  .dec = 6.02908,
+},
+{ .is_ngc = TRUE,
+  .id = 5471,
+  .ra = 211.121,
+  .dec = 54.3968,
+},
+{ .is_ngc = TRUE,
+  .id = 5472,
+  .ra = 211.729,
+  .dec = -5.46097,
+},
+{ .is_ngc = TRUE,
+  .id = 5473,
+  .ra = 211.181,
+  .dec = 54.8924,
+},
+{ .is_ngc = TRUE,
+  .id = 5474,
+  .ra = 211.257,
+  .dec = 53.6624,
+},
+{ .is_ngc = TRUE,
+  .id = 5475,
+  .ra = 211.302,
+  .dec = 55.7421,
+},
+{ .is_ngc = TRUE,
+  .id = 5476,
+  .ra = 212.035,
+  .dec = -6.09222,
+},
+{ .is_ngc = TRUE,
+  .id = 5477,
+  .ra = 211.388,
+  .dec = 54.4606,
+},
+{ .is_ngc = TRUE,
+  .id = 5478,
+  .ra = 212.035,
+  .dec = -1.70253,
+},
+{ .is_ngc = TRUE,
+  .id = 5479,
+  .ra = 211.489,
+  .dec = 65.6906,
+},
+{ .is_ngc = TRUE,
+  .id = 5480,
+  .ra = 211.59,
+  .dec = 50.7249,
+},
+{ .is_ngc = TRUE,
+  .id = 5481,
+  .ra = 211.672,
+  .dec = 50.7226,
+},
+{ .is_ngc = TRUE,
+  .id = 5482,
+  .ra = 212.128,
+  .dec = 8.93158,
+},
+{ .is_ngc = TRUE,
+  .id = 5483,
+  .ra = 212.605,
+  .dec = -43.3253,
+},
+{ .is_ngc = TRUE,
+  .id = 5484,
+  .ra = 211.701,
+  .dec = 55.0299,
+},
+{ .is_ngc = TRUE,
+  .id = 5485,
+  .ra = 211.797,
+  .dec = 55.0015,
+},
+{ .is_ngc = TRUE,
+  .id = 5486,
+  .ra = 211.854,
+  .dec = 55.1028,
+},
+{ .is_ngc = TRUE,
+  .id = 5487,
+  .ra = 212.433,
+  .dec = 8.06917,
+},
+{ .is_ngc = TRUE,
+  .id = 5489,
+  .ra = 213.004,
+  .dec = -46.0892,
+},
+{ .is_ngc = TRUE,
+  .id = 5492,
+  .ra = 212.647,
+  .dec = 19.6116,
+},
+{ .is_ngc = TRUE,
+  .id = 5493,
+  .ra = 212.873,
+  .dec = -5.04417,
+},
+{ .is_ngc = TRUE,
+  .id = 5494,
+  .ra = 213.101,
+  .dec = -30.6441,
+},
+{ .is_ngc = TRUE,
+  .id = 5495,
+  .ra = 213.097,
+  .dec = -27.1078,
+},
+{ .is_ngc = TRUE,
+  .id = 5496,
+  .ra = 212.908,
+  .dec = -1.15811,
+},
+{ .is_ngc = TRUE,
+  .id = 5497,
+  .ra = 212.632,
+  .dec = 38.8934,
+},
+{ .is_ngc = TRUE,
+  .id = 5498,
+  .ra = 212.769,
+  .dec = 25.6976,
+},
+{ .is_ngc = TRUE,
+  .id = 5499,
+  .ra = 212.699,
+  .dec = 35.9134,
+},
+{ .is_ngc = TRUE,
+  .id = 5500,
+  .ra = 212.564,
+  .dec = 48.5463,
+},
+{ .is_ngc = TRUE,
+  .id = 5501,
+  .ra = 213.084,
+  .dec = 1.27194,
+},
+{ .is_ngc = TRUE,
+  .id = 5505,
+  .ra = 213.132,
+  .dec = 13.3046,
+},
+{ .is_ngc = TRUE,
+  .id = 5506,
+  .ra = 213.312,
+  .dec = -3.20756,
+},
+{ .is_ngc = TRUE,
+  .id = 5507,
+  .ra = 213.332,
+  .dec = -3.14897,
+},
+{ .is_ngc = TRUE,
+  .id = 5508,
+  .ra = 213.121,
+  .dec = 24.6352,
+},
+{ .is_ngc = TRUE,
+  .id = 5509,
+  .ra = 213.165,
+  .dec = 20.3872,
+},
+{ .is_ngc = TRUE,
+  .id = 5510,
+  .ra = 213.405,
+  .dec = -17.9841,
+},
+{ .is_ngc = TRUE,
+  .id = 5512,
+  .ra = 213.171,
+  .dec = 30.8552,
+},
+{ .is_ngc = TRUE,
+  .id = 5513,
+  .ra = 213.287,
+  .dec = 20.4159,
+},
+{ .is_ngc = TRUE,
+  .id = 5514,
+  .ra = 213.412,
+  .dec = 7.65917,
+},
+{ .is_ngc = TRUE,
+  .id = 5515,
+  .ra = 213.159,
+  .dec = 39.3096,
+},
+{ .is_ngc = TRUE,
+  .id = 5516,
+  .ra = 213.978,
+  .dec = -48.1153,
+},
+{ .is_ngc = TRUE,
+  .id = 5517,
+  .ra = 213.214,
+  .dec = 35.7106,
+},
+{ .is_ngc = TRUE,
+  .id = 5518,
+  .ra = 213.449,
+  .dec = 20.8484,
+},
+{ .is_ngc = TRUE,
+  .id = 5520,
+  .ra = 213.095,
+  .dec = 50.3484,
+},
+{ .is_ngc = TRUE,
+  .id = 5521,
+  .ra = 213.849,
+  .dec = 4.40836,
+},
+{ .is_ngc = TRUE,
+  .id = 5522,
+  .ra = 213.709,
+  .dec = 15.1465,
+},
+{ .is_ngc = TRUE,
+  .id = 5523,
+  .ra = 213.715,
+  .dec = 25.3172,
+},
+{ .is_ngc = TRUE,
+  .id = 5524,
+  .ra = 213.453,
+  .dec = 36.3808,
+},
+{ .is_ngc = TRUE,
+  .id = 5524,
+  .ra = 213.358,
+  .dec = 36.4644,
+},
+{ .is_ngc = TRUE,
+  .id = 5525,
+  .ra = 213.913,
+  .dec = 14.2826,
+},
+{ .is_ngc = TRUE,
+  .id = 5526,
+  .ra = 213.473,
+  .dec = 57.7718,
+},
+{ .is_ngc = TRUE,
+  .id = 5527,
+  .ra = 213.614,
+  .dec = 36.4043,
+},
+{ .is_ngc = TRUE,
+  .id = 5528,
+  .ra = 214.082,
+  .dec = 8.29278,
+},
+{ .is_ngc = TRUE,
+  .id = 5529,
+  .ra = 213.892,
+  .dec = 36.2261,
+},
+{ .is_ngc = TRUE,
+  .id = 5530,
+  .ra = 214.613,
+  .dec = -43.3878,
+},
+{ .is_ngc = TRUE,
+  .id = 5531,
+  .ra = 214.181,
+  .dec = 10.8847,
+},
+{ .is_ngc = TRUE,
+  .id = 5533,
+  .ra = 214.031,
+  .dec = 35.3438,
+},
+{ .is_ngc = TRUE,
+  .id = 5534,
+  .ra = 214.418,
+  .dec = -7.41717,
+},
+{ .is_ngc = TRUE,
+  .id = 5535,
+  .ra = 214.38,
+  .dec = 8.20747,
+},
+{ .is_ngc = TRUE,
+  .id = 5536,
+  .ra = 214.099,
+  .dec = 39.5021,
+},
+{ .is_ngc = TRUE,
+  .id = 5537,
+  .ra = 214.404,
+  .dec = 7.05389,
+},
+{ .is_ngc = TRUE,
+  .id = 5538,
+  .ra = 214.427,
+  .dec = 7.47583,
+},
+{ .is_ngc = TRUE,
+  .id = 5539,
+  .ra = 214.407,
+  .dec = 8.17886,
+},
+{ .is_ngc = TRUE,
+  .id = 5540,
+  .ra = 213.726,
+  .dec = 60.0109,
+},
+{ .is_ngc = TRUE,
+  .id = 5541,
+  .ra = 214.133,
+  .dec = 39.589,
+},
+{ .is_ngc = TRUE,
+  .id = 5542,
+  .ra = 214.472,
+  .dec = 7.55833,
+},
+{ .is_ngc = TRUE,
+  .id = 5543,
+  .ra = 214.517,
+  .dec = 7.65389,
+},
+{ .is_ngc = TRUE,
+  .id = 5544,
+  .ra = 214.261,
+  .dec = 36.5715,
+},
+{ .is_ngc = TRUE,
+  .id = 5545,
+  .ra = 214.272,
+  .dec = 36.5752,
+},
+{ .is_ngc = TRUE,
+  .id = 5546,
+  .ra = 214.538,
+  .dec = 7.56361,
+},
+{ .is_ngc = TRUE,
+  .id = 5547,
+  .ra = 212.437,
+  .dec = 78.6009,
+},
+{ .is_ngc = TRUE,
+  .id = 5548,
+  .ra = 214.498,
+  .dec = 25.1367,
+},
+{ .is_ngc = TRUE,
+  .id = 5549,
+  .ra = 214.662,
+  .dec = 7.37664,
+},
+{ .is_ngc = TRUE,
+  .id = 5550,
+  .ra = 214.617,
+  .dec = 12.8829,
+},
+{ .is_ngc = TRUE,
+  .id = 5551,
+  .ra = 214.728,
+  .dec = 5.45083,
+},
+{ .is_ngc = TRUE,
+  .id = 5553,
+  .ra = 214.624,
+  .dec = 26.2873,
+},
+{ .is_ngc = TRUE,
+  .id = 5555,
+  .ra = 214.7,
+  .dec = -19.1394,
+},
+{ .is_ngc = TRUE,
+  .id = 5556,
+  .ra = 215.142,
+  .dec = -29.242,
+},
+{ .is_ngc = TRUE,
+  .id = 5557,
+  .ra = 214.607,
+  .dec = 36.4935,
+},
+{ .is_ngc = TRUE,
+  .id = 5559,
+  .ra = 214.803,
+  .dec = 24.7986,
+},
+{ .is_ngc = TRUE,
+  .id = 5560,
+  .ra = 215.019,
+  .dec = 3.99231,
+},
+{ .is_ngc = TRUE,
+  .id = 5561,
+  .ra = 214.345,
+  .dec = 58.7505,
+},
+{ .is_ngc = TRUE,
+  .id = 5562,
+  .ra = 215.046,
+  .dec = 10.2629,
+},
+{ .is_ngc = TRUE,
+  .id = 5563,
+  .ra = 215.054,
+  .dec = 7.05522,
+},
+{ .is_ngc = TRUE,
+  .id = 5565,
+  .ra = 214.827,
+  .dec = 6.99508,
+},
+{ .is_ngc = TRUE,
+  .id = 5566,
+  .ra = 215.083,
+  .dec = 3.93333,
+},
+{ .is_ngc = TRUE,
+  .id = 5567,
+  .ra = 214.823,
+  .dec = 35.138,
+},
+{ .is_ngc = TRUE,
+  .id = 5568,
+  .ra = 214.839,
+  .dec = 35.0921,
+},
+{ .is_ngc = TRUE,
+  .id = 5569,
+  .ra = 215.134,
+  .dec = 3.98272,
+},
+{ .is_ngc = TRUE,
+  .id = 5571,
+  .ra = 214.885,
+  .dec = 35.1503,
+},
+{ .is_ngc = TRUE,
+  .id = 5572,
+  .ra = 214.897,
+  .dec = 36.1404,
+},
+{ .is_ngc = TRUE,
+  .id = 5573,
+  .ra = 215.173,
+  .dec = 6.90711,
+},
+{ .is_ngc = TRUE,
+  .id = 5574,
+  .ra = 215.234,
+  .dec = 3.23797,
+},
+{ .is_ngc = TRUE,
+  .id = 5576,
+  .ra = 215.266,
+  .dec = 3.27069,
+},
+{ .is_ngc = TRUE,
+  .id = 5577,
+  .ra = 215.305,
+  .dec = 3.436,
+},
+{ .is_ngc = TRUE,
+  .id = 5579,
+  .ra = 215.11,
+  .dec = 35.1885,
+},
+{ .is_ngc = TRUE,
+  .id = 5581,
+  .ra = 215.318,
+  .dec = 23.4796,
+},
+{ .is_ngc = TRUE,
+  .id = 5582,
+  .ra = 215.18,
+  .dec = 39.6934,
+},
+{ .is_ngc = TRUE,
+  .id = 5583,
+  .ra = 215.419,
+  .dec = 13.232,
+},
+{ .is_ngc = TRUE,
+  .id = 5584,
+  .ra = 215.599,
+  .dec = -0.387528,
+},
+{ .is_ngc = TRUE,
+  .id = 5585,
+  .ra = 214.95,
+  .dec = 56.7293,
+},
+{ .is_ngc = TRUE,
+  .id = 5586,
+  .ra = 215.529,
+  .dec = 13.1836,
+},
+{ .is_ngc = TRUE,
+  .id = 5587,
+  .ra = 215.545,
+  .dec = 13.9176,
+},
+{ .is_ngc = TRUE,
+  .id = 5591,
+  .ra = 215.642,
+  .dec = 13.7172,
+},
+{ .is_ngc = TRUE,
+  .id = 5592,
+  .ra = 215.979,
+  .dec = -28.6881,
+},
+{ .is_ngc = TRUE,
+  .id = 5593,
+  .ra = 216.412,
+  .dec = -54.7858,
+},
+{ .is_ngc = TRUE,
+  .id = 5595,
+  .ra = 216.055,
+  .dec = -16.7228,
+},
+{ .is_ngc = TRUE,
+  .id = 5596,
+  .ra = 215.62,
+  .dec = 37.1221,
+},
+{ .is_ngc = TRUE,
+  .id = 5597,
+  .ra = 216.115,
+  .dec = -16.7631,
+},
+{ .is_ngc = TRUE,
+  .id = 5598,
+  .ra = 215.618,
+  .dec = 40.3199,
+},
+{ .is_ngc = TRUE,
+  .id = 5599,
+  .ra = 215.961,
+  .dec = 6.57572,
+},
+{ .is_ngc = TRUE,
+  .id = 5600,
+  .ra = 215.956,
+  .dec = 14.6386,
+},
+{ .is_ngc = TRUE,
+  .id = 5601,
+  .ra = 215.722,
+  .dec = 40.3097,
+},
+{ .is_ngc = TRUE,
+  .id = 5602,
+  .ra = 215.578,
+  .dec = 50.5018,
+},
+{ .is_ngc = TRUE,
+  .id = 5604,
+  .ra = 216.178,
+  .dec = -3.2125,
+},
+{ .is_ngc = TRUE,
+  .id = 5605,
+  .ra = 216.281,
+  .dec = -13.1638,
+},
+{ .is_ngc = TRUE,
+  .id = 5606,
+  .ra = 216.946,
+  .dec = -59.6192,
+},
+{ .is_ngc = TRUE,
+  .id = 5608,
+  .ra = 215.824,
+  .dec = 41.7755,
+},
+{ .is_ngc = TRUE,
+  .id = 5609,
+  .ra = 215.951,
+  .dec = 34.843,
+},
+{ .is_ngc = TRUE,
+  .id = 5610,
+  .ra = 216.096,
+  .dec = 24.614,
+},
+{ .is_ngc = TRUE,
+  .id = 5611,
+  .ra = 216.02,
+  .dec = 33.0476,
+},
+{ .is_ngc = TRUE,
+  .id = 5612,
+  .ra = 218.507,
+  .dec = -78.3883,
+},
+{ .is_ngc = TRUE,
+  .id = 5613,
+  .ra = 216.025,
+  .dec = 34.8922,
+},
+{ .is_ngc = TRUE,
+  .id = 5614,
+  .ra = 216.032,
+  .dec = 34.8591,
+},
+{ .is_ngc = TRUE,
+  .id = 5615,
+  .ra = 216.027,
+  .dec = 34.8649,
+},
+{ .is_ngc = TRUE,
+  .id = 5616,
+  .ra = 216.086,
+  .dec = 36.461,
+},
+{ .is_ngc = TRUE,
+  .id = 5617,
+  .ra = 217.433,
+  .dec = -60.7019,
+},
+{ .is_ngc = TRUE,
+  .id = 5618,
+  .ra = 216.799,
+  .dec = -2.26308,
+},
+{ .is_ngc = TRUE,
+  .id = 5620,
+  .ra = 215.667,
+  .dec = 69.5944,
+},
+{ .is_ngc = TRUE,
+  .id = 5621,
+  .ra = 216.957,
+  .dec = 8.24139,
+},
+{ .is_ngc = TRUE,
+  .id = 5622,
+  .ra = 216.551,
+  .dec = 48.5637,
+},
+{ .is_ngc = TRUE,
+  .id = 5623,
+  .ra = 216.786,
+  .dec = 33.2526,
+},
+{ .is_ngc = TRUE,
+  .id = 5624,
+  .ra = 216.648,
+  .dec = 51.5851,
+},
+{ .is_ngc = TRUE,
+  .id = 5625,
+  .ra = 216.758,
+  .dec = 39.9572,
+},
+{ .is_ngc = TRUE,
+  .id = 5626,
+  .ra = 217.453,
+  .dec = -29.7492,
+},
+{ .is_ngc = TRUE,
+  .id = 5627,
+  .ra = 217.143,
+  .dec = 11.3781,
+},
+{ .is_ngc = TRUE,
+  .id = 5628,
+  .ra = 217.108,
+  .dec = 17.9245,
+},
+{ .is_ngc = TRUE,
+  .id = 5629,
+  .ra = 217.068,
+  .dec = 25.8486,
+},
+{ .is_ngc = TRUE,
+  .id = 5630,
+  .ra = 216.903,
+  .dec = 41.2574,
+},
+{ .is_ngc = TRUE,
+  .id = 5631,
+  .ra = 216.639,
+  .dec = 56.5826,
+},
+{ .is_ngc = TRUE,
+  .id = 5632,
+  .ra = 217.332,
+  .dec = -0.447611,
+},
+{ .is_ngc = TRUE,
+  .id = 5633,
+  .ra = 216.869,
+  .dec = 46.1467,
+},
+{ .is_ngc = TRUE,
+  .id = 5634,
+  .ra = 217.405,
+  .dec = -5.97706,
+},
+{ .is_ngc = TRUE,
+  .id = 5635,
+  .ra = 217.132,
+  .dec = 27.4088,
+},
+{ .is_ngc = TRUE,
+  .id = 5636,
+  .ra = 217.413,
+  .dec = 3.26608,
+},
+{ .is_ngc = TRUE,
+  .id = 5637,
+  .ra = 217.248,
+  .dec = 23.1911,
+},
+{ .is_ngc = TRUE,
+  .id = 5638,
+  .ra = 217.418,
+  .dec = 3.23328,
+},
+{ .is_ngc = TRUE,
+  .id = 5640,
+  .ra = 215.17,
+  .dec = 80.1224,
+},
+{ .is_ngc = TRUE,
+  .id = 5641,
+  .ra = 217.32,
+  .dec = 28.8216,
+},
+{ .is_ngc = TRUE,
+  .id = 5642,
+  .ra = 217.306,
+  .dec = 30.0263,
+},
+{ .is_ngc = TRUE,
+  .id = 5643,
+  .ra = 218.172,
+  .dec = -44.1739,
+},
+{ .is_ngc = TRUE,
+  .id = 5644,
+  .ra = 217.607,
+  .dec = 11.9277,
+},
+{ .is_ngc = TRUE,
+  .id = 5645,
+  .ra = 217.664,
+  .dec = 7.27508,
+},
+{ .is_ngc = TRUE,
+  .id = 5646,
+  .ra = 217.392,
+  .dec = 35.4616,
+},
+{ .is_ngc = TRUE,
+  .id = 5647,
+  .ra = 217.65,
+  .dec = 11.8767,
+},
+{ .is_ngc = TRUE,
+  .id = 5651,
+  .ra = 217.804,
+  .dec = -0.322333,
+},
+{ .is_ngc = TRUE,
+  .id = 5654,
+  .ra = 217.506,
+  .dec = 36.3596,
+},
+{ .is_ngc = TRUE,
+  .id = 5655,
+  .ra = 217.712,
+  .dec = 13.9688,
+},
+{ .is_ngc = TRUE,
+  .id = 5656,
+  .ra = 217.606,
+  .dec = 35.3208,
+},
+{ .is_ngc = TRUE,
+  .id = 5657,
+  .ra = 217.682,
+  .dec = 29.1803,
+},
+{ .is_ngc = TRUE,
+  .id = 5658,
+  .ra = 217.98,
+  .dec = -0.366972,
+},
+{ .is_ngc = TRUE,
+  .id = 5659,
+  .ra = 217.776,
+  .dec = 25.355,
+},
+{ .is_ngc = TRUE,
+  .id = 5660,
+  .ra = 217.458,
+  .dec = 49.6228,
+},
+{ .is_ngc = TRUE,
+  .id = 5661,
+  .ra = 217.989,
+  .dec = 6.25044,
+},
+{ .is_ngc = TRUE,
+  .id = 5662,
+  .ra = 218.904,
+  .dec = -56.6169,
+},
+{ .is_ngc = TRUE,
+  .id = 5663,
+  .ra = 218.485,
+  .dec = -16.5811,
+},
+{ .is_ngc = TRUE,
+  .id = 5665,
+  .ra = 218.107,
+  .dec = 8.07944,
+},
+{ .is_ngc = TRUE,
+  .id = 5666,
+  .ra = 218.289,
+  .dec = 10.5104,
+},
+{ .is_ngc = TRUE,
+  .id = 5667,
+  .ra = 217.596,
+  .dec = 59.4701,
+},
+{ .is_ngc = TRUE,
+  .id = 5668,
+  .ra = 218.351,
+  .dec = 4.45031,
+},
+{ .is_ngc = TRUE,
+  .id = 5669,
+  .ra = 218.183,
+  .dec = 9.89133,
+},
+{ .is_ngc = TRUE,
+  .id = 5670,
+  .ra = 218.902,
+  .dec = -45.9661,
+},
+{ .is_ngc = TRUE,
+  .id = 5671,
+  .ra = 216.926,
+  .dec = 69.6938,
+},
+{ .is_ngc = TRUE,
+  .id = 5673,
+  .ra = 217.879,
+  .dec = 49.9585,
+},
+{ .is_ngc = TRUE,
+  .id = 5674,
+  .ra = 218.468,
+  .dec = 5.45858,
+},
+{ .is_ngc = TRUE,
+  .id = 5675,
+  .ra = 218.166,
+  .dec = 36.3023,
+},
+{ .is_ngc = TRUE,
+  .id = 5676,
+  .ra = 218.196,
+  .dec = 49.4578,
+},
+{ .is_ngc = TRUE,
+  .id = 5677,
+  .ra = 218.553,
+  .dec = 25.4678,
+},
+{ .is_ngc = TRUE,
+  .id = 5678,
+  .ra = 218.024,
+  .dec = 57.9217,
+},
+{ .is_ngc = TRUE,
+  .id = 5680,
+  .ra = 218.936,
+  .dec = -0.0135833,
+},
+{ .is_ngc = TRUE,
+  .id = 5681,
+  .ra = 218.929,
+  .dec = 8.30036,
+},
+{ .is_ngc = TRUE,
+  .id = 5682,
+  .ra = 218.688,
+  .dec = 48.6704,
+},
+{ .is_ngc = TRUE,
+  .id = 5683,
+  .ra = 218.719,
+  .dec = 48.6623,
+},
+{ .is_ngc = TRUE,
+  .id = 5684,
+  .ra = 218.959,
+  .dec = 36.5429,
+},
+{ .is_ngc = TRUE,
+  .id = 5685,
+  .ra = 219.064,
+  .dec = 29.9082,
+},
+{ .is_ngc = TRUE,
+  .id = 5686,
+  .ra = 219.011,
+  .dec = 36.503,
+},
+{ .is_ngc = TRUE,
+  .id = 5687,
+  .ra = 218.719,
+  .dec = 54.4756,
+},
+{ .is_ngc = TRUE,
+  .id = 5688,
+  .ra = 219.896,
+  .dec = -45.0194,
+},
+{ .is_ngc = TRUE,
+  .id = 5689,
+  .ra = 218.874,
+  .dec = 48.7419,
+},
+{ .is_ngc = TRUE,
+  .id = 5690,
+  .ra = 219.421,
+  .dec = 2.291,
+},
+{ .is_ngc = TRUE,
+  .id = 5691,
+  .ra = 219.473,
+  .dec = -0.398278,
+},
+{ .is_ngc = TRUE,
+  .id = 5692,
+  .ra = 219.575,
+  .dec = 3.40975,
+},
+{ .is_ngc = TRUE,
+  .id = 5693,
+  .ra = 219.047,
+  .dec = 48.5853,
+},
+{ .is_ngc = TRUE,
+  .id = 5694,
+  .ra = 219.902,
+  .dec = -26.5382,
+},
+{ .is_ngc = TRUE,
+  .id = 5695,
+  .ra = 219.342,
+  .dec = 36.5675,
+},
+{ .is_ngc = TRUE,
+  .id = 5696,
+  .ra = 219.238,
+  .dec = 41.8283,
+},
+{ .is_ngc = TRUE,
+  .id = 5698,
+  .ra = 219.312,
+  .dec = 38.4546,
+},
+{ .is_ngc = TRUE,
+  .id = 5700,
+  .ra = 219.257,
+  .dec = 48.545,
+},
+{ .is_ngc = TRUE,
+  .id = 5701,
+  .ra = 219.797,
+  .dec = 5.36406,
+},
+{ .is_ngc = TRUE,
+  .id = 5702,
+  .ra = 219.73,
+  .dec = 20.5065,
+},
+{ .is_ngc = TRUE,
+  .id = 5704,
+  .ra = 219.481,
+  .dec = 40.5159,
+},
+{ .is_ngc = TRUE,
+  .id = 5705,
+  .ra = 219.957,
+  .dec = -0.718694,
+},
+{ .is_ngc = TRUE,
+  .id = 5707,
+  .ra = 219.378,
+  .dec = 51.562,
+},
+{ .is_ngc = TRUE,
+  .id = 5710,
+  .ra = 219.818,
+  .dec = 20.0431,
+},
+{ .is_ngc = TRUE,
+  .id = 5711,
+  .ra = 219.844,
+  .dec = 19.9903,
+},
+{ .is_ngc = TRUE,
+  .id = 5712,
+  .ra = 217.424,
+  .dec = 78.8644,
+},
+{ .is_ngc = TRUE,
+  .id = 5713,
+  .ra = 220.048,
+  .dec = -0.290139,
+},
+{ .is_ngc = TRUE,
+  .id = 5714,
+  .ra = 219.549,
+  .dec = 46.6379,
+},
+{ .is_ngc = TRUE,
+  .id = 5715,
+  .ra = 220.871,
+  .dec = -57.5683,
+},
+{ .is_ngc = TRUE,
+  .id = 5716,
+  .ra = 220.274,
+  .dec = -17.4766,
+},
+{ .is_ngc = TRUE,
+  .id = 5717,
+  .ra = 219.657,
+  .dec = 46.663,
+},
+{ .is_ngc = TRUE,
+  .id = 5718,
+  .ra = 220.179,
+  .dec = 3.46522,
+},
+{ .is_ngc = TRUE,
+  .id = 5719,
+  .ra = 220.235,
+  .dec = -0.317944,
+},
+{ .is_ngc = TRUE,
+  .id = 5720,
+  .ra = 219.639,
+  .dec = 50.8147,
+},
+{ .is_ngc = TRUE,
+  .id = 5721,
+  .ra = 219.721,
+  .dec = 46.6744,
+},
+{ .is_ngc = TRUE,
+  .id = 5722,
+  .ra = 219.727,
+  .dec = 46.6656,
+},
+{ .is_ngc = TRUE,
+  .id = 5723,
+  .ra = 219.741,
+  .dec = 46.6894,
+},
+{ .is_ngc = TRUE,
+  .id = 5724,
+  .ra = 219.759,
+  .dec = 46.6922,
+},
+{ .is_ngc = TRUE,
+  .id = 5725,
+  .ra = 220.243,
+  .dec = 2.18594,
+},
+{ .is_ngc = TRUE,
+  .id = 5726,
+  .ra = 220.733,
+  .dec = -18.4445,
+},
+{ .is_ngc = TRUE,
+  .id = 5727,
+  .ra = 220.109,
+  .dec = 33.9885,
+},
+{ .is_ngc = TRUE,
+  .id = 5728,
+  .ra = 220.6,
+  .dec = -17.2533,
+},
+{ .is_ngc = TRUE,
+  .id = 5729,
+  .ra = 220.529,
+  .dec = -9.00947,
+},
+{ .is_ngc = TRUE,
+  .id = 5730,
+  .ra = 219.967,
+  .dec = 42.7421,
+},
+{ .is_ngc = TRUE,
+  .id = 5732,
+  .ra = 220.162,
+  .dec = 38.638,
+},
+{ .is_ngc = TRUE,
+  .id = 5733,
+  .ra = 220.691,
+  .dec = -0.351389,
+},
+{ .is_ngc = TRUE,
+  .id = 5734,
+  .ra = 221.288,
+  .dec = -20.8707,
+},
+{ .is_ngc = TRUE,
+  .id = 5735,
+  .ra = 220.639,
+  .dec = 28.726,
+},
+{ .is_ngc = TRUE,
+  .id = 5736,
+  .ra = 220.879,
+  .dec = 11.2027,
+},
+{ .is_ngc = TRUE,
+  .id = 5737,
+  .ra = 220.8,
+  .dec = 18.8798,
+},
+{ .is_ngc = TRUE,
+  .id = 5738,
+  .ra = 220.985,
+  .dec = 1.60361,
+},
+{ .is_ngc = TRUE,
+  .id = 5739,
+  .ra = 220.621,
+  .dec = 41.8421,
+},
+{ .is_ngc = TRUE,
+  .id = 5740,
+  .ra = 221.102,
+  .dec = 1.67961,
+},
+{ .is_ngc = TRUE,
+  .id = 5741,
+  .ra = 221.466,
+  .dec = -11.9144,
+},
+{ .is_ngc = TRUE,
+  .id = 5742,
+  .ra = 221.403,
+  .dec = -11.81,
+},
+{ .is_ngc = TRUE,
+  .id = 5743,
+  .ra = 221.295,
+  .dec = -20.9135,
+},
+{ .is_ngc = TRUE,
+  .id = 5744,
+  .ra = 221.66,
+  .dec = -18.5131,
+},
+{ .is_ngc = TRUE,
+  .id = 5746,
+  .ra = 221.232,
+  .dec = 1.95489,
+},
+{ .is_ngc = TRUE,
+  .id = 5748,
+  .ra = 221.272,
+  .dec = 21.9162,
+},
+{ .is_ngc = TRUE,
+  .id = 5749,
+  .ra = 222.221,
+  .dec = -54.4858,
+},
+{ .is_ngc = TRUE,
+  .id = 5750,
+  .ra = 221.546,
+  .dec = -0.223111,
+},
+{ .is_ngc = TRUE,
+  .id = 5751,
+  .ra = 220.955,
+  .dec = 53.4003,
+},
+{ .is_ngc = TRUE,
+  .id = 5752,
+  .ra = 221.309,
+  .dec = 38.7286,
+},
+{ .is_ngc = TRUE,
+  .id = 5753,
+  .ra = 221.329,
+  .dec = 38.8057,
+},
+{ .is_ngc = TRUE,
+  .id = 5754,
+  .ra = 221.332,
+  .dec = 38.7317,
+},
+{ .is_ngc = TRUE,
+  .id = 5755,
+  .ra = 221.352,
+  .dec = 38.7799,
+},
+{ .is_ngc = TRUE,
+  .id = 5756,
+  .ra = 221.89,
+  .dec = -14.8533,
+},
+{ .is_ngc = TRUE,
+  .id = 5757,
+  .ra = 221.943,
+  .dec = -19.0783,
+},
+{ .is_ngc = TRUE,
+  .id = 5758,
+  .ra = 221.758,
+  .dec = 13.6675,
+},
+{ .is_ngc = TRUE,
+  .id = 5759,
+  .ra = 221.812,
+  .dec = 13.4562,
+},
+{ .is_ngc = TRUE,
+  .id = 5760,
+  .ra = 221.927,
+  .dec = 18.5014,
+},
+{ .is_ngc = TRUE,
+  .id = 5761,
+  .ra = 222.285,
+  .dec = -20.3764,
+},
+{ .is_ngc = TRUE,
+  .id = 5761,
+  .ra = 222.459,
+  .dec = -20.2783,
+},
+{ .is_ngc = TRUE,
+  .id = 5762,
+  .ra = 222.178,
+  .dec = 12.4568,
+},
+{ .is_ngc = TRUE,
+  .id = 5763,
+  .ra = 222.244,
+  .dec = 12.4903,
+},
+{ .is_ngc = TRUE,
+  .id = 5764,
+  .ra = 223.383,
+  .dec = -52.6672,
+},
+{ .is_ngc = TRUE,
+  .id = 5766,
+  .ra = 223.29,
+  .dec = -21.3939,
+},
+{ .is_ngc = TRUE,
+  .id = 5767,
+  .ra = 222.393,
+  .dec = 47.3758,
+},
+{ .is_ngc = TRUE,
+  .id = 5768,
+  .ra = 223.033,
+  .dec = -2.52983,
+},
+{ .is_ngc = TRUE,
+  .id = 5769,
+  .ra = 223.173,
+  .dec = 7.93186,
+},
+{ .is_ngc = TRUE,
+  .id = 5770,
+  .ra = 223.312,
+  .dec = 3.95978,
+},
+{ .is_ngc = TRUE,
+  .id = 5771,
+  .ra = 223.06,
+  .dec = 29.8452,
+},
+{ .is_ngc = TRUE,
+  .id = 5772,
+  .ra = 222.912,
+  .dec = 40.5989,
+},
+{ .is_ngc = TRUE,
+  .id = 5773,
+  .ra = 223.127,
+  .dec = 29.8073,
+},
+{ .is_ngc = TRUE,
+  .id = 5774,
+  .ra = 223.428,
+  .dec = 3.58228,
+},
+{ .is_ngc = TRUE,
+  .id = 5775,
+  .ra = 223.49,
+  .dec = 3.54425,
+},
+{ .is_ngc = TRUE,
+  .id = 5776,
+  .ra = 223.637,
+  .dec = 2.9663,
+},
+{ .is_ngc = TRUE,
+  .id = 5777,
+  .ra = 222.825,
+  .dec = 58.9772,
+},
+{ .is_ngc = TRUE,
+  .id = 5779,
+  .ra = 223.04,
+  .dec = 55.8992,
+},
+{ .is_ngc = TRUE,
+  .id = 5780,
+  .ra = 223.595,
+  .dec = 28.9394,
+},
+{ .is_ngc = TRUE,
+  .id = 5781,
+  .ra = 224.172,
+  .dec = -17.2425,
+},
+{ .is_ngc = TRUE,
+  .id = 5782,
+  .ra = 223.98,
+  .dec = 11.8614,
+},
+{ .is_ngc = TRUE,
+  .id = 5784,
+  .ra = 223.568,
+  .dec = 42.558,
+},
+{ .is_ngc = TRUE,
+  .id = 5786,
+  .ra = 224.735,
+  .dec = -42.0136,
+},
+{ .is_ngc = TRUE,
+  .id = 5787,
+  .ra = 223.814,
+  .dec = 42.5068,
+},
+{ .is_ngc = TRUE,
+  .id = 5788,
+  .ra = 223.32,
+  .dec = 52.0441,
+},
+{ .is_ngc = TRUE,
+  .id = 5789,
+  .ra = 224.149,
+  .dec = 30.2338,
+},
+{ .is_ngc = TRUE,
+  .id = 5790,
+  .ra = 224.4,
+  .dec = 8.28503,
+},
+{ .is_ngc = TRUE,
+  .id = 5791,
+  .ra = 224.692,
+  .dec = -19.2672,
+},
+{ .is_ngc = TRUE,
+  .id = 5792,
+  .ra = 224.594,
+  .dec = -1.09061,
+},
+{ .is_ngc = TRUE,
+  .id = 5793,
+  .ra = 224.853,
+  .dec = -16.6931,
+},
+{ .is_ngc = TRUE,
+  .id = 5794,
+  .ra = 223.973,
+  .dec = 49.7258,
+},
+{ .is_ngc = TRUE,
+  .id = 5795,
+  .ra = 224.08,
+  .dec = 49.3987,
+},
+{ .is_ngc = TRUE,
+  .id = 5796,
+  .ra = 224.85,
+  .dec = -16.6236,
+},
+{ .is_ngc = TRUE,
+  .id = 5797,
+  .ra = 224.1,
+  .dec = 49.6958,
+},
+{ .is_ngc = TRUE,
+  .id = 5798,
+  .ra = 224.408,
+  .dec = 29.9682,
+},
+{ .is_ngc = TRUE,
+  .id = 5799,
+  .ra = 226.399,
+  .dec = -72.4328,
+},
+{ .is_ngc = TRUE,
+  .id = 5800,
+  .ra = 225.446,
+  .dec = -51.9169,
+},
+{ .is_ngc = TRUE,
+  .id = 5801,
+  .ra = 225.108,
+  .dec = -13.9043,
+},
+{ .is_ngc = TRUE,
+  .id = 5802,
+  .ra = 225.125,
+  .dec = -13.9192,
+},
+{ .is_ngc = TRUE,
+  .id = 5803,
+  .ra = 225.144,
+  .dec = -13.8948,
+},
+{ .is_ngc = TRUE,
+  .id = 5804,
+  .ra = 224.278,
+  .dec = 49.6687,
+},
+{ .is_ngc = TRUE,
+  .id = 5805,
+  .ra = 224.3,
+  .dec = 49.6278,
+},
+{ .is_ngc = TRUE,
+  .id = 5806,
+  .ra = 225.001,
+  .dec = 1.89112,
+},
+{ .is_ngc = TRUE,
+  .id = 5807,
+  .ra = 223.952,
+  .dec = 63.9035,
+},
+{ .is_ngc = TRUE,
+  .id = 5809,
+  .ra = 225.218,
+  .dec = -14.1653,
+},
+{ .is_ngc = TRUE,
+  .id = 5810,
+  .ra = 225.678,
+  .dec = -17.8681,
+},
+{ .is_ngc = TRUE,
+  .id = 5811,
+  .ra = 225.114,
+  .dec = 1.62308,
+},
+{ .is_ngc = TRUE,
+  .id = 5812,
+  .ra = 225.232,
+  .dec = -7.45778,
+},
+{ .is_ngc = TRUE,
+  .id = 5813,
+  .ra = 225.297,
+  .dec = 1.70192,
+},
+{ .is_ngc = TRUE,
+  .id = 5814,
+  .ra = 225.338,
+  .dec = 1.63639,
+},
+{ .is_ngc = TRUE,
+  .id = 5815,
+  .ra = 225.122,
+  .dec = -16.8342,
+},
+{ .is_ngc = TRUE,
+  .id = 5816,
+  .ra = 225.02,
+  .dec = -16.0936,
+},
+{ .is_ngc = TRUE,
+  .id = 5817,
+  .ra = 224.92,
+  .dec = -16.1804,
+},
+{ .is_ngc = TRUE,
+  .id = 5818,
+  .ra = 224.743,
+  .dec = 49.8212,
+},
+{ .is_ngc = TRUE,
+  .id = 5820,
+  .ra = 224.667,
+  .dec = 53.8858,
+},
+{ .is_ngc = TRUE,
+  .id = 5821,
+  .ra = 224.749,
+  .dec = 53.9229,
+},
+{ .is_ngc = TRUE,
+  .id = 5822,
+  .ra = 226.088,
+  .dec = -54.3856,
+},
+{ .is_ngc = TRUE,
+  .id = 5823,
+  .ra = 226.375,
+  .dec = -55.6006,
+},
+{ .is_ngc = TRUE,
+  .id = 5827,
+  .ra = 225.474,
+  .dec = 25.9638,
+},
+{ .is_ngc = TRUE,
+  .id = 5829,
+  .ra = 225.676,
+  .dec = 23.3328,
+},
+{ .is_ngc = TRUE,
+  .id = 5830,
+  .ra = 225.463,
+  .dec = 47.8752,
+},
+{ .is_ngc = TRUE,
+  .id = 5831,
+  .ra = 226.029,
+  .dec = 1.21986,
+},
+{ .is_ngc = TRUE,
+  .id = 5832,
+  .ra = 224.44,
+  .dec = 71.681,
+},
+{ .is_ngc = TRUE,
+  .id = 5833,
+  .ra = 227.975,
+  .dec = -72.8589,
+},
+{ .is_ngc = TRUE,
+  .id = 5835,
+  .ra = 225.606,
+  .dec = 48.8775,
+},
+{ .is_ngc = TRUE,
+  .id = 5836,
+  .ra = 224.88,
+  .dec = 73.8932,
+},
+{ .is_ngc = TRUE,
+  .id = 5837,
+  .ra = 226.17,
+  .dec = 12.6329,
+},
+{ .is_ngc = TRUE,
+  .id = 5838,
+  .ra = 226.359,
+  .dec = 2.09925,
+},
+{ .is_ngc = TRUE,
+  .id = 5839,
+  .ra = 226.365,
+  .dec = 1.63444,
+},
+{ .is_ngc = TRUE,
+  .id = 5840,
+  .ra = 226.083,
+  .dec = 29.5011,
+},
+{ .is_ngc = TRUE,
+  .id = 5842,
+  .ra = 226.217,
+  .dec = 21.0696,
+},
+{ .is_ngc = TRUE,
+  .id = 5843,
+  .ra = 226.867,
+  .dec = -36.3283,
+},
+{ .is_ngc = TRUE,
+  .id = 5844,
+  .ra = 227.67,
+  .dec = -64.6736,
+},
+{ .is_ngc = TRUE,
+  .id = 5845,
+  .ra = 226.503,
+  .dec = 1.63358,
+},
+{ .is_ngc = TRUE,
+  .id = 5846,
+  .ra = 226.622,
+  .dec = 1.60552,
+},
+{ .is_ngc = TRUE,
+  .id = 5847,
+  .ra = 226.593,
+  .dec = 6.37972,
+},
+{ .is_ngc = TRUE,
+  .id = 5849,
+  .ra = 226.711,
+  .dec = -14.5721,
+},
+{ .is_ngc = TRUE,
+  .id = 5850,
+  .ra = 226.782,
+  .dec = 1.54408,
+},
+{ .is_ngc = TRUE,
+  .id = 5851,
+  .ra = 226.723,
+  .dec = 12.8582,
+},
+{ .is_ngc = TRUE,
+  .id = 5852,
+  .ra = 226.735,
+  .dec = 12.8468,
+},
+{ .is_ngc = TRUE,
+  .id = 5853,
+  .ra = 226.472,
+  .dec = 39.5221,
+},
+{ .is_ngc = TRUE,
+  .id = 5854,
+  .ra = 226.949,
+  .dec = 2.56836,
+},
+{ .is_ngc = TRUE,
+  .id = 5855,
+  .ra = 226.954,
+  .dec = 3.98413,
+},
+{ .is_ngc = TRUE,
+  .id = 5856,
+  .ra = 226.834,
+  .dec = 18.442,
+},
+{ .is_ngc = TRUE,
+  .id = 5857,
+  .ra = 226.864,
+  .dec = 19.598,
+},
+{ .is_ngc = TRUE,
+  .id = 5858,
+  .ra = 227.205,
+  .dec = -11.208,
+},
+{ .is_ngc = TRUE,
+  .id = 5859,
+  .ra = 226.896,
+  .dec = 19.5821,
+},
+{ .is_ngc = TRUE,
+  .id = 5860,
+  .ra = 226.64,
+  .dec = 42.6418,
+},
+{ .is_ngc = TRUE,
+  .id = 5861,
+  .ra = 227.317,
+  .dec = -11.3221,
+},
+{ .is_ngc = TRUE,
+  .id = 5862,
+  .ra = 226.513,
+  .dec = 55.5737,
+},
+{ .is_ngc = TRUE,
+  .id = 5863,
+  .ra = 227.701,
+  .dec = -18.4311,
+},
+{ .is_ngc = TRUE,
+  .id = 5864,
+  .ra = 227.39,
+  .dec = 3.05272,
+},
+{ .is_ngc = TRUE,
+  .id = 5866,
+  .ra = 226.623,
+  .dec = 55.7631,
+},
+{ .is_ngc = TRUE,
+  .id = 5867,
+  .ra = 226.601,
+  .dec = 55.7314,
+},
+{ .is_ngc = TRUE,
+  .id = 5869,
+  .ra = 227.456,
+  .dec = 0.469833,
+},
+{ .is_ngc = TRUE,
+  .id = 5871,
+  .ra = 227.52,
+  .dec = 0.497972,
+},
+{ .is_ngc = TRUE,
+  .id = 5871,
+  .ra = 227.484,
+  .dec = 0.513611,
+},
+{ .is_ngc = TRUE,
+  .id = 5872,
+  .ra = 227.732,
+  .dec = -11.4802,
+},
+{ .is_ngc = TRUE,
+  .id = 5873,
+  .ra = 228.211,
+  .dec = -38.1251,
+},
+{ .is_ngc = TRUE,
+  .id = 5874,
+  .ra = 226.967,
+  .dec = 54.7526,
+},
+{ .is_ngc = TRUE,
+  .id = 5875,
+  .ra = 227.304,
+  .dec = 52.5283,
+},
+{ .is_ngc = TRUE,
+  .id = 5877,
+  .ra = 228.221,
+  .dec = -4.92722,
+},
+{ .is_ngc = TRUE,
+  .id = 5878,
+  .ra = 228.44,
+  .dec = -14.2706,
+},
+{ .is_ngc = TRUE,
+  .id = 5879,
+  .ra = 227.446,
+  .dec = 57.0007,
+},
+{ .is_ngc = TRUE,
+  .id = 5880,
+  .ra = 228.755,
+  .dec = -14.5792,
+},
+{ .is_ngc = TRUE,
+  .id = 5883,
+  .ra = 228.792,
+  .dec = -14.6172,
+},
+{ .is_ngc = TRUE,
+  .id = 5884,
+  .ra = 228.288,
+  .dec = 31.8614,
+},
+{ .is_ngc = TRUE,
+  .id = 5885,
+  .ra = 228.767,
+  .dec = -10.0856,
+},
+{ .is_ngc = TRUE,
+  .id = 5886,
+  .ra = 228.19,
+  .dec = 41.2336,
+},
+{ .is_ngc = TRUE,
+  .id = 5887,
+  .ra = 228.683,
+  .dec = 1.15396,
+},
+{ .is_ngc = TRUE,
+  .id = 5888,
+  .ra = 228.281,
+  .dec = 41.2645,
+},
+{ .is_ngc = TRUE,
+  .id = 5889,
+  .ra = 228.315,
+  .dec = 41.3277,
+},
+{ .is_ngc = TRUE,
+  .id = 5890,
+  .ra = 229.463,
+  .dec = -17.5895,
+},
+{ .is_ngc = TRUE,
+  .id = 5891,
+  .ra = 229.055,
+  .dec = -11.4939,
+},
+{ .is_ngc = TRUE,
+  .id = 5892,
+  .ra = 228.451,
+  .dec = -15.4642,
+},
+{ .is_ngc = TRUE,
+  .id = 5893,
+  .ra = 228.392,
+  .dec = 41.9586,
+},
+{ .is_ngc = TRUE,
+  .id = 5894,
+  .ra = 227.921,
+  .dec = 59.8079,
+},
+{ .is_ngc = TRUE,
+  .id = 5895,
+  .ra = 228.458,
+  .dec = 42.0077,
+},
+{ .is_ngc = TRUE,
+  .id = 5896,
+  .ra = 228.461,
+  .dec = 42.0245,
+},
+{ .is_ngc = TRUE,
+  .id = 5897,
+  .ra = 229.352,
+  .dec = -21.0102,
+},
+{ .is_ngc = TRUE,
+  .id = 5898,
+  .ra = 229.557,
+  .dec = -24.0975,
+},
+{ .is_ngc = TRUE,
+  .id = 5899,
+  .ra = 228.763,
+  .dec = 42.0493,
+},
+{ .is_ngc = TRUE,
+  .id = 5900,
+  .ra = 228.771,
+  .dec = 42.2093,
+},
+{ .is_ngc = TRUE,
+  .id = 5901,
+  .ra = 228.76,
+  .dec = 42.2294,
+},
+{ .is_ngc = TRUE,
+  .id = 5902,
+  .ra = 228.593,
+  .dec = 50.3299,
+},
+{ .is_ngc = TRUE,
+  .id = 5903,
+  .ra = 229.652,
+  .dec = -24.0683,
+},
+{ .is_ngc = TRUE,
+  .id = 5904,
+  .ra = 229.64,
+  .dec = 2.08242,
+},
+{ .is_ngc = TRUE,
+  .id = 5905,
+  .ra = 228.847,
+  .dec = 55.5172,
+},
+{ .is_ngc = TRUE,
+  .id = 5906,
+  .ra = 228.971,
+  .dec = 56.3297,
+},
+{ .is_ngc = TRUE,
+  .id = 5907,
+  .ra = 228.974,
+  .dec = 56.329,
+},
+{ .is_ngc = TRUE,
+  .id = 5908,
+  .ra = 229.18,
+  .dec = 55.4096,
+},
+{ .is_ngc = TRUE,
+  .id = 5909,
+  .ra = 227.866,
+  .dec = 75.3836,
+},
+{ .is_ngc = TRUE,
+  .id = 5910,
+  .ra = 229.853,
+  .dec = 20.8959,
+},
+{ .is_ngc = TRUE,
+  .id = 5911,
+  .ra = 230.076,
+  .dec = 3.51812,
+},
+{ .is_ngc = TRUE,
+  .id = 5912,
+  .ra = 227.92,
+  .dec = 75.3845,
+},
+{ .is_ngc = TRUE,
+  .id = 5913,
+  .ra = 230.231,
+  .dec = -2.57781,
+},
+{ .is_ngc = TRUE,
+  .id = 5915,
+  .ra = 230.388,
+  .dec = -13.0917,
+},
+{ .is_ngc = TRUE,
+  .id = 5916,
+  .ra = 230.407,
+  .dec = -13.1697,
+},
+{ .is_ngc = TRUE,
+  .id = 5917,
+  .ra = 230.386,
+  .dec = -7.37803,
+},
+{ .is_ngc = TRUE,
+  .id = 5918,
+  .ra = 229.855,
+  .dec = 45.8801,
+},
+{ .is_ngc = TRUE,
+  .id = 5919,
+  .ra = 230.404,
+  .dec = 7.71915,
+},
+{ .is_ngc = TRUE,
+  .id = 5920,
+  .ra = 230.466,
+  .dec = 7.70881,
+},
+{ .is_ngc = TRUE,
+  .id = 5921,
+  .ra = 230.485,
+  .dec = 5.07003,
+},
+{ .is_ngc = TRUE,
+  .id = 5922,
+  .ra = 230.287,
+  .dec = 41.6722,
+},
+{ .is_ngc = TRUE,
+  .id = 5923,
+  .ra = 230.31,
+  .dec = 41.7258,
+},
+{ .is_ngc = TRUE,
+  .id = 5924,
+  .ra = 230.508,
+  .dec = 31.2322,
+},
+{ .is_ngc = TRUE,
+  .id = 5925,
+  .ra = 231.858,
+  .dec = -54.5186,
+},
+{ .is_ngc = TRUE,
+  .id = 5926,
+  .ra = 230.854,
+  .dec = 12.715,
+},
+{ .is_ngc = TRUE,
+  .id = 5927,
+  .ra = 232.002,
+  .dec = -50.673,
+},
+{ .is_ngc = TRUE,
+  .id = 5928,
+  .ra = 231.512,
+  .dec = 18.0735,
+},
+{ .is_ngc = TRUE,
+  .id = 5929,
+  .ra = 231.525,
+  .dec = 41.6705,
+},
+{ .is_ngc = TRUE,
+  .id = 5930,
+  .ra = 231.533,
+  .dec = 41.676,
+},
+{ .is_ngc = TRUE,
+  .id = 5931,
+  .ra = 232.373,
+  .dec = 7.57272,
+},
+{ .is_ngc = TRUE,
+  .id = 5932,
+  .ra = 231.701,
+  .dec = 48.6146,
+},
+{ .is_ngc = TRUE,
+  .id = 5933,
+  .ra = 231.756,
+  .dec = 48.6132,
+},
+{ .is_ngc = TRUE,
+  .id = 5934,
+  .ra = 232.053,
+  .dec = 42.9297,
+},
+{ .is_ngc = TRUE,
+  .id = 5935,
+  .ra = 232.07,
+  .dec = 42.944,
+},
+{ .is_ngc = TRUE,
+  .id = 5936,
+  .ra = 232.504,
+  .dec = 12.9892,
+},
+{ .is_ngc = TRUE,
+  .id = 5937,
+  .ra = 232.692,
+  .dec = -2.82972,
+},
+{ .is_ngc = TRUE,
+  .id = 5938,
+  .ra = 234.109,
+  .dec = -66.8592,
+},
+{ .is_ngc = TRUE,
+  .id = 5939,
+  .ra = 231.19,
+  .dec = 68.7299,
+},
+{ .is_ngc = TRUE,
+  .id = 5940,
+  .ra = 232.825,
+  .dec = 7.45756,
+},
+{ .is_ngc = TRUE,
+  .id = 5941,
+  .ra = 232.918,
+  .dec = 7.33869,
+},
+{ .is_ngc = TRUE,
+  .id = 5942,
+  .ra = 232.903,
+  .dec = 7.31216,
+},
+{ .is_ngc = TRUE,
+  .id = 5943,
+  .ra = 232.434,
+  .dec = 42.778,
+},
+{ .is_ngc = TRUE,
+  .id = 5944,
+  .ra = 232.948,
+  .dec = 7.30778,
+},
+{ .is_ngc = TRUE,
+  .id = 5945,
+  .ra = 232.438,
+  .dec = 42.9188,
+},
+{ .is_ngc = TRUE,
+  .id = 5947,
+  .ra = 232.653,
+  .dec = 42.7168,
+},
+{ .is_ngc = TRUE,
+  .id = 5948,
+  .ra = 233.244,
+  .dec = 3.98283,
+},
+{ .is_ngc = TRUE,
+  .id = 5949,
+  .ra = 232.003,
+  .dec = 64.763,
+},
+{ .is_ngc = TRUE,
+  .id = 5950,
+  .ra = 232.878,
+  .dec = 40.4298,
+},
+{ .is_ngc = TRUE,
+  .id = 5951,
+  .ra = 233.429,
+  .dec = 15.0073,
+},
+{ .is_ngc = TRUE,
+  .id = 5952,
+  .ra = 233.735,
+  .dec = 4.9588,
+},
+{ .is_ngc = TRUE,
+  .id = 5953,
+  .ra = 233.635,
+  .dec = 15.1939,
+},
+{ .is_ngc = TRUE,
+  .id = 5954,
+  .ra = 233.646,
+  .dec = 15.2006,
+},
+{ .is_ngc = TRUE,
+  .id = 5955,
+  .ra = 233.802,
+  .dec = 5.0631,
+},
+{ .is_ngc = TRUE,
+  .id = 5956,
+  .ra = 233.744,
+  .dec = 11.75,
+},
+{ .is_ngc = TRUE,
+  .id = 5957,
+  .ra = 233.847,
+  .dec = 12.0476,
+},
+{ .is_ngc = TRUE,
+  .id = 5958,
+  .ra = 233.705,
+  .dec = 28.655,
+},
+{ .is_ngc = TRUE,
+  .id = 5959,
+  .ra = 234.343,
+  .dec = -16.5961,
+},
+{ .is_ngc = TRUE,
+  .id = 5960,
+  .ra = 234.077,
+  .dec = 5.66544,
+},
+{ .is_ngc = TRUE,
+  .id = 5961,
+  .ra = 233.818,
+  .dec = 30.8642,
+},
+{ .is_ngc = TRUE,
+  .id = 5962,
+  .ra = 234.132,
+  .dec = 16.6079,
+},
+{ .is_ngc = TRUE,
+  .id = 5963,
+  .ra = 233.367,
+  .dec = 56.559,
+},
+{ .is_ngc = TRUE,
+  .id = 5965,
+  .ra = 233.509,
+  .dec = 56.6857,
+},
+{ .is_ngc = TRUE,
+  .id = 5966,
+  .ra = 233.967,
+  .dec = 39.7687,
+},
+{ .is_ngc = TRUE,
+  .id = 5967,
+  .ra = 237.067,
+  .dec = -75.6731,
+},
+{ .is_ngc = TRUE,
+  .id = 5968,
+  .ra = 234.988,
+  .dec = -30.5528,
+},
+{ .is_ngc = TRUE,
+  .id = 5969,
+  .ra = 233.713,
+  .dec = 56.4505,
+},
+{ .is_ngc = TRUE,
+  .id = 5970,
+  .ra = 234.625,
+  .dec = 12.1863,
+},
+{ .is_ngc = TRUE,
+  .id = 5971,
+  .ra = 233.904,
+  .dec = 56.461,
+},
+{ .is_ngc = TRUE,
+  .id = 5972,
+  .ra = 234.726,
+  .dec = 17.0258,
+},
+{ .is_ngc = TRUE,
+  .id = 5973,
+  .ra = 235.065,
+  .dec = -8.60167,
+},
+{ .is_ngc = TRUE,
+  .id = 5974,
+  .ra = 234.76,
+  .dec = 31.7595,
+},
+{ .is_ngc = TRUE,
+  .id = 5975,
+  .ra = 234.992,
+  .dec = 21.4703,
+},
+{ .is_ngc = TRUE,
+  .id = 5976,
+  .ra = 234.2,
+  .dec = 59.3977,
+},
+{ .is_ngc = TRUE,
+  .id = 5977,
+  .ra = 235.14,
+  .dec = 17.1278,
+},
+{ .is_ngc = TRUE,
+  .id = 5978,
+  .ra = 235.613,
+  .dec = -13.2345,
+},
+{ .is_ngc = TRUE,
+  .id = 5979,
+  .ra = 236.92,
+  .dec = -61.2177,
+},
+{ .is_ngc = TRUE,
+  .id = 5980,
+  .ra = 235.377,
+  .dec = 15.7877,
+},
+{ .is_ngc = TRUE,
+  .id = 5981,
+  .ra = 234.473,
+  .dec = 59.3915,
+},
+{ .is_ngc = TRUE,
+  .id = 5982,
+  .ra = 234.667,
+  .dec = 59.3558,
+},
+{ .is_ngc = TRUE,
+  .id = 5983,
+  .ra = 235.69,
+  .dec = 8.24099,
+},
+{ .is_ngc = TRUE,
+  .id = 5984,
+  .ra = 235.722,
+  .dec = 14.2316,
+},
+{ .is_ngc = TRUE,
+  .id = 5985,
+  .ra = 234.905,
+  .dec = 59.3318,
+},
+{ .is_ngc = TRUE,
+  .id = 5986,
+  .ra = 236.515,
+  .dec = -37.7857,
+},
+{ .is_ngc = TRUE,
+  .id = 5987,
+  .ra = 234.989,
+  .dec = 58.0798,
+},
+{ .is_ngc = TRUE,
+  .id = 5988,
+  .ra = 236.141,
+  .dec = 10.2929,
+},
+{ .is_ngc = TRUE,
+  .id = 5989,
+  .ra = 235.386,
+  .dec = 59.7547,
+},
+{ .is_ngc = TRUE,
+  .id = 5990,
+  .ra = 236.568,
+  .dec = 2.41511,
+},
+{ .is_ngc = TRUE,
+  .id = 5991,
+  .ra = 236.32,
+  .dec = 24.6305,
+},
+{ .is_ngc = TRUE,
+  .id = 5992,
+  .ra = 236.09,
+  .dec = 41.0858,
+},
+{ .is_ngc = TRUE,
+  .id = 5993,
+  .ra = 236.115,
+  .dec = 41.1205,
+},
+{ .is_ngc = TRUE,
+  .id = 5994,
+  .ra = 236.722,
+  .dec = 17.8728,
+},
+{ .is_ngc = TRUE,
+  .id = 5995,
+  .ra = 237.104,
+  .dec = -13.7578,
+},
+{ .is_ngc = TRUE,
+  .id = 5996,
+  .ra = 236.746,
+  .dec = 17.8839,
+},
+{ .is_ngc = TRUE,
+  .id = 5997,
+  .ra = 236.865,
+  .dec = 8.32108,
+},
+{ .is_ngc = TRUE,
+  .id = 5998,
+  .ra = 237.408,
+  .dec = -28.5686,
+},
+{ .is_ngc = TRUE,
+  .id = 5998,
+  .ra = 237.375,
+  .dec = -28.5997,
+},
+{ .is_ngc = TRUE,
+  .id = 5999,
+  .ra = 238.033,
+  .dec = -56.4678,
+},
+{ .is_ngc = TRUE,
+  .id = 6000,
+  .ra = 237.458,
+  .dec = -29.3867,
+},
+{ .is_ngc = TRUE,
+  .id = 6001,
+  .ra = 236.941,
+  .dec = 28.6414,
+},
+{ .is_ngc = TRUE,
+  .id = 6002,
+  .ra = 236.935,
+  .dec = 28.6097,
+},
+{ .is_ngc = TRUE,
+  .id = 6003,
+  .ra = 237.357,
+  .dec = 19.0322,
+},
+{ .is_ngc = TRUE,
+  .id = 6004,
+  .ra = 237.595,
+  .dec = 18.9387,
+},
+{ .is_ngc = TRUE,
+  .id = 6005,
+  .ra = 238.95,
+  .dec = -57.4339,
+},
+{ .is_ngc = TRUE,
+  .id = 6006,
+  .ra = 238.261,
+  .dec = 12.0053,
+},
+{ .is_ngc = TRUE,
+  .id = 6007,
+  .ra = 238.347,
+  .dec = 11.9591,
+},
+{ .is_ngc = TRUE,
+  .id = 6009,
+  .ra = 238.351,
+  .dec = 12.058,
+},
+{ .is_ngc = TRUE,
+  .id = 6010,
+  .ra = 238.579,
+  .dec = 0.543167,
+},
+{ .is_ngc = TRUE,
+  .id = 6011,
+  .ra = 236.637,
+  .dec = 72.1695,
+},
+{ .is_ngc = TRUE,
+  .id = 6012,
+  .ra = 238.557,
+  .dec = 14.6015,
+},
+{ .is_ngc = TRUE,
+  .id = 6013,
+  .ra = 238.22,
+  .dec = 40.6463,
+},
+{ .is_ngc = TRUE,
+  .id = 6015,
+  .ra = 237.855,
+  .dec = 62.3097,
+},
+{ .is_ngc = TRUE,
+  .id = 6016,
+  .ra = 238.979,
+  .dec = 26.9666,
+},
+{ .is_ngc = TRUE,
+  .id = 6017,
+  .ra = 239.314,
+  .dec = 5.99836,
+},
+{ .is_ngc = TRUE,
+  .id = 6019,
+  .ra = 238.038,
+  .dec = 64.8404,
+},
+{ .is_ngc = TRUE,
+  .id = 6021,
+  .ra = 239.378,
+  .dec = 15.9558,
+},
+{ .is_ngc = TRUE,
+  .id = 6022,
+  .ra = 239.449,
+  .dec = 16.2821,
+},
+{ .is_ngc = TRUE,
+  .id = 6023,
+  .ra = 239.457,
+  .dec = 16.3097,
+},
+{ .is_ngc = TRUE,
+  .id = 6024,
+  .ra = 238.282,
+  .dec = 64.9178,
+},
+{ .is_ngc = TRUE,
+  .id = 6025,
+  .ra = 240.821,
+  .dec = -60.4192,
+},
+{ .is_ngc = TRUE,
+  .id = 6026,
+  .ra = 240.338,
+  .dec = -34.5435,
+},
+{ .is_ngc = TRUE,
+  .id = 6027,
+  .ra = 239.802,
+  .dec = 20.7633,
+},
+{ .is_ngc = TRUE,
+  .id = 6029,
+  .ra = 240.495,
+  .dec = 12.5743,
+},
+{ .is_ngc = TRUE,
+  .id = 6030,
+  .ra = 240.464,
+  .dec = 17.9575,
+},
+{ .is_ngc = TRUE,
+  .id = 6031,
+  .ra = 241.896,
+  .dec = -54.0025,
+},
+{ .is_ngc = TRUE,
+  .id = 6032,
+  .ra = 240.755,
+  .dec = 20.9557,
+},
+{ .is_ngc = TRUE,
+  .id = 6033,
+  .ra = 241.117,
+  .dec = -2.12111,
+},
+{ .is_ngc = TRUE,
+  .id = 6034,
+  .ra = 240.884,
+  .dec = 17.1981,
+},
+{ .is_ngc = TRUE,
+  .id = 6035,
+  .ra = 240.85,
+  .dec = 20.8909,
+},
+{ .is_ngc = TRUE,
+  .id = 6036,
+  .ra = 241.128,
+  .dec = 3.86803,
+},
+{ .is_ngc = TRUE,
+  .id = 6037,
+  .ra = 241.125,
+  .dec = 3.81484,
+},
+{ .is_ngc = TRUE,
+  .id = 6038,
+  .ra = 240.669,
+  .dec = 37.3591,
+},
+{ .is_ngc = TRUE,
+  .id = 6047,
+  .ra = 241.287,
+  .dec = 17.7293,
+},
+{ .is_ngc = TRUE,
+  .id = 6048,
+  .ra = 239.377,
+  .dec = 70.6891,
+},
+{ .is_ngc = TRUE,
+  .id = 6049,
+  .ra = 241.408,
+  .dec = 8.09611,
+},
+{ .is_ngc = TRUE,
+  .id = 6051,
+  .ra = 241.236,
+  .dec = 23.9325,
+},
+{ .is_ngc = TRUE,
+  .id = 6055,
+  .ra = 241.386,
+  .dec = 18.1594,
+},
+{ .is_ngc = TRUE,
+  .id = 6058,
+  .ra = 241.111,
+  .dec = 40.683,
+},
+{ .is_ngc = TRUE,
+  .id = 6059,
+  .ra = 241.804,
+  .dec = -6.40222,
+},
+{ .is_ngc = TRUE,
+  .id = 6060,
+  .ra = 241.467,
+  .dec = 21.4844,
+},
+{ .is_ngc = TRUE,
+  .id = 6061,
+  .ra = 241.567,
+  .dec = 18.2498,
+},
+{ .is_ngc = TRUE,
+  .id = 6062,
+  .ra = 241.595,
+  .dec = 19.7776,
+},
+{ .is_ngc = TRUE,
+  .id = 6063,
+  .ra = 241.805,
+  .dec = 7.97872,
+},
+{ .is_ngc = TRUE,
+  .id = 6065,
+  .ra = 241.846,
+  .dec = 13.8879,
+},
+{ .is_ngc = TRUE,
+  .id = 6066,
+  .ra = 241.897,
+  .dec = 13.9435,
+},
+{ .is_ngc = TRUE,
+  .id = 6067,
+  .ra = 243.296,
+  .dec = -54.2169,
+},
+{ .is_ngc = TRUE,
+  .id = 6068,
+  .ra = 238.86,
+  .dec = 78.9969,
+},
+{ .is_ngc = TRUE,
+  .id = 6069,
+  .ra = 241.924,
+  .dec = 38.9307,
+},
+{ .is_ngc = TRUE,
+  .id = 6071,
+  .ra = 240.529,
+  .dec = 70.417,
+},
+{ .is_ngc = TRUE,
+  .id = 6072,
+  .ra = 243.243,
+  .dec = -36.2298,
+},
+{ .is_ngc = TRUE,
+  .id = 6073,
+  .ra = 242.545,
+  .dec = 16.699,
+},
+{ .is_ngc = TRUE,
+  .id = 6074,
+  .ra = 242.822,
+  .dec = 14.2587,
+},
+{ .is_ngc = TRUE,
+  .id = 6077,
+  .ra = 242.809,
+  .dec = 26.9234,
+},
+{ .is_ngc = TRUE,
+  .id = 6078,
+  .ra = 243.023,
+  .dec = 14.2087,
+},
+{ .is_ngc = TRUE,
+  .id = 6080,
+  .ra = 243.245,
+  .dec = 2.17728,
+},
+{ .is_ngc = TRUE,
+  .id = 6082,
+  .ra = 243.9,
+  .dec = -34.235,
+},
+{ .is_ngc = TRUE,
+  .id = 6082,
+  .ra = 243.865,
+  .dec = -34.2325,
+},
+{ .is_ngc = TRUE,
+  .id = 6083,
+  .ra = 243.303,
+  .dec = 14.1853,
+},
+{ .is_ngc = TRUE,
+  .id = 6084,
+  .ra = 243.57,
+  .dec = 17.7571,
+},
+{ .is_ngc = TRUE,
+  .id = 6085,
+  .ra = 243.147,
+  .dec = 29.3648,
+},
+{ .is_ngc = TRUE,
+  .id = 6086,
+  .ra = 243.148,
+  .dec = 29.4848,
+},
+{ .is_ngc = TRUE,
+  .id = 6087,
+  .ra = 244.708,
+  .dec = -57.9336,
+},
+{ .is_ngc = TRUE,
+  .id = 6090,
+  .ra = 242.92,
+  .dec = 52.457,
+},
+{ .is_ngc = TRUE,
+  .id = 6091,
+  .ra = 241.97,
+  .dec = 69.9047,
+},
+{ .is_ngc = TRUE,
+  .id = 6092,
+  .ra = 243.519,
+  .dec = 28.1256,
+},
+{ .is_ngc = TRUE,
+  .id = 6093,
+  .ra = 244.262,
+  .dec = -22.9755,
+},
+{ .is_ngc = TRUE,
+  .id = 6094,
+  .ra = 241.641,
+  .dec = 72.4942,
+},
+{ .is_ngc = TRUE,
+  .id = 6095,
+  .ra = 242.797,
+  .dec = 61.2678,
+},
+{ .is_ngc = TRUE,
+  .id = 6096,
+  .ra = 243.695,
+  .dec = 26.5588,
+},
+{ .is_ngc = TRUE,
+  .id = 6097,
+  .ra = 243.609,
+  .dec = 35.1088,
+},
+{ .is_ngc = TRUE,
+  .id = 6098,
+  .ra = 243.892,
+  .dec = 19.4611,
+},
+{ .is_ngc = TRUE,
+  .id = 6099,
+  .ra = 243.898,
+  .dec = 19.453,
+},
+{ .is_ngc = TRUE,
+  .id = 6100,
+  .ra = 244.218,
+  .dec = 0.840667,
+},
+{ .is_ngc = TRUE,
+  .id = 6101,
+  .ra = 246.449,
+  .dec = -72.2014,
+},
+{ .is_ngc = TRUE,
+  .id = 6102,
+  .ra = 243.904,
+  .dec = 28.1585,
+},
+{ .is_ngc = TRUE,
+  .id = 6103,
+  .ra = 243.936,
+  .dec = 31.9639,
+},
+{ .is_ngc = TRUE,
+  .id = 6104,
+  .ra = 244.128,
+  .dec = 35.7074,
+},
+{ .is_ngc = TRUE,
+  .id = 6105,
+  .ra = 244.289,
+  .dec = 34.8789,
+},
+{ .is_ngc = TRUE,
+  .id = 6106,
+  .ra = 244.697,
+  .dec = 7.41131,
+},
+{ .is_ngc = TRUE,
+  .id = 6107,
+  .ra = 244.334,
+  .dec = 34.9015,
+},
+{ .is_ngc = TRUE,
+  .id = 6108,
+  .ra = 244.357,
+  .dec = 35.1356,
+},
+{ .is_ngc = TRUE,
+  .id = 6109,
+  .ra = 244.419,
+  .dec = 35.004,
+},
+{ .is_ngc = TRUE,
+  .id = 6110,
+  .ra = 244.433,
+  .dec = 35.0873,
+},
+{ .is_ngc = TRUE,
+  .id = 6112,
+  .ra = 244.502,
+  .dec = 35.1102,
+},
+{ .is_ngc = TRUE,
+  .id = 6113,
+  .ra = 244.795,
+  .dec = 14.1332,
+},
+{ .is_ngc = TRUE,
+  .id = 6114,
+  .ra = 244.598,
+  .dec = 35.1741,
+},
+{ .is_ngc = TRUE,
+  .id = 6115,
+  .ra = 246.108,
+  .dec = -51.9358,
+},
+{ .is_ngc = TRUE,
+  .id = 6116,
+  .ra = 244.727,
+  .dec = 35.1537,
+},
+{ .is_ngc = TRUE,
+  .id = 6118,
+  .ra = 245.453,
+  .dec = -2.28397,
+},
+{ .is_ngc = TRUE,
+  .id = 6119,
+  .ra = 244.925,
+  .dec = 37.8064,
+},
+{ .is_ngc = TRUE,
+  .id = 6120,
+  .ra = 244.95,
+  .dec = 37.7741,
+},
+{ .is_ngc = TRUE,
+  .id = 6121,
+  .ra = 245.897,
+  .dec = -26.5263,
+},
+{ .is_ngc = TRUE,
+  .id = 6122,
+  .ra = 245.04,
+  .dec = 37.798,
+},
+{ .is_ngc = TRUE,
+  .id = 6123,
+  .ra = 244.333,
+  .dec = 61.9389,
+},
+{ .is_ngc = TRUE,
+  .id = 6124,
+  .ra = 246.333,
+  .dec = -40.6506,
+},
+{ .is_ngc = TRUE,
+  .id = 6126,
+  .ra = 245.366,
+  .dec = 36.3763,
+},
+{ .is_ngc = TRUE,
+  .id = 6129,
+  .ra = 245.431,
+  .dec = 37.9961,
+},
+{ .is_ngc = TRUE,
+  .id = 6130,
+  .ra = 244.889,
+  .dec = 57.6147,
+},
+{ .is_ngc = TRUE,
+  .id = 6133,
+  .ra = 245.071,
+  .dec = 56.6525,
+},
+{ .is_ngc = TRUE,
+  .id = 6134,
+  .ra = 246.942,
+  .dec = -49.1503,
+},
+{ .is_ngc = TRUE,
+  .id = 6135,
+  .ra = 243.605,
+  .dec = 64.9831,
+},
+{ .is_ngc = TRUE,
+  .id = 6136,
+  .ra = 245.248,
+  .dec = 55.9698,
+},
+{ .is_ngc = TRUE,
+  .id = 6139,
+  .ra = 246.918,
+  .dec = -38.8491,
+},
+{ .is_ngc = TRUE,
+  .id = 6140,
+  .ra = 245.238,
+  .dec = 65.39,
+},
+{ .is_ngc = TRUE,
+  .id = 6141,
+  .ra = 245.776,
+  .dec = 40.8585,
+},
+{ .is_ngc = TRUE,
+  .id = 6142,
+  .ra = 245.838,
+  .dec = 37.2581,
+},
+{ .is_ngc = TRUE,
+  .id = 6143,
+  .ra = 245.426,
+  .dec = 55.0861,
+},
+{ .is_ngc = TRUE,
+  .id = 6145,
+  .ra = 246.26,
+  .dec = 40.9464,
+},
+{ .is_ngc = TRUE,
+  .id = 6146,
+  .ra = 246.293,
+  .dec = 40.8929,
+},
+{ .is_ngc = TRUE,
+  .id = 6147,
+  .ra = 246.274,
+  .dec = 40.9288,
+},
+{ .is_ngc = TRUE,
+  .id = 6148,
+  .ra = 246.767,
+  .dec = 24.0928,
+},
+{ .is_ngc = TRUE,
+  .id = 6149,
+  .ra = 246.851,
+  .dec = 19.5969,
+},
+{ .is_ngc = TRUE,
+  .id = 6151,
+  .ra = 249.605,
+  .dec = -73.2525,
+},
+{ .is_ngc = TRUE,
+  .id = 6152,
+  .ra = 248.188,
+  .dec = -52.635,
+},
+{ .is_ngc = TRUE,
+  .id = 6153,
+  .ra = 247.877,
+  .dec = -40.2536,
+},
+{ .is_ngc = TRUE,
+  .id = 6154,
+  .ra = 246.377,
+  .dec = 49.8398,
+},
+{ .is_ngc = TRUE,
+  .id = 6155,
+  .ra = 246.535,
+  .dec = 48.3666,
+},
+{ .is_ngc = TRUE,
+  .id = 6156,
+  .ra = 248.72,
+  .dec = -60.6181,
+},
+{ .is_ngc = TRUE,
+  .id = 6157,
+  .ra = 246.452,
+  .dec = 55.3605,
+},
+{ .is_ngc = TRUE,
+  .id = 6158,
+  .ra = 246.92,
+  .dec = 39.3832,
+},
+{ .is_ngc = TRUE,
+  .id = 6159,
+  .ra = 246.855,
+  .dec = 42.6796,
+},
+{ .is_ngc = TRUE,
+  .id = 6160,
+  .ra = 246.921,
+  .dec = 40.9268,
+},
+{ .is_ngc = TRUE,
+  .id = 6161,
+  .ra = 247.086,
+  .dec = 32.8105,
+},
+{ .is_ngc = TRUE,
+  .id = 6162,
+  .ra = 247.093,
+  .dec = 32.8492,
+},
+{ .is_ngc = TRUE,
+  .id = 6163,
+  .ra = 247.116,
+  .dec = 32.8462,
+},
+{ .is_ngc = TRUE,
+  .id = 6164,
+  .ra = 248.424,
+  .dec = -48.0797,
+},
+{ .is_ngc = TRUE,
+  .id = 6165,
+  .ra = 248.513,
+  .dec = -48.1514,
+},
+{ .is_ngc = TRUE,
+  .id = 6166,
+  .ra = 247.16,
+  .dec = 39.5513,
+},
+{ .is_ngc = TRUE,
+  .id = 6167,
+  .ra = 248.642,
+  .dec = -49.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 6168,
+  .ra = 247.839,
+  .dec = 20.1847,
+},
+{ .is_ngc = TRUE,
+  .id = 6169,
+  .ra = 248.517,
+  .dec = -44.0353,
+},
+{ .is_ngc = TRUE,
+  .id = 6171,
+  .ra = 248.133,
+  .dec = -13.0532,
+},
+{ .is_ngc = TRUE,
+  .id = 6173,
+  .ra = 247.437,
+  .dec = 40.8111,
+},
+{ .is_ngc = TRUE,
+  .id = 6174,
+  .ra = 247.496,
+  .dec = 40.8019,
+},
+{ .is_ngc = TRUE,
+  .id = 6175,
+  .ra = 247.49,
+  .dec = 40.6299,
+},
+{ .is_ngc = TRUE,
+  .id = 6177,
+  .ra = 247.662,
+  .dec = 35.0559,
+},
+{ .is_ngc = TRUE,
+  .id = 6178,
+  .ra = 248.946,
+  .dec = -45.635,
+},
+{ .is_ngc = TRUE,
+  .id = 6179,
+  .ra = 247.697,
+  .dec = 35.102,
+},
+{ .is_ngc = TRUE,
+  .id = 6180,
+  .ra = 247.641,
+  .dec = 40.5392,
+},
+{ .is_ngc = TRUE,
+  .id = 6181,
+  .ra = 248.087,
+  .dec = 19.8256,
+},
+{ .is_ngc = TRUE,
+  .id = 6182,
+  .ra = 247.392,
+  .dec = 55.5175,
+},
+{ .is_ngc = TRUE,
+  .id = 6183,
+  .ra = 250.424,
+  .dec = -69.3728,
+},
+{ .is_ngc = TRUE,
+  .id = 6184,
+  .ra = 247.894,
+  .dec = 40.5654,
+},
+{ .is_ngc = TRUE,
+  .id = 6185,
+  .ra = 248.325,
+  .dec = 35.3417,
+},
+{ .is_ngc = TRUE,
+  .id = 6186,
+  .ra = 248.606,
+  .dec = 21.5406,
+},
+{ .is_ngc = TRUE,
+  .id = 6187,
+  .ra = 247.903,
+  .dec = 57.7067,
+},
+{ .is_ngc = TRUE,
+  .id = 6188,
+  .ra = 250.021,
+  .dec = -48.6519,
+},
+{ .is_ngc = TRUE,
+  .id = 6190,
+  .ra = 248.028,
+  .dec = 58.439,
+},
+{ .is_ngc = TRUE,
+  .id = 6191,
+  .ra = 242.877,
+  .dec = 58.7859,
+},
+{ .is_ngc = TRUE,
+  .id = 6192,
+  .ra = 250.096,
+  .dec = -43.3667,
+},
+{ .is_ngc = TRUE,
+  .id = 6193,
+  .ra = 250.333,
+  .dec = -48.7522,
+},
+{ .is_ngc = TRUE,
+  .id = 6194,
+  .ra = 249.155,
+  .dec = 36.2003,
+},
+{ .is_ngc = TRUE,
+  .id = 6195,
+  .ra = 249.136,
+  .dec = 39.0276,
+},
+{ .is_ngc = TRUE,
+  .id = 6198,
+  .ra = 248.878,
+  .dec = 57.4868,
+},
+{ .is_ngc = TRUE,
+  .id = 6199,
+  .ra = 249.871,
+  .dec = 36.0589,
+},
+{ .is_ngc = TRUE,
+  .id = 6200,
+  .ra = 251.029,
+  .dec = -47.4522,
+},
+{ .is_ngc = TRUE,
+  .id = 6201,
+  .ra = 250.06,
+  .dec = 23.7647,
+},
+{ .is_ngc = TRUE,
+  .id = 6203,
+  .ra = 250.114,
+  .dec = 23.7747,
+},
+{ .is_ngc = TRUE,
+  .id = 6204,
+  .ra = 251.537,
+  .dec = -47.0167,
+},
+{ .is_ngc = TRUE,
+  .id = 6205,
+  .ra = 250.422,
+  .dec = 36.4598,
+},
+{ .is_ngc = TRUE,
+  .id = 6207,
+  .ra = 250.766,
+  .dec = 36.8322,
+},
+{ .is_ngc = TRUE,
+  .id = 6208,
+  .ra = 252.367,
+  .dec = -53.7186,
+},
+{ .is_ngc = TRUE,
+  .id = 6209,
+  .ra = 253.743,
+  .dec = -72.5867,
+},
+{ .is_ngc = TRUE,
+  .id = 6210,
+  .ra = 251.123,
+  .dec = 23.7998,
+},
+{ .is_ngc = TRUE,
+  .id = 6211,
+  .ra = 250.366,
+  .dec = 57.7837,
+},
+{ .is_ngc = TRUE,
+  .id = 6212,
+  .ra = 250.846,
+  .dec = 39.8066,
+},
+{ .is_ngc = TRUE,
+  .id = 6213,
+  .ra = 250.405,
+  .dec = 57.8147,
+},
+{ .is_ngc = TRUE,
+  .id = 6214,
+  .ra = 249.884,
+  .dec = 66.0396,
+},
+{ .is_ngc = TRUE,
+  .id = 6215,
+  .ra = 252.779,
+  .dec = -58.9928,
+},
+{ .is_ngc = TRUE,
+  .id = 6217,
+  .ra = 248.163,
+  .dec = 78.1981,
+},
+{ .is_ngc = TRUE,
+  .id = 6218,
+  .ra = 251.81,
+  .dec = -1.94769,
+},
+{ .is_ngc = TRUE,
+  .id = 6219,
+  .ra = 251.594,
+  .dec = 9.03797,
+},
+{ .is_ngc = TRUE,
+  .id = 6220,
+  .ra = 251.805,
+  .dec = -0.27545,
+},
+{ .is_ngc = TRUE,
+  .id = 6221,
+  .ra = 253.193,
+  .dec = -59.2171,
+},
+{ .is_ngc = TRUE,
+  .id = 6223,
+  .ra = 250.768,
+  .dec = 61.5781,
+},
+{ .is_ngc = TRUE,
+  .id = 6224,
+  .ra = 252.077,
+  .dec = 6.31192,
+},
+{ .is_ngc = TRUE,
+  .id = 6225,
+  .ra = 252.09,
+  .dec = 6.22261,
+},
+{ .is_ngc = TRUE,
+  .id = 6227,
+  .ra = 252.887,
+  .dec = -41.2167,
+},
+{ .is_ngc = TRUE,
+  .id = 6228,
+  .ra = 252.012,
+  .dec = 26.2125,
+},
+{ .is_ngc = TRUE,
+  .id = 6229,
+  .ra = 251.745,
+  .dec = 47.5274,
+},
+{ .is_ngc = TRUE,
+  .id = 6230,
+  .ra = 252.695,
+  .dec = 4.60433,
+},
+{ .is_ngc = TRUE,
+  .id = 6231,
+  .ra = 253.542,
+  .dec = -41.8181,
+},
+{ .is_ngc = TRUE,
+  .id = 6232,
+  .ra = 250.834,
+  .dec = 70.6322,
+},
+{ .is_ngc = TRUE,
+  .id = 6233,
+  .ra = 252.565,
+  .dec = 23.5796,
+},
+{ .is_ngc = TRUE,
+  .id = 6234,
+  .ra = 252.989,
+  .dec = 4.38351,
+},
+{ .is_ngc = TRUE,
+  .id = 6235,
+  .ra = 253.354,
+  .dec = -22.1761,
+},
+{ .is_ngc = TRUE,
+  .id = 6236,
+  .ra = 251.144,
+  .dec = 70.7801,
+},
+{ .is_ngc = TRUE,
+  .id = 6237,
+  .ra = 251.029,
+  .dec = 70.6336,
+},
+{ .is_ngc = TRUE,
+  .id = 6238,
+  .ra = 251.818,
+  .dec = 62.1469,
+},
+{ .is_ngc = TRUE,
+  .id = 6239,
+  .ra = 252.522,
+  .dec = 42.7394,
+},
+{ .is_ngc = TRUE,
+  .id = 6241,
+  .ra = 252.546,
+  .dec = 45.4206,
+},
+{ .is_ngc = TRUE,
+  .id = 6242,
+  .ra = 253.887,
+  .dec = -39.4519,
+},
+{ .is_ngc = TRUE,
+  .id = 6243,
+  .ra = 253.11,
+  .dec = 23.3325,
+},
+{ .is_ngc = TRUE,
+  .id = 6244,
+  .ra = 252.016,
+  .dec = 62.2002,
+},
+{ .is_ngc = TRUE,
+  .id = 6245,
+  .ra = 251.342,
+  .dec = 70.8008,
+},
+{ .is_ngc = TRUE,
+  .id = 6246,
+  .ra = 252.471,
+  .dec = 55.5432,
+},
+{ .is_ngc = TRUE,
+  .id = 6248,
+  .ra = 251.594,
+  .dec = 70.3555,
+},
+{ .is_ngc = TRUE,
+  .id = 6249,
+  .ra = 254.421,
+  .dec = -44.8019,
+},
+{ .is_ngc = TRUE,
+  .id = 6250,
+  .ra = 254.483,
+  .dec = -45.9339,
+},
+{ .is_ngc = TRUE,
+  .id = 6251,
+  .ra = 248.135,
+  .dec = 82.5378,
+},
+{ .is_ngc = TRUE,
+  .id = 6252,
+  .ra = 248.169,
+  .dec = 82.5764,
+},
+{ .is_ngc = TRUE,
+  .id = 6253,
+  .ra = 254.771,
+  .dec = -52.7014,
+},
+{ .is_ngc = TRUE,
+  .id = 6254,
+  .ra = 254.288,
+  .dec = -4.09883,
+},
+{ .is_ngc = TRUE,
+  .id = 6255,
+  .ra = 253.697,
+  .dec = 36.5018,
+},
+{ .is_ngc = TRUE,
+  .id = 6256,
+  .ra = 254.886,
+  .dec = -37.1213,
+},
+{ .is_ngc = TRUE,
+  .id = 6257,
+  .ra = 254.015,
+  .dec = 39.6454,
+},
+{ .is_ngc = TRUE,
+  .id = 6258,
+  .ra = 253.125,
+  .dec = 60.5142,
+},
+{ .is_ngc = TRUE,
+  .id = 6259,
+  .ra = 255.188,
+  .dec = -44.6508,
+},
+{ .is_ngc = TRUE,
+  .id = 6260,
+  .ra = 252.959,
+  .dec = 63.7146,
+},
+{ .is_ngc = TRUE,
+  .id = 6261,
+  .ra = 254.127,
+  .dec = 27.9775,
+},
+{ .is_ngc = TRUE,
+  .id = 6262,
+  .ra = 254.679,
+  .dec = 57.0985,
+},
+{ .is_ngc = TRUE,
+  .id = 6263,
+  .ra = 254.18,
+  .dec = 27.822,
+},
+{ .is_ngc = TRUE,
+  .id = 6264,
+  .ra = 254.317,
+  .dec = 27.8492,
+},
+{ .is_ngc = TRUE,
+  .id = 6265,
+  .ra = 254.371,
+  .dec = 27.8443,
+},
+{ .is_ngc = TRUE,
+  .id = 6266,
+  .ra = 255.304,
+  .dec = -30.1124,
+},
+{ .is_ngc = TRUE,
+  .id = 6267,
+  .ra = 254.536,
+  .dec = 22.9848,
+},
+{ .is_ngc = TRUE,
+  .id = 6268,
+  .ra = 255.542,
+  .dec = -39.7186,
+},
+{ .is_ngc = TRUE,
+  .id = 6269,
+  .ra = 254.492,
+  .dec = 27.8546,
+},
+{ .is_ngc = TRUE,
+  .id = 6270,
+  .ra = 254.684,
+  .dec = 27.8593,
+},
+{ .is_ngc = TRUE,
+  .id = 6271,
+  .ra = 254.711,
+  .dec = 27.9651,
+},
+{ .is_ngc = TRUE,
+  .id = 6272,
+  .ra = 254.743,
+  .dec = 27.9307,
+},
+{ .is_ngc = TRUE,
+  .id = 6273,
+  .ra = 255.657,
+  .dec = -26.2677,
+},
+{ .is_ngc = TRUE,
+  .id = 6274,
+  .ra = 254.835,
+  .dec = 29.9462,
+},
+{ .is_ngc = TRUE,
+  .id = 6275,
+  .ra = 253.89,
+  .dec = 63.2425,
+},
+{ .is_ngc = TRUE,
+  .id = 6277,
+  .ra = 255.204,
+  .dec = 23.0392,
+},
+{ .is_ngc = TRUE,
+  .id = 6278,
+  .ra = 255.209,
+  .dec = 23.011,
+},
+{ .is_ngc = TRUE,
+  .id = 6279,
+  .ra = 254.756,
+  .dec = 47.2371,
+},
+{ .is_ngc = TRUE,
+  .id = 6280,
+  .ra = 255.49,
+  .dec = 6.66583,
+},
+{ .is_ngc = TRUE,
+  .id = 6281,
+  .ra = 256.171,
+  .dec = -37.9836,
+},
+{ .is_ngc = TRUE,
+  .id = 6282,
+  .ra = 255.196,
+  .dec = 29.8203,
+},
+{ .is_ngc = TRUE,
+  .id = 6283,
+  .ra = 254.86,
+  .dec = 49.9215,
+},
+{ .is_ngc = TRUE,
+  .id = 6284,
+  .ra = 256.12,
+  .dec = -24.7642,
+},
+{ .is_ngc = TRUE,
+  .id = 6285,
+  .ra = 254.6,
+  .dec = 58.9557,
+},
+{ .is_ngc = TRUE,
+  .id = 6286,
+  .ra = 254.633,
+  .dec = 58.9374,
+},
+{ .is_ngc = TRUE,
+  .id = 6287,
+  .ra = 256.288,
+  .dec = -22.7071,
+},
+{ .is_ngc = TRUE,
+  .id = 6288,
+  .ra = 254.353,
+  .dec = 68.4566,
+},
+{ .is_ngc = TRUE,
+  .id = 6289,
+  .ra = 254.437,
+  .dec = 68.514,
+},
+{ .is_ngc = TRUE,
+  .id = 6290,
+  .ra = 255.235,
+  .dec = 58.9702,
+},
+{ .is_ngc = TRUE,
+  .id = 6291,
+  .ra = 255.232,
+  .dec = 58.9373,
+},
+{ .is_ngc = TRUE,
+  .id = 6292,
+  .ra = 255.766,
+  .dec = 61.0441,
+},
+{ .is_ngc = TRUE,
+  .id = 6293,
+  .ra = 257.543,
+  .dec = -26.5821,
+},
+{ .is_ngc = TRUE,
+  .id = 6294,
+  .ra = 257.567,
+  .dec = -26.5742,
+},
+{ .is_ngc = TRUE,
+  .id = 6295,
+  .ra = 255.814,
+  .dec = 60.3375,
+},
+{ .is_ngc = TRUE,
+  .id = 6296,
+  .ra = 257.186,
+  .dec = 3.894,
+},
+{ .is_ngc = TRUE,
+  .id = 6299,
+  .ra = 256.268,
+  .dec = 62.4578,
+},
+{ .is_ngc = TRUE,
+  .id = 6300,
+  .ra = 259.25,
+  .dec = -62.8207,
+},
+{ .is_ngc = TRUE,
+  .id = 6302,
+  .ra = 258.434,
+  .dec = -37.1032,
+},
+{ .is_ngc = TRUE,
+  .id = 6303,
+  .ra = 256.262,
+  .dec = 68.8276,
+},
+{ .is_ngc = TRUE,
+  .id = 6304,
+  .ra = 258.634,
+  .dec = -29.462,
+},
+{ .is_ngc = TRUE,
+  .id = 6305,
+  .ra = 259.503,
+  .dec = -59.1714,
+},
+{ .is_ngc = TRUE,
+  .id = 6306,
+  .ra = 256.904,
+  .dec = 60.7288,
+},
+{ .is_ngc = TRUE,
+  .id = 6307,
+  .ra = 256.919,
+  .dec = 60.7507,
+},
+{ .is_ngc = TRUE,
+  .id = 6308,
+  .ra = 257.999,
+  .dec = 23.38,
+},
+{ .is_ngc = TRUE,
+  .id = 6309,
+  .ra = 258.518,
+  .dec = -12.9105,
+},
+{ .is_ngc = TRUE,
+  .id = 6310,
+  .ra = 256.99,
+  .dec = 60.9899,
+},
+{ .is_ngc = TRUE,
+  .id = 6311,
+  .ra = 257.682,
+  .dec = 41.6509,
+},
+{ .is_ngc = TRUE,
+  .id = 6312,
+  .ra = 257.7,
+  .dec = 42.2875,
+},
+{ .is_ngc = TRUE,
+  .id = 6313,
+  .ra = 257.587,
+  .dec = 48.3316,
+},
+{ .is_ngc = TRUE,
+  .id = 6314,
+  .ra = 258.162,
+  .dec = 23.2704,
+},
+{ .is_ngc = TRUE,
+  .id = 6315,
+  .ra = 258.192,
+  .dec = 23.2233,
+},
+{ .is_ngc = TRUE,
+  .id = 6316,
+  .ra = 259.155,
+  .dec = -28.1396,
+},
+{ .is_ngc = TRUE,
+  .id = 6317,
+  .ra = 257.248,
+  .dec = 62.8979,
+},
+{ .is_ngc = TRUE,
+  .id = 6318,
+  .ra = 259.046,
+  .dec = -39.4181,
+},
+{ .is_ngc = TRUE,
+  .id = 6319,
+  .ra = 257.434,
+  .dec = 62.9731,
+},
+{ .is_ngc = TRUE,
+  .id = 6320,
+  .ra = 258.232,
+  .dec = 40.2664,
+},
+{ .is_ngc = TRUE,
+  .id = 6321,
+  .ra = 258.601,
+  .dec = 20.3136,
+},
+{ .is_ngc = TRUE,
+  .id = 6322,
+  .ra = 259.604,
+  .dec = -42.9333,
+},
+{ .is_ngc = TRUE,
+  .id = 6323,
+  .ra = 258.325,
+  .dec = 43.7819,
+},
+{ .is_ngc = TRUE,
+  .id = 6324,
+  .ra = 256.355,
+  .dec = 75.4069,
+},
+{ .is_ngc = TRUE,
+  .id = 6325,
+  .ra = 259.496,
+  .dec = -23.766,
+},
+{ .is_ngc = TRUE,
+  .id = 6326,
+  .ra = 260.193,
+  .dec = -51.7548,
+},
+{ .is_ngc = TRUE,
+  .id = 6327,
+  .ra = 258.509,
+  .dec = 43.6486,
+},
+{ .is_ngc = TRUE,
+  .id = 6328,
+  .ra = 260.921,
+  .dec = -65.0102,
+},
+{ .is_ngc = TRUE,
+  .id = 6329,
+  .ra = 258.563,
+  .dec = 43.6844,
+},
+{ .is_ngc = TRUE,
+  .id = 6330,
+  .ra = 258.935,
+  .dec = 29.404,
+},
+{ .is_ngc = TRUE,
+  .id = 6331,
+  .ra = 255.892,
+  .dec = 78.6286,
+},
+{ .is_ngc = TRUE,
+  .id = 6332,
+  .ra = 258.762,
+  .dec = 43.6599,
+},
+{ .is_ngc = TRUE,
+  .id = 6333,
+  .ra = 259.799,
+  .dec = -18.5162,
+},
+{ .is_ngc = TRUE,
+  .id = 6334,
+  .ra = 260.204,
+  .dec = -36.1006,
+},
+{ .is_ngc = TRUE,
+  .id = 6335,
+  .ra = 259.879,
+  .dec = -30.1522,
+},
+{ .is_ngc = TRUE,
+  .id = 6335,
+  .ra = 259.908,
+  .dec = -30.1689,
+},
+{ .is_ngc = TRUE,
+  .id = 6335,
+  .ra = 260.125,
+  .dec = -30.1497,
+},
+{ .is_ngc = TRUE,
+  .id = 6336,
+  .ra = 259.069,
+  .dec = 43.8204,
+},
+{ .is_ngc = TRUE,
+  .id = 6337,
+  .ra = 260.566,
+  .dec = -38.4835,
+},
+{ .is_ngc = TRUE,
+  .id = 6338,
+  .ra = 258.845,
+  .dec = 57.4113,
+},
+{ .is_ngc = TRUE,
+  .id = 6339,
+  .ra = 259.278,
+  .dec = 40.8449,
+},
+{ .is_ngc = TRUE,
+  .id = 6340,
+  .ra = 257.604,
+  .dec = 72.3048,
+},
+{ .is_ngc = TRUE,
+  .id = 6341,
+  .ra = 259.281,
+  .dec = 43.1365,
+},
+{ .is_ngc = TRUE,
+  .id = 6342,
+  .ra = 260.292,
+  .dec = -19.5872,
+},
+{ .is_ngc = TRUE,
+  .id = 6343,
+  .ra = 259.318,
+  .dec = 41.0526,
+},
+{ .is_ngc = TRUE,
+  .id = 6344,
+  .ra = 259.325,
+  .dec = 42.4342,
+},
+{ .is_ngc = TRUE,
+  .id = 6345,
+  .ra = 258.85,
+  .dec = 57.3503,
+},
+{ .is_ngc = TRUE,
+  .id = 6346,
+  .ra = 258.852,
+  .dec = 57.3226,
+},
+{ .is_ngc = TRUE,
+  .id = 6349,
+  .ra = 259.777,
+  .dec = 36.0609,
+},
+{ .is_ngc = TRUE,
+  .id = 6350,
+  .ra = 259.676,
+  .dec = 41.6943,
+},
+{ .is_ngc = TRUE,
+  .id = 6351,
+  .ra = 259.796,
+  .dec = 36.0599,
+},
+{ .is_ngc = TRUE,
+  .id = 6352,
+  .ra = 261.371,
+  .dec = -48.4226,
+},
+{ .is_ngc = TRUE,
+  .id = 6353,
+  .ra = 260.302,
+  .dec = 15.6881,
+},
+{ .is_ngc = TRUE,
+  .id = 6354,
+  .ra = 261.142,
+  .dec = -38.5419,
+},
+{ .is_ngc = TRUE,
+  .id = 6355,
+  .ra = 260.994,
+  .dec = -26.3528,
+},
+{ .is_ngc = TRUE,
+  .id = 6356,
+  .ra = 260.896,
+  .dec = -17.8144,
+},
+{ .is_ngc = TRUE,
+  .id = 6357,
+  .ra = 261.179,
+  .dec = -34.2003,
+},
+{ .is_ngc = TRUE,
+  .id = 6358,
+  .ra = 259.721,
+  .dec = 52.6153,
+},
+{ .is_ngc = TRUE,
+  .id = 6359,
+  .ra = 259.472,
+  .dec = 61.7804,
+},
+{ .is_ngc = TRUE,
+  .id = 6360,
+  .ra = 261.112,
+  .dec = -29.8675,
+},
+{ .is_ngc = TRUE,
+  .id = 6360,
+  .ra = 261.15,
+  .dec = -29.8833,
+},
+{ .is_ngc = TRUE,
+  .id = 6361,
+  .ra = 259.67,
+  .dec = 60.6081,
+},
+{ .is_ngc = TRUE,
+  .id = 6362,
+  .ra = 262.979,
+  .dec = -67.0483,
+},
+{ .is_ngc = TRUE,
+  .id = 6364,
+  .ra = 261.114,
+  .dec = 29.3901,
+},
+{ .is_ngc = TRUE,
+  .id = 6366,
+  .ra = 261.935,
+  .dec = -5.07656,
+},
+{ .is_ngc = TRUE,
+  .id = 6367,
+  .ra = 261.287,
+  .dec = 37.7599,
+},
+{ .is_ngc = TRUE,
+  .id = 6368,
+  .ra = 261.798,
+  .dec = 11.5427,
+},
+{ .is_ngc = TRUE,
+  .id = 6369,
+  .ra = 262.336,
+  .dec = -23.7595,
+},
+{ .is_ngc = TRUE,
+  .id = 6370,
+  .ra = 260.855,
+  .dec = 56.9748,
+},
+{ .is_ngc = TRUE,
+  .id = 6371,
+  .ra = 261.836,
+  .dec = 26.5049,
+},
+{ .is_ngc = TRUE,
+  .id = 6372,
+  .ra = 261.883,
+  .dec = 26.4746,
+},
+{ .is_ngc = TRUE,
+  .id = 6373,
+  .ra = 261.034,
+  .dec = 58.9952,
+},
+{ .is_ngc = TRUE,
+  .id = 6375,
+  .ra = 262.341,
+  .dec = 16.2066,
+},
+{ .is_ngc = TRUE,
+  .id = 6376,
+  .ra = 261.33,
+  .dec = 58.8169,
+},
+{ .is_ngc = TRUE,
+  .id = 6377,
+  .ra = 261.346,
+  .dec = 58.8224,
+},
+{ .is_ngc = TRUE,
+  .id = 6378,
+  .ra = 262.675,
+  .dec = 6.28175,
+},
+{ .is_ngc = TRUE,
+  .id = 6379,
+  .ra = 262.646,
+  .dec = 16.2884,
+},
+{ .is_ngc = TRUE,
+  .id = 6380,
+  .ra = 263.618,
+  .dec = -39.0694,
+},
+{ .is_ngc = TRUE,
+  .id = 6381,
+  .ra = 261.821,
+  .dec = 60.014,
+},
+{ .is_ngc = TRUE,
+  .id = 6382,
+  .ra = 261.98,
+  .dec = 56.8684,
+},
+{ .is_ngc = TRUE,
+  .id = 6384,
+  .ra = 263.101,
+  .dec = 7.06036,
+},
+{ .is_ngc = TRUE,
+  .id = 6385,
+  .ra = 262.007,
+  .dec = 57.5217,
+},
+{ .is_ngc = TRUE,
+  .id = 6386,
+  .ra = 262.216,
+  .dec = 52.7233,
+},
+{ .is_ngc = TRUE,
+  .id = 6387,
+  .ra = 262.102,
+  .dec = 57.5439,
+},
+{ .is_ngc = TRUE,
+  .id = 6388,
+  .ra = 264.072,
+  .dec = -44.7355,
+},
+{ .is_ngc = TRUE,
+  .id = 6389,
+  .ra = 263.166,
+  .dec = 16.4021,
+},
+{ .is_ngc = TRUE,
+  .id = 6390,
+  .ra = 262.117,
+  .dec = 60.0943,
+},
+{ .is_ngc = TRUE,
+  .id = 6391,
+  .ra = 262.204,
+  .dec = 58.8507,
+},
+{ .is_ngc = TRUE,
+  .id = 6392,
+  .ra = 265.877,
+  .dec = -69.7847,
+},
+{ .is_ngc = TRUE,
+  .id = 6393,
+  .ra = 262.535,
+  .dec = 59.5318,
+},
+{ .is_ngc = TRUE,
+  .id = 6394,
+  .ra = 262.589,
+  .dec = 59.6399,
+},
+{ .is_ngc = TRUE,
+  .id = 6395,
+  .ra = 261.631,
+  .dec = 71.0963,
+},
+{ .is_ngc = TRUE,
+  .id = 6396,
+  .ra = 264.4,
+  .dec = -35.0183,
+},
+{ .is_ngc = TRUE,
+  .id = 6397,
+  .ra = 265.174,
+  .dec = -53.674,
+},
+{ .is_ngc = TRUE,
+  .id = 6398,
+  .ra = 265.682,
+  .dec = -61.6931,
+},
+{ .is_ngc = TRUE,
+  .id = 6399,
+  .ra = 262.96,
+  .dec = 59.6152,
+},
+{ .is_ngc = TRUE,
+  .id = 6400,
+  .ra = 265.05,
+  .dec = -36.9358,
+},
+{ .is_ngc = TRUE,
+  .id = 6401,
+  .ra = 264.652,
+  .dec = -23.9091,
+},
+{ .is_ngc = TRUE,
+  .id = 6402,
+  .ra = 264.4,
+  .dec = -3.24525,
+},
+{ .is_ngc = TRUE,
+  .id = 6403,
+  .ra = 265.848,
+  .dec = -61.6817,
+},
+{ .is_ngc = TRUE,
+  .id = 6404,
+  .ra = 264.904,
+  .dec = -33.2356,
+},
+{ .is_ngc = TRUE,
+  .id = 6405,
+  .ra = 265.083,
+  .dec = -32.2506,
+},
+{ .is_ngc = TRUE,
+  .id = 6406,
+  .ra = 264.58,
+  .dec = 18.8326,
+},
+{ .is_ngc = TRUE,
+  .id = 6407,
+  .ra = 266.24,
+  .dec = -60.7397,
+},
+{ .is_ngc = TRUE,
+  .id = 6408,
+  .ra = 264.697,
+  .dec = 18.878,
+},
+{ .is_ngc = TRUE,
+  .id = 6409,
+  .ra = 264.147,
+  .dec = 50.7658,
+},
+{ .is_ngc = TRUE,
+  .id = 6410,
+  .ra = 263.835,
+  .dec = 60.7922,
+},
+{ .is_ngc = TRUE,
+  .id = 6411,
+  .ra = 263.887,
+  .dec = 60.8133,
+},
+{ .is_ngc = TRUE,
+  .id = 6412,
+  .ra = 262.403,
+  .dec = 75.7039,
+},
+{ .is_ngc = TRUE,
+  .id = 6413,
+  .ra = 265.17,
+  .dec = 12.6236,
+},
+{ .is_ngc = TRUE,
+  .id = 6414,
+  .ra = 262.654,
+  .dec = 74.3759,
+},
+{ .is_ngc = TRUE,
+  .id = 6415,
+  .ra = 266.012,
+  .dec = -35.0667,
+},
+{ .is_ngc = TRUE,
+  .id = 6416,
+  .ra = 266.079,
+  .dec = -32.3519,
+},
+{ .is_ngc = TRUE,
+  .id = 6417,
+  .ra = 265.449,
+  .dec = 23.6717,
+},
+{ .is_ngc = TRUE,
+  .id = 6418,
+  .ra = 264.539,
+  .dec = 58.7147,
+},
+{ .is_ngc = TRUE,
+  .id = 6419,
+  .ra = 264.024,
+  .dec = 68.1555,
+},
+{ .is_ngc = TRUE,
+  .id = 6420,
+  .ra = 264.067,
+  .dec = 68.0522,
+},
+{ .is_ngc = TRUE,
+  .id = 6421,
+  .ra = 266.433,
+  .dec = -33.685,
+},
+{ .is_ngc = TRUE,
+  .id = 6422,
+  .ra = 264.125,
+  .dec = 68.0584,
+},
+{ .is_ngc = TRUE,
+  .id = 6423,
+  .ra = 264.222,
+  .dec = 68.1713,
+},
+{ .is_ngc = TRUE,
+  .id = 6424,
+  .ra = 264.051,
+  .dec = 69.9892,
+},
+{ .is_ngc = TRUE,
+  .id = 6425,
+  .ra = 266.754,
+  .dec = -31.5189,
+},
+{ .is_ngc = TRUE,
+  .id = 6426,
+  .ra = 266.228,
+  .dec = 3.16975,
+},
+{ .is_ngc = TRUE,
+  .id = 6428,
+  .ra = 265.97,
+  .dec = 25.5565,
+},
+{ .is_ngc = TRUE,
+  .id = 6429,
+  .ra = 266.022,
+  .dec = 25.3502,
+},
+{ .is_ngc = TRUE,
+  .id = 6430,
+  .ra = 266.31,
+  .dec = 18.1387,
+},
+{ .is_ngc = TRUE,
+  .id = 6432,
+  .ra = 266.844,
+  .dec = -24.8875,
+},
+{ .is_ngc = TRUE,
+  .id = 6433,
+  .ra = 265.984,
+  .dec = 36.7997,
+},
+{ .is_ngc = TRUE,
+  .id = 6434,
+  .ra = 264.203,
+  .dec = 72.0888,
+},
+{ .is_ngc = TRUE,
+  .id = 6435,
+  .ra = 265.046,
+  .dec = 62.6417,
+},
+{ .is_ngc = TRUE,
+  .id = 6436,
+  .ra = 265.305,
+  .dec = 60.4496,
+},
+{ .is_ngc = TRUE,
+  .id = 6437,
+  .ra = 267.017,
+  .dec = -35.35,
+},
+{ .is_ngc = TRUE,
+  .id = 6438,
+  .ra = 275.569,
+  .dec = -85.4018,
+},
+{ .is_ngc = TRUE,
+  .id = 6439,
+  .ra = 267.083,
+  .dec = -16.479,
+},
+{ .is_ngc = TRUE,
+  .id = 6440,
+  .ra = 267.219,
+  .dec = -20.3608,
+},
+{ .is_ngc = TRUE,
+  .id = 6441,
+  .ra = 267.554,
+  .dec = -37.0509,
+},
+{ .is_ngc = TRUE,
+  .id = 6442,
+  .ra = 266.714,
+  .dec = 20.7606,
+},
+{ .is_ngc = TRUE,
+  .id = 6443,
+  .ra = 266.14,
+  .dec = 48.1142,
+},
+{ .is_ngc = TRUE,
+  .id = 6444,
+  .ra = 267.396,
+  .dec = -34.8172,
+},
+{ .is_ngc = TRUE,
+  .id = 6445,
+  .ra = 267.313,
+  .dec = -20.0101,
+},
+{ .is_ngc = TRUE,
+  .id = 6446,
+  .ra = 266.531,
+  .dec = 35.5692,
+},
+{ .is_ngc = TRUE,
+  .id = 6447,
+  .ra = 266.572,
+  .dec = 35.5718,
+},
+{ .is_ngc = TRUE,
+  .id = 6448,
+  .ra = 266.083,
+  .dec = 53.5344,
+},
+{ .is_ngc = TRUE,
+  .id = 6449,
+  .ra = 265.943,
+  .dec = 56.8038,
+},
+{ .is_ngc = TRUE,
+  .id = 6450,
+  .ra = 266.883,
+  .dec = 18.5681,
+},
+{ .is_ngc = TRUE,
+  .id = 6451,
+  .ra = 267.671,
+  .dec = -30.2017,
+},
+{ .is_ngc = TRUE,
+  .id = 6452,
+  .ra = 266.994,
+  .dec = 20.8372,
+},
+{ .is_ngc = TRUE,
+  .id = 6453,
+  .ra = 267.716,
+  .dec = -34.5984,
+},
+{ .is_ngc = TRUE,
+  .id = 6454,
+  .ra = 266.236,
+  .dec = 55.7044,
+},
+{ .is_ngc = TRUE,
+  .id = 6455,
+  .ra = 267.783,
+  .dec = -35.3342,
+},
+{ .is_ngc = TRUE,
+  .id = 6456,
+  .ra = 265.632,
+  .dec = 67.5922,
+},
+{ .is_ngc = TRUE,
+  .id = 6457,
+  .ra = 265.72,
+  .dec = 66.4759,
+},
+{ .is_ngc = TRUE,
+  .id = 6458,
+  .ra = 267.296,
+  .dec = 20.8039,
+},
+{ .is_ngc = TRUE,
+  .id = 6459,
+  .ra = 266.446,
+  .dec = 55.7767,
+},
+{ .is_ngc = TRUE,
+  .id = 6460,
+  .ra = 267.377,
+  .dec = 20.7634,
+},
+{ .is_ngc = TRUE,
+  .id = 6461,
+  .ra = 264.986,
+  .dec = 74.0344,
+},
+{ .is_ngc = TRUE,
+  .id = 6462,
+  .ra = 266.203,
+  .dec = 61.9103,
+},
+{ .is_ngc = TRUE,
+  .id = 6463,
+  .ra = 265.893,
+  .dec = 67.6033,
+},
+{ .is_ngc = TRUE,
+  .id = 6464,
+  .ra = 266.448,
+  .dec = 60.8964,
+},
+{ .is_ngc = TRUE,
+  .id = 6465,
+  .ra = 268.231,
+  .dec = -25.3981,
+},
+{ .is_ngc = TRUE,
+  .id = 6466,
+  .ra = 267.034,
+  .dec = 51.399,
+},
+{ .is_ngc = TRUE,
+  .id = 6467,
+  .ra = 267.658,
+  .dec = 17.5344,
+},
+{ .is_ngc = TRUE,
+  .id = 6468,
+  .ra = 267.663,
+  .dec = 17.5344,
+},
+{ .is_ngc = TRUE,
+  .id = 6469,
+  .ra = 268.3,
+  .dec = -22.2681,
+},
+{ .is_ngc = TRUE,
+  .id = 6470,
+  .ra = 266.062,
+  .dec = 67.6191,
+},
+{ .is_ngc = TRUE,
+  .id = 6472,
+  .ra = 266.013,
+  .dec = 67.6302,
+},
+{ .is_ngc = TRUE,
+  .id = 6473,
+  .ra = 266.725,
+  .dec = 57.3014,
+},
+{ .is_ngc = TRUE,
+  .id = 6473,
+  .ra = 266.743,
+  .dec = 57.2399,
+},
+{ .is_ngc = TRUE,
+  .id = 6474,
+  .ra = 266.773,
+  .dec = 57.3014,
+},
+{ .is_ngc = TRUE,
+  .id = 6475,
+  .ra = 268.463,
+  .dec = -34.785,
+},
+{ .is_ngc = TRUE,
+  .id = 6476,
+  .ra = 268.508,
+  .dec = -29.1353,
+},
+{ .is_ngc = TRUE,
+  .id = 6477,
+  .ra = 266.126,
+  .dec = 67.6103,
+},
+{ .is_ngc = TRUE,
+  .id = 6478,
+  .ra = 267.159,
+  .dec = 51.1567,
+},
+{ .is_ngc = TRUE,
+  .id = 6479,
+  .ra = 267.09,
+  .dec = 54.1491,
+},
+{ .is_ngc = TRUE,
+  .id = 6480,
+  .ra = 268.608,
+  .dec = -30.4503,
+},
+{ .is_ngc = TRUE,
+  .id = 6481,
+  .ra = 268.204,
+  .dec = 4.16694,
+},
+{ .is_ngc = TRUE,
+  .id = 6482,
+  .ra = 267.954,
+  .dec = 23.0719,
+},
+{ .is_ngc = TRUE,
+  .id = 6483,
+  .ra = 269.878,
+  .dec = -63.669,
+},
+{ .is_ngc = TRUE,
+  .id = 6484,
+  .ra = 267.945,
+  .dec = 24.4832,
+},
+{ .is_ngc = TRUE,
+  .id = 6485,
+  .ra = 267.97,
+  .dec = 31.462,
+},
+{ .is_ngc = TRUE,
+  .id = 6486,
+  .ra = 268.147,
+  .dec = 29.8179,
+},
+{ .is_ngc = TRUE,
+  .id = 6487,
+  .ra = 268.175,
+  .dec = 29.8384,
+},
+{ .is_ngc = TRUE,
+  .id = 6488,
+  .ra = 267.337,
+  .dec = 62.2229,
+},
+{ .is_ngc = TRUE,
+  .id = 6489,
+  .ra = 267.506,
+  .dec = 60.0922,
+},
+{ .is_ngc = TRUE,
+  .id = 6490,
+  .ra = 268.627,
+  .dec = 18.3756,
+},
+{ .is_ngc = TRUE,
+  .id = 6491,
+  .ra = 267.503,
+  .dec = 61.5317,
+},
+{ .is_ngc = TRUE,
+  .id = 6492,
+  .ra = 270.7,
+  .dec = -66.4303,
+},
+{ .is_ngc = TRUE,
+  .id = 6493,
+  .ra = 267.594,
+  .dec = 61.559,
+},
+{ .is_ngc = TRUE,
+  .id = 6494,
+  .ra = 269.267,
+  .dec = -18.9836,
+},
+{ .is_ngc = TRUE,
+  .id = 6495,
+  .ra = 268.711,
+  .dec = 18.3269,
+},
+{ .is_ngc = TRUE,
+  .id = 6496,
+  .ra = 269.765,
+  .dec = -44.2668,
+},
+{ .is_ngc = TRUE,
+  .id = 6499,
+  .ra = 268.833,
+  .dec = 18.3593,
+},
+{ .is_ngc = TRUE,
+  .id = 6500,
+  .ra = 268.999,
+  .dec = 18.3384,
+},
+{ .is_ngc = TRUE,
+  .id = 6501,
+  .ra = 269.016,
+  .dec = 18.3733,
+},
+{ .is_ngc = TRUE,
+  .id = 6502,
+  .ra = 271.056,
+  .dec = -65.4097,
+},
+{ .is_ngc = TRUE,
+  .id = 6503,
+  .ra = 267.362,
+  .dec = 70.1445,
+},
+{ .is_ngc = TRUE,
+  .id = 6504,
+  .ra = 269.024,
+  .dec = 33.2088,
+},
+{ .is_ngc = TRUE,
+  .id = 6505,
+  .ra = 267.781,
+  .dec = 65.5306,
+},
+{ .is_ngc = TRUE,
+  .id = 6506,
+  .ra = 269.971,
+  .dec = -24.6833,
+},
+{ .is_ngc = TRUE,
+  .id = 6507,
+  .ra = 269.958,
+  .dec = -17.45,
+},
+{ .is_ngc = TRUE,
+  .id = 6508,
+  .ra = 267.445,
+  .dec = 72.0214,
+},
+{ .is_ngc = TRUE,
+  .id = 6509,
+  .ra = 269.855,
+  .dec = 6.28661,
+},
+{ .is_ngc = TRUE,
+  .id = 6512,
+  .ra = 268.71,
+  .dec = 62.6446,
+},
+{ .is_ngc = TRUE,
+  .id = 6513,
+  .ra = 269.893,
+  .dec = 24.887,
+},
+{ .is_ngc = TRUE,
+  .id = 6514,
+  .ra = 270.675,
+  .dec = -22.9675,
+},
+{ .is_ngc = TRUE,
+  .id = 6515,
+  .ra = 269.355,
+  .dec = 50.7276,
+},
+{ .is_ngc = TRUE,
+  .id = 6516,
+  .ra = 268.819,
+  .dec = 62.6686,
+},
+{ .is_ngc = TRUE,
+  .id = 6517,
+  .ra = 270.461,
+  .dec = -8.95881,
+},
+{ .is_ngc = TRUE,
+  .id = 6518,
+  .ra = 269.932,
+  .dec = 28.8666,
+},
+{ .is_ngc = TRUE,
+  .id = 6519,
+  .ra = 270.834,
+  .dec = -29.8042,
+},
+{ .is_ngc = TRUE,
+  .id = 6520,
+  .ra = 270.85,
+  .dec = -27.8842,
+},
+{ .is_ngc = TRUE,
+  .id = 6521,
+  .ra = 268.951,
+  .dec = 62.6117,
+},
+{ .is_ngc = TRUE,
+  .id = 6523,
+  .ra = 270.922,
+  .dec = -24.38,
+},
+{ .is_ngc = TRUE,
+  .id = 6524,
+  .ra = 269.812,
+  .dec = 45.8874,
+},
+{ .is_ngc = TRUE,
+  .id = 6525,
+  .ra = 270.525,
+  .dec = 11.0247,
+},
+{ .is_ngc = TRUE,
+  .id = 6526,
+  .ra = 271.025,
+  .dec = -24.4347,
+},
+{ .is_ngc = TRUE,
+  .id = 6527,
+  .ra = 270.443,
+  .dec = 19.7286,
+},
+{ .is_ngc = TRUE,
+  .id = 6528,
+  .ra = 271.206,
+  .dec = -30.0559,
+},
+{ .is_ngc = TRUE,
+  .id = 6529,
+  .ra = 271.371,
+  .dec = -36.2856,
+},
+{ .is_ngc = TRUE,
+  .id = 6530,
+  .ra = 271.129,
+  .dec = -24.3514,
+},
+{ .is_ngc = TRUE,
+  .id = 6531,
+  .ra = 271.054,
+  .dec = -22.4844,
+},
+{ .is_ngc = TRUE,
+  .id = 6532,
+  .ra = 269.808,
+  .dec = 56.2314,
+},
+{ .is_ngc = TRUE,
+  .id = 6533,
+  .ra = 271.004,
+  .dec = -24.3833,
+},
+{ .is_ngc = TRUE,
+  .id = 6534,
+  .ra = 269.325,
+  .dec = 64.3006,
+},
+{ .is_ngc = TRUE,
+  .id = 6534,
+  .ra = 269.037,
+  .dec = 64.2814,
+},
+{ .is_ngc = TRUE,
+  .id = 6535,
+  .ra = 270.961,
+  .dec = -0.297611,
+},
+{ .is_ngc = TRUE,
+  .id = 6536,
+  .ra = 269.319,
+  .dec = 64.9377,
+},
+{ .is_ngc = TRUE,
+  .id = 6537,
+  .ra = 271.304,
+  .dec = -19.8429,
+},
+{ .is_ngc = TRUE,
+  .id = 6538,
+  .ra = 268.57,
+  .dec = 73.4238,
+},
+{ .is_ngc = TRUE,
+  .id = 6539,
+  .ra = 271.207,
+  .dec = -7.5865,
+},
+{ .is_ngc = TRUE,
+  .id = 6540,
+  .ra = 271.535,
+  .dec = -27.7639,
+},
+{ .is_ngc = TRUE,
+  .id = 6541,
+  .ra = 272.008,
+  .dec = -43.7158,
+},
+{ .is_ngc = TRUE,
+  .id = 6542,
+  .ra = 269.912,
+  .dec = 61.3591,
+},
+{ .is_ngc = TRUE,
+  .id = 6543,
+  .ra = 269.639,
+  .dec = 66.6331,
+},
+{ .is_ngc = TRUE,
+  .id = 6544,
+  .ra = 271.833,
+  .dec = -24.9982,
+},
+{ .is_ngc = TRUE,
+  .id = 6545,
+  .ra = 273.063,
+  .dec = -63.7761,
+},
+{ .is_ngc = TRUE,
+  .id = 6546,
+  .ra = 271.842,
+  .dec = -23.2856,
+},
+{ .is_ngc = TRUE,
+  .id = 6547,
+  .ra = 271.292,
+  .dec = 25.2325,
+},
+{ .is_ngc = TRUE,
+  .id = 6548,
+  .ra = 271.497,
+  .dec = 18.587,
+},
+{ .is_ngc = TRUE,
+  .id = 6551,
+  .ra = 272.25,
+  .dec = -29.55,
+},
+{ .is_ngc = TRUE,
+  .id = 6552,
+  .ra = 270.03,
+  .dec = 66.6149,
+},
+{ .is_ngc = TRUE,
+  .id = 6553,
+  .ra = 272.322,
+  .dec = -25.9084,
+},
+{ .is_ngc = TRUE,
+  .id = 6554,
+  .ra = 272.346,
+  .dec = -18.3686,
+},
+{ .is_ngc = TRUE,
+  .id = 6554,
+  .ra = 272.246,
+  .dec = -18.4336,
+},
+{ .is_ngc = TRUE,
+  .id = 6555,
+  .ra = 271.955,
+  .dec = 17.6047,
+},
+{ .is_ngc = TRUE,
+  .id = 6556,
+  .ra = 272.487,
+  .dec = -27.5181,
+},
+{ .is_ngc = TRUE,
+  .id = 6557,
+  .ra = 275.355,
+  .dec = -76.5831,
+},
+{ .is_ngc = TRUE,
+  .id = 6558,
+  .ra = 272.576,
+  .dec = -31.7631,
+},
+{ .is_ngc = TRUE,
+  .id = 6560,
+  .ra = 271.308,
+  .dec = 46.8813,
+},
+{ .is_ngc = TRUE,
+  .id = 6561,
+  .ra = 272.625,
+  .dec = -16.7181,
+},
+{ .is_ngc = TRUE,
+  .id = 6561,
+  .ra = 272.625,
+  .dec = -16.7997,
+},
+{ .is_ngc = TRUE,
+  .id = 6562,
+  .ra = 271.253,
+  .dec = 56.2628,
+},
+{ .is_ngc = TRUE,
+  .id = 6563,
+  .ra = 273.011,
+  .dec = -33.8687,
+},
+{ .is_ngc = TRUE,
+  .id = 6564,
+  .ra = 272.26,
+  .dec = 17.3944,
+},
+{ .is_ngc = TRUE,
+  .id = 6565,
+  .ra = 272.969,
+  .dec = -28.178,
+},
+{ .is_ngc = TRUE,
+  .id = 6566,
+  .ra = 271.753,
+  .dec = 52.2601,
+},
+{ .is_ngc = TRUE,
+  .id = 6567,
+  .ra = 273.438,
+  .dec = -19.0762,
+},
+{ .is_ngc = TRUE,
+  .id = 6568,
+  .ra = 273.183,
+  .dec = -21.6008,
+},
+{ .is_ngc = TRUE,
+  .id = 6569,
+  .ra = 273.412,
+  .dec = -31.8265,
+},
+{ .is_ngc = TRUE,
+  .id = 6570,
+  .ra = 272.781,
+  .dec = 14.0926,
+},
+{ .is_ngc = TRUE,
+  .id = 6571,
+  .ra = 272.706,
+  .dec = 21.2387,
+},
+{ .is_ngc = TRUE,
+  .id = 6572,
+  .ra = 273.026,
+  .dec = 6.85359,
+},
+{ .is_ngc = TRUE,
+  .id = 6573,
+  .ra = 273.454,
+  .dec = -22.1358,
+},
+{ .is_ngc = TRUE,
+  .id = 6575,
+  .ra = 272.739,
+  .dec = 31.1163,
+},
+{ .is_ngc = TRUE,
+  .id = 6576,
+  .ra = 272.95,
+  .dec = 21.4284,
+},
+{ .is_ngc = TRUE,
+  .id = 6577,
+  .ra = 273.005,
+  .dec = 21.4637,
+},
+{ .is_ngc = TRUE,
+  .id = 6578,
+  .ra = 274.069,
+  .dec = -20.4507,
+},
+{ .is_ngc = TRUE,
+  .id = 6579,
+  .ra = 273.133,
+  .dec = 21.4207,
+},
+{ .is_ngc = TRUE,
+  .id = 6580,
+  .ra = 273.14,
+  .dec = 21.426,
+},
+{ .is_ngc = TRUE,
+  .id = 6583,
+  .ra = 273.954,
+  .dec = -22.1339,
+},
+{ .is_ngc = TRUE,
+  .id = 6584,
+  .ra = 274.657,
+  .dec = -52.2158,
+},
+{ .is_ngc = TRUE,
+  .id = 6585,
+  .ra = 273.091,
+  .dec = 39.6328,
+},
+{ .is_ngc = TRUE,
+  .id = 6586,
+  .ra = 273.41,
+  .dec = 21.0904,
+},
+{ .is_ngc = TRUE,
+  .id = 6587,
+  .ra = 273.462,
+  .dec = 18.8256,
+},
+{ .is_ngc = TRUE,
+  .id = 6588,
+  .ra = 275.363,
+  .dec = -63.8011,
+},
+{ .is_ngc = TRUE,
+  .id = 6588,
+  .ra = 275.245,
+  .dec = -63.8097,
+},
+{ .is_ngc = TRUE,
+  .id = 6588,
+  .ra = 275.314,
+  .dec = -63.8047,
+},
+{ .is_ngc = TRUE,
+  .id = 6591,
+  .ra = 273.515,
+  .dec = 21.0631,
+},
+{ .is_ngc = TRUE,
+  .id = 6591,
+  .ra = 273.552,
+  .dec = 21.0688,
+},
+{ .is_ngc = TRUE,
+  .id = 6592,
+  .ra = 272.462,
+  .dec = 61.4219,
+},
+{ .is_ngc = TRUE,
+  .id = 6593,
+  .ra = 273.515,
+  .dec = 22.2838,
+},
+{ .is_ngc = TRUE,
+  .id = 6594,
+  .ra = 272.523,
+  .dec = 61.1336,
+},
+{ .is_ngc = TRUE,
+  .id = 6596,
+  .ra = 274.387,
+  .dec = -16.65,
+},
+{ .is_ngc = TRUE,
+  .id = 6597,
+  .ra = 272.806,
+  .dec = 61.1807,
+},
+{ .is_ngc = TRUE,
+  .id = 6598,
+  .ra = 272.232,
+  .dec = 69.0682,
+},
+{ .is_ngc = TRUE,
+  .id = 6601,
+  .ra = 272.934,
+  .dec = 61.4528,
+},
+{ .is_ngc = TRUE,
+  .id = 6602,
+  .ra = 274.143,
+  .dec = 25.0438,
+},
+{ .is_ngc = TRUE,
+  .id = 6603,
+  .ra = 274.608,
+  .dec = -18.4011,
+},
+{ .is_ngc = TRUE,
+  .id = 6604,
+  .ra = 274.512,
+  .dec = -12.2431,
+},
+{ .is_ngc = TRUE,
+  .id = 6605,
+  .ra = 274.017,
+  .dec = -15,
+},
+{ .is_ngc = TRUE,
+  .id = 6606,
+  .ra = 273.673,
+  .dec = 43.2686,
+},
+{ .is_ngc = TRUE,
+  .id = 6607,
+  .ra = 273.063,
+  .dec = 61.3329,
+},
+{ .is_ngc = TRUE,
+  .id = 6608,
+  .ra = 273.122,
+  .dec = 61.2981,
+},
+{ .is_ngc = TRUE,
+  .id = 6609,
+  .ra = 273.14,
+  .dec = 61.3318,
+},
+{ .is_ngc = TRUE,
+  .id = 6611,
+  .ra = 274.7,
+  .dec = -13.8011,
+},
+{ .is_ngc = TRUE,
+  .id = 6612,
+  .ra = 274.046,
+  .dec = 36.0786,
+},
+{ .is_ngc = TRUE,
+  .id = 6613,
+  .ra = 274.994,
+  .dec = -17.1019,
+},
+{ .is_ngc = TRUE,
+  .id = 6614,
+  .ra = 276.281,
+  .dec = -63.2481,
+},
+{ .is_ngc = TRUE,
+  .id = 6615,
+  .ra = 274.639,
+  .dec = 13.2648,
+},
+{ .is_ngc = TRUE,
+  .id = 6616,
+  .ra = 274.421,
+  .dec = 22.2379,
+},
+{ .is_ngc = TRUE,
+  .id = 6617,
+  .ra = 273.511,
+  .dec = 61.3194,
+},
+{ .is_ngc = TRUE,
+  .id = 6618,
+  .ra = 275.196,
+  .dec = -16.1675,
+},
+{ .is_ngc = TRUE,
+  .id = 6619,
+  .ra = 274.731,
+  .dec = 23.6556,
+},
+{ .is_ngc = TRUE,
+  .id = 6620,
+  .ra = 275.726,
+  .dec = -26.8214,
+},
+{ .is_ngc = TRUE,
+  .id = 6621,
+  .ra = 273.249,
+  .dec = 68.3533,
+},
+{ .is_ngc = TRUE,
+  .id = 6622,
+  .ra = 273.231,
+  .dec = 68.3633,
+},
+{ .is_ngc = TRUE,
+  .id = 6623,
+  .ra = 274.929,
+  .dec = 23.7093,
+},
+{ .is_ngc = TRUE,
+  .id = 6624,
+  .ra = 275.919,
+  .dec = -30.3611,
+},
+{ .is_ngc = TRUE,
+  .id = 6625,
+  .ra = 275.754,
+  .dec = -12.0178,
+},
+{ .is_ngc = TRUE,
+  .id = 6625,
+  .ra = 275.704,
+  .dec = -11.9519,
+},
+{ .is_ngc = TRUE,
+  .id = 6626,
+  .ra = 276.136,
+  .dec = -24.8685,
+},
+{ .is_ngc = TRUE,
+  .id = 6627,
+  .ra = 275.662,
+  .dec = 15.6982,
+},
+{ .is_ngc = TRUE,
+  .id = 6628,
+  .ra = 275.591,
+  .dec = 23.4776,
+},
+{ .is_ngc = TRUE,
+  .id = 6629,
+  .ra = 276.427,
+  .dec = -23.2027,
+},
+{ .is_ngc = TRUE,
+  .id = 6630,
+  .ra = 278.144,
+  .dec = -63.2919,
+},
+{ .is_ngc = TRUE,
+  .id = 6631,
+  .ra = 276.797,
+  .dec = -12.0311,
+},
+{ .is_ngc = TRUE,
+  .id = 6632,
+  .ra = 276.263,
+  .dec = 27.535,
+},
+{ .is_ngc = TRUE,
+  .id = 6633,
+  .ra = 276.812,
+  .dec = 6.50139,
+},
+{ .is_ngc = TRUE,
+  .id = 6634,
+  .ra = 277.488,
+  .dec = -33.5022,
+},
+{ .is_ngc = TRUE,
+  .id = 6635,
+  .ra = 276.904,
+  .dec = 14.8185,
+},
+{ .is_ngc = TRUE,
+  .id = 6638,
+  .ra = 277.735,
+  .dec = -25.4988,
+},
+{ .is_ngc = TRUE,
+  .id = 6639,
+  .ra = 277.746,
+  .dec = -13.1508,
+},
+{ .is_ngc = TRUE,
+  .id = 6640,
+  .ra = 277.034,
+  .dec = 34.3026,
+},
+{ .is_ngc = TRUE,
+  .id = 6641,
+  .ra = 277.239,
+  .dec = 22.9026,
+},
+{ .is_ngc = TRUE,
+  .id = 6642,
+  .ra = 277.975,
+  .dec = -23.4763,
+},
+{ .is_ngc = TRUE,
+  .id = 6643,
+  .ra = 274.944,
+  .dec = 74.569,
+},
+{ .is_ngc = TRUE,
+  .id = 6644,
+  .ra = 278.145,
+  .dec = -25.1289,
+},
+{ .is_ngc = TRUE,
+  .id = 6645,
+  .ra = 278.154,
+  .dec = -16.8833,
+},
+{ .is_ngc = TRUE,
+  .id = 6646,
+  .ra = 277.412,
+  .dec = 39.8648,
+},
+{ .is_ngc = TRUE,
+  .id = 6647,
+  .ra = 278.204,
+  .dec = -17.2186,
+},
+{ .is_ngc = TRUE,
+  .id = 6648,
+  .ra = 276.407,
+  .dec = 64.9756,
+},
+{ .is_ngc = TRUE,
+  .id = 6649,
+  .ra = 278.363,
+  .dec = -10.4006,
+},
+{ .is_ngc = TRUE,
+  .id = 6650,
+  .ra = 276.367,
+  .dec = 68.0059,
+},
+{ .is_ngc = TRUE,
+  .id = 6651,
+  .ra = 276.082,
+  .dec = 71.6019,
+},
+{ .is_ngc = TRUE,
+  .id = 6652,
+  .ra = 278.941,
+  .dec = -32.9912,
+},
+{ .is_ngc = TRUE,
+  .id = 6653,
+  .ra = 281.161,
+  .dec = -73.2631,
+},
+{ .is_ngc = TRUE,
+  .id = 6654,
+  .ra = 276.033,
+  .dec = 73.1828,
+},
+{ .is_ngc = TRUE,
+  .id = 6655,
+  .ra = 278.629,
+  .dec = -5.92086,
+},
+{ .is_ngc = TRUE,
+  .id = 6656,
+  .ra = 279.101,
+  .dec = -23.9048,
+},
+{ .is_ngc = TRUE,
+  .id = 6657,
+  .ra = 278.257,
+  .dec = 34.0608,
+},
+{ .is_ngc = TRUE,
+  .id = 6658,
+  .ra = 278.482,
+  .dec = 22.8879,
+},
+{ .is_ngc = TRUE,
+  .id = 6659,
+  .ra = 278.496,
+  .dec = 23.5853,
+},
+{ .is_ngc = TRUE,
+  .id = 6662,
+  .ra = 278.547,
+  .dec = 32.0642,
+},
+{ .is_ngc = TRUE,
+  .id = 6663,
+  .ra = 278.39,
+  .dec = 40.0488,
+},
+{ .is_ngc = TRUE,
+  .id = 6664,
+  .ra = 279.137,
+  .dec = -8.21722,
+},
+{ .is_ngc = TRUE,
+  .id = 6665,
+  .ra = 278.625,
+  .dec = 30.72,
+},
+{ .is_ngc = TRUE,
+  .id = 6666,
+  .ra = 278.683,
+  .dec = 33.5842,
+},
+{ .is_ngc = TRUE,
+  .id = 6669,
+  .ra = 279.313,
+  .dec = 22.1956,
+},
+{ .is_ngc = TRUE,
+  .id = 6671,
+  .ra = 279.359,
+  .dec = 26.4174,
+},
+{ .is_ngc = TRUE,
+  .id = 6672,
+  .ra = 279.06,
+  .dec = 42.9464,
+},
+{ .is_ngc = TRUE,
+  .id = 6673,
+  .ra = 281.278,
+  .dec = -62.2969,
+},
+{ .is_ngc = TRUE,
+  .id = 6674,
+  .ra = 279.641,
+  .dec = 25.3749,
+},
+{ .is_ngc = TRUE,
+  .id = 6675,
+  .ra = 279.36,
+  .dec = 40.0575,
+},
+{ .is_ngc = TRUE,
+  .id = 6676,
+  .ra = 278.291,
+  .dec = 66.9589,
+},
+{ .is_ngc = TRUE,
+  .id = 6677,
+  .ra = 278.401,
+  .dec = 67.1102,
+},
+{ .is_ngc = TRUE,
+  .id = 6681,
+  .ra = 280.802,
+  .dec = -32.2908,
+},
+{ .is_ngc = TRUE,
+  .id = 6682,
+  .ra = 279.904,
+  .dec = -4.80222,
+},
+{ .is_ngc = TRUE,
+  .id = 6683,
+  .ra = 280.554,
+  .dec = -6.20194,
+},
+{ .is_ngc = TRUE,
+  .id = 6684,
+  .ra = 282.241,
+  .dec = -65.1738,
+},
+{ .is_ngc = TRUE,
+  .id = 6685,
+  .ra = 279.994,
+  .dec = 39.9818,
+},
+{ .is_ngc = TRUE,
+  .id = 6686,
+  .ra = 280.029,
+  .dec = 40.1375,
+},
+{ .is_ngc = TRUE,
+  .id = 6687,
+  .ra = 279.342,
+  .dec = 59.6426,
+},
+{ .is_ngc = TRUE,
+  .id = 6688,
+  .ra = 280.167,
+  .dec = 36.2896,
+},
+{ .is_ngc = TRUE,
+  .id = 6691,
+  .ra = 279.801,
+  .dec = 55.6414,
+},
+{ .is_ngc = TRUE,
+  .id = 6692,
+  .ra = 280.423,
+  .dec = 34.8433,
+},
+{ .is_ngc = TRUE,
+  .id = 6693,
+  .ra = 280.383,
+  .dec = 36.9025,
+},
+{ .is_ngc = TRUE,
+  .id = 6694,
+  .ra = 281.325,
+  .dec = -9.38333,
+},
+{ .is_ngc = TRUE,
+  .id = 6695,
+  .ra = 280.678,
+  .dec = 40.3667,
+},
+{ .is_ngc = TRUE,
+  .id = 6696,
+  .ra = 280.021,
+  .dec = 59.3331,
+},
+{ .is_ngc = TRUE,
+  .id = 6697,
+  .ra = 281.313,
+  .dec = 25.5125,
+},
+{ .is_ngc = TRUE,
+  .id = 6698,
+  .ra = 282.071,
+  .dec = -25.9022,
+},
+{ .is_ngc = TRUE,
+  .id = 6698,
+  .ra = 282.004,
+  .dec = -25.4667,
+},
+{ .is_ngc = TRUE,
+  .id = 6699,
+  .ra = 283.01,
+  .dec = -57.3203,
+},
+{ .is_ngc = TRUE,
+  .id = 6700,
+  .ra = 281.519,
+  .dec = 32.2797,
+},
+{ .is_ngc = TRUE,
+  .id = 6701,
+  .ra = 280.802,
+  .dec = 60.6532,
+},
+{ .is_ngc = TRUE,
+  .id = 6702,
+  .ra = 281.74,
+  .dec = 45.7058,
+},
+{ .is_ngc = TRUE,
+  .id = 6703,
+  .ra = 281.829,
+  .dec = 45.5506,
+},
+{ .is_ngc = TRUE,
+  .id = 6704,
+  .ra = 282.688,
+  .dec = -5.20083,
+},
+{ .is_ngc = TRUE,
+  .id = 6705,
+  .ra = 282.771,
+  .dec = -6.26722,
+},
+{ .is_ngc = TRUE,
+  .id = 6706,
+  .ra = 284.213,
+  .dec = -63.1664,
+},
+{ .is_ngc = TRUE,
+  .id = 6707,
+  .ra = 283.841,
+  .dec = -53.8192,
+},
+{ .is_ngc = TRUE,
+  .id = 6708,
+  .ra = 283.898,
+  .dec = -53.7236,
+},
+{ .is_ngc = TRUE,
+  .id = 6709,
+  .ra = 282.825,
+  .dec = 10.3169,
+},
+{ .is_ngc = TRUE,
+  .id = 6710,
+  .ra = 282.642,
+  .dec = 26.838,
+},
+{ .is_ngc = TRUE,
+  .id = 6711,
+  .ra = 282.254,
+  .dec = 47.6575,
+},
+{ .is_ngc = TRUE,
+  .id = 6712,
+  .ra = 283.269,
+  .dec = -8.70531,
+},
+{ .is_ngc = TRUE,
+  .id = 6713,
+  .ra = 282.685,
+  .dec = 33.9599,
+},
+{ .is_ngc = TRUE,
+  .id = 6714,
+  .ra = 281.454,
+  .dec = 66.7181,
+},
+{ .is_ngc = TRUE,
+  .id = 6715,
+  .ra = 283.763,
+  .dec = -30.4796,
+},
+{ .is_ngc = TRUE,
+  .id = 6716,
+  .ra = 283.642,
+  .dec = -19.9003,
+},
+{ .is_ngc = TRUE,
+  .id = 6717,
+  .ra = 283.775,
+  .dec = -22.7015,
+},
+{ .is_ngc = TRUE,
+  .id = 6718,
+  .ra = 285.368,
+  .dec = -66.1106,
+},
+{ .is_ngc = TRUE,
+  .id = 6719,
+  .ra = 285.781,
+  .dec = -68.5878,
+},
+{ .is_ngc = TRUE,
+  .id = 6720,
+  .ra = 283.396,
+  .dec = 33.0289,
+},
+{ .is_ngc = TRUE,
+  .id = 6721,
+  .ra = 285.211,
+  .dec = -57.7586,
+},
+{ .is_ngc = TRUE,
+  .id = 6722,
+  .ra = 285.916,
+  .dec = -64.895,
+},
+{ .is_ngc = TRUE,
+  .id = 6723,
+  .ra = 284.888,
+  .dec = -36.6318,
+},
+{ .is_ngc = TRUE,
+  .id = 6724,
+  .ra = 284.192,
+  .dec = 10.4186,
+},
+{ .is_ngc = TRUE,
+  .id = 6725,
+  .ra = 285.485,
+  .dec = -53.8644,
+},
+{ .is_ngc = TRUE,
+  .id = 6726,
+  .ra = 285.413,
+  .dec = -36.8847,
+},
+{ .is_ngc = TRUE,
+  .id = 6728,
+  .ra = 284.687,
+  .dec = -8.96667,
+},
+{ .is_ngc = TRUE,
+  .id = 6729,
+  .ra = 285.479,
+  .dec = -36.9514,
+},
+{ .is_ngc = TRUE,
+  .id = 6730,
+  .ra = 286.89,
+  .dec = -68.9119,
+},
+{ .is_ngc = TRUE,
+  .id = 6731,
+  .ra = 284.306,
+  .dec = 43.0767,
+},
+{ .is_ngc = TRUE,
+  .id = 6732,
+  .ra = 284.1,
+  .dec = 52.3773,
+},
+{ .is_ngc = TRUE,
+  .id = 6733,
+  .ra = 286.545,
+  .dec = -62.1967,
+},
+{ .is_ngc = TRUE,
+  .id = 6734,
+  .ra = 286.808,
+  .dec = -65.4617,
+},
+{ .is_ngc = TRUE,
+  .id = 6735,
+  .ra = 285.154,
+  .dec = -0.468056,
+},
+{ .is_ngc = TRUE,
+  .id = 6736,
+  .ra = 286.872,
+  .dec = -65.4283,
+},
+{ .is_ngc = TRUE,
+  .id = 6737,
+  .ra = 285.571,
+  .dec = -18.5356,
+},
+{ .is_ngc = TRUE,
+  .id = 6737,
+  .ra = 285.75,
+  .dec = -18.5164,
+},
+{ .is_ngc = TRUE,
+  .id = 6738,
+  .ra = 285.337,
+  .dec = 11.6025,
+},
+{ .is_ngc = TRUE,
+  .id = 6739,
+  .ra = 286.952,
+  .dec = -61.3678,
+},
+{ .is_ngc = TRUE,
+  .id = 6739,
+  .ra = 287.012,
+  .dec = -61.3853,
+},
+{ .is_ngc = TRUE,
+  .id = 6740,
+  .ra = 285.211,
+  .dec = 28.7709,
+},
+{ .is_ngc = TRUE,
+  .id = 6741,
+  .ra = 285.654,
+  .dec = -0.449278,
+},
+{ .is_ngc = TRUE,
+  .id = 6742,
+  .ra = 284.833,
+  .dec = 48.4655,
+},
+{ .is_ngc = TRUE,
+  .id = 6743,
+  .ra = 285.333,
+  .dec = 29.2683,
+},
+{ .is_ngc = TRUE,
+  .id = 6744,
+  .ra = 287.441,
+  .dec = -63.857,
+},
+{ .is_ngc = TRUE,
+  .id = 6746,
+  .ra = 287.592,
+  .dec = -61.9694,
+},
+{ .is_ngc = TRUE,
+  .id = 6747,
+  .ra = 283.84,
+  .dec = 72.7715,
+},
+{ .is_ngc = TRUE,
+  .id = 6748,
+  .ra = 285.959,
+  .dec = 21.6089,
+},
+{ .is_ngc = TRUE,
+  .id = 6749,
+  .ra = 286.314,
+  .dec = 1.90056,
+},
+{ .is_ngc = TRUE,
+  .id = 6750,
+  .ra = 285.15,
+  .dec = 59.1666,
+},
+{ .is_ngc = TRUE,
+  .id = 6751,
+  .ra = 286.481,
+  .dec = -5.992,
+},
+{ .is_ngc = TRUE,
+  .id = 6753,
+  .ra = 287.848,
+  .dec = -57.0489,
+},
+{ .is_ngc = TRUE,
+  .id = 6754,
+  .ra = 287.855,
+  .dec = -50.6419,
+},
+{ .is_ngc = TRUE,
+  .id = 6755,
+  .ra = 286.954,
+  .dec = 4.26667,
+},
+{ .is_ngc = TRUE,
+  .id = 6756,
+  .ra = 287.175,
+  .dec = 4.70083,
+},
+{ .is_ngc = TRUE,
+  .id = 6757,
+  .ra = 286.276,
+  .dec = 55.7175,
+},
+{ .is_ngc = TRUE,
+  .id = 6758,
+  .ra = 288.468,
+  .dec = -56.3094,
+},
+{ .is_ngc = TRUE,
+  .id = 6759,
+  .ra = 286.738,
+  .dec = 50.3477,
+},
+{ .is_ngc = TRUE,
+  .id = 6760,
+  .ra = 287.8,
+  .dec = 1.03053,
+},
+{ .is_ngc = TRUE,
+  .id = 6761,
+  .ra = 288.771,
+  .dec = -50.6572,
+},
+{ .is_ngc = TRUE,
+  .id = 6764,
+  .ra = 287.069,
+  .dec = 50.933,
+},
+{ .is_ngc = TRUE,
+  .id = 6765,
+  .ra = 287.777,
+  .dec = 30.5458,
+},
+{ .is_ngc = TRUE,
+  .id = 6767,
+  .ra = 287.892,
+  .dec = 37.7254,
+},
+{ .is_ngc = TRUE,
+  .id = 6768,
+  .ra = 289.136,
+  .dec = -40.2089,
+},
+{ .is_ngc = TRUE,
+  .id = 6769,
+  .ra = 289.596,
+  .dec = -60.5012,
+},
+{ .is_ngc = TRUE,
+  .id = 6770,
+  .ra = 289.655,
+  .dec = -60.4968,
+},
+{ .is_ngc = TRUE,
+  .id = 6771,
+  .ra = 289.665,
+  .dec = -60.5461,
+},
+{ .is_ngc = TRUE,
+  .id = 6772,
+  .ra = 288.651,
+  .dec = -2.70681,
+},
+{ .is_ngc = TRUE,
+  .id = 6773,
+  .ra = 288.783,
+  .dec = 4.85111,
+},
+{ .is_ngc = TRUE,
+  .id = 6774,
+  .ra = 289.012,
+  .dec = -16.25,
+},
+{ .is_ngc = TRUE,
+  .id = 6775,
+  .ra = 289.175,
+  .dec = -0.933333,
+},
+{ .is_ngc = TRUE,
+  .id = 6776,
+  .ra = 291.33,
+  .dec = -63.8604,
+},
+{ .is_ngc = TRUE,
+  .id = 6779,
+  .ra = 289.149,
+  .dec = 30.1837,
+},
+{ .is_ngc = TRUE,
+  .id = 6780,
+  .ra = 290.712,
+  .dec = -55.775,
+},
+{ .is_ngc = TRUE,
+  .id = 6781,
+  .ra = 289.617,
+  .dec = 6.53878,
+},
+{ .is_ngc = TRUE,
+  .id = 6782,
+  .ra = 290.99,
+  .dec = -59.9225,
+},
+{ .is_ngc = TRUE,
+  .id = 6783,
+  .ra = 289.198,
+  .dec = 46.0173,
+},
+{ .is_ngc = TRUE,
+  .id = 6786,
+  .ra = 287.724,
+  .dec = 73.4101,
+},
+{ .is_ngc = TRUE,
+  .id = 6787,
+  .ra = 289.044,
+  .dec = 60.4173,
+},
+{ .is_ngc = TRUE,
+  .id = 6788,
+  .ra = 291.707,
+  .dec = -54.9508,
+},
+{ .is_ngc = TRUE,
+  .id = 6789,
+  .ra = 289.174,
+  .dec = 63.9719,
+},
+{ .is_ngc = TRUE,
+  .id = 6790,
+  .ra = 290.737,
+  .dec = 1.51339,
+},
+{ .is_ngc = TRUE,
+  .id = 6791,
+  .ra = 290.221,
+  .dec = 37.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 6792,
+  .ra = 290.239,
+  .dec = 43.1326,
+},
+{ .is_ngc = TRUE,
+  .id = 6793,
+  .ra = 290.808,
+  .dec = 22.1347,
+},
+{ .is_ngc = TRUE,
+  .id = 6794,
+  .ra = 292.014,
+  .dec = -38.9189,
+},
+{ .is_ngc = TRUE,
+  .id = 6795,
+  .ra = 291.575,
+  .dec = 3.5025,
+},
+{ .is_ngc = TRUE,
+  .id = 6796,
+  .ra = 290.379,
+  .dec = 61.1451,
+},
+{ .is_ngc = TRUE,
+  .id = 6797,
+  .ra = 292.252,
+  .dec = -25.6664,
+},
+{ .is_ngc = TRUE,
+  .id = 6799,
+  .ra = 293.069,
+  .dec = -55.9078,
+},
+{ .is_ngc = TRUE,
+  .id = 6800,
+  .ra = 291.779,
+  .dec = 25.1344,
+},
+{ .is_ngc = TRUE,
+  .id = 6801,
+  .ra = 291.9,
+  .dec = 54.3723,
+},
+{ .is_ngc = TRUE,
+  .id = 6802,
+  .ra = 292.646,
+  .dec = 20.2519,
+},
+{ .is_ngc = TRUE,
+  .id = 6803,
+  .ra = 292.819,
+  .dec = 10.0564,
+},
+{ .is_ngc = TRUE,
+  .id = 6804,
+  .ra = 292.897,
+  .dec = 9.22531,
+},
+{ .is_ngc = TRUE,
+  .id = 6805,
+  .ra = 294.191,
+  .dec = -37.5542,
+},
+{ .is_ngc = TRUE,
+  .id = 6806,
+  .ra = 294.272,
+  .dec = -42.2958,
+},
+{ .is_ngc = TRUE,
+  .id = 6807,
+  .ra = 293.64,
+  .dec = 5.68417,
+},
+{ .is_ngc = TRUE,
+  .id = 6808,
+  .ra = 295.976,
+  .dec = -70.6325,
+},
+{ .is_ngc = TRUE,
+  .id = 6809,
+  .ra = 294.999,
+  .dec = -30.9623,
+},
+{ .is_ngc = TRUE,
+  .id = 6810,
+  .ra = 295.892,
+  .dec = -58.6561,
+},
+{ .is_ngc = TRUE,
+  .id = 6811,
+  .ra = 294.321,
+  .dec = 46.3842,
+},
+{ .is_ngc = TRUE,
+  .id = 6812,
+  .ra = 296.351,
+  .dec = -55.347,
+},
+{ .is_ngc = TRUE,
+  .id = 6813,
+  .ra = 295.093,
+  .dec = 27.3094,
+},
+{ .is_ngc = TRUE,
+  .id = 6814,
+  .ra = 295.669,
+  .dec = -10.324,
+},
+{ .is_ngc = TRUE,
+  .id = 6815,
+  .ra = 295.183,
+  .dec = 26.7514,
+},
+{ .is_ngc = TRUE,
+  .id = 6816,
+  .ra = 296.01,
+  .dec = -28.4011,
+},
+{ .is_ngc = TRUE,
+  .id = 6818,
+  .ra = 295.991,
+  .dec = -14.1528,
+},
+{ .is_ngc = TRUE,
+  .id = 6819,
+  .ra = 295.325,
+  .dec = 40.1867,
+},
+{ .is_ngc = TRUE,
+  .id = 6820,
+  .ra = 295.617,
+  .dec = 23.0881,
+},
+{ .is_ngc = TRUE,
+  .id = 6821,
+  .ra = 296.1,
+  .dec = -6.83417,
+},
+{ .is_ngc = TRUE,
+  .id = 6823,
+  .ra = 295.788,
+  .dec = 23.3,
+},
+{ .is_ngc = TRUE,
+  .id = 6824,
+  .ra = 295.92,
+  .dec = 56.1094,
+},
+{ .is_ngc = TRUE,
+  .id = 6825,
+  .ra = 295.477,
+  .dec = 64.0725,
+},
+{ .is_ngc = TRUE,
+  .id = 6826,
+  .ra = 296.201,
+  .dec = 50.5251,
+},
+{ .is_ngc = TRUE,
+  .id = 6827,
+  .ra = 297.222,
+  .dec = 21.215,
+},
+{ .is_ngc = TRUE,
+  .id = 6828,
+  .ra = 297.571,
+  .dec = 7.90056,
+},
+{ .is_ngc = TRUE,
+  .id = 6829,
+  .ra = 296.782,
+  .dec = 59.9068,
+},
+{ .is_ngc = TRUE,
+  .id = 6830,
+  .ra = 297.746,
+  .dec = 23.1,
+},
+{ .is_ngc = TRUE,
+  .id = 6831,
+  .ra = 296.989,
+  .dec = 59.8924,
+},
+{ .is_ngc = TRUE,
+  .id = 6832,
+  .ra = 297.062,
+  .dec = 59.4175,
+},
+{ .is_ngc = TRUE,
+  .id = 6833,
+  .ra = 297.444,
+  .dec = 48.961,
+},
+{ .is_ngc = TRUE,
+  .id = 6834,
+  .ra = 298.05,
+  .dec = 29.4014,
+},
+{ .is_ngc = TRUE,
+  .id = 6835,
+  .ra = 298.637,
+  .dec = -12.5675,
+},
+{ .is_ngc = TRUE,
+  .id = 6836,
+  .ra = 298.668,
+  .dec = -12.6878,
+},
+{ .is_ngc = TRUE,
+  .id = 6837,
+  .ra = 298.283,
+  .dec = 11.6858,
+},
+{ .is_ngc = TRUE,
+  .id = 6839,
+  .ra = 298.637,
+  .dec = 17.9342,
+},
+{ .is_ngc = TRUE,
+  .id = 6840,
+  .ra = 298.821,
+  .dec = 12.1175,
+},
+{ .is_ngc = TRUE,
+  .id = 6841,
+  .ra = 299.455,
+  .dec = -31.8103,
+},
+{ .is_ngc = TRUE,
+  .id = 6842,
+  .ra = 298.76,
+  .dec = 29.2889,
+},
+{ .is_ngc = TRUE,
+  .id = 6843,
+  .ra = 299.025,
+  .dec = 12.1636,
+},
+{ .is_ngc = TRUE,
+  .id = 6844,
+  .ra = 300.71,
+  .dec = -65.2297,
+},
+{ .is_ngc = TRUE,
+  .id = 6846,
+  .ra = 299.117,
+  .dec = 32.3494,
+},
+{ .is_ngc = TRUE,
+  .id = 6847,
+  .ra = 299.288,
+  .dec = 29.3506,
+},
+{ .is_ngc = TRUE,
+  .id = 6847,
+  .ra = 299.154,
+  .dec = 30.2022,
+},
+{ .is_ngc = TRUE,
+  .id = 6848,
+  .ra = 300.695,
+  .dec = -56.0894,
+},
+{ .is_ngc = TRUE,
+  .id = 6849,
+  .ra = 301.566,
+  .dec = -40.1981,
+},
+{ .is_ngc = TRUE,
+  .id = 6850,
+  .ra = 300.874,
+  .dec = -54.8456,
+},
+{ .is_ngc = TRUE,
+  .id = 6851,
+  .ra = 300.893,
+  .dec = -48.2847,
+},
+{ .is_ngc = TRUE,
+  .id = 6852,
+  .ra = 300.163,
+  .dec = 1.72811,
+},
+{ .is_ngc = TRUE,
+  .id = 6853,
+  .ra = 299.901,
+  .dec = 22.7209,
+},
+{ .is_ngc = TRUE,
+  .id = 6854,
+  .ra = 301.412,
+  .dec = -54.3759,
+},
+{ .is_ngc = TRUE,
+  .id = 6855,
+  .ra = 301.708,
+  .dec = -56.39,
+},
+{ .is_ngc = TRUE,
+  .id = 6856,
+  .ra = 299.821,
+  .dec = 56.1308,
+},
+{ .is_ngc = TRUE,
+  .id = 6856,
+  .ra = 299.825,
+  .dec = 56.1247,
+},
+{ .is_ngc = TRUE,
+  .id = 6857,
+  .ra = 300.45,
+  .dec = 33.5258,
+},
+{ .is_ngc = TRUE,
+  .id = 6858,
+  .ra = 300.746,
+  .dec = 11.2517,
+},
+{ .is_ngc = TRUE,
+  .id = 6858,
+  .ra = 300.725,
+  .dec = 11.2581,
+},
+{ .is_ngc = TRUE,
+  .id = 6859,
+  .ra = 300.955,
+  .dec = 0.443889,
+},
+{ .is_ngc = TRUE,
+  .id = 6860,
+  .ra = 302.194,
+  .dec = -61.0994,
+},
+{ .is_ngc = TRUE,
+  .id = 6862,
+  .ra = 302.227,
+  .dec = -56.3928,
+},
+{ .is_ngc = TRUE,
+  .id = 6863,
+  .ra = 301.28,
+  .dec = -3.555,
+},
+{ .is_ngc = TRUE,
+  .id = 6864,
+  .ra = 301.52,
+  .dec = -21.9219,
+},
+{ .is_ngc = TRUE,
+  .id = 6865,
+  .ra = 301.485,
+  .dec = -9.04111,
+},
+{ .is_ngc = TRUE,
+  .id = 6866,
+  .ra = 300.979,
+  .dec = 44.1514,
+},
+{ .is_ngc = TRUE,
+  .id = 6867,
+  .ra = 302.623,
+  .dec = -54.7839,
+},
+{ .is_ngc = TRUE,
+  .id = 6868,
+  .ra = 302.475,
+  .dec = -48.3796,
+},
+{ .is_ngc = TRUE,
+  .id = 6869,
+  .ra = 300.177,
+  .dec = 66.2277,
+},
+{ .is_ngc = TRUE,
+  .id = 6870,
+  .ra = 302.544,
+  .dec = -48.2869,
+},
+{ .is_ngc = TRUE,
+  .id = 6871,
+  .ra = 301.498,
+  .dec = 35.7772,
+},
+{ .is_ngc = TRUE,
+  .id = 6872,
+  .ra = 304.237,
+  .dec = -70.7678,
+},
+{ .is_ngc = TRUE,
+  .id = 6873,
+  .ra = 301.804,
+  .dec = 21.1003,
+},
+{ .is_ngc = TRUE,
+  .id = 6874,
+  .ra = 301.887,
+  .dec = 38.2356,
+},
+{ .is_ngc = TRUE,
+  .id = 6874,
+  .ra = 301.95,
+  .dec = 38.2331,
+},
+{ .is_ngc = TRUE,
+  .id = 6875,
+  .ra = 303.301,
+  .dec = -46.1611,
+},
+{ .is_ngc = TRUE,
+  .id = 6876,
+  .ra = 304.582,
+  .dec = -70.8581,
+},
+{ .is_ngc = TRUE,
+  .id = 6877,
+  .ra = 304.65,
+  .dec = -70.8528,
+},
+{ .is_ngc = TRUE,
+  .id = 6878,
+  .ra = 303.472,
+  .dec = -44.5261,
+},
+{ .is_ngc = TRUE,
+  .id = 6879,
+  .ra = 302.611,
+  .dec = 16.9229,
+},
+{ .is_ngc = TRUE,
+  .id = 6880,
+  .ra = 304.875,
+  .dec = -70.8597,
+},
+{ .is_ngc = TRUE,
+  .id = 6881,
+  .ra = 302.719,
+  .dec = 37.4116,
+},
+{ .is_ngc = TRUE,
+  .id = 6882,
+  .ra = 302.95,
+  .dec = 26.8014,
+},
+{ .is_ngc = TRUE,
+  .id = 6883,
+  .ra = 302.833,
+  .dec = 35.8319,
+},
+{ .is_ngc = TRUE,
+  .id = 6886,
+  .ra = 303.179,
+  .dec = 19.9895,
+},
+{ .is_ngc = TRUE,
+  .id = 6887,
+  .ra = 304.321,
+  .dec = -52.7969,
+},
+{ .is_ngc = TRUE,
+  .id = 6888,
+  .ra = 303.027,
+  .dec = 38.3547,
+},
+{ .is_ngc = TRUE,
+  .id = 6889,
+  .ra = 304.721,
+  .dec = -53.9567,
+},
+{ .is_ngc = TRUE,
+  .id = 6890,
+  .ra = 304.576,
+  .dec = -44.8052,
+},
+{ .is_ngc = TRUE,
+  .id = 6891,
+  .ra = 303.787,
+  .dec = 12.7044,
+},
+{ .is_ngc = TRUE,
+  .id = 6892,
+  .ra = 304.238,
+  .dec = 18.0194,
+},
+{ .is_ngc = TRUE,
+  .id = 6893,
+  .ra = 305.206,
+  .dec = -48.2394,
+},
+{ .is_ngc = TRUE,
+  .id = 6894,
+  .ra = 304.099,
+  .dec = 30.5652,
+},
+{ .is_ngc = TRUE,
+  .id = 6895,
+  .ra = 304.133,
+  .dec = 50.2344,
+},
+{ .is_ngc = TRUE,
+  .id = 6896,
+  .ra = 304.515,
+  .dec = 30.6397,
+},
+{ .is_ngc = TRUE,
+  .id = 6897,
+  .ra = 305.255,
+  .dec = -12.2547,
+},
+{ .is_ngc = TRUE,
+  .id = 6898,
+  .ra = 305.283,
+  .dec = -12.3589,
+},
+{ .is_ngc = TRUE,
+  .id = 6899,
+  .ra = 306.092,
+  .dec = -50.4333,
+},
+{ .is_ngc = TRUE,
+  .id = 6900,
+  .ra = 305.396,
+  .dec = -2.57,
+},
+{ .is_ngc = TRUE,
+  .id = 6903,
+  .ra = 305.937,
+  .dec = -19.3253,
+},
+{ .is_ngc = TRUE,
+  .id = 6904,
+  .ra = 305.45,
+  .dec = 25.7414,
+},
+{ .is_ngc = TRUE,
+  .id = 6905,
+  .ra = 305.596,
+  .dec = 20.1044,
+},
+{ .is_ngc = TRUE,
+  .id = 6906,
+  .ra = 305.892,
+  .dec = 6.44367,
+},
+{ .is_ngc = TRUE,
+  .id = 6907,
+  .ra = 306.278,
+  .dec = -24.8088,
+},
+{ .is_ngc = TRUE,
+  .id = 6908,
+  .ra = 306.287,
+  .dec = -24.8008,
+},
+{ .is_ngc = TRUE,
+  .id = 6909,
+  .ra = 306.911,
+  .dec = -47.0267,
+},
+{ .is_ngc = TRUE,
+  .id = 6910,
+  .ra = 305.8,
+  .dec = 40.7686,
+},
+{ .is_ngc = TRUE,
+  .id = 6911,
+  .ra = 304.911,
+  .dec = 66.7281,
+},
+{ .is_ngc = TRUE,
+  .id = 6912,
+  .ra = 306.717,
+  .dec = -18.6175,
+},
+{ .is_ngc = TRUE,
+  .id = 6913,
+  .ra = 305.988,
+  .dec = 38.5014,
+},
+{ .is_ngc = TRUE,
+  .id = 6914,
+  .ra = 306.18,
+  .dec = 42.4825,
+},
+{ .is_ngc = TRUE,
+  .id = 6915,
+  .ra = 306.942,
+  .dec = -3.07694,
+},
+{ .is_ngc = TRUE,
+  .id = 6916,
+  .ra = 305.888,
+  .dec = 58.3439,
+},
+{ .is_ngc = TRUE,
+  .id = 6917,
+  .ra = 306.868,
+  .dec = 8.09772,
+},
+{ .is_ngc = TRUE,
+  .id = 6918,
+  .ra = 307.696,
+  .dec = -47.4728,
+},
+{ .is_ngc = TRUE,
+  .id = 6919,
+  .ra = 307.909,
+  .dec = -44.2164,
+},
+{ .is_ngc = TRUE,
+  .id = 6920,
+  .ra = 310.987,
+  .dec = -80.0006,
+},
+{ .is_ngc = TRUE,
+  .id = 6921,
+  .ra = 307.12,
+  .dec = 25.7234,
+},
+{ .is_ngc = TRUE,
+  .id = 6924,
+  .ra = 308.33,
+  .dec = -25.4742,
+},
+{ .is_ngc = TRUE,
+  .id = 6926,
+  .ra = 308.275,
+  .dec = -2.02817,
+},
+{ .is_ngc = TRUE,
+  .id = 6927,
+  .ra = 308.159,
+  .dec = 9.91631,
+},
+{ .is_ngc = TRUE,
+  .id = 6929,
+  .ra = 308.34,
+  .dec = -2.03753,
+},
+{ .is_ngc = TRUE,
+  .id = 6931,
+  .ra = 308.422,
+  .dec = -11.3689,
+},
+{ .is_ngc = TRUE,
+  .id = 6932,
+  .ra = 310.535,
+  .dec = -73.6194,
+},
+{ .is_ngc = TRUE,
+  .id = 6933,
+  .ra = 308.409,
+  .dec = 7.38733,
+},
+{ .is_ngc = TRUE,
+  .id = 6934,
+  .ra = 308.548,
+  .dec = 7.40461,
+},
+{ .is_ngc = TRUE,
+  .id = 6935,
+  .ra = 309.583,
+  .dec = -52.1097,
+},
+{ .is_ngc = TRUE,
+  .id = 6936,
+  .ra = 308.985,
+  .dec = -25.2797,
+},
+{ .is_ngc = TRUE,
+  .id = 6937,
+  .ra = 309.69,
+  .dec = -52.1439,
+},
+{ .is_ngc = TRUE,
+  .id = 6938,
+  .ra = 308.676,
+  .dec = 22.2153,
+},
+{ .is_ngc = TRUE,
+  .id = 6939,
+  .ra = 307.875,
+  .dec = 60.6519,
+},
+{ .is_ngc = TRUE,
+  .id = 6940,
+  .ra = 308.608,
+  .dec = 28.2833,
+},
+{ .is_ngc = TRUE,
+  .id = 6941,
+  .ra = 309.098,
+  .dec = -4.61861,
+},
+{ .is_ngc = TRUE,
+  .id = 6942,
+  .ra = 310.157,
+  .dec = -54.3031,
+},
+{ .is_ngc = TRUE,
+  .id = 6943,
+  .ra = 311.138,
+  .dec = -68.7475,
+},
+{ .is_ngc = TRUE,
+  .id = 6944,
+  .ra = 309.599,
+  .dec = 6.99662,
+},
+{ .is_ngc = TRUE,
+  .id = 6945,
+  .ra = 309.753,
+  .dec = -4.97256,
+},
+{ .is_ngc = TRUE,
+  .id = 6946,
+  .ra = 308.717,
+  .dec = 60.154,
+},
+{ .is_ngc = TRUE,
+  .id = 6947,
+  .ra = 310.314,
+  .dec = -32.4872,
+},
+{ .is_ngc = TRUE,
+  .id = 6948,
+  .ra = 310.871,
+  .dec = -53.3575,
+},
+{ .is_ngc = TRUE,
+  .id = 6949,
+  .ra = 308.78,
+  .dec = 64.8026,
+},
+{ .is_ngc = TRUE,
+  .id = 6950,
+  .ra = 310.271,
+  .dec = 16.6175,
+},
+{ .is_ngc = TRUE,
+  .id = 6953,
+  .ra = 309.442,
+  .dec = 65.7647,
+},
+{ .is_ngc = TRUE,
+  .id = 6953,
+  .ra = 310.304,
+  .dec = 65.7633,
+},
+{ .is_ngc = TRUE,
+  .id = 6954,
+  .ra = 311.014,
+  .dec = 3.20928,
+},
+{ .is_ngc = TRUE,
+  .id = 6955,
+  .ra = 311.075,
+  .dec = 2.5947,
+},
+{ .is_ngc = TRUE,
+  .id = 6956,
+  .ra = 310.974,
+  .dec = 12.5115,
+},
+{ .is_ngc = TRUE,
+  .id = 6957,
+  .ra = 311.199,
+  .dec = 2.58056,
+},
+{ .is_ngc = TRUE,
+  .id = 6958,
+  .ra = 312.178,
+  .dec = -37.9971,
+},
+{ .is_ngc = TRUE,
+  .id = 6959,
+  .ra = 311.78,
+  .dec = 0.43,
+},
+{ .is_ngc = TRUE,
+  .id = 6960,
+  .ra = 311.492,
+  .dec = 30.5853,
+},
+{ .is_ngc = TRUE,
+  .id = 6961,
+  .ra = 311.794,
+  .dec = 0.363097,
+},
+{ .is_ngc = TRUE,
+  .id = 6962,
+  .ra = 311.829,
+  .dec = 0.320778,
+},
+{ .is_ngc = TRUE,
+  .id = 6963,
+  .ra = 311.831,
+  .dec = 0.509028,
+},
+{ .is_ngc = TRUE,
+  .id = 6964,
+  .ra = 311.851,
+  .dec = 0.300694,
+},
+{ .is_ngc = TRUE,
+  .id = 6966,
+  .ra = 311.862,
+  .dec = 0.3675,
+},
+{ .is_ngc = TRUE,
+  .id = 6967,
+  .ra = 311.892,
+  .dec = 0.411583,
+},
+{ .is_ngc = TRUE,
+  .id = 6968,
+  .ra = 312.135,
+  .dec = -8.36013,
+},
+{ .is_ngc = TRUE,
+  .id = 6969,
+  .ra = 312.115,
+  .dec = 7.73972,
+},
+{ .is_ngc = TRUE,
+  .id = 6970,
+  .ra = 313.039,
+  .dec = -48.7772,
+},
+{ .is_ngc = TRUE,
+  .id = 6971,
+  .ra = 312.349,
+  .dec = 5.99508,
+},
+{ .is_ngc = TRUE,
+  .id = 6972,
+  .ra = 312.496,
+  .dec = 9.89916,
+},
+{ .is_ngc = TRUE,
+  .id = 6973,
+  .ra = 313.025,
+  .dec = -5.89467,
+},
+{ .is_ngc = TRUE,
+  .id = 6974,
+  .ra = 312.767,
+  .dec = 31.8186,
+},
+{ .is_ngc = TRUE,
+  .id = 6977,
+  .ra = 313.124,
+  .dec = -5.74648,
+},
+{ .is_ngc = TRUE,
+  .id = 6978,
+  .ra = 313.147,
+  .dec = -5.71111,
+},
+{ .is_ngc = TRUE,
+  .id = 6979,
+  .ra = 312.617,
+  .dec = 32.0183,
+},
+{ .is_ngc = TRUE,
+  .id = 6980,
+  .ra = 313.204,
+  .dec = -5.83789,
+},
+{ .is_ngc = TRUE,
+  .id = 6981,
+  .ra = 313.366,
+  .dec = -12.5373,
+},
+{ .is_ngc = TRUE,
+  .id = 6982,
+  .ra = 314.326,
+  .dec = -51.8625,
+},
+{ .is_ngc = TRUE,
+  .id = 6983,
+  .ra = 314.181,
+  .dec = -43.9861,
+},
+{ .is_ngc = TRUE,
+  .id = 6984,
+  .ra = 314.475,
+  .dec = -51.8706,
+},
+{ .is_ngc = TRUE,
+  .id = 6985,
+  .ra = 311.262,
+  .dec = -11.1044,
+},
+{ .is_ngc = TRUE,
+  .id = 6986,
+  .ra = 314.128,
+  .dec = -18.5667,
+},
+{ .is_ngc = TRUE,
+  .id = 6987,
+  .ra = 314.543,
+  .dec = -48.6297,
+},
+{ .is_ngc = TRUE,
+  .id = 6988,
+  .ra = 313.954,
+  .dec = 10.5076,
+},
+{ .is_ngc = TRUE,
+  .id = 6989,
+  .ra = 313.525,
+  .dec = 45.2344,
+},
+{ .is_ngc = TRUE,
+  .id = 6990,
+  .ra = 314.987,
+  .dec = -55.5617,
+},
+{ .is_ngc = TRUE,
+  .id = 6992,
+  .ra = 314.079,
+  .dec = 31.735,
+},
+{ .is_ngc = TRUE,
+  .id = 6993,
+  .ra = 313.475,
+  .dec = -25.4719,
+},
+{ .is_ngc = TRUE,
+  .id = 6994,
+  .ra = 314.733,
+  .dec = -12.6353,
+},
+{ .is_ngc = TRUE,
+  .id = 6995,
+  .ra = 314.292,
+  .dec = 31.2336,
+},
+{ .is_ngc = TRUE,
+  .id = 6996,
+  .ra = 314.125,
+  .dec = 45.4678,
+},
+{ .is_ngc = TRUE,
+  .id = 6997,
+  .ra = 314.163,
+  .dec = 44.6192,
+},
+{ .is_ngc = TRUE,
+  .id = 6998,
+  .ra = 315.407,
+  .dec = -28.0319,
+},
+{ .is_ngc = TRUE,
+  .id = 6999,
+  .ra = 315.497,
+  .dec = -28.0592,
+},
+{ .is_ngc = TRUE,
+  .id = 7000,
+  .ra = 314.762,
+  .dec = 44.5167,
+},
+{ .is_ngc = TRUE,
+  .id = 7001,
+  .ra = 315.282,
+  .dec = -0.195294,
+},
+{ .is_ngc = TRUE,
+  .id = 7002,
+  .ra = 315.938,
+  .dec = -49.0294,
+},
+{ .is_ngc = TRUE,
+  .id = 7003,
+  .ra = 315.176,
+  .dec = 17.8048,
+},
+{ .is_ngc = TRUE,
+  .id = 7004,
+  .ra = 316.008,
+  .dec = -49.1136,
+},
+{ .is_ngc = TRUE,
+  .id = 7005,
+  .ra = 315.489,
+  .dec = -12.8814,
+},
+{ .is_ngc = TRUE,
+  .id = 7006,
+  .ra = 315.372,
+  .dec = 16.1875,
+},
+{ .is_ngc = TRUE,
+  .id = 7007,
+  .ra = 316.365,
+  .dec = -52.5519,
+},
+{ .is_ngc = TRUE,
+  .id = 7008,
+  .ra = 315.137,
+  .dec = 54.543,
+},
+{ .is_ngc = TRUE,
+  .id = 7009,
+  .ra = 316.045,
+  .dec = -11.3639,
+},
+{ .is_ngc = TRUE,
+  .id = 7011,
+  .ra = 315.457,
+  .dec = 47.3542,
+},
+{ .is_ngc = TRUE,
+  .id = 7012,
+  .ra = 316.69,
+  .dec = -44.8142,
+},
+{ .is_ngc = TRUE,
+  .id = 7013,
+  .ra = 315.889,
+  .dec = 29.8969,
+},
+{ .is_ngc = TRUE,
+  .id = 7014,
+  .ra = 316.968,
+  .dec = -47.1781,
+},
+{ .is_ngc = TRUE,
+  .id = 7015,
+  .ra = 316.405,
+  .dec = 11.4136,
+},
+{ .is_ngc = TRUE,
+  .id = 7016,
+  .ra = 316.818,
+  .dec = -25.4691,
+},
+{ .is_ngc = TRUE,
+  .id = 7017,
+  .ra = 316.836,
+  .dec = -25.4877,
+},
+{ .is_ngc = TRUE,
+  .id = 7018,
+  .ra = 316.857,
+  .dec = -25.4291,
+},
+{ .is_ngc = TRUE,
+  .id = 7019,
+  .ra = 316.608,
+  .dec = -24.4131,
+},
+{ .is_ngc = TRUE,
+  .id = 7022,
+  .ra = 317.396,
+  .dec = -49.3033,
+},
+{ .is_ngc = TRUE,
+  .id = 7023,
+  .ra = 315.398,
+  .dec = 68.1694,
+},
+{ .is_ngc = TRUE,
+  .id = 7024,
+  .ra = 316.538,
+  .dec = 41.4894,
+},
+{ .is_ngc = TRUE,
+  .id = 7025,
+  .ra = 316.947,
+  .dec = 16.3356,
+},
+{ .is_ngc = TRUE,
+  .id = 7026,
+  .ra = 316.577,
+  .dec = 47.8522,
+},
+{ .is_ngc = TRUE,
+  .id = 7027,
+  .ra = 316.757,
+  .dec = 42.2362,
+},
+{ .is_ngc = TRUE,
+  .id = 7028,
+  .ra = 317.062,
+  .dec = 18.4689,
+},
+{ .is_ngc = TRUE,
+  .id = 7028,
+  .ra = 316.459,
+  .dec = 18.4684,
+},
+{ .is_ngc = TRUE,
+  .id = 7029,
+  .ra = 317.966,
+  .dec = -49.2833,
+},
+{ .is_ngc = TRUE,
+  .id = 7030,
+  .ra = 317.806,
+  .dec = -20.4864,
+},
+{ .is_ngc = TRUE,
+  .id = 7031,
+  .ra = 316.8,
+  .dec = 50.8681,
+},
+{ .is_ngc = TRUE,
+  .id = 7032,
+  .ra = 318.846,
+  .dec = -68.2881,
+},
+{ .is_ngc = TRUE,
+  .id = 7033,
+  .ra = 317.401,
+  .dec = 15.1243,
+},
+{ .is_ngc = TRUE,
+  .id = 7034,
+  .ra = 317.409,
+  .dec = 15.1502,
+},
+{ .is_ngc = TRUE,
+  .id = 7035,
+  .ra = 317.691,
+  .dec = -23.1361,
+},
+{ .is_ngc = TRUE,
+  .id = 7036,
+  .ra = 317.55,
+  .dec = 15.3683,
+},
+{ .is_ngc = TRUE,
+  .id = 7037,
+  .ra = 317.704,
+  .dec = 33.7356,
+},
+{ .is_ngc = TRUE,
+  .id = 7038,
+  .ra = 318.782,
+  .dec = -47.2205,
+},
+{ .is_ngc = TRUE,
+  .id = 7039,
+  .ra = 317.533,
+  .dec = 45.6167,
+},
+{ .is_ngc = TRUE,
+  .id = 7040,
+  .ra = 318.319,
+  .dec = 8.86478,
+},
+{ .is_ngc = TRUE,
+  .id = 7041,
+  .ra = 319.135,
+  .dec = -48.3636,
+},
+{ .is_ngc = TRUE,
+  .id = 7042,
+  .ra = 318.441,
+  .dec = 13.5748,
+},
+{ .is_ngc = TRUE,
+  .id = 7043,
+  .ra = 318.517,
+  .dec = 13.6258,
+},
+{ .is_ngc = TRUE,
+  .id = 7044,
+  .ra = 318.289,
+  .dec = 42.4961,
+},
+{ .is_ngc = TRUE,
+  .id = 7045,
+  .ra = 318.709,
+  .dec = 4.50742,
+},
+{ .is_ngc = TRUE,
+  .id = 7046,
+  .ra = 318.733,
+  .dec = 2.83467,
+},
+{ .is_ngc = TRUE,
+  .id = 7047,
+  .ra = 319.115,
+  .dec = -0.826639,
+},
+{ .is_ngc = TRUE,
+  .id = 7048,
+  .ra = 318.563,
+  .dec = 46.2883,
+},
+{ .is_ngc = TRUE,
+  .id = 7049,
+  .ra = 319.751,
+  .dec = -48.5628,
+},
+{ .is_ngc = TRUE,
+  .id = 7050,
+  .ra = 318.783,
+  .dec = 36.1681,
+},
+{ .is_ngc = TRUE,
+  .id = 7051,
+  .ra = 319.964,
+  .dec = -8.78278,
+},
+{ .is_ngc = TRUE,
+  .id = 7052,
+  .ra = 319.638,
+  .dec = 26.447,
+},
+{ .is_ngc = TRUE,
+  .id = 7053,
+  .ra = 320.282,
+  .dec = 23.0848,
+},
+{ .is_ngc = TRUE,
+  .id = 7054,
+  .ra = 320.181,
+  .dec = 39.1719,
+},
+{ .is_ngc = TRUE,
+  .id = 7055,
+  .ra = 319.875,
+  .dec = 57.5672,
+},
+{ .is_ngc = TRUE,
+  .id = 7057,
+  .ra = 321.244,
+  .dec = -42.4606,
+},
+{ .is_ngc = TRUE,
+  .id = 7058,
+  .ra = 320.25,
+  .dec = 50.8014,
+},
+{ .is_ngc = TRUE,
+  .id = 7058,
+  .ra = 320.471,
+  .dec = 50.8169,
+},
+{ .is_ngc = TRUE,
+  .id = 7058,
+  .ra = 320.258,
+  .dec = 50.8333,
+},
+{ .is_ngc = TRUE,
+  .id = 7059,
+  .ra = 321.84,
+  .dec = -60.0144,
+},
+{ .is_ngc = TRUE,
+  .id = 7060,
+  .ra = 321.472,
+  .dec = -42.4106,
+},
+{ .is_ngc = TRUE,
+  .id = 7061,
+  .ra = 321.862,
+  .dec = -49.0636,
+},
+{ .is_ngc = TRUE,
+  .id = 7062,
+  .ra = 320.863,
+  .dec = 46.3686,
+},
+{ .is_ngc = TRUE,
+  .id = 7063,
+  .ra = 321.087,
+  .dec = 36.4839,
+},
+{ .is_ngc = TRUE,
+  .id = 7064,
+  .ra = 322.261,
+  .dec = -52.7664,
+},
+{ .is_ngc = TRUE,
+  .id = 7065,
+  .ra = 321.677,
+  .dec = -6.99541,
+},
+{ .is_ngc = TRUE,
+  .id = 7066,
+  .ra = 321.557,
+  .dec = 14.1825,
+},
+{ .is_ngc = TRUE,
+  .id = 7067,
+  .ra = 321.096,
+  .dec = 48.0017,
+},
+{ .is_ngc = TRUE,
+  .id = 7068,
+  .ra = 321.635,
+  .dec = 12.1839,
+},
+{ .is_ngc = TRUE,
+  .id = 7069,
+  .ra = 322.025,
+  .dec = -1.64692,
+},
+{ .is_ngc = TRUE,
+  .id = 7070,
+  .ra = 322.605,
+  .dec = -43.0867,
+},
+{ .is_ngc = TRUE,
+  .id = 7071,
+  .ra = 321.665,
+  .dec = 47.9208,
+},
+{ .is_ngc = TRUE,
+  .id = 7072,
+  .ra = 322.655,
+  .dec = -43.1528,
+},
+{ .is_ngc = TRUE,
+  .id = 7073,
+  .ra = 322.358,
+  .dec = -11.4886,
+},
+{ .is_ngc = TRUE,
+  .id = 7074,
+  .ra = 322.412,
+  .dec = 6.68194,
+},
+{ .is_ngc = TRUE,
+  .id = 7075,
+  .ra = 322.886,
+  .dec = -38.6178,
+},
+{ .is_ngc = TRUE,
+  .id = 7076,
+  .ra = 321.598,
+  .dec = 62.8925,
+},
+{ .is_ngc = TRUE,
+  .id = 7077,
+  .ra = 322.499,
+  .dec = 2.41416,
+},
+{ .is_ngc = TRUE,
+  .id = 7078,
+  .ra = 322.493,
+  .dec = 12.1672,
+},
+{ .is_ngc = TRUE,
+  .id = 7079,
+  .ra = 323.146,
+  .dec = -44.0672,
+},
+{ .is_ngc = TRUE,
+  .id = 7080,
+  .ra = 322.508,
+  .dec = 26.7178,
+},
+{ .is_ngc = TRUE,
+  .id = 7081,
+  .ra = 322.851,
+  .dec = 2.49072,
+},
+{ .is_ngc = TRUE,
+  .id = 7082,
+  .ra = 322.321,
+  .dec = 47.1183,
+},
+{ .is_ngc = TRUE,
+  .id = 7083,
+  .ra = 323.938,
+  .dec = -63.9042,
+},
+{ .is_ngc = TRUE,
+  .id = 7084,
+  .ra = 323.137,
+  .dec = 17.5014,
+},
+{ .is_ngc = TRUE,
+  .id = 7085,
+  .ra = 323.105,
+  .dec = 6.58102,
+},
+{ .is_ngc = TRUE,
+  .id = 7086,
+  .ra = 322.613,
+  .dec = 51.6,
+},
+{ .is_ngc = TRUE,
+  .id = 7087,
+  .ra = 323.639,
+  .dec = -40.8178,
+},
+{ .is_ngc = TRUE,
+  .id = 7088,
+  .ra = 323.342,
+  .dec = -0.383333,
+},
+{ .is_ngc = TRUE,
+  .id = 7089,
+  .ra = 323.363,
+  .dec = -0.823194,
+},
+{ .is_ngc = TRUE,
+  .id = 7090,
+  .ra = 324.119,
+  .dec = -54.5567,
+},
+{ .is_ngc = TRUE,
+  .id = 7092,
+  .ra = 322.779,
+  .dec = 48.4167,
+},
+{ .is_ngc = TRUE,
+  .id = 7093,
+  .ra = 323.587,
+  .dec = 45.9525,
+},
+{ .is_ngc = TRUE,
+  .id = 7094,
+  .ra = 324.221,
+  .dec = 12.7886,
+},
+{ .is_ngc = TRUE,
+  .id = 7095,
+  .ra = 328.11,
+  .dec = -81.5311,
+},
+{ .is_ngc = TRUE,
+  .id = 7097,
+  .ra = 325.054,
+  .dec = -42.5392,
+},
+{ .is_ngc = TRUE,
+  .id = 7098,
+  .ra = 326.068,
+  .dec = -75.1116,
+},
+{ .is_ngc = TRUE,
+  .id = 7099,
+  .ra = 325.092,
+  .dec = -23.1792,
+},
+{ .is_ngc = TRUE,
+  .id = 7100,
+  .ra = 324.779,
+  .dec = 8.95153,
+},
+{ .is_ngc = TRUE,
+  .id = 7101,
+  .ra = 324.894,
+  .dec = 8.87703,
+},
+{ .is_ngc = TRUE,
+  .id = 7103,
+  .ra = 324.963,
+  .dec = -22.4735,
+},
+{ .is_ngc = TRUE,
+  .id = 7104,
+  .ra = 325.013,
+  .dec = -22.4247,
+},
+{ .is_ngc = TRUE,
+  .id = 7105,
+  .ra = 325.422,
+  .dec = -10.6355,
+},
+{ .is_ngc = TRUE,
+  .id = 7106,
+  .ra = 325.653,
+  .dec = -52.6992,
+},
+{ .is_ngc = TRUE,
+  .id = 7107,
+  .ra = 325.611,
+  .dec = -44.7925,
+},
+{ .is_ngc = TRUE,
+  .id = 7109,
+  .ra = 325.493,
+  .dec = -34.4456,
+},
+{ .is_ngc = TRUE,
+  .id = 7110,
+  .ra = 325.55,
+  .dec = -34.1622,
+},
+{ .is_ngc = TRUE,
+  .id = 7114,
+  .ra = 325.433,
+  .dec = 42.8415,
+},
+{ .is_ngc = TRUE,
+  .id = 7115,
+  .ra = 325.912,
+  .dec = -25.3513,
+},
+{ .is_ngc = TRUE,
+  .id = 7116,
+  .ra = 325.669,
+  .dec = 28.9464,
+},
+{ .is_ngc = TRUE,
+  .id = 7117,
+  .ra = 326.446,
+  .dec = -48.4211,
+},
+{ .is_ngc = TRUE,
+  .id = 7118,
+  .ra = 326.541,
+  .dec = -48.3536,
+},
+{ .is_ngc = TRUE,
+  .id = 7120,
+  .ra = 326.138,
+  .dec = -6.52389,
+},
+{ .is_ngc = TRUE,
+  .id = 7121,
+  .ra = 326.219,
+  .dec = -3.62,
+},
+{ .is_ngc = TRUE,
+  .id = 7122,
+  .ra = 326.449,
+  .dec = -8.83019,
+},
+{ .is_ngc = TRUE,
+  .id = 7123,
+  .ra = 327.694,
+  .dec = -70.3342,
+},
+{ .is_ngc = TRUE,
+  .id = 7124,
+  .ra = 327.023,
+  .dec = -50.565,
+},
+{ .is_ngc = TRUE,
+  .id = 7125,
+  .ra = 327.317,
+  .dec = -60.7119,
+},
+{ .is_ngc = TRUE,
+  .id = 7126,
+  .ra = 327.325,
+  .dec = -60.6089,
+},
+{ .is_ngc = TRUE,
+  .id = 7127,
+  .ra = 325.921,
+  .dec = 54.6189,
+},
+{ .is_ngc = TRUE,
+  .id = 7128,
+  .ra = 325.987,
+  .dec = 53.7025,
+},
+{ .is_ngc = TRUE,
+  .id = 7129,
+  .ra = 325.746,
+  .dec = 66.1022,
+},
+{ .is_ngc = TRUE,
+  .id = 7131,
+  .ra = 326.9,
+  .dec = -13.1826,
+},
+{ .is_ngc = TRUE,
+  .id = 7132,
+  .ra = 326.819,
+  .dec = 10.2412,
+},
+{ .is_ngc = TRUE,
+  .id = 7133,
+  .ra = 326.111,
+  .dec = 66.1683,
+},
+{ .is_ngc = TRUE,
+  .id = 7134,
+  .ra = 327.234,
+  .dec = -12.9717,
+},
+{ .is_ngc = TRUE,
+  .id = 7136,
+  .ra = 327.43,
+  .dec = -11.7933,
+},
+{ .is_ngc = TRUE,
+  .id = 7137,
+  .ra = 327.054,
+  .dec = 22.1597,
+},
+{ .is_ngc = TRUE,
+  .id = 7138,
+  .ra = 327.254,
+  .dec = 12.5136,
+},
+{ .is_ngc = TRUE,
+  .id = 7139,
+  .ra = 326.536,
+  .dec = 63.7917,
+},
+{ .is_ngc = TRUE,
+  .id = 7142,
+  .ra = 326.288,
+  .dec = 65.7681,
+},
+{ .is_ngc = TRUE,
+  .id = 7143,
+  .ra = 327.224,
+  .dec = 29.9556,
+},
+{ .is_ngc = TRUE,
+  .id = 7144,
+  .ra = 328.177,
+  .dec = -48.2541,
+},
+{ .is_ngc = TRUE,
+  .id = 7145,
+  .ra = 328.335,
+  .dec = -47.8822,
+},
+{ .is_ngc = TRUE,
+  .id = 7146,
+  .ra = 327.948,
+  .dec = 3.01639,
+},
+{ .is_ngc = TRUE,
+  .id = 7147,
+  .ra = 327.993,
+  .dec = 3.07148,
+},
+{ .is_ngc = TRUE,
+  .id = 7148,
+  .ra = 328.035,
+  .dec = 3.34169,
+},
+{ .is_ngc = TRUE,
+  .id = 7149,
+  .ra = 328.049,
+  .dec = 3.30099,
+},
+{ .is_ngc = TRUE,
+  .id = 7150,
+  .ra = 327.598,
+  .dec = 49.7556,
+},
+{ .is_ngc = TRUE,
+  .id = 7151,
+  .ra = 328.766,
+  .dec = -50.6572,
+},
+{ .is_ngc = TRUE,
+  .id = 7152,
+  .ra = 328.495,
+  .dec = -29.2897,
+},
+{ .is_ngc = TRUE,
+  .id = 7153,
+  .ra = 328.647,
+  .dec = -29.0636,
+},
+{ .is_ngc = TRUE,
+  .id = 7154,
+  .ra = 328.838,
+  .dec = -34.8142,
+},
+{ .is_ngc = TRUE,
+  .id = 7156,
+  .ra = 328.64,
+  .dec = 2.94283,
+},
+{ .is_ngc = TRUE,
+  .id = 7157,
+  .ra = 329.235,
+  .dec = -25.3506,
+},
+{ .is_ngc = TRUE,
+  .id = 7158,
+  .ra = 329.367,
+  .dec = -11.5925,
+},
+{ .is_ngc = TRUE,
+  .id = 7159,
+  .ra = 329.107,
+  .dec = 13.5622,
+},
+{ .is_ngc = TRUE,
+  .id = 7160,
+  .ra = 328.417,
+  .dec = 62.6006,
+},
+{ .is_ngc = TRUE,
+  .id = 7161,
+  .ra = 329.241,
+  .dec = 2.91611,
+},
+{ .is_ngc = TRUE,
+  .id = 7162,
+  .ra = 329.912,
+  .dec = -43.3061,
+},
+{ .is_ngc = TRUE,
+  .id = 7163,
+  .ra = 329.834,
+  .dec = -31.8836,
+},
+{ .is_ngc = TRUE,
+  .id = 7164,
+  .ra = 329.099,
+  .dec = 1.36346,
+},
+{ .is_ngc = TRUE,
+  .id = 7165,
+  .ra = 329.859,
+  .dec = -16.5125,
+},
+{ .is_ngc = TRUE,
+  .id = 7166,
+  .ra = 330.136,
+  .dec = -43.3897,
+},
+{ .is_ngc = TRUE,
+  .id = 7167,
+  .ra = 330.127,
+  .dec = -24.6331,
+},
+{ .is_ngc = TRUE,
+  .id = 7168,
+  .ra = 330.53,
+  .dec = -51.7428,
+},
+{ .is_ngc = TRUE,
+  .id = 7169,
+  .ra = 330.702,
+  .dec = -47.6969,
+},
+{ .is_ngc = TRUE,
+  .id = 7170,
+  .ra = 330.36,
+  .dec = -5.4325,
+},
+{ .is_ngc = TRUE,
+  .id = 7171,
+  .ra = 330.258,
+  .dec = -13.2694,
+},
+{ .is_ngc = TRUE,
+  .id = 7172,
+  .ra = 330.508,
+  .dec = -31.8701,
+},
+{ .is_ngc = TRUE,
+  .id = 7173,
+  .ra = 330.513,
+  .dec = -31.9738,
+},
+{ .is_ngc = TRUE,
+  .id = 7174,
+  .ra = 330.527,
+  .dec = -31.9928,
+},
+{ .is_ngc = TRUE,
+  .id = 7175,
+  .ra = 329.695,
+  .dec = 54.8197,
+},
+{ .is_ngc = TRUE,
+  .id = 7176,
+  .ra = 330.536,
+  .dec = -31.9902,
+},
+{ .is_ngc = TRUE,
+  .id = 7177,
+  .ra = 330.172,
+  .dec = 17.7377,
+},
+{ .is_ngc = TRUE,
+  .id = 7178,
+  .ra = 330.604,
+  .dec = -35.7906,
+},
+{ .is_ngc = TRUE,
+  .id = 7179,
+  .ra = 331.205,
+  .dec = -64.0458,
+},
+{ .is_ngc = TRUE,
+  .id = 7180,
+  .ra = 330.577,
+  .dec = -20.5475,
+},
+{ .is_ngc = TRUE,
+  .id = 7181,
+  .ra = 330.431,
+  .dec = -1.96057,
+},
+{ .is_ngc = TRUE,
+  .id = 7182,
+  .ra = 330.465,
+  .dec = -2.19659,
+},
+{ .is_ngc = TRUE,
+  .id = 7183,
+  .ra = 330.59,
+  .dec = -18.9168,
+},
+{ .is_ngc = TRUE,
+  .id = 7184,
+  .ra = 330.666,
+  .dec = -20.8129,
+},
+{ .is_ngc = TRUE,
+  .id = 7185,
+  .ra = 330.736,
+  .dec = -20.4718,
+},
+{ .is_ngc = TRUE,
+  .id = 7186,
+  .ra = 330.271,
+  .dec = 35.0781,
+},
+{ .is_ngc = TRUE,
+  .id = 7187,
+  .ra = 330.683,
+  .dec = -32.8033,
+},
+{ .is_ngc = TRUE,
+  .id = 7188,
+  .ra = 330.871,
+  .dec = -20.3176,
+},
+{ .is_ngc = TRUE,
+  .id = 7189,
+  .ra = 330.816,
+  .dec = 0.571194,
+},
+{ .is_ngc = TRUE,
+  .id = 7190,
+  .ra = 330.778,
+  .dec = 11.1992,
+},
+{ .is_ngc = TRUE,
+  .id = 7191,
+  .ra = 331.715,
+  .dec = -64.6339,
+},
+{ .is_ngc = TRUE,
+  .id = 7192,
+  .ra = 331.709,
+  .dec = -64.3159,
+},
+{ .is_ngc = TRUE,
+  .id = 7193,
+  .ra = 330.766,
+  .dec = 10.8017,
+},
+{ .is_ngc = TRUE,
+  .id = 7194,
+  .ra = 330.879,
+  .dec = 12.6367,
+},
+{ .is_ngc = TRUE,
+  .id = 7195,
+  .ra = 330.876,
+  .dec = 12.6607,
+},
+{ .is_ngc = TRUE,
+  .id = 7196,
+  .ra = 331.478,
+  .dec = -50.1196,
+},
+{ .is_ngc = TRUE,
+  .id = 7197,
+  .ra = 330.742,
+  .dec = 41.0593,
+},
+{ .is_ngc = TRUE,
+  .id = 7198,
+  .ra = 331.309,
+  .dec = -0.648231,
+},
+{ .is_ngc = TRUE,
+  .id = 7199,
+  .ra = 332.123,
+  .dec = -64.7064,
+},
+{ .is_ngc = TRUE,
+  .id = 7200,
+  .ra = 331.789,
+  .dec = -49.9956,
+},
+{ .is_ngc = TRUE,
+  .id = 7201,
+  .ra = 331.634,
+  .dec = -31.2632,
+},
+{ .is_ngc = TRUE,
+  .id = 7202,
+  .ra = 331.68,
+  .dec = -31.2185,
+},
+{ .is_ngc = TRUE,
+  .id = 7203,
+  .ra = 331.683,
+  .dec = -31.163,
+},
+{ .is_ngc = TRUE,
+  .id = 7204,
+  .ra = 331.725,
+  .dec = -31.05,
+},
+{ .is_ngc = TRUE,
+  .id = 7205,
+  .ra = 332.139,
+  .dec = -57.4428,
+},
+{ .is_ngc = TRUE,
+  .id = 7206,
+  .ra = 331.421,
+  .dec = 16.785,
+},
+{ .is_ngc = TRUE,
+  .id = 7207,
+  .ra = 331.44,
+  .dec = 16.7675,
+},
+{ .is_ngc = TRUE,
+  .id = 7208,
+  .ra = 332.102,
+  .dec = -29.0514,
+},
+{ .is_ngc = TRUE,
+  .id = 7209,
+  .ra = 331.279,
+  .dec = 46.4833,
+},
+{ .is_ngc = TRUE,
+  .id = 7210,
+  .ra = 331.592,
+  .dec = 27.1017,
+},
+{ .is_ngc = TRUE,
+  .id = 7211,
+  .ra = 331.591,
+  .dec = -8.09017,
+},
+{ .is_ngc = TRUE,
+  .id = 7213,
+  .ra = 332.318,
+  .dec = -47.1666,
+},
+{ .is_ngc = TRUE,
+  .id = 7214,
+  .ra = 332.281,
+  .dec = -27.8097,
+},
+{ .is_ngc = TRUE,
+  .id = 7215,
+  .ra = 332.144,
+  .dec = 0.511389,
+},
+{ .is_ngc = TRUE,
+  .id = 7216,
+  .ra = 333.152,
+  .dec = -68.6614,
+},
+{ .is_ngc = TRUE,
+  .id = 7217,
+  .ra = 331.968,
+  .dec = 31.3591,
+},
+{ .is_ngc = TRUE,
+  .id = 7218,
+  .ra = 332.549,
+  .dec = -16.6607,
+},
+{ .is_ngc = TRUE,
+  .id = 7219,
+  .ra = 333.286,
+  .dec = -64.8481,
+},
+{ .is_ngc = TRUE,
+  .id = 7220,
+  .ra = 332.879,
+  .dec = -22.9531,
+},
+{ .is_ngc = TRUE,
+  .id = 7221,
+  .ra = 332.813,
+  .dec = -30.5634,
+},
+{ .is_ngc = TRUE,
+  .id = 7222,
+  .ra = 332.716,
+  .dec = 2.10557,
+},
+{ .is_ngc = TRUE,
+  .id = 7223,
+  .ra = 332.538,
+  .dec = 41.0166,
+},
+{ .is_ngc = TRUE,
+  .id = 7224,
+  .ra = 332.897,
+  .dec = 25.8644,
+},
+{ .is_ngc = TRUE,
+  .id = 7225,
+  .ra = 333.282,
+  .dec = -26.1478,
+},
+{ .is_ngc = TRUE,
+  .id = 7226,
+  .ra = 332.612,
+  .dec = 55.3983,
+},
+{ .is_ngc = TRUE,
+  .id = 7227,
+  .ra = 332.881,
+  .dec = 38.7211,
+},
+{ .is_ngc = TRUE,
+  .id = 7228,
+  .ra = 332.953,
+  .dec = 38.6985,
+},
+{ .is_ngc = TRUE,
+  .id = 7229,
+  .ra = 333.512,
+  .dec = -29.3833,
+},
+{ .is_ngc = TRUE,
+  .id = 7230,
+  .ra = 333.555,
+  .dec = -17.0747,
+},
+{ .is_ngc = TRUE,
+  .id = 7231,
+  .ra = 333.127,
+  .dec = 45.3286,
+},
+{ .is_ngc = TRUE,
+  .id = 7232,
+  .ra = 333.907,
+  .dec = -45.8506,
+},
+{ .is_ngc = TRUE,
+  .id = 7233,
+  .ra = 333.953,
+  .dec = -45.8469,
+},
+{ .is_ngc = TRUE,
+  .id = 7236,
+  .ra = 333.687,
+  .dec = 13.8464,
+},
+{ .is_ngc = TRUE,
+  .id = 7237,
+  .ra = 333.695,
+  .dec = 13.8407,
+},
+{ .is_ngc = TRUE,
+  .id = 7238,
+  .ra = 333.833,
+  .dec = 22.5172,
+},
+{ .is_ngc = TRUE,
+  .id = 7239,
+  .ra = 333.756,
+  .dec = -5.05307,
+},
+{ .is_ngc = TRUE,
+  .id = 7240,
+  .ra = 333.844,
+  .dec = 37.2811,
+},
+{ .is_ngc = TRUE,
+  .id = 7241,
+  .ra = 333.957,
+  .dec = 19.2311,
+},
+{ .is_ngc = TRUE,
+  .id = 7242,
+  .ra = 333.915,
+  .dec = 37.2988,
+},
+{ .is_ngc = TRUE,
+  .id = 7243,
+  .ra = 333.783,
+  .dec = 49.8858,
+},
+{ .is_ngc = TRUE,
+  .id = 7244,
+  .ra = 334.112,
+  .dec = 16.4708,
+},
+{ .is_ngc = TRUE,
+  .id = 7245,
+  .ra = 333.796,
+  .dec = 54.335,
+},
+{ .is_ngc = TRUE,
+  .id = 7247,
+  .ra = 334.42,
+  .dec = -23.7322,
+},
+{ .is_ngc = TRUE,
+  .id = 7248,
+  .ra = 334.219,
+  .dec = 40.5045,
+},
+{ .is_ngc = TRUE,
+  .id = 7249,
+  .ra = 335.129,
+  .dec = -55.1253,
+},
+{ .is_ngc = TRUE,
+  .id = 7250,
+  .ra = 334.574,
+  .dec = 40.5629,
+},
+{ .is_ngc = TRUE,
+  .id = 7251,
+  .ra = 335.113,
+  .dec = -15.7736,
+},
+{ .is_ngc = TRUE,
+  .id = 7252,
+  .ra = 335.187,
+  .dec = -24.6784,
+},
+{ .is_ngc = TRUE,
+  .id = 7255,
+  .ra = 335.784,
+  .dec = -15.5416,
+},
+{ .is_ngc = TRUE,
+  .id = 7258,
+  .ra = 335.742,
+  .dec = -28.3453,
+},
+{ .is_ngc = TRUE,
+  .id = 7259,
+  .ra = 335.773,
+  .dec = -28.9547,
+},
+{ .is_ngc = TRUE,
+  .id = 7261,
+  .ra = 335.004,
+  .dec = 58.05,
+},
+{ .is_ngc = TRUE,
+  .id = 7262,
+  .ra = 335.868,
+  .dec = -32.3642,
+},
+{ .is_ngc = TRUE,
+  .id = 7263,
+  .ra = 335.438,
+  .dec = 36.3495,
+},
+{ .is_ngc = TRUE,
+  .id = 7264,
+  .ra = 335.557,
+  .dec = 36.3868,
+},
+{ .is_ngc = TRUE,
+  .id = 7265,
+  .ra = 335.614,
+  .dec = 36.2098,
+},
+{ .is_ngc = TRUE,
+  .id = 7266,
+  .ra = 335.996,
+  .dec = -4.07333,
+},
+{ .is_ngc = TRUE,
+  .id = 7267,
+  .ra = 336.091,
+  .dec = -33.6936,
+},
+{ .is_ngc = TRUE,
+  .id = 7268,
+  .ra = 336.419,
+  .dec = -31.2013,
+},
+{ .is_ngc = TRUE,
+  .id = 7269,
+  .ra = 336.445,
+  .dec = -13.1669,
+},
+{ .is_ngc = TRUE,
+  .id = 7270,
+  .ra = 335.949,
+  .dec = 32.403,
+},
+{ .is_ngc = TRUE,
+  .id = 7271,
+  .ra = 335.99,
+  .dec = 32.3672,
+},
+{ .is_ngc = TRUE,
+  .id = 7272,
+  .ra = 336.132,
+  .dec = 16.5881,
+},
+{ .is_ngc = TRUE,
+  .id = 7273,
+  .ra = 336.038,
+  .dec = 36.1997,
+},
+{ .is_ngc = TRUE,
+  .id = 7274,
+  .ra = 336.046,
+  .dec = 36.1258,
+},
+{ .is_ngc = TRUE,
+  .id = 7275,
+  .ra = 336.072,
+  .dec = 32.4465,
+},
+{ .is_ngc = TRUE,
+  .id = 7276,
+  .ra = 336.06,
+  .dec = 36.0876,
+},
+{ .is_ngc = TRUE,
+  .id = 7277,
+  .ra = 336.546,
+  .dec = -31.1464,
+},
+{ .is_ngc = TRUE,
+  .id = 7278,
+  .ra = 337.095,
+  .dec = -60.1694,
+},
+{ .is_ngc = TRUE,
+  .id = 7279,
+  .ra = 336.802,
+  .dec = -35.14,
+},
+{ .is_ngc = TRUE,
+  .id = 7280,
+  .ra = 336.615,
+  .dec = 16.1482,
+},
+{ .is_ngc = TRUE,
+  .id = 7281,
+  .ra = 336.262,
+  .dec = 57.8167,
+},
+{ .is_ngc = TRUE,
+  .id = 7282,
+  .ra = 336.475,
+  .dec = 40.3151,
+},
+{ .is_ngc = TRUE,
+  .id = 7283,
+  .ra = 337.136,
+  .dec = 17.4703,
+},
+{ .is_ngc = TRUE,
+  .id = 7284,
+  .ra = 337.15,
+  .dec = -24.8444,
+},
+{ .is_ngc = TRUE,
+  .id = 7285,
+  .ra = 337.158,
+  .dec = -24.8408,
+},
+{ .is_ngc = TRUE,
+  .id = 7286,
+  .ra = 336.961,
+  .dec = 29.0956,
+},
+{ .is_ngc = TRUE,
+  .id = 7287,
+  .ra = 337.133,
+  .dec = -22.1342,
+},
+{ .is_ngc = TRUE,
+  .id = 7287,
+  .ra = 336.821,
+  .dec = -22.1167,
+},
+{ .is_ngc = TRUE,
+  .id = 7288,
+  .ra = 337.062,
+  .dec = -2.88417,
+},
+{ .is_ngc = TRUE,
+  .id = 7289,
+  .ra = 337.335,
+  .dec = -35.4719,
+},
+{ .is_ngc = TRUE,
+  .id = 7290,
+  .ra = 337.11,
+  .dec = 17.1476,
+},
+{ .is_ngc = TRUE,
+  .id = 7291,
+  .ra = 337.123,
+  .dec = 16.783,
+},
+{ .is_ngc = TRUE,
+  .id = 7292,
+  .ra = 337.108,
+  .dec = 30.292,
+},
+{ .is_ngc = TRUE,
+  .id = 7293,
+  .ra = 337.41,
+  .dec = -20.837,
+},
+{ .is_ngc = TRUE,
+  .id = 7297,
+  .ra = 337.792,
+  .dec = -37.8267,
+},
+{ .is_ngc = TRUE,
+  .id = 7298,
+  .ra = 337.711,
+  .dec = -14.1886,
+},
+{ .is_ngc = TRUE,
+  .id = 7299,
+  .ra = 337.887,
+  .dec = -37.8097,
+},
+{ .is_ngc = TRUE,
+  .id = 7301,
+  .ra = 337.645,
+  .dec = -17.5739,
+},
+{ .is_ngc = TRUE,
+  .id = 7303,
+  .ra = 337.887,
+  .dec = 30.9561,
+},
+{ .is_ngc = TRUE,
+  .id = 7305,
+  .ra = 338.058,
+  .dec = 11.712,
+},
+{ .is_ngc = TRUE,
+  .id = 7306,
+  .ra = 338.319,
+  .dec = -27.2464,
+},
+{ .is_ngc = TRUE,
+  .id = 7307,
+  .ra = 338.469,
+  .dec = -40.9339,
+},
+{ .is_ngc = TRUE,
+  .id = 7309,
+  .ra = 338.585,
+  .dec = -10.3569,
+},
+{ .is_ngc = TRUE,
+  .id = 7310,
+  .ra = 338.654,
+  .dec = -22.485,
+},
+{ .is_ngc = TRUE,
+  .id = 7311,
+  .ra = 338.528,
+  .dec = 5.56983,
+},
+{ .is_ngc = TRUE,
+  .id = 7312,
+  .ra = 338.645,
+  .dec = 5.817,
+},
+{ .is_ngc = TRUE,
+  .id = 7313,
+  .ra = 338.885,
+  .dec = -26.1019,
+},
+{ .is_ngc = TRUE,
+  .id = 7314,
+  .ra = 338.941,
+  .dec = -26.0503,
+},
+{ .is_ngc = TRUE,
+  .id = 7315,
+  .ra = 338.882,
+  .dec = 34.8033,
+},
+{ .is_ngc = TRUE,
+  .id = 7316,
+  .ra = 338.985,
+  .dec = 20.3222,
+},
+{ .is_ngc = TRUE,
+  .id = 7317,
+  .ra = 338.966,
+  .dec = 33.9448,
+},
+{ .is_ngc = TRUE,
+  .id = 7319,
+  .ra = 339.015,
+  .dec = 33.9757,
+},
+{ .is_ngc = TRUE,
+  .id = 7320,
+  .ra = 339.015,
+  .dec = 33.9483,
+},
+{ .is_ngc = TRUE,
+  .id = 7321,
+  .ra = 339.117,
+  .dec = 21.6212,
+},
+{ .is_ngc = TRUE,
+  .id = 7323,
+  .ra = 339.223,
+  .dec = 19.1437,
+},
+{ .is_ngc = TRUE,
+  .id = 7324,
+  .ra = 339.254,
+  .dec = 19.1458,
+},
+{ .is_ngc = TRUE,
+  .id = 7325,
+  .ra = 339.202,
+  .dec = 34.368,
+},
+{ .is_ngc = TRUE,
+  .id = 7326,
+  .ra = 339.217,
+  .dec = 34.4228,
+},
+{ .is_ngc = TRUE,
+  .id = 7327,
+  .ra = 339.14,
+  .dec = 34.5019,
+},
+{ .is_ngc = TRUE,
+  .id = 7328,
+  .ra = 339.372,
+  .dec = 10.5317,
+},
+{ .is_ngc = TRUE,
+  .id = 7329,
+  .ra = 340.101,
+  .dec = -66.479,
+},
+{ .is_ngc = TRUE,
+  .id = 7330,
+  .ra = 339.235,
+  .dec = 38.5477,
+},
+{ .is_ngc = TRUE,
+  .id = 7331,
+  .ra = 339.267,
+  .dec = 34.4159,
+},
+{ .is_ngc = TRUE,
+  .id = 7332,
+  .ra = 339.352,
+  .dec = 23.7983,
+},
+{ .is_ngc = TRUE,
+  .id = 7333,
+  .ra = 339.299,
+  .dec = 34.4373,
+},
+{ .is_ngc = TRUE,
+  .id = 7335,
+  .ra = 339.331,
+  .dec = 34.4477,
+},
+{ .is_ngc = TRUE,
+  .id = 7336,
+  .ra = 339.341,
+  .dec = 34.4817,
+},
+{ .is_ngc = TRUE,
+  .id = 7337,
+  .ra = 339.361,
+  .dec = 34.374,
+},
+{ .is_ngc = TRUE,
+  .id = 7338,
+  .ra = 339.38,
+  .dec = 34.4144,
+},
+{ .is_ngc = TRUE,
+  .id = 7339,
+  .ra = 339.446,
+  .dec = 23.7864,
+},
+{ .is_ngc = TRUE,
+  .id = 7340,
+  .ra = 339.434,
+  .dec = 34.41,
+},
+{ .is_ngc = TRUE,
+  .id = 7341,
+  .ra = 339.773,
+  .dec = -22.6664,
+},
+{ .is_ngc = TRUE,
+  .id = 7342,
+  .ra = 339.555,
+  .dec = 35.4985,
+},
+{ .is_ngc = TRUE,
+  .id = 7343,
+  .ra = 339.658,
+  .dec = 34.0713,
+},
+{ .is_ngc = TRUE,
+  .id = 7344,
+  .ra = 339.901,
+  .dec = -4.15917,
+},
+{ .is_ngc = TRUE,
+  .id = 7345,
+  .ra = 339.687,
+  .dec = 35.5404,
+},
+{ .is_ngc = TRUE,
+  .id = 7346,
+  .ra = 339.898,
+  .dec = 11.0832,
+},
+{ .is_ngc = TRUE,
+  .id = 7347,
+  .ra = 339.984,
+  .dec = 11.0275,
+},
+{ .is_ngc = TRUE,
+  .id = 7348,
+  .ra = 340.151,
+  .dec = 11.906,
+},
+{ .is_ngc = TRUE,
+  .id = 7349,
+  .ra = 340.31,
+  .dec = -21.7969,
+},
+{ .is_ngc = TRUE,
+  .id = 7350,
+  .ra = 340.202,
+  .dec = 12.0065,
+},
+{ .is_ngc = TRUE,
+  .id = 7351,
+  .ra = 340.362,
+  .dec = -4.44472,
+},
+{ .is_ngc = TRUE,
+  .id = 7352,
+  .ra = 339.929,
+  .dec = 57.3853,
+},
+{ .is_ngc = TRUE,
+  .id = 7353,
+  .ra = 340.552,
+  .dec = 11.8774,
+},
+{ .is_ngc = TRUE,
+  .id = 7354,
+  .ra = 340.083,
+  .dec = 61.2854,
+},
+{ .is_ngc = TRUE,
+  .id = 7355,
+  .ra = 340.877,
+  .dec = -36.8652,
+},
+{ .is_ngc = TRUE,
+  .id = 7356,
+  .ra = 340.51,
+  .dec = 30.7086,
+},
+{ .is_ngc = TRUE,
+  .id = 7357,
+  .ra = 340.6,
+  .dec = 30.1714,
+},
+{ .is_ngc = TRUE,
+  .id = 7358,
+  .ra = 341.401,
+  .dec = -65.1208,
+},
+{ .is_ngc = TRUE,
+  .id = 7359,
+  .ra = 341.198,
+  .dec = -23.6875,
+},
+{ .is_ngc = TRUE,
+  .id = 7360,
+  .ra = 340.892,
+  .dec = 4.15153,
+},
+{ .is_ngc = TRUE,
+  .id = 7362,
+  .ra = 340.955,
+  .dec = 8.70525,
+},
+{ .is_ngc = TRUE,
+  .id = 7363,
+  .ra = 340.827,
+  .dec = 33.9989,
+},
+{ .is_ngc = TRUE,
+  .id = 7364,
+  .ra = 341.101,
+  .dec = -0.162139,
+},
+{ .is_ngc = TRUE,
+  .id = 7365,
+  .ra = 341.292,
+  .dec = -19.9519,
+},
+{ .is_ngc = TRUE,
+  .id = 7366,
+  .ra = 341.112,
+  .dec = 10.7814,
+},
+{ .is_ngc = TRUE,
+  .id = 7367,
+  .ra = 341.144,
+  .dec = 3.64586,
+},
+{ .is_ngc = TRUE,
+  .id = 7368,
+  .ra = 341.382,
+  .dec = -39.3422,
+},
+{ .is_ngc = TRUE,
+  .id = 7369,
+  .ra = 341.051,
+  .dec = 34.3511,
+},
+{ .is_ngc = TRUE,
+  .id = 7370,
+  .ra = 341.405,
+  .dec = 11.0574,
+},
+{ .is_ngc = TRUE,
+  .id = 7371,
+  .ra = 341.516,
+  .dec = -11.0013,
+},
+{ .is_ngc = TRUE,
+  .id = 7372,
+  .ra = 341.441,
+  .dec = 11.1306,
+},
+{ .is_ngc = TRUE,
+  .id = 7373,
+  .ra = 341.581,
+  .dec = 3.20917,
+},
+{ .is_ngc = TRUE,
+  .id = 7375,
+  .ra = 341.634,
+  .dec = 21.0834,
+},
+{ .is_ngc = TRUE,
+  .id = 7376,
+  .ra = 341.823,
+  .dec = 3.64525,
+},
+{ .is_ngc = TRUE,
+  .id = 7377,
+  .ra = 341.948,
+  .dec = -22.3119,
+},
+{ .is_ngc = TRUE,
+  .id = 7378,
+  .ra = 341.948,
+  .dec = -11.8171,
+},
+{ .is_ngc = TRUE,
+  .id = 7379,
+  .ra = 341.888,
+  .dec = 40.2386,
+},
+{ .is_ngc = TRUE,
+  .id = 7380,
+  .ra = 341.837,
+  .dec = 58.1192,
+},
+{ .is_ngc = TRUE,
+  .id = 7381,
+  .ra = 342.534,
+  .dec = -19.7243,
+},
+{ .is_ngc = TRUE,
+  .id = 7382,
+  .ra = 342.598,
+  .dec = -36.8558,
+},
+{ .is_ngc = TRUE,
+  .id = 7383,
+  .ra = 342.399,
+  .dec = 11.5564,
+},
+{ .is_ngc = TRUE,
+  .id = 7384,
+  .ra = 342.427,
+  .dec = 11.4872,
+},
+{ .is_ngc = TRUE,
+  .id = 7385,
+  .ra = 342.478,
+  .dec = 11.6084,
+},
+{ .is_ngc = TRUE,
+  .id = 7386,
+  .ra = 342.509,
+  .dec = 11.6983,
+},
+{ .is_ngc = TRUE,
+  .id = 7387,
+  .ra = 342.574,
+  .dec = 11.6368,
+},
+{ .is_ngc = TRUE,
+  .id = 7388,
+  .ra = 342.588,
+  .dec = 11.7109,
+},
+{ .is_ngc = TRUE,
+  .id = 7389,
+  .ra = 342.567,
+  .dec = 11.566,
+},
+{ .is_ngc = TRUE,
+  .id = 7390,
+  .ra = 342.581,
+  .dec = 11.5308,
+},
+{ .is_ngc = TRUE,
+  .id = 7391,
+  .ra = 342.65,
+  .dec = -1.5445,
+},
+{ .is_ngc = TRUE,
+  .id = 7392,
+  .ra = 342.953,
+  .dec = -20.6072,
+},
+{ .is_ngc = TRUE,
+  .id = 7393,
+  .ra = 342.909,
+  .dec = -5.55736,
+},
+{ .is_ngc = TRUE,
+  .id = 7394,
+  .ra = 342.549,
+  .dec = 52.1678,
+},
+{ .is_ngc = TRUE,
+  .id = 7395,
+  .ra = 342.762,
+  .dec = 37.0878,
+},
+{ .is_ngc = TRUE,
+  .id = 7396,
+  .ra = 343.094,
+  .dec = 1.09236,
+},
+{ .is_ngc = TRUE,
+  .id = 7397,
+  .ra = 343.194,
+  .dec = 1.13244,
+},
+{ .is_ngc = TRUE,
+  .id = 7398,
+  .ra = 343.205,
+  .dec = 1.20105,
+},
+{ .is_ngc = TRUE,
+  .id = 7399,
+  .ra = 343.164,
+  .dec = -9.26778,
+},
+{ .is_ngc = TRUE,
+  .id = 7400,
+  .ra = 343.586,
+  .dec = -45.3469,
+},
+{ .is_ngc = TRUE,
+  .id = 7401,
+  .ra = 343.244,
+  .dec = 1.14222,
+},
+{ .is_ngc = TRUE,
+  .id = 7402,
+  .ra = 343.269,
+  .dec = 1.14428,
+},
+{ .is_ngc = TRUE,
+  .id = 7403,
+  .ra = 343.276,
+  .dec = 1.48208,
+},
+{ .is_ngc = TRUE,
+  .id = 7405,
+  .ra = 343.4,
+  .dec = 12.4683,
+},
+{ .is_ngc = TRUE,
+  .id = 7405,
+  .ra = 343.238,
+  .dec = 12.5936,
+},
+{ .is_ngc = TRUE,
+  .id = 7406,
+  .ra = 343.485,
+  .dec = -6.57944,
+},
+{ .is_ngc = TRUE,
+  .id = 7407,
+  .ra = 343.338,
+  .dec = 32.129,
+},
+{ .is_ngc = TRUE,
+  .id = 7408,
+  .ra = 343.986,
+  .dec = -63.6947,
+},
+{ .is_ngc = TRUE,
+  .id = 7409,
+  .ra = 343.451,
+  .dec = 20.2104,
+},
+{ .is_ngc = TRUE,
+  .id = 7410,
+  .ra = 343.753,
+  .dec = -39.6618,
+},
+{ .is_ngc = TRUE,
+  .id = 7411,
+  .ra = 343.646,
+  .dec = 20.2362,
+},
+{ .is_ngc = TRUE,
+  .id = 7412,
+  .ra = 343.94,
+  .dec = -42.6417,
+},
+{ .is_ngc = TRUE,
+  .id = 7413,
+  .ra = 343.763,
+  .dec = 13.2205,
+},
+{ .is_ngc = TRUE,
+  .id = 7414,
+  .ra = 343.852,
+  .dec = 13.2483,
+},
+{ .is_ngc = TRUE,
+  .id = 7416,
+  .ra = 343.924,
+  .dec = -5.49522,
+},
+{ .is_ngc = TRUE,
+  .id = 7417,
+  .ra = 344.455,
+  .dec = -65.0382,
+},
+{ .is_ngc = TRUE,
+  .id = 7418,
+  .ra = 344.15,
+  .dec = -37.0303,
+},
+{ .is_ngc = TRUE,
+  .id = 7419,
+  .ra = 343.584,
+  .dec = 60.8153,
+},
+{ .is_ngc = TRUE,
+  .id = 7420,
+  .ra = 343.883,
+  .dec = 29.805,
+},
+{ .is_ngc = TRUE,
+  .id = 7421,
+  .ra = 344.225,
+  .dec = -37.3481,
+},
+{ .is_ngc = TRUE,
+  .id = 7422,
+  .ra = 344.052,
+  .dec = 3.92644,
+},
+{ .is_ngc = TRUE,
+  .id = 7423,
+  .ra = 343.785,
+  .dec = 57.0967,
+},
+{ .is_ngc = TRUE,
+  .id = 7424,
+  .ra = 344.327,
+  .dec = -41.071,
+},
+{ .is_ngc = TRUE,
+  .id = 7425,
+  .ra = 344.315,
+  .dec = -10.9502,
+},
+{ .is_ngc = TRUE,
+  .id = 7426,
+  .ra = 344.012,
+  .dec = 36.3612,
+},
+{ .is_ngc = TRUE,
+  .id = 7427,
+  .ra = 344.291,
+  .dec = 8.50564,
+},
+{ .is_ngc = TRUE,
+  .id = 7428,
+  .ra = 344.331,
+  .dec = -1.04914,
+},
+{ .is_ngc = TRUE,
+  .id = 7429,
+  .ra = 344,
+  .dec = 59.9678,
+},
+{ .is_ngc = TRUE,
+  .id = 7430,
+  .ra = 344.374,
+  .dec = 8.79381,
+},
+{ .is_ngc = TRUE,
+  .id = 7432,
+  .ra = 344.508,
+  .dec = 13.1342,
+},
+{ .is_ngc = TRUE,
+  .id = 7433,
+  .ra = 344.465,
+  .dec = 26.1618,
+},
+{ .is_ngc = TRUE,
+  .id = 7434,
+  .ra = 344.589,
+  .dec = -1.18423,
+},
+{ .is_ngc = TRUE,
+  .id = 7435,
+  .ra = 344.477,
+  .dec = 26.1385,
+},
+{ .is_ngc = TRUE,
+  .id = 7437,
+  .ra = 344.542,
+  .dec = 14.3086,
+},
+{ .is_ngc = TRUE,
+  .id = 7438,
+  .ra = 344.333,
+  .dec = 54.3017,
+},
+{ .is_ngc = TRUE,
+  .id = 7439,
+  .ra = 344.542,
+  .dec = 29.2283,
+},
+{ .is_ngc = TRUE,
+  .id = 7440,
+  .ra = 344.636,
+  .dec = 35.8024,
+},
+{ .is_ngc = TRUE,
+  .id = 7441,
+  .ra = 344.871,
+  .dec = -7.05487,
+},
+{ .is_ngc = TRUE,
+  .id = 7442,
+  .ra = 344.861,
+  .dec = 15.5486,
+},
+{ .is_ngc = TRUE,
+  .id = 7443,
+  .ra = 345.037,
+  .dec = -12.8075,
+},
+{ .is_ngc = TRUE,
+  .id = 7444,
+  .ra = 345.037,
+  .dec = -12.8339,
+},
+{ .is_ngc = TRUE,
+  .id = 7445,
+  .ra = 344.843,
+  .dec = 39.1075,
+},
+{ .is_ngc = TRUE,
+  .id = 7446,
+  .ra = 344.871,
+  .dec = 39.0828,
+},
+{ .is_ngc = TRUE,
+  .id = 7447,
+  .ra = 345.108,
+  .dec = -10.5186,
+},
+{ .is_ngc = TRUE,
+  .id = 7448,
+  .ra = 345.015,
+  .dec = 15.9802,
+},
+{ .is_ngc = TRUE,
+  .id = 7449,
+  .ra = 344.907,
+  .dec = 39.1455,
+},
+{ .is_ngc = TRUE,
+  .id = 7450,
+  .ra = 345.199,
+  .dec = -12.9185,
+},
+{ .is_ngc = TRUE,
+  .id = 7451,
+  .ra = 345.17,
+  .dec = 8.46722,
+},
+{ .is_ngc = TRUE,
+  .id = 7452,
+  .ra = 345.198,
+  .dec = 6.74559,
+},
+{ .is_ngc = TRUE,
+  .id = 7453,
+  .ra = 345.356,
+  .dec = -6.35544,
+},
+{ .is_ngc = TRUE,
+  .id = 7454,
+  .ra = 345.277,
+  .dec = 16.389,
+},
+{ .is_ngc = TRUE,
+  .id = 7455,
+  .ra = 345.171,
+  .dec = 7.30311,
+},
+{ .is_ngc = TRUE,
+  .id = 7456,
+  .ra = 345.542,
+  .dec = -39.5695,
+},
+{ .is_ngc = TRUE,
+  .id = 7457,
+  .ra = 345.25,
+  .dec = 30.1446,
+},
+{ .is_ngc = TRUE,
+  .id = 7458,
+  .ra = 345.369,
+  .dec = 1.75325,
+},
+{ .is_ngc = TRUE,
+  .id = 7459,
+  .ra = 345.25,
+  .dec = 6.74889,
+},
+{ .is_ngc = TRUE,
+  .id = 7460,
+  .ra = 345.429,
+  .dec = 2.26344,
+},
+{ .is_ngc = TRUE,
+  .id = 7461,
+  .ra = 345.451,
+  .dec = 15.5827,
+},
+{ .is_ngc = TRUE,
+  .id = 7462,
+  .ra = 345.694,
+  .dec = -40.8349,
+},
+{ .is_ngc = TRUE,
+  .id = 7463,
+  .ra = 345.466,
+  .dec = 15.9819,
+},
+{ .is_ngc = TRUE,
+  .id = 7464,
+  .ra = 345.474,
+  .dec = 15.9737,
+},
+{ .is_ngc = TRUE,
+  .id = 7465,
+  .ra = 345.504,
+  .dec = 15.9651,
+},
+{ .is_ngc = TRUE,
+  .id = 7466,
+  .ra = 345.514,
+  .dec = 27.0525,
+},
+{ .is_ngc = TRUE,
+  .id = 7467,
+  .ra = 345.615,
+  .dec = 15.5539,
+},
+{ .is_ngc = TRUE,
+  .id = 7468,
+  .ra = 345.746,
+  .dec = 16.6042,
+},
+{ .is_ngc = TRUE,
+  .id = 7469,
+  .ra = 345.815,
+  .dec = 8.8739,
+},
+{ .is_ngc = TRUE,
+  .id = 7470,
+  .ra = 346.307,
+  .dec = -50.1117,
+},
+{ .is_ngc = TRUE,
+  .id = 7471,
+  .ra = 345.971,
+  .dec = -22.9011,
+},
+{ .is_ngc = TRUE,
+  .id = 7473,
+  .ra = 345.988,
+  .dec = 30.1599,
+},
+{ .is_ngc = TRUE,
+  .id = 7474,
+  .ra = 346.018,
+  .dec = 20.0669,
+},
+{ .is_ngc = TRUE,
+  .id = 7476,
+  .ra = 346.3,
+  .dec = -43.0982,
+},
+{ .is_ngc = TRUE,
+  .id = 7477,
+  .ra = 346.17,
+  .dec = 3.12,
+},
+{ .is_ngc = TRUE,
+  .id = 7478,
+  .ra = 346.235,
+  .dec = 2.57733,
+},
+{ .is_ngc = TRUE,
+  .id = 7479,
+  .ra = 346.236,
+  .dec = 12.3223,
+},
+{ .is_ngc = TRUE,
+  .id = 7481,
+  .ra = 346.462,
+  .dec = -19.9344,
+},
+{ .is_ngc = TRUE,
+  .id = 7483,
+  .ra = 346.451,
+  .dec = 3.54467,
+},
+{ .is_ngc = TRUE,
+  .id = 7484,
+  .ra = 346.769,
+  .dec = -36.2736,
+},
+{ .is_ngc = TRUE,
+  .id = 7485,
+  .ra = 346.52,
+  .dec = 34.1079,
+},
+{ .is_ngc = TRUE,
+  .id = 7486,
+  .ra = 346.554,
+  .dec = 34.1014,
+},
+{ .is_ngc = TRUE,
+  .id = 7487,
+  .ra = 346.711,
+  .dec = 28.1789,
+},
+{ .is_ngc = TRUE,
+  .id = 7488,
+  .ra = 346.954,
+  .dec = 0.940422,
+},
+{ .is_ngc = TRUE,
+  .id = 7489,
+  .ra = 346.886,
+  .dec = 22.9976,
+},
+{ .is_ngc = TRUE,
+  .id = 7490,
+  .ra = 346.855,
+  .dec = 32.3752,
+},
+{ .is_ngc = TRUE,
+  .id = 7491,
+  .ra = 347.025,
+  .dec = -5.96694,
+},
+{ .is_ngc = TRUE,
+  .id = 7492,
+  .ra = 347.111,
+  .dec = -15.6115,
+},
+{ .is_ngc = TRUE,
+  .id = 7493,
+  .ra = 347.132,
+  .dec = 0.909972,
+},
+{ .is_ngc = TRUE,
+  .id = 7494,
+  .ra = 347.244,
+  .dec = -24.3692,
+},
+{ .is_ngc = TRUE,
+  .id = 7495,
+  .ra = 347.239,
+  .dec = 12.0476,
+},
+{ .is_ngc = TRUE,
+  .id = 7496,
+  .ra = 347.445,
+  .dec = -43.4278,
+},
+{ .is_ngc = TRUE,
+  .id = 7497,
+  .ra = 347.265,
+  .dec = 18.1768,
+},
+{ .is_ngc = TRUE,
+  .id = 7498,
+  .ra = 347.482,
+  .dec = -24.425,
+},
+{ .is_ngc = TRUE,
+  .id = 7499,
+  .ra = 347.593,
+  .dec = 7.58087,
+},
+{ .is_ngc = TRUE,
+  .id = 7500,
+  .ra = 347.624,
+  .dec = 11.0122,
+},
+{ .is_ngc = TRUE,
+  .id = 7501,
+  .ra = 347.627,
+  .dec = 7.58902,
+},
+{ .is_ngc = TRUE,
+  .id = 7502,
+  .ra = 347.582,
+  .dec = -21.7369,
+},
+{ .is_ngc = TRUE,
+  .id = 7503,
+  .ra = 347.676,
+  .dec = 7.56769,
+},
+{ .is_ngc = TRUE,
+  .id = 7504,
+  .ra = 347.671,
+  .dec = 14.3858,
+},
+{ .is_ngc = TRUE,
+  .id = 7505,
+  .ra = 347.753,
+  .dec = 13.6308,
+},
+{ .is_ngc = TRUE,
+  .id = 7506,
+  .ra = 347.921,
+  .dec = -2.15992,
+},
+{ .is_ngc = TRUE,
+  .id = 7507,
+  .ra = 348.032,
+  .dec = -28.54,
+},
+{ .is_ngc = TRUE,
+  .id = 7508,
+  .ra = 347.955,
+  .dec = 12.9403,
+},
+{ .is_ngc = TRUE,
+  .id = 7509,
+  .ra = 348.09,
+  .dec = 14.6091,
+},
+{ .is_ngc = TRUE,
+  .id = 7510,
+  .ra = 347.766,
+  .dec = 60.5708,
+},
+{ .is_ngc = TRUE,
+  .id = 7511,
+  .ra = 348.11,
+  .dec = 13.7263,
+},
+{ .is_ngc = TRUE,
+  .id = 7512,
+  .ra = 348.087,
+  .dec = 31.1257,
+},
+{ .is_ngc = TRUE,
+  .id = 7513,
+  .ra = 348.307,
+  .dec = -28.3583,
+},
+{ .is_ngc = TRUE,
+  .id = 7514,
+  .ra = 348.107,
+  .dec = 34.8812,
+},
+{ .is_ngc = TRUE,
+  .id = 7515,
+  .ra = 348.203,
+  .dec = 12.6795,
+},
+{ .is_ngc = TRUE,
+  .id = 7516,
+  .ra = 348.216,
+  .dec = 20.2483,
+},
+{ .is_ngc = TRUE,
+  .id = 7517,
+  .ra = 348.308,
+  .dec = -2.10064,
+},
+{ .is_ngc = TRUE,
+  .id = 7518,
+  .ra = 348.303,
+  .dec = 6.3215,
+},
+{ .is_ngc = TRUE,
+  .id = 7519,
+  .ra = 348.297,
+  .dec = 10.7719,
+},
+{ .is_ngc = TRUE,
+  .id = 7521,
+  .ra = 348.397,
+  .dec = -1.73111,
+},
+{ .is_ngc = TRUE,
+  .id = 7522,
+  .ra = 348.902,
+  .dec = -22.8947,
+},
+{ .is_ngc = TRUE,
+  .id = 7523,
+  .ra = 348.394,
+  .dec = 13.9863,
+},
+{ .is_ngc = TRUE,
+  .id = 7524,
+  .ra = 348.444,
+  .dec = -1.73078,
+},
+{ .is_ngc = TRUE,
+  .id = 7525,
+  .ra = 348.419,
+  .dec = 14.0213,
+},
+{ .is_ngc = TRUE,
+  .id = 7526,
+  .ra = 348.51,
+  .dec = -9.22139,
+},
+{ .is_ngc = TRUE,
+  .id = 7527,
+  .ra = 348.424,
+  .dec = 24.9022,
+},
+{ .is_ngc = TRUE,
+  .id = 7528,
+  .ra = 348.584,
+  .dec = 10.2313,
+},
+{ .is_ngc = TRUE,
+  .id = 7529,
+  .ra = 348.513,
+  .dec = 8.99208,
+},
+{ .is_ngc = TRUE,
+  .id = 7530,
+  .ra = 348.549,
+  .dec = -2.77951,
+},
+{ .is_ngc = TRUE,
+  .id = 7531,
+  .ra = 348.702,
+  .dec = -43.5996,
+},
+{ .is_ngc = TRUE,
+  .id = 7532,
+  .ra = 348.593,
+  .dec = -2.72797,
+},
+{ .is_ngc = TRUE,
+  .id = 7533,
+  .ra = 348.592,
+  .dec = -2.03404,
+},
+{ .is_ngc = TRUE,
+  .id = 7534,
+  .ra = 348.611,
+  .dec = -2.69919,
+},
+{ .is_ngc = TRUE,
+  .id = 7535,
+  .ra = 348.553,
+  .dec = 13.5818,
+},
+{ .is_ngc = TRUE,
+  .id = 7536,
+  .ra = 348.555,
+  .dec = 13.4259,
+},
+{ .is_ngc = TRUE,
+  .id = 7537,
+  .ra = 348.644,
+  .dec = 4.49828,
+},
+{ .is_ngc = TRUE,
+  .id = 7538,
+  .ra = 348.408,
+  .dec = 61.5019,
+},
+{ .is_ngc = TRUE,
+  .id = 7539,
+  .ra = 348.622,
+  .dec = 23.6848,
+},
+{ .is_ngc = TRUE,
+  .id = 7540,
+  .ra = 348.65,
+  .dec = 15.9504,
+},
+{ .is_ngc = TRUE,
+  .id = 7542,
+  .ra = 348.674,
+  .dec = 10.6431,
+},
+{ .is_ngc = TRUE,
+  .id = 7543,
+  .ra = 348.644,
+  .dec = 28.3272,
+},
+{ .is_ngc = TRUE,
+  .id = 7544,
+  .ra = 348.737,
+  .dec = -2.1995,
+},
+{ .is_ngc = TRUE,
+  .id = 7545,
+  .ra = 348.885,
+  .dec = -38.5353,
+},
+{ .is_ngc = TRUE,
+  .id = 7546,
+  .ra = 348.773,
+  .dec = -2.32514,
+},
+{ .is_ngc = TRUE,
+  .id = 7547,
+  .ra = 348.765,
+  .dec = 18.9734,
+},
+{ .is_ngc = TRUE,
+  .id = 7548,
+  .ra = 348.797,
+  .dec = 25.2822,
+},
+{ .is_ngc = TRUE,
+  .id = 7549,
+  .ra = 348.822,
+  .dec = 19.0409,
+},
+{ .is_ngc = TRUE,
+  .id = 7550,
+  .ra = 348.817,
+  .dec = 18.961,
+},
+{ .is_ngc = TRUE,
+  .id = 7551,
+  .ra = 348.841,
+  .dec = 15.9403,
+},
+{ .is_ngc = TRUE,
+  .id = 7553,
+  .ra = 348.888,
+  .dec = 19.0482,
+},
+{ .is_ngc = TRUE,
+  .id = 7553,
+  .ra = 348.901,
+  .dec = 19.0317,
+},
+{ .is_ngc = TRUE,
+  .id = 7554,
+  .ra = 348.922,
+  .dec = -2.37882,
+},
+{ .is_ngc = TRUE,
+  .id = 7555,
+  .ra = 348.771,
+  .dec = 12.5667,
+},
+{ .is_ngc = TRUE,
+  .id = 7556,
+  .ra = 348.935,
+  .dec = -2.38161,
+},
+{ .is_ngc = TRUE,
+  .id = 7557,
+  .ra = 348.916,
+  .dec = 6.70804,
+},
+{ .is_ngc = TRUE,
+  .id = 7558,
+  .ra = 348.91,
+  .dec = 18.9199,
+},
+{ .is_ngc = TRUE,
+  .id = 7560,
+  .ra = 348.974,
+  .dec = 4.49553,
+},
+{ .is_ngc = TRUE,
+  .id = 7561,
+  .ra = 348.989,
+  .dec = 4.52228,
+},
+{ .is_ngc = TRUE,
+  .id = 7562,
+  .ra = 348.99,
+  .dec = 6.68739,
+},
+{ .is_ngc = TRUE,
+  .id = 7563,
+  .ra = 348.983,
+  .dec = 13.1961,
+},
+{ .is_ngc = TRUE,
+  .id = 7564,
+  .ra = 349.005,
+  .dec = 7.34806,
+},
+{ .is_ngc = TRUE,
+  .id = 7565,
+  .ra = 349.079,
+  .dec = -0.0513889,
+},
+{ .is_ngc = TRUE,
+  .id = 7566,
+  .ra = 349.156,
+  .dec = -2.33111,
+},
+{ .is_ngc = TRUE,
+  .id = 7567,
+  .ra = 349.045,
+  .dec = 15.8504,
+},
+{ .is_ngc = TRUE,
+  .id = 7569,
+  .ra = 349.186,
+  .dec = 8.90603,
+},
+{ .is_ngc = TRUE,
+  .id = 7570,
+  .ra = 349.186,
+  .dec = 13.483,
+},
+{ .is_ngc = TRUE,
+  .id = 7571,
+  .ra = 349.294,
+  .dec = 18.9669,
+},
+{ .is_ngc = TRUE,
+  .id = 7572,
+  .ra = 349.21,
+  .dec = 18.4825,
+},
+{ .is_ngc = TRUE,
+  .id = 7573,
+  .ra = 349.11,
+  .dec = -22.1544,
+},
+{ .is_ngc = TRUE,
+  .id = 7575,
+  .ra = 349.337,
+  .dec = 5.66089,
+},
+{ .is_ngc = TRUE,
+  .id = 7576,
+  .ra = 349.344,
+  .dec = -4.72861,
+},
+{ .is_ngc = TRUE,
+  .id = 7577,
+  .ra = 349.325,
+  .dec = 7.36722,
+},
+{ .is_ngc = TRUE,
+  .id = 7579,
+  .ra = 349.412,
+  .dec = 9.43306,
+},
+{ .is_ngc = TRUE,
+  .id = 7580,
+  .ra = 349.402,
+  .dec = 14.0008,
+},
+{ .is_ngc = TRUE,
+  .id = 7582,
+  .ra = 349.598,
+  .dec = -42.3706,
+},
+{ .is_ngc = TRUE,
+  .id = 7584,
+  .ra = 349.471,
+  .dec = 9.43278,
+},
+{ .is_ngc = TRUE,
+  .id = 7585,
+  .ra = 349.505,
+  .dec = -4.65083,
+},
+{ .is_ngc = TRUE,
+  .id = 7586,
+  .ra = 349.482,
+  .dec = 8.58439,
+},
+{ .is_ngc = TRUE,
+  .id = 7587,
+  .ra = 349.497,
+  .dec = 9.68033,
+},
+{ .is_ngc = TRUE,
+  .id = 7588,
+  .ra = 349.491,
+  .dec = 18.7522,
+},
+{ .is_ngc = TRUE,
+  .id = 7589,
+  .ra = 349.565,
+  .dec = 0.261244,
+},
+{ .is_ngc = TRUE,
+  .id = 7590,
+  .ra = 349.728,
+  .dec = -42.2393,
+},
+{ .is_ngc = TRUE,
+  .id = 7591,
+  .ra = 349.568,
+  .dec = 6.58572,
+},
+{ .is_ngc = TRUE,
+  .id = 7592,
+  .ra = 349.592,
+  .dec = -4.41639,
+},
+{ .is_ngc = TRUE,
+  .id = 7593,
+  .ra = 349.488,
+  .dec = 11.3489,
+},
+{ .is_ngc = TRUE,
+  .id = 7595,
+  .ra = 349.626,
+  .dec = 9.93217,
+},
+{ .is_ngc = TRUE,
+  .id = 7598,
+  .ra = 349.639,
+  .dec = 18.7494,
+},
+{ .is_ngc = TRUE,
+  .id = 7600,
+  .ra = 349.724,
+  .dec = -7.58,
+},
+{ .is_ngc = TRUE,
+  .id = 7601,
+  .ra = 349.696,
+  .dec = 9.23356,
+},
+{ .is_ngc = TRUE,
+  .id = 7602,
+  .ra = 349.681,
+  .dec = 18.6981,
+},
+{ .is_ngc = TRUE,
+  .id = 7603,
+  .ra = 349.736,
+  .dec = 0.243931,
+},
+{ .is_ngc = TRUE,
+  .id = 7604,
+  .ra = 349.466,
+  .dec = 7.4295,
+},
+{ .is_ngc = TRUE,
+  .id = 7606,
+  .ra = 349.77,
+  .dec = -8.48581,
+},
+{ .is_ngc = TRUE,
+  .id = 7608,
+  .ra = 349.814,
+  .dec = 8.35047,
+},
+{ .is_ngc = TRUE,
+  .id = 7609,
+  .ra = 349.875,
+  .dec = 9.50794,
+},
+{ .is_ngc = TRUE,
+  .id = 7611,
+  .ra = 349.903,
+  .dec = 8.06322,
+},
+{ .is_ngc = TRUE,
+  .id = 7612,
+  .ra = 349.934,
+  .dec = 8.57647,
+},
+{ .is_ngc = TRUE,
+  .id = 7613,
+  .ra = 349.963,
+  .dec = 0.185833,
+},
+{ .is_ngc = TRUE,
+  .id = 7614,
+  .ra = 349.963,
+  .dec = 0.185833,
+},
+{ .is_ngc = TRUE,
+  .id = 7615,
+  .ra = 349.977,
+  .dec = 8.39956,
+},
+{ .is_ngc = TRUE,
+  .id = 7617,
+  .ra = 350.038,
+  .dec = 8.16561,
+},
+{ .is_ngc = TRUE,
+  .id = 7618,
+  .ra = 349.947,
+  .dec = 42.8526,
+},
+{ .is_ngc = TRUE,
+  .id = 7619,
+  .ra = 350.061,
+  .dec = 8.20625,
+},
+{ .is_ngc = TRUE,
+  .id = 7620,
+  .ra = 350.024,
+  .dec = 24.2206,
+},
+{ .is_ngc = TRUE,
+  .id = 7621,
+  .ra = 350.103,
+  .dec = 8.36583,
+},
+{ .is_ngc = TRUE,
+  .id = 7622,
+  .ra = 350.411,
+  .dec = -62.1175,
+},
+{ .is_ngc = TRUE,
+  .id = 7623,
+  .ra = 350.125,
+  .dec = 8.39598,
+},
+{ .is_ngc = TRUE,
+  .id = 7624,
+  .ra = 350.095,
+  .dec = 27.3151,
+},
+{ .is_ngc = TRUE,
+  .id = 7625,
+  .ra = 350.125,
+  .dec = 17.2259,
+},
+{ .is_ngc = TRUE,
+  .id = 7626,
+  .ra = 350.177,
+  .dec = 8.21683,
+},
+{ .is_ngc = TRUE,
+  .id = 7628,
+  .ra = 350.229,
+  .dec = 25.8986,
+},
+{ .is_ngc = TRUE,
+  .id = 7629,
+  .ra = 350.331,
+  .dec = 1.40309,
+},
+{ .is_ngc = TRUE,
+  .id = 7630,
+  .ra = 350.318,
+  .dec = 11.3973,
+},
+{ .is_ngc = TRUE,
+  .id = 7631,
+  .ra = 350.362,
+  .dec = 8.21747,
+},
+{ .is_ngc = TRUE,
+  .id = 7633,
+  .ra = 350.763,
+  .dec = -67.6528,
+},
+{ .is_ngc = TRUE,
+  .id = 7634,
+  .ra = 350.425,
+  .dec = 8.88728,
+},
+{ .is_ngc = TRUE,
+  .id = 7635,
+  .ra = 350.188,
+  .dec = 61.2019,
+},
+{ .is_ngc = TRUE,
+  .id = 7636,
+  .ra = 350.638,
+  .dec = -29.2808,
+},
+{ .is_ngc = TRUE,
+  .id = 7637,
+  .ra = 351.621,
+  .dec = -81.9114,
+},
+{ .is_ngc = TRUE,
+  .id = 7640,
+  .ra = 350.528,
+  .dec = 40.8452,
+},
+{ .is_ngc = TRUE,
+  .id = 7642,
+  .ra = 350.722,
+  .dec = 1.44272,
+},
+{ .is_ngc = TRUE,
+  .id = 7645,
+  .ra = 350.947,
+  .dec = -29.3875,
+},
+{ .is_ngc = TRUE,
+  .id = 7647,
+  .ra = 350.989,
+  .dec = 16.7773,
+},
+{ .is_ngc = TRUE,
+  .id = 7650,
+  .ra = 351.339,
+  .dec = -57.7909,
+},
+{ .is_ngc = TRUE,
+  .id = 7652,
+  .ra = 351.406,
+  .dec = -57.8872,
+},
+{ .is_ngc = TRUE,
+  .id = 7653,
+  .ra = 351.206,
+  .dec = 15.2751,
+},
+{ .is_ngc = TRUE,
+  .id = 7654,
+  .ra = 351.2,
+  .dec = 61.585,
+},
+{ .is_ngc = TRUE,
+  .id = 7655,
+  .ra = 351.691,
+  .dec = -68.0278,
+},
+{ .is_ngc = TRUE,
+  .id = 7656,
+  .ra = 351.131,
+  .dec = -19.0596,
+},
+{ .is_ngc = TRUE,
+  .id = 7657,
+  .ra = 351.696,
+  .dec = -57.805,
+},
+{ .is_ngc = TRUE,
+  .id = 7659,
+  .ra = 351.482,
+  .dec = 14.2094,
+},
+{ .is_ngc = TRUE,
+  .id = 7660,
+  .ra = 351.453,
+  .dec = 27.0293,
+},
+{ .is_ngc = TRUE,
+  .id = 7661,
+  .ra = 351.81,
+  .dec = -65.2714,
+},
+{ .is_ngc = TRUE,
+  .id = 7662,
+  .ra = 351.475,
+  .dec = 42.535,
+},
+{ .is_ngc = TRUE,
+  .id = 7663,
+  .ra = 351.667,
+  .dec = -4.75056,
+},
+{ .is_ngc = TRUE,
+  .id = 7663,
+  .ra = 351.688,
+  .dec = -4.96589,
+},
+{ .is_ngc = TRUE,
+  .id = 7664,
+  .ra = 351.666,
+  .dec = 25.0801,
+},
+{ .is_ngc = TRUE,
+  .id = 7665,
+  .ra = 351.812,
+  .dec = -9.38694,
+},
+{ .is_ngc = TRUE,
+  .id = 7666,
+  .ra = 351.85,
+  .dec = -4.18389,
+},
+{ .is_ngc = TRUE,
+  .id = 7667,
+  .ra = 351.842,
+  .dec = -0.183889,
+},
+{ .is_ngc = TRUE,
+  .id = 7667,
+  .ra = 351.096,
+  .dec = -0.108333,
+},
+{ .is_ngc = TRUE,
+  .id = 7668,
+  .ra = 351.767,
+  .dec = -0.183333,
+},
+{ .is_ngc = TRUE,
+  .id = 7669,
+  .ra = 351.767,
+  .dec = -0.183333,
+},
+{ .is_ngc = TRUE,
+  .id = 7670,
+  .ra = 351.767,
+  .dec = -0.183333,
+},
+{ .is_ngc = TRUE,
+  .id = 7671,
+  .ra = 351.831,
+  .dec = 12.4675,
+},
+{ .is_ngc = TRUE,
+  .id = 7672,
+  .ra = 351.881,
+  .dec = 12.3851,
+},
+{ .is_ngc = TRUE,
+  .id = 7673,
+  .ra = 351.922,
+  .dec = 23.5894,
+},
+{ .is_ngc = TRUE,
+  .id = 7674,
+  .ra = 351.986,
+  .dec = 8.77869,
+},
+{ .is_ngc = TRUE,
+  .id = 7675,
+  .ra = 352.025,
+  .dec = 8.76839,
+},
+{ .is_ngc = TRUE,
+  .id = 7676,
+  .ra = 352.257,
+  .dec = -59.7172,
+},
+{ .is_ngc = TRUE,
+  .id = 7677,
+  .ra = 352.025,
+  .dec = 23.531,
+},
+{ .is_ngc = TRUE,
+  .id = 7678,
+  .ra = 352.116,
+  .dec = 22.4211,
+},
+{ .is_ngc = TRUE,
+  .id = 7679,
+  .ra = 352.195,
+  .dec = 3.51144,
+},
+{ .is_ngc = TRUE,
+  .id = 7680,
+  .ra = 352.146,
+  .dec = 32.4156,
+},
+{ .is_ngc = TRUE,
+  .id = 7681,
+  .ra = 352.228,
+  .dec = 17.3091,
+},
+{ .is_ngc = TRUE,
+  .id = 7682,
+  .ra = 352.266,
+  .dec = 3.53335,
+},
+{ .is_ngc = TRUE,
+  .id = 7683,
+  .ra = 352.266,
+  .dec = 11.4448,
+},
+{ .is_ngc = TRUE,
+  .id = 7684,
+  .ra = 352.634,
+  .dec = 0.0807778,
+},
+{ .is_ngc = TRUE,
+  .id = 7685,
+  .ra = 352.639,
+  .dec = 3.90128,
+},
+{ .is_ngc = TRUE,
+  .id = 7686,
+  .ra = 352.529,
+  .dec = 49.1333,
+},
+{ .is_ngc = TRUE,
+  .id = 7687,
+  .ra = 352.727,
+  .dec = 3.54691,
+},
+{ .is_ngc = TRUE,
+  .id = 7688,
+  .ra = 352.773,
+  .dec = 21.4113,
+},
+{ .is_ngc = TRUE,
+  .id = 7689,
+  .ra = 353.317,
+  .dec = -54.0939,
+},
+{ .is_ngc = TRUE,
+  .id = 7690,
+  .ra = 353.26,
+  .dec = -51.6978,
+},
+{ .is_ngc = TRUE,
+  .id = 7691,
+  .ra = 353.102,
+  .dec = 15.8476,
+},
+{ .is_ngc = TRUE,
+  .id = 7692,
+  .ra = 353.195,
+  .dec = -5.59639,
+},
+{ .is_ngc = TRUE,
+  .id = 7693,
+  .ra = 353.294,
+  .dec = -1.29196,
+},
+{ .is_ngc = TRUE,
+  .id = 7694,
+  .ra = 353.317,
+  .dec = -2.70331,
+},
+{ .is_ngc = TRUE,
+  .id = 7695,
+  .ra = 353.312,
+  .dec = -2.72019,
+},
+{ .is_ngc = TRUE,
+  .id = 7696,
+  .ra = 353.459,
+  .dec = 4.87056,
+},
+{ .is_ngc = TRUE,
+  .id = 7698,
+  .ra = 353.507,
+  .dec = 24.9445,
+},
+{ .is_ngc = TRUE,
+  .id = 7699,
+  .ra = 353.612,
+  .dec = -2.89989,
+},
+{ .is_ngc = TRUE,
+  .id = 7700,
+  .ra = 353.626,
+  .dec = -2.95383,
+},
+{ .is_ngc = TRUE,
+  .id = 7701,
+  .ra = 353.631,
+  .dec = -2.85469,
+},
+{ .is_ngc = TRUE,
+  .id = 7702,
+  .ra = 353.87,
+  .dec = -56.0111,
+},
+{ .is_ngc = TRUE,
+  .id = 7703,
+  .ra = 353.695,
+  .dec = 16.0755,
+},
+{ .is_ngc = TRUE,
+  .id = 7704,
+  .ra = 353.755,
+  .dec = 4.89748,
+},
+{ .is_ngc = TRUE,
+  .id = 7705,
+  .ra = 353.761,
+  .dec = 4.80381,
+},
+{ .is_ngc = TRUE,
+  .id = 7706,
+  .ra = 353.794,
+  .dec = 4.96406,
+},
+{ .is_ngc = TRUE,
+  .id = 7707,
+  .ra = 353.714,
+  .dec = 44.3039,
+},
+{ .is_ngc = TRUE,
+  .id = 7708,
+  .ra = 353.754,
+  .dec = 72.8333,
+},
+{ .is_ngc = TRUE,
+  .id = 7709,
+  .ra = 353.864,
+  .dec = -16.7056,
+},
+{ .is_ngc = TRUE,
+  .id = 7710,
+  .ra = 353.942,
+  .dec = -2.88111,
+},
+{ .is_ngc = TRUE,
+  .id = 7711,
+  .ra = 353.914,
+  .dec = 15.3013,
+},
+{ .is_ngc = TRUE,
+  .id = 7712,
+  .ra = 353.965,
+  .dec = 23.6186,
+},
+{ .is_ngc = TRUE,
+  .id = 7713,
+  .ra = 354.063,
+  .dec = -37.9387,
+},
+{ .is_ngc = TRUE,
+  .id = 7714,
+  .ra = 354.059,
+  .dec = 2.15497,
+},
+{ .is_ngc = TRUE,
+  .id = 7715,
+  .ra = 354.091,
+  .dec = 2.1565,
+},
+{ .is_ngc = TRUE,
+  .id = 7716,
+  .ra = 354.131,
+  .dec = 0.297167,
+},
+{ .is_ngc = TRUE,
+  .id = 7717,
+  .ra = 354.431,
+  .dec = -15.1189,
+},
+{ .is_ngc = TRUE,
+  .id = 7718,
+  .ra = 354.521,
+  .dec = 25.7196,
+},
+{ .is_ngc = TRUE,
+  .id = 7719,
+  .ra = 354.511,
+  .dec = -22.9747,
+},
+{ .is_ngc = TRUE,
+  .id = 7721,
+  .ra = 354.702,
+  .dec = -6.51806,
+},
+{ .is_ngc = TRUE,
+  .id = 7722,
+  .ra = 354.671,
+  .dec = 15.9541,
+},
+{ .is_ngc = TRUE,
+  .id = 7723,
+  .ra = 354.737,
+  .dec = -12.9611,
+},
+{ .is_ngc = TRUE,
+  .id = 7724,
+  .ra = 354.779,
+  .dec = -12.2244,
+},
+{ .is_ngc = TRUE,
+  .id = 7725,
+  .ra = 354.811,
+  .dec = -4.53917,
+},
+{ .is_ngc = TRUE,
+  .id = 7726,
+  .ra = 354.8,
+  .dec = 27.1154,
+},
+{ .is_ngc = TRUE,
+  .id = 7727,
+  .ra = 354.974,
+  .dec = -12.2931,
+},
+{ .is_ngc = TRUE,
+  .id = 7728,
+  .ra = 355.003,
+  .dec = 27.1336,
+},
+{ .is_ngc = TRUE,
+  .id = 7729,
+  .ra = 355.14,
+  .dec = 29.188,
+},
+{ .is_ngc = TRUE,
+  .id = 7730,
+  .ra = 355.191,
+  .dec = -20.5092,
+},
+{ .is_ngc = TRUE,
+  .id = 7731,
+  .ra = 355.371,
+  .dec = 3.73986,
+},
+{ .is_ngc = TRUE,
+  .id = 7732,
+  .ra = 355.392,
+  .dec = 3.72444,
+},
+{ .is_ngc = TRUE,
+  .id = 7733,
+  .ra = 355.638,
+  .dec = -65.9569,
+},
+{ .is_ngc = TRUE,
+  .id = 7734,
+  .ra = 355.68,
+  .dec = -65.9442,
+},
+{ .is_ngc = TRUE,
+  .id = 7735,
+  .ra = 355.572,
+  .dec = 26.2319,
+},
+{ .is_ngc = TRUE,
+  .id = 7736,
+  .ra = 355.607,
+  .dec = -19.4525,
+},
+{ .is_ngc = TRUE,
+  .id = 7737,
+  .ra = 355.693,
+  .dec = 27.0527,
+},
+{ .is_ngc = TRUE,
+  .id = 7738,
+  .ra = 355.879,
+  .dec = 0.484167,
+},
+{ .is_ngc = TRUE,
+  .id = 7738,
+  .ra = 356.009,
+  .dec = 0.516556,
+},
+{ .is_ngc = TRUE,
+  .id = 7739,
+  .ra = 355.879,
+  .dec = 0.484167,
+},
+{ .is_ngc = TRUE,
+  .id = 7739,
+  .ra = 356.125,
+  .dec = 0.320039,
+},
+{ .is_ngc = TRUE,
+  .id = 7740,
+  .ra = 355.884,
+  .dec = 27.3129,
+},
+{ .is_ngc = TRUE,
+  .id = 7741,
+  .ra = 355.976,
+  .dec = 26.0756,
+},
+{ .is_ngc = TRUE,
+  .id = 7742,
+  .ra = 356.066,
+  .dec = 10.7668,
+},
+{ .is_ngc = TRUE,
+  .id = 7743,
+  .ra = 356.089,
+  .dec = 9.93369,
+},
+{ .is_ngc = TRUE,
+  .id = 7745,
+  .ra = 356.191,
+  .dec = 25.9084,
+},
+{ .is_ngc = TRUE,
+  .id = 7746,
+  .ra = 356.333,
+  .dec = -1.68492,
+},
+{ .is_ngc = TRUE,
+  .id = 7747,
+  .ra = 356.385,
+  .dec = 27.3601,
+},
+{ .is_ngc = TRUE,
+  .id = 7748,
+  .ra = 356.236,
+  .dec = 69.7547,
+},
+{ .is_ngc = TRUE,
+  .id = 7749,
+  .ra = 356.447,
+  .dec = -29.5175,
+},
+{ .is_ngc = TRUE,
+  .id = 7750,
+  .ra = 356.658,
+  .dec = 3.79944,
+},
+{ .is_ngc = TRUE,
+  .id = 7751,
+  .ra = 356.743,
+  .dec = 6.86194,
+},
+{ .is_ngc = TRUE,
+  .id = 7752,
+  .ra = 356.744,
+  .dec = 29.4588,
+},
+{ .is_ngc = TRUE,
+  .id = 7753,
+  .ra = 356.77,
+  .dec = 29.4832,
+},
+{ .is_ngc = TRUE,
+  .id = 7754,
+  .ra = 357.296,
+  .dec = -16.6003,
+},
+{ .is_ngc = TRUE,
+  .id = 7755,
+  .ra = 356.964,
+  .dec = -30.522,
+},
+{ .is_ngc = TRUE,
+  .id = 7756,
+  .ra = 357.119,
+  .dec = 4.12517,
+},
+{ .is_ngc = TRUE,
+  .id = 7756,
+  .ra = 357.127,
+  .dec = 4.13933,
+},
+{ .is_ngc = TRUE,
+  .id = 7757,
+  .ra = 357.19,
+  .dec = 4.17117,
+},
+{ .is_ngc = TRUE,
+  .id = 7758,
+  .ra = 357.23,
+  .dec = -22.0241,
+},
+{ .is_ngc = TRUE,
+  .id = 7759,
+  .ra = 357.228,
+  .dec = -16.541,
+},
+{ .is_ngc = TRUE,
+  .id = 7760,
+  .ra = 357.3,
+  .dec = 30.9829,
+},
+{ .is_ngc = TRUE,
+  .id = 7762,
+  .ra = 357.504,
+  .dec = 68.0342,
+},
+{ .is_ngc = TRUE,
+  .id = 7763,
+  .ra = 357.565,
+  .dec = -16.5903,
+},
+{ .is_ngc = TRUE,
+  .id = 7764,
+  .ra = 357.723,
+  .dec = -40.7297,
+},
+{ .is_ngc = TRUE,
+  .id = 7765,
+  .ra = 357.718,
+  .dec = 27.1653,
+},
+{ .is_ngc = TRUE,
+  .id = 7766,
+  .ra = 357.733,
+  .dec = 27.1263,
+},
+{ .is_ngc = TRUE,
+  .id = 7767,
+  .ra = 357.735,
+  .dec = 27.0868,
+},
+{ .is_ngc = TRUE,
+  .id = 7768,
+  .ra = 357.744,
+  .dec = 27.1469,
+},
+{ .is_ngc = TRUE,
+  .id = 7769,
+  .ra = 357.767,
+  .dec = 20.1504,
+},
+{ .is_ngc = TRUE,
+  .id = 7770,
+  .ra = 357.844,
+  .dec = 20.0967,
+},
+{ .is_ngc = TRUE,
+  .id = 7771,
+  .ra = 357.854,
+  .dec = 20.1119,
+},
+{ .is_ngc = TRUE,
+  .id = 7772,
+  .ra = 357.938,
+  .dec = 16.2358,
+},
+{ .is_ngc = TRUE,
+  .id = 7773,
+  .ra = 358.041,
+  .dec = 31.2769,
+},
+{ .is_ngc = TRUE,
+  .id = 7775,
+  .ra = 358.101,
+  .dec = 28.7724,
+},
+{ .is_ngc = TRUE,
+  .id = 7777,
+  .ra = 358.303,
+  .dec = 28.2836,
+},
+{ .is_ngc = TRUE,
+  .id = 7778,
+  .ra = 358.332,
+  .dec = 7.87075,
+},
+{ .is_ngc = TRUE,
+  .id = 7779,
+  .ra = 358.362,
+  .dec = 7.87556,
+},
+{ .is_ngc = TRUE,
+  .id = 7780,
+  .ra = 358.384,
+  .dec = 8.11786,
+},
+{ .is_ngc = TRUE,
+  .id = 7781,
+  .ra = 358.441,
+  .dec = 7.86028,
+},
+{ .is_ngc = TRUE,
+  .id = 7782,
+  .ra = 358.475,
+  .dec = 7.97058,
+},
+{ .is_ngc = TRUE,
+  .id = 7784,
+  .ra = 358.807,
+  .dec = 21.7623,
+},
+{ .is_ngc = TRUE,
+  .id = 7785,
+  .ra = 358.829,
+  .dec = 5.91553,
+},
+{ .is_ngc = TRUE,
+  .id = 7786,
+  .ra = 358.839,
+  .dec = 21.5881,
+},
+{ .is_ngc = TRUE,
+  .id = 7787,
+  .ra = 359.032,
+  .dec = 0.549556,
+},
+{ .is_ngc = TRUE,
+  .id = 7788,
+  .ra = 359.19,
+  .dec = 61.3997,
+},
+{ .is_ngc = TRUE,
+  .id = 7789,
+  .ra = 359.35,
+  .dec = 56.7014,
+},
+{ .is_ngc = TRUE,
+  .id = 7790,
+  .ra = 359.6,
+  .dec = 61.2014,
+},
+{ .is_ngc = TRUE,
+  .id = 7791,
+  .ra = 359.488,
+  .dec = 10.7655,
+},
+{ .is_ngc = TRUE,
+  .id = 7792,
+  .ra = 359.515,
+  .dec = 16.5014,
+},
+{ .is_ngc = TRUE,
+  .id = 7793,
+  .ra = 359.457,
+  .dec = -32.5911,
+},
+{ .is_ngc = TRUE,
+  .id = 7794,
+  .ra = 359.642,
+  .dec = 10.7281,
+},
+{ .is_ngc = TRUE,
+  .id = 7795,
+  .ra = 359.654,
+  .dec = 60.0336,
+},
+{ .is_ngc = TRUE,
+  .id = 7796,
+  .ra = 359.749,
+  .dec = -55.4569,
+},
+{ .is_ngc = TRUE,
+  .id = 7797,
+  .ra = 359.745,
+  .dec = 3.6345,
+},
+{ .is_ngc = TRUE,
+  .id = 7798,
+  .ra = 359.856,
+  .dec = 20.7496,
+},
+{ .is_ngc = TRUE,
+  .id = 7799,
+  .ra = 359.881,
+  .dec = 31.2956,
+},
+{ .is_ngc = TRUE,
+  .id = 7800,
+  .ra = 359.904,
+  .dec = 14.807,
+},
+{ .is_ngc = TRUE,
+  .id = 7801,
+  .ra = 0.0875,
+  .dec = 50.7347,
+},
+{ .is_ngc = TRUE,
+  .id = 7802,
+  .ra = 0.251833,
+  .dec = 6.24197,
+},
+{ .is_ngc = TRUE,
+  .id = 7803,
+  .ra = 0.33325,
+  .dec = 13.1111,
+},
+{ .is_ngc = TRUE,
+  .id = 7804,
+  .ra = 0.328292,
+  .dec = 7.74875,
+},
+{ .is_ngc = TRUE,
+  .id = 7805,
+  .ra = 0.361292,
+  .dec = 31.4338,
+},
+{ .is_ngc = TRUE,
+  .id = 7806,
+  .ra = 0.375208,
+  .dec = 31.4417,
+},
+{ .is_ngc = TRUE,
+  .id = 7807,
+  .ra = 0.111208,
+  .dec = -18.8421,
+},
+{ .is_ngc = TRUE,
+  .id = 7808,
+  .ra = 0.884133,
+  .dec = -10.7445,
+},
+{ .is_ngc = TRUE,
+  .id = 7809,
+  .ra = 0.539167,
+  .dec = 2.94028,
+},
+{ .is_ngc = TRUE,
+  .id = 7810,
+  .ra = 0.580208,
+  .dec = 12.9714,
+},
+{ .is_ngc = TRUE,
+  .id = 7811,
+  .ra = 0.610342,
+  .dec = 3.35178,
+},
+{ .is_ngc = TRUE,
+  .id = 7812,
+  .ra = 0.72625,
+  .dec = -34.2356,
+},
+{ .is_ngc = TRUE,
+  .id = 7814,
+  .ra = 0.812292,
+  .dec = 16.1454,
+},
+{ .is_ngc = TRUE,
+  .id = 7815,
+  .ra = 0.853583,
+  .dec = 20.704,
+},
+{ .is_ngc = TRUE,
+  .id = 7816,
+  .ra = 0.953958,
+  .dec = 7.47869,
+},
+{ .is_ngc = TRUE,
+  .id = 7817,
+  .ra = 0.995,
+  .dec = 20.7508,
+},
+{ .is_ngc = TRUE,
+  .id = 7818,
+  .ra = 1.03704,
+  .dec = 7.37886,
+},
+{ .is_ngc = TRUE,
+  .id = 7819,
+  .ra = 1.10243,
+  .dec = 31.4723,
+},
+{ .is_ngc = TRUE,
+  .id = 7820,
+  .ra = 1.12825,
+  .dec = 5.19947,
+},
+{ .is_ngc = TRUE,
+  .id = 7821,
+  .ra = 1.31917,
+  .dec = -16.4769,
+},
+{ .is_ngc = TRUE,
+  .id = 7822,
+  .ra = 0.775,
+  .dec = 67.15,
+},
+{ .is_ngc = TRUE,
+  .id = 7822,
+  .ra = 0.7625,
+  .dec = 68.4667,
+},
+{ .is_ngc = TRUE,
+  .id = 7823,
+  .ra = 1.19292,
+  .dec = -62.0614,
+},
+{ .is_ngc = TRUE,
+  .id = 7824,
+  .ra = 1.27599,
+  .dec = 6.91999,
+},
+{ .is_ngc = TRUE,
+  .id = 7825,
+  .ra = 1.27792,
+  .dec = 5.20278,
+},
+{ .is_ngc = TRUE,
+  .id = 7826,
+  .ra = 1.32083,
+  .dec = -20.6847,
+},
+{ .is_ngc = TRUE,
+  .id = 7827,
+  .ra = 1.36542,
+  .dec = 5.22197,
+},
+{ .is_ngc = TRUE,
+  .id = 7828,
+  .ra = 1.61275,
+  .dec = -13.4158,
+},
+{ .is_ngc = TRUE,
+  .id = 7829,
+  .ra = 1.62117,
+  .dec = -13.4209,
+},
+{ .is_ngc = TRUE,
+  .id = 7830,
+  .ra = 1.50792,
+  .dec = 8.3425,
+},
+{ .is_ngc = TRUE,
+  .id = 7833,
+  .ra = 1.63292,
+  .dec = 27.6406,
+},
+{ .is_ngc = TRUE,
+  .id = 7834,
+  .ra = 1.65783,
+  .dec = 8.36786,
+},
+{ .is_ngc = TRUE,
+  .id = 7835,
+  .ra = 1.69417,
+  .dec = 8.42583,
+},
+{ .is_ngc = TRUE,
+  .id = 7836,
+  .ra = 2.00707,
+  .dec = 33.0706,
+},
+{ .is_ngc = TRUE,
+  .id = 7837,
+  .ra = 1.71429,
+  .dec = 8.35153,
+},
+{ .is_ngc = TRUE,
+  .id = 7838,
+  .ra = 1.72467,
+  .dec = 8.35108,
+},
+{ .is_ngc = TRUE,
+  .id = 7839,
+  .ra = 1.7525,
+  .dec = 27.6353,
+},
+{ .is_ngc = TRUE,
+  .id = 7840,
+  .ra = 1.78708,
+  .dec = 8.3825,
+},
+{ .is_ngc = FALSE,
+  .id = 1,
+  .ra = 2.11333,
+  .dec = 27.7181,
+},
+{ .is_ngc = FALSE,
+  .id = 2,
+  .ra = 2.75333,
+  .dec = -12.8219,
+},
+{ .is_ngc = FALSE,
+  .id = 3,
+  .ra = 3.0253,
+  .dec = -0.414875,
+},
+{ .is_ngc = FALSE,
+  .id = 4,
+  .ra = 3.36263,
+  .dec = 17.4861,
+},
+{ .is_ngc = FALSE,
+  .id = 5,
+  .ra = 4.39542,
+  .dec = -9.54318,
+},
+{ .is_ngc = FALSE,
+  .id = 6,
+  .ra = 4.72862,
+  .dec = -3.27564,
+},
+{ .is_ngc = FALSE,
+  .id = 7,
+  .ra = 4.72125,
+  .dec = 10.5944,
+},
+{ .is_ngc = FALSE,
+  .id = 8,
+  .ra = 4.76017,
+  .dec = -3.22164,
+},
+{ .is_ngc = FALSE,
+  .id = 9,
+  .ra = 4.93417,
+  .dec = -14.1217,
+},
+{ .is_ngc = FALSE,
+  .id = 10,
+  .ra = 5.10054,
+  .dec = 59.2927,
+},
+{ .is_ngc = FALSE,
+  .id = 12,
+  .ra = 5.0625,
+  .dec = -2.6525,
+},
+{ .is_ngc = FALSE,
+  .id = 13,
+  .ra = 5.08408,
+  .dec = 7.70039,
+},
+{ .is_ngc = FALSE,
+  .id = 14,
+  .ra = 5.63042,
+  .dec = 10.4903,
+},
+{ .is_ngc = FALSE,
+  .id = 15,
+  .ra = 6.99,
+  .dec = -0.0616667,
+},
+{ .is_ngc = FALSE,
+  .id = 16,
+  .ra = 7.03292,
+  .dec = -13.0936,
+},
+{ .is_ngc = FALSE,
+  .id = 17,
+  .ra = 7.12375,
+  .dec = 2.64861,
+},
+{ .is_ngc = FALSE,
+  .id = 18,
+  .ra = 7.14583,
+  .dec = -11.5864,
+},
+{ .is_ngc = FALSE,
+  .id = 19,
+  .ra = 7.16416,
+  .dec = -11.6406,
+},
+{ .is_ngc = FALSE,
+  .id = 20,
+  .ra = 7.1654,
+  .dec = -13.0102,
+},
+{ .is_ngc = FALSE,
+  .id = 21,
+  .ra = 7.29308,
+  .dec = -0.163833,
+},
+{ .is_ngc = FALSE,
+  .id = 22,
+  .ra = 7.38792,
+  .dec = -9.08,
+},
+{ .is_ngc = FALSE,
+  .id = 23,
+  .ra = 7.71188,
+  .dec = -12.7194,
+},
+{ .is_ngc = FALSE,
+  .id = 24,
+  .ra = 7.81958,
+  .dec = 30.8394,
+},
+{ .is_ngc = FALSE,
+  .id = 25,
+  .ra = 7.80042,
+  .dec = -0.4075,
+},
+{ .is_ngc = FALSE,
+  .id = 27,
+  .ra = 8.2758,
+  .dec = -13.3719,
+},
+{ .is_ngc = FALSE,
+  .id = 28,
+  .ra = 8.28531,
+  .dec = -13.4568,
+},
+{ .is_ngc = FALSE,
+  .id = 29,
+  .ra = 8.54492,
+  .dec = -2.1775,
+},
+{ .is_ngc = FALSE,
+  .id = 30,
+  .ra = 8.56125,
+  .dec = -2.08528,
+},
+{ .is_ngc = FALSE,
+  .id = 31,
+  .ra = 8.60259,
+  .dec = 12.2682,
+},
+{ .is_ngc = FALSE,
+  .id = 32,
+  .ra = 8.75644,
+  .dec = -2.14169,
+},
+{ .is_ngc = FALSE,
+  .id = 33,
+  .ra = 8.77083,
+  .dec = -2.13778,
+},
+{ .is_ngc = FALSE,
+  .id = 34,
+  .ra = 8.90121,
+  .dec = 9.12389,
+},
+{ .is_ngc = FALSE,
+  .id = 35,
+  .ra = 9.41642,
+  .dec = 10.3579,
+},
+{ .is_ngc = FALSE,
+  .id = 36,
+  .ra = 9.45689,
+  .dec = -15.4409,
+},
+{ .is_ngc = FALSE,
+  .id = 37,
+  .ra = 9.64246,
+  .dec = -15.3583,
+},
+{ .is_ngc = FALSE,
+  .id = 38,
+  .ra = 9.66204,
+  .dec = -15.4193,
+},
+{ .is_ngc = FALSE,
+  .id = 40,
+  .ra = 9.83942,
+  .dec = 2.45592,
+},
+{ .is_ngc = FALSE,
+  .id = 41,
+  .ra = 9.9175,
+  .dec = -14.1747,
+},
+{ .is_ngc = FALSE,
+  .id = 42,
+  .ra = 10.2743,
+  .dec = -15.4277,
+},
+{ .is_ngc = FALSE,
+  .id = 43,
+  .ra = 10.5921,
+  .dec = 29.6415,
+},
+{ .is_ngc = FALSE,
+  .id = 45,
+  .ra = 10.6512,
+  .dec = 29.655,
+},
+{ .is_ngc = FALSE,
+  .id = 46,
+  .ra = 10.741,
+  .dec = 27.2532,
+},
+{ .is_ngc = FALSE,
+  .id = 47,
+  .ra = 10.7291,
+  .dec = -13.7401,
+},
+{ .is_ngc = FALSE,
+  .id = 49,
+  .ra = 10.9841,
+  .dec = 1.84989,
+},
+{ .is_ngc = FALSE,
+  .id = 50,
+  .ra = 11.5233,
+  .dec = -9.50306,
+},
+{ .is_ngc = FALSE,
+  .id = 51,
+  .ra = 11.6013,
+  .dec = -13.4419,
+},
+{ .is_ngc = FALSE,
+  .id = 52,
+  .ra = 12.0996,
+  .dec = 4.09147,
+},
+{ .is_ngc = FALSE,
+  .id = 53,
+  .ra = 12.6701,
+  .dec = 10.6002,
+},
+{ .is_ngc = FALSE,
+  .id = 54,
+  .ra = 12.695,
+  .dec = -2.28833,
+},
+{ .is_ngc = FALSE,
+  .id = 55,
+  .ra = 12.9265,
+  .dec = 7.71839,
+},
+{ .is_ngc = FALSE,
+  .id = 56,
+  .ra = 12.875,
+  .dec = -12.8447,
+},
+{ .is_ngc = FALSE,
+  .id = 57,
+  .ra = 13.7022,
+  .dec = 11.8409,
+},
+{ .is_ngc = FALSE,
+  .id = 58,
+  .ra = 13.7602,
+  .dec = -13.6781,
+},
+{ .is_ngc = FALSE,
+  .id = 59,
+  .ra = 14.3692,
+  .dec = 61.1436,
+},
+{ .is_ngc = FALSE,
+  .id = 60,
+  .ra = 14.0177,
+  .dec = -13.3583,
+},
+{ .is_ngc = FALSE,
+  .id = 61,
+  .ra = 14.2801,
+  .dec = 7.50681,
+},
+{ .is_ngc = FALSE,
+  .id = 62,
+  .ra = 14.6828,
+  .dec = 11.8078,
+},
+{ .is_ngc = FALSE,
+  .id = 63,
+  .ra = 14.87,
+  .dec = 60.9117,
+},
+{ .is_ngc = FALSE,
+  .id = 64,
+  .ra = 14.8517,
+  .dec = 27.0588,
+},
+{ .is_ngc = FALSE,
+  .id = 65,
+  .ra = 15.2317,
+  .dec = 47.6815,
+},
+{ .is_ngc = FALSE,
+  .id = 66,
+  .ra = 15.1354,
+  .dec = 30.7969,
+},
+{ .is_ngc = FALSE,
+  .id = 67,
+  .ra = 15.0708,
+  .dec = -6.90167,
+},
+{ .is_ngc = FALSE,
+  .id = 68,
+  .ra = 15.0875,
+  .dec = -6.935,
+},
+{ .is_ngc = FALSE,
+  .id = 69,
+  .ra = 15.3487,
+  .dec = 31.0406,
+},
+{ .is_ngc = FALSE,
+  .id = 70,
+  .ra = 15.2662,
+  .dec = 0.0508444,
+},
+{ .is_ngc = FALSE,
+  .id = 71,
+  .ra = 15.3208,
+  .dec = -6.76861,
+},
+{ .is_ngc = FALSE,
+  .id = 71,
+  .ra = 15.3302,
+  .dec = -6.76717,
+},
+{ .is_ngc = FALSE,
+  .id = 72,
+  .ra = 15.3792,
+  .dec = -6.75194,
+},
+{ .is_ngc = FALSE,
+  .id = 72,
+  .ra = 15.3946,
+  .dec = -6.77794,
+},
+{ .is_ngc = FALSE,
+  .id = 73,
+  .ra = 16.2213,
+  .dec = 4.76694,
+},
+{ .is_ngc = FALSE,
+  .id = 74,
+  .ra = 16.483,
+  .dec = 4.09137,
+},
+{ .is_ngc = FALSE,
+  .id = 75,
+  .ra = 16.7986,
+  .dec = 10.8366,
+},
+{ .is_ngc = FALSE,
+  .id = 76,
+  .ra = 17.0487,
+  .dec = -4.55417,
+},
+{ .is_ngc = FALSE,
+  .id = 77,
+  .ra = 17.1823,
+  .dec = -15.421,
+},
+{ .is_ngc = FALSE,
+  .id = 78,
+  .ra = 17.1989,
+  .dec = -15.8448,
+},
+{ .is_ngc = FALSE,
+  .id = 79,
+  .ra = 17.2067,
+  .dec = -15.9489,
+},
+{ .is_ngc = FALSE,
+  .id = 81,
+  .ra = 17.3433,
+  .dec = -1.69556,
+},
+{ .is_ngc = FALSE,
+  .id = 82,
+  .ra = 17.2733,
+  .dec = -15.9997,
+},
+{ .is_ngc = FALSE,
+  .id = 83,
+  .ra = 17.6238,
+  .dec = 1.68889,
+},
+{ .is_ngc = FALSE,
+  .id = 84,
+  .ra = 17.8565,
+  .dec = 1.64005,
+},
+{ .is_ngc = FALSE,
+  .id = 85,
+  .ra = 17.9567,
+  .dec = -0.452222,
+},
+{ .is_ngc = FALSE,
+  .id = 86,
+  .ra = 18.3688,
+  .dec = -16.2404,
+},
+{ .is_ngc = FALSE,
+  .id = 87,
+  .ra = 18.5657,
+  .dec = 0.765167,
+},
+{ .is_ngc = FALSE,
+  .id = 88,
+  .ra = 18.6301,
+  .dec = 0.791722,
+},
+{ .is_ngc = FALSE,
+  .id = 90,
+  .ra = 19.1267,
+  .dec = -7.97733,
+},
+{ .is_ngc = FALSE,
+  .id = 91,
+  .ra = 19.6644,
+  .dec = 2.55401,
+},
+{ .is_ngc = FALSE,
+  .id = 94,
+  .ra = 20.0229,
+  .dec = 32.7173,
+},
+{ .is_ngc = FALSE,
+  .id = 95,
+  .ra = 19.8245,
+  .dec = -12.574,
+},
+{ .is_ngc = FALSE,
+  .id = 96,
+  .ra = 20.1387,
+  .dec = 29.6165,
+},
+{ .is_ngc = FALSE,
+  .id = 98,
+  .ra = 20.2287,
+  .dec = -12.6046,
+},
+{ .is_ngc = FALSE,
+  .id = 99,
+  .ra = 20.6137,
+  .dec = -12.9527,
+},
+{ .is_ngc = FALSE,
+  .id = 100,
+  .ra = 20.7251,
+  .dec = -4.64293,
+},
+{ .is_ngc = FALSE,
+  .id = 101,
+  .ra = 21.0358,
+  .dec = 9.93025,
+},
+{ .is_ngc = FALSE,
+  .id = 102,
+  .ra = 21.1099,
+  .dec = 9.88656,
+},
+{ .is_ngc = FALSE,
+  .id = 103,
+  .ra = 21.1523,
+  .dec = 2.04416,
+},
+{ .is_ngc = FALSE,
+  .id = 104,
+  .ra = 21.1396,
+  .dec = -1.45639,
+},
+{ .is_ngc = FALSE,
+  .id = 105,
+  .ra = 21.1929,
+  .dec = 2.07472,
+},
+{ .is_ngc = FALSE,
+  .id = 108,
+  .ra = 21.1625,
+  .dec = -12.6357,
+},
+{ .is_ngc = FALSE,
+  .id = 109,
+  .ra = 21.3043,
+  .dec = 2.06675,
+},
+{ .is_ngc = FALSE,
+  .id = 110,
+  .ra = 21.4417,
+  .dec = 33.5025,
+},
+{ .is_ngc = FALSE,
+  .id = 110,
+  .ra = 21.4542,
+  .dec = 33.5175,
+},
+{ .is_ngc = FALSE,
+  .id = 111,
+  .ra = 21.4958,
+  .dec = 33.5006,
+},
+{ .is_ngc = FALSE,
+  .id = 112,
+  .ra = 21.5123,
+  .dec = 11.4434,
+},
+{ .is_ngc = FALSE,
+  .id = 113,
+  .ra = 21.6064,
+  .dec = 19.1917,
+},
+{ .is_ngc = FALSE,
+  .id = 114,
+  .ra = 21.5943,
+  .dec = 9.90972,
+},
+{ .is_ngc = FALSE,
+  .id = 115,
+  .ra = 21.7268,
+  .dec = 19.2142,
+},
+{ .is_ngc = FALSE,
+  .id = 116,
+  .ra = 21.7125,
+  .dec = -4.98194,
+},
+{ .is_ngc = FALSE,
+  .id = 118,
+  .ra = 21.9001,
+  .dec = -4.99744,
+},
+{ .is_ngc = FALSE,
+  .id = 119,
+  .ra = 21.9794,
+  .dec = -2.04075,
+},
+{ .is_ngc = FALSE,
+  .id = 120,
+  .ra = 22.0538,
+  .dec = -1.91583,
+},
+{ .is_ngc = FALSE,
+  .id = 121,
+  .ra = 22.0909,
+  .dec = 2.51275,
+},
+{ .is_ngc = FALSE,
+  .id = 122,
+  .ra = 22.0551,
+  .dec = -14.839,
+},
+{ .is_ngc = FALSE,
+  .id = 123,
+  .ra = 22.2146,
+  .dec = 2.44653,
+},
+{ .is_ngc = FALSE,
+  .id = 124,
+  .ra = 22.2875,
+  .dec = -1.93697,
+},
+{ .is_ngc = FALSE,
+  .id = 125,
+  .ra = 22.3263,
+  .dec = -13.2801,
+},
+{ .is_ngc = FALSE,
+  .id = 126,
+  .ra = 22.449,
+  .dec = -1.98381,
+},
+{ .is_ngc = FALSE,
+  .id = 127,
+  .ra = 22.4478,
+  .dec = -6.97994,
+},
+{ .is_ngc = FALSE,
+  .id = 128,
+  .ra = 22.8494,
+  .dec = -12.6245,
+},
+{ .is_ngc = FALSE,
+  .id = 129,
+  .ra = 22.8804,
+  .dec = -12.6546,
+},
+{ .is_ngc = FALSE,
+  .id = 130,
+  .ra = 22.8695,
+  .dec = -15.5915,
+},
+{ .is_ngc = FALSE,
+  .id = 131,
+  .ra = 23.3109,
+  .dec = 30.7488,
+},
+{ .is_ngc = FALSE,
+  .id = 132,
+  .ra = 23.316,
+  .dec = 30.9451,
+},
+{ .is_ngc = FALSE,
+  .id = 133,
+  .ra = 23.3148,
+  .dec = 30.8858,
+},
+{ .is_ngc = FALSE,
+  .id = 134,
+  .ra = 23.3545,
+  .dec = 30.8998,
+},
+{ .is_ngc = FALSE,
+  .id = 135,
+  .ra = 23.5662,
+  .dec = 30.6197,
+},
+{ .is_ngc = FALSE,
+  .id = 136,
+  .ra = 23.566,
+  .dec = 30.5619,
+},
+{ .is_ngc = FALSE,
+  .id = 137,
+  .ra = 23.4128,
+  .dec = 30.5223,
+},
+{ .is_ngc = FALSE,
+  .id = 138,
+  .ra = 23.2586,
+  .dec = -0.690194,
+},
+{ .is_ngc = FALSE,
+  .id = 139,
+  .ra = 23.4968,
+  .dec = 30.5674,
+},
+{ .is_ngc = FALSE,
+  .id = 140,
+  .ra = 23.4922,
+  .dec = 30.5506,
+},
+{ .is_ngc = FALSE,
+  .id = 141,
+  .ra = 23.2146,
+  .dec = -14.815,
+},
+{ .is_ngc = FALSE,
+  .id = 142,
+  .ra = 23.4821,
+  .dec = 30.7565,
+},
+{ .is_ngc = FALSE,
+  .id = 143,
+  .ra = 23.5467,
+  .dec = 30.7771,
+},
+{ .is_ngc = FALSE,
+  .id = 144,
+  .ra = 24.4205,
+  .dec = -13.3146,
+},
+{ .is_ngc = FALSE,
+  .id = 145,
+  .ra = 24.6612,
+  .dec = 0.741389,
+},
+{ .is_ngc = FALSE,
+  .id = 147,
+  .ra = 24.9989,
+  .dec = -14.8628,
+},
+{ .is_ngc = FALSE,
+  .id = 148,
+  .ra = 25.6129,
+  .dec = 13.9767,
+},
+{ .is_ngc = FALSE,
+  .id = 149,
+  .ra = 25.6067,
+  .dec = -16.3003,
+},
+{ .is_ngc = FALSE,
+  .id = 150,
+  .ra = 25.7398,
+  .dec = 4.19961,
+},
+{ .is_ngc = FALSE,
+  .id = 151,
+  .ra = 25.9875,
+  .dec = 13.2006,
+},
+{ .is_ngc = FALSE,
+  .id = 152,
+  .ra = 26.0292,
+  .dec = 13.0339,
+},
+{ .is_ngc = FALSE,
+  .id = 152,
+  .ra = 26.0054,
+  .dec = 13.0739,
+},
+{ .is_ngc = FALSE,
+  .id = 153,
+  .ra = 26.15,
+  .dec = 12.6186,
+},
+{ .is_ngc = FALSE,
+  .id = 154,
+  .ra = 26.318,
+  .dec = 10.6491,
+},
+{ .is_ngc = FALSE,
+  .id = 155,
+  .ra = 26.8833,
+  .dec = 60.6017,
+},
+{ .is_ngc = FALSE,
+  .id = 156,
+  .ra = 26.3717,
+  .dec = 10.5526,
+},
+{ .is_ngc = FALSE,
+  .id = 157,
+  .ra = 26.425,
+  .dec = 12.8678,
+},
+{ .is_ngc = FALSE,
+  .id = 158,
+  .ra = 26.4728,
+  .dec = -6.93566,
+},
+{ .is_ngc = FALSE,
+  .id = 159,
+  .ra = 26.6043,
+  .dec = -8.637,
+},
+{ .is_ngc = FALSE,
+  .id = 160,
+  .ra = 26.6224,
+  .dec = -13.2481,
+},
+{ .is_ngc = FALSE,
+  .id = 161,
+  .ra = 27.1828,
+  .dec = 10.5079,
+},
+{ .is_ngc = FALSE,
+  .id = 162,
+  .ra = 27.2228,
+  .dec = 10.5215,
+},
+{ .is_ngc = FALSE,
+  .id = 163,
+  .ra = 27.3132,
+  .dec = 20.7109,
+},
+{ .is_ngc = FALSE,
+  .id = 164,
+  .ra = 27.285,
+  .dec = -3.90472,
+},
+{ .is_ngc = FALSE,
+  .id = 166,
+  .ra = 28.0917,
+  .dec = 61.8506,
+},
+{ .is_ngc = FALSE,
+  .id = 167,
+  .ra = 27.7853,
+  .dec = 21.9128,
+},
+{ .is_ngc = FALSE,
+  .id = 168,
+  .ra = 27.6146,
+  .dec = -8.52342,
+},
+{ .is_ngc = FALSE,
+  .id = 169,
+  .ra = 27.664,
+  .dec = -12.6796,
+},
+{ .is_ngc = FALSE,
+  .id = 170,
+  .ra = 27.9891,
+  .dec = -8.51753,
+},
+{ .is_ngc = FALSE,
+  .id = 171,
+  .ra = 28.7931,
+  .dec = 35.2811,
+},
+{ .is_ngc = FALSE,
+  .id = 172,
+  .ra = 28.7258,
+  .dec = 0.811111,
+},
+{ .is_ngc = FALSE,
+  .id = 173,
+  .ra = 28.9881,
+  .dec = 1.28472,
+},
+{ .is_ngc = FALSE,
+  .id = 174,
+  .ra = 29.0671,
+  .dec = 3.76164,
+},
+{ .is_ngc = FALSE,
+  .id = 175,
+  .ra = 29.0785,
+  .dec = 1.33203,
+},
+{ .is_ngc = FALSE,
+  .id = 176,
+  .ra = 29.2226,
+  .dec = -2.01919,
+},
+{ .is_ngc = FALSE,
+  .id = 177,
+  .ra = 29.2523,
+  .dec = -0.0896667,
+},
+{ .is_ngc = FALSE,
+  .id = 178,
+  .ra = 29.7287,
+  .dec = 36.6749,
+},
+{ .is_ngc = FALSE,
+  .id = 179,
+  .ra = 30.0484,
+  .dec = 38.0208,
+},
+{ .is_ngc = FALSE,
+  .id = 180,
+  .ra = 30.0018,
+  .dec = 23.6042,
+},
+{ .is_ngc = FALSE,
+  .id = 181,
+  .ra = 30.0095,
+  .dec = 23.6588,
+},
+{ .is_ngc = FALSE,
+  .id = 182,
+  .ra = 29.9657,
+  .dec = 7.41153,
+},
+{ .is_ngc = FALSE,
+  .id = 183,
+  .ra = 29.8915,
+  .dec = -5.34686,
+},
+{ .is_ngc = FALSE,
+  .id = 184,
+  .ra = 29.9632,
+  .dec = -6.84081,
+},
+{ .is_ngc = FALSE,
+  .id = 185,
+  .ra = 30.0252,
+  .dec = -1.52825,
+},
+{ .is_ngc = FALSE,
+  .id = 186,
+  .ra = 30.1029,
+  .dec = -1.55117,
+},
+{ .is_ngc = FALSE,
+  .id = 188,
+  .ra = 30.4431,
+  .dec = 26.5459,
+},
+{ .is_ngc = FALSE,
+  .id = 189,
+  .ra = 30.4706,
+  .dec = 23.5511,
+},
+{ .is_ngc = FALSE,
+  .id = 190,
+  .ra = 30.5304,
+  .dec = 23.5497,
+},
+{ .is_ngc = FALSE,
+  .id = 192,
+  .ra = 30.635,
+  .dec = 16.014,
+},
+{ .is_ngc = FALSE,
+  .id = 193,
+  .ra = 30.6294,
+  .dec = 11.0927,
+},
+{ .is_ngc = FALSE,
+  .id = 194,
+  .ra = 30.7718,
+  .dec = 2.61361,
+},
+{ .is_ngc = FALSE,
+  .id = 195,
+  .ra = 30.9359,
+  .dec = 14.7087,
+},
+{ .is_ngc = FALSE,
+  .id = 196,
+  .ra = 30.9576,
+  .dec = 14.739,
+},
+{ .is_ngc = FALSE,
+  .id = 197,
+  .ra = 31.0208,
+  .dec = 2.78653,
+},
+{ .is_ngc = FALSE,
+  .id = 198,
+  .ra = 31.5131,
+  .dec = 9.2955,
+},
+{ .is_ngc = FALSE,
+  .id = 200,
+  .ra = 31.3613,
+  .dec = 31.1761,
+},
+{ .is_ngc = FALSE,
+  .id = 201,
+  .ra = 31.8137,
+  .dec = 9.11511,
+},
+{ .is_ngc = FALSE,
+  .id = 202,
+  .ra = 31.8693,
+  .dec = 9.16811,
+},
+{ .is_ngc = FALSE,
+  .id = 203,
+  .ra = 31.8732,
+  .dec = 9.12259,
+},
+{ .is_ngc = FALSE,
+  .id = 204,
+  .ra = 31.8628,
+  .dec = -1.43017,
+},
+{ .is_ngc = FALSE,
+  .id = 205,
+  .ra = 31.8644,
+  .dec = -2.09139,
+},
+{ .is_ngc = FALSE,
+  .id = 206,
+  .ra = 32.3783,
+  .dec = -6.96972,
+},
+{ .is_ngc = FALSE,
+  .id = 207,
+  .ra = 32.4142,
+  .dec = -6.92306,
+},
+{ .is_ngc = FALSE,
+  .id = 208,
+  .ra = 32.1158,
+  .dec = 6.39458,
+},
+{ .is_ngc = FALSE,
+  .id = 209,
+  .ra = 32.2442,
+  .dec = -7.05889,
+},
+{ .is_ngc = FALSE,
+  .id = 210,
+  .ra = 32.3679,
+  .dec = -9.68,
+},
+{ .is_ngc = FALSE,
+  .id = 211,
+  .ra = 32.7837,
+  .dec = 3.85217,
+},
+{ .is_ngc = FALSE,
+  .id = 212,
+  .ra = 33.4094,
+  .dec = 16.594,
+},
+{ .is_ngc = FALSE,
+  .id = 213,
+  .ra = 33.5178,
+  .dec = 16.4557,
+},
+{ .is_ngc = FALSE,
+  .id = 215,
+  .ra = 33.5392,
+  .dec = -6.80661,
+},
+{ .is_ngc = FALSE,
+  .id = 216,
+  .ra = 33.9808,
+  .dec = -2.01519,
+},
+{ .is_ngc = FALSE,
+  .id = 218,
+  .ra = 34.2802,
+  .dec = 1.28228,
+},
+{ .is_ngc = FALSE,
+  .id = 220,
+  .ra = 34.7995,
+  .dec = -12.7816,
+},
+{ .is_ngc = FALSE,
+  .id = 221,
+  .ra = 35.6707,
+  .dec = 28.2567,
+},
+{ .is_ngc = FALSE,
+  .id = 222,
+  .ra = 35.7,
+  .dec = 11.6378,
+},
+{ .is_ngc = FALSE,
+  .id = 223,
+  .ra = 35.5042,
+  .dec = -20.7459,
+},
+{ .is_ngc = FALSE,
+  .id = 224,
+  .ra = 36.1886,
+  .dec = -12.5643,
+},
+{ .is_ngc = FALSE,
+  .id = 226,
+  .ra = 36.9409,
+  .dec = 28.209,
+},
+{ .is_ngc = FALSE,
+  .id = 227,
+  .ra = 37.0149,
+  .dec = 28.175,
+},
+{ .is_ngc = FALSE,
+  .id = 229,
+  .ra = 36.8417,
+  .dec = -23.8022,
+},
+{ .is_ngc = FALSE,
+  .id = 230,
+  .ra = 37.1969,
+  .dec = -10.8314,
+},
+{ .is_ngc = FALSE,
+  .id = 231,
+  .ra = 37.4849,
+  .dec = 1.17889,
+},
+{ .is_ngc = FALSE,
+  .id = 232,
+  .ra = 37.7982,
+  .dec = 1.26549,
+},
+{ .is_ngc = FALSE,
+  .id = 233,
+  .ra = 37.9195,
+  .dec = 2.80994,
+},
+{ .is_ngc = FALSE,
+  .id = 234,
+  .ra = 37.9071,
+  .dec = -0.139444,
+},
+{ .is_ngc = FALSE,
+  .id = 235,
+  .ra = 38.2112,
+  .dec = 20.642,
+},
+{ .is_ngc = FALSE,
+  .id = 236,
+  .ra = 38.2326,
+  .dec = -0.131319,
+},
+{ .is_ngc = FALSE,
+  .id = 237,
+  .ra = 38.3815,
+  .dec = 1.13944,
+},
+{ .is_ngc = FALSE,
+  .id = 238,
+  .ra = 38.8448,
+  .dec = 12.8377,
+},
+{ .is_ngc = FALSE,
+  .id = 239,
+  .ra = 39.1162,
+  .dec = 38.9689,
+},
+{ .is_ngc = FALSE,
+  .id = 240,
+  .ra = 39.7433,
+  .dec = 41.7189,
+},
+{ .is_ngc = FALSE,
+  .id = 241,
+  .ra = 39.4767,
+  .dec = 2.32733,
+},
+{ .is_ngc = FALSE,
+  .id = 242,
+  .ra = 39.6,
+  .dec = -6.93389,
+},
+{ .is_ngc = FALSE,
+  .id = 243,
+  .ra = 39.6341,
+  .dec = -6.90242,
+},
+{ .is_ngc = FALSE,
+  .id = 244,
+  .ra = 39.853,
+  .dec = 2.72775,
+},
+{ .is_ngc = FALSE,
+  .id = 245,
+  .ra = 39.7272,
+  .dec = -14.3063,
+},
+{ .is_ngc = FALSE,
+  .id = 246,
+  .ra = 40.1192,
+  .dec = 2.4785,
+},
+{ .is_ngc = FALSE,
+  .id = 247,
+  .ra = 40.0366,
+  .dec = -11.7341,
+},
+{ .is_ngc = FALSE,
+  .id = 248,
+  .ra = 40.3571,
+  .dec = 17.8119,
+},
+{ .is_ngc = FALSE,
+  .id = 250,
+  .ra = 40.226,
+  .dec = -13.3139,
+},
+{ .is_ngc = FALSE,
+  .id = 251,
+  .ra = 40.3074,
+  .dec = -14.9581,
+},
+{ .is_ngc = FALSE,
+  .id = 252,
+  .ra = 40.4376,
+  .dec = -14.8491,
+},
+{ .is_ngc = FALSE,
+  .id = 253,
+  .ra = 40.5236,
+  .dec = -15.0471,
+},
+{ .is_ngc = FALSE,
+  .id = 254,
+  .ra = 40.5202,
+  .dec = -15.1072,
+},
+{ .is_ngc = FALSE,
+  .id = 255,
+  .ra = 41.7637,
+  .dec = 16.2881,
+},
+{ .is_ngc = FALSE,
+  .id = 257,
+  .ra = 42.4395,
+  .dec = 46.9761,
+},
+{ .is_ngc = FALSE,
+  .id = 258,
+  .ra = 42.4416,
+  .dec = 41.0517,
+},
+{ .is_ngc = FALSE,
+  .id = 259,
+  .ra = 42.4203,
+  .dec = 41.0551,
+},
+{ .is_ngc = FALSE,
+  .id = 260,
+  .ra = 42.7539,
+  .dec = 46.9547,
+},
+{ .is_ngc = FALSE,
+  .id = 262,
+  .ra = 42.9303,
+  .dec = 42.8282,
+},
+{ .is_ngc = FALSE,
+  .id = 263,
+  .ra = 42.4165,
+  .dec = -0.0697778,
+},
+{ .is_ngc = FALSE,
+  .id = 264,
+  .ra = 42.1985,
+  .dec = -0.108861,
+},
+{ .is_ngc = FALSE,
+  .id = 265,
+  .ra = 43.6834,
+  .dec = 41.6554,
+},
+{ .is_ngc = FALSE,
+  .id = 266,
+  .ra = 43.7696,
+  .dec = 42.263,
+},
+{ .is_ngc = FALSE,
+  .id = 267,
+  .ra = 43.4592,
+  .dec = 12.849,
+},
+{ .is_ngc = FALSE,
+  .id = 268,
+  .ra = 43.862,
+  .dec = -14.1033,
+},
+{ .is_ngc = FALSE,
+  .id = 269,
+  .ra = 43.8602,
+  .dec = -14.0669,
+},
+{ .is_ngc = FALSE,
+  .id = 270,
+  .ra = 43.9339,
+  .dec = -14.208,
+},
+{ .is_ngc = FALSE,
+  .id = 271,
+  .ra = 43.9976,
+  .dec = -12.0084,
+},
+{ .is_ngc = FALSE,
+  .id = 272,
+  .ra = 44.0264,
+  .dec = -14.1872,
+},
+{ .is_ngc = FALSE,
+  .id = 273,
+  .ra = 44.2948,
+  .dec = 2.77525,
+},
+{ .is_ngc = FALSE,
+  .id = 274,
+  .ra = 45.0737,
+  .dec = 44.2267,
+},
+{ .is_ngc = FALSE,
+  .id = 276,
+  .ra = 44.6721,
+  .dec = -15.7033,
+},
+{ .is_ngc = FALSE,
+  .id = 277,
+  .ra = 44.9604,
+  .dec = 2.77117,
+},
+{ .is_ngc = FALSE,
+  .id = 278,
+  .ra = 45.377,
+  .dec = 37.7657,
+},
+{ .is_ngc = FALSE,
+  .id = 279,
+  .ra = 45.3008,
+  .dec = 16.209,
+},
+{ .is_ngc = FALSE,
+  .id = 280,
+  .ra = 45.7638,
+  .dec = 42.3587,
+},
+{ .is_ngc = FALSE,
+  .id = 283,
+  .ra = 45.96,
+  .dec = -0.204444,
+},
+{ .is_ngc = FALSE,
+  .id = 284,
+  .ra = 46.5415,
+  .dec = 42.3717,
+},
+{ .is_ngc = FALSE,
+  .id = 285,
+  .ra = 46.0259,
+  .dec = -12.0153,
+},
+{ .is_ngc = FALSE,
+  .id = 286,
+  .ra = 46.1958,
+  .dec = -6.48361,
+},
+{ .is_ngc = FALSE,
+  .id = 287,
+  .ra = 46.2409,
+  .dec = -12.0703,
+},
+{ .is_ngc = FALSE,
+  .id = 288,
+  .ra = 46.887,
+  .dec = 42.3872,
+},
+{ .is_ngc = FALSE,
+  .id = 289,
+  .ra = 47.5803,
+  .dec = 61.3171,
+},
+{ .is_ngc = FALSE,
+  .id = 291,
+  .ra = 46.8608,
+  .dec = -12.5872,
+},
+{ .is_ngc = FALSE,
+  .id = 295,
+  .ra = 47.75,
+  .dec = 40.6025,
+},
+{ .is_ngc = FALSE,
+  .id = 296,
+  .ra = 47.7667,
+  .dec = 40.6183,
+},
+{ .is_ngc = FALSE,
+  .id = 297,
+  .ra = 48.3267,
+  .dec = 42.1486,
+},
+{ .is_ngc = FALSE,
+  .id = 299,
+  .ra = 47.7607,
+  .dec = -13.1095,
+},
+{ .is_ngc = FALSE,
+  .id = 300,
+  .ra = 48.5663,
+  .dec = 42.4153,
+},
+{ .is_ngc = FALSE,
+  .id = 301,
+  .ra = 48.6989,
+  .dec = 42.2223,
+},
+{ .is_ngc = FALSE,
+  .id = 302,
+  .ra = 48.2143,
+  .dec = 4.70603,
+},
+{ .is_ngc = FALSE,
+  .id = 303,
+  .ra = 48.1695,
+  .dec = -11.6898,
+},
+{ .is_ngc = FALSE,
+  .id = 304,
+  .ra = 48.7555,
+  .dec = 37.8815,
+},
+{ .is_ngc = FALSE,
+  .id = 305,
+  .ra = 48.766,
+  .dec = 37.8598,
+},
+{ .is_ngc = FALSE,
+  .id = 306,
+  .ra = 48.2496,
+  .dec = -11.7159,
+},
+{ .is_ngc = FALSE,
+  .id = 307,
+  .ra = 48.4383,
+  .dec = -0.241556,
+},
+{ .is_ngc = FALSE,
+  .id = 308,
+  .ra = 49.0662,
+  .dec = 41.1803,
+},
+{ .is_ngc = FALSE,
+  .id = 309,
+  .ra = 49.0258,
+  .dec = 40.8042,
+},
+{ .is_ngc = FALSE,
+  .id = 310,
+  .ra = 49.1789,
+  .dec = 41.3248,
+},
+{ .is_ngc = FALSE,
+  .id = 311,
+  .ra = 49.1948,
+  .dec = 40.0036,
+},
+{ .is_ngc = FALSE,
+  .id = 312,
+  .ra = 49.5354,
+  .dec = 41.7541,
+},
+{ .is_ngc = FALSE,
+  .id = 313,
+  .ra = 50.242,
+  .dec = 41.8936,
+},
+{ .is_ngc = FALSE,
+  .id = 315,
+  .ra = 49.7889,
+  .dec = 4.03836,
+},
+{ .is_ngc = FALSE,
+  .id = 317,
+  .ra = 49.7311,
+  .dec = -12.7401,
+},
+{ .is_ngc = FALSE,
+  .id = 318,
+  .ra = 50.1826,
+  .dec = -14.5684,
+},
+{ .is_ngc = FALSE,
+  .id = 319,
+  .ra = 50.8713,
+  .dec = 41.4161,
+},
+{ .is_ngc = FALSE,
+  .id = 320,
+  .ra = 51.4965,
+  .dec = 40.7888,
+},
+{ .is_ngc = FALSE,
+  .id = 321,
+  .ra = 51.1233,
+  .dec = -14.9859,
+},
+{ .is_ngc = FALSE,
+  .id = 322,
+  .ra = 51.5021,
+  .dec = 3.68028,
+},
+{ .is_ngc = FALSE,
+  .id = 323,
+  .ra = 52.3896,
+  .dec = 41.8553,
+},
+{ .is_ngc = FALSE,
+  .id = 325,
+  .ra = 52.7035,
+  .dec = -7.0468,
+},
+{ .is_ngc = FALSE,
+  .id = 326,
+  .ra = 52.6526,
+  .dec = -14.4261,
+},
+{ .is_ngc = FALSE,
+  .id = 327,
+  .ra = 52.7919,
+  .dec = -14.6924,
+},
+{ .is_ngc = FALSE,
+  .id = 328,
+  .ra = 52.7958,
+  .dec = -14.6382,
+},
+{ .is_ngc = FALSE,
+  .id = 329,
+  .ra = 53.0055,
+  .dec = 0.27935,
+},
+{ .is_ngc = FALSE,
+  .id = 330,
+  .ra = 53.0332,
+  .dec = 0.352944,
+},
+{ .is_ngc = FALSE,
+  .id = 331,
+  .ra = 53.0792,
+  .dec = 0.282333,
+},
+{ .is_ngc = FALSE,
+  .id = 332,
+  .ra = 53.1559,
+  .dec = 1.38234,
+},
+{ .is_ngc = FALSE,
+  .id = 333,
+  .ra = 53.5125,
+  .dec = -4.58361,
+},
+{ .is_ngc = FALSE,
+  .id = 334,
+  .ra = 56.321,
+  .dec = 76.6374,
+},
+{ .is_ngc = FALSE,
+  .id = 336,
+  .ra = 54.25,
+  .dec = 23.0667,
+},
+{ .is_ngc = FALSE,
+  .id = 337,
+  .ra = 54.2667,
+  .dec = -6.7175,
+},
+{ .is_ngc = FALSE,
+  .id = 337,
+  .ra = 54.389,
+  .dec = -6.52039,
+},
+{ .is_ngc = FALSE,
+  .id = 338,
+  .ra = 54.4087,
+  .dec = 3.11817,
+},
+{ .is_ngc = FALSE,
+  .id = 339,
+  .ra = 54.5079,
+  .dec = -18.3981,
+},
+{ .is_ngc = FALSE,
+  .id = 340,
+  .ra = 54.8708,
+  .dec = -13.1153,
+},
+{ .is_ngc = FALSE,
+  .id = 341,
+  .ra = 55,
+  .dec = 22,
+},
+{ .is_ngc = FALSE,
+  .id = 342,
+  .ra = 56.7025,
+  .dec = 68.0962,
+},
+{ .is_ngc = FALSE,
+  .id = 343,
+  .ra = 55.0296,
+  .dec = -18.4433,
+},
+{ .is_ngc = FALSE,
+  .id = 344,
+  .ra = 55.3728,
+  .dec = -4.66583,
+},
+{ .is_ngc = FALSE,
+  .id = 345,
+  .ra = 55.2874,
+  .dec = -18.3142,
+},
+{ .is_ngc = FALSE,
+  .id = 346,
+  .ra = 55.4362,
+  .dec = -18.2671,
+},
+{ .is_ngc = FALSE,
+  .id = 347,
+  .ra = 55.6354,
+  .dec = -4.29889,
+},
+{ .is_ngc = FALSE,
+  .id = 349,
+  .ra = 56.5838,
+  .dec = 23.9397,
+},
+{ .is_ngc = FALSE,
+  .id = 350,
+  .ra = 56.1526,
+  .dec = -11.801,
+},
+{ .is_ngc = FALSE,
+  .id = 351,
+  .ra = 56.8873,
+  .dec = 35.0468,
+},
+{ .is_ngc = FALSE,
+  .id = 352,
+  .ra = 56.9057,
+  .dec = -8.73183,
+},
+{ .is_ngc = FALSE,
+  .id = 353,
+  .ra = 58.25,
+  .dec = 25.1333,
+},
+{ .is_ngc = FALSE,
+  .id = 354,
+  .ra = 58.25,
+  .dec = 23.0167,
+},
+{ .is_ngc = FALSE,
+  .id = 355,
+  .ra = 58.4426,
+  .dec = 19.9738,
+},
+{ .is_ngc = FALSE,
+  .id = 356,
+  .ra = 61.9444,
+  .dec = 69.8122,
+},
+{ .is_ngc = FALSE,
+  .id = 357,
+  .ra = 60.9338,
+  .dec = 22.1593,
+},
+{ .is_ngc = FALSE,
+  .id = 358,
+  .ra = 60.9289,
+  .dec = 19.8948,
+},
+{ .is_ngc = FALSE,
+  .id = 359,
+  .ra = 63.1181,
+  .dec = 27.7023,
+},
+{ .is_ngc = FALSE,
+  .id = 360,
+  .ra = 62.25,
+  .dec = 26.0167,
+},
+{ .is_ngc = FALSE,
+  .id = 361,
+  .ra = 64.7083,
+  .dec = 58.25,
+},
+{ .is_ngc = FALSE,
+  .id = 362,
+  .ra = 64.1771,
+  .dec = -12.2001,
+},
+{ .is_ngc = FALSE,
+  .id = 363,
+  .ra = 64.7305,
+  .dec = 3.03247,
+},
+{ .is_ngc = FALSE,
+  .id = 364,
+  .ra = 64.7779,
+  .dec = 3.18851,
+},
+{ .is_ngc = FALSE,
+  .id = 365,
+  .ra = 64.8089,
+  .dec = 3.34797,
+},
+{ .is_ngc = FALSE,
+  .id = 366,
+  .ra = 64.923,
+  .dec = 2.35966,
+},
+{ .is_ngc = FALSE,
+  .id = 367,
+  .ra = 65.1708,
+  .dec = -14.7817,
+},
+{ .is_ngc = FALSE,
+  .id = 368,
+  .ra = 65.6778,
+  .dec = -12.6149,
+},
+{ .is_ngc = FALSE,
+  .id = 369,
+  .ra = 65.8675,
+  .dec = -11.7901,
+},
+{ .is_ngc = FALSE,
+  .id = 370,
+  .ra = 66.0075,
+  .dec = -9.39556,
+},
+{ .is_ngc = FALSE,
+  .id = 371,
+  .ra = 67.5525,
+  .dec = -0.561,
+},
+{ .is_ngc = FALSE,
+  .id = 372,
+  .ra = 67.5176,
+  .dec = -5.01022,
+},
+{ .is_ngc = FALSE,
+  .id = 373,
+  .ra = 67.6783,
+  .dec = -4.871,
+},
+{ .is_ngc = FALSE,
+  .id = 374,
+  .ra = 68.1367,
+  .dec = 16.6342,
+},
+{ .is_ngc = FALSE,
+  .id = 375,
+  .ra = 67.763,
+  .dec = -12.9742,
+},
+{ .is_ngc = FALSE,
+  .id = 376,
+  .ra = 67.8064,
+  .dec = -12.4337,
+},
+{ .is_ngc = FALSE,
+  .id = 377,
+  .ra = 67.8183,
+  .dec = -12.4553,
+},
+{ .is_ngc = FALSE,
+  .id = 378,
+  .ra = 67.8667,
+  .dec = -12.2996,
+},
+{ .is_ngc = FALSE,
+  .id = 379,
+  .ra = 67.9621,
+  .dec = -7.2384,
+},
+{ .is_ngc = FALSE,
+  .id = 380,
+  .ra = 67.922,
+  .dec = -12.9274,
+},
+{ .is_ngc = FALSE,
+  .id = 382,
+  .ra = 69.4813,
+  .dec = -9.51944,
+},
+{ .is_ngc = FALSE,
+  .id = 383,
+  .ra = 69.7418,
+  .dec = 9.89225,
+},
+{ .is_ngc = FALSE,
+  .id = 384,
+  .ra = 69.826,
+  .dec = -7.83922,
+},
+{ .is_ngc = FALSE,
+  .id = 385,
+  .ra = 69.8809,
+  .dec = -7.09765,
+},
+{ .is_ngc = FALSE,
+  .id = 387,
+  .ra = 70.4342,
+  .dec = -7.08667,
+},
+{ .is_ngc = FALSE,
+  .id = 389,
+  .ra = 70.4985,
+  .dec = -7.31166,
+},
+{ .is_ngc = FALSE,
+  .id = 390,
+  .ra = 70.5161,
+  .dec = -7.20665,
+},
+{ .is_ngc = FALSE,
+  .id = 391,
+  .ra = 74.3416,
+  .dec = 78.1897,
+},
+{ .is_ngc = FALSE,
+  .id = 392,
+  .ra = 71.6076,
+  .dec = 3.50553,
+},
+{ .is_ngc = FALSE,
+  .id = 393,
+  .ra = 71.9657,
+  .dec = -15.5255,
+},
+{ .is_ngc = FALSE,
+  .id = 394,
+  .ra = 72.0333,
+  .dec = -6.26667,
+},
+{ .is_ngc = FALSE,
+  .id = 396,
+  .ra = 74.4955,
+  .dec = 68.3226,
+},
+{ .is_ngc = FALSE,
+  .id = 397,
+  .ra = 75.2773,
+  .dec = 40.4247,
+},
+{ .is_ngc = FALSE,
+  .id = 398,
+  .ra = 74.5525,
+  .dec = -7.78056,
+},
+{ .is_ngc = FALSE,
+  .id = 399,
+  .ra = 75.4333,
+  .dec = -4.28889,
+},
+{ .is_ngc = FALSE,
+  .id = 400,
+  .ra = 75.9401,
+  .dec = -15.8196,
+},
+{ .is_ngc = FALSE,
+  .id = 400,
+  .ra = 75.9358,
+  .dec = -15.7658,
+},
+{ .is_ngc = FALSE,
+  .id = 401,
+  .ra = 76.0825,
+  .dec = -10.0758,
+},
+{ .is_ngc = FALSE,
+  .id = 402,
+  .ra = 76.5615,
+  .dec = -9.10758,
+},
+{ .is_ngc = FALSE,
+  .id = 403,
+  .ra = 78.8157,
+  .dec = 39.9721,
+},
+{ .is_ngc = FALSE,
+  .id = 404,
+  .ra = 78.332,
+  .dec = 9.75469,
+},
+{ .is_ngc = FALSE,
+  .id = 405,
+  .ra = 79.1208,
+  .dec = 34.3511,
+},
+{ .is_ngc = FALSE,
+  .id = 406,
+  .ra = 79.4542,
+  .dec = 39.886,
+},
+{ .is_ngc = FALSE,
+  .id = 407,
+  .ra = 79.4275,
+  .dec = -15.5236,
+},
+{ .is_ngc = FALSE,
+  .id = 408,
+  .ra = 79.5175,
+  .dec = -25.1716,
+},
+{ .is_ngc = FALSE,
+  .id = 409,
+  .ra = 79.89,
+  .dec = 3.31722,
+},
+{ .is_ngc = FALSE,
+  .id = 410,
+  .ra = 80.6833,
+  .dec = 33.4019,
+},
+{ .is_ngc = FALSE,
+  .id = 411,
+  .ra = 80.075,
+  .dec = -25.3244,
+},
+{ .is_ngc = FALSE,
+  .id = 414,
+  .ra = 80.479,
+  .dec = 3.34208,
+},
+{ .is_ngc = FALSE,
+  .id = 415,
+  .ra = 80.3398,
+  .dec = -15.5427,
+},
+{ .is_ngc = FALSE,
+  .id = 416,
+  .ra = 80.985,
+  .dec = -17.2606,
+},
+{ .is_ngc = FALSE,
+  .id = 417,
+  .ra = 82.025,
+  .dec = 34.4178,
+},
+{ .is_ngc = FALSE,
+  .id = 418,
+  .ra = 81.8676,
+  .dec = -12.6972,
+},
+{ .is_ngc = FALSE,
+  .id = 419,
+  .ra = 82.7168,
+  .dec = 30.1179,
+},
+{ .is_ngc = FALSE,
+  .id = 420,
+  .ra = 83.0375,
+  .dec = -4.50083,
+},
+{ .is_ngc = FALSE,
+  .id = 421,
+  .ra = 83.0357,
+  .dec = -7.91805,
+},
+{ .is_ngc = FALSE,
+  .id = 423,
+  .ra = 83.3417,
+  .dec = -0.6025,
+},
+{ .is_ngc = FALSE,
+  .id = 424,
+  .ra = 83.4042,
+  .dec = -0.402222,
+},
+{ .is_ngc = FALSE,
+  .id = 425,
+  .ra = 84.2583,
+  .dec = 32.4167,
+},
+{ .is_ngc = FALSE,
+  .id = 426,
+  .ra = 84.1292,
+  .dec = -0.285833,
+},
+{ .is_ngc = FALSE,
+  .id = 427,
+  .ra = 84.075,
+  .dec = -6.61667,
+},
+{ .is_ngc = FALSE,
+  .id = 428,
+  .ra = 84.1,
+  .dec = -6.45028,
+},
+{ .is_ngc = FALSE,
+  .id = 429,
+  .ra = 84.582,
+  .dec = -7.04136,
+},
+{ .is_ngc = FALSE,
+  .id = 430,
+  .ra = 84.6383,
+  .dec = -7.08528,
+},
+{ .is_ngc = FALSE,
+  .id = 433,
+  .ra = 85.1301,
+  .dec = -11.6658,
+},
+{ .is_ngc = FALSE,
+  .id = 435,
+  .ra = 85.7523,
+  .dec = -2.31261,
+},
+{ .is_ngc = FALSE,
+  .id = 437,
+  .ra = 87.9058,
+  .dec = -12.5651,
+},
+{ .is_ngc = FALSE,
+  .id = 438,
+  .ra = 88.2508,
+  .dec = -17.8761,
+},
+{ .is_ngc = FALSE,
+  .id = 439,
+  .ra = 89.0292,
+  .dec = 32.0167,
+},
+{ .is_ngc = FALSE,
+  .id = 440,
+  .ra = 94.8039,
+  .dec = 80.0685,
+},
+{ .is_ngc = FALSE,
+  .id = 441,
+  .ra = 90.6778,
+  .dec = -12.4996,
+},
+{ .is_ngc = FALSE,
+  .id = 442,
+  .ra = 99.0504,
+  .dec = 82.968,
+},
+{ .is_ngc = FALSE,
+  .id = 443,
+  .ra = 94.025,
+  .dec = 22.5167,
+},
+{ .is_ngc = FALSE,
+  .id = 444,
+  .ra = 95.2542,
+  .dec = 23.1,
+},
+{ .is_ngc = FALSE,
+  .id = 445,
+  .ra = 99.3384,
+  .dec = 67.8596,
+},
+{ .is_ngc = FALSE,
+  .id = 448,
+  .ra = 98.1875,
+  .dec = 7.38417,
+},
+{ .is_ngc = FALSE,
+  .id = 449,
+  .ra = 101.423,
+  .dec = 71.3436,
+},
+{ .is_ngc = FALSE,
+  .id = 450,
+  .ra = 103.052,
+  .dec = 74.427,
+},
+{ .is_ngc = FALSE,
+  .id = 451,
+  .ra = 103.217,
+  .dec = 74.4805,
+},
+{ .is_ngc = FALSE,
+  .id = 453,
+  .ra = 102.298,
+  .dec = -16.9068,
+},
+{ .is_ngc = FALSE,
+  .id = 454,
+  .ra = 102.777,
+  .dec = 12.9217,
+},
+{ .is_ngc = FALSE,
+  .id = 455,
+  .ra = 113.742,
+  .dec = 85.5368,
+},
+{ .is_ngc = FALSE,
+  .id = 456,
+  .ra = 105.074,
+  .dec = -30.1631,
+},
+{ .is_ngc = FALSE,
+  .id = 458,
+  .ra = 107.642,
+  .dec = 50.1187,
+},
+{ .is_ngc = FALSE,
+  .id = 459,
+  .ra = 107.661,
+  .dec = 50.1772,
+},
+{ .is_ngc = FALSE,
+  .id = 460,
+  .ra = 107.684,
+  .dec = 50.2019,
+},
+{ .is_ngc = FALSE,
+  .id = 461,
+  .ra = 107.688,
+  .dec = 50.081,
+},
+{ .is_ngc = FALSE,
+  .id = 462,
+  .ra = 107.733,
+  .dec = 50.1808,
+},
+{ .is_ngc = FALSE,
+  .id = 463,
+  .ra = 107.754,
+  .dec = 50.1174,
+},
+{ .is_ngc = FALSE,
+  .id = 464,
+  .ra = 107.77,
+  .dec = 50.1364,
+},
+{ .is_ngc = FALSE,
+  .id = 466,
+  .ra = 107.163,
+  .dec = -4.31744,
+},
+{ .is_ngc = FALSE,
+  .id = 467,
+  .ra = 112.576,
+  .dec = 79.8724,
+},
+{ .is_ngc = FALSE,
+  .id = 468,
+  .ra = 109.329,
+  .dec = -13.2188,
+},
+{ .is_ngc = FALSE,
+  .id = 469,
+  .ra = 118.997,
+  .dec = 85.1589,
+},
+{ .is_ngc = FALSE,
+  .id = 470,
+  .ra = 110.881,
+  .dec = 46.0785,
+},
+{ .is_ngc = FALSE,
+  .id = 471,
+  .ra = 115.902,
+  .dec = 49.6672,
+},
+{ .is_ngc = FALSE,
+  .id = 472,
+  .ra = 115.959,
+  .dec = 49.6137,
+},
+{ .is_ngc = FALSE,
+  .id = 473,
+  .ra = 115.603,
+  .dec = 9.25528,
+},
+{ .is_ngc = FALSE,
+  .id = 474,
+  .ra = 116.53,
+  .dec = 26.5044,
+},
+{ .is_ngc = FALSE,
+  .id = 475,
+  .ra = 116.788,
+  .dec = 30.4886,
+},
+{ .is_ngc = FALSE,
+  .id = 476,
+  .ra = 116.818,
+  .dec = 26.9506,
+},
+{ .is_ngc = FALSE,
+  .id = 477,
+  .ra = 118.029,
+  .dec = 23.4827,
+},
+{ .is_ngc = FALSE,
+  .id = 478,
+  .ra = 118.423,
+  .dec = 26.4922,
+},
+{ .is_ngc = FALSE,
+  .id = 479,
+  .ra = 118.593,
+  .dec = 27.0075,
+},
+{ .is_ngc = FALSE,
+  .id = 480,
+  .ra = 118.847,
+  .dec = 26.7421,
+},
+{ .is_ngc = FALSE,
+  .id = 481,
+  .ra = 119.762,
+  .dec = 24.1599,
+},
+{ .is_ngc = FALSE,
+  .id = 482,
+  .ra = 119.947,
+  .dec = 25.3563,
+},
+{ .is_ngc = FALSE,
+  .id = 483,
+  .ra = 119.968,
+  .dec = 25.9248,
+},
+{ .is_ngc = FALSE,
+  .id = 484,
+  .ra = 120.005,
+  .dec = 26.6654,
+},
+{ .is_ngc = FALSE,
+  .id = 485,
+  .ra = 120.083,
+  .dec = 26.7015,
+},
+{ .is_ngc = FALSE,
+  .id = 486,
+  .ra = 120.087,
+  .dec = 26.6136,
+},
+{ .is_ngc = FALSE,
+  .id = 488,
+  .ra = 120.203,
+  .dec = 25.9072,
+},
+{ .is_ngc = FALSE,
+  .id = 488,
+  .ra = 120.207,
+  .dec = 25.9024,
+},
+{ .is_ngc = FALSE,
+  .id = 488,
+  .ra = 120.218,
+  .dec = 25.8994,
+},
+{ .is_ngc = FALSE,
+  .id = 489,
+  .ra = 120.407,
+  .dec = 25.9964,
+},
+{ .is_ngc = FALSE,
+  .id = 490,
+  .ra = 120.834,
+  .dec = 25.8107,
+},
+{ .is_ngc = FALSE,
+  .id = 491,
+  .ra = 120.979,
+  .dec = 26.5198,
+},
+{ .is_ngc = FALSE,
+  .id = 492,
+  .ra = 121.411,
+  .dec = 26.1669,
+},
+{ .is_ngc = FALSE,
+  .id = 493,
+  .ra = 121.865,
+  .dec = 25.1332,
+},
+{ .is_ngc = FALSE,
+  .id = 494,
+  .ra = 121.601,
+  .dec = 1.03581,
+},
+{ .is_ngc = FALSE,
+  .id = 495,
+  .ra = 122.08,
+  .dec = 9.01374,
+},
+{ .is_ngc = FALSE,
+  .id = 497,
+  .ra = 122.525,
+  .dec = 24.9218,
+},
+{ .is_ngc = FALSE,
+  .id = 498,
+  .ra = 122.376,
+  .dec = 5.27986,
+},
+{ .is_ngc = FALSE,
+  .id = 499,
+  .ra = 131.324,
+  .dec = 85.74,
+},
+{ .is_ngc = FALSE,
+  .id = 500,
+  .ra = 123.165,
+  .dec = -16.0512,
+},
+{ .is_ngc = FALSE,
+  .id = 501,
+  .ra = 124.698,
+  .dec = 24.5373,
+},
+{ .is_ngc = FALSE,
+  .id = 502,
+  .ra = 125.515,
+  .dec = 8.75256,
+},
+{ .is_ngc = FALSE,
+  .id = 503,
+  .ra = 125.544,
+  .dec = 3.26806,
+},
+{ .is_ngc = FALSE,
+  .id = 504,
+  .ra = 125.671,
+  .dec = 4.26225,
+},
+{ .is_ngc = FALSE,
+  .id = 505,
+  .ra = 125.84,
+  .dec = 4.37239,
+},
+{ .is_ngc = FALSE,
+  .id = 506,
+  .ra = 125.878,
+  .dec = 4.29912,
+},
+{ .is_ngc = FALSE,
+  .id = 508,
+  .ra = 127.093,
+  .dec = 25.1246,
+},
+{ .is_ngc = FALSE,
+  .id = 509,
+  .ra = 128.015,
+  .dec = 24.0104,
+},
+{ .is_ngc = FALSE,
+  .id = 511,
+  .ra = 130.208,
+  .dec = 73.4864,
+},
+{ .is_ngc = FALSE,
+  .id = 512,
+  .ra = 135.958,
+  .dec = 85.5014,
+},
+{ .is_ngc = FALSE,
+  .id = 513,
+  .ra = 128.271,
+  .dec = -12.3555,
+},
+{ .is_ngc = FALSE,
+  .id = 514,
+  .ra = 128.843,
+  .dec = -2.04694,
+},
+{ .is_ngc = FALSE,
+  .id = 515,
+  .ra = 128.88,
+  .dec = -1.90099,
+},
+{ .is_ngc = FALSE,
+  .id = 516,
+  .ra = 128.961,
+  .dec = -1.87075,
+},
+{ .is_ngc = FALSE,
+  .id = 517,
+  .ra = 129.092,
+  .dec = -2.05575,
+},
+{ .is_ngc = FALSE,
+  .id = 518,
+  .ra = 129.029,
+  .dec = 0.6925,
+},
+{ .is_ngc = FALSE,
+  .id = 519,
+  .ra = 130.143,
+  .dec = 2.61098,
+},
+{ .is_ngc = FALSE,
+  .id = 520,
+  .ra = 133.425,
+  .dec = 73.4908,
+},
+{ .is_ngc = FALSE,
+  .id = 521,
+  .ra = 131.684,
+  .dec = 2.53714,
+},
+{ .is_ngc = FALSE,
+  .id = 522,
+  .ra = 133.647,
+  .dec = 57.1668,
+},
+{ .is_ngc = FALSE,
+  .id = 523,
+  .ra = 133.297,
+  .dec = 9.14789,
+},
+{ .is_ngc = FALSE,
+  .id = 524,
+  .ra = 134.554,
+  .dec = -19.1925,
+},
+{ .is_ngc = FALSE,
+  .id = 525,
+  .ra = 135.344,
+  .dec = -1.85353,
+},
+{ .is_ngc = FALSE,
+  .id = 526,
+  .ra = 135.67,
+  .dec = 10.8415,
+},
+{ .is_ngc = FALSE,
+  .id = 527,
+  .ra = 137.424,
+  .dec = 37.6013,
+},
+{ .is_ngc = FALSE,
+  .id = 528,
+  .ra = 137.344,
+  .dec = 15.7959,
+},
+{ .is_ngc = FALSE,
+  .id = 529,
+  .ra = 139.636,
+  .dec = 73.7593,
+},
+{ .is_ngc = FALSE,
+  .id = 530,
+  .ra = 138.821,
+  .dec = 11.8856,
+},
+{ .is_ngc = FALSE,
+  .id = 531,
+  .ra = 139.462,
+  .dec = -0.278694,
+},
+{ .is_ngc = FALSE,
+  .id = 532,
+  .ra = 139.762,
+  .dec = -16.7508,
+},
+{ .is_ngc = FALSE,
+  .id = 533,
+  .ra = 140.097,
+  .dec = -3.992,
+},
+{ .is_ngc = FALSE,
+  .id = 533,
+  .ra = 140.091,
+  .dec = -7.88139,
+},
+{ .is_ngc = FALSE,
+  .id = 534,
+  .ra = 140.314,
+  .dec = 3.15022,
+},
+{ .is_ngc = FALSE,
+  .id = 535,
+  .ra = 140.568,
+  .dec = -1.0405,
+},
+{ .is_ngc = FALSE,
+  .id = 536,
+  .ra = 141.167,
+  .dec = 25.1106,
+},
+{ .is_ngc = FALSE,
+  .id = 537,
+  .ra = 141.344,
+  .dec = -12.392,
+},
+{ .is_ngc = FALSE,
+  .id = 539,
+  .ra = 142.284,
+  .dec = -2.54908,
+},
+{ .is_ngc = FALSE,
+  .id = 540,
+  .ra = 142.542,
+  .dec = 7.90183,
+},
+{ .is_ngc = FALSE,
+  .id = 541,
+  .ra = 142.521,
+  .dec = -4.25,
+},
+{ .is_ngc = FALSE,
+  .id = 542,
+  .ra = 142.776,
+  .dec = -13.1817,
+},
+{ .is_ngc = FALSE,
+  .id = 543,
+  .ra = 142.787,
+  .dec = -14.7678,
+},
+{ .is_ngc = FALSE,
+  .id = 544,
+  .ra = 143.972,
+  .dec = 24.8931,
+},
+{ .is_ngc = FALSE,
+  .id = 545,
+  .ra = 144.023,
+  .dec = 24.9481,
+},
+{ .is_ngc = FALSE,
+  .id = 546,
+  .ra = 143.709,
+  .dec = -16.385,
+},
+{ .is_ngc = FALSE,
+  .id = 548,
+  .ra = 144.581,
+  .dec = 9.44556,
+},
+{ .is_ngc = FALSE,
+  .id = 549,
+  .ra = 145.18,
+  .dec = 3.95919,
+},
+{ .is_ngc = FALSE,
+  .id = 550,
+  .ra = 145.119,
+  .dec = -6.94619,
+},
+{ .is_ngc = FALSE,
+  .id = 551,
+  .ra = 145.25,
+  .dec = 6.936,
+},
+{ .is_ngc = FALSE,
+  .id = 552,
+  .ra = 145.319,
+  .dec = 10.6463,
+},
+{ .is_ngc = FALSE,
+  .id = 553,
+  .ra = 145.187,
+  .dec = -5.43583,
+},
+{ .is_ngc = FALSE,
+  .id = 557,
+  .ra = 146.01,
+  .dec = 10.9875,
+},
+{ .is_ngc = FALSE,
+  .id = 558,
+  .ra = 146.251,
+  .dec = 29.452,
+},
+{ .is_ngc = FALSE,
+  .id = 559,
+  .ra = 146.183,
+  .dec = 9.61511,
+},
+{ .is_ngc = FALSE,
+  .id = 560,
+  .ra = 146.473,
+  .dec = -0.268833,
+},
+{ .is_ngc = FALSE,
+  .id = 561,
+  .ra = 146.495,
+  .dec = 3.1445,
+},
+{ .is_ngc = FALSE,
+  .id = 562,
+  .ra = 146.516,
+  .dec = -3.97194,
+},
+{ .is_ngc = FALSE,
+  .id = 563,
+  .ra = 146.584,
+  .dec = 3.04514,
+},
+{ .is_ngc = FALSE,
+  .id = 564,
+  .ra = 146.588,
+  .dec = 3.07092,
+},
+{ .is_ngc = FALSE,
+  .id = 565,
+  .ra = 146.96,
+  .dec = 15.8513,
+},
+{ .is_ngc = FALSE,
+  .id = 566,
+  .ra = 147.485,
+  .dec = -0.231742,
+},
+{ .is_ngc = FALSE,
+  .id = 567,
+  .ra = 147.641,
+  .dec = 12.7839,
+},
+{ .is_ngc = FALSE,
+  .id = 568,
+  .ra = 147.785,
+  .dec = 15.7301,
+},
+{ .is_ngc = FALSE,
+  .id = 569,
+  .ra = 147.867,
+  .dec = 10.9197,
+},
+{ .is_ngc = FALSE,
+  .id = 570,
+  .ra = 147.963,
+  .dec = 15.7556,
+},
+{ .is_ngc = FALSE,
+  .id = 571,
+  .ra = 148.132,
+  .dec = 15.7751,
+},
+{ .is_ngc = FALSE,
+  .id = 571,
+  .ra = 148.131,
+  .dec = 15.4411,
+},
+{ .is_ngc = FALSE,
+  .id = 572,
+  .ra = 148.137,
+  .dec = 15.8268,
+},
+{ .is_ngc = FALSE,
+  .id = 574,
+  .ra = 148.612,
+  .dec = -6.95346,
+},
+{ .is_ngc = FALSE,
+  .id = 575,
+  .ra = 148.638,
+  .dec = -6.85778,
+},
+{ .is_ngc = FALSE,
+  .id = 576,
+  .ra = 148.78,
+  .dec = 11.0395,
+},
+{ .is_ngc = FALSE,
+  .id = 577,
+  .ra = 149.017,
+  .dec = 10.4977,
+},
+{ .is_ngc = FALSE,
+  .id = 578,
+  .ra = 149.067,
+  .dec = 10.4853,
+},
+{ .is_ngc = FALSE,
+  .id = 579,
+  .ra = 149.164,
+  .dec = -13.7749,
+},
+{ .is_ngc = FALSE,
+  .id = 581,
+  .ra = 149.548,
+  .dec = 15.9467,
+},
+{ .is_ngc = FALSE,
+  .id = 582,
+  .ra = 149.751,
+  .dec = 17.8167,
+},
+{ .is_ngc = FALSE,
+  .id = 583,
+  .ra = 149.771,
+  .dec = 17.821,
+},
+{ .is_ngc = FALSE,
+  .id = 584,
+  .ra = 149.771,
+  .dec = 10.3606,
+},
+{ .is_ngc = FALSE,
+  .id = 585,
+  .ra = 149.934,
+  .dec = 12.9883,
+},
+{ .is_ngc = FALSE,
+  .id = 586,
+  .ra = 149.959,
+  .dec = -6.92265,
+},
+{ .is_ngc = FALSE,
+  .id = 587,
+  .ra = 150.771,
+  .dec = -2.40003,
+},
+{ .is_ngc = FALSE,
+  .id = 588,
+  .ra = 150.529,
+  .dec = 3.05756,
+},
+{ .is_ngc = FALSE,
+  .id = 589,
+  .ra = 151.101,
+  .dec = -5.67889,
+},
+{ .is_ngc = FALSE,
+  .id = 590,
+  .ra = 151.459,
+  .dec = 0.6325,
+},
+{ .is_ngc = FALSE,
+  .id = 591,
+  .ra = 151.865,
+  .dec = 12.2744,
+},
+{ .is_ngc = FALSE,
+  .id = 592,
+  .ra = 151.995,
+  .dec = -2.49819,
+},
+{ .is_ngc = FALSE,
+  .id = 593,
+  .ra = 152.076,
+  .dec = -2.52675,
+},
+{ .is_ngc = FALSE,
+  .id = 594,
+  .ra = 152.133,
+  .dec = -0.667,
+},
+{ .is_ngc = FALSE,
+  .id = 595,
+  .ra = 152.409,
+  .dec = 11.0002,
+},
+{ .is_ngc = FALSE,
+  .id = 596,
+  .ra = 152.63,
+  .dec = 10.0417,
+},
+{ .is_ngc = FALSE,
+  .id = 597,
+  .ra = 152.55,
+  .dec = -6.89928,
+},
+{ .is_ngc = FALSE,
+  .id = 598,
+  .ra = 153.202,
+  .dec = 43.1454,
+},
+{ .is_ngc = FALSE,
+  .id = 599,
+  .ra = 153.301,
+  .dec = -5.62964,
+},
+{ .is_ngc = FALSE,
+  .id = 600,
+  .ra = 154.295,
+  .dec = -3.49806,
+},
+{ .is_ngc = FALSE,
+  .id = 601,
+  .ra = 154.564,
+  .dec = 7.03842,
+},
+{ .is_ngc = FALSE,
+  .id = 602,
+  .ra = 154.582,
+  .dec = 7.04889,
+},
+{ .is_ngc = FALSE,
+  .id = 603,
+  .ra = 154.854,
+  .dec = -5.65639,
+},
+{ .is_ngc = FALSE,
+  .id = 605,
+  .ra = 155.601,
+  .dec = 1.19894,
+},
+{ .is_ngc = FALSE,
+  .id = 607,
+  .ra = 156.037,
+  .dec = 16.7415,
+},
+{ .is_ngc = FALSE,
+  .id = 608,
+  .ra = 156.088,
+  .dec = -6.03956,
+},
+{ .is_ngc = FALSE,
+  .id = 609,
+  .ra = 156.398,
+  .dec = -2.21531,
+},
+{ .is_ngc = FALSE,
+  .id = 612,
+  .ra = 156.774,
+  .dec = 11.0546,
+},
+{ .is_ngc = FALSE,
+  .id = 613,
+  .ra = 156.783,
+  .dec = 11.0107,
+},
+{ .is_ngc = FALSE,
+  .id = 614,
+  .ra = 156.717,
+  .dec = -3.46528,
+},
+{ .is_ngc = FALSE,
+  .id = 615,
+  .ra = 156.842,
+  .dec = 11.08,
+},
+{ .is_ngc = FALSE,
+  .id = 616,
+  .ra = 158.198,
+  .dec = 15.8606,
+},
+{ .is_ngc = FALSE,
+  .id = 619,
+  .ra = 158.458,
+  .dec = 12.8787,
+},
+{ .is_ngc = FALSE,
+  .id = 620,
+  .ra = 158.389,
+  .dec = 11.8709,
+},
+{ .is_ngc = FALSE,
+  .id = 621,
+  .ra = 158.337,
+  .dec = 2.61569,
+},
+{ .is_ngc = FALSE,
+  .id = 623,
+  .ra = 158.838,
+  .dec = 3.55789,
+},
+{ .is_ngc = FALSE,
+  .id = 624,
+  .ra = 159.064,
+  .dec = -8.33444,
+},
+{ .is_ngc = FALSE,
+  .id = 625,
+  .ra = 160.657,
+  .dec = -23.9354,
+},
+{ .is_ngc = FALSE,
+  .id = 626,
+  .ra = 159.238,
+  .dec = -7.02411,
+},
+{ .is_ngc = FALSE,
+  .id = 627,
+  .ra = 159.333,
+  .dec = -3.35736,
+},
+{ .is_ngc = FALSE,
+  .id = 628,
+  .ra = 159.401,
+  .dec = 5.60311,
+},
+{ .is_ngc = FALSE,
+  .id = 630,
+  .ra = 159.641,
+  .dec = -7.17083,
+},
+{ .is_ngc = FALSE,
+  .id = 631,
+  .ra = 159.745,
+  .dec = -7.05239,
+},
+{ .is_ngc = FALSE,
+  .id = 632,
+  .ra = 159.799,
+  .dec = -0.41025,
+},
+{ .is_ngc = FALSE,
+  .id = 633,
+  .ra = 159.85,
+  .dec = -0.389222,
+},
+{ .is_ngc = FALSE,
+  .id = 634,
+  .ra = 160.229,
+  .dec = 5.99142,
+},
+{ .is_ngc = FALSE,
+  .id = 635,
+  .ra = 160.439,
+  .dec = 15.6429,
+},
+{ .is_ngc = FALSE,
+  .id = 636,
+  .ra = 160.461,
+  .dec = 4.33042,
+},
+{ .is_ngc = FALSE,
+  .id = 637,
+  .ra = 160.592,
+  .dec = 15.3598,
+},
+{ .is_ngc = FALSE,
+  .id = 638,
+  .ra = 160.95,
+  .dec = 15.8947,
+},
+{ .is_ngc = FALSE,
+  .id = 639,
+  .ra = 161.467,
+  .dec = 16.9294,
+},
+{ .is_ngc = FALSE,
+  .id = 640,
+  .ra = 161.71,
+  .dec = 34.7675,
+},
+{ .is_ngc = FALSE,
+  .id = 641,
+  .ra = 161.956,
+  .dec = 34.6728,
+},
+{ .is_ngc = FALSE,
+  .id = 642,
+  .ra = 162.034,
+  .dec = 18.1888,
+},
+{ .is_ngc = FALSE,
+  .id = 643,
+  .ra = 162.363,
+  .dec = 12.2006,
+},
+{ .is_ngc = FALSE,
+  .id = 645,
+  .ra = 162.539,
+  .dec = -6.04333,
+},
+{ .is_ngc = FALSE,
+  .id = 646,
+  .ra = 162.897,
+  .dec = 55.4657,
+},
+{ .is_ngc = FALSE,
+  .id = 647,
+  .ra = 162.644,
+  .dec = -12.8545,
+},
+{ .is_ngc = FALSE,
+  .id = 648,
+  .ra = 162.751,
+  .dec = 12.2869,
+},
+{ .is_ngc = FALSE,
+  .id = 649,
+  .ra = 162.717,
+  .dec = 1.15222,
+},
+{ .is_ngc = FALSE,
+  .id = 650,
+  .ra = 162.669,
+  .dec = -13.4419,
+},
+{ .is_ngc = FALSE,
+  .id = 651,
+  .ra = 162.743,
+  .dec = -2.15056,
+},
+{ .is_ngc = FALSE,
+  .id = 653,
+  .ra = 163.028,
+  .dec = -0.561083,
+},
+{ .is_ngc = FALSE,
+  .id = 654,
+  .ra = 163.46,
+  .dec = -11.7259,
+},
+{ .is_ngc = FALSE,
+  .id = 655,
+  .ra = 163.593,
+  .dec = -0.365833,
+},
+{ .is_ngc = FALSE,
+  .id = 657,
+  .ra = 164.473,
+  .dec = -4.90493,
+},
+{ .is_ngc = FALSE,
+  .id = 658,
+  .ra = 164.568,
+  .dec = 8.24154,
+},
+{ .is_ngc = FALSE,
+  .id = 659,
+  .ra = 164.516,
+  .dec = -6.26038,
+},
+{ .is_ngc = FALSE,
+  .id = 660,
+  .ra = 164.611,
+  .dec = 1.38283,
+},
+{ .is_ngc = FALSE,
+  .id = 661,
+  .ra = 164.714,
+  .dec = 1.65014,
+},
+{ .is_ngc = FALSE,
+  .id = 662,
+  .ra = 164.835,
+  .dec = 1.59894,
+},
+{ .is_ngc = FALSE,
+  .id = 663,
+  .ra = 165.155,
+  .dec = 10.4364,
+},
+{ .is_ngc = FALSE,
+  .id = 664,
+  .ra = 165.189,
+  .dec = 10.5528,
+},
+{ .is_ngc = FALSE,
+  .id = 665,
+  .ra = 165.125,
+  .dec = -13.8668,
+},
+{ .is_ngc = FALSE,
+  .id = 666,
+  .ra = 165.312,
+  .dec = 10.4803,
+},
+{ .is_ngc = FALSE,
+  .id = 667,
+  .ra = 166.652,
+  .dec = 15.0887,
+},
+{ .is_ngc = FALSE,
+  .id = 668,
+  .ra = 166.665,
+  .dec = 15.0406,
+},
+{ .is_ngc = FALSE,
+  .id = 669,
+  .ra = 166.819,
+  .dec = 6.30211,
+},
+{ .is_ngc = FALSE,
+  .id = 670,
+  .ra = 166.87,
+  .dec = 6.71394,
+},
+{ .is_ngc = FALSE,
+  .id = 671,
+  .ra = 166.882,
+  .dec = 0.782417,
+},
+{ .is_ngc = FALSE,
+  .id = 672,
+  .ra = 167.013,
+  .dec = -12.4844,
+},
+{ .is_ngc = FALSE,
+  .id = 673,
+  .ra = 167.355,
+  .dec = -0.0985,
+},
+{ .is_ngc = FALSE,
+  .id = 674,
+  .ra = 167.777,
+  .dec = 43.633,
+},
+{ .is_ngc = FALSE,
+  .id = 675,
+  .ra = 167.739,
+  .dec = 3.59417,
+},
+{ .is_ngc = FALSE,
+  .id = 676,
+  .ra = 168.166,
+  .dec = 9.05594,
+},
+{ .is_ngc = FALSE,
+  .id = 677,
+  .ra = 168.486,
+  .dec = 12.301,
+},
+{ .is_ngc = FALSE,
+  .id = 678,
+  .ra = 168.526,
+  .dec = 6.57716,
+},
+{ .is_ngc = FALSE,
+  .id = 679,
+  .ra = 169.152,
+  .dec = -13.972,
+},
+{ .is_ngc = FALSE,
+  .id = 680,
+  .ra = 169.478,
+  .dec = -1.94722,
+},
+{ .is_ngc = FALSE,
+  .id = 681,
+  .ra = 169.633,
+  .dec = -12.1405,
+},
+{ .is_ngc = FALSE,
+  .id = 683,
+  .ra = 170.382,
+  .dec = 2.75164,
+},
+{ .is_ngc = FALSE,
+  .id = 685,
+  .ra = 170.528,
+  .dec = 17.7522,
+},
+{ .is_ngc = FALSE,
+  .id = 686,
+  .ra = 170.771,
+  .dec = 5.64389,
+},
+{ .is_ngc = FALSE,
+  .id = 687,
+  .ra = 171.072,
+  .dec = 47.8473,
+},
+{ .is_ngc = FALSE,
+  .id = 688,
+  .ra = 170.917,
+  .dec = -9.79544,
+},
+{ .is_ngc = FALSE,
+  .id = 690,
+  .ra = 171.086,
+  .dec = -8.34195,
+},
+{ .is_ngc = FALSE,
+  .id = 691,
+  .ra = 171.685,
+  .dec = 59.1556,
+},
+{ .is_ngc = FALSE,
+  .id = 692,
+  .ra = 171.473,
+  .dec = 9.987,
+},
+{ .is_ngc = FALSE,
+  .id = 693,
+  .ra = 171.703,
+  .dec = -5.00472,
+},
+{ .is_ngc = FALSE,
+  .id = 694,
+  .ra = 172.114,
+  .dec = 58.5785,
+},
+{ .is_ngc = FALSE,
+  .id = 695,
+  .ra = 171.993,
+  .dec = -11.7155,
+},
+{ .is_ngc = FALSE,
+  .id = 696,
+  .ra = 172.166,
+  .dec = 9.09858,
+},
+{ .is_ngc = FALSE,
+  .id = 697,
+  .ra = 172.144,
+  .dec = -1.62989,
+},
+{ .is_ngc = FALSE,
+  .id = 698,
+  .ra = 172.266,
+  .dec = 9.11222,
+},
+{ .is_ngc = FALSE,
+  .id = 699,
+  .ra = 172.277,
+  .dec = 8.98842,
+},
+{ .is_ngc = FALSE,
+  .id = 700,
+  .ra = 172.315,
+  .dec = 20.5847,
+},
+{ .is_ngc = FALSE,
+  .id = 701,
+  .ra = 172.753,
+  .dec = 20.4693,
+},
+{ .is_ngc = FALSE,
+  .id = 702,
+  .ra = 172.728,
+  .dec = -4.92239,
+},
+{ .is_ngc = FALSE,
+  .id = 705,
+  .ra = 173.235,
+  .dec = 50.2417,
+},
+{ .is_ngc = FALSE,
+  .id = 706,
+  .ra = 173.303,
+  .dec = -13.3383,
+},
+{ .is_ngc = FALSE,
+  .id = 707,
+  .ra = 173.436,
+  .dec = 21.38,
+},
+{ .is_ngc = FALSE,
+  .id = 708,
+  .ra = 173.497,
+  .dec = 49.0617,
+},
+{ .is_ngc = FALSE,
+  .id = 709,
+  .ra = 173.56,
+  .dec = 49.043,
+},
+{ .is_ngc = FALSE,
+  .id = 710,
+  .ra = 173.614,
+  .dec = 25.876,
+},
+{ .is_ngc = FALSE,
+  .id = 711,
+  .ra = 173.694,
+  .dec = 48.9559,
+},
+{ .is_ngc = FALSE,
+  .id = 712,
+  .ra = 173.705,
+  .dec = 49.0775,
+},
+{ .is_ngc = FALSE,
+  .id = 713,
+  .ra = 173.684,
+  .dec = 16.8461,
+},
+{ .is_ngc = FALSE,
+  .id = 715,
+  .ra = 174.228,
+  .dec = -8.37722,
+},
+{ .is_ngc = FALSE,
+  .id = 716,
+  .ra = 174.764,
+  .dec = -0.206194,
+},
+{ .is_ngc = FALSE,
+  .id = 718,
+  .ra = 174.97,
+  .dec = 8.87431,
+},
+{ .is_ngc = FALSE,
+  .id = 719,
+  .ra = 175.077,
+  .dec = 9.00964,
+},
+{ .is_ngc = FALSE,
+  .id = 721,
+  .ra = 175.62,
+  .dec = -8.34083,
+},
+{ .is_ngc = FALSE,
+  .id = 722,
+  .ra = 175.682,
+  .dec = 8.974,
+},
+{ .is_ngc = FALSE,
+  .id = 723,
+  .ra = 175.74,
+  .dec = -8.33251,
+},
+{ .is_ngc = FALSE,
+  .id = 724,
+  .ra = 175.894,
+  .dec = 8.94194,
+},
+{ .is_ngc = FALSE,
+  .id = 725,
+  .ra = 175.873,
+  .dec = -1.66817,
+},
+{ .is_ngc = FALSE,
+  .id = 726,
+  .ra = 175.939,
+  .dec = 33.392,
+},
+{ .is_ngc = FALSE,
+  .id = 727,
+  .ra = 176.12,
+  .dec = 10.7833,
+},
+{ .is_ngc = FALSE,
+  .id = 728,
+  .ra = 176.21,
+  .dec = -1.60136,
+},
+{ .is_ngc = FALSE,
+  .id = 729,
+  .ra = 176.327,
+  .dec = 33.3357,
+},
+{ .is_ngc = FALSE,
+  .id = 731,
+  .ra = 176.325,
+  .dec = 49.5702,
+},
+{ .is_ngc = FALSE,
+  .id = 733,
+  .ra = 176.494,
+  .dec = -8.15589,
+},
+{ .is_ngc = FALSE,
+  .id = 735,
+  .ra = 177.053,
+  .dec = 13.2085,
+},
+{ .is_ngc = FALSE,
+  .id = 736,
+  .ra = 177.084,
+  .dec = 12.7164,
+},
+{ .is_ngc = FALSE,
+  .id = 737,
+  .ra = 177.114,
+  .dec = 12.7271,
+},
+{ .is_ngc = FALSE,
+  .id = 738,
+  .ra = 177.228,
+  .dec = -4.68208,
+},
+{ .is_ngc = FALSE,
+  .id = 739,
+  .ra = 177.88,
+  .dec = 23.8626,
+},
+{ .is_ngc = FALSE,
+  .id = 741,
+  .ra = 177.633,
+  .dec = -4.83667,
+},
+{ .is_ngc = FALSE,
+  .id = 742,
+  .ra = 177.76,
+  .dec = 20.7994,
+},
+{ .is_ngc = FALSE,
+  .id = 743,
+  .ra = 178.342,
+  .dec = -13.2641,
+},
+{ .is_ngc = FALSE,
+  .id = 744,
+  .ra = 178.52,
+  .dec = 23.1922,
+},
+{ .is_ngc = FALSE,
+  .id = 745,
+  .ra = 178.551,
+  .dec = 0.136778,
+},
+{ .is_ngc = FALSE,
+  .id = 746,
+  .ra = 178.896,
+  .dec = 25.8889,
+},
+{ .is_ngc = FALSE,
+  .id = 747,
+  .ra = 179.27,
+  .dec = -8.29213,
+},
+{ .is_ngc = FALSE,
+  .id = 748,
+  .ra = 179.361,
+  .dec = 7.46075,
+},
+{ .is_ngc = FALSE,
+  .id = 749,
+  .ra = 179.641,
+  .dec = 42.7341,
+},
+{ .is_ngc = FALSE,
+  .id = 750,
+  .ra = 179.717,
+  .dec = 42.7223,
+},
+{ .is_ngc = FALSE,
+  .id = 751,
+  .ra = 179.719,
+  .dec = 42.5702,
+},
+{ .is_ngc = FALSE,
+  .id = 752,
+  .ra = 179.813,
+  .dec = 42.5667,
+},
+{ .is_ngc = FALSE,
+  .id = 753,
+  .ra = 179.803,
+  .dec = -0.524222,
+},
+{ .is_ngc = FALSE,
+  .id = 754,
+  .ra = 179.848,
+  .dec = -1.65433,
+},
+{ .is_ngc = FALSE,
+  .id = 756,
+  .ra = 180.741,
+  .dec = 4.84542,
+},
+{ .is_ngc = FALSE,
+  .id = 758,
+  .ra = 181.051,
+  .dec = 62.5052,
+},
+{ .is_ngc = FALSE,
+  .id = 759,
+  .ra = 181.287,
+  .dec = 20.2517,
+},
+{ .is_ngc = FALSE,
+  .id = 760,
+  .ra = 181.473,
+  .dec = -29.2925,
+},
+{ .is_ngc = FALSE,
+  .id = 761,
+  .ra = 181.474,
+  .dec = -12.6732,
+},
+{ .is_ngc = FALSE,
+  .id = 762,
+  .ra = 182.05,
+  .dec = 25.7564,
+},
+{ .is_ngc = FALSE,
+  .id = 763,
+  .ra = 182.064,
+  .dec = 25.8112,
+},
+{ .is_ngc = FALSE,
+  .id = 764,
+  .ra = 182.558,
+  .dec = -29.7367,
+},
+{ .is_ngc = FALSE,
+  .id = 765,
+  .ra = 182.625,
+  .dec = 16.1336,
+},
+{ .is_ngc = FALSE,
+  .id = 765,
+  .ra = 182.636,
+  .dec = 16.1322,
+},
+{ .is_ngc = FALSE,
+  .id = 766,
+  .ra = 182.723,
+  .dec = -12.6547,
+},
+{ .is_ngc = FALSE,
+  .id = 767,
+  .ra = 182.762,
+  .dec = 12.1033,
+},
+{ .is_ngc = FALSE,
+  .id = 768,
+  .ra = 182.948,
+  .dec = 12.143,
+},
+{ .is_ngc = FALSE,
+  .id = 769,
+  .ra = 183.134,
+  .dec = 12.1231,
+},
+{ .is_ngc = FALSE,
+  .id = 770,
+  .ra = 183.26,
+  .dec = -4.55332,
+},
+{ .is_ngc = FALSE,
+  .id = 771,
+  .ra = 183.804,
+  .dec = 13.185,
+},
+{ .is_ngc = FALSE,
+  .id = 773,
+  .ra = 184.533,
+  .dec = 6.14008,
+},
+{ .is_ngc = FALSE,
+  .id = 774,
+  .ra = 184.714,
+  .dec = -6.76649,
+},
+{ .is_ngc = FALSE,
+  .id = 775,
+  .ra = 184.723,
+  .dec = 12.9128,
+},
+{ .is_ngc = FALSE,
+  .id = 776,
+  .ra = 184.763,
+  .dec = 8.85633,
+},
+{ .is_ngc = FALSE,
+  .id = 777,
+  .ra = 184.849,
+  .dec = 28.3095,
+},
+{ .is_ngc = FALSE,
+  .id = 779,
+  .ra = 184.911,
+  .dec = 29.8827,
+},
+{ .is_ngc = FALSE,
+  .id = 780,
+  .ra = 184.994,
+  .dec = 25.7712,
+},
+{ .is_ngc = FALSE,
+  .id = 781,
+  .ra = 185.013,
+  .dec = 14.9608,
+},
+{ .is_ngc = FALSE,
+  .id = 782,
+  .ra = 185.404,
+  .dec = 5.76579,
+},
+{ .is_ngc = FALSE,
+  .id = 783,
+  .ra = 185.412,
+  .dec = 15.7451,
+},
+{ .is_ngc = FALSE,
+  .id = 784,
+  .ra = 185.625,
+  .dec = -4.65333,
+},
+{ .is_ngc = FALSE,
+  .id = 785,
+  .ra = 185.759,
+  .dec = -13.2235,
+},
+{ .is_ngc = FALSE,
+  .id = 786,
+  .ra = 185.796,
+  .dec = -13.2044,
+},
+{ .is_ngc = FALSE,
+  .id = 787,
+  .ra = 186.354,
+  .dec = 16.1233,
+},
+{ .is_ngc = FALSE,
+  .id = 789,
+  .ra = 186.585,
+  .dec = 7.46008,
+},
+{ .is_ngc = FALSE,
+  .id = 790,
+  .ra = 186.648,
+  .dec = 9.03538,
+},
+{ .is_ngc = FALSE,
+  .id = 791,
+  .ra = 186.748,
+  .dec = 22.6397,
+},
+{ .is_ngc = FALSE,
+  .id = 792,
+  .ra = 186.786,
+  .dec = 16.3258,
+},
+{ .is_ngc = FALSE,
+  .id = 794,
+  .ra = 187.036,
+  .dec = 12.093,
+},
+{ .is_ngc = FALSE,
+  .id = 795,
+  .ra = 187.13,
+  .dec = 23.3047,
+},
+{ .is_ngc = FALSE,
+  .id = 796,
+  .ra = 187.36,
+  .dec = 16.4043,
+},
+{ .is_ngc = FALSE,
+  .id = 797,
+  .ra = 187.977,
+  .dec = 15.1241,
+},
+{ .is_ngc = FALSE,
+  .id = 798,
+  .ra = 188.139,
+  .dec = 15.4161,
+},
+{ .is_ngc = FALSE,
+  .id = 800,
+  .ra = 188.486,
+  .dec = 15.3548,
+},
+{ .is_ngc = FALSE,
+  .id = 801,
+  .ra = 188.437,
+  .dec = 52.2544,
+},
+{ .is_ngc = FALSE,
+  .id = 802,
+  .ra = 188.99,
+  .dec = 74.3013,
+},
+{ .is_ngc = FALSE,
+  .id = 803,
+  .ra = 189.905,
+  .dec = 16.5883,
+},
+{ .is_ngc = FALSE,
+  .id = 804,
+  .ra = 190.317,
+  .dec = -5.00917,
+},
+{ .is_ngc = FALSE,
+  .id = 806,
+  .ra = 190.535,
+  .dec = -17.3496,
+},
+{ .is_ngc = FALSE,
+  .id = 807,
+  .ra = 190.552,
+  .dec = -17.4038,
+},
+{ .is_ngc = FALSE,
+  .id = 808,
+  .ra = 190.477,
+  .dec = 19.9319,
+},
+{ .is_ngc = FALSE,
+  .id = 809,
+  .ra = 190.533,
+  .dec = 11.7539,
+},
+{ .is_ngc = FALSE,
+  .id = 810,
+  .ra = 190.537,
+  .dec = 12.5967,
+},
+{ .is_ngc = FALSE,
+  .id = 812,
+  .ra = 191.212,
+  .dec = -4.43472,
+},
+{ .is_ngc = FALSE,
+  .id = 813,
+  .ra = 191.299,
+  .dec = 23.0359,
+},
+{ .is_ngc = FALSE,
+  .id = 814,
+  .ra = 191.392,
+  .dec = -8.09199,
+},
+{ .is_ngc = FALSE,
+  .id = 815,
+  .ra = 191.594,
+  .dec = 11.8766,
+},
+{ .is_ngc = FALSE,
+  .id = 816,
+  .ra = 191.693,
+  .dec = 9.85133,
+},
+{ .is_ngc = FALSE,
+  .id = 818,
+  .ra = 191.685,
+  .dec = 29.7351,
+},
+{ .is_ngc = FALSE,
+  .id = 821,
+  .ra = 191.859,
+  .dec = 29.7874,
+},
+{ .is_ngc = FALSE,
+  .id = 822,
+  .ra = 191.94,
+  .dec = 30.0771,
+},
+{ .is_ngc = FALSE,
+  .id = 823,
+  .ra = 191.962,
+  .dec = 27.2033,
+},
+{ .is_ngc = FALSE,
+  .id = 823,
+  .ra = 191.962,
+  .dec = 27.2092,
+},
+{ .is_ngc = FALSE,
+  .id = 826,
+  .ra = 192.833,
+  .dec = 31.0593,
+},
+{ .is_ngc = FALSE,
+  .id = 827,
+  .ra = 192.98,
+  .dec = 16.2825,
+},
+{ .is_ngc = FALSE,
+  .id = 828,
+  .ra = 193.065,
+  .dec = -8.13303,
+},
+{ .is_ngc = FALSE,
+  .id = 829,
+  .ra = 193.114,
+  .dec = -15.5185,
+},
+{ .is_ngc = FALSE,
+  .id = 830,
+  .ra = 192.82,
+  .dec = 53.6961,
+},
+{ .is_ngc = FALSE,
+  .id = 831,
+  .ra = 193.183,
+  .dec = 26.4704,
+},
+{ .is_ngc = FALSE,
+  .id = 832,
+  .ra = 193.496,
+  .dec = 26.444,
+},
+{ .is_ngc = FALSE,
+  .id = 833,
+  .ra = 194.159,
+  .dec = -6.73339,
+},
+{ .is_ngc = FALSE,
+  .id = 834,
+  .ra = 194.077,
+  .dec = 26.3588,
+},
+{ .is_ngc = FALSE,
+  .id = 835,
+  .ra = 194.218,
+  .dec = 26.4871,
+},
+{ .is_ngc = FALSE,
+  .id = 836,
+  .ra = 193.976,
+  .dec = 63.6116,
+},
+{ .is_ngc = FALSE,
+  .id = 837,
+  .ra = 194.38,
+  .dec = 26.5118,
+},
+{ .is_ngc = FALSE,
+  .id = 839,
+  .ra = 194.563,
+  .dec = 28.1257,
+},
+{ .is_ngc = FALSE,
+  .id = 840,
+  .ra = 194.675,
+  .dec = 10.6158,
+},
+{ .is_ngc = FALSE,
+  .id = 841,
+  .ra = 194.947,
+  .dec = 21.8125,
+},
+{ .is_ngc = FALSE,
+  .id = 842,
+  .ra = 195.165,
+  .dec = 29.019,
+},
+{ .is_ngc = FALSE,
+  .id = 843,
+  .ra = 195.39,
+  .dec = 29.1304,
+},
+{ .is_ngc = FALSE,
+  .id = 844,
+  .ra = 195.826,
+  .dec = -30.5206,
+},
+{ .is_ngc = FALSE,
+  .id = 845,
+  .ra = 196.239,
+  .dec = 12.0787,
+},
+{ .is_ngc = FALSE,
+  .id = 846,
+  .ra = 196.338,
+  .dec = 23.095,
+},
+{ .is_ngc = FALSE,
+  .id = 848,
+  .ra = 196.756,
+  .dec = 16.0067,
+},
+{ .is_ngc = FALSE,
+  .id = 849,
+  .ra = 196.912,
+  .dec = -0.942722,
+},
+{ .is_ngc = FALSE,
+  .id = 850,
+  .ra = 196.959,
+  .dec = -0.868611,
+},
+{ .is_ngc = FALSE,
+  .id = 851,
+  .ra = 197.143,
+  .dec = 21.0495,
+},
+{ .is_ngc = FALSE,
+  .id = 852,
+  .ra = 196.903,
+  .dec = 60.157,
+},
+{ .is_ngc = FALSE,
+  .id = 854,
+  .ra = 197.458,
+  .dec = 24.5774,
+},
+{ .is_ngc = FALSE,
+  .id = 855,
+  .ra = 197.653,
+  .dec = -4.48556,
+},
+{ .is_ngc = FALSE,
+  .id = 856,
+  .ra = 197.673,
+  .dec = 20.5366,
+},
+{ .is_ngc = FALSE,
+  .id = 857,
+  .ra = 198.459,
+  .dec = 17.0758,
+},
+{ .is_ngc = FALSE,
+  .id = 858,
+  .ra = 198.717,
+  .dec = 17.2264,
+},
+{ .is_ngc = FALSE,
+  .id = 859,
+  .ra = 198.739,
+  .dec = 17.225,
+},
+{ .is_ngc = FALSE,
+  .id = 860,
+  .ra = 198.765,
+  .dec = 24.6185,
+},
+{ .is_ngc = FALSE,
+  .id = 861,
+  .ra = 198.781,
+  .dec = 34.3284,
+},
+{ .is_ngc = FALSE,
+  .id = 862,
+  .ra = 199.063,
+  .dec = 20.047,
+},
+{ .is_ngc = FALSE,
+  .id = 863,
+  .ra = 199.301,
+  .dec = -17.255,
+},
+{ .is_ngc = FALSE,
+  .id = 864,
+  .ra = 199.285,
+  .dec = 20.6922,
+},
+{ .is_ngc = FALSE,
+  .id = 865,
+  .ra = 199.398,
+  .dec = -5.83382,
+},
+{ .is_ngc = FALSE,
+  .id = 866,
+  .ra = 199.319,
+  .dec = 20.6911,
+},
+{ .is_ngc = FALSE,
+  .id = 867,
+  .ra = 199.332,
+  .dec = 20.638,
+},
+{ .is_ngc = FALSE,
+  .id = 868,
+  .ra = 199.369,
+  .dec = 20.6124,
+},
+{ .is_ngc = FALSE,
+  .id = 869,
+  .ra = 199.378,
+  .dec = 20.6808,
+},
+{ .is_ngc = FALSE,
+  .id = 870,
+  .ra = 199.378,
+  .dec = 20.6,
+},
+{ .is_ngc = FALSE,
+  .id = 871,
+  .ra = 199.494,
+  .dec = 4.40321,
+},
+{ .is_ngc = FALSE,
+  .id = 872,
+  .ra = 199.257,
+  .dec = 6.35706,
+},
+{ .is_ngc = FALSE,
+  .id = 872,
+  .ra = 199.577,
+  .dec = 6.33528,
+},
+{ .is_ngc = FALSE,
+  .id = 873,
+  .ra = 199.568,
+  .dec = 4.46418,
+},
+{ .is_ngc = FALSE,
+  .id = 874,
+  .ra = 199.752,
+  .dec = -27.6281,
+},
+{ .is_ngc = FALSE,
+  .id = 875,
+  .ra = 199.283,
+  .dec = 57.5391,
+},
+{ .is_ngc = FALSE,
+  .id = 876,
+  .ra = 199.644,
+  .dec = 4.486,
+},
+{ .is_ngc = FALSE,
+  .id = 881,
+  .ra = 199.985,
+  .dec = 15.85,
+},
+{ .is_ngc = FALSE,
+  .id = 882,
+  .ra = 200.029,
+  .dec = 15.8975,
+},
+{ .is_ngc = FALSE,
+  .id = 883,
+  .ra = 200.148,
+  .dec = 34.1387,
+},
+{ .is_ngc = FALSE,
+  .id = 884,
+  .ra = 200.475,
+  .dec = -12.7189,
+},
+{ .is_ngc = FALSE,
+  .id = 885,
+  .ra = 200.629,
+  .dec = 21.3161,
+},
+{ .is_ngc = FALSE,
+  .id = 886,
+  .ra = 200.99,
+  .dec = -4.39539,
+},
+{ .is_ngc = FALSE,
+  .id = 887,
+  .ra = 201.046,
+  .dec = -12.4517,
+},
+{ .is_ngc = FALSE,
+  .id = 889,
+  .ra = 201.657,
+  .dec = 11.8692,
+},
+{ .is_ngc = FALSE,
+  .id = 890,
+  .ra = 202.107,
+  .dec = -16.0924,
+},
+{ .is_ngc = FALSE,
+  .id = 891,
+  .ra = 202.5,
+  .dec = 0.305003,
+},
+{ .is_ngc = FALSE,
+  .id = 892,
+  .ra = 202.941,
+  .dec = -2.71311,
+},
+{ .is_ngc = FALSE,
+  .id = 893,
+  .ra = 202.947,
+  .dec = -2.61169,
+},
+{ .is_ngc = FALSE,
+  .id = 894,
+  .ra = 203.02,
+  .dec = 17.0487,
+},
+{ .is_ngc = FALSE,
+  .id = 895,
+  .ra = 203.071,
+  .dec = 35.6514,
+},
+{ .is_ngc = FALSE,
+  .id = 896,
+  .ra = 203.543,
+  .dec = 4.86836,
+},
+{ .is_ngc = FALSE,
+  .id = 897,
+  .ra = 203.581,
+  .dec = 17.848,
+},
+{ .is_ngc = FALSE,
+  .id = 898,
+  .ra = 203.539,
+  .dec = 13.2809,
+},
+{ .is_ngc = FALSE,
+  .id = 899,
+  .ra = 203.748,
+  .dec = -8.09164,
+},
+{ .is_ngc = FALSE,
+  .id = 900,
+  .ra = 203.679,
+  .dec = 9.33672,
+},
+{ .is_ngc = FALSE,
+  .id = 901,
+  .ra = 203.927,
+  .dec = 13.3297,
+},
+{ .is_ngc = FALSE,
+  .id = 902,
+  .ra = 204.006,
+  .dec = 49.9598,
+},
+{ .is_ngc = FALSE,
+  .id = 903,
+  .ra = 204.609,
+  .dec = -0.228472,
+},
+{ .is_ngc = FALSE,
+  .id = 904,
+  .ra = 204.635,
+  .dec = 0.539722,
+},
+{ .is_ngc = FALSE,
+  .id = 905,
+  .ra = 205.012,
+  .dec = 23.1428,
+},
+{ .is_ngc = FALSE,
+  .id = 906,
+  .ra = 205.042,
+  .dec = 23.3403,
+},
+{ .is_ngc = FALSE,
+  .id = 907,
+  .ra = 204.845,
+  .dec = 51.0511,
+},
+{ .is_ngc = FALSE,
+  .id = 908,
+  .ra = 205.329,
+  .dec = -4.34417,
+},
+{ .is_ngc = FALSE,
+  .id = 909,
+  .ra = 205.213,
+  .dec = 24.4729,
+},
+{ .is_ngc = FALSE,
+  .id = 910,
+  .ra = 205.283,
+  .dec = 23.2816,
+},
+{ .is_ngc = FALSE,
+  .id = 911,
+  .ra = 205.356,
+  .dec = 23.2473,
+},
+{ .is_ngc = FALSE,
+  .id = 912,
+  .ra = 205.371,
+  .dec = 23.245,
+},
+{ .is_ngc = FALSE,
+  .id = 913,
+  .ra = 205.374,
+  .dec = 23.1666,
+},
+{ .is_ngc = FALSE,
+  .id = 914,
+  .ra = 205.419,
+  .dec = 23.1894,
+},
+{ .is_ngc = FALSE,
+  .id = 915,
+  .ra = 205.864,
+  .dec = -17.3327,
+},
+{ .is_ngc = FALSE,
+  .id = 916,
+  .ra = 205.659,
+  .dec = 24.4648,
+},
+{ .is_ngc = FALSE,
+  .id = 917,
+  .ra = 205.63,
+  .dec = 55.6364,
+},
+{ .is_ngc = FALSE,
+  .id = 918,
+  .ra = 205.657,
+  .dec = 55.5292,
+},
+{ .is_ngc = FALSE,
+  .id = 919,
+  .ra = 205.698,
+  .dec = 55.5212,
+},
+{ .is_ngc = FALSE,
+  .id = 920,
+  .ra = 206.353,
+  .dec = -12.5744,
+},
+{ .is_ngc = FALSE,
+  .id = 921,
+  .ra = 205.783,
+  .dec = 55.6492,
+},
+{ .is_ngc = FALSE,
+  .id = 922,
+  .ra = 205.735,
+  .dec = 55.6032,
+},
+{ .is_ngc = FALSE,
+  .id = 923,
+  .ra = 205.81,
+  .dec = 55.6025,
+},
+{ .is_ngc = FALSE,
+  .id = 924,
+  .ra = 206.407,
+  .dec = -12.4554,
+},
+{ .is_ngc = FALSE,
+  .id = 925,
+  .ra = 205.817,
+  .dec = 55.615,
+},
+{ .is_ngc = FALSE,
+  .id = 926,
+  .ra = 205.914,
+  .dec = 55.6308,
+},
+{ .is_ngc = FALSE,
+  .id = 927,
+  .ra = 206.468,
+  .dec = -12.4643,
+},
+{ .is_ngc = FALSE,
+  .id = 928,
+  .ra = 205.95,
+  .dec = 55.5678,
+},
+{ .is_ngc = FALSE,
+  .id = 929,
+  .ra = 205.938,
+  .dec = 55.6333,
+},
+{ .is_ngc = FALSE,
+  .id = 930,
+  .ra = 205.94,
+  .dec = 55.6458,
+},
+{ .is_ngc = FALSE,
+  .id = 931,
+  .ra = 205.955,
+  .dec = 55.6222,
+},
+{ .is_ngc = FALSE,
+  .id = 932,
+  .ra = 205.964,
+  .dec = 55.6461,
+},
+{ .is_ngc = FALSE,
+  .id = 933,
+  .ra = 206.317,
+  .dec = 23.2188,
+},
+{ .is_ngc = FALSE,
+  .id = 934,
+  .ra = 205.969,
+  .dec = 55.6558,
+},
+{ .is_ngc = FALSE,
+  .id = 935,
+  .ra = 206.012,
+  .dec = 55.6494,
+},
+{ .is_ngc = FALSE,
+  .id = 935,
+  .ra = 206.023,
+  .dec = 55.6136,
+},
+{ .is_ngc = FALSE,
+  .id = 936,
+  .ra = 206.038,
+  .dec = 55.7067,
+},
+{ .is_ngc = FALSE,
+  .id = 937,
+  .ra = 206.12,
+  .dec = 55.6289,
+},
+{ .is_ngc = FALSE,
+  .id = 938,
+  .ra = 206.13,
+  .dec = 55.6264,
+},
+{ .is_ngc = FALSE,
+  .id = 939,
+  .ra = 206.93,
+  .dec = 3.41155,
+},
+{ .is_ngc = FALSE,
+  .id = 940,
+  .ra = 206.99,
+  .dec = 3.44917,
+},
+{ .is_ngc = FALSE,
+  .id = 941,
+  .ra = 207.149,
+  .dec = 24.0151,
+},
+{ .is_ngc = FALSE,
+  .id = 942,
+  .ra = 206.921,
+  .dec = 56.6216,
+},
+{ .is_ngc = FALSE,
+  .id = 943,
+  .ra = 207.634,
+  .dec = 3.19361,
+},
+{ .is_ngc = FALSE,
+  .id = 944,
+  .ra = 207.879,
+  .dec = 14.0917,
+},
+{ .is_ngc = FALSE,
+  .id = 945,
+  .ra = 206.781,
+  .dec = 72.0704,
+},
+{ .is_ngc = FALSE,
+  .id = 946,
+  .ra = 208.034,
+  .dec = 14.1161,
+},
+{ .is_ngc = FALSE,
+  .id = 947,
+  .ra = 208.149,
+  .dec = 0.818194,
+},
+{ .is_ngc = FALSE,
+  .id = 948,
+  .ra = 208.11,
+  .dec = 14.0912,
+},
+{ .is_ngc = FALSE,
+  .id = 949,
+  .ra = 208.07,
+  .dec = 22.5211,
+},
+{ .is_ngc = FALSE,
+  .id = 951,
+  .ra = 207.947,
+  .dec = 50.9782,
+},
+{ .is_ngc = FALSE,
+  .id = 952,
+  .ra = 208.424,
+  .dec = 3.37778,
+},
+{ .is_ngc = FALSE,
+  .id = 953,
+  .ra = 208.738,
+  .dec = -30.2833,
+},
+{ .is_ngc = FALSE,
+  .id = 954,
+  .ra = 207.486,
+  .dec = 71.1646,
+},
+{ .is_ngc = FALSE,
+  .id = 955,
+  .ra = 208.929,
+  .dec = -30.2519,
+},
+{ .is_ngc = FALSE,
+  .id = 957,
+  .ra = 209.033,
+  .dec = -30.2342,
+},
+{ .is_ngc = FALSE,
+  .id = 959,
+  .ra = 209.014,
+  .dec = 13.5053,
+},
+{ .is_ngc = FALSE,
+  .id = 961,
+  .ra = 208.945,
+  .dec = 25.8397,
+},
+{ .is_ngc = FALSE,
+  .id = 962,
+  .ra = 209.305,
+  .dec = 12.0212,
+},
+{ .is_ngc = FALSE,
+  .id = 963,
+  .ra = 209.354,
+  .dec = 17.4075,
+},
+{ .is_ngc = FALSE,
+  .id = 964,
+  .ra = 209.422,
+  .dec = 17.5087,
+},
+{ .is_ngc = FALSE,
+  .id = 965,
+  .ra = 209.448,
+  .dec = 17.5105,
+},
+{ .is_ngc = FALSE,
+  .id = 966,
+  .ra = 209.558,
+  .dec = 5.40822,
+},
+{ .is_ngc = FALSE,
+  .id = 967,
+  .ra = 209.596,
+  .dec = 14.4571,
+},
+{ .is_ngc = FALSE,
+  .id = 969,
+  .ra = 210.442,
+  .dec = -4.18038,
+},
+{ .is_ngc = FALSE,
+  .id = 970,
+  .ra = 210.642,
+  .dec = 14.5524,
+},
+{ .is_ngc = FALSE,
+  .id = 971,
+  .ra = 210.97,
+  .dec = -10.1409,
+},
+{ .is_ngc = FALSE,
+  .id = 972,
+  .ra = 211.108,
+  .dec = -17.2275,
+},
+{ .is_ngc = FALSE,
+  .id = 974,
+  .ra = 211.642,
+  .dec = -5.5,
+},
+{ .is_ngc = FALSE,
+  .id = 974,
+  .ra = 211.643,
+  .dec = -5.49242,
+},
+{ .is_ngc = FALSE,
+  .id = 975,
+  .ra = 211.787,
+  .dec = 15.3177,
+},
+{ .is_ngc = FALSE,
+  .id = 976,
+  .ra = 212.18,
+  .dec = -1.16178,
+},
+{ .is_ngc = FALSE,
+  .id = 977,
+  .ra = 212.175,
+  .dec = -3.0025,
+},
+{ .is_ngc = FALSE,
+  .id = 978,
+  .ra = 212.242,
+  .dec = -2.97413,
+},
+{ .is_ngc = FALSE,
+  .id = 979,
+  .ra = 212.385,
+  .dec = 14.8317,
+},
+{ .is_ngc = FALSE,
+  .id = 980,
+  .ra = 212.593,
+  .dec = -7.34263,
+},
+{ .is_ngc = FALSE,
+  .id = 981,
+  .ra = 212.617,
+  .dec = -4.17164,
+},
+{ .is_ngc = FALSE,
+  .id = 982,
+  .ra = 212.496,
+  .dec = 17.6959,
+},
+{ .is_ngc = FALSE,
+  .id = 983,
+  .ra = 212.518,
+  .dec = 17.7338,
+},
+{ .is_ngc = FALSE,
+  .id = 984,
+  .ra = 212.532,
+  .dec = 18.3633,
+},
+{ .is_ngc = FALSE,
+  .id = 985,
+  .ra = 212.888,
+  .dec = -3.22,
+},
+{ .is_ngc = FALSE,
+  .id = 986,
+  .ra = 212.859,
+  .dec = 1.28627,
+},
+{ .is_ngc = FALSE,
+  .id = 987,
+  .ra = 212.883,
+  .dec = 19.1717,
+},
+{ .is_ngc = FALSE,
+  .id = 988,
+  .ra = 213.634,
+  .dec = 3.19022,
+},
+{ .is_ngc = FALSE,
+  .id = 989,
+  .ra = 213.713,
+  .dec = 3.13064,
+},
+{ .is_ngc = FALSE,
+  .id = 990,
+  .ra = 213.955,
+  .dec = 39.7979,
+},
+{ .is_ngc = FALSE,
+  .id = 991,
+  .ra = 214.452,
+  .dec = -13.8731,
+},
+{ .is_ngc = FALSE,
+  .id = 992,
+  .ra = 214.562,
+  .dec = 0.890583,
+},
+{ .is_ngc = FALSE,
+  .id = 993,
+  .ra = 214.578,
+  .dec = 11.2164,
+},
+{ .is_ngc = FALSE,
+  .id = 994,
+  .ra = 214.594,
+  .dec = 11.1949,
+},
+{ .is_ngc = FALSE,
+  .id = 995,
+  .ra = 214.13,
+  .dec = 57.8098,
+},
+{ .is_ngc = FALSE,
+  .id = 996,
+  .ra = 214.342,
+  .dec = 57.6297,
+},
+{ .is_ngc = FALSE,
+  .id = 997,
+  .ra = 214.998,
+  .dec = -4.45203,
+},
+{ .is_ngc = FALSE,
+  .id = 998,
+  .ra = 215.081,
+  .dec = -4.4165,
+},
+{ .is_ngc = FALSE,
+  .id = 999,
+  .ra = 214.886,
+  .dec = 17.8755,
+},
+{ .is_ngc = FALSE,
+  .id = 1000,
+  .ra = 214.917,
+  .dec = 17.8549,
+},
+{ .is_ngc = FALSE,
+  .id = 1001,
+  .ra = 215.165,
+  .dec = 5.42736,
+},
+{ .is_ngc = FALSE,
+  .id = 1002,
+  .ra = 215.175,
+  .dec = 5.48561,
+},
+{ .is_ngc = FALSE,
+  .id = 1003,
+  .ra = 215.374,
+  .dec = 5.07309,
+},
+{ .is_ngc = FALSE,
+  .id = 1006,
+  .ra = 215.746,
+  .dec = 23.7944,
+},
+{ .is_ngc = FALSE,
+  .id = 1007,
+  .ra = 216.152,
+  .dec = 4.55861,
+},
+{ .is_ngc = FALSE,
+  .id = 1009,
+  .ra = 216.573,
+  .dec = 12.3531,
+},
+{ .is_ngc = FALSE,
+  .id = 1010,
+  .ra = 216.835,
+  .dec = 1.02575,
+},
+{ .is_ngc = FALSE,
+  .id = 1011,
+  .ra = 217.019,
+  .dec = 1.00626,
+},
+{ .is_ngc = FALSE,
+  .id = 1013,
+  .ra = 216.995,
+  .dec = 25.8656,
+},
+{ .is_ngc = FALSE,
+  .id = 1014,
+  .ra = 217.077,
+  .dec = 13.78,
+},
+{ .is_ngc = FALSE,
+  .id = 1015,
+  .ra = 217.08,
+  .dec = 15.4194,
+},
+{ .is_ngc = FALSE,
+  .id = 1017,
+  .ra = 217.03,
+  .dec = 25.8684,
+},
+{ .is_ngc = FALSE,
+  .id = 1018,
+  .ra = 217.053,
+  .dec = 25.8297,
+},
+{ .is_ngc = FALSE,
+  .id = 1019,
+  .ra = 217.056,
+  .dec = 25.9469,
+},
+{ .is_ngc = FALSE,
+  .id = 1020,
+  .ra = 217.206,
+  .dec = 26.0322,
+},
+{ .is_ngc = FALSE,
+  .id = 1021,
+  .ra = 217.321,
+  .dec = 20.6544,
+},
+{ .is_ngc = FALSE,
+  .id = 1022,
+  .ra = 217.508,
+  .dec = 3.77261,
+},
+{ .is_ngc = FALSE,
+  .id = 1023,
+  .ra = 218.104,
+  .dec = -35.8006,
+},
+{ .is_ngc = FALSE,
+  .id = 1024,
+  .ra = 217.863,
+  .dec = 3.00811,
+},
+{ .is_ngc = FALSE,
+  .id = 1025,
+  .ra = 217.868,
+  .dec = 7.06333,
+},
+{ .is_ngc = FALSE,
+  .id = 1027,
+  .ra = 217.452,
+  .dec = 53.965,
+},
+{ .is_ngc = FALSE,
+  .id = 1028,
+  .ra = 218.319,
+  .dec = 41.6503,
+},
+{ .is_ngc = FALSE,
+  .id = 1029,
+  .ra = 218.114,
+  .dec = 49.9043,
+},
+{ .is_ngc = FALSE,
+  .id = 1031,
+  .ra = 218.6,
+  .dec = 48.0375,
+},
+{ .is_ngc = FALSE,
+  .id = 1032,
+  .ra = 218.663,
+  .dec = 47.9683,
+},
+{ .is_ngc = FALSE,
+  .id = 1033,
+  .ra = 218.674,
+  .dec = 47.9374,
+},
+{ .is_ngc = FALSE,
+  .id = 1034,
+  .ra = 219.307,
+  .dec = 14.6652,
+},
+{ .is_ngc = FALSE,
+  .id = 1035,
+  .ra = 219.543,
+  .dec = 9.33622,
+},
+{ .is_ngc = FALSE,
+  .id = 1036,
+  .ra = 219.595,
+  .dec = 18.1106,
+},
+{ .is_ngc = FALSE,
+  .id = 1037,
+  .ra = 219.606,
+  .dec = 18.1839,
+},
+{ .is_ngc = FALSE,
+  .id = 1038,
+  .ra = 219.864,
+  .dec = 11.9281,
+},
+{ .is_ngc = FALSE,
+  .id = 1039,
+  .ra = 220.122,
+  .dec = 3.43249,
+},
+{ .is_ngc = FALSE,
+  .id = 1040,
+  .ra = 220.094,
+  .dec = 9.47633,
+},
+{ .is_ngc = FALSE,
+  .id = 1041,
+  .ra = 220.157,
+  .dec = 3.37639,
+},
+{ .is_ngc = FALSE,
+  .id = 1042,
+  .ra = 220.162,
+  .dec = 3.46928,
+},
+{ .is_ngc = FALSE,
+  .id = 1043,
+  .ra = 220.18,
+  .dec = 3.37415,
+},
+{ .is_ngc = FALSE,
+  .id = 1044,
+  .ra = 220.37,
+  .dec = 9.43111,
+},
+{ .is_ngc = FALSE,
+  .id = 1046,
+  .ra = 219.472,
+  .dec = 69.0143,
+},
+{ .is_ngc = FALSE,
+  .id = 1047,
+  .ra = 220.582,
+  .dec = 19.1914,
+},
+{ .is_ngc = FALSE,
+  .id = 1048,
+  .ra = 220.741,
+  .dec = 4.88983,
+},
+{ .is_ngc = FALSE,
+  .id = 1049,
+  .ra = 219.888,
+  .dec = 62.0027,
+},
+{ .is_ngc = FALSE,
+  .id = 1050,
+  .ra = 221.03,
+  .dec = 18.0125,
+},
+{ .is_ngc = FALSE,
+  .id = 1051,
+  .ra = 221.049,
+  .dec = 19.0202,
+},
+{ .is_ngc = FALSE,
+  .id = 1052,
+  .ra = 221.059,
+  .dec = 20.6138,
+},
+{ .is_ngc = FALSE,
+  .id = 1053,
+  .ra = 221.43,
+  .dec = 16.9461,
+},
+{ .is_ngc = FALSE,
+  .id = 1054,
+  .ra = 221.63,
+  .dec = 1.27451,
+},
+{ .is_ngc = FALSE,
+  .id = 1058,
+  .ra = 222.302,
+  .dec = 17.0206,
+},
+{ .is_ngc = FALSE,
+  .id = 1059,
+  .ra = 222.677,
+  .dec = -0.875803,
+},
+{ .is_ngc = FALSE,
+  .id = 1060,
+  .ra = 222.947,
+  .dec = -7.23303,
+},
+{ .is_ngc = FALSE,
+  .id = 1061,
+  .ra = 222.809,
+  .dec = 18.7572,
+},
+{ .is_ngc = FALSE,
+  .id = 1062,
+  .ra = 222.824,
+  .dec = 18.687,
+},
+{ .is_ngc = FALSE,
+  .id = 1065,
+  .ra = 222.339,
+  .dec = 63.2701,
+},
+{ .is_ngc = FALSE,
+  .id = 1066,
+  .ra = 223.262,
+  .dec = 3.29569,
+},
+{ .is_ngc = FALSE,
+  .id = 1067,
+  .ra = 223.272,
+  .dec = 3.33131,
+},
+{ .is_ngc = FALSE,
+  .id = 1068,
+  .ra = 223.387,
+  .dec = 3.07714,
+},
+{ .is_ngc = FALSE,
+  .id = 1069,
+  .ra = 222.694,
+  .dec = 54.4109,
+},
+{ .is_ngc = FALSE,
+  .id = 1070,
+  .ra = 223.464,
+  .dec = 3.48438,
+},
+{ .is_ngc = FALSE,
+  .id = 1071,
+  .ra = 223.552,
+  .dec = 4.74979,
+},
+{ .is_ngc = FALSE,
+  .id = 1072,
+  .ra = 223.555,
+  .dec = 4.84134,
+},
+{ .is_ngc = FALSE,
+  .id = 1073,
+  .ra = 223.56,
+  .dec = 4.79389,
+},
+{ .is_ngc = FALSE,
+  .id = 1074,
+  .ra = 222.989,
+  .dec = 51.2647,
+},
+{ .is_ngc = FALSE,
+  .id = 1075,
+  .ra = 223.705,
+  .dec = 18.1055,
+},
+{ .is_ngc = FALSE,
+  .id = 1076,
+  .ra = 223.748,
+  .dec = 18.0374,
+},
+{ .is_ngc = FALSE,
+  .id = 1077,
+  .ra = 224.34,
+  .dec = -19.2144,
+},
+{ .is_ngc = FALSE,
+  .id = 1078,
+  .ra = 224.121,
+  .dec = 9.35425,
+},
+{ .is_ngc = FALSE,
+  .id = 1079,
+  .ra = 224.151,
+  .dec = 9.36949,
+},
+{ .is_ngc = FALSE,
+  .id = 1080,
+  .ra = 224.499,
+  .dec = -6.72359,
+},
+{ .is_ngc = FALSE,
+  .id = 1081,
+  .ra = 224.729,
+  .dec = -19.2397,
+},
+{ .is_ngc = FALSE,
+  .id = 1082,
+  .ra = 224.719,
+  .dec = 7.00711,
+},
+{ .is_ngc = FALSE,
+  .id = 1083,
+  .ra = 223.889,
+  .dec = 68.4083,
+},
+{ .is_ngc = FALSE,
+  .id = 1084,
+  .ra = 225.312,
+  .dec = -7.47525,
+},
+{ .is_ngc = FALSE,
+  .id = 1085,
+  .ra = 225.681,
+  .dec = 17.2524,
+},
+{ .is_ngc = FALSE,
+  .id = 1086,
+  .ra = 225.871,
+  .dec = 17.1145,
+},
+{ .is_ngc = FALSE,
+  .id = 1087,
+  .ra = 226.683,
+  .dec = 3.77701,
+},
+{ .is_ngc = FALSE,
+  .id = 1088,
+  .ra = 226.698,
+  .dec = 3.79183,
+},
+{ .is_ngc = FALSE,
+  .id = 1089,
+  .ra = 226.859,
+  .dec = 7.11654,
+},
+{ .is_ngc = FALSE,
+  .id = 1090,
+  .ra = 226.429,
+  .dec = 42.6831,
+},
+{ .is_ngc = FALSE,
+  .id = 1091,
+  .ra = 227.057,
+  .dec = -11.1414,
+},
+{ .is_ngc = FALSE,
+  .id = 1092,
+  .ra = 226.901,
+  .dec = 9.35862,
+},
+{ .is_ngc = FALSE,
+  .id = 1093,
+  .ra = 226.899,
+  .dec = 14.5481,
+},
+{ .is_ngc = FALSE,
+  .id = 1095,
+  .ra = 227.146,
+  .dec = 13.6707,
+},
+{ .is_ngc = FALSE,
+  .id = 1096,
+  .ra = 227.09,
+  .dec = 19.1919,
+},
+{ .is_ngc = FALSE,
+  .id = 1097,
+  .ra = 227.131,
+  .dec = 19.1841,
+},
+{ .is_ngc = FALSE,
+  .id = 1098,
+  .ra = 226.606,
+  .dec = 55.6012,
+},
+{ .is_ngc = FALSE,
+  .id = 1099,
+  .ra = 226.728,
+  .dec = 56.5087,
+},
+{ .is_ngc = FALSE,
+  .id = 1101,
+  .ra = 227.734,
+  .dec = 5.74486,
+},
+{ .is_ngc = FALSE,
+  .id = 1102,
+  .ra = 227.77,
+  .dec = 4.29353,
+},
+{ .is_ngc = FALSE,
+  .id = 1103,
+  .ra = 227.899,
+  .dec = 19.2077,
+},
+{ .is_ngc = FALSE,
+  .id = 1104,
+  .ra = 228.208,
+  .dec = -5.05561,
+},
+{ .is_ngc = FALSE,
+  .id = 1105,
+  .ra = 228.308,
+  .dec = 4.28764,
+},
+{ .is_ngc = FALSE,
+  .id = 1106,
+  .ra = 228.484,
+  .dec = 4.71061,
+},
+{ .is_ngc = FALSE,
+  .id = 1107,
+  .ra = 228.537,
+  .dec = 4.71438,
+},
+{ .is_ngc = FALSE,
+  .id = 1109,
+  .ra = 229.266,
+  .dec = 5.25613,
+},
+{ .is_ngc = FALSE,
+  .id = 1110,
+  .ra = 228.021,
+  .dec = 67.3625,
+},
+{ .is_ngc = FALSE,
+  .id = 1112,
+  .ra = 229.447,
+  .dec = 7.21889,
+},
+{ .is_ngc = FALSE,
+  .id = 1113,
+  .ra = 229.563,
+  .dec = 12.4881,
+},
+{ .is_ngc = FALSE,
+  .id = 1114,
+  .ra = 227.829,
+  .dec = 75.4347,
+},
+{ .is_ngc = FALSE,
+  .id = 1114,
+  .ra = 227.857,
+  .dec = 75.4267,
+},
+{ .is_ngc = FALSE,
+  .id = 1115,
+  .ra = 230.579,
+  .dec = -4.47417,
+},
+{ .is_ngc = FALSE,
+  .id = 1116,
+  .ra = 230.48,
+  .dec = 8.42389,
+},
+{ .is_ngc = FALSE,
+  .id = 1117,
+  .ra = 231.095,
+  .dec = 15.4886,
+},
+{ .is_ngc = FALSE,
+  .id = 1119,
+  .ra = 231.435,
+  .dec = -3.65611,
+},
+{ .is_ngc = FALSE,
+  .id = 1121,
+  .ra = 231.934,
+  .dec = 6.80382,
+},
+{ .is_ngc = FALSE,
+  .id = 1122,
+  .ra = 232.346,
+  .dec = 7.61719,
+},
+{ .is_ngc = FALSE,
+  .id = 1123,
+  .ra = 232.225,
+  .dec = 42.8984,
+},
+{ .is_ngc = FALSE,
+  .id = 1124,
+  .ra = 232.504,
+  .dec = 23.6382,
+},
+{ .is_ngc = FALSE,
+  .id = 1126,
+  .ra = 233.753,
+  .dec = 4.99064,
+},
+{ .is_ngc = FALSE,
+  .id = 1129,
+  .ra = 233.001,
+  .dec = 68.2465,
+},
+{ .is_ngc = FALSE,
+  .id = 1130,
+  .ra = 234.433,
+  .dec = 17.2442,
+},
+{ .is_ngc = FALSE,
+  .id = 1131,
+  .ra = 234.715,
+  .dec = 12.0806,
+},
+{ .is_ngc = FALSE,
+  .id = 1132,
+  .ra = 235.028,
+  .dec = 20.6803,
+},
+{ .is_ngc = FALSE,
+  .id = 1133,
+  .ra = 235.3,
+  .dec = 15.5727,
+},
+{ .is_ngc = FALSE,
+  .id = 1135,
+  .ra = 236.395,
+  .dec = 17.6994,
+},
+{ .is_ngc = FALSE,
+  .id = 1136,
+  .ra = 236.893,
+  .dec = -1.54532,
+},
+{ .is_ngc = FALSE,
+  .id = 1137,
+  .ra = 237.135,
+  .dec = 8.58847,
+},
+{ .is_ngc = FALSE,
+  .id = 1138,
+  .ra = 237.066,
+  .dec = 26.206,
+},
+{ .is_ngc = FALSE,
+  .id = 1139,
+  .ra = 232.358,
+  .dec = 82.5833,
+},
+{ .is_ngc = FALSE,
+  .id = 1140,
+  .ra = 237.355,
+  .dec = 19.1133,
+},
+{ .is_ngc = FALSE,
+  .id = 1141,
+  .ra = 237.446,
+  .dec = 12.3991,
+},
+{ .is_ngc = FALSE,
+  .id = 1142,
+  .ra = 237.608,
+  .dec = 18.1395,
+},
+{ .is_ngc = FALSE,
+  .id = 1143,
+  .ra = 232.732,
+  .dec = 82.4557,
+},
+{ .is_ngc = FALSE,
+  .id = 1144,
+  .ra = 237.841,
+  .dec = 43.4178,
+},
+{ .is_ngc = FALSE,
+  .id = 1145,
+  .ra = 236.035,
+  .dec = 72.4309,
+},
+{ .is_ngc = FALSE,
+  .id = 1146,
+  .ra = 237.092,
+  .dec = 69.3854,
+},
+{ .is_ngc = FALSE,
+  .id = 1147,
+  .ra = 237.548,
+  .dec = 69.5594,
+},
+{ .is_ngc = FALSE,
+  .id = 1149,
+  .ra = 239.533,
+  .dec = 12.0699,
+},
+{ .is_ngc = FALSE,
+  .id = 1150,
+  .ra = 239.577,
+  .dec = 15.8744,
+},
+{ .is_ngc = FALSE,
+  .id = 1151,
+  .ra = 239.635,
+  .dec = 17.4418,
+},
+{ .is_ngc = FALSE,
+  .id = 1152,
+  .ra = 239.181,
+  .dec = 48.0949,
+},
+{ .is_ngc = FALSE,
+  .id = 1153,
+  .ra = 239.263,
+  .dec = 48.1681,
+},
+{ .is_ngc = FALSE,
+  .id = 1154,
+  .ra = 238.119,
+  .dec = 70.375,
+},
+{ .is_ngc = FALSE,
+  .id = 1155,
+  .ra = 240.149,
+  .dec = 15.6852,
+},
+{ .is_ngc = FALSE,
+  .id = 1156,
+  .ra = 240.156,
+  .dec = 19.7231,
+},
+{ .is_ngc = FALSE,
+  .id = 1157,
+  .ra = 240.234,
+  .dec = 15.5259,
+},
+{ .is_ngc = FALSE,
+  .id = 1158,
+  .ra = 240.392,
+  .dec = 1.70742,
+},
+{ .is_ngc = FALSE,
+  .id = 1159,
+  .ra = 240.256,
+  .dec = 15.4191,
+},
+{ .is_ngc = FALSE,
+  .id = 1160,
+  .ra = 240.261,
+  .dec = 15.4943,
+},
+{ .is_ngc = FALSE,
+  .id = 1161,
+  .ra = 240.32,
+  .dec = 15.6448,
+},
+{ .is_ngc = FALSE,
+  .id = 1162,
+  .ra = 240.318,
+  .dec = 17.6777,
+},
+{ .is_ngc = FALSE,
+  .id = 1163,
+  .ra = 240.378,
+  .dec = 15.5034,
+},
+{ .is_ngc = FALSE,
+  .id = 1164,
+  .ra = 238.761,
+  .dec = 70.5865,
+},
+{ .is_ngc = FALSE,
+  .id = 1166,
+  .ra = 240.537,
+  .dec = 26.3272,
+},
+{ .is_ngc = FALSE,
+  .id = 1167,
+  .ra = 240.971,
+  .dec = 14.9457,
+},
+{ .is_ngc = FALSE,
+  .id = 1169,
+  .ra = 241.056,
+  .dec = 13.7432,
+},
+{ .is_ngc = FALSE,
+  .id = 1170,
+  .ra = 241.132,
+  .dec = 17.7212,
+},
+{ .is_ngc = FALSE,
+  .id = 1171,
+  .ra = 241.216,
+  .dec = 17.9788,
+},
+{ .is_ngc = FALSE,
+  .id = 1173,
+  .ra = 241.303,
+  .dec = 17.4224,
+},
+{ .is_ngc = FALSE,
+  .id = 1174,
+  .ra = 241.362,
+  .dec = 15.025,
+},
+{ .is_ngc = FALSE,
+  .id = 1175,
+  .ra = 241.344,
+  .dec = 18.1631,
+},
+{ .is_ngc = FALSE,
+  .id = 1177,
+  .ra = 241.331,
+  .dec = 18.3144,
+},
+{ .is_ngc = FALSE,
+  .id = 1180,
+  .ra = 241.375,
+  .dec = 18.1483,
+},
+{ .is_ngc = FALSE,
+  .id = 1182,
+  .ra = 241.403,
+  .dec = 17.8017,
+},
+{ .is_ngc = FALSE,
+  .id = 1184,
+  .ra = 241.428,
+  .dec = 17.7889,
+},
+{ .is_ngc = FALSE,
+  .id = 1185,
+  .ra = 241.436,
+  .dec = 17.7163,
+},
+{ .is_ngc = FALSE,
+  .id = 1186,
+  .ra = 241.434,
+  .dec = 17.3616,
+},
+{ .is_ngc = FALSE,
+  .id = 1187,
+  .ra = 239.792,
+  .dec = 70.5566,
+},
+{ .is_ngc = FALSE,
+  .id = 1189,
+  .ra = 241.562,
+  .dec = 18.1824,
+},
+{ .is_ngc = FALSE,
+  .id = 1190,
+  .ra = 241.468,
+  .dec = 18.2204,
+},
+{ .is_ngc = FALSE,
+  .id = 1192,
+  .ra = 241.638,
+  .dec = 17.7756,
+},
+{ .is_ngc = FALSE,
+  .id = 1193,
+  .ra = 241.634,
+  .dec = 17.7134,
+},
+{ .is_ngc = FALSE,
+  .id = 1194,
+  .ra = 241.664,
+  .dec = 17.7609,
+},
+{ .is_ngc = FALSE,
+  .id = 1195,
+  .ra = 241.67,
+  .dec = 17.1911,
+},
+{ .is_ngc = FALSE,
+  .id = 1196,
+  .ra = 241.993,
+  .dec = 10.7794,
+},
+{ .is_ngc = FALSE,
+  .id = 1197,
+  .ra = 242.072,
+  .dec = 7.5385,
+},
+{ .is_ngc = FALSE,
+  .id = 1198,
+  .ra = 242.152,
+  .dec = 12.3305,
+},
+{ .is_ngc = FALSE,
+  .id = 1199,
+  .ra = 242.643,
+  .dec = 10.0399,
+},
+{ .is_ngc = FALSE,
+  .id = 1201,
+  .ra = 241.424,
+  .dec = 69.5938,
+},
+{ .is_ngc = FALSE,
+  .id = 1203,
+  .ra = 243.817,
+  .dec = -22.3347,
+},
+{ .is_ngc = FALSE,
+  .id = 1203,
+  .ra = 243.817,
+  .dec = -22.3706,
+},
+{ .is_ngc = FALSE,
+  .id = 1204,
+  .ra = 241.815,
+  .dec = 69.9312,
+},
+{ .is_ngc = FALSE,
+  .id = 1205,
+  .ra = 243.566,
+  .dec = 9.53699,
+},
+{ .is_ngc = FALSE,
+  .id = 1206,
+  .ra = 243.804,
+  .dec = 11.2972,
+},
+{ .is_ngc = FALSE,
+  .id = 1207,
+  .ra = 244.861,
+  .dec = -29.6503,
+},
+{ .is_ngc = FALSE,
+  .id = 1208,
+  .ra = 243.95,
+  .dec = 36.5271,
+},
+{ .is_ngc = FALSE,
+  .id = 1209,
+  .ra = 244.665,
+  .dec = 15.5582,
+},
+{ .is_ngc = FALSE,
+  .id = 1210,
+  .ra = 243.626,
+  .dec = 62.5365,
+},
+{ .is_ngc = FALSE,
+  .id = 1211,
+  .ra = 244.217,
+  .dec = 53.0059,
+},
+{ .is_ngc = FALSE,
+  .id = 1212,
+  .ra = 243.878,
+  .dec = 64.2249,
+},
+{ .is_ngc = FALSE,
+  .id = 1214,
+  .ra = 244.048,
+  .dec = 65.9686,
+},
+{ .is_ngc = FALSE,
+  .id = 1215,
+  .ra = 243.896,
+  .dec = 68.3975,
+},
+{ .is_ngc = FALSE,
+  .id = 1216,
+  .ra = 243.979,
+  .dec = 68.3502,
+},
+{ .is_ngc = FALSE,
+  .id = 1217,
+  .ra = 244.017,
+  .dec = 69.6683,
+},
+{ .is_ngc = FALSE,
+  .id = 1218,
+  .ra = 244.154,
+  .dec = 68.2022,
+},
+{ .is_ngc = FALSE,
+  .id = 1219,
+  .ra = 246.115,
+  .dec = 19.4829,
+},
+{ .is_ngc = FALSE,
+  .id = 1220,
+  .ra = 247.41,
+  .dec = 8.45078,
+},
+{ .is_ngc = FALSE,
+  .id = 1221,
+  .ra = 248.673,
+  .dec = 46.392,
+},
+{ .is_ngc = FALSE,
+  .id = 1222,
+  .ra = 248.788,
+  .dec = 46.2136,
+},
+{ .is_ngc = FALSE,
+  .id = 1223,
+  .ra = 248.927,
+  .dec = 49.2205,
+},
+{ .is_ngc = FALSE,
+  .id = 1224,
+  .ra = 250.735,
+  .dec = 19.2538,
+},
+{ .is_ngc = FALSE,
+  .id = 1225,
+  .ra = 249.219,
+  .dec = 67.629,
+},
+{ .is_ngc = FALSE,
+  .id = 1228,
+  .ra = 250.528,
+  .dec = 65.5851,
+},
+{ .is_ngc = FALSE,
+  .id = 1229,
+  .ra = 251.244,
+  .dec = 51.3078,
+},
+{ .is_ngc = FALSE,
+  .id = 1231,
+  .ra = 251.746,
+  .dec = 58.4227,
+},
+{ .is_ngc = FALSE,
+  .id = 1234,
+  .ra = 253.212,
+  .dec = 56.8778,
+},
+{ .is_ngc = FALSE,
+  .id = 1235,
+  .ra = 253.011,
+  .dec = 63.1161,
+},
+{ .is_ngc = FALSE,
+  .id = 1236,
+  .ra = 254.624,
+  .dec = 20.0406,
+},
+{ .is_ngc = FALSE,
+  .id = 1237,
+  .ra = 254.066,
+  .dec = 55.0262,
+},
+{ .is_ngc = FALSE,
+  .id = 1238,
+  .ra = 255.126,
+  .dec = 23.0761,
+},
+{ .is_ngc = FALSE,
+  .id = 1240,
+  .ra = 255.242,
+  .dec = 61.05,
+},
+{ .is_ngc = FALSE,
+  .id = 1241,
+  .ra = 255.369,
+  .dec = 63.6907,
+},
+{ .is_ngc = FALSE,
+  .id = 1242,
+  .ra = 257.179,
+  .dec = 4.0495,
+},
+{ .is_ngc = FALSE,
+  .id = 1243,
+  .ra = 257.602,
+  .dec = 10.7675,
+},
+{ .is_ngc = FALSE,
+  .id = 1244,
+  .ra = 257.641,
+  .dec = 36.3032,
+},
+{ .is_ngc = FALSE,
+  .id = 1245,
+  .ra = 258.153,
+  .dec = 38.0201,
+},
+{ .is_ngc = FALSE,
+  .id = 1246,
+  .ra = 258.551,
+  .dec = 20.2373,
+},
+{ .is_ngc = FALSE,
+  .id = 1247,
+  .ra = 259.092,
+  .dec = -12.7812,
+},
+{ .is_ngc = FALSE,
+  .id = 1248,
+  .ra = 257.918,
+  .dec = 59.9954,
+},
+{ .is_ngc = FALSE,
+  .id = 1249,
+  .ra = 258.729,
+  .dec = 35.5204,
+},
+{ .is_ngc = FALSE,
+  .id = 1250,
+  .ra = 258.621,
+  .dec = 57.4171,
+},
+{ .is_ngc = FALSE,
+  .id = 1251,
+  .ra = 257.554,
+  .dec = 72.4098,
+},
+{ .is_ngc = FALSE,
+  .id = 1254,
+  .ra = 257.89,
+  .dec = 72.4018,
+},
+{ .is_ngc = FALSE,
+  .id = 1255,
+  .ra = 260.773,
+  .dec = 12.6955,
+},
+{ .is_ngc = FALSE,
+  .id = 1256,
+  .ra = 260.947,
+  .dec = 26.4865,
+},
+{ .is_ngc = FALSE,
+  .id = 1257,
+  .ra = 261.785,
+  .dec = -7.09322,
+},
+{ .is_ngc = FALSE,
+  .id = 1258,
+  .ra = 261.822,
+  .dec = 58.4852,
+},
+{ .is_ngc = FALSE,
+  .id = 1260,
+  .ra = 261.882,
+  .dec = 58.4758,
+},
+{ .is_ngc = FALSE,
+  .id = 1262,
+  .ra = 263.259,
+  .dec = 43.7594,
+},
+{ .is_ngc = FALSE,
+  .id = 1263,
+  .ra = 263.28,
+  .dec = 43.8216,
+},
+{ .is_ngc = FALSE,
+  .id = 1264,
+  .ra = 263.32,
+  .dec = 43.6287,
+},
+{ .is_ngc = FALSE,
+  .id = 1265,
+  .ra = 264.164,
+  .dec = 42.0881,
+},
+{ .is_ngc = FALSE,
+  .id = 1266,
+  .ra = 266.397,
+  .dec = -46.0896,
+},
+{ .is_ngc = FALSE,
+  .id = 1267,
+  .ra = 264.691,
+  .dec = 59.3728,
+},
+{ .is_ngc = FALSE,
+  .id = 1268,
+  .ra = 267.664,
+  .dec = 17.2093,
+},
+{ .is_ngc = FALSE,
+  .id = 1269,
+  .ra = 268.025,
+  .dec = 21.569,
+},
+{ .is_ngc = FALSE,
+  .id = 1270,
+  .ra = 266.988,
+  .dec = 62.2233,
+},
+{ .is_ngc = FALSE,
+  .id = 1271,
+  .ra = 271.304,
+  .dec = -24.4017,
+},
+{ .is_ngc = FALSE,
+  .id = 1272,
+  .ra = 271.232,
+  .dec = 25.1292,
+},
+{ .is_ngc = FALSE,
+  .id = 1273,
+  .ra = 271.262,
+  .dec = 25.1325,
+},
+{ .is_ngc = FALSE,
+  .id = 1274,
+  .ra = 272.462,
+  .dec = -23.6358,
+},
+{ .is_ngc = FALSE,
+  .id = 1275,
+  .ra = 272.529,
+  .dec = -23.7519,
+},
+{ .is_ngc = FALSE,
+  .id = 1276,
+  .ra = 272.689,
+  .dec = -7.21278,
+},
+{ .is_ngc = FALSE,
+  .id = 1277,
+  .ra = 272.614,
+  .dec = 31.0032,
+},
+{ .is_ngc = FALSE,
+  .id = 1278,
+  .ra = 272.674,
+  .dec = 31.1494,
+},
+{ .is_ngc = FALSE,
+  .id = 1279,
+  .ra = 272.814,
+  .dec = 36.0073,
+},
+{ .is_ngc = FALSE,
+  .id = 1282,
+  .ra = 273.522,
+  .dec = 21.1019,
+},
+{ .is_ngc = FALSE,
+  .id = 1283,
+  .ra = 274.32,
+  .dec = -19.7619,
+},
+{ .is_ngc = FALSE,
+  .id = 1284,
+  .ra = 274.413,
+  .dec = -19.6675,
+},
+{ .is_ngc = FALSE,
+  .id = 1285,
+  .ra = 274.042,
+  .dec = 25.1008,
+},
+{ .is_ngc = FALSE,
+  .id = 1286,
+  .ra = 274.06,
+  .dec = 55.5904,
+},
+{ .is_ngc = FALSE,
+  .id = 1287,
+  .ra = 277.857,
+  .dec = -10.7956,
+},
+{ .is_ngc = FALSE,
+  .id = 1288,
+  .ra = 277.344,
+  .dec = 39.7132,
+},
+{ .is_ngc = FALSE,
+  .id = 1289,
+  .ra = 277.51,
+  .dec = 39.964,
+},
+{ .is_ngc = FALSE,
+  .id = 1290,
+  .ra = 279.646,
+  .dec = -24.0856,
+},
+{ .is_ngc = FALSE,
+  .id = 1291,
+  .ra = 278.468,
+  .dec = 49.2786,
+},
+{ .is_ngc = FALSE,
+  .id = 1292,
+  .ra = 281.167,
+  .dec = -27.8167,
+},
+{ .is_ngc = FALSE,
+  .id = 1293,
+  .ra = 280.405,
+  .dec = 56.3169,
+},
+{ .is_ngc = FALSE,
+  .id = 1294,
+  .ra = 282.46,
+  .dec = 40.2092,
+},
+{ .is_ngc = FALSE,
+  .id = 1294,
+  .ra = 282.345,
+  .dec = 40.105,
+},
+{ .is_ngc = FALSE,
+  .id = 1295,
+  .ra = 283.655,
+  .dec = -8.82672,
+},
+{ .is_ngc = FALSE,
+  .id = 1296,
+  .ra = 283.328,
+  .dec = 33.0664,
+},
+{ .is_ngc = FALSE,
+  .id = 1297,
+  .ra = 289.347,
+  .dec = -39.613,
+},
+{ .is_ngc = FALSE,
+  .id = 1298,
+  .ra = 289.649,
+  .dec = -1.59611,
+},
+{ .is_ngc = FALSE,
+  .id = 1299,
+  .ra = 290.675,
+  .dec = 20.7394,
+},
+{ .is_ngc = FALSE,
+  .id = 1301,
+  .ra = 291.656,
+  .dec = 49.7582,
+},
+{ .is_ngc = FALSE,
+  .id = 1302,
+  .ra = 292.721,
+  .dec = 35.7842,
+},
+{ .is_ngc = FALSE,
+  .id = 1303,
+  .ra = 292.876,
+  .dec = 35.8758,
+},
+{ .is_ngc = FALSE,
+  .id = 1304,
+  .ra = 293.775,
+  .dec = 41.1,
+},
+{ .is_ngc = FALSE,
+  .id = 1305,
+  .ra = 294.821,
+  .dec = 20.1942,
+},
+{ .is_ngc = FALSE,
+  .id = 1306,
+  .ra = 295.421,
+  .dec = 37.6836,
+},
+{ .is_ngc = FALSE,
+  .id = 1306,
+  .ra = 295.425,
+  .dec = 37.6497,
+},
+{ .is_ngc = FALSE,
+  .id = 1307,
+  .ra = 295.521,
+  .dec = 27.75,
+},
+{ .is_ngc = FALSE,
+  .id = 1308,
+  .ra = 296.272,
+  .dec = -14.7214,
+},
+{ .is_ngc = FALSE,
+  .id = 1309,
+  .ra = 300.756,
+  .dec = -17.2319,
+},
+{ .is_ngc = FALSE,
+  .id = 1310,
+  .ra = 302.504,
+  .dec = 34.9686,
+},
+{ .is_ngc = FALSE,
+  .id = 1311,
+  .ra = 302.699,
+  .dec = 41.1739,
+},
+{ .is_ngc = FALSE,
+  .id = 1312,
+  .ra = 304.215,
+  .dec = 18.0458,
+},
+{ .is_ngc = FALSE,
+  .id = 1313,
+  .ra = 304.682,
+  .dec = -16.9467,
+},
+{ .is_ngc = FALSE,
+  .id = 1314,
+  .ra = 304.283,
+  .dec = 25.0833,
+},
+{ .is_ngc = FALSE,
+  .id = 1315,
+  .ra = 304.341,
+  .dec = 30.6881,
+},
+{ .is_ngc = FALSE,
+  .id = 1317,
+  .ra = 305.815,
+  .dec = 0.664361,
+},
+{ .is_ngc = FALSE,
+  .id = 1318,
+  .ra = 305.557,
+  .dec = 40.2567,
+},
+{ .is_ngc = FALSE,
+  .id = 1318,
+  .ra = 306.975,
+  .dec = 39.9997,
+},
+{ .is_ngc = FALSE,
+  .id = 1319,
+  .ra = 306.507,
+  .dec = -18.5042,
+},
+{ .is_ngc = FALSE,
+  .id = 1320,
+  .ra = 306.607,
+  .dec = 2.90958,
+},
+{ .is_ngc = FALSE,
+  .id = 1321,
+  .ra = 307.047,
+  .dec = -18.2919,
+},
+{ .is_ngc = FALSE,
+  .id = 1322,
+  .ra = 307.535,
+  .dec = -15.2279,
+},
+{ .is_ngc = FALSE,
+  .id = 1323,
+  .ra = 307.623,
+  .dec = -15.1822,
+},
+{ .is_ngc = FALSE,
+  .id = 1324,
+  .ra = 308.051,
+  .dec = -9.05623,
+},
+{ .is_ngc = FALSE,
+  .id = 1327,
+  .ra = 308.922,
+  .dec = -0.00591667,
+},
+{ .is_ngc = FALSE,
+  .id = 1328,
+  .ra = 310.488,
+  .dec = -19.6328,
+},
+{ .is_ngc = FALSE,
+  .id = 1329,
+  .ra = 310.925,
+  .dec = 15.5972,
+},
+{ .is_ngc = FALSE,
+  .id = 1330,
+  .ra = 311.562,
+  .dec = -14.0233,
+},
+{ .is_ngc = FALSE,
+  .id = 1331,
+  .ra = 311.953,
+  .dec = -9.99556,
+},
+{ .is_ngc = FALSE,
+  .id = 1332,
+  .ra = 312.964,
+  .dec = -13.7116,
+},
+{ .is_ngc = FALSE,
+  .id = 1333,
+  .ra = 313.072,
+  .dec = -16.2431,
+},
+{ .is_ngc = FALSE,
+  .id = 1335,
+  .ra = 313.275,
+  .dec = -16.3354,
+},
+{ .is_ngc = FALSE,
+  .id = 1336,
+  .ra = 313.77,
+  .dec = -18.0386,
+},
+{ .is_ngc = FALSE,
+  .id = 1337,
+  .ra = 314.219,
+  .dec = -16.5858,
+},
+{ .is_ngc = FALSE,
+  .id = 1338,
+  .ra = 314.241,
+  .dec = -16.4925,
+},
+{ .is_ngc = FALSE,
+  .id = 1339,
+  .ra = 314.481,
+  .dec = -17.9425,
+},
+{ .is_ngc = FALSE,
+  .id = 1340,
+  .ra = 314.035,
+  .dec = 31.0478,
+},
+{ .is_ngc = FALSE,
+  .id = 1341,
+  .ra = 315.07,
+  .dec = -13.9762,
+},
+{ .is_ngc = FALSE,
+  .id = 1342,
+  .ra = 315.106,
+  .dec = -14.4953,
+},
+{ .is_ngc = FALSE,
+  .id = 1343,
+  .ra = 315.253,
+  .dec = -15.4038,
+},
+{ .is_ngc = FALSE,
+  .id = 1344,
+  .ra = 315.319,
+  .dec = -13.3806,
+},
+{ .is_ngc = FALSE,
+  .id = 1345,
+  .ra = 315.343,
+  .dec = -13.3976,
+},
+{ .is_ngc = FALSE,
+  .id = 1346,
+  .ra = 315.404,
+  .dec = -13.9606,
+},
+{ .is_ngc = FALSE,
+  .id = 1347,
+  .ra = 315.435,
+  .dec = -13.3132,
+},
+{ .is_ngc = FALSE,
+  .id = 1348,
+  .ra = 315.434,
+  .dec = -13.3575,
+},
+{ .is_ngc = FALSE,
+  .id = 1349,
+  .ra = 315.46,
+  .dec = -13.2654,
+},
+{ .is_ngc = FALSE,
+  .id = 1351,
+  .ra = 315.469,
+  .dec = -13.2018,
+},
+{ .is_ngc = FALSE,
+  .id = 1352,
+  .ra = 315.478,
+  .dec = -13.3847,
+},
+{ .is_ngc = FALSE,
+  .id = 1353,
+  .ra = 315.485,
+  .dec = -13.2728,
+},
+{ .is_ngc = FALSE,
+  .id = 1355,
+  .ra = 315.493,
+  .dec = -13.1729,
+},
+{ .is_ngc = FALSE,
+  .id = 1356,
+  .ra = 315.721,
+  .dec = -15.8119,
+},
+{ .is_ngc = FALSE,
+  .id = 1357,
+  .ra = 316.489,
+  .dec = -10.7164,
+},
+{ .is_ngc = FALSE,
+  .id = 1358,
+  .ra = 316.623,
+  .dec = -16.2042,
+},
+{ .is_ngc = FALSE,
+  .id = 1359,
+  .ra = 317.179,
+  .dec = 12.4839,
+},
+{ .is_ngc = FALSE,
+  .id = 1360,
+  .ra = 317.71,
+  .dec = 5.07111,
+},
+{ .is_ngc = FALSE,
+  .id = 1361,
+  .ra = 317.872,
+  .dec = 5.05428,
+},
+{ .is_ngc = FALSE,
+  .id = 1362,
+  .ra = 317.97,
+  .dec = 2.32889,
+},
+{ .is_ngc = FALSE,
+  .id = 1363,
+  .ra = 317.668,
+  .dec = 46.87,
+},
+{ .is_ngc = FALSE,
+  .id = 1364,
+  .ra = 318.353,
+  .dec = 2.76948,
+},
+{ .is_ngc = FALSE,
+  .id = 1365,
+  .ra = 318.482,
+  .dec = 2.56444,
+},
+{ .is_ngc = FALSE,
+  .id = 1366,
+  .ra = 318.533,
+  .dec = 1.77574,
+},
+{ .is_ngc = FALSE,
+  .id = 1367,
+  .ra = 318.541,
+  .dec = 2.99348,
+},
+{ .is_ngc = FALSE,
+  .id = 1368,
+  .ra = 318.552,
+  .dec = 2.17761,
+},
+{ .is_ngc = FALSE,
+  .id = 1369,
+  .ra = 318.038,
+  .dec = 47.7683,
+},
+{ .is_ngc = FALSE,
+  .id = 1370,
+  .ra = 318.809,
+  .dec = 2.19197,
+},
+{ .is_ngc = FALSE,
+  .id = 1371,
+  .ra = 320.065,
+  .dec = -4.87677,
+},
+{ .is_ngc = FALSE,
+  .id = 1372,
+  .ra = 320.071,
+  .dec = -5.60469,
+},
+{ .is_ngc = FALSE,
+  .id = 1373,
+  .ra = 320.155,
+  .dec = 1.09223,
+},
+{ .is_ngc = FALSE,
+  .id = 1374,
+  .ra = 320.261,
+  .dec = 1.71261,
+},
+{ .is_ngc = FALSE,
+  .id = 1375,
+  .ra = 320.249,
+  .dec = 3.98514,
+},
+{ .is_ngc = FALSE,
+  .id = 1376,
+  .ra = 321.171,
+  .dec = -5.73472,
+},
+{ .is_ngc = FALSE,
+  .id = 1377,
+  .ra = 321.361,
+  .dec = 4.31361,
+},
+{ .is_ngc = FALSE,
+  .id = 1378,
+  .ra = 320.715,
+  .dec = 55.4642,
+},
+{ .is_ngc = FALSE,
+  .id = 1379,
+  .ra = 321.505,
+  .dec = 3.09639,
+},
+{ .is_ngc = FALSE,
+  .id = 1380,
+  .ra = 321.796,
+  .dec = 2.71746,
+},
+{ .is_ngc = FALSE,
+  .id = 1381,
+  .ra = 321.891,
+  .dec = -1.1883,
+},
+{ .is_ngc = FALSE,
+  .id = 1383,
+  .ra = 321.915,
+  .dec = -1.10222,
+},
+{ .is_ngc = FALSE,
+  .id = 1384,
+  .ra = 321.971,
+  .dec = -1.36861,
+},
+{ .is_ngc = FALSE,
+  .id = 1385,
+  .ra = 322.213,
+  .dec = -1.06972,
+},
+{ .is_ngc = FALSE,
+  .id = 1386,
+  .ra = 322.407,
+  .dec = -21.1956,
+},
+{ .is_ngc = FALSE,
+  .id = 1387,
+  .ra = 322.394,
+  .dec = -1.35086,
+},
+{ .is_ngc = FALSE,
+  .id = 1388,
+  .ra = 322.468,
+  .dec = -0.631186,
+},
+{ .is_ngc = FALSE,
+  .id = 1389,
+  .ra = 323.033,
+  .dec = -18.0189,
+},
+{ .is_ngc = FALSE,
+  .id = 1390,
+  .ra = 323.103,
+  .dec = -1.86222,
+},
+{ .is_ngc = FALSE,
+  .id = 1391,
+  .ra = 323.751,
+  .dec = -0.511667,
+},
+{ .is_ngc = FALSE,
+  .id = 1392,
+  .ra = 323.886,
+  .dec = 35.3981,
+},
+{ .is_ngc = FALSE,
+  .id = 1393,
+  .ra = 325.058,
+  .dec = -22.412,
+},
+{ .is_ngc = FALSE,
+  .id = 1394,
+  .ra = 325.054,
+  .dec = 14.6329,
+},
+{ .is_ngc = FALSE,
+  .id = 1395,
+  .ra = 325.423,
+  .dec = 4.10429,
+},
+{ .is_ngc = FALSE,
+  .id = 1396,
+  .ra = 324.74,
+  .dec = 57.4891,
+},
+{ .is_ngc = FALSE,
+  .id = 1397,
+  .ra = 326.01,
+  .dec = -4.88482,
+},
+{ .is_ngc = FALSE,
+  .id = 1398,
+  .ra = 326.465,
+  .dec = 9.475,
+},
+{ .is_ngc = FALSE,
+  .id = 1399,
+  .ra = 326.537,
+  .dec = 4.40209,
+},
+{ .is_ngc = FALSE,
+  .id = 1400,
+  .ra = 326.067,
+  .dec = 52.9667,
+},
+{ .is_ngc = FALSE,
+  .id = 1401,
+  .ra = 326.748,
+  .dec = 1.71231,
+},
+{ .is_ngc = FALSE,
+  .id = 1402,
+  .ra = 326.242,
+  .dec = 53.2522,
+},
+{ .is_ngc = FALSE,
+  .id = 1403,
+  .ra = 327.621,
+  .dec = -2.71593,
+},
+{ .is_ngc = FALSE,
+  .id = 1404,
+  .ra = 327.735,
+  .dec = -9.26653,
+},
+{ .is_ngc = FALSE,
+  .id = 1405,
+  .ra = 327.708,
+  .dec = 2.02051,
+},
+{ .is_ngc = FALSE,
+  .id = 1406,
+  .ra = 327.77,
+  .dec = 1.98686,
+},
+{ .is_ngc = FALSE,
+  .id = 1407,
+  .ra = 328.098,
+  .dec = 3.42661,
+},
+{ .is_ngc = FALSE,
+  .id = 1408,
+  .ra = 328.288,
+  .dec = -13.3467,
+},
+{ .is_ngc = FALSE,
+  .id = 1409,
+  .ra = 328.332,
+  .dec = -7.50014,
+},
+{ .is_ngc = FALSE,
+  .id = 1410,
+  .ra = 329.009,
+  .dec = -2.90013,
+},
+{ .is_ngc = FALSE,
+  .id = 1411,
+  .ra = 329.003,
+  .dec = -1.51672,
+},
+{ .is_ngc = FALSE,
+  .id = 1412,
+  .ra = 329.577,
+  .dec = -17.1761,
+},
+{ .is_ngc = FALSE,
+  .id = 1413,
+  .ra = 329.611,
+  .dec = -3.10292,
+},
+{ .is_ngc = FALSE,
+  .id = 1414,
+  .ra = 329.575,
+  .dec = 8.4238,
+},
+{ .is_ngc = FALSE,
+  .id = 1415,
+  .ra = 329.677,
+  .dec = 1.35028,
+},
+{ .is_ngc = FALSE,
+  .id = 1416,
+  .ra = 329.706,
+  .dec = 1.45139,
+},
+{ .is_ngc = FALSE,
+  .id = 1417,
+  .ra = 330.09,
+  .dec = -13.1469,
+},
+{ .is_ngc = FALSE,
+  .id = 1418,
+  .ra = 330.5,
+  .dec = 4.38389,
+},
+{ .is_ngc = FALSE,
+  .id = 1419,
+  .ra = 330.745,
+  .dec = -9.9209,
+},
+{ .is_ngc = FALSE,
+  .id = 1421,
+  .ra = 330.767,
+  .dec = -9.978,
+},
+{ .is_ngc = FALSE,
+  .id = 1422,
+  .ra = 330.75,
+  .dec = 2.59888,
+},
+{ .is_ngc = FALSE,
+  .id = 1423,
+  .ra = 330.803,
+  .dec = 4.29722,
+},
+{ .is_ngc = FALSE,
+  .id = 1424,
+  .ra = 330.789,
+  .dec = 11.1972,
+},
+{ .is_ngc = FALSE,
+  .id = 1425,
+  .ra = 330.852,
+  .dec = 2.59489,
+},
+{ .is_ngc = FALSE,
+  .id = 1426,
+  .ra = 330.97,
+  .dec = -9.91278,
+},
+{ .is_ngc = FALSE,
+  .id = 1426,
+  .ra = 330.964,
+  .dec = -9.91917,
+},
+{ .is_ngc = FALSE,
+  .id = 1427,
+  .ra = 330.897,
+  .dec = 15.1068,
+},
+{ .is_ngc = FALSE,
+  .id = 1428,
+  .ra = 331.115,
+  .dec = 2.63056,
+},
+{ .is_ngc = FALSE,
+  .id = 1429,
+  .ra = 331.76,
+  .dec = 10.1092,
+},
+{ .is_ngc = FALSE,
+  .id = 1430,
+  .ra = 331.874,
+  .dec = -13.5811,
+},
+{ .is_ngc = FALSE,
+  .id = 1431,
+  .ra = 331.915,
+  .dec = -13.5135,
+},
+{ .is_ngc = FALSE,
+  .id = 1432,
+  .ra = 332.517,
+  .dec = 3.68949,
+},
+{ .is_ngc = FALSE,
+  .id = 1434,
+  .ra = 332.675,
+  .dec = 52.85,
+},
+{ .is_ngc = FALSE,
+  .id = 1435,
+  .ra = 333.359,
+  .dec = -22.0967,
+},
+{ .is_ngc = FALSE,
+  .id = 1436,
+  .ra = 333.464,
+  .dec = -10.192,
+},
+{ .is_ngc = FALSE,
+  .id = 1437,
+  .ra = 333.938,
+  .dec = 2.06569,
+},
+{ .is_ngc = FALSE,
+  .id = 1438,
+  .ra = 334.122,
+  .dec = -21.4314,
+},
+{ .is_ngc = FALSE,
+  .id = 1439,
+  .ra = 334.168,
+  .dec = -21.4861,
+},
+{ .is_ngc = FALSE,
+  .id = 1440,
+  .ra = 334.138,
+  .dec = -16.0164,
+},
+{ .is_ngc = FALSE,
+  .id = 1441,
+  .ra = 333.83,
+  .dec = 37.3012,
+},
+{ .is_ngc = FALSE,
+  .id = 1442,
+  .ra = 334.004,
+  .dec = 53.9847,
+},
+{ .is_ngc = FALSE,
+  .id = 1443,
+  .ra = 334.765,
+  .dec = -20.9403,
+},
+{ .is_ngc = FALSE,
+  .id = 1444,
+  .ra = 335.6,
+  .dec = 5.13887,
+},
+{ .is_ngc = FALSE,
+  .id = 1445,
+  .ra = 336.376,
+  .dec = -17.2433,
+},
+{ .is_ngc = FALSE,
+  .id = 1446,
+  .ra = 337.27,
+  .dec = -1.18481,
+},
+{ .is_ngc = FALSE,
+  .id = 1447,
+  .ra = 337.499,
+  .dec = -5.11975,
+},
+{ .is_ngc = FALSE,
+  .id = 1449,
+  .ra = 338.779,
+  .dec = -8.76572,
+},
+{ .is_ngc = FALSE,
+  .id = 1450,
+  .ra = 339.492,
+  .dec = 34.5353,
+},
+{ .is_ngc = FALSE,
+  .id = 1451,
+  .ra = 341.531,
+  .dec = -10.37,
+},
+{ .is_ngc = FALSE,
+  .id = 1453,
+  .ra = 341.726,
+  .dec = -13.4495,
+},
+{ .is_ngc = FALSE,
+  .id = 1454,
+  .ra = 340.602,
+  .dec = 80.4423,
+},
+{ .is_ngc = FALSE,
+  .id = 1455,
+  .ra = 343.442,
+  .dec = 1.37178,
+},
+{ .is_ngc = FALSE,
+  .id = 1456,
+  .ra = 343.826,
+  .dec = -12.7323,
+},
+{ .is_ngc = FALSE,
+  .id = 1457,
+  .ra = 343.849,
+  .dec = -5.5625,
+},
+{ .is_ngc = FALSE,
+  .id = 1457,
+  .ra = 343.844,
+  .dec = -5.57128,
+},
+{ .is_ngc = FALSE,
+  .id = 1460,
+  .ra = 344.267,
+  .dec = 4.67704,
+},
+{ .is_ngc = FALSE,
+  .id = 1461,
+  .ra = 344.643,
+  .dec = 15.1719,
+},
+{ .is_ngc = FALSE,
+  .id = 1462,
+  .ra = 344.655,
+  .dec = 8.44131,
+},
+{ .is_ngc = FALSE,
+  .id = 1463,
+  .ra = 344.837,
+  .dec = -10.5308,
+},
+{ .is_ngc = FALSE,
+  .id = 1464,
+  .ra = 345.798,
+  .dec = -8.99083,
+},
+{ .is_ngc = FALSE,
+  .id = 1465,
+  .ra = 345.722,
+  .dec = 16.5822,
+},
+{ .is_ngc = FALSE,
+  .id = 1466,
+  .ra = 345.913,
+  .dec = -2.77569,
+},
+{ .is_ngc = FALSE,
+  .id = 1467,
+  .ra = 346.207,
+  .dec = -3.23072,
+},
+{ .is_ngc = FALSE,
+  .id = 1468,
+  .ra = 346.281,
+  .dec = -3.205,
+},
+{ .is_ngc = FALSE,
+  .id = 1469,
+  .ra = 346.619,
+  .dec = -13.5367,
+},
+{ .is_ngc = FALSE,
+  .id = 1470,
+  .ra = 346.294,
+  .dec = 60.2434,
+},
+{ .is_ngc = FALSE,
+  .id = 1471,
+  .ra = 347.187,
+  .dec = -12.6394,
+},
+{ .is_ngc = FALSE,
+  .id = 1472,
+  .ra = 347.278,
+  .dec = 17.2591,
+},
+{ .is_ngc = FALSE,
+  .id = 1473,
+  .ra = 347.772,
+  .dec = 29.6433,
+},
+{ .is_ngc = FALSE,
+  .id = 1474,
+  .ra = 348.214,
+  .dec = 5.80589,
+},
+{ .is_ngc = FALSE,
+  .id = 1475,
+  .ra = 348.508,
+  .dec = -28.4175,
+},
+{ .is_ngc = FALSE,
+  .id = 1476,
+  .ra = 348.568,
+  .dec = 30.5514,
+},
+{ .is_ngc = FALSE,
+  .id = 1479,
+  .ra = 349.693,
+  .dec = -10.3993,
+},
+{ .is_ngc = FALSE,
+  .id = 1481,
+  .ra = 349.854,
+  .dec = 5.90583,
+},
+{ .is_ngc = FALSE,
+  .id = 1482,
+  .ra = 350.207,
+  .dec = 1.73906,
+},
+{ .is_ngc = FALSE,
+  .id = 1484,
+  .ra = 350.666,
+  .dec = 11.3845,
+},
+{ .is_ngc = FALSE,
+  .id = 1488,
+  .ra = 351.411,
+  .dec = 15.3541,
+},
+{ .is_ngc = FALSE,
+  .id = 1489,
+  .ra = 351.634,
+  .dec = -12.5166,
+},
+{ .is_ngc = FALSE,
+  .id = 1490,
+  .ra = 352.258,
+  .dec = -4.13333,
+},
+{ .is_ngc = FALSE,
+  .id = 1491,
+  .ra = 352.352,
+  .dec = -16.3164,
+},
+{ .is_ngc = FALSE,
+  .id = 1492,
+  .ra = 352.65,
+  .dec = -3.0402,
+},
+{ .is_ngc = FALSE,
+  .id = 1493,
+  .ra = 352.614,
+  .dec = 14.4585,
+},
+{ .is_ngc = FALSE,
+  .id = 1494,
+  .ra = 352.692,
+  .dec = -12.7245,
+},
+{ .is_ngc = FALSE,
+  .id = 1496,
+  .ra = 352.723,
+  .dec = -2.9344,
+},
+{ .is_ngc = FALSE,
+  .id = 1497,
+  .ra = 352.209,
+  .dec = 11.9869,
+},
+{ .is_ngc = FALSE,
+  .id = 1498,
+  .ra = 352.973,
+  .dec = -5.00667,
+},
+{ .is_ngc = FALSE,
+  .id = 1499,
+  .ra = 352.987,
+  .dec = -13.4397,
+},
+{ .is_ngc = FALSE,
+  .id = 1500,
+  .ra = 353.29,
+  .dec = 4.55222,
+},
+{ .is_ngc = FALSE,
+  .id = 1501,
+  .ra = 353.667,
+  .dec = -3.15294,
+},
+{ .is_ngc = FALSE,
+  .id = 1502,
+  .ra = 354.084,
+  .dec = 75.6472,
+},
+{ .is_ngc = FALSE,
+  .id = 1503,
+  .ra = 354.613,
+  .dec = 4.80067,
+},
+{ .is_ngc = FALSE,
+  .id = 1504,
+  .ra = 355.331,
+  .dec = 4.0175,
+},
+{ .is_ngc = FALSE,
+  .id = 1505,
+  .ra = 355.405,
+  .dec = -3.56511,
+},
+{ .is_ngc = FALSE,
+  .id = 1506,
+  .ra = 356.202,
+  .dec = 4.73553,
+},
+{ .is_ngc = FALSE,
+  .id = 1507,
+  .ra = 356.388,
+  .dec = 1.68878,
+},
+{ .is_ngc = FALSE,
+  .id = 1508,
+  .ra = 356.48,
+  .dec = 12.0612,
+},
+{ .is_ngc = FALSE,
+  .id = 1509,
+  .ra = 356.819,
+  .dec = -15.3069,
+},
+{ .is_ngc = FALSE,
+  .id = 1510,
+  .ra = 357.637,
+  .dec = 2.07306,
+},
+{ .is_ngc = FALSE,
+  .id = 1511,
+  .ra = 357.752,
+  .dec = 27.0608,
+},
+{ .is_ngc = FALSE,
+  .id = 1512,
+  .ra = 357.756,
+  .dec = 27.0271,
+},
+{ .is_ngc = FALSE,
+  .id = 1513,
+  .ra = 358.373,
+  .dec = 11.3174,
+},
+{ .is_ngc = FALSE,
+  .id = 1515,
+  .ra = 359.016,
+  .dec = -0.988778,
+},
+{ .is_ngc = FALSE,
+  .id = 1516,
+  .ra = 359.03,
+  .dec = -0.916889,
+},
+{ .is_ngc = FALSE,
+  .id = 1517,
+  .ra = 359.078,
+  .dec = -0.305833,
+},
+{ .is_ngc = FALSE,
+  .id = 1518,
+  .ra = 359.276,
+  .dec = 12.465,
+},
+{ .is_ngc = FALSE,
+  .id = 1519,
+  .ra = 359.285,
+  .dec = 12.4574,
+},
+{ .is_ngc = FALSE,
+  .id = 1520,
+  .ra = 359.477,
+  .dec = -14.0392,
+},
+{ .is_ngc = FALSE,
+  .id = 1521,
+  .ra = 359.748,
+  .dec = -7.14667,
+},
+{ .is_ngc = FALSE,
+  .id = 1522,
+  .ra = 359.765,
+  .dec = 1.71917,
+},
+{ .is_ngc = FALSE,
+  .id = 1525,
+  .ra = 359.816,
+  .dec = 46.8896,
+},
+{ .is_ngc = FALSE,
+  .id = 1526,
+  .ra = 0.38125,
+  .dec = 11.3461,
+},
+{ .is_ngc = FALSE,
+  .id = 1527,
+  .ra = 0.590117,
+  .dec = 4.0906,
+},
+{ .is_ngc = FALSE,
+  .id = 1528,
+  .ra = 1.27225,
+  .dec = -7.09328,
+},
+{ .is_ngc = FALSE,
+  .id = 1529,
+  .ra = 1.30519,
+  .dec = -11.5028,
+},
+{ .is_ngc = FALSE,
+  .id = 1531,
+  .ra = 2.399,
+  .dec = -32.2769,
+},
+{ .is_ngc = FALSE,
+  .id = 1532,
+  .ra = 2.46833,
+  .dec = -64.3714,
+},
+{ .is_ngc = FALSE,
+  .id = 1533,
+  .ra = 2.65,
+  .dec = -7.4025,
+},
+{ .is_ngc = FALSE,
+  .id = 1534,
+  .ra = 3.43937,
+  .dec = 48.1513,
+},
+{ .is_ngc = FALSE,
+  .id = 1535,
+  .ra = 3.48867,
+  .dec = 48.1577,
+},
+{ .is_ngc = FALSE,
+  .id = 1536,
+  .ra = 3.57952,
+  .dec = 48.1432,
+},
+{ .is_ngc = FALSE,
+  .id = 1537,
+  .ra = 3.95625,
+  .dec = -39.2608,
+},
+{ .is_ngc = FALSE,
+  .id = 1538,
+  .ra = 4.50417,
+  .dec = 30.0189,
+},
+{ .is_ngc = FALSE,
+  .id = 1540,
+  .ra = 4.95329,
+  .dec = 23.7726,
+},
+{ .is_ngc = FALSE,
+  .id = 1541,
+  .ra = 5.00827,
+  .dec = 22,
+},
+{ .is_ngc = FALSE,
+  .id = 1542,
+  .ra = 5.17208,
+  .dec = 22.5925,
+},
+{ .is_ngc = FALSE,
+  .id = 1543,
+  .ra = 5.23179,
+  .dec = 21.8655,
+},
+{ .is_ngc = FALSE,
+  .id = 1544,
+  .ra = 5.32329,
+  .dec = 23.0906,
+},
+{ .is_ngc = FALSE,
+  .id = 1545,
+  .ra = 5.33712,
+  .dec = 21.9835,
+},
+{ .is_ngc = FALSE,
+  .id = 1547,
+  .ra = 5.39875,
+  .dec = 22.5064,
+},
+{ .is_ngc = FALSE,
+  .id = 1548,
+  .ra = 5.47985,
+  .dec = 22.0063,
+},
+{ .is_ngc = FALSE,
+  .id = 1549,
+  .ra = 5.70782,
+  .dec = 6.96414,
+},
+{ .is_ngc = FALSE,
+  .id = 1550,
+  .ra = 6.1155,
+  .dec = 38.1852,
+},
+{ .is_ngc = FALSE,
+  .id = 1551,
+  .ra = 6.89775,
+  .dec = 8.87711,
+},
+{ .is_ngc = FALSE,
+  .id = 1552,
+  .ra = 7.43325,
+  .dec = 21.4757,
+},
+{ .is_ngc = FALSE,
+  .id = 1553,
+  .ra = 8.1675,
+  .dec = -25.61,
+},
+{ .is_ngc = FALSE,
+  .id = 1554,
+  .ra = 8.28125,
+  .dec = -32.2589,
+},
+{ .is_ngc = FALSE,
+  .id = 1555,
+  .ra = 8.63667,
+  .dec = -30.0178,
+},
+{ .is_ngc = FALSE,
+  .id = 1556,
+  .ra = 8.76333,
+  .dec = -9.3675,
+},
+{ .is_ngc = FALSE,
+  .id = 1557,
+  .ra = 8.89374,
+  .dec = -2.87638,
+},
+{ .is_ngc = FALSE,
+  .id = 1558,
+  .ra = 8.94708,
+  .dec = -25.3747,
+},
+{ .is_ngc = FALSE,
+  .id = 1559,
+  .ra = 9.2175,
+  .dec = 23.9844,
+},
+{ .is_ngc = FALSE,
+  .id = 1560,
+  .ra = 9.4125,
+  .dec = 2.6675,
+},
+{ .is_ngc = FALSE,
+  .id = 1561,
+  .ra = 9.63583,
+  .dec = -24.3403,
+},
+{ .is_ngc = FALSE,
+  .id = 1562,
+  .ra = 9.64292,
+  .dec = -24.2747,
+},
+{ .is_ngc = FALSE,
+  .id = 1564,
+  .ra = 9.77158,
+  .dec = 6.02069,
+},
+{ .is_ngc = FALSE,
+  .id = 1566,
+  .ra = 9.88878,
+  .dec = 6.81497,
+},
+{ .is_ngc = FALSE,
+  .id = 1568,
+  .ra = 9.98313,
+  .dec = 6.84859,
+},
+{ .is_ngc = FALSE,
+  .id = 1569,
+  .ra = 10.1167,
+  .dec = 6.71947,
+},
+{ .is_ngc = FALSE,
+  .id = 1570,
+  .ra = 10.1426,
+  .dec = 6.75253,
+},
+{ .is_ngc = FALSE,
+  .id = 1571,
+  .ra = 10.1581,
+  .dec = -0.330833,
+},
+{ .is_ngc = FALSE,
+  .id = 1572,
+  .ra = 10.3,
+  .dec = 16.2342,
+},
+{ .is_ngc = FALSE,
+  .id = 1573,
+  .ra = 10.5433,
+  .dec = -23.5917,
+},
+{ .is_ngc = FALSE,
+  .id = 1574,
+  .ra = 10.7658,
+  .dec = -22.2469,
+},
+{ .is_ngc = FALSE,
+  .id = 1575,
+  .ra = 10.8892,
+  .dec = -4.11806,
+},
+{ .is_ngc = FALSE,
+  .id = 1576,
+  .ra = 11.0575,
+  .dec = -25.1094,
+},
+{ .is_ngc = FALSE,
+  .id = 1578,
+  .ra = 11.1075,
+  .dec = -25.0756,
+},
+{ .is_ngc = FALSE,
+  .id = 1579,
+  .ra = 11.3863,
+  .dec = -26.5647,
+},
+{ .is_ngc = FALSE,
+  .id = 1580,
+  .ra = 11.5892,
+  .dec = 29.945,
+},
+{ .is_ngc = FALSE,
+  .id = 1581,
+  .ra = 11.4433,
+  .dec = -25.9189,
+},
+{ .is_ngc = FALSE,
+  .id = 1582,
+  .ra = 11.57,
+  .dec = -24.2792,
+},
+{ .is_ngc = FALSE,
+  .id = 1583,
+  .ra = 11.7927,
+  .dec = 23.0737,
+},
+{ .is_ngc = FALSE,
+  .id = 1584,
+  .ra = 11.8274,
+  .dec = 27.8285,
+},
+{ .is_ngc = FALSE,
+  .id = 1585,
+  .ra = 11.8095,
+  .dec = 23.0533,
+},
+{ .is_ngc = FALSE,
+  .id = 1586,
+  .ra = 11.985,
+  .dec = 22.3733,
+},
+{ .is_ngc = FALSE,
+  .id = 1587,
+  .ra = 12.1792,
+  .dec = -23.5614,
+},
+{ .is_ngc = FALSE,
+  .id = 1588,
+  .ra = 12.7403,
+  .dec = -23.5584,
+},
+{ .is_ngc = FALSE,
+  .id = 1589,
+  .ra = 12.9973,
+  .dec = -34.4223,
+},
+{ .is_ngc = FALSE,
+  .id = 1590,
+  .ra = 13.2042,
+  .dec = 56.6192,
+},
+{ .is_ngc = FALSE,
+  .id = 1592,
+  .ra = 13.3627,
+  .dec = 5.76978,
+},
+{ .is_ngc = FALSE,
+  .id = 1593,
+  .ra = 13.665,
+  .dec = 32.5194,
+},
+{ .is_ngc = FALSE,
+  .id = 1594,
+  .ra = 13.4379,
+  .dec = -47.6475,
+},
+{ .is_ngc = FALSE,
+  .id = 1595,
+  .ra = 13.4449,
+  .dec = -45.1863,
+},
+{ .is_ngc = FALSE,
+  .id = 1596,
+  .ra = 13.6783,
+  .dec = 21.5224,
+},
+{ .is_ngc = FALSE,
+  .id = 1597,
+  .ra = 13.382,
+  .dec = -58.108,
+},
+{ .is_ngc = FALSE,
+  .id = 1598,
+  .ra = 13.6741,
+  .dec = 5.77366,
+},
+{ .is_ngc = FALSE,
+  .id = 1599,
+  .ra = 13.6371,
+  .dec = -23.4953,
+},
+{ .is_ngc = FALSE,
+  .id = 1600,
+  .ra = 13.7671,
+  .dec = -23.5253,
+},
+{ .is_ngc = FALSE,
+  .id = 1601,
+  .ra = 13.8946,
+  .dec = -24.1539,
+},
+{ .is_ngc = FALSE,
+  .id = 1602,
+  .ra = 13.9663,
+  .dec = -9.9853,
+},
+{ .is_ngc = FALSE,
+  .id = 1603,
+  .ra = 14.2479,
+  .dec = -45.4122,
+},
+{ .is_ngc = FALSE,
+  .id = 1604,
+  .ra = 14.5,
+  .dec = -16.2167,
+},
+{ .is_ngc = FALSE,
+  .id = 1605,
+  .ra = 14.405,
+  .dec = -48.9022,
+},
+{ .is_ngc = FALSE,
+  .id = 1606,
+  .ra = 14.5917,
+  .dec = -12.1686,
+},
+{ .is_ngc = FALSE,
+  .id = 1607,
+  .ra = 14.7035,
+  .dec = 0.587306,
+},
+{ .is_ngc = FALSE,
+  .id = 1608,
+  .ra = 14.8508,
+  .dec = -34.3292,
+},
+{ .is_ngc = FALSE,
+  .id = 1609,
+  .ra = 14.9454,
+  .dec = -40.3331,
+},
+{ .is_ngc = FALSE,
+  .id = 1610,
+  .ra = 15.4279,
+  .dec = -15.57,
+},
+{ .is_ngc = FALSE,
+  .id = 1611,
+  .ra = 14.9517,
+  .dec = -72.3328,
+},
+{ .is_ngc = FALSE,
+  .id = 1612,
+  .ra = 14.9992,
+  .dec = -72.37,
+},
+{ .is_ngc = FALSE,
+  .id = 1613,
+  .ra = 16.1977,
+  .dec = 2.11864,
+},
+{ .is_ngc = FALSE,
+  .id = 1614,
+  .ra = 16.2795,
+  .dec = 33.1898,
+},
+{ .is_ngc = FALSE,
+  .id = 1615,
+  .ra = 16.0292,
+  .dec = -51.1325,
+},
+{ .is_ngc = FALSE,
+  .id = 1616,
+  .ra = 16.2342,
+  .dec = -27.4289,
+},
+{ .is_ngc = FALSE,
+  .id = 1617,
+  .ra = 16.0704,
+  .dec = -51.0322,
+},
+{ .is_ngc = FALSE,
+  .id = 1618,
+  .ra = 16.4835,
+  .dec = 32.4124,
+},
+{ .is_ngc = FALSE,
+  .id = 1619,
+  .ra = 16.8438,
+  .dec = 33.0673,
+},
+{ .is_ngc = FALSE,
+  .id = 1620,
+  .ra = 16.8091,
+  .dec = 13.9546,
+},
+{ .is_ngc = FALSE,
+  .id = 1621,
+  .ra = 16.5925,
+  .dec = -46.725,
+},
+{ .is_ngc = FALSE,
+  .id = 1622,
+  .ra = 16.9027,
+  .dec = -17.5386,
+},
+{ .is_ngc = FALSE,
+  .id = 1623,
+  .ra = 16.9458,
+  .dec = -17.5011,
+},
+{ .is_ngc = FALSE,
+  .id = 1624,
+  .ra = 16.3404,
+  .dec = -72.0431,
+},
+{ .is_ngc = FALSE,
+  .id = 1625,
+  .ra = 16.9267,
+  .dec = -46.9075,
+},
+{ .is_ngc = FALSE,
+  .id = 1626,
+  .ra = 16.5567,
+  .dec = -73.2972,
+},
+{ .is_ngc = FALSE,
+  .id = 1627,
+  .ra = 17.0446,
+  .dec = -46.0936,
+},
+{ .is_ngc = FALSE,
+  .id = 1628,
+  .ra = 17.1978,
+  .dec = -28.5823,
+},
+{ .is_ngc = FALSE,
+  .id = 1629,
+  .ra = 17.3262,
+  .dec = 2.56726,
+},
+{ .is_ngc = FALSE,
+  .id = 1630,
+  .ra = 17.0708,
+  .dec = -46.7539,
+},
+{ .is_ngc = FALSE,
+  .id = 1631,
+  .ra = 17.1871,
+  .dec = -46.4753,
+},
+{ .is_ngc = FALSE,
+  .id = 1632,
+  .ra = 17.6807,
+  .dec = 17.6829,
+},
+{ .is_ngc = FALSE,
+  .id = 1633,
+  .ra = 17.4808,
+  .dec = -45.9311,
+},
+{ .is_ngc = FALSE,
+  .id = 1634,
+  .ra = 17.7621,
+  .dec = 17.6624,
+},
+{ .is_ngc = FALSE,
+  .id = 1635,
+  .ra = 17.7645,
+  .dec = 17.6517,
+},
+{ .is_ngc = FALSE,
+  .id = 1637,
+  .ra = 17.7546,
+  .dec = -30.4383,
+},
+{ .is_ngc = FALSE,
+  .id = 1638,
+  .ra = 18.0908,
+  .dec = 33.3641,
+},
+{ .is_ngc = FALSE,
+  .id = 1639,
+  .ra = 17.944,
+  .dec = -0.664453,
+},
+{ .is_ngc = FALSE,
+  .id = 1640,
+  .ra = 17.9638,
+  .dec = -0.630556,
+},
+{ .is_ngc = FALSE,
+  .id = 1641,
+  .ra = 17.4133,
+  .dec = -71.7686,
+},
+{ .is_ngc = FALSE,
+  .id = 1643,
+  .ra = 18.0354,
+  .dec = -0.410525,
+},
+{ .is_ngc = FALSE,
+  .id = 1644,
+  .ra = 17.3,
+  .dec = -73.185,
+},
+{ .is_ngc = FALSE,
+  .id = 1646,
+  .ra = 18.1824,
+  .dec = 15.7071,
+},
+{ .is_ngc = FALSE,
+  .id = 1647,
+  .ra = 18.3105,
+  .dec = 38.8849,
+},
+{ .is_ngc = FALSE,
+  .id = 1648,
+  .ra = 18.4253,
+  .dec = 33.2179,
+},
+{ .is_ngc = FALSE,
+  .id = 1649,
+  .ra = 17.9618,
+  .dec = -55.8569,
+},
+{ .is_ngc = FALSE,
+  .id = 1650,
+  .ra = 18.0808,
+  .dec = -50.4019,
+},
+{ .is_ngc = FALSE,
+  .id = 1651,
+  .ra = 18.365,
+  .dec = 2.06889,
+},
+{ .is_ngc = FALSE,
+  .id = 1652,
+  .ra = 18.7351,
+  .dec = 31.9482,
+},
+{ .is_ngc = FALSE,
+  .id = 1654,
+  .ra = 18.7998,
+  .dec = 30.1949,
+},
+{ .is_ngc = FALSE,
+  .id = 1655,
+  .ra = 17.9753,
+  .dec = -71.3312,
+},
+{ .is_ngc = FALSE,
+  .id = 1659,
+  .ra = 19.0255,
+  .dec = 30.3487,
+},
+{ .is_ngc = FALSE,
+  .id = 1660,
+  .ra = 18.1596,
+  .dec = -71.7614,
+},
+{ .is_ngc = FALSE,
+  .id = 1662,
+  .ra = 18.1387,
+  .dec = -73.4567,
+},
+{ .is_ngc = FALSE,
+  .id = 1664,
+  .ra = 18.5771,
+  .dec = -69.8114,
+},
+{ .is_ngc = FALSE,
+  .id = 1665,
+  .ra = 19.4375,
+  .dec = 34.7011,
+},
+{ .is_ngc = FALSE,
+  .id = 1666,
+  .ra = 19.973,
+  .dec = 32.4673,
+},
+{ .is_ngc = FALSE,
+  .id = 1667,
+  .ra = 19.6761,
+  .dec = -17.0504,
+},
+{ .is_ngc = FALSE,
+  .id = 1668,
+  .ra = 19.7212,
+  .dec = 33.1728,
+},
+{ .is_ngc = FALSE,
+  .id = 1669,
+  .ra = 20.0286,
+  .dec = 33.1844,
+},
+{ .is_ngc = FALSE,
+  .id = 1672,
+  .ra = 20.1595,
+  .dec = 29.6987,
+},
+{ .is_ngc = FALSE,
+  .id = 1673,
+  .ra = 20.1933,
+  .dec = 33.0446,
+},
+{ .is_ngc = FALSE,
+  .id = 1674,
+  .ra = 19.75,
+  .dec = -50.6333,
+},
+{ .is_ngc = FALSE,
+  .id = 1675,
+  .ra = 20.25,
+  .dec = 34.2491,
+},
+{ .is_ngc = FALSE,
+  .id = 1676,
+  .ra = 20.2441,
+  .dec = 30.2595,
+},
+{ .is_ngc = FALSE,
+  .id = 1677,
+  .ra = 20.2797,
+  .dec = 33.2158,
+},
+{ .is_ngc = FALSE,
+  .id = 1678,
+  .ra = 20.2608,
+  .dec = 5.55972,
+},
+{ .is_ngc = FALSE,
+  .id = 1679,
+  .ra = 20.4351,
+  .dec = 33.4933,
+},
+{ .is_ngc = FALSE,
+  .id = 1680,
+  .ra = 20.4636,
+  .dec = 33.2822,
+},
+{ .is_ngc = FALSE,
+  .id = 1681,
+  .ra = 20.3383,
+  .dec = 0.0903889,
+},
+{ .is_ngc = FALSE,
+  .id = 1682,
+  .ra = 20.5554,
+  .dec = 33.2602,
+},
+{ .is_ngc = FALSE,
+  .id = 1683,
+  .ra = 20.6623,
+  .dec = 34.4373,
+},
+{ .is_ngc = FALSE,
+  .id = 1684,
+  .ra = 20.7216,
+  .dec = 33.413,
+},
+{ .is_ngc = FALSE,
+  .id = 1685,
+  .ra = 20.7778,
+  .dec = 33.1903,
+},
+{ .is_ngc = FALSE,
+  .id = 1687,
+  .ra = 20.83,
+  .dec = 33.277,
+},
+{ .is_ngc = FALSE,
+  .id = 1688,
+  .ra = 20.8675,
+  .dec = 33.0827,
+},
+{ .is_ngc = FALSE,
+  .id = 1689,
+  .ra = 20.9496,
+  .dec = 33.0547,
+},
+{ .is_ngc = FALSE,
+  .id = 1690,
+  .ra = 20.9566,
+  .dec = 33.1563,
+},
+{ .is_ngc = FALSE,
+  .id = 1691,
+  .ra = 21.1077,
+  .dec = 33.4066,
+},
+{ .is_ngc = FALSE,
+  .id = 1692,
+  .ra = 21.165,
+  .dec = 33.2355,
+},
+{ .is_ngc = FALSE,
+  .id = 1693,
+  .ra = 21.0092,
+  .dec = -1.65744,
+},
+{ .is_ngc = FALSE,
+  .id = 1694,
+  .ra = 21.1992,
+  .dec = 1.60722,
+},
+{ .is_ngc = FALSE,
+  .id = 1695,
+  .ra = 21.2822,
+  .dec = 8.69967,
+},
+{ .is_ngc = FALSE,
+  .id = 1696,
+  .ra = 21.2184,
+  .dec = -1.61744,
+},
+{ .is_ngc = FALSE,
+  .id = 1697,
+  .ra = 21.2625,
+  .dec = 0.444183,
+},
+{ .is_ngc = FALSE,
+  .id = 1701,
+  .ra = 21.4602,
+  .dec = 18.1842,
+},
+{ .is_ngc = FALSE,
+  .id = 1702,
+  .ra = 21.4845,
+  .dec = 16.6015,
+},
+{ .is_ngc = FALSE,
+  .id = 1704,
+  .ra = 21.7898,
+  .dec = 14.7759,
+},
+{ .is_ngc = FALSE,
+  .id = 1705,
+  .ra = 21.6871,
+  .dec = -3.50167,
+},
+{ .is_ngc = FALSE,
+  .id = 1706,
+  .ra = 21.8794,
+  .dec = 14.8191,
+},
+{ .is_ngc = FALSE,
+  .id = 1707,
+  .ra = 22,
+  .dec = 37.1167,
+},
+{ .is_ngc = FALSE,
+  .id = 1708,
+  .ra = 21.2362,
+  .dec = -71.1833,
+},
+{ .is_ngc = FALSE,
+  .id = 1711,
+  .ra = 22.7302,
+  .dec = 17.1883,
+},
+{ .is_ngc = FALSE,
+  .id = 1713,
+  .ra = 23.1825,
+  .dec = 35.3245,
+},
+{ .is_ngc = FALSE,
+  .id = 1714,
+  .ra = 23.2218,
+  .dec = -13.0251,
+},
+{ .is_ngc = FALSE,
+  .id = 1715,
+  .ra = 23.393,
+  .dec = 12.5853,
+},
+{ .is_ngc = FALSE,
+  .id = 1716,
+  .ra = 23.3618,
+  .dec = -12.3081,
+},
+{ .is_ngc = FALSE,
+  .id = 1717,
+  .ra = 23.125,
+  .dec = -67.5339,
+},
+{ .is_ngc = FALSE,
+  .id = 1718,
+  .ra = 24.6114,
+  .dec = 33.3659,
+},
+{ .is_ngc = FALSE,
+  .id = 1719,
+  .ra = 24.4004,
+  .dec = -33.9244,
+},
+{ .is_ngc = FALSE,
+  .id = 1720,
+  .ra = 25.0887,
+  .dec = -28.9139,
+},
+{ .is_ngc = FALSE,
+  .id = 1721,
+  .ra = 25.3519,
+  .dec = 8.52532,
+},
+{ .is_ngc = FALSE,
+  .id = 1722,
+  .ra = 25.76,
+  .dec = -34.1883,
+},
+{ .is_ngc = FALSE,
+  .id = 1723,
+  .ra = 25.809,
+  .dec = 8.88908,
+},
+{ .is_ngc = FALSE,
+  .id = 1724,
+  .ra = 25.7888,
+  .dec = -34.2422,
+},
+{ .is_ngc = FALSE,
+  .id = 1725,
+  .ra = 26.2995,
+  .dec = 21.7762,
+},
+{ .is_ngc = FALSE,
+  .id = 1726,
+  .ra = 26.3321,
+  .dec = 4.61846,
+},
+{ .is_ngc = FALSE,
+  .id = 1727,
+  .ra = 26.8761,
+  .dec = 27.3319,
+},
+{ .is_ngc = FALSE,
+  .id = 1728,
+  .ra = 26.9358,
+  .dec = -33.6022,
+},
+{ .is_ngc = FALSE,
+  .id = 1729,
+  .ra = 26.9804,
+  .dec = -26.8917,
+},
+{ .is_ngc = FALSE,
+  .id = 1730,
+  .ra = 27.4916,
+  .dec = 22.0114,
+},
+{ .is_ngc = FALSE,
+  .id = 1731,
+  .ra = 27.5521,
+  .dec = 27.1961,
+},
+{ .is_ngc = FALSE,
+  .id = 1732,
+  .ra = 27.6998,
+  .dec = 35.9325,
+},
+{ .is_ngc = FALSE,
+  .id = 1733,
+  .ra = 27.6791,
+  .dec = 33.0822,
+},
+{ .is_ngc = FALSE,
+  .id = 1734,
+  .ra = 27.3208,
+  .dec = -32.7436,
+},
+{ .is_ngc = FALSE,
+  .id = 1735,
+  .ra = 27.7159,
+  .dec = 33.0925,
+},
+{ .is_ngc = FALSE,
+  .id = 1736,
+  .ra = 27.7218,
+  .dec = 18.3024,
+},
+{ .is_ngc = FALSE,
+  .id = 1737,
+  .ra = 27.9267,
+  .dec = 36.2503,
+},
+{ .is_ngc = FALSE,
+  .id = 1738,
+  .ra = 27.7825,
+  .dec = -9.79278,
+},
+{ .is_ngc = FALSE,
+  .id = 1739,
+  .ra = 27.6233,
+  .dec = -34.0567,
+},
+{ .is_ngc = FALSE,
+  .id = 1740,
+  .ra = 27.215,
+  .dec = -30.0864,
+},
+{ .is_ngc = FALSE,
+  .id = 1740,
+  .ra = 27.9034,
+  .dec = -29.9223,
+},
+{ .is_ngc = FALSE,
+  .id = 1741,
+  .ra = 27.9863,
+  .dec = -16.788,
+},
+{ .is_ngc = FALSE,
+  .id = 1742,
+  .ra = 28.3095,
+  .dec = 22.7207,
+},
+{ .is_ngc = FALSE,
+  .id = 1745,
+  .ra = 28.2461,
+  .dec = -16.6693,
+},
+{ .is_ngc = FALSE,
+  .id = 1746,
+  .ra = 28.6012,
+  .dec = 4.80339,
+},
+{ .is_ngc = FALSE,
+  .id = 1747,
+  .ra = 29.3986,
+  .dec = 63.3217,
+},
+{ .is_ngc = FALSE,
+  .id = 1748,
+  .ra = 29.037,
+  .dec = 17.6408,
+},
+{ .is_ngc = FALSE,
+  .id = 1749,
+  .ra = 29.0463,
+  .dec = 6.74479,
+},
+{ .is_ngc = FALSE,
+  .id = 1750,
+  .ra = 29.0773,
+  .dec = 4.07592,
+},
+{ .is_ngc = FALSE,
+  .id = 1753,
+  .ra = 29.3304,
+  .dec = 28.5895,
+},
+{ .is_ngc = FALSE,
+  .id = 1754,
+  .ra = 29.2081,
+  .dec = 4.02544,
+},
+{ .is_ngc = FALSE,
+  .id = 1755,
+  .ra = 29.2907,
+  .dec = 14.5497,
+},
+{ .is_ngc = FALSE,
+  .id = 1756,
+  .ra = 29.2721,
+  .dec = -0.468667,
+},
+{ .is_ngc = FALSE,
+  .id = 1757,
+  .ra = 29.2978,
+  .dec = -0.474056,
+},
+{ .is_ngc = FALSE,
+  .id = 1761,
+  .ra = 29.7179,
+  .dec = 0.568136,
+},
+{ .is_ngc = FALSE,
+  .id = 1762,
+  .ra = 29.4521,
+  .dec = -33.24,
+},
+{ .is_ngc = FALSE,
+  .id = 1763,
+  .ra = 29.7975,
+  .dec = -27.8106,
+},
+{ .is_ngc = FALSE,
+  .id = 1764,
+  .ra = 30.0976,
+  .dec = 24.5804,
+},
+{ .is_ngc = FALSE,
+  .id = 1767,
+  .ra = 29.9975,
+  .dec = -11.0786,
+},
+{ .is_ngc = FALSE,
+  .id = 1768,
+  .ra = 30.208,
+  .dec = -25.0267,
+},
+{ .is_ngc = FALSE,
+  .id = 1769,
+  .ra = 30.2283,
+  .dec = -31.9206,
+},
+{ .is_ngc = FALSE,
+  .id = 1770,
+  .ra = 30.56,
+  .dec = 9.98039,
+},
+{ .is_ngc = FALSE,
+  .id = 1771,
+  .ra = 30.5659,
+  .dec = 9.96836,
+},
+{ .is_ngc = FALSE,
+  .id = 1772,
+  .ra = 30.6785,
+  .dec = 7.74525,
+},
+{ .is_ngc = FALSE,
+  .id = 1774,
+  .ra = 30.996,
+  .dec = 15.3176,
+},
+{ .is_ngc = FALSE,
+  .id = 1775,
+  .ra = 31.3233,
+  .dec = 13.505,
+},
+{ .is_ngc = FALSE,
+  .id = 1776,
+  .ra = 31.3131,
+  .dec = 6.10486,
+},
+{ .is_ngc = FALSE,
+  .id = 1777,
+  .ra = 31.5367,
+  .dec = 15.2097,
+},
+{ .is_ngc = FALSE,
+  .id = 1779,
+  .ra = 31.6083,
+  .dec = 3.70583,
+},
+{ .is_ngc = FALSE,
+  .id = 1780,
+  .ra = 31.7133,
+  .dec = 14.7217,
+},
+{ .is_ngc = FALSE,
+  .id = 1781,
+  .ra = 31.72,
+  .dec = -0.517778,
+},
+{ .is_ngc = FALSE,
+  .id = 1783,
+  .ra = 32.5258,
+  .dec = -32.9406,
+},
+{ .is_ngc = FALSE,
+  .id = 1784,
+  .ra = 34.0539,
+  .dec = 32.6497,
+},
+{ .is_ngc = FALSE,
+  .id = 1785,
+  .ra = 34.0872,
+  .dec = 32.6663,
+},
+{ .is_ngc = FALSE,
+  .id = 1786,
+  .ra = 34.0234,
+  .dec = 5.14544,
+},
+{ .is_ngc = FALSE,
+  .id = 1788,
+  .ra = 33.9571,
+  .dec = -31.2011,
+},
+{ .is_ngc = FALSE,
+  .id = 1789,
+  .ra = 34.4637,
+  .dec = 32.3958,
+},
+{ .is_ngc = FALSE,
+  .id = 1790,
+  .ra = 34.4084,
+  .dec = 12.5089,
+},
+{ .is_ngc = FALSE,
+  .id = 1791,
+  .ra = 34.4224,
+  .dec = 12.4701,
+},
+{ .is_ngc = FALSE,
+  .id = 1792,
+  .ra = 34.7547,
+  .dec = 34.4619,
+},
+{ .is_ngc = FALSE,
+  .id = 1793,
+  .ra = 35.3849,
+  .dec = 32.5445,
+},
+{ .is_ngc = FALSE,
+  .id = 1794,
+  .ra = 35.376,
+  .dec = 15.7613,
+},
+{ .is_ngc = FALSE,
+  .id = 1795,
+  .ra = 36.6333,
+  .dec = 62.0414,
+},
+{ .is_ngc = FALSE,
+  .id = 1796,
+  .ra = 35.6975,
+  .dec = -41.3711,
+},
+{ .is_ngc = FALSE,
+  .id = 1797,
+  .ra = 36.3664,
+  .dec = 20.3952,
+},
+{ .is_ngc = FALSE,
+  .id = 1798,
+  .ra = 36.5648,
+  .dec = 13.4303,
+},
+{ .is_ngc = FALSE,
+  .id = 1799,
+  .ra = 37.1915,
+  .dec = 45.9705,
+},
+{ .is_ngc = FALSE,
+  .id = 1800,
+  .ra = 37.1296,
+  .dec = 31.4103,
+},
+{ .is_ngc = FALSE,
+  .id = 1801,
+  .ra = 37.0533,
+  .dec = 19.5827,
+},
+{ .is_ngc = FALSE,
+  .id = 1802,
+  .ra = 37.3084,
+  .dec = 23.0829,
+},
+{ .is_ngc = FALSE,
+  .id = 1803,
+  .ra = 37.4576,
+  .dec = 23.1086,
+},
+{ .is_ngc = FALSE,
+  .id = 1804,
+  .ra = 37.4764,
+  .dec = 23.0972,
+},
+{ .is_ngc = FALSE,
+  .id = 1805,
+  .ra = 38.1958,
+  .dec = 61.4519,
+},
+{ .is_ngc = FALSE,
+  .id = 1806,
+  .ra = 37.3955,
+  .dec = 22.9433,
+},
+{ .is_ngc = FALSE,
+  .id = 1807,
+  .ra = 37.6291,
+  .dec = 22.9494,
+},
+{ .is_ngc = FALSE,
+  .id = 1809,
+  .ra = 37.9187,
+  .dec = 22.9169,
+},
+{ .is_ngc = FALSE,
+  .id = 1810,
+  .ra = 37.3617,
+  .dec = -43.0758,
+},
+{ .is_ngc = FALSE,
+  .id = 1811,
+  .ra = 37.6583,
+  .dec = -34.2644,
+},
+{ .is_ngc = FALSE,
+  .id = 1812,
+  .ra = 37.3829,
+  .dec = -42.8108,
+},
+{ .is_ngc = FALSE,
+  .id = 1813,
+  .ra = 37.7054,
+  .dec = -34.2211,
+},
+{ .is_ngc = FALSE,
+  .id = 1815,
+  .ra = 38.5837,
+  .dec = 32.4294,
+},
+{ .is_ngc = FALSE,
+  .id = 1816,
+  .ra = 37.9629,
+  .dec = -36.6719,
+},
+{ .is_ngc = FALSE,
+  .id = 1818,
+  .ra = 38.5298,
+  .dec = -11.0408,
+},
+{ .is_ngc = FALSE,
+  .id = 1819,
+  .ra = 38.9244,
+  .dec = 4.05158,
+},
+{ .is_ngc = FALSE,
+  .id = 1820,
+  .ra = 38.9696,
+  .dec = 6.04028,
+},
+{ .is_ngc = FALSE,
+  .id = 1822,
+  .ra = 38.9262,
+  .dec = -8.56292,
+},
+{ .is_ngc = FALSE,
+  .id = 1823,
+  .ra = 39.6543,
+  .dec = 32.0695,
+},
+{ .is_ngc = FALSE,
+  .id = 1825,
+  .ra = 39.7313,
+  .dec = 9.09683,
+},
+{ .is_ngc = FALSE,
+  .id = 1827,
+  .ra = 39.9439,
+  .dec = 1.55792,
+},
+{ .is_ngc = FALSE,
+  .id = 1829,
+  .ra = 40.137,
+  .dec = 14.2981,
+},
+{ .is_ngc = FALSE,
+  .id = 1831,
+  .ra = 41,
+  .dec = 63.1,
+},
+{ .is_ngc = FALSE,
+  .id = 1831,
+  .ra = 40.75,
+  .dec = 62.0667,
+},
+{ .is_ngc = FALSE,
+  .id = 1832,
+  .ra = 40.4906,
+  .dec = 19.0298,
+},
+{ .is_ngc = FALSE,
+  .id = 1833,
+  .ra = 40.4108,
+  .dec = -28.1719,
+},
+{ .is_ngc = FALSE,
+  .id = 1834,
+  .ra = 40.7004,
+  .dec = 3.08358,
+},
+{ .is_ngc = FALSE,
+  .id = 1835,
+  .ra = 40.9558,
+  .dec = 14.8869,
+},
+{ .is_ngc = FALSE,
+  .id = 1836,
+  .ra = 40.8476,
+  .dec = 3.10481,
+},
+{ .is_ngc = FALSE,
+  .id = 1838,
+  .ra = 41.1793,
+  .dec = 19.4547,
+},
+{ .is_ngc = FALSE,
+  .id = 1839,
+  .ra = 41.1793,
+  .dec = 15.2395,
+},
+{ .is_ngc = FALSE,
+  .id = 1841,
+  .ra = 41.4014,
+  .dec = 18.9286,
+},
+{ .is_ngc = FALSE,
+  .id = 1842,
+  .ra = 41.3474,
+  .dec = 11.458,
+},
+{ .is_ngc = FALSE,
+  .id = 1843,
+  .ra = 41.3531,
+  .dec = 2.87961,
+},
+{ .is_ngc = FALSE,
+  .id = 1844,
+  .ra = 41.4554,
+  .dec = 3.23,
+},
+{ .is_ngc = FALSE,
+  .id = 1845,
+  .ra = 40.9863,
+  .dec = -27.9681,
+},
+{ .is_ngc = FALSE,
+  .id = 1847,
+  .ra = 41.974,
+  .dec = 14.5048,
+},
+{ .is_ngc = FALSE,
+  .id = 1848,
+  .ra = 42.825,
+  .dec = 60.4014,
+},
+{ .is_ngc = FALSE,
+  .id = 1849,
+  .ra = 41.9363,
+  .dec = 9.35611,
+},
+{ .is_ngc = FALSE,
+  .id = 1851,
+  .ra = 42.9413,
+  .dec = 58.3145,
+},
+{ .is_ngc = FALSE,
+  .id = 1853,
+  .ra = 42.0175,
+  .dec = -13.9936,
+},
+{ .is_ngc = FALSE,
+  .id = 1854,
+  .ra = 42.336,
+  .dec = 19.3045,
+},
+{ .is_ngc = FALSE,
+  .id = 1855,
+  .ra = 42.2682,
+  .dec = 13.4427,
+},
+{ .is_ngc = FALSE,
+  .id = 1856,
+  .ra = 42.2112,
+  .dec = -0.767472,
+},
+{ .is_ngc = FALSE,
+  .id = 1857,
+  .ra = 42.4124,
+  .dec = 14.6196,
+},
+{ .is_ngc = FALSE,
+  .id = 1858,
+  .ra = 42.285,
+  .dec = -31.2897,
+},
+{ .is_ngc = FALSE,
+  .id = 1859,
+  .ra = 42.2675,
+  .dec = -31.1731,
+},
+{ .is_ngc = FALSE,
+  .id = 1860,
+  .ra = 42.3921,
+  .dec = -31.19,
+},
+{ .is_ngc = FALSE,
+  .id = 1861,
+  .ra = 43.2794,
+  .dec = 25.4901,
+},
+{ .is_ngc = FALSE,
+  .id = 1862,
+  .ra = 42.995,
+  .dec = -33.3394,
+},
+{ .is_ngc = FALSE,
+  .id = 1863,
+  .ra = 43.7121,
+  .dec = 8.78406,
+},
+{ .is_ngc = FALSE,
+  .id = 1864,
+  .ra = 43.4146,
+  .dec = -34.1975,
+},
+{ .is_ngc = FALSE,
+  .id = 1865,
+  .ra = 43.834,
+  .dec = 8.828,
+},
+{ .is_ngc = FALSE,
+  .id = 1866,
+  .ra = 43.7206,
+  .dec = -15.6529,
+},
+{ .is_ngc = FALSE,
+  .id = 1867,
+  .ra = 43.9678,
+  .dec = 9.31173,
+},
+{ .is_ngc = FALSE,
+  .id = 1868,
+  .ra = 44.0243,
+  .dec = 9.3788,
+},
+{ .is_ngc = FALSE,
+  .id = 1870,
+  .ra = 44.4729,
+  .dec = -2.34694,
+},
+{ .is_ngc = FALSE,
+  .id = 1871,
+  .ra = 44.3375,
+  .dec = 60.6675,
+},
+{ .is_ngc = FALSE,
+  .id = 1872,
+  .ra = 46.145,
+  .dec = 42.8094,
+},
+{ .is_ngc = FALSE,
+  .id = 1873,
+  .ra = 45.9703,
+  .dec = 9.61326,
+},
+{ .is_ngc = FALSE,
+  .id = 1874,
+  .ra = 46.5915,
+  .dec = 36.0144,
+},
+{ .is_ngc = FALSE,
+  .id = 1875,
+  .ra = 45.9855,
+  .dec = -39.4408,
+},
+{ .is_ngc = FALSE,
+  .id = 1876,
+  .ra = 46.1338,
+  .dec = -27.4601,
+},
+{ .is_ngc = FALSE,
+  .id = 1877,
+  .ra = 45.79,
+  .dec = -50.5116,
+},
+{ .is_ngc = FALSE,
+  .id = 1878,
+  .ra = 45.9172,
+  .dec = -52.1082,
+},
+{ .is_ngc = FALSE,
+  .id = 1879,
+  .ra = 45.9692,
+  .dec = -52.1179,
+},
+{ .is_ngc = FALSE,
+  .id = 1880,
+  .ra = 46.6189,
+  .dec = -9.73158,
+},
+{ .is_ngc = FALSE,
+  .id = 1882,
+  .ra = 46.9558,
+  .dec = 3.14719,
+},
+{ .is_ngc = FALSE,
+  .id = 1885,
+  .ra = 46.6679,
+  .dec = -32.8644,
+},
+{ .is_ngc = FALSE,
+  .id = 1886,
+  .ra = 47.0133,
+  .dec = -4.40028,
+},
+{ .is_ngc = FALSE,
+  .id = 1890,
+  .ra = 47.4936,
+  .dec = 19.2079,
+},
+{ .is_ngc = FALSE,
+  .id = 1891,
+  .ra = 47.5499,
+  .dec = 19.6066,
+},
+{ .is_ngc = FALSE,
+  .id = 1892,
+  .ra = 47.1133,
+  .dec = -23.0553,
+},
+{ .is_ngc = FALSE,
+  .id = 1893,
+  .ra = 47.5688,
+  .dec = 19.6167,
+},
+{ .is_ngc = FALSE,
+  .id = 1894,
+  .ra = 47.6059,
+  .dec = 19.6067,
+},
+{ .is_ngc = FALSE,
+  .id = 1895,
+  .ra = 47.4017,
+  .dec = -25.2536,
+},
+{ .is_ngc = FALSE,
+  .id = 1896,
+  .ra = 46.9704,
+  .dec = -54.2142,
+},
+{ .is_ngc = FALSE,
+  .id = 1897,
+  .ra = 47.6913,
+  .dec = -10.7956,
+},
+{ .is_ngc = FALSE,
+  .id = 1898,
+  .ra = 47.5833,
+  .dec = -22.405,
+},
+{ .is_ngc = FALSE,
+  .id = 1899,
+  .ra = 48.0546,
+  .dec = -25.3047,
+},
+{ .is_ngc = FALSE,
+  .id = 1900,
+  .ra = 48.9798,
+  .dec = 37.1541,
+},
+{ .is_ngc = FALSE,
+  .id = 1901,
+  .ra = 49.011,
+  .dec = 37.1124,
+},
+{ .is_ngc = FALSE,
+  .id = 1902,
+  .ra = 49.0519,
+  .dec = 37.1775,
+},
+{ .is_ngc = FALSE,
+  .id = 1904,
+  .ra = 48.7537,
+  .dec = -30.7086,
+},
+{ .is_ngc = FALSE,
+  .id = 1905,
+  .ra = 49.7,
+  .dec = 41.3656,
+},
+{ .is_ngc = FALSE,
+  .id = 1905,
+  .ra = 49.7025,
+  .dec = 41.3617,
+},
+{ .is_ngc = FALSE,
+  .id = 1906,
+  .ra = 49.0229,
+  .dec = -34.36,
+},
+{ .is_ngc = FALSE,
+  .id = 1908,
+  .ra = 48.7708,
+  .dec = -54.8167,
+},
+{ .is_ngc = FALSE,
+  .id = 1909,
+  .ra = 49.3333,
+  .dec = -33.6906,
+},
+{ .is_ngc = FALSE,
+  .id = 1910,
+  .ra = 49.4875,
+  .dec = -21.4336,
+},
+{ .is_ngc = FALSE,
+  .id = 1911,
+  .ra = 50.1917,
+  .dec = 35.3178,
+},
+{ .is_ngc = FALSE,
+  .id = 1911,
+  .ra = 50.2049,
+  .dec = 35.3218,
+},
+{ .is_ngc = FALSE,
+  .id = 1912,
+  .ra = 49.18,
+  .dec = -50.6551,
+},
+{ .is_ngc = FALSE,
+  .id = 1913,
+  .ra = 49.8929,
+  .dec = -32.4656,
+},
+{ .is_ngc = FALSE,
+  .id = 1914,
+  .ra = 49.854,
+  .dec = -49.5997,
+},
+{ .is_ngc = FALSE,
+  .id = 1915,
+  .ra = 49.9665,
+  .dec = -50.6911,
+},
+{ .is_ngc = FALSE,
+  .id = 1916,
+  .ra = 50.0683,
+  .dec = -49.0419,
+},
+{ .is_ngc = FALSE,
+  .id = 1917,
+  .ra = 50.5525,
+  .dec = -53.1858,
+},
+{ .is_ngc = FALSE,
+  .id = 1918,
+  .ra = 51.5746,
+  .dec = 4.54088,
+},
+{ .is_ngc = FALSE,
+  .id = 1919,
+  .ra = 51.5087,
+  .dec = -32.8947,
+},
+{ .is_ngc = FALSE,
+  .id = 1920,
+  .ra = 51.1011,
+  .dec = -52.713,
+},
+{ .is_ngc = FALSE,
+  .id = 1921,
+  .ra = 51.175,
+  .dec = -50.6858,
+},
+{ .is_ngc = FALSE,
+  .id = 1921,
+  .ra = 51.1832,
+  .dec = -50.6899,
+},
+{ .is_ngc = FALSE,
+  .id = 1922,
+  .ra = 51.179,
+  .dec = -50.7402,
+},
+{ .is_ngc = FALSE,
+  .id = 1923,
+  .ra = 51.2183,
+  .dec = -50.5556,
+},
+{ .is_ngc = FALSE,
+  .id = 1924,
+  .ra = 51.2815,
+  .dec = -51.7029,
+},
+{ .is_ngc = FALSE,
+  .id = 1925,
+  .ra = 51.3125,
+  .dec = -51.2525,
+},
+{ .is_ngc = FALSE,
+  .id = 1926,
+  .ra = 51.3284,
+  .dec = -51.7009,
+},
+{ .is_ngc = FALSE,
+  .id = 1927,
+  .ra = 51.3,
+  .dec = -51.7192,
+},
+{ .is_ngc = FALSE,
+  .id = 1927,
+  .ra = 51.3325,
+  .dec = -51.7194,
+},
+{ .is_ngc = FALSE,
+  .id = 1928,
+  .ra = 51.8708,
+  .dec = -21.5594,
+},
+{ .is_ngc = FALSE,
+  .id = 1930,
+  .ra = 52.1921,
+  .dec = 4.38306,
+},
+{ .is_ngc = FALSE,
+  .id = 1931,
+  .ra = 52.2396,
+  .dec = 1.74972,
+},
+{ .is_ngc = FALSE,
+  .id = 1932,
+  .ra = 51.4754,
+  .dec = -51.3429,
+},
+{ .is_ngc = FALSE,
+  .id = 1933,
+  .ra = 51.4165,
+  .dec = -52.7848,
+},
+{ .is_ngc = FALSE,
+  .id = 1934,
+  .ra = 52.8079,
+  .dec = 42.7919,
+},
+{ .is_ngc = FALSE,
+  .id = 1935,
+  .ra = 51.5558,
+  .dec = -50.0101,
+},
+{ .is_ngc = FALSE,
+  .id = 1936,
+  .ra = 51.6167,
+  .dec = -51.3233,
+},
+{ .is_ngc = FALSE,
+  .id = 1937,
+  .ra = 51.6967,
+  .dec = -48.7031,
+},
+{ .is_ngc = FALSE,
+  .id = 1938,
+  .ra = 51.7941,
+  .dec = -53.0102,
+},
+{ .is_ngc = FALSE,
+  .id = 1939,
+  .ra = 51.9333,
+  .dec = -51.0675,
+},
+{ .is_ngc = FALSE,
+  .id = 1939,
+  .ra = 51.825,
+  .dec = -51.0497,
+},
+{ .is_ngc = FALSE,
+  .id = 1940,
+  .ra = 51.9253,
+  .dec = -52.1395,
+},
+{ .is_ngc = FALSE,
+  .id = 1941,
+  .ra = 53.0621,
+  .dec = 24.3836,
+},
+{ .is_ngc = FALSE,
+  .id = 1942,
+  .ra = 51.9746,
+  .dec = -52.6758,
+},
+{ .is_ngc = FALSE,
+  .id = 1943,
+  .ra = 52.4333,
+  .dec = -44.1014,
+},
+{ .is_ngc = FALSE,
+  .id = 1944,
+  .ra = 52.4162,
+  .dec = -47.9964,
+},
+{ .is_ngc = FALSE,
+  .id = 1945,
+  .ra = 52.3185,
+  .dec = -52.6273,
+},
+{ .is_ngc = FALSE,
+  .id = 1946,
+  .ra = 52.3424,
+  .dec = -52.6194,
+},
+{ .is_ngc = FALSE,
+  .id = 1947,
+  .ra = 52.6362,
+  .dec = -50.3383,
+},
+{ .is_ngc = FALSE,
+  .id = 1948,
+  .ra = 52.7079,
+  .dec = -47.9642,
+},
+{ .is_ngc = FALSE,
+  .id = 1949,
+  .ra = 52.72,
+  .dec = -47.9794,
+},
+{ .is_ngc = FALSE,
+  .id = 1950,
+  .ra = 52.7682,
+  .dec = -50.4329,
+},
+{ .is_ngc = FALSE,
+  .id = 1951,
+  .ra = 52.7352,
+  .dec = -53.1266,
+},
+{ .is_ngc = FALSE,
+  .id = 1952,
+  .ra = 53.36,
+  .dec = -23.7128,
+},
+{ .is_ngc = FALSE,
+  .id = 1953,
+  .ra = 53.4242,
+  .dec = -21.4783,
+},
+{ .is_ngc = FALSE,
+  .id = 1954,
+  .ra = 52.8808,
+  .dec = -51.9046,
+},
+{ .is_ngc = FALSE,
+  .id = 1955,
+  .ra = 52.8533,
+  .dec = -57.2417,
+},
+{ .is_ngc = FALSE,
+  .id = 1956,
+  .ra = 53.8884,
+  .dec = 5.06672,
+},
+{ .is_ngc = FALSE,
+  .id = 1957,
+  .ra = 53.0554,
+  .dec = -52.4569,
+},
+{ .is_ngc = FALSE,
+  .id = 1958,
+  .ra = 53.1935,
+  .dec = -51.4412,
+},
+{ .is_ngc = FALSE,
+  .id = 1959,
+  .ra = 53.3006,
+  .dec = -50.4129,
+},
+{ .is_ngc = FALSE,
+  .id = 1960,
+  .ra = 53.1383,
+  .dec = -57.2072,
+},
+{ .is_ngc = FALSE,
+  .id = 1961,
+  .ra = 53.3862,
+  .dec = -48.9511,
+},
+{ .is_ngc = FALSE,
+  .id = 1962,
+  .ra = 53.9062,
+  .dec = -21.2919,
+},
+{ .is_ngc = FALSE,
+  .id = 1964,
+  .ra = 53.3722,
+  .dec = -53.1732,
+},
+{ .is_ngc = FALSE,
+  .id = 1965,
+  .ra = 53.2946,
+  .dec = -56.5536,
+},
+{ .is_ngc = FALSE,
+  .id = 1966,
+  .ra = 53.514,
+  .dec = -51.3223,
+},
+{ .is_ngc = FALSE,
+  .id = 1967,
+  .ra = 54.4487,
+  .dec = 3.27028,
+},
+{ .is_ngc = FALSE,
+  .id = 1968,
+  .ra = 53.6577,
+  .dec = -50.6512,
+},
+{ .is_ngc = FALSE,
+  .id = 1969,
+  .ra = 54.0588,
+  .dec = -45.1792,
+},
+{ .is_ngc = FALSE,
+  .id = 1970,
+  .ra = 54.1308,
+  .dec = -43.9572,
+},
+{ .is_ngc = FALSE,
+  .id = 1971,
+  .ra = 53.9898,
+  .dec = -52.6506,
+},
+{ .is_ngc = FALSE,
+  .id = 1972,
+  .ra = 54.0888,
+  .dec = -51.9678,
+},
+{ .is_ngc = FALSE,
+  .id = 1973,
+  .ra = 54.0878,
+  .dec = -51.9942,
+},
+{ .is_ngc = FALSE,
+  .id = 1974,
+  .ra = 54.1756,
+  .dec = -49.5506,
+},
+{ .is_ngc = FALSE,
+  .id = 1975,
+  .ra = 54.7647,
+  .dec = -15.5001,
+},
+{ .is_ngc = FALSE,
+  .id = 1976,
+  .ra = 54.2867,
+  .dec = -47.4381,
+},
+{ .is_ngc = FALSE,
+  .id = 1977,
+  .ra = 55.188,
+  .dec = 17.7406,
+},
+{ .is_ngc = FALSE,
+  .id = 1978,
+  .ra = 54.2732,
+  .dec = -50.1513,
+},
+{ .is_ngc = FALSE,
+  .id = 1979,
+  .ra = 54.1929,
+  .dec = -57.9444,
+},
+{ .is_ngc = FALSE,
+  .id = 1980,
+  .ra = 54.2456,
+  .dec = -57.9737,
+},
+{ .is_ngc = FALSE,
+  .id = 1982,
+  .ra = 54.4267,
+  .dec = -57.7761,
+},
+{ .is_ngc = FALSE,
+  .id = 1984,
+  .ra = 54.9583,
+  .dec = -47.0753,
+},
+{ .is_ngc = FALSE,
+  .id = 1986,
+  .ra = 55.1467,
+  .dec = -45.3556,
+},
+{ .is_ngc = FALSE,
+  .id = 1987,
+  .ra = 55.048,
+  .dec = -55.0578,
+},
+{ .is_ngc = FALSE,
+  .id = 1988,
+  .ra = 55.6875,
+  .dec = -39.8839,
+},
+{ .is_ngc = FALSE,
+  .id = 1989,
+  .ra = 55.4774,
+  .dec = -50.9579,
+},
+{ .is_ngc = FALSE,
+  .id = 1990,
+  .ra = 56.8042,
+  .dec = 24.3333,
+},
+{ .is_ngc = FALSE,
+  .id = 1991,
+  .ra = 56.1944,
+  .dec = -51.5239,
+},
+{ .is_ngc = FALSE,
+  .id = 1992,
+  .ra = 56.2833,
+  .dec = -51.0008,
+},
+{ .is_ngc = FALSE,
+  .id = 1992,
+  .ra = 56.2895,
+  .dec = -50.9989,
+},
+{ .is_ngc = FALSE,
+  .id = 1993,
+  .ra = 56.7704,
+  .dec = -33.7099,
+},
+{ .is_ngc = FALSE,
+  .id = 1994,
+  .ra = 56.4795,
+  .dec = -51.6437,
+},
+{ .is_ngc = FALSE,
+  .id = 1995,
+  .ra = 57.575,
+  .dec = 25.5689,
+},
+{ .is_ngc = FALSE,
+  .id = 1996,
+  .ra = 56.2827,
+  .dec = -57.3248,
+},
+{ .is_ngc = FALSE,
+  .id = 1997,
+  .ra = 56.2154,
+  .dec = -59.1378,
+},
+{ .is_ngc = FALSE,
+  .id = 1998,
+  .ra = 57.8804,
+  .dec = 1.18987,
+},
+{ .is_ngc = FALSE,
+  .id = 1999,
+  .ra = 56.9279,
+  .dec = -56.9522,
+},
+{ .is_ngc = FALSE,
+  .id = 2000,
+  .ra = 57.2818,
+  .dec = -48.8584,
+},
+{ .is_ngc = FALSE,
+  .id = 2001,
+  .ra = 57.7154,
+  .dec = -48.5997,
+},
+{ .is_ngc = FALSE,
+  .id = 2003,
+  .ra = 59.0915,
+  .dec = 33.8751,
+},
+{ .is_ngc = FALSE,
+  .id = 2004,
+  .ra = 57.9396,
+  .dec = -49.4194,
+},
+{ .is_ngc = FALSE,
+  .id = 2005,
+  .ra = 59.4146,
+  .dec = 36.787,
+},
+{ .is_ngc = FALSE,
+  .id = 2006,
+  .ra = 58.6179,
+  .dec = -35.9672,
+},
+{ .is_ngc = FALSE,
+  .id = 2009,
+  .ra = 58.3959,
+  .dec = -48.9894,
+},
+{ .is_ngc = FALSE,
+  .id = 2010,
+  .ra = 57.9924,
+  .dec = -59.9298,
+},
+{ .is_ngc = FALSE,
+  .id = 2011,
+  .ra = 58.1137,
+  .dec = -57.4683,
+},
+{ .is_ngc = FALSE,
+  .id = 2012,
+  .ra = 58.2303,
+  .dec = -58.6501,
+},
+{ .is_ngc = FALSE,
+  .id = 2013,
+  .ra = 59.1833,
+  .dec = -17.1017,
+},
+{ .is_ngc = FALSE,
+  .id = 2014,
+  .ra = 58.84,
+  .dec = -56.7461,
+},
+{ .is_ngc = FALSE,
+  .id = 2015,
+  .ra = 59.5479,
+  .dec = -40.3897,
+},
+{ .is_ngc = FALSE,
+  .id = 2016,
+  .ra = 60.4996,
+  .dec = 20.2397,
+},
+{ .is_ngc = FALSE,
+  .id = 2017,
+  .ra = 59.1634,
+  .dec = -59.3949,
+},
+{ .is_ngc = FALSE,
+  .id = 2018,
+  .ra = 59.4759,
+  .dec = -52.7811,
+},
+{ .is_ngc = FALSE,
+  .id = 2019,
+  .ra = 60.4737,
+  .dec = 5.63889,
+},
+{ .is_ngc = FALSE,
+  .id = 2020,
+  .ra = 59.7211,
+  .dec = -54.0584,
+},
+{ .is_ngc = FALSE,
+  .id = 2021,
+  .ra = 59.8494,
+  .dec = -52.6566,
+},
+{ .is_ngc = FALSE,
+  .id = 2022,
+  .ra = 59.6676,
+  .dec = -59.0446,
+},
+{ .is_ngc = FALSE,
+  .id = 2023,
+  .ra = 59.9194,
+  .dec = -52.681,
+},
+{ .is_ngc = FALSE,
+  .id = 2024,
+  .ra = 60.0163,
+  .dec = -53.3728,
+},
+{ .is_ngc = FALSE,
+  .id = 2025,
+  .ra = 60.0967,
+  .dec = -53.0653,
+},
+{ .is_ngc = FALSE,
+  .id = 2027,
+  .ra = 61.665,
+  .dec = 37.1156,
+},
+{ .is_ngc = FALSE,
+  .id = 2028,
+  .ra = 60.3263,
+  .dec = -52.7078,
+},
+{ .is_ngc = FALSE,
+  .id = 2029,
+  .ra = 60.325,
+  .dec = -52.8011,
+},
+{ .is_ngc = FALSE,
+  .id = 2030,
+  .ra = 61.2333,
+  .dec = -19.2192,
+},
+{ .is_ngc = FALSE,
+  .id = 2031,
+  .ra = 61.5609,
+  .dec = -5.65186,
+},
+{ .is_ngc = FALSE,
+  .id = 2032,
+  .ra = 61.7637,
+  .dec = -55.3244,
+},
+{ .is_ngc = FALSE,
+  .id = 2033,
+  .ra = 61.8104,
+  .dec = -53.6819,
+},
+{ .is_ngc = FALSE,
+  .id = 2034,
+  .ra = 61.6529,
+  .dec = -57.9619,
+},
+{ .is_ngc = FALSE,
+  .id = 2035,
+  .ra = 62.2567,
+  .dec = -45.5175,
+},
+{ .is_ngc = FALSE,
+  .id = 2036,
+  .ra = 62.4804,
+  .dec = -39.6886,
+},
+{ .is_ngc = FALSE,
+  .id = 2037,
+  .ra = 62.0804,
+  .dec = -58.7511,
+},
+{ .is_ngc = FALSE,
+  .id = 2038,
+  .ra = 62.2254,
+  .dec = -55.9939,
+},
+{ .is_ngc = FALSE,
+  .id = 2039,
+  .ra = 62.2596,
+  .dec = -56.0122,
+},
+{ .is_ngc = FALSE,
+  .id = 2040,
+  .ra = 63.2479,
+  .dec = -32.5531,
+},
+{ .is_ngc = FALSE,
+  .id = 2042,
+  .ra = 62.93,
+  .dec = -47.2712,
+},
+{ .is_ngc = FALSE,
+  .id = 2043,
+  .ra = 62.7908,
+  .dec = -53.6867,
+},
+{ .is_ngc = FALSE,
+  .id = 2044,
+  .ra = 62.8088,
+  .dec = -54.5331,
+},
+{ .is_ngc = FALSE,
+  .id = 2046,
+  .ra = 62.8525,
+  .dec = -54.6736,
+},
+{ .is_ngc = FALSE,
+  .id = 2049,
+  .ra = 63.0154,
+  .dec = -58.5569,
+},
+{ .is_ngc = FALSE,
+  .id = 2050,
+  .ra = 63.4838,
+  .dec = -53.4756,
+},
+{ .is_ngc = FALSE,
+  .id = 2051,
+  .ra = 58.0054,
+  .dec = -83.8322,
+},
+{ .is_ngc = FALSE,
+  .id = 2052,
+  .ra = 63.743,
+  .dec = -54.3369,
+},
+{ .is_ngc = FALSE,
+  .id = 2053,
+  .ra = 63.9812,
+  .dec = -49.3585,
+},
+{ .is_ngc = FALSE,
+  .id = 2054,
+  .ra = 61.8596,
+  .dec = -78.2535,
+},
+{ .is_ngc = FALSE,
+  .id = 2055,
+  .ra = 64.45,
+  .dec = -48.9178,
+},
+{ .is_ngc = FALSE,
+  .id = 2055,
+  .ra = 64.4458,
+  .dec = -48.9078,
+},
+{ .is_ngc = FALSE,
+  .id = 2056,
+  .ra = 64.1008,
+  .dec = -60.2064,
+},
+{ .is_ngc = FALSE,
+  .id = 2057,
+  .ra = 65.4838,
+  .dec = 4.04722,
+},
+{ .is_ngc = FALSE,
+  .id = 2058,
+  .ra = 64.4771,
+  .dec = -55.9333,
+},
+{ .is_ngc = FALSE,
+  .id = 2059,
+  .ra = 65.1092,
+  .dec = -31.7247,
+},
+{ .is_ngc = FALSE,
+  .id = 2060,
+  .ra = 64.4737,
+  .dec = -56.6167,
+},
+{ .is_ngc = FALSE,
+  .id = 2061,
+  .ra = 66,
+  .dec = 21.0833,
+},
+{ .is_ngc = FALSE,
+  .id = 2062,
+  .ra = 68.0095,
+  .dec = 71.9202,
+},
+{ .is_ngc = FALSE,
+  .id = 2063,
+  .ra = 65.6677,
+  .dec = -15.6611,
+},
+{ .is_ngc = FALSE,
+  .id = 2064,
+  .ra = 65.8614,
+  .dec = -15.6854,
+},
+{ .is_ngc = FALSE,
+  .id = 2065,
+  .ra = 65.3667,
+  .dec = -55.9331,
+},
+{ .is_ngc = FALSE,
+  .id = 2066,
+  .ra = 65.8846,
+  .dec = -54.7336,
+},
+{ .is_ngc = FALSE,
+  .id = 2067,
+  .ra = 67.7126,
+  .dec = 35.4462,
+},
+{ .is_ngc = FALSE,
+  .id = 2068,
+  .ra = 66.6542,
+  .dec = -42.0928,
+},
+{ .is_ngc = FALSE,
+  .id = 2069,
+  .ra = 66.4833,
+  .dec = -48.2014,
+},
+{ .is_ngc = FALSE,
+  .id = 2069,
+  .ra = 66.481,
+  .dec = -48.2059,
+},
+{ .is_ngc = FALSE,
+  .id = 2070,
+  .ra = 66.1467,
+  .dec = -57.9808,
+},
+{ .is_ngc = FALSE,
+  .id = 2071,
+  .ra = 66.5512,
+  .dec = -53.1508,
+},
+{ .is_ngc = FALSE,
+  .id = 2072,
+  .ra = 66.725,
+  .dec = -48.3683,
+},
+{ .is_ngc = FALSE,
+  .id = 2073,
+  .ra = 66.6396,
+  .dec = -53.1878,
+},
+{ .is_ngc = FALSE,
+  .id = 2074,
+  .ra = 67.8458,
+  .dec = 7.7025,
+},
+{ .is_ngc = FALSE,
+  .id = 2076,
+  .ra = 67.0292,
+  .dec = -48.2186,
+},
+{ .is_ngc = FALSE,
+  .id = 2078,
+  .ra = 67.9676,
+  .dec = -4.69869,
+},
+{ .is_ngc = FALSE,
+  .id = 2079,
+  .ra = 67.1279,
+  .dec = -53.7372,
+},
+{ .is_ngc = FALSE,
+  .id = 2080,
+  .ra = 67.9673,
+  .dec = -5.75669,
+},
+{ .is_ngc = FALSE,
+  .id = 2081,
+  .ra = 67.2538,
+  .dec = -53.6136,
+},
+{ .is_ngc = FALSE,
+  .id = 2082,
+  .ra = 67.2817,
+  .dec = -53.8272,
+},
+{ .is_ngc = FALSE,
+  .id = 2083,
+  .ra = 67.6829,
+  .dec = -53.9806,
+},
+{ .is_ngc = FALSE,
+  .id = 2084,
+  .ra = 68.025,
+  .dec = -48.2842,
+},
+{ .is_ngc = FALSE,
+  .id = 2085,
+  .ra = 67.8508,
+  .dec = -54.4175,
+},
+{ .is_ngc = FALSE,
+  .id = 2086,
+  .ra = 67.8825,
+  .dec = -53.6469,
+},
+{ .is_ngc = FALSE,
+  .id = 2087,
+  .ra = 70,
+  .dec = 25.7422,
+},
+{ .is_ngc = FALSE,
+  .id = 2088,
+  .ra = 70.7792,
+  .dec = 27.2667,
+},
+{ .is_ngc = FALSE,
+  .id = 2088,
+  .ra = 67.7542,
+  .dec = 26.6,
+},
+{ .is_ngc = FALSE,
+  .id = 2089,
+  .ra = 68.2092,
+  .dec = -75.5406,
+},
+{ .is_ngc = FALSE,
+  .id = 2090,
+  .ra = 71.1833,
+  .dec = -33.985,
+},
+{ .is_ngc = FALSE,
+  .id = 2091,
+  .ra = 71.6671,
+  .dec = -4.6725,
+},
+{ .is_ngc = FALSE,
+  .id = 2092,
+  .ra = 71.6983,
+  .dec = -4.94333,
+},
+{ .is_ngc = FALSE,
+  .id = 2093,
+  .ra = 71.8845,
+  .dec = -2.70903,
+},
+{ .is_ngc = FALSE,
+  .id = 2094,
+  .ra = 72.1033,
+  .dec = -5.35275,
+},
+{ .is_ngc = FALSE,
+  .id = 2095,
+  .ra = 72.1906,
+  .dec = -5.12522,
+},
+{ .is_ngc = FALSE,
+  .id = 2096,
+  .ra = 72.4225,
+  .dec = -4.97861,
+},
+{ .is_ngc = FALSE,
+  .id = 2097,
+  .ra = 72.5992,
+  .dec = -5.08069,
+},
+{ .is_ngc = FALSE,
+  .id = 2098,
+  .ra = 72.6846,
+  .dec = -5.41867,
+},
+{ .is_ngc = FALSE,
+  .id = 2099,
+  .ra = 72.7161,
+  .dec = -4.89217,
+},
+{ .is_ngc = FALSE,
+  .id = 2100,
+  .ra = 72.8124,
+  .dec = -4.83056,
+},
+{ .is_ngc = FALSE,
+  .id = 2101,
+  .ra = 72.925,
+  .dec = -6.23056,
+},
+{ .is_ngc = FALSE,
+  .id = 2102,
+  .ra = 72.9798,
+  .dec = -4.95231,
+},
+{ .is_ngc = FALSE,
+  .id = 2103,
+  .ra = 69.9492,
+  .dec = -76.8369,
+},
+{ .is_ngc = FALSE,
+  .id = 2104,
+  .ra = 74.08,
+  .dec = -15.7992,
+},
+{ .is_ngc = FALSE,
+  .id = 2105,
+  .ra = 72.3602,
+  .dec = -69.2007,
+},
+{ .is_ngc = FALSE,
+  .id = 2106,
+  .ra = 74.1412,
+  .dec = -28.5033,
+},
+{ .is_ngc = FALSE,
+  .id = 2109,
+  .ra = 74.7466,
+  .dec = -0.305306,
+},
+{ .is_ngc = FALSE,
+  .id = 2110,
+  .ra = 74.7575,
+  .dec = -0.302639,
+},
+{ .is_ngc = FALSE,
+  .id = 2111,
+  .ra = 72.9683,
+  .dec = -69.3925,
+},
+{ .is_ngc = FALSE,
+  .id = 2112,
+  .ra = 75.1254,
+  .dec = 4.38611,
+},
+{ .is_ngc = FALSE,
+  .id = 2115,
+  .ra = 74.2864,
+  .dec = -66.3902,
+},
+{ .is_ngc = FALSE,
+  .id = 2116,
+  .ra = 74.3168,
+  .dec = -66.3891,
+},
+{ .is_ngc = FALSE,
+  .id = 2117,
+  .ra = 74.3098,
+  .dec = -68.4414,
+},
+{ .is_ngc = FALSE,
+  .id = 2119,
+  .ra = 76.7115,
+  .dec = -20.3459,
+},
+{ .is_ngc = FALSE,
+  .id = 2120,
+  .ra = 79.7929,
+  .dec = 38.1847,
+},
+{ .is_ngc = FALSE,
+  .id = 2121,
+  .ra = 79.9368,
+  .dec = -25.0648,
+},
+{ .is_ngc = FALSE,
+  .id = 2122,
+  .ra = 79.755,
+  .dec = -37.0886,
+},
+{ .is_ngc = FALSE,
+  .id = 2125,
+  .ra = 81.1171,
+  .dec = -27.0158,
+},
+{ .is_ngc = FALSE,
+  .id = 2128,
+  .ra = 80.6842,
+  .dec = -68.0608,
+},
+{ .is_ngc = FALSE,
+  .id = 2132,
+  .ra = 83.1196,
+  .dec = -13.9275,
+},
+{ .is_ngc = FALSE,
+  .id = 2134,
+  .ra = 80.7778,
+  .dec = -75.4467,
+},
+{ .is_ngc = FALSE,
+  .id = 2139,
+  .ra = 83.8154,
+  .dec = -17.9339,
+},
+{ .is_ngc = FALSE,
+  .id = 2140,
+  .ra = 83.343,
+  .dec = -75.3762,
+},
+{ .is_ngc = FALSE,
+  .id = 2141,
+  .ra = 85.5929,
+  .dec = -51.0328,
+},
+{ .is_ngc = FALSE,
+  .id = 2142,
+  .ra = 83.2879,
+  .dec = -78.0194,
+},
+{ .is_ngc = FALSE,
+  .id = 2143,
+  .ra = 86.72,
+  .dec = -18.7267,
+},
+{ .is_ngc = FALSE,
+  .id = 2144,
+  .ra = 87.5579,
+  .dec = 23.8724,
+},
+{ .is_ngc = FALSE,
+  .id = 2145,
+  .ra = 85.0958,
+  .dec = -69.6675,
+},
+{ .is_ngc = FALSE,
+  .id = 2146,
+  .ra = 84.4448,
+  .dec = -74.7821,
+},
+{ .is_ngc = FALSE,
+  .id = 2147,
+  .ra = 85.8685,
+  .dec = -30.4953,
+},
+{ .is_ngc = FALSE,
+  .id = 2148,
+  .ra = 84.8007,
+  .dec = -75.5629,
+},
+{ .is_ngc = FALSE,
+  .id = 2149,
+  .ra = 89.0993,
+  .dec = 46.1048,
+},
+{ .is_ngc = FALSE,
+  .id = 2150,
+  .ra = 87.8279,
+  .dec = -38.3206,
+},
+{ .is_ngc = FALSE,
+  .id = 2151,
+  .ra = 88.1525,
+  .dec = -17.7878,
+},
+{ .is_ngc = FALSE,
+  .id = 2152,
+  .ra = 89.4717,
+  .dec = -23.1808,
+},
+{ .is_ngc = FALSE,
+  .id = 2153,
+  .ra = 90.02,
+  .dec = -33.9189,
+},
+{ .is_ngc = FALSE,
+  .id = 2155,
+  .ra = 90.2042,
+  .dec = -34.0025,
+},
+{ .is_ngc = FALSE,
+  .id = 2155,
+  .ra = 90.1598,
+  .dec = -33.9973,
+},
+{ .is_ngc = FALSE,
+  .id = 2155,
+  .ra = 90.1838,
+  .dec = -33.9736,
+},
+{ .is_ngc = FALSE,
+  .id = 2156,
+  .ra = 91.2217,
+  .dec = 24.1539,
+},
+{ .is_ngc = FALSE,
+  .id = 2157,
+  .ra = 91.2,
+  .dec = 24.0525,
+},
+{ .is_ngc = FALSE,
+  .id = 2158,
+  .ra = 91.3243,
+  .dec = -27.8569,
+},
+{ .is_ngc = FALSE,
+  .id = 2159,
+  .ra = 92.4875,
+  .dec = 20.4192,
+},
+{ .is_ngc = FALSE,
+  .id = 2160,
+  .ra = 88.8725,
+  .dec = -76.9206,
+},
+{ .is_ngc = FALSE,
+  .id = 2161,
+  .ra = 89.3573,
+  .dec = -75.1396,
+},
+{ .is_ngc = FALSE,
+  .id = 2162,
+  .ra = 93.2696,
+  .dec = 17.98,
+},
+{ .is_ngc = FALSE,
+  .id = 2163,
+  .ra = 94.1165,
+  .dec = -21.376,
+},
+{ .is_ngc = FALSE,
+  .id = 2164,
+  .ra = 91.7154,
+  .dec = -75.3656,
+},
+{ .is_ngc = FALSE,
+  .id = 2165,
+  .ra = 95.4278,
+  .dec = -12.9869,
+},
+{ .is_ngc = FALSE,
+  .id = 2166,
+  .ra = 96.7318,
+  .dec = 59.0791,
+},
+{ .is_ngc = FALSE,
+  .id = 2168,
+  .ra = 98.4525,
+  .dec = 44.6867,
+},
+{ .is_ngc = FALSE,
+  .id = 2170,
+  .ra = 98.5279,
+  .dec = 44.6872,
+},
+{ .is_ngc = FALSE,
+  .id = 2173,
+  .ra = 102.697,
+  .dec = 33.4575,
+},
+{ .is_ngc = FALSE,
+  .id = 2174,
+  .ra = 107.273,
+  .dec = 75.3529,
+},
+{ .is_ngc = FALSE,
+  .id = 2175,
+  .ra = 107.166,
+  .dec = 35.2884,
+},
+{ .is_ngc = FALSE,
+  .id = 2176,
+  .ra = 106.882,
+  .dec = 32.4699,
+},
+{ .is_ngc = FALSE,
+  .id = 2177,
+  .ra = 106.106,
+  .dec = -10.4536,
+},
+{ .is_ngc = FALSE,
+  .id = 2178,
+  .ra = 106.907,
+  .dec = 32.5125,
+},
+{ .is_ngc = FALSE,
+  .id = 2179,
+  .ra = 108.885,
+  .dec = 64.926,
+},
+{ .is_ngc = FALSE,
+  .id = 2180,
+  .ra = 107.832,
+  .dec = 26.3709,
+},
+{ .is_ngc = FALSE,
+  .id = 2181,
+  .ra = 108.294,
+  .dec = 18.9958,
+},
+{ .is_ngc = FALSE,
+  .id = 2182,
+  .ra = 108.546,
+  .dec = 18.9446,
+},
+{ .is_ngc = FALSE,
+  .id = 2183,
+  .ra = 109.233,
+  .dec = -20.4017,
+},
+{ .is_ngc = FALSE,
+  .id = 2184,
+  .ra = 112.359,
+  .dec = 72.1294,
+},
+{ .is_ngc = FALSE,
+  .id = 2185,
+  .ra = 110.817,
+  .dec = 32.4947,
+},
+{ .is_ngc = FALSE,
+  .id = 2186,
+  .ra = 110.699,
+  .dec = 21.5294,
+},
+{ .is_ngc = FALSE,
+  .id = 2187,
+  .ra = 110.681,
+  .dec = 21.4828,
+},
+{ .is_ngc = FALSE,
+  .id = 2189,
+  .ra = 111.237,
+  .dec = 8.91722,
+},
+{ .is_ngc = FALSE,
+  .id = 2189,
+  .ra = 111.241,
+  .dec = 8.9075,
+},
+{ .is_ngc = FALSE,
+  .id = 2190,
+  .ra = 112.477,
+  .dec = 37.4516,
+},
+{ .is_ngc = FALSE,
+  .id = 2191,
+  .ra = 112.573,
+  .dec = 24.3276,
+},
+{ .is_ngc = FALSE,
+  .id = 2192,
+  .ra = 113.334,
+  .dec = 31.3617,
+},
+{ .is_ngc = FALSE,
+  .id = 2193,
+  .ra = 113.349,
+  .dec = 31.4832,
+},
+{ .is_ngc = FALSE,
+  .id = 2194,
+  .ra = 113.418,
+  .dec = 31.3343,
+},
+{ .is_ngc = FALSE,
+  .id = 2195,
+  .ra = 112.113,
+  .dec = -51.2511,
+},
+{ .is_ngc = FALSE,
+  .id = 2196,
+  .ra = 113.541,
+  .dec = 31.4058,
+},
+{ .is_ngc = FALSE,
+  .id = 2197,
+  .ra = 113.605,
+  .dec = 31.4222,
+},
+{ .is_ngc = FALSE,
+  .id = 2198,
+  .ra = 113.546,
+  .dec = 23.9658,
+},
+{ .is_ngc = FALSE,
+  .id = 2199,
+  .ra = 113.732,
+  .dec = 31.2761,
+},
+{ .is_ngc = FALSE,
+  .id = 2200,
+  .ra = 112.073,
+  .dec = -62.3519,
+},
+{ .is_ngc = FALSE,
+  .id = 2201,
+  .ra = 114.07,
+  .dec = 33.1225,
+},
+{ .is_ngc = FALSE,
+  .id = 2202,
+  .ra = 111.977,
+  .dec = -67.5744,
+},
+{ .is_ngc = FALSE,
+  .id = 2203,
+  .ra = 115.141,
+  .dec = 34.2297,
+},
+{ .is_ngc = FALSE,
+  .id = 2204,
+  .ra = 115.326,
+  .dec = 34.2318,
+},
+{ .is_ngc = FALSE,
+  .id = 2205,
+  .ra = 116.728,
+  .dec = 26.8731,
+},
+{ .is_ngc = FALSE,
+  .id = 2206,
+  .ra = 116.46,
+  .dec = -34.3302,
+},
+{ .is_ngc = FALSE,
+  .id = 2207,
+  .ra = 117.462,
+  .dec = 33.9619,
+},
+{ .is_ngc = FALSE,
+  .id = 2208,
+  .ra = 118.033,
+  .dec = 27.4839,
+},
+{ .is_ngc = FALSE,
+  .id = 2209,
+  .ra = 119.06,
+  .dec = 60.3041,
+},
+{ .is_ngc = FALSE,
+  .id = 2210,
+  .ra = 119.235,
+  .dec = 56.6822,
+},
+{ .is_ngc = FALSE,
+  .id = 2211,
+  .ra = 119.441,
+  .dec = 32.558,
+},
+{ .is_ngc = FALSE,
+  .id = 2212,
+  .ra = 119.738,
+  .dec = 32.6122,
+},
+{ .is_ngc = FALSE,
+  .id = 2213,
+  .ra = 119.777,
+  .dec = 27.4638,
+},
+{ .is_ngc = FALSE,
+  .id = 2214,
+  .ra = 119.974,
+  .dec = 33.2901,
+},
+{ .is_ngc = FALSE,
+  .id = 2215,
+  .ra = 119.888,
+  .dec = 24.9289,
+},
+{ .is_ngc = FALSE,
+  .id = 2216,
+  .ra = 119.865,
+  .dec = 5.61419,
+},
+{ .is_ngc = FALSE,
+  .id = 2217,
+  .ra = 120.208,
+  .dec = 27.5001,
+},
+{ .is_ngc = FALSE,
+  .id = 2218,
+  .ra = 120.41,
+  .dec = 24.4319,
+},
+{ .is_ngc = FALSE,
+  .id = 2219,
+  .ra = 120.652,
+  .dec = 27.4372,
+},
+{ .is_ngc = FALSE,
+  .id = 2220,
+  .ra = 119.213,
+  .dec = -59.1259,
+},
+{ .is_ngc = FALSE,
+  .id = 2221,
+  .ra = 121.283,
+  .dec = 37.4503,
+},
+{ .is_ngc = FALSE,
+  .id = 2222,
+  .ra = 121.312,
+  .dec = 37.4724,
+},
+{ .is_ngc = FALSE,
+  .id = 2223,
+  .ra = 121.442,
+  .dec = 37.4653,
+},
+{ .is_ngc = FALSE,
+  .id = 2225,
+  .ra = 121.367,
+  .dec = 35.9464,
+},
+{ .is_ngc = FALSE,
+  .id = 2226,
+  .ra = 121.547,
+  .dec = 12.5438,
+},
+{ .is_ngc = FALSE,
+  .id = 2227,
+  .ra = 121.78,
+  .dec = 36.2336,
+},
+{ .is_ngc = FALSE,
+  .id = 2228,
+  .ra = 121.774,
+  .dec = 8.02528,
+},
+{ .is_ngc = FALSE,
+  .id = 2230,
+  .ra = 122.736,
+  .dec = 25.6846,
+},
+{ .is_ngc = FALSE,
+  .id = 2231,
+  .ra = 122.757,
+  .dec = 5.08722,
+},
+{ .is_ngc = FALSE,
+  .id = 2233,
+  .ra = 123.496,
+  .dec = 45.7424,
+},
+{ .is_ngc = FALSE,
+  .id = 2234,
+  .ra = 123.465,
+  .dec = 35.4928,
+},
+{ .is_ngc = FALSE,
+  .id = 2235,
+  .ra = 123.392,
+  .dec = 24.0778,
+},
+{ .is_ngc = FALSE,
+  .id = 2236,
+  .ra = 123.407,
+  .dec = 24.0478,
+},
+{ .is_ngc = FALSE,
+  .id = 2237,
+  .ra = 123.534,
+  .dec = 24.6791,
+},
+{ .is_ngc = FALSE,
+  .id = 2238,
+  .ra = 123.536,
+  .dec = 24.6616,
+},
+{ .is_ngc = FALSE,
+  .id = 2239,
+  .ra = 123.528,
+  .dec = 23.8658,
+},
+{ .is_ngc = FALSE,
+  .id = 2240,
+  .ra = 123.698,
+  .dec = 24.4678,
+},
+{ .is_ngc = FALSE,
+  .id = 2241,
+  .ra = 123.786,
+  .dec = 24.1297,
+},
+{ .is_ngc = FALSE,
+  .id = 2242,
+  .ra = 123.797,
+  .dec = 24.1335,
+},
+{ .is_ngc = FALSE,
+  .id = 2243,
+  .ra = 123.827,
+  .dec = 23.9623,
+},
+{ .is_ngc = FALSE,
+  .id = 2244,
+  .ra = 123.843,
+  .dec = 24.5456,
+},
+{ .is_ngc = FALSE,
+  .id = 2245,
+  .ra = 123.868,
+  .dec = 24.5357,
+},
+{ .is_ngc = FALSE,
+  .id = 2246,
+  .ra = 124.003,
+  .dec = 23.8498,
+},
+{ .is_ngc = FALSE,
+  .id = 2247,
+  .ra = 123.996,
+  .dec = 23.1996,
+},
+{ .is_ngc = FALSE,
+  .id = 2248,
+  .ra = 124.02,
+  .dec = 23.1341,
+},
+{ .is_ngc = FALSE,
+  .id = 2249,
+  .ra = 124.144,
+  .dec = 24.4922,
+},
+{ .is_ngc = FALSE,
+  .id = 2250,
+  .ra = 124.135,
+  .dec = 23.6317,
+},
+{ .is_ngc = FALSE,
+  .id = 2251,
+  .ra = 124.162,
+  .dec = 23.9492,
+},
+{ .is_ngc = FALSE,
+  .id = 2252,
+  .ra = 124.174,
+  .dec = 24.6945,
+},
+{ .is_ngc = FALSE,
+  .id = 2253,
+  .ra = 124.141,
+  .dec = 21.4099,
+},
+{ .is_ngc = FALSE,
+  .id = 2254,
+  .ra = 124.189,
+  .dec = 24.7799,
+},
+{ .is_ngc = FALSE,
+  .id = 2255,
+  .ra = 124.18,
+  .dec = 23.4571,
+},
+{ .is_ngc = FALSE,
+  .id = 2256,
+  .ra = 124.227,
+  .dec = 24.1764,
+},
+{ .is_ngc = FALSE,
+  .id = 2257,
+  .ra = 124.295,
+  .dec = 23.6497,
+},
+{ .is_ngc = FALSE,
+  .id = 2258,
+  .ra = 124.318,
+  .dec = 23.5781,
+},
+{ .is_ngc = FALSE,
+  .id = 2258,
+  .ra = 124.308,
+  .dec = 23.5822,
+},
+{ .is_ngc = FALSE,
+  .id = 2259,
+  .ra = 124.325,
+  .dec = 23.5628,
+},
+{ .is_ngc = FALSE,
+  .id = 2259,
+  .ra = 124.326,
+  .dec = 23.5661,
+},
+{ .is_ngc = FALSE,
+  .id = 2260,
+  .ra = 124.365,
+  .dec = 24.6734,
+},
+{ .is_ngc = FALSE,
+  .id = 2261,
+  .ra = 124.387,
+  .dec = 23.5122,
+},
+{ .is_ngc = FALSE,
+  .id = 2262,
+  .ra = 124.344,
+  .dec = 18.4539,
+},
+{ .is_ngc = FALSE,
+  .id = 2263,
+  .ra = 124.42,
+  .dec = 23.5806,
+},
+{ .is_ngc = FALSE,
+  .id = 2264,
+  .ra = 124.437,
+  .dec = 23.7145,
+},
+{ .is_ngc = FALSE,
+  .id = 2265,
+  .ra = 124.459,
+  .dec = 24.1936,
+},
+{ .is_ngc = FALSE,
+  .id = 2266,
+  .ra = 124.41,
+  .dec = 18.4104,
+},
+{ .is_ngc = FALSE,
+  .id = 2267,
+  .ra = 124.506,
+  .dec = 24.7364,
+},
+{ .is_ngc = FALSE,
+  .id = 2268,
+  .ra = 124.528,
+  .dec = 24.7958,
+},
+{ .is_ngc = FALSE,
+  .id = 2269,
+  .ra = 124.536,
+  .dec = 23.0472,
+},
+{ .is_ngc = FALSE,
+  .id = 2270,
+  .ra = 124.502,
+  .dec = 19.0972,
+},
+{ .is_ngc = FALSE,
+  .id = 2271,
+  .ra = 124.582,
+  .dec = 24.5268,
+},
+{ .is_ngc = FALSE,
+  .id = 2272,
+  .ra = 124.53,
+  .dec = 18.7358,
+},
+{ .is_ngc = FALSE,
+  .id = 2273,
+  .ra = 124.554,
+  .dec = 18.4011,
+},
+{ .is_ngc = FALSE,
+  .id = 2274,
+  .ra = 124.559,
+  .dec = 18.6654,
+},
+{ .is_ngc = FALSE,
+  .id = 2275,
+  .ra = 124.557,
+  .dec = 18.4113,
+},
+{ .is_ngc = FALSE,
+  .id = 2276,
+  .ra = 124.623,
+  .dec = 18.4775,
+},
+{ .is_ngc = FALSE,
+  .id = 2277,
+  .ra = 124.635,
+  .dec = 18.6501,
+},
+{ .is_ngc = FALSE,
+  .id = 2278,
+  .ra = 124.644,
+  .dec = 18.4614,
+},
+{ .is_ngc = FALSE,
+  .id = 2279,
+  .ra = 124.648,
+  .dec = 18.5682,
+},
+{ .is_ngc = FALSE,
+  .id = 2280,
+  .ra = 124.661,
+  .dec = 18.4508,
+},
+{ .is_ngc = FALSE,
+  .id = 2281,
+  .ra = 124.725,
+  .dec = 18.9094,
+},
+{ .is_ngc = FALSE,
+  .id = 2282,
+  .ra = 124.815,
+  .dec = 24.7924,
+},
+{ .is_ngc = FALSE,
+  .id = 2283,
+  .ra = 124.823,
+  .dec = 24.787,
+},
+{ .is_ngc = FALSE,
+  .id = 2284,
+  .ra = 124.745,
+  .dec = 18.6056,
+},
+{ .is_ngc = FALSE,
+  .id = 2285,
+  .ra = 124.762,
+  .dec = 18.9144,
+},
+{ .is_ngc = FALSE,
+  .id = 2286,
+  .ra = 124.767,
+  .dec = 18.9561,
+},
+{ .is_ngc = FALSE,
+  .id = 2287,
+  .ra = 124.782,
+  .dec = 19.4005,
+},
+{ .is_ngc = FALSE,
+  .id = 2288,
+  .ra = 124.843,
+  .dec = 23.747,
+},
+{ .is_ngc = FALSE,
+  .id = 2289,
+  .ra = 124.782,
+  .dec = 18.4986,
+},
+{ .is_ngc = FALSE,
+  .id = 2290,
+  .ra = 124.816,
+  .dec = 19.3128,
+},
+{ .is_ngc = FALSE,
+  .id = 2291,
+  .ra = 124.825,
+  .dec = 18.5085,
+},
+{ .is_ngc = FALSE,
+  .id = 2292,
+  .ra = 124.842,
+  .dec = 19.5636,
+},
+{ .is_ngc = FALSE,
+  .id = 2293,
+  .ra = 124.884,
+  .dec = 21.3939,
+},
+{ .is_ngc = FALSE,
+  .id = 2294,
+  .ra = 124.858,
+  .dec = 18.9852,
+},
+{ .is_ngc = FALSE,
+  .id = 2295,
+  .ra = 124.862,
+  .dec = 18.4146,
+},
+{ .is_ngc = FALSE,
+  .id = 2295,
+  .ra = 124.86,
+  .dec = 18.4131,
+},
+{ .is_ngc = FALSE,
+  .id = 2296,
+  .ra = 124.869,
+  .dec = 18.8978,
+},
+{ .is_ngc = FALSE,
+  .id = 2297,
+  .ra = 125.019,
+  .dec = 18.3813,
+},
+{ .is_ngc = FALSE,
+  .id = 2298,
+  .ra = 125.03,
+  .dec = 18.4027,
+},
+{ .is_ngc = FALSE,
+  .id = 2299,
+  .ra = 125.039,
+  .dec = 19.3372,
+},
+{ .is_ngc = FALSE,
+  .id = 2300,
+  .ra = 125.053,
+  .dec = 18.4192,
+},
+{ .is_ngc = FALSE,
+  .id = 2301,
+  .ra = 125.058,
+  .dec = 18.4336,
+},
+{ .is_ngc = FALSE,
+  .id = 2302,
+  .ra = 125.072,
+  .dec = 19.3568,
+},
+{ .is_ngc = FALSE,
+  .id = 2303,
+  .ra = 125.081,
+  .dec = 19.4188,
+},
+{ .is_ngc = FALSE,
+  .id = 2304,
+  .ra = 125.149,
+  .dec = 19.4389,
+},
+{ .is_ngc = FALSE,
+  .id = 2305,
+  .ra = 125.168,
+  .dec = 19.4519,
+},
+{ .is_ngc = FALSE,
+  .id = 2306,
+  .ra = 125.164,
+  .dec = 19.1104,
+},
+{ .is_ngc = FALSE,
+  .id = 2307,
+  .ra = 125.179,
+  .dec = 19.4404,
+},
+{ .is_ngc = FALSE,
+  .id = 2308,
+  .ra = 125.189,
+  .dec = 19.362,
+},
+{ .is_ngc = FALSE,
+  .id = 2309,
+  .ra = 125.182,
+  .dec = 18.3969,
+},
+{ .is_ngc = FALSE,
+  .id = 2310,
+  .ra = 125.193,
+  .dec = 18.4632,
+},
+{ .is_ngc = FALSE,
+  .id = 2311,
+  .ra = 124.691,
+  .dec = -25.3703,
+},
+{ .is_ngc = FALSE,
+  .id = 2312,
+  .ra = 125.223,
+  .dec = 18.5083,
+},
+{ .is_ngc = FALSE,
+  .id = 2313,
+  .ra = 125.227,
+  .dec = 18.5146,
+},
+{ .is_ngc = FALSE,
+  .id = 2314,
+  .ra = 125.265,
+  .dec = 18.7625,
+},
+{ .is_ngc = FALSE,
+  .id = 2315,
+  .ra = 125.295,
+  .dec = 18.9153,
+},
+{ .is_ngc = FALSE,
+  .id = 2316,
+  .ra = 125.313,
+  .dec = 19.7592,
+},
+{ .is_ngc = FALSE,
+  .id = 2317,
+  .ra = 125.34,
+  .dec = 18.8442,
+},
+{ .is_ngc = FALSE,
+  .id = 2318,
+  .ra = 125.388,
+  .dec = 18.6219,
+},
+{ .is_ngc = FALSE,
+  .id = 2318,
+  .ra = 125.386,
+  .dec = 18.6233,
+},
+{ .is_ngc = FALSE,
+  .id = 2318,
+  .ra = 125.393,
+  .dec = 18.6224,
+},
+{ .is_ngc = FALSE,
+  .id = 2319,
+  .ra = 125.388,
+  .dec = 18.4761,
+},
+{ .is_ngc = FALSE,
+  .id = 2320,
+  .ra = 125.397,
+  .dec = 18.6706,
+},
+{ .is_ngc = FALSE,
+  .id = 2321,
+  .ra = 125.413,
+  .dec = 18.4685,
+},
+{ .is_ngc = FALSE,
+  .id = 2322,
+  .ra = 125.412,
+  .dec = 18.4838,
+},
+{ .is_ngc = FALSE,
+  .id = 2323,
+  .ra = 125.422,
+  .dec = 18.6134,
+},
+{ .is_ngc = FALSE,
+  .id = 2324,
+  .ra = 125.495,
+  .dec = 19.194,
+},
+{ .is_ngc = FALSE,
+  .id = 2325,
+  .ra = 125.536,
+  .dec = 18.9119,
+},
+{ .is_ngc = FALSE,
+  .id = 2326,
+  .ra = 125.55,
+  .dec = 19.0119,
+},
+{ .is_ngc = FALSE,
+  .id = 2327,
+  .ra = 125.367,
+  .dec = 3.16908,
+},
+{ .is_ngc = FALSE,
+  .id = 2328,
+  .ra = 125.573,
+  .dec = 19.6164,
+},
+{ .is_ngc = FALSE,
+  .id = 2329,
+  .ra = 125.581,
+  .dec = 19.4149,
+},
+{ .is_ngc = FALSE,
+  .id = 2330,
+  .ra = 125.597,
+  .dec = 18.8525,
+},
+{ .is_ngc = FALSE,
+  .id = 2331,
+  .ra = 125.647,
+  .dec = 19.6795,
+},
+{ .is_ngc = FALSE,
+  .id = 2332,
+  .ra = 125.665,
+  .dec = 19.9217,
+},
+{ .is_ngc = FALSE,
+  .id = 2333,
+  .ra = 125.754,
+  .dec = 19.0815,
+},
+{ .is_ngc = FALSE,
+  .id = 2334,
+  .ra = 125.75,
+  .dec = 18.6136,
+},
+{ .is_ngc = FALSE,
+  .id = 2335,
+  .ra = 125.781,
+  .dec = 19.41,
+},
+{ .is_ngc = FALSE,
+  .id = 2336,
+  .ra = 125.829,
+  .dec = 18.5378,
+},
+{ .is_ngc = FALSE,
+  .id = 2337,
+  .ra = 125.835,
+  .dec = 18.535,
+},
+{ .is_ngc = FALSE,
+  .id = 2338,
+  .ra = 125.886,
+  .dec = 21.3377,
+},
+{ .is_ngc = FALSE,
+  .id = 2339,
+  .ra = 125.893,
+  .dec = 21.3474,
+},
+{ .is_ngc = FALSE,
+  .id = 2340,
+  .ra = 125.876,
+  .dec = 18.7489,
+},
+{ .is_ngc = FALSE,
+  .id = 2341,
+  .ra = 125.923,
+  .dec = 21.4344,
+},
+{ .is_ngc = FALSE,
+  .id = 2342,
+  .ra = 125.884,
+  .dec = 18.5792,
+},
+{ .is_ngc = FALSE,
+  .id = 2343,
+  .ra = 125.975,
+  .dec = 19.0254,
+},
+{ .is_ngc = FALSE,
+  .id = 2344,
+  .ra = 125.979,
+  .dec = 18.6586,
+},
+{ .is_ngc = FALSE,
+  .id = 2345,
+  .ra = 126.035,
+  .dec = 19.9524,
+},
+{ .is_ngc = FALSE,
+  .id = 2346,
+  .ra = 126.046,
+  .dec = 19.7064,
+},
+{ .is_ngc = FALSE,
+  .id = 2347,
+  .ra = 126.059,
+  .dec = 18.7739,
+},
+{ .is_ngc = FALSE,
+  .id = 2348,
+  .ra = 126.084,
+  .dec = 20.5331,
+},
+{ .is_ngc = FALSE,
+  .id = 2349,
+  .ra = 126.07,
+  .dec = 19.0082,
+},
+{ .is_ngc = FALSE,
+  .id = 2350,
+  .ra = 126.118,
+  .dec = 19.5519,
+},
+{ .is_ngc = FALSE,
+  .id = 2350,
+  .ra = 126.005,
+  .dec = 19.6642,
+},
+{ .is_ngc = FALSE,
+  .id = 2351,
+  .ra = 126.126,
+  .dec = 18.5889,
+},
+{ .is_ngc = FALSE,
+  .id = 2352,
+  .ra = 126.167,
+  .dec = 19.6023,
+},
+{ .is_ngc = FALSE,
+  .id = 2353,
+  .ra = 126.157,
+  .dec = 18.6561,
+},
+{ .is_ngc = FALSE,
+  .id = 2354,
+  .ra = 126.17,
+  .dec = 18.6664,
+},
+{ .is_ngc = FALSE,
+  .id = 2355,
+  .ra = 126.216,
+  .dec = 20.4635,
+},
+{ .is_ngc = FALSE,
+  .id = 2356,
+  .ra = 126.253,
+  .dec = 19.4971,
+},
+{ .is_ngc = FALSE,
+  .id = 2357,
+  .ra = 126.269,
+  .dec = 19.5084,
+},
+{ .is_ngc = FALSE,
+  .id = 2358,
+  .ra = 126.271,
+  .dec = 19.4952,
+},
+{ .is_ngc = FALSE,
+  .id = 2360,
+  .ra = 126.313,
+  .dec = 19.5163,
+},
+{ .is_ngc = FALSE,
+  .id = 2361,
+  .ra = 126.435,
+  .dec = 27.8742,
+},
+{ .is_ngc = FALSE,
+  .id = 2362,
+  .ra = 126.423,
+  .dec = 19.9413,
+},
+{ .is_ngc = FALSE,
+  .id = 2363,
+  .ra = 126.44,
+  .dec = 19.449,
+},
+{ .is_ngc = FALSE,
+  .id = 2364,
+  .ra = 126.465,
+  .dec = 19.7591,
+},
+{ .is_ngc = FALSE,
+  .id = 2365,
+  .ra = 126.575,
+  .dec = 27.8817,
+},
+{ .is_ngc = FALSE,
+  .id = 2367,
+  .ra = 126.042,
+  .dec = -18.7767,
+},
+{ .is_ngc = FALSE,
+  .id = 2368,
+  .ra = 126.505,
+  .dec = 19.883,
+},
+{ .is_ngc = FALSE,
+  .id = 2369,
+  .ra = 126.567,
+  .dec = 20.2322,
+},
+{ .is_ngc = FALSE,
+  .id = 2370,
+  .ra = 126.595,
+  .dec = 19.6384,
+},
+{ .is_ngc = FALSE,
+  .id = 2371,
+  .ra = 126.654,
+  .dec = 19.7981,
+},
+{ .is_ngc = FALSE,
+  .id = 2372,
+  .ra = 126.669,
+  .dec = 19.8828,
+},
+{ .is_ngc = FALSE,
+  .id = 2373,
+  .ra = 126.704,
+  .dec = 20.3644,
+},
+{ .is_ngc = FALSE,
+  .id = 2374,
+  .ra = 127.092,
+  .dec = 30.4433,
+},
+{ .is_ngc = FALSE,
+  .id = 2375,
+  .ra = 126.582,
+  .dec = -13.3032,
+},
+{ .is_ngc = FALSE,
+  .id = 2376,
+  .ra = 127.109,
+  .dec = 30.4073,
+},
+{ .is_ngc = FALSE,
+  .id = 2377,
+  .ra = 126.608,
+  .dec = -13.3065,
+},
+{ .is_ngc = FALSE,
+  .id = 2378,
+  .ra = 127.132,
+  .dec = 30.431,
+},
+{ .is_ngc = FALSE,
+  .id = 2379,
+  .ra = 126.616,
+  .dec = -13.2934,
+},
+{ .is_ngc = FALSE,
+  .id = 2380,
+  .ra = 127.183,
+  .dec = 30.4045,
+},
+{ .is_ngc = FALSE,
+  .id = 2381,
+  .ra = 127.091,
+  .dec = 19.7911,
+},
+{ .is_ngc = FALSE,
+  .id = 2382,
+  .ra = 127.192,
+  .dec = 22.0533,
+},
+{ .is_ngc = FALSE,
+  .id = 2383,
+  .ra = 127.422,
+  .dec = 30.6878,
+},
+{ .is_ngc = FALSE,
+  .id = 2384,
+  .ra = 128.598,
+  .dec = 32.4345,
+},
+{ .is_ngc = FALSE,
+  .id = 2385,
+  .ra = 128.794,
+  .dec = 37.2659,
+},
+{ .is_ngc = FALSE,
+  .id = 2386,
+  .ra = 128.683,
+  .dec = 25.8066,
+},
+{ .is_ngc = FALSE,
+  .id = 2387,
+  .ra = 129.642,
+  .dec = 30.7985,
+},
+{ .is_ngc = FALSE,
+  .id = 2388,
+  .ra = 129.985,
+  .dec = 19.6446,
+},
+{ .is_ngc = FALSE,
+  .id = 2389,
+  .ra = 131.99,
+  .dec = 73.5383,
+},
+{ .is_ngc = FALSE,
+  .id = 2391,
+  .ra = 130.012,
+  .dec = -52.9167,
+},
+{ .is_ngc = FALSE,
+  .id = 2392,
+  .ra = 131.129,
+  .dec = 18.2859,
+},
+{ .is_ngc = FALSE,
+  .id = 2393,
+  .ra = 131.705,
+  .dec = 28.1709,
+},
+{ .is_ngc = FALSE,
+  .id = 2394,
+  .ra = 131.779,
+  .dec = 28.2363,
+},
+{ .is_ngc = FALSE,
+  .id = 2395,
+  .ra = 130.621,
+  .dec = -48.1192,
+},
+{ .is_ngc = FALSE,
+  .id = 2396,
+  .ra = 131.669,
+  .dec = 17.6492,
+},
+{ .is_ngc = FALSE,
+  .id = 2397,
+  .ra = 131.674,
+  .dec = 17.6593,
+},
+{ .is_ngc = FALSE,
+  .id = 2398,
+  .ra = 131.685,
+  .dec = 17.7548,
+},
+{ .is_ngc = FALSE,
+  .id = 2399,
+  .ra = 131.709,
+  .dec = 18.915,
+},
+{ .is_ngc = FALSE,
+  .id = 2399,
+  .ra = 131.957,
+  .dec = 18.9111,
+},
+{ .is_ngc = FALSE,
+  .id = 2400,
+  .ra = 131.996,
+  .dec = 38.0692,
+},
+{ .is_ngc = FALSE,
+  .id = 2401,
+  .ra = 132.043,
+  .dec = 37.7552,
+},
+{ .is_ngc = FALSE,
+  .id = 2402,
+  .ra = 131.996,
+  .dec = 31.7856,
+},
+{ .is_ngc = FALSE,
+  .id = 2403,
+  .ra = 131.539,
+  .dec = -15.3572,
+},
+{ .is_ngc = FALSE,
+  .id = 2404,
+  .ra = 132.043,
+  .dec = 29.4908,
+},
+{ .is_ngc = FALSE,
+  .id = 2405,
+  .ra = 132.178,
+  .dec = 37.2184,
+},
+{ .is_ngc = FALSE,
+  .id = 2406,
+  .ra = 132.019,
+  .dec = 17.7024,
+},
+{ .is_ngc = FALSE,
+  .id = 2407,
+  .ra = 132.038,
+  .dec = 17.6112,
+},
+{ .is_ngc = FALSE,
+  .id = 2408,
+  .ra = 132.084,
+  .dec = 19.0369,
+},
+{ .is_ngc = FALSE,
+  .id = 2409,
+  .ra = 132.103,
+  .dec = 18.3305,
+},
+{ .is_ngc = FALSE,
+  .id = 2412,
+  .ra = 132.349,
+  .dec = 18.5424,
+},
+{ .is_ngc = FALSE,
+  .id = 2413,
+  .ra = 132.381,
+  .dec = 18.7442,
+},
+{ .is_ngc = FALSE,
+  .id = 2414,
+  .ra = 132.459,
+  .dec = 18.7925,
+},
+{ .is_ngc = FALSE,
+  .id = 2415,
+  .ra = 132.508,
+  .dec = 18.6514,
+},
+{ .is_ngc = FALSE,
+  .id = 2416,
+  .ra = 132.634,
+  .dec = 18.5594,
+},
+{ .is_ngc = FALSE,
+  .id = 2417,
+  .ra = 132.784,
+  .dec = 18.6252,
+},
+{ .is_ngc = FALSE,
+  .id = 2418,
+  .ra = 132.854,
+  .dec = 17.9447,
+},
+{ .is_ngc = FALSE,
+  .id = 2419,
+  .ra = 133.039,
+  .dec = 18.1011,
+},
+{ .is_ngc = FALSE,
+  .id = 2420,
+  .ra = 132.891,
+  .dec = 3.1,
+},
+{ .is_ngc = FALSE,
+  .id = 2421,
+  .ra = 133.59,
+  .dec = 32.6807,
+},
+{ .is_ngc = FALSE,
+  .id = 2422,
+  .ra = 133.601,
+  .dec = 20.2244,
+},
+{ .is_ngc = FALSE,
+  .id = 2423,
+  .ra = 133.696,
+  .dec = 20.22,
+},
+{ .is_ngc = FALSE,
+  .id = 2425,
+  .ra = 133.959,
+  .dec = -3.42314,
+},
+{ .is_ngc = FALSE,
+  .id = 2426,
+  .ra = 134.627,
+  .dec = 2.92531,
+},
+{ .is_ngc = FALSE,
+  .id = 2427,
+  .ra = 135.257,
+  .dec = 37.8753,
+},
+{ .is_ngc = FALSE,
+  .id = 2428,
+  .ra = 135.811,
+  .dec = 30.5911,
+},
+{ .is_ngc = FALSE,
+  .id = 2429,
+  .ra = 135.927,
+  .dec = 29.296,
+},
+{ .is_ngc = FALSE,
+  .id = 2430,
+  .ra = 136.095,
+  .dec = 27.9527,
+},
+{ .is_ngc = FALSE,
+  .id = 2431,
+  .ra = 136.145,
+  .dec = 14.5947,
+},
+{ .is_ngc = FALSE,
+  .id = 2432,
+  .ra = 136.165,
+  .dec = 5.51186,
+},
+{ .is_ngc = FALSE,
+  .id = 2433,
+  .ra = 136.369,
+  .dec = 22.6014,
+},
+{ .is_ngc = FALSE,
+  .id = 2434,
+  .ra = 136.817,
+  .dec = 37.215,
+},
+{ .is_ngc = FALSE,
+  .id = 2435,
+  .ra = 136.708,
+  .dec = 26.2752,
+},
+{ .is_ngc = FALSE,
+  .id = 2436,
+  .ra = 136.347,
+  .dec = -19.1661,
+},
+{ .is_ngc = FALSE,
+  .id = 2437,
+  .ra = 136.388,
+  .dec = -19.207,
+},
+{ .is_ngc = FALSE,
+  .id = 2438,
+  .ra = 138.539,
+  .dec = 73.4153,
+},
+{ .is_ngc = FALSE,
+  .id = 2439,
+  .ra = 137.16,
+  .dec = 32.593,
+},
+{ .is_ngc = FALSE,
+  .id = 2440,
+  .ra = 138.959,
+  .dec = 73.459,
+},
+{ .is_ngc = FALSE,
+  .id = 2442,
+  .ra = 137.522,
+  .dec = 22.8381,
+},
+{ .is_ngc = FALSE,
+  .id = 2443,
+  .ra = 137.879,
+  .dec = 28.8265,
+},
+{ .is_ngc = FALSE,
+  .id = 2444,
+  .ra = 138.212,
+  .dec = 30.2122,
+},
+{ .is_ngc = FALSE,
+  .id = 2445,
+  .ra = 138.302,
+  .dec = 31.8077,
+},
+{ .is_ngc = FALSE,
+  .id = 2447,
+  .ra = 138.379,
+  .dec = 28.7408,
+},
+{ .is_ngc = FALSE,
+  .id = 2448,
+  .ra = 136.775,
+  .dec = -69.9422,
+},
+{ .is_ngc = FALSE,
+  .id = 2450,
+  .ra = 139.272,
+  .dec = 25.4293,
+},
+{ .is_ngc = FALSE,
+  .id = 2451,
+  .ra = 138.949,
+  .dec = 23.4962,
+},
+{ .is_ngc = FALSE,
+  .id = 2452,
+  .ra = 138.99,
+  .dec = 23.4721,
+},
+{ .is_ngc = FALSE,
+  .id = 2453,
+  .ra = 138.977,
+  .dec = 20.9287,
+},
+{ .is_ngc = FALSE,
+  .id = 2454,
+  .ra = 139.007,
+  .dec = 17.8209,
+},
+{ .is_ngc = FALSE,
+  .id = 2455,
+  .ra = 139.213,
+  .dec = 20.1092,
+},
+{ .is_ngc = FALSE,
+  .id = 2456,
+  .ra = 139.349,
+  .dec = 34.6758,
+},
+{ .is_ngc = FALSE,
+  .id = 2456,
+  .ra = 139.351,
+  .dec = 34.6747,
+},
+{ .is_ngc = FALSE,
+  .id = 2457,
+  .ra = 139.267,
+  .dec = 20.0932,
+},
+{ .is_ngc = FALSE,
+  .id = 2459,
+  .ra = 139.748,
+  .dec = 34.8622,
+},
+{ .is_ngc = FALSE,
+  .id = 2461,
+  .ra = 139.992,
+  .dec = 37.1908,
+},
+{ .is_ngc = FALSE,
+  .id = 2462,
+  .ra = 140.735,
+  .dec = 22.6853,
+},
+{ .is_ngc = FALSE,
+  .id = 2463,
+  .ra = 140.751,
+  .dec = 22.6184,
+},
+{ .is_ngc = FALSE,
+  .id = 2464,
+  .ra = 140.843,
+  .dec = 22.6294,
+},
+{ .is_ngc = FALSE,
+  .id = 2465,
+  .ra = 140.881,
+  .dec = 24.4462,
+},
+{ .is_ngc = FALSE,
+  .id = 2466,
+  .ra = 140.937,
+  .dec = 24.5175,
+},
+{ .is_ngc = FALSE,
+  .id = 2467,
+  .ra = 141.22,
+  .dec = 38.3517,
+},
+{ .is_ngc = FALSE,
+  .id = 2468,
+  .ra = 141.257,
+  .dec = 38.3445,
+},
+{ .is_ngc = FALSE,
+  .id = 2469,
+  .ra = 140.755,
+  .dec = -32.45,
+},
+{ .is_ngc = FALSE,
+  .id = 2470,
+  .ra = 141.422,
+  .dec = 23.3621,
+},
+{ .is_ngc = FALSE,
+  .id = 2471,
+  .ra = 141.301,
+  .dec = -6.83,
+},
+{ .is_ngc = FALSE,
+  .id = 2472,
+  .ra = 141.64,
+  .dec = 21.3844,
+},
+{ .is_ngc = FALSE,
+  .id = 2473,
+  .ra = 141.848,
+  .dec = 30.4407,
+},
+{ .is_ngc = FALSE,
+  .id = 2474,
+  .ra = 141.798,
+  .dec = 23.034,
+},
+{ .is_ngc = FALSE,
+  .id = 2475,
+  .ra = 141.976,
+  .dec = 29.7919,
+},
+{ .is_ngc = FALSE,
+  .id = 2476,
+  .ra = 141.97,
+  .dec = 29.9863,
+},
+{ .is_ngc = FALSE,
+  .id = 2478,
+  .ra = 142.004,
+  .dec = 30.0371,
+},
+{ .is_ngc = FALSE,
+  .id = 2479,
+  .ra = 142.017,
+  .dec = 29.9908,
+},
+{ .is_ngc = FALSE,
+  .id = 2481,
+  .ra = 141.87,
+  .dec = 3.92917,
+},
+{ .is_ngc = FALSE,
+  .id = 2482,
+  .ra = 141.747,
+  .dec = -12.1091,
+},
+{ .is_ngc = FALSE,
+  .id = 2483,
+  .ra = 142.357,
+  .dec = 30.9944,
+},
+{ .is_ngc = FALSE,
+  .id = 2484,
+  .ra = 141.708,
+  .dec = -42.835,
+},
+{ .is_ngc = FALSE,
+  .id = 2485,
+  .ra = 141.796,
+  .dec = -39.2836,
+},
+{ .is_ngc = FALSE,
+  .id = 2486,
+  .ra = 142.572,
+  .dec = 26.6417,
+},
+{ .is_ngc = FALSE,
+  .id = 2487,
+  .ra = 142.538,
+  .dec = 20.0899,
+},
+{ .is_ngc = FALSE,
+  .id = 2488,
+  .ra = 141.879,
+  .dec = -56.9692,
+},
+{ .is_ngc = FALSE,
+  .id = 2489,
+  .ra = 142.796,
+  .dec = -5.88333,
+},
+{ .is_ngc = FALSE,
+  .id = 2490,
+  .ra = 143.265,
+  .dec = 29.9281,
+},
+{ .is_ngc = FALSE,
+  .id = 2491,
+  .ra = 143.809,
+  .dec = 34.7316,
+},
+{ .is_ngc = FALSE,
+  .id = 2492,
+  .ra = 143.311,
+  .dec = -37.8664,
+},
+{ .is_ngc = FALSE,
+  .id = 2493,
+  .ra = 144.073,
+  .dec = 37.3641,
+},
+{ .is_ngc = FALSE,
+  .id = 2495,
+  .ra = 144.531,
+  .dec = 28.0572,
+},
+{ .is_ngc = FALSE,
+  .id = 2496,
+  .ra = 144.685,
+  .dec = 34.7264,
+},
+{ .is_ngc = FALSE,
+  .id = 2497,
+  .ra = 145.267,
+  .dec = 34.7329,
+},
+{ .is_ngc = FALSE,
+  .id = 2498,
+  .ra = 145.341,
+  .dec = 28.1143,
+},
+{ .is_ngc = FALSE,
+  .id = 2499,
+  .ra = 145.352,
+  .dec = 27.895,
+},
+{ .is_ngc = FALSE,
+  .id = 2500,
+  .ra = 145.597,
+  .dec = 36.3493,
+},
+{ .is_ngc = FALSE,
+  .id = 2501,
+  .ra = 144.696,
+  .dec = -60.0913,
+},
+{ .is_ngc = FALSE,
+  .id = 2502,
+  .ra = 145.778,
+  .dec = 33.0603,
+},
+{ .is_ngc = FALSE,
+  .id = 2503,
+  .ra = 145.79,
+  .dec = 33.1075,
+},
+{ .is_ngc = FALSE,
+  .id = 2504,
+  .ra = 144.637,
+  .dec = -69.0836,
+},
+{ .is_ngc = FALSE,
+  .id = 2505,
+  .ra = 146.279,
+  .dec = 27.2684,
+},
+{ .is_ngc = FALSE,
+  .id = 2506,
+  .ra = 146.303,
+  .dec = 27.2521,
+},
+{ .is_ngc = FALSE,
+  .id = 2507,
+  .ra = 146.142,
+  .dec = -31.7903,
+},
+{ .is_ngc = FALSE,
+  .id = 2508,
+  .ra = 146.78,
+  .dec = 33.5082,
+},
+{ .is_ngc = FALSE,
+  .id = 2509,
+  .ra = 146.733,
+  .dec = 5.70272,
+},
+{ .is_ngc = FALSE,
+  .id = 2510,
+  .ra = 146.93,
+  .dec = -32.8378,
+},
+{ .is_ngc = FALSE,
+  .id = 2515,
+  .ra = 148.664,
+  .dec = 37.4083,
+},
+{ .is_ngc = FALSE,
+  .id = 2516,
+  .ra = 148.702,
+  .dec = 37.6869,
+},
+{ .is_ngc = FALSE,
+  .id = 2517,
+  .ra = 148.213,
+  .dec = -33.7431,
+},
+{ .is_ngc = FALSE,
+  .id = 2518,
+  .ra = 148.994,
+  .dec = 37.1555,
+},
+{ .is_ngc = FALSE,
+  .id = 2519,
+  .ra = 148.995,
+  .dec = 34.0361,
+},
+{ .is_ngc = FALSE,
+  .id = 2520,
+  .ra = 149.084,
+  .dec = 27.2278,
+},
+{ .is_ngc = FALSE,
+  .id = 2521,
+  .ra = 149.316,
+  .dec = 33.9765,
+},
+{ .is_ngc = FALSE,
+  .id = 2522,
+  .ra = 148.787,
+  .dec = -33.1372,
+},
+{ .is_ngc = FALSE,
+  .id = 2523,
+  .ra = 148.79,
+  .dec = -33.2108,
+},
+{ .is_ngc = FALSE,
+  .id = 2524,
+  .ra = 149.387,
+  .dec = 33.6195,
+},
+{ .is_ngc = FALSE,
+  .id = 2525,
+  .ra = 149.604,
+  .dec = 37.1017,
+},
+{ .is_ngc = FALSE,
+  .id = 2526,
+  .ra = 149.262,
+  .dec = -32.2561,
+},
+{ .is_ngc = FALSE,
+  .id = 2527,
+  .ra = 150.027,
+  .dec = 38.1721,
+},
+{ .is_ngc = FALSE,
+  .id = 2530,
+  .ra = 150.38,
+  .dec = 37.2038,
+},
+{ .is_ngc = FALSE,
+  .id = 2531,
+  .ra = 149.982,
+  .dec = -29.6167,
+},
+{ .is_ngc = FALSE,
+  .id = 2532,
+  .ra = 150.022,
+  .dec = -34.2286,
+},
+{ .is_ngc = FALSE,
+  .id = 2533,
+  .ra = 150.131,
+  .dec = -31.2447,
+},
+{ .is_ngc = FALSE,
+  .id = 2534,
+  .ra = 150.375,
+  .dec = -34.1119,
+},
+{ .is_ngc = FALSE,
+  .id = 2535,
+  .ra = 151.133,
+  .dec = 38.0059,
+},
+{ .is_ngc = FALSE,
+  .id = 2536,
+  .ra = 150.875,
+  .dec = -33.9506,
+},
+{ .is_ngc = FALSE,
+  .id = 2537,
+  .ra = 150.967,
+  .dec = -27.5704,
+},
+{ .is_ngc = FALSE,
+  .id = 2538,
+  .ra = 150.985,
+  .dec = -34.8075,
+},
+{ .is_ngc = FALSE,
+  .id = 2539,
+  .ra = 151.069,
+  .dec = -31.3619,
+},
+{ .is_ngc = FALSE,
+  .id = 2540,
+  .ra = 151.695,
+  .dec = 31.4756,
+},
+{ .is_ngc = FALSE,
+  .id = 2541,
+  .ra = 151.45,
+  .dec = -17.4347,
+},
+{ .is_ngc = FALSE,
+  .id = 2542,
+  .ra = 151.961,
+  .dec = 34.3149,
+},
+{ .is_ngc = FALSE,
+  .id = 2544,
+  .ra = 152.123,
+  .dec = 33.3461,
+},
+{ .is_ngc = FALSE,
+  .id = 2545,
+  .ra = 151.65,
+  .dec = -33.8508,
+},
+{ .is_ngc = FALSE,
+  .id = 2545,
+  .ra = 151.646,
+  .dec = -33.8583,
+},
+{ .is_ngc = FALSE,
+  .id = 2546,
+  .ra = 151.773,
+  .dec = -33.2617,
+},
+{ .is_ngc = FALSE,
+  .id = 2547,
+  .ra = 152.519,
+  .dec = 36.5024,
+},
+{ .is_ngc = FALSE,
+  .id = 2548,
+  .ra = 151.98,
+  .dec = -35.23,
+},
+{ .is_ngc = FALSE,
+  .id = 2549,
+  .ra = 152.542,
+  .dec = 36.4649,
+},
+{ .is_ngc = FALSE,
+  .id = 2550,
+  .ra = 152.617,
+  .dec = 27.956,
+},
+{ .is_ngc = FALSE,
+  .id = 2551,
+  .ra = 152.668,
+  .dec = 24.4142,
+},
+{ .is_ngc = FALSE,
+  .id = 2552,
+  .ra = 152.692,
+  .dec = -34.8447,
+},
+{ .is_ngc = FALSE,
+  .id = 2553,
+  .ra = 152.338,
+  .dec = -62.6128,
+},
+{ .is_ngc = FALSE,
+  .id = 2554,
+  .ra = 152.212,
+  .dec = -67.0186,
+},
+{ .is_ngc = FALSE,
+  .id = 2556,
+  .ra = 153.157,
+  .dec = -34.7289,
+},
+{ .is_ngc = FALSE,
+  .id = 2557,
+  .ra = 154.024,
+  .dec = 38.1088,
+},
+{ .is_ngc = FALSE,
+  .id = 2558,
+  .ra = 153.685,
+  .dec = -34.3381,
+},
+{ .is_ngc = FALSE,
+  .id = 2559,
+  .ra = 153.689,
+  .dec = -34.0594,
+},
+{ .is_ngc = FALSE,
+  .id = 2560,
+  .ra = 154.079,
+  .dec = -33.5642,
+},
+{ .is_ngc = FALSE,
+  .id = 2561,
+  .ra = 154.786,
+  .dec = 34.6744,
+},
+{ .is_ngc = FALSE,
+  .id = 2562,
+  .ra = 154.726,
+  .dec = 16.155,
+},
+{ .is_ngc = FALSE,
+  .id = 2563,
+  .ra = 154.715,
+  .dec = -32.5972,
+},
+{ .is_ngc = FALSE,
+  .id = 2564,
+  .ra = 155.365,
+  .dec = 36.452,
+},
+{ .is_ngc = FALSE,
+  .id = 2565,
+  .ra = 155.325,
+  .dec = 27.9297,
+},
+{ .is_ngc = FALSE,
+  .id = 2566,
+  .ra = 155.581,
+  .dec = 36.583,
+},
+{ .is_ngc = FALSE,
+  .id = 2567,
+  .ra = 155.491,
+  .dec = 24.6551,
+},
+{ .is_ngc = FALSE,
+  .id = 2568,
+  .ra = 155.625,
+  .dec = 36.5994,
+},
+{ .is_ngc = FALSE,
+  .id = 2569,
+  .ra = 155.723,
+  .dec = 24.6063,
+},
+{ .is_ngc = FALSE,
+  .id = 2570,
+  .ra = 155.392,
+  .dec = -33.6222,
+},
+{ .is_ngc = FALSE,
+  .id = 2572,
+  .ra = 156.28,
+  .dec = 28.0943,
+},
+{ .is_ngc = FALSE,
+  .id = 2573,
+  .ra = 155.876,
+  .dec = -35.4558,
+},
+{ .is_ngc = FALSE,
+  .id = 2574,
+  .ra = 157.092,
+  .dec = 68.4135,
+},
+{ .is_ngc = FALSE,
+  .id = 2575,
+  .ra = 156.351,
+  .dec = -32.6361,
+},
+{ .is_ngc = FALSE,
+  .id = 2576,
+  .ra = 156.496,
+  .dec = -32.9025,
+},
+{ .is_ngc = FALSE,
+  .id = 2577,
+  .ra = 157.006,
+  .dec = 32.7634,
+},
+{ .is_ngc = FALSE,
+  .id = 2578,
+  .ra = 156.845,
+  .dec = -33.8778,
+},
+{ .is_ngc = FALSE,
+  .id = 2580,
+  .ra = 157.076,
+  .dec = -31.5186,
+},
+{ .is_ngc = FALSE,
+  .id = 2581,
+  .ra = 156.862,
+  .dec = -57.6175,
+},
+{ .is_ngc = FALSE,
+  .id = 2582,
+  .ra = 157.295,
+  .dec = -30.3439,
+},
+{ .is_ngc = FALSE,
+  .id = 2583,
+  .ra = 157.794,
+  .dec = 26.0544,
+},
+{ .is_ngc = FALSE,
+  .id = 2584,
+  .ra = 157.465,
+  .dec = -34.9117,
+},
+{ .is_ngc = FALSE,
+  .id = 2586,
+  .ra = 157.76,
+  .dec = -28.7181,
+},
+{ .is_ngc = FALSE,
+  .id = 2587,
+  .ra = 157.749,
+  .dec = -34.5633,
+},
+{ .is_ngc = FALSE,
+  .id = 2588,
+  .ra = 157.958,
+  .dec = -30.385,
+},
+{ .is_ngc = FALSE,
+  .id = 2589,
+  .ra = 158.086,
+  .dec = -24.0375,
+},
+{ .is_ngc = FALSE,
+  .id = 2590,
+  .ra = 159.069,
+  .dec = 26.9623,
+},
+{ .is_ngc = FALSE,
+  .id = 2591,
+  .ra = 159.162,
+  .dec = 35.0526,
+},
+{ .is_ngc = FALSE,
+  .id = 2593,
+  .ra = 159.066,
+  .dec = -12.7254,
+},
+{ .is_ngc = FALSE,
+  .id = 2594,
+  .ra = 159.016,
+  .dec = -24.3225,
+},
+{ .is_ngc = FALSE,
+  .id = 2595,
+  .ra = 159.388,
+  .dec = -11.1167,
+},
+{ .is_ngc = FALSE,
+  .id = 2596,
+  .ra = 158.554,
+  .dec = -73.2403,
+},
+{ .is_ngc = FALSE,
+  .id = 2597,
+  .ra = 159.447,
+  .dec = -27.0811,
+},
+{ .is_ngc = FALSE,
+  .id = 2598,
+  .ra = 159.926,
+  .dec = 26.7272,
+},
+{ .is_ngc = FALSE,
+  .id = 2599,
+  .ra = 159.363,
+  .dec = -58.7334,
+},
+{ .is_ngc = FALSE,
+  .id = 2600,
+  .ra = 161.661,
+  .dec = 72.3202,
+},
+{ .is_ngc = FALSE,
+  .id = 2601,
+  .ra = 161.805,
+  .dec = 72.323,
+},
+{ .is_ngc = FALSE,
+  .id = 2602,
+  .ra = 160.733,
+  .dec = -64.3853,
+},
+{ .is_ngc = FALSE,
+  .id = 2603,
+  .ra = 162.104,
+  .dec = 32.9183,
+},
+{ .is_ngc = FALSE,
+  .id = 2604,
+  .ra = 162.355,
+  .dec = 32.7728,
+},
+{ .is_ngc = FALSE,
+  .id = 2605,
+  .ra = 162.448,
+  .dec = 32.9731,
+},
+{ .is_ngc = FALSE,
+  .id = 2606,
+  .ra = 162.573,
+  .dec = 37.9561,
+},
+{ .is_ngc = FALSE,
+  .id = 2607,
+  .ra = 162.579,
+  .dec = 37.9937,
+},
+{ .is_ngc = FALSE,
+  .id = 2608,
+  .ra = 162.564,
+  .dec = 32.7682,
+},
+{ .is_ngc = FALSE,
+  .id = 2610,
+  .ra = 163.034,
+  .dec = 33.0831,
+},
+{ .is_ngc = FALSE,
+  .id = 2611,
+  .ra = 163.162,
+  .dec = 10.1364,
+},
+{ .is_ngc = FALSE,
+  .id = 2612,
+  .ra = 163.404,
+  .dec = 32.7681,
+},
+{ .is_ngc = FALSE,
+  .id = 2614,
+  .ra = 165.391,
+  .dec = 38.8037,
+},
+{ .is_ngc = FALSE,
+  .id = 2615,
+  .ra = 165.509,
+  .dec = 37.945,
+},
+{ .is_ngc = FALSE,
+  .id = 2616,
+  .ra = 165.524,
+  .dec = 38.7869,
+},
+{ .is_ngc = FALSE,
+  .id = 2617,
+  .ra = 165.532,
+  .dec = 38.6641,
+},
+{ .is_ngc = FALSE,
+  .id = 2618,
+  .ra = 165.495,
+  .dec = 27.7894,
+},
+{ .is_ngc = FALSE,
+  .id = 2619,
+  .ra = 165.563,
+  .dec = 37.9658,
+},
+{ .is_ngc = FALSE,
+  .id = 2620,
+  .ra = 165.6,
+  .dec = 38.5052,
+},
+{ .is_ngc = FALSE,
+  .id = 2621,
+  .ra = 165.083,
+  .dec = -65.249,
+},
+{ .is_ngc = FALSE,
+  .id = 2623,
+  .ra = 165.962,
+  .dec = -20.0932,
+},
+{ .is_ngc = FALSE,
+  .id = 2626,
+  .ra = 167.266,
+  .dec = 26.9039,
+},
+{ .is_ngc = FALSE,
+  .id = 2627,
+  .ra = 167.473,
+  .dec = -23.7267,
+},
+{ .is_ngc = FALSE,
+  .id = 2628,
+  .ra = 167.908,
+  .dec = 12.1217,
+},
+{ .is_ngc = FALSE,
+  .id = 2629,
+  .ra = 168.154,
+  .dec = 12.1043,
+},
+{ .is_ngc = FALSE,
+  .id = 2630,
+  .ra = 168.18,
+  .dec = 12.3192,
+},
+{ .is_ngc = FALSE,
+  .id = 2631,
+  .ra = 167.465,
+  .dec = -76.613,
+},
+{ .is_ngc = FALSE,
+  .id = 2632,
+  .ra = 168.275,
+  .dec = 11.6732,
+},
+{ .is_ngc = FALSE,
+  .id = 2633,
+  .ra = 168.292,
+  .dec = 11.6009,
+},
+{ .is_ngc = FALSE,
+  .id = 2634,
+  .ra = 168.368,
+  .dec = 10.4854,
+},
+{ .is_ngc = FALSE,
+  .id = 2635,
+  .ra = 168.374,
+  .dec = 11.4636,
+},
+{ .is_ngc = FALSE,
+  .id = 2636,
+  .ra = 168.392,
+  .dec = 11.4561,
+},
+{ .is_ngc = FALSE,
+  .id = 2637,
+  .ra = 168.457,
+  .dec = 9.58628,
+},
+{ .is_ngc = FALSE,
+  .id = 2638,
+  .ra = 168.466,
+  .dec = 10.5629,
+},
+{ .is_ngc = FALSE,
+  .id = 2639,
+  .ra = 168.481,
+  .dec = 9.64273,
+},
+{ .is_ngc = FALSE,
+  .id = 2640,
+  .ra = 168.523,
+  .dec = 10.997,
+},
+{ .is_ngc = FALSE,
+  .id = 2641,
+  .ra = 168.544,
+  .dec = 9.39897,
+},
+{ .is_ngc = FALSE,
+  .id = 2642,
+  .ra = 168.566,
+  .dec = 12.2663,
+},
+{ .is_ngc = FALSE,
+  .id = 2643,
+  .ra = 168.612,
+  .dec = 10.1262,
+},
+{ .is_ngc = FALSE,
+  .id = 2644,
+  .ra = 168.624,
+  .dec = 10.7678,
+},
+{ .is_ngc = FALSE,
+  .id = 2645,
+  .ra = 168.628,
+  .dec = 11.8863,
+},
+{ .is_ngc = FALSE,
+  .id = 2646,
+  .ra = 168.657,
+  .dec = 12.5283,
+},
+{ .is_ngc = FALSE,
+  .id = 2647,
+  .ra = 168.661,
+  .dec = 12.1417,
+},
+{ .is_ngc = FALSE,
+  .id = 2648,
+  .ra = 168.69,
+  .dec = 10.2247,
+},
+{ .is_ngc = FALSE,
+  .id = 2649,
+  .ra = 168.693,
+  .dec = 11.1273,
+},
+{ .is_ngc = FALSE,
+  .id = 2650,
+  .ra = 168.719,
+  .dec = 13.8521,
+},
+{ .is_ngc = FALSE,
+  .id = 2651,
+  .ra = 168.718,
+  .dec = 12.2393,
+},
+{ .is_ngc = FALSE,
+  .id = 2652,
+  .ra = 168.718,
+  .dec = 12.448,
+},
+{ .is_ngc = FALSE,
+  .id = 2653,
+  .ra = 168.724,
+  .dec = 10.548,
+},
+{ .is_ngc = FALSE,
+  .id = 2654,
+  .ra = 168.762,
+  .dec = 12.4997,
+},
+{ .is_ngc = FALSE,
+  .id = 2655,
+  .ra = 168.771,
+  .dec = 12.1642,
+},
+{ .is_ngc = FALSE,
+  .id = 2656,
+  .ra = 168.772,
+  .dec = 12.3789,
+},
+{ .is_ngc = FALSE,
+  .id = 2657,
+  .ra = 168.786,
+  .dec = 13.6943,
+},
+{ .is_ngc = FALSE,
+  .id = 2658,
+  .ra = 168.787,
+  .dec = 12.9962,
+},
+{ .is_ngc = FALSE,
+  .id = 2659,
+  .ra = 168.866,
+  .dec = 12.8871,
+},
+{ .is_ngc = FALSE,
+  .id = 2660,
+  .ra = 168.868,
+  .dec = 12.4369,
+},
+{ .is_ngc = FALSE,
+  .id = 2661,
+  .ra = 168.872,
+  .dec = 13.6083,
+},
+{ .is_ngc = FALSE,
+  .id = 2662,
+  .ra = 168.878,
+  .dec = 12.7708,
+},
+{ .is_ngc = FALSE,
+  .id = 2663,
+  .ra = 168.885,
+  .dec = 12.604,
+},
+{ .is_ngc = FALSE,
+  .id = 2664,
+  .ra = 168.912,
+  .dec = 12.5622,
+},
+{ .is_ngc = FALSE,
+  .id = 2665,
+  .ra = 168.92,
+  .dec = 11.7237,
+},
+{ .is_ngc = FALSE,
+  .id = 2666,
+  .ra = 168.933,
+  .dec = 13.7819,
+},
+{ .is_ngc = FALSE,
+  .id = 2667,
+  .ra = 168.933,
+  .dec = 12.1165,
+},
+{ .is_ngc = FALSE,
+  .id = 2668,
+  .ra = 168.884,
+  .dec = -14.1716,
+},
+{ .is_ngc = FALSE,
+  .id = 2669,
+  .ra = 168.972,
+  .dec = 13.4293,
+},
+{ .is_ngc = FALSE,
+  .id = 2670,
+  .ra = 168.998,
+  .dec = 11.7827,
+},
+{ .is_ngc = FALSE,
+  .id = 2671,
+  .ra = 169.014,
+  .dec = 13.1239,
+},
+{ .is_ngc = FALSE,
+  .id = 2672,
+  .ra = 169.016,
+  .dec = 10.1568,
+},
+{ .is_ngc = FALSE,
+  .id = 2673,
+  .ra = 169.017,
+  .dec = 10.1622,
+},
+{ .is_ngc = FALSE,
+  .id = 2674,
+  .ra = 169.034,
+  .dec = 11.0481,
+},
+{ .is_ngc = FALSE,
+  .id = 2675,
+  .ra = 169.045,
+  .dec = 12.2489,
+},
+{ .is_ngc = FALSE,
+  .id = 2676,
+  .ra = 169.077,
+  .dec = 9.82119,
+},
+{ .is_ngc = FALSE,
+  .id = 2677,
+  .ra = 169.085,
+  .dec = 12.2147,
+},
+{ .is_ngc = FALSE,
+  .id = 2678,
+  .ra = 169.09,
+  .dec = 11.9484,
+},
+{ .is_ngc = FALSE,
+  .id = 2679,
+  .ra = 169.097,
+  .dec = 12.0149,
+},
+{ .is_ngc = FALSE,
+  .id = 2680,
+  .ra = 169.107,
+  .dec = 9.80664,
+},
+{ .is_ngc = FALSE,
+  .id = 2681,
+  .ra = 169.138,
+  .dec = 11.2069,
+},
+{ .is_ngc = FALSE,
+  .id = 2682,
+  .ra = 169.151,
+  .dec = 9.41028,
+},
+{ .is_ngc = FALSE,
+  .id = 2683,
+  .ra = 169.226,
+  .dec = 12.0989,
+},
+{ .is_ngc = FALSE,
+  .id = 2684,
+  .ra = 169.254,
+  .dec = 13.0988,
+},
+{ .is_ngc = FALSE,
+  .id = 2685,
+  .ra = 169.25,
+  .dec = 10.094,
+},
+{ .is_ngc = FALSE,
+  .id = 2686,
+  .ra = 169.261,
+  .dec = 12.9517,
+},
+{ .is_ngc = FALSE,
+  .id = 2686,
+  .ra = 169.263,
+  .dec = 12.9479,
+},
+{ .is_ngc = FALSE,
+  .id = 2687,
+  .ra = 169.3,
+  .dec = 10.1577,
+},
+{ .is_ngc = FALSE,
+  .id = 2688,
+  .ra = 169.325,
+  .dec = 13.4894,
+},
+{ .is_ngc = FALSE,
+  .id = 2689,
+  .ra = 169.332,
+  .dec = 12.9607,
+},
+{ .is_ngc = FALSE,
+  .id = 2690,
+  .ra = 169.34,
+  .dec = 12.9752,
+},
+{ .is_ngc = FALSE,
+  .id = 2691,
+  .ra = 169.352,
+  .dec = 12.031,
+},
+{ .is_ngc = FALSE,
+  .id = 2692,
+  .ra = 169.388,
+  .dec = 10.7678,
+},
+{ .is_ngc = FALSE,
+  .id = 2693,
+  .ra = 169.402,
+  .dec = 13.5489,
+},
+{ .is_ngc = FALSE,
+  .id = 2694,
+  .ra = 169.411,
+  .dec = 13.3761,
+},
+{ .is_ngc = FALSE,
+  .id = 2695,
+  .ra = 169.452,
+  .dec = 13.7273,
+},
+{ .is_ngc = FALSE,
+  .id = 2696,
+  .ra = 169.455,
+  .dec = 12.7555,
+},
+{ .is_ngc = FALSE,
+  .id = 2697,
+  .ra = 169.463,
+  .dec = 13.4,
+},
+{ .is_ngc = FALSE,
+  .id = 2698,
+  .ra = 169.463,
+  .dec = 11.885,
+},
+{ .is_ngc = FALSE,
+  .id = 2699,
+  .ra = 169.469,
+  .dec = 11.9091,
+},
+{ .is_ngc = FALSE,
+  .id = 2700,
+  .ra = 169.475,
+  .dec = 12.0535,
+},
+{ .is_ngc = FALSE,
+  .id = 2701,
+  .ra = 169.487,
+  .dec = 11.1175,
+},
+{ .is_ngc = FALSE,
+  .id = 2702,
+  .ra = 169.488,
+  .dec = 9.41242,
+},
+{ .is_ngc = FALSE,
+  .id = 2703,
+  .ra = 169.521,
+  .dec = 17.6496,
+},
+{ .is_ngc = FALSE,
+  .id = 2704,
+  .ra = 169.517,
+  .dec = 12.4536,
+},
+{ .is_ngc = FALSE,
+  .id = 2705,
+  .ra = 169.515,
+  .dec = 11.9039,
+},
+{ .is_ngc = FALSE,
+  .id = 2706,
+  .ra = 169.622,
+  .dec = 12.5483,
+},
+{ .is_ngc = FALSE,
+  .id = 2707,
+  .ra = 169.628,
+  .dec = 9.47428,
+},
+{ .is_ngc = FALSE,
+  .id = 2708,
+  .ra = 169.644,
+  .dec = 12.7109,
+},
+{ .is_ngc = FALSE,
+  .id = 2709,
+  .ra = 169.67,
+  .dec = 12.5642,
+},
+{ .is_ngc = FALSE,
+  .id = 2710,
+  .ra = 169.684,
+  .dec = 13.5671,
+},
+{ .is_ngc = FALSE,
+  .id = 2711,
+  .ra = 169.694,
+  .dec = 13.7384,
+},
+{ .is_ngc = FALSE,
+  .id = 2712,
+  .ra = 169.717,
+  .dec = 9.62556,
+},
+{ .is_ngc = FALSE,
+  .id = 2713,
+  .ra = 169.793,
+  .dec = 12.1646,
+},
+{ .is_ngc = FALSE,
+  .id = 2714,
+  .ra = 169.342,
+  .dec = -62.7175,
+},
+{ .is_ngc = FALSE,
+  .id = 2715,
+  .ra = 169.809,
+  .dec = 11.952,
+},
+{ .is_ngc = FALSE,
+  .id = 2716,
+  .ra = 169.818,
+  .dec = 11.6982,
+},
+{ .is_ngc = FALSE,
+  .id = 2717,
+  .ra = 169.828,
+  .dec = 12.0481,
+},
+{ .is_ngc = FALSE,
+  .id = 2718,
+  .ra = 169.837,
+  .dec = 12.0219,
+},
+{ .is_ngc = FALSE,
+  .id = 2719,
+  .ra = 169.884,
+  .dec = 12.0594,
+},
+{ .is_ngc = FALSE,
+  .id = 2720,
+  .ra = 169.898,
+  .dec = 12.0763,
+},
+{ .is_ngc = FALSE,
+  .id = 2721,
+  .ra = 169.928,
+  .dec = 12.3106,
+},
+{ .is_ngc = FALSE,
+  .id = 2722,
+  .ra = 169.933,
+  .dec = 13.9637,
+},
+{ .is_ngc = FALSE,
+  .id = 2723,
+  .ra = 169.95,
+  .dec = 12.0328,
+},
+{ .is_ngc = FALSE,
+  .id = 2724,
+  .ra = 169.952,
+  .dec = 10.7165,
+},
+{ .is_ngc = FALSE,
+  .id = 2725,
+  .ra = 169.989,
+  .dec = 13.4291,
+},
+{ .is_ngc = FALSE,
+  .id = 2726,
+  .ra = 169.993,
+  .dec = 13.4156,
+},
+{ .is_ngc = FALSE,
+  .id = 2726,
+  .ra = 169.994,
+  .dec = 13.4181,
+},
+{ .is_ngc = FALSE,
+  .id = 2727,
+  .ra = 170,
+  .dec = 12.0327,
+},
+{ .is_ngc = FALSE,
+  .id = 2728,
+  .ra = 170.023,
+  .dec = 13.4244,
+},
+{ .is_ngc = FALSE,
+  .id = 2728,
+  .ra = 170.021,
+  .dec = 13.4268,
+},
+{ .is_ngc = FALSE,
+  .id = 2729,
+  .ra = 170.03,
+  .dec = 13.4081,
+},
+{ .is_ngc = FALSE,
+  .id = 2729,
+  .ra = 170.028,
+  .dec = 13.4093,
+},
+{ .is_ngc = FALSE,
+  .id = 2730,
+  .ra = 170.031,
+  .dec = 12.3662,
+},
+{ .is_ngc = FALSE,
+  .id = 2731,
+  .ra = 170.043,
+  .dec = 13.5578,
+},
+{ .is_ngc = FALSE,
+  .id = 2732,
+  .ra = 170.052,
+  .dec = 12.4036,
+},
+{ .is_ngc = FALSE,
+  .id = 2733,
+  .ra = 170.102,
+  .dec = 13.8694,
+},
+{ .is_ngc = FALSE,
+  .id = 2733,
+  .ra = 170.072,
+  .dec = 13.835,
+},
+{ .is_ngc = FALSE,
+  .id = 2734,
+  .ra = 170.099,
+  .dec = 12.4429,
+},
+{ .is_ngc = FALSE,
+  .id = 2735,
+  .ra = 170.267,
+  .dec = 34.3441,
+},
+{ .is_ngc = FALSE,
+  .id = 2736,
+  .ra = 170.228,
+  .dec = 12.4087,
+},
+{ .is_ngc = FALSE,
+  .id = 2737,
+  .ra = 170.284,
+  .dec = 14.2932,
+},
+{ .is_ngc = FALSE,
+  .id = 2739,
+  .ra = 170.302,
+  .dec = 11.9141,
+},
+{ .is_ngc = FALSE,
+  .id = 2740,
+  .ra = 170.321,
+  .dec = 8.75169,
+},
+{ .is_ngc = FALSE,
+  .id = 2741,
+  .ra = 170.322,
+  .dec = 9.155,
+},
+{ .is_ngc = FALSE,
+  .id = 2742,
+  .ra = 170.328,
+  .dec = 10.446,
+},
+{ .is_ngc = FALSE,
+  .id = 2743,
+  .ra = 170.354,
+  .dec = 8.69331,
+},
+{ .is_ngc = FALSE,
+  .id = 2744,
+  .ra = 170.427,
+  .dec = 34.3627,
+},
+{ .is_ngc = FALSE,
+  .id = 2745,
+  .ra = 170.382,
+  .dec = 13.4266,
+},
+{ .is_ngc = FALSE,
+  .id = 2746,
+  .ra = 170.402,
+  .dec = 11.7369,
+},
+{ .is_ngc = FALSE,
+  .id = 2747,
+  .ra = 170.417,
+  .dec = 8.80306,
+},
+{ .is_ngc = FALSE,
+  .id = 2748,
+  .ra = 170.433,
+  .dec = 8.80485,
+},
+{ .is_ngc = FALSE,
+  .id = 2749,
+  .ra = 170.438,
+  .dec = 8.57397,
+},
+{ .is_ngc = FALSE,
+  .id = 2750,
+  .ra = 170.461,
+  .dec = 9.65794,
+},
+{ .is_ngc = FALSE,
+  .id = 2751,
+  .ra = 170.53,
+  .dec = 34.3664,
+},
+{ .is_ngc = FALSE,
+  .id = 2752,
+  .ra = 170.508,
+  .dec = 14.1241,
+},
+{ .is_ngc = FALSE,
+  .id = 2753,
+  .ra = 170.499,
+  .dec = 9.87775,
+},
+{ .is_ngc = FALSE,
+  .id = 2754,
+  .ra = 170.51,
+  .dec = 14.1436,
+},
+{ .is_ngc = FALSE,
+  .id = 2755,
+  .ra = 170.51,
+  .dec = 13.7927,
+},
+{ .is_ngc = FALSE,
+  .id = 2756,
+  .ra = 170.504,
+  .dec = 9.95956,
+},
+{ .is_ngc = FALSE,
+  .id = 2757,
+  .ra = 170.509,
+  .dec = 8.39342,
+},
+{ .is_ngc = FALSE,
+  .id = 2758,
+  .ra = 170.514,
+  .dec = 7.8134,
+},
+{ .is_ngc = FALSE,
+  .id = 2759,
+  .ra = 170.555,
+  .dec = 24.3172,
+},
+{ .is_ngc = FALSE,
+  .id = 2760,
+  .ra = 170.553,
+  .dec = 12.6653,
+},
+{ .is_ngc = FALSE,
+  .id = 2761,
+  .ra = 170.571,
+  .dec = 14.177,
+},
+{ .is_ngc = FALSE,
+  .id = 2762,
+  .ra = 170.575,
+  .dec = 12.7224,
+},
+{ .is_ngc = FALSE,
+  .id = 2763,
+  .ra = 170.576,
+  .dec = 13.0648,
+},
+{ .is_ngc = FALSE,
+  .id = 2764,
+  .ra = 171.771,
+  .dec = -28.9797,
+},
+{ .is_ngc = FALSE,
+  .id = 2765,
+  .ra = 170.596,
+  .dec = 14.1983,
+},
+{ .is_ngc = FALSE,
+  .id = 2766,
+  .ra = 170.596,
+  .dec = 12.9033,
+},
+{ .is_ngc = FALSE,
+  .id = 2767,
+  .ra = 170.598,
+  .dec = 13.0776,
+},
+{ .is_ngc = FALSE,
+  .id = 2768,
+  .ra = 170.598,
+  .dec = 12.5284,
+},
+{ .is_ngc = FALSE,
+  .id = 2769,
+  .ra = 170.607,
+  .dec = 14.1956,
+},
+{ .is_ngc = FALSE,
+  .id = 2770,
+  .ra = 170.603,
+  .dec = 9.22042,
+},
+{ .is_ngc = FALSE,
+  .id = 2771,
+  .ra = 170.617,
+  .dec = 12.5189,
+},
+{ .is_ngc = FALSE,
+  .id = 2772,
+  .ra = 170.627,
+  .dec = 13.5987,
+},
+{ .is_ngc = FALSE,
+  .id = 2773,
+  .ra = 170.652,
+  .dec = 13.57,
+},
+{ .is_ngc = FALSE,
+  .id = 2773,
+  .ra = 170.647,
+  .dec = 13.5742,
+},
+{ .is_ngc = FALSE,
+  .id = 2774,
+  .ra = 170.655,
+  .dec = 12.5144,
+},
+{ .is_ngc = FALSE,
+  .id = 2775,
+  .ra = 170.665,
+  .dec = 12.5116,
+},
+{ .is_ngc = FALSE,
+  .id = 2776,
+  .ra = 170.667,
+  .dec = 13.3304,
+},
+{ .is_ngc = FALSE,
+  .id = 2777,
+  .ra = 170.669,
+  .dec = 12.025,
+},
+{ .is_ngc = FALSE,
+  .id = 2778,
+  .ra = 170.675,
+  .dec = 12.5261,
+},
+{ .is_ngc = FALSE,
+  .id = 2779,
+  .ra = 170.685,
+  .dec = 13.3455,
+},
+{ .is_ngc = FALSE,
+  .id = 2780,
+  .ra = 170.701,
+  .dec = 10.1493,
+},
+{ .is_ngc = FALSE,
+  .id = 2781,
+  .ra = 170.711,
+  .dec = 12.3446,
+},
+{ .is_ngc = FALSE,
+  .id = 2782,
+  .ra = 170.731,
+  .dec = 13.4413,
+},
+{ .is_ngc = FALSE,
+  .id = 2783,
+  .ra = 170.723,
+  .dec = 8.88387,
+},
+{ .is_ngc = FALSE,
+  .id = 2784,
+  .ra = 170.798,
+  .dec = 13.1175,
+},
+{ .is_ngc = FALSE,
+  .id = 2785,
+  .ra = 170.814,
+  .dec = 13.3913,
+},
+{ .is_ngc = FALSE,
+  .id = 2786,
+  .ra = 170.823,
+  .dec = 13.3919,
+},
+{ .is_ngc = FALSE,
+  .id = 2787,
+  .ra = 170.829,
+  .dec = 13.6293,
+},
+{ .is_ngc = FALSE,
+  .id = 2788,
+  .ra = 170.862,
+  .dec = 12.6976,
+},
+{ .is_ngc = FALSE,
+  .id = 2789,
+  .ra = 170.887,
+  .dec = 14.1864,
+},
+{ .is_ngc = FALSE,
+  .id = 2790,
+  .ra = 170.892,
+  .dec = 9.5545,
+},
+{ .is_ngc = FALSE,
+  .id = 2791,
+  .ra = 170.906,
+  .dec = 12.8957,
+},
+{ .is_ngc = FALSE,
+  .id = 2792,
+  .ra = 170.923,
+  .dec = 11.404,
+},
+{ .is_ngc = FALSE,
+  .id = 2793,
+  .ra = 170.947,
+  .dec = 9.44972,
+},
+{ .is_ngc = FALSE,
+  .id = 2794,
+  .ra = 171.015,
+  .dec = 12.7907,
+},
+{ .is_ngc = FALSE,
+  .id = 2795,
+  .ra = 171.017,
+  .dec = 12.1349,
+},
+{ .is_ngc = FALSE,
+  .id = 2796,
+  .ra = 171.035,
+  .dec = 9.34389,
+},
+{ .is_ngc = FALSE,
+  .id = 2797,
+  .ra = 171.088,
+  .dec = 11.7057,
+},
+{ .is_ngc = FALSE,
+  .id = 2798,
+  .ra = 171.1,
+  .dec = 12.4156,
+},
+{ .is_ngc = FALSE,
+  .id = 2799,
+  .ra = 171.111,
+  .dec = 13.8489,
+},
+{ .is_ngc = FALSE,
+  .id = 2800,
+  .ra = 171.113,
+  .dec = 12.2085,
+},
+{ .is_ngc = FALSE,
+  .id = 2801,
+  .ra = 171.121,
+  .dec = 10.1833,
+},
+{ .is_ngc = FALSE,
+  .id = 2802,
+  .ra = 171.126,
+  .dec = 12.2084,
+},
+{ .is_ngc = FALSE,
+  .id = 2803,
+  .ra = 171.147,
+  .dec = 9.84958,
+},
+{ .is_ngc = FALSE,
+  .id = 2804,
+  .ra = 171.232,
+  .dec = 13.222,
+},
+{ .is_ngc = FALSE,
+  .id = 2805,
+  .ra = 171.25,
+  .dec = 14.0145,
+},
+{ .is_ngc = FALSE,
+  .id = 2806,
+  .ra = 171.313,
+  .dec = 9.65233,
+},
+{ .is_ngc = FALSE,
+  .id = 2807,
+  .ra = 171.321,
+  .dec = 11.5294,
+},
+{ .is_ngc = FALSE,
+  .id = 2808,
+  .ra = 171.362,
+  .dec = 9.13219,
+},
+{ .is_ngc = FALSE,
+  .id = 2809,
+  .ra = 171.407,
+  .dec = 8.52614,
+},
+{ .is_ngc = FALSE,
+  .id = 2810,
+  .ra = 171.437,
+  .dec = 14.6767,
+},
+{ .is_ngc = FALSE,
+  .id = 2811,
+  .ra = 171.436,
+  .dec = 9.17031,
+},
+{ .is_ngc = FALSE,
+  .id = 2812,
+  .ra = 171.483,
+  .dec = 11.5299,
+},
+{ .is_ngc = FALSE,
+  .id = 2813,
+  .ra = 171.527,
+  .dec = 11.2556,
+},
+{ .is_ngc = FALSE,
+  .id = 2814,
+  .ra = 171.536,
+  .dec = 9.66131,
+},
+{ .is_ngc = FALSE,
+  .id = 2815,
+  .ra = 171.569,
+  .dec = 12.8033,
+},
+{ .is_ngc = FALSE,
+  .id = 2816,
+  .ra = 171.576,
+  .dec = 10.636,
+},
+{ .is_ngc = FALSE,
+  .id = 2817,
+  .ra = 171.578,
+  .dec = 9.14886,
+},
+{ .is_ngc = FALSE,
+  .id = 2818,
+  .ra = 171.612,
+  .dec = 12.9209,
+},
+{ .is_ngc = FALSE,
+  .id = 2819,
+  .ra = 171.614,
+  .dec = 13.8441,
+},
+{ .is_ngc = FALSE,
+  .id = 2820,
+  .ra = 171.612,
+  .dec = 10.2383,
+},
+{ .is_ngc = FALSE,
+  .id = 2821,
+  .ra = 171.645,
+  .dec = 13.9622,
+},
+{ .is_ngc = FALSE,
+  .id = 2822,
+  .ra = 171.642,
+  .dec = 11.4396,
+},
+{ .is_ngc = FALSE,
+  .id = 2823,
+  .ra = 171.686,
+  .dec = 12.8478,
+},
+{ .is_ngc = FALSE,
+  .id = 2824,
+  .ra = 171.77,
+  .dec = 14.0847,
+},
+{ .is_ngc = FALSE,
+  .id = 2825,
+  .ra = 171.765,
+  .dec = 8.44419,
+},
+{ .is_ngc = FALSE,
+  .id = 2826,
+  .ra = 171.775,
+  .dec = 13.2383,
+},
+{ .is_ngc = FALSE,
+  .id = 2827,
+  .ra = 171.79,
+  .dec = 11.5142,
+},
+{ .is_ngc = FALSE,
+  .id = 2828,
+  .ra = 171.796,
+  .dec = 8.73094,
+},
+{ .is_ngc = FALSE,
+  .id = 2829,
+  .ra = 171.812,
+  .dec = 10.3222,
+},
+{ .is_ngc = FALSE,
+  .id = 2830,
+  .ra = 171.84,
+  .dec = 7.81389,
+},
+{ .is_ngc = FALSE,
+  .id = 2831,
+  .ra = 171.845,
+  .dec = 8.97883,
+},
+{ .is_ngc = FALSE,
+  .id = 2832,
+  .ra = 171.855,
+  .dec = 13.989,
+},
+{ .is_ngc = FALSE,
+  .id = 2833,
+  .ra = 171.859,
+  .dec = 13.6023,
+},
+{ .is_ngc = FALSE,
+  .id = 2834,
+  .ra = 171.882,
+  .dec = 13.5693,
+},
+{ .is_ngc = FALSE,
+  .id = 2835,
+  .ra = 171.882,
+  .dec = 12.1427,
+},
+{ .is_ngc = FALSE,
+  .id = 2836,
+  .ra = 171.905,
+  .dec = 9.08489,
+},
+{ .is_ngc = FALSE,
+  .id = 2837,
+  .ra = 171.925,
+  .dec = 10.3127,
+},
+{ .is_ngc = FALSE,
+  .id = 2838,
+  .ra = 171.938,
+  .dec = 14.011,
+},
+{ .is_ngc = FALSE,
+  .id = 2839,
+  .ra = 171.939,
+  .dec = 10.8193,
+},
+{ .is_ngc = FALSE,
+  .id = 2840,
+  .ra = 171.948,
+  .dec = 13.4254,
+},
+{ .is_ngc = FALSE,
+  .id = 2841,
+  .ra = 171.953,
+  .dec = 12.6031,
+},
+{ .is_ngc = FALSE,
+  .id = 2842,
+  .ra = 171.949,
+  .dec = 9.65153,
+},
+{ .is_ngc = FALSE,
+  .id = 2843,
+  .ra = 171.992,
+  .dec = 13.1833,
+},
+{ .is_ngc = FALSE,
+  .id = 2844,
+  .ra = 171.992,
+  .dec = 11.4528,
+},
+{ .is_ngc = FALSE,
+  .id = 2845,
+  .ra = 172.002,
+  .dec = 12.5296,
+},
+{ .is_ngc = FALSE,
+  .id = 2846,
+  .ra = 172.002,
+  .dec = 11.158,
+},
+{ .is_ngc = FALSE,
+  .id = 2847,
+  .ra = 172.014,
+  .dec = 13.9294,
+},
+{ .is_ngc = FALSE,
+  .id = 2848,
+  .ra = 172.057,
+  .dec = 13.0303,
+},
+{ .is_ngc = FALSE,
+  .id = 2849,
+  .ra = 172.049,
+  .dec = 9.09364,
+},
+{ .is_ngc = FALSE,
+  .id = 2850,
+  .ra = 172.054,
+  .dec = 9.06217,
+},
+{ .is_ngc = FALSE,
+  .id = 2851,
+  .ra = 172.061,
+  .dec = 11.3937,
+},
+{ .is_ngc = FALSE,
+  .id = 2852,
+  .ra = 172.058,
+  .dec = 9.80038,
+},
+{ .is_ngc = FALSE,
+  .id = 2853,
+  .ra = 172.062,
+  .dec = 9.147,
+},
+{ .is_ngc = FALSE,
+  .id = 2854,
+  .ra = 172.083,
+  .dec = 8.96844,
+},
+{ .is_ngc = FALSE,
+  .id = 2855,
+  .ra = 172.104,
+  .dec = 9.68728,
+},
+{ .is_ngc = FALSE,
+  .id = 2856,
+  .ra = 172.068,
+  .dec = -12.8907,
+},
+{ .is_ngc = FALSE,
+  .id = 2857,
+  .ra = 172.129,
+  .dec = 9.10397,
+},
+{ .is_ngc = FALSE,
+  .id = 2858,
+  .ra = 172.15,
+  .dec = 13.661,
+},
+{ .is_ngc = FALSE,
+  .id = 2859,
+  .ra = 172.174,
+  .dec = 9.10844,
+},
+{ .is_ngc = FALSE,
+  .id = 2860,
+  .ra = 172.186,
+  .dec = 14.0412,
+},
+{ .is_ngc = FALSE,
+  .id = 2861,
+  .ra = 172.246,
+  .dec = 38.8513,
+},
+{ .is_ngc = FALSE,
+  .id = 2862,
+  .ra = 172.18,
+  .dec = 10.1271,
+},
+{ .is_ngc = FALSE,
+  .id = 2863,
+  .ra = 172.225,
+  .dec = 9.09514,
+},
+{ .is_ngc = FALSE,
+  .id = 2864,
+  .ra = 172.249,
+  .dec = 12.3674,
+},
+{ .is_ngc = FALSE,
+  .id = 2865,
+  .ra = 172.249,
+  .dec = 9.11508,
+},
+{ .is_ngc = FALSE,
+  .id = 2866,
+  .ra = 172.25,
+  .dec = 9.04183,
+},
+{ .is_ngc = FALSE,
+  .id = 2867,
+  .ra = 172.252,
+  .dec = 9.08958,
+},
+{ .is_ngc = FALSE,
+  .id = 2868,
+  .ra = 172.274,
+  .dec = 9.09439,
+},
+{ .is_ngc = FALSE,
+  .id = 2869,
+  .ra = 172.286,
+  .dec = 9.01736,
+},
+{ .is_ngc = FALSE,
+  .id = 2870,
+  .ra = 172.301,
+  .dec = 11.8644,
+},
+{ .is_ngc = FALSE,
+  .id = 2871,
+  .ra = 172.336,
+  .dec = 8.60219,
+},
+{ .is_ngc = FALSE,
+  .id = 2872,
+  .ra = 172.067,
+  .dec = -62.9833,
+},
+{ .is_ngc = FALSE,
+  .id = 2873,
+  .ra = 172.365,
+  .dec = 13.2181,
+},
+{ .is_ngc = FALSE,
+  .id = 2874,
+  .ra = 172.364,
+  .dec = 10.6278,
+},
+{ .is_ngc = FALSE,
+  .id = 2875,
+  .ra = 172.396,
+  .dec = 12.9899,
+},
+{ .is_ngc = FALSE,
+  .id = 2876,
+  .ra = 172.39,
+  .dec = 9.01581,
+},
+{ .is_ngc = FALSE,
+  .id = 2877,
+  .ra = 172.407,
+  .dec = 12.853,
+},
+{ .is_ngc = FALSE,
+  .id = 2878,
+  .ra = 172.409,
+  .dec = 9.96706,
+},
+{ .is_ngc = FALSE,
+  .id = 2879,
+  .ra = 172.434,
+  .dec = 9.01331,
+},
+{ .is_ngc = FALSE,
+  .id = 2880,
+  .ra = 172.471,
+  .dec = 13.1988,
+},
+{ .is_ngc = FALSE,
+  .id = 2880,
+  .ra = 172.469,
+  .dec = 13.2014,
+},
+{ .is_ngc = FALSE,
+  .id = 2881,
+  .ra = 172.477,
+  .dec = 12.5108,
+},
+{ .is_ngc = FALSE,
+  .id = 2882,
+  .ra = 172.539,
+  .dec = 11.989,
+},
+{ .is_ngc = FALSE,
+  .id = 2883,
+  .ra = 172.566,
+  .dec = 10.9107,
+},
+{ .is_ngc = FALSE,
+  .id = 2884,
+  .ra = 171.923,
+  .dec = -79.7354,
+},
+{ .is_ngc = FALSE,
+  .id = 2885,
+  .ra = 172.594,
+  .dec = 9.77172,
+},
+{ .is_ngc = FALSE,
+  .id = 2886,
+  .ra = 172.602,
+  .dec = 11.5624,
+},
+{ .is_ngc = FALSE,
+  .id = 2888,
+  .ra = 172.646,
+  .dec = 9.90831,
+},
+{ .is_ngc = FALSE,
+  .id = 2889,
+  .ra = 172.621,
+  .dec = -13.0917,
+},
+{ .is_ngc = FALSE,
+  .id = 2890,
+  .ra = 172.692,
+  .dec = 13.182,
+},
+{ .is_ngc = FALSE,
+  .id = 2891,
+  .ra = 172.7,
+  .dec = 12.6772,
+},
+{ .is_ngc = FALSE,
+  .id = 2892,
+  .ra = 172.704,
+  .dec = 10.5879,
+},
+{ .is_ngc = FALSE,
+  .id = 2893,
+  .ra = 172.722,
+  .dec = 13.3906,
+},
+{ .is_ngc = FALSE,
+  .id = 2894,
+  .ra = 172.739,
+  .dec = 13.2348,
+},
+{ .is_ngc = FALSE,
+  .id = 2895,
+  .ra = 172.739,
+  .dec = 9.97681,
+},
+{ .is_ngc = FALSE,
+  .id = 2896,
+  .ra = 172.806,
+  .dec = 12.3499,
+},
+{ .is_ngc = FALSE,
+  .id = 2897,
+  .ra = 172.831,
+  .dec = 11.5488,
+},
+{ .is_ngc = FALSE,
+  .id = 2898,
+  .ra = 172.835,
+  .dec = 13.3354,
+},
+{ .is_ngc = FALSE,
+  .id = 2899,
+  .ra = 172.835,
+  .dec = 10.6346,
+},
+{ .is_ngc = FALSE,
+  .id = 2900,
+  .ra = 172.874,
+  .dec = 13.1672,
+},
+{ .is_ngc = FALSE,
+  .id = 2901,
+  .ra = 172.884,
+  .dec = 12.6997,
+},
+{ .is_ngc = FALSE,
+  .id = 2902,
+  .ra = 172.888,
+  .dec = 14.2225,
+},
+{ .is_ngc = FALSE,
+  .id = 2903,
+  .ra = 172.92,
+  .dec = 12.6419,
+},
+{ .is_ngc = FALSE,
+  .id = 2904,
+  .ra = 172.927,
+  .dec = 13.184,
+},
+{ .is_ngc = FALSE,
+  .id = 2905,
+  .ra = 172.946,
+  .dec = 9.10647,
+},
+{ .is_ngc = FALSE,
+  .id = 2906,
+  .ra = 172.957,
+  .dec = 13.1323,
+},
+{ .is_ngc = FALSE,
+  .id = 2907,
+  .ra = 172.954,
+  .dec = 9.89889,
+},
+{ .is_ngc = FALSE,
+  .id = 2908,
+  .ra = 172.961,
+  .dec = 12.9376,
+},
+{ .is_ngc = FALSE,
+  .id = 2909,
+  .ra = 172.962,
+  .dec = 11.4698,
+},
+{ .is_ngc = FALSE,
+  .id = 2910,
+  .ra = 172.978,
+  .dec = -9.72541,
+},
+{ .is_ngc = FALSE,
+  .id = 2911,
+  .ra = 173.022,
+  .dec = 12.9772,
+},
+{ .is_ngc = FALSE,
+  .id = 2912,
+  .ra = 173.029,
+  .dec = 11.7099,
+},
+{ .is_ngc = FALSE,
+  .id = 2913,
+  .ra = 172.963,
+  .dec = -30.41,
+},
+{ .is_ngc = FALSE,
+  .id = 2914,
+  .ra = 173.052,
+  .dec = 13.4918,
+},
+{ .is_ngc = FALSE,
+  .id = 2915,
+  .ra = 173.065,
+  .dec = 14.4837,
+},
+{ .is_ngc = FALSE,
+  .id = 2916,
+  .ra = 173.067,
+  .dec = 11.6835,
+},
+{ .is_ngc = FALSE,
+  .id = 2917,
+  .ra = 173.081,
+  .dec = 10.9453,
+},
+{ .is_ngc = FALSE,
+  .id = 2918,
+  .ra = 173.109,
+  .dec = 13.2486,
+},
+{ .is_ngc = FALSE,
+  .id = 2919,
+  .ra = 173.146,
+  .dec = 14.1899,
+},
+{ .is_ngc = FALSE,
+  .id = 2920,
+  .ra = 173.204,
+  .dec = 12.5571,
+},
+{ .is_ngc = FALSE,
+  .id = 2921,
+  .ra = 173.205,
+  .dec = 10.2963,
+},
+{ .is_ngc = FALSE,
+  .id = 2922,
+  .ra = 173.214,
+  .dec = 12.9222,
+},
+{ .is_ngc = FALSE,
+  .id = 2923,
+  .ra = 173.223,
+  .dec = 13.1636,
+},
+{ .is_ngc = FALSE,
+  .id = 2924,
+  .ra = 173.218,
+  .dec = 9.02333,
+},
+{ .is_ngc = FALSE,
+  .id = 2925,
+  .ra = 173.305,
+  .dec = 34.2651,
+},
+{ .is_ngc = FALSE,
+  .id = 2926,
+  .ra = 173.268,
+  .dec = 12.4362,
+},
+{ .is_ngc = FALSE,
+  .id = 2927,
+  .ra = 173.27,
+  .dec = 13.0852,
+},
+{ .is_ngc = FALSE,
+  .id = 2928,
+  .ra = 173.375,
+  .dec = 34.3161,
+},
+{ .is_ngc = FALSE,
+  .id = 2929,
+  .ra = 173.381,
+  .dec = 12.1365,
+},
+{ .is_ngc = FALSE,
+  .id = 2930,
+  .ra = 173.434,
+  .dec = 10.0882,
+},
+{ .is_ngc = FALSE,
+  .id = 2931,
+  .ra = 173.461,
+  .dec = 12.4664,
+},
+{ .is_ngc = FALSE,
+  .id = 2932,
+  .ra = 173.473,
+  .dec = 10.5434,
+},
+{ .is_ngc = FALSE,
+  .id = 2933,
+  .ra = 173.553,
+  .dec = 34.3126,
+},
+{ .is_ngc = FALSE,
+  .id = 2934,
+  .ra = 173.582,
+  .dec = 13.3211,
+},
+{ .is_ngc = FALSE,
+  .id = 2935,
+  .ra = 173.701,
+  .dec = 10.2496,
+},
+{ .is_ngc = FALSE,
+  .id = 2936,
+  .ra = 173.737,
+  .dec = 13.0081,
+},
+{ .is_ngc = FALSE,
+  .id = 2937,
+  .ra = 173.764,
+  .dec = 10.1033,
+},
+{ .is_ngc = FALSE,
+  .id = 2938,
+  .ra = 173.901,
+  .dec = 13.6798,
+},
+{ .is_ngc = FALSE,
+  .id = 2939,
+  .ra = 173.908,
+  .dec = 10.6966,
+},
+{ .is_ngc = FALSE,
+  .id = 2940,
+  .ra = 174.008,
+  .dec = 21.9519,
+},
+{ .is_ngc = FALSE,
+  .id = 2941,
+  .ra = 174.042,
+  .dec = 10.0555,
+},
+{ .is_ngc = FALSE,
+  .id = 2942,
+  .ra = 174.05,
+  .dec = 11.8153,
+},
+{ .is_ngc = FALSE,
+  .id = 2943,
+  .ra = 174.177,
+  .dec = 54.8461,
+},
+{ .is_ngc = FALSE,
+  .id = 2944,
+  .ra = 173.947,
+  .dec = -63.0197,
+},
+{ .is_ngc = FALSE,
+  .id = 2945,
+  .ra = 174.268,
+  .dec = 12.9263,
+},
+{ .is_ngc = FALSE,
+  .id = 2946,
+  .ra = 174.373,
+  .dec = 32.2523,
+},
+{ .is_ngc = FALSE,
+  .id = 2947,
+  .ra = 174.379,
+  .dec = 31.3614,
+},
+{ .is_ngc = FALSE,
+  .id = 2948,
+  .ra = 174.771,
+  .dec = -63.435,
+},
+{ .is_ngc = FALSE,
+  .id = 2949,
+  .ra = 175.227,
+  .dec = -46.4544,
+},
+{ .is_ngc = FALSE,
+  .id = 2950,
+  .ra = 175.408,
+  .dec = 37.9921,
+},
+{ .is_ngc = FALSE,
+  .id = 2951,
+  .ra = 175.852,
+  .dec = 19.7494,
+},
+{ .is_ngc = FALSE,
+  .id = 2952,
+  .ra = 176.072,
+  .dec = 33.3513,
+},
+{ .is_ngc = FALSE,
+  .id = 2954,
+  .ra = 176.264,
+  .dec = 26.7864,
+},
+{ .is_ngc = FALSE,
+  .id = 2955,
+  .ra = 176.266,
+  .dec = 19.6204,
+},
+{ .is_ngc = FALSE,
+  .id = 2956,
+  .ra = 176.323,
+  .dec = 26.7669,
+},
+{ .is_ngc = FALSE,
+  .id = 2957,
+  .ra = 176.404,
+  .dec = 31.2995,
+},
+{ .is_ngc = FALSE,
+  .id = 2958,
+  .ra = 176.426,
+  .dec = 33.1539,
+},
+{ .is_ngc = FALSE,
+  .id = 2960,
+  .ra = 176.582,
+  .dec = 35.0035,
+},
+{ .is_ngc = FALSE,
+  .id = 2961,
+  .ra = 176.957,
+  .dec = 31.3449,
+},
+{ .is_ngc = FALSE,
+  .id = 2962,
+  .ra = 177.271,
+  .dec = -12.3019,
+},
+{ .is_ngc = FALSE,
+  .id = 2964,
+  .ra = 177.467,
+  .dec = 12.05,
+},
+{ .is_ngc = FALSE,
+  .id = 2966,
+  .ra = 177.555,
+  .dec = -64.8711,
+},
+{ .is_ngc = FALSE,
+  .id = 2967,
+  .ra = 177.73,
+  .dec = 30.8508,
+},
+{ .is_ngc = FALSE,
+  .id = 2968,
+  .ra = 178.127,
+  .dec = 20.6253,
+},
+{ .is_ngc = FALSE,
+  .id = 2969,
+  .ra = 178.13,
+  .dec = -3.87297,
+},
+{ .is_ngc = FALSE,
+  .id = 2970,
+  .ra = 178.287,
+  .dec = -23.1178,
+},
+{ .is_ngc = FALSE,
+  .id = 2970,
+  .ra = 178.253,
+  .dec = -23.1289,
+},
+{ .is_ngc = FALSE,
+  .id = 2971,
+  .ra = 178.365,
+  .dec = 30.6967,
+},
+{ .is_ngc = FALSE,
+  .id = 2973,
+  .ra = 178.461,
+  .dec = 33.3653,
+},
+{ .is_ngc = FALSE,
+  .id = 2977,
+  .ra = 178.81,
+  .dec = -37.6956,
+},
+{ .is_ngc = FALSE,
+  .id = 2978,
+  .ra = 179.096,
+  .dec = 32.0387,
+},
+{ .is_ngc = FALSE,
+  .id = 2979,
+  .ra = 179.226,
+  .dec = 32.1587,
+},
+{ .is_ngc = FALSE,
+  .id = 2980,
+  .ra = 179.375,
+  .dec = -73.6847,
+},
+{ .is_ngc = FALSE,
+  .id = 2981,
+  .ra = 178.927,
+  .dec = 32.1893,
+},
+{ .is_ngc = FALSE,
+  .id = 2983,
+  .ra = 179.567,
+  .dec = -2.10167,
+},
+{ .is_ngc = FALSE,
+  .id = 2984,
+  .ra = 179.78,
+  .dec = 30.6969,
+},
+{ .is_ngc = FALSE,
+  .id = 2985,
+  .ra = 179.803,
+  .dec = 30.7312,
+},
+{ .is_ngc = FALSE,
+  .id = 2986,
+  .ra = 179.957,
+  .dec = 30.8445,
+},
+{ .is_ngc = FALSE,
+  .id = 2987,
+  .ra = 180.852,
+  .dec = 38.8131,
+},
+{ .is_ngc = FALSE,
+  .id = 2988,
+  .ra = 180.926,
+  .dec = 3.42953,
+},
+{ .is_ngc = FALSE,
+  .id = 2990,
+  .ra = 181.161,
+  .dec = 11.0497,
+},
+{ .is_ngc = FALSE,
+  .id = 2991,
+  .ra = 181.303,
+  .dec = 10.6401,
+},
+{ .is_ngc = FALSE,
+  .id = 2992,
+  .ra = 181.316,
+  .dec = 30.8555,
+},
+{ .is_ngc = FALSE,
+  .id = 2993,
+  .ra = 181.41,
+  .dec = 32.8223,
+},
+{ .is_ngc = FALSE,
+  .id = 2994,
+  .ra = 181.366,
+  .dec = 12.7028,
+},
+{ .is_ngc = FALSE,
+  .id = 2995,
+  .ra = 181.445,
+  .dec = -27.9406,
+},
+{ .is_ngc = FALSE,
+  .id = 2996,
+  .ra = 181.452,
+  .dec = -29.9728,
+},
+{ .is_ngc = FALSE,
+  .id = 2997,
+  .ra = 181.435,
+  .dec = 20.2808,
+},
+{ .is_ngc = FALSE,
+  .id = 2997,
+  .ra = 181.432,
+  .dec = 20.2843,
+},
+{ .is_ngc = FALSE,
+  .id = 2999,
+  .ra = 181.49,
+  .dec = 31.3481,
+},
+{ .is_ngc = FALSE,
+  .id = 3000,
+  .ra = 181.533,
+  .dec = -29.6678,
+},
+{ .is_ngc = FALSE,
+  .id = 3001,
+  .ra = 181.57,
+  .dec = 33.5254,
+},
+{ .is_ngc = FALSE,
+  .id = 3002,
+  .ra = 181.767,
+  .dec = 33.3824,
+},
+{ .is_ngc = FALSE,
+  .id = 3003,
+  .ra = 181.886,
+  .dec = 32.8128,
+},
+{ .is_ngc = FALSE,
+  .id = 3004,
+  .ra = 181.793,
+  .dec = 13.2477,
+},
+{ .is_ngc = FALSE,
+  .id = 3005,
+  .ra = 181.808,
+  .dec = -30.0247,
+},
+{ .is_ngc = FALSE,
+  .id = 3007,
+  .ra = 181.878,
+  .dec = 31.348,
+},
+{ .is_ngc = FALSE,
+  .id = 3008,
+  .ra = 181.966,
+  .dec = 13.5772,
+},
+{ .is_ngc = FALSE,
+  .id = 3009,
+  .ra = 182,
+  .dec = 12.6464,
+},
+{ .is_ngc = FALSE,
+  .id = 3010,
+  .ra = 181.988,
+  .dec = -30.3397,
+},
+{ .is_ngc = FALSE,
+  .id = 3012,
+  .ra = 182.1,
+  .dec = 11.1763,
+},
+{ .is_ngc = FALSE,
+  .id = 3013,
+  .ra = 182.106,
+  .dec = 10.0164,
+},
+{ .is_ngc = FALSE,
+  .id = 3014,
+  .ra = 182.154,
+  .dec = 38.8316,
+},
+{ .is_ngc = FALSE,
+  .id = 3015,
+  .ra = 182.252,
+  .dec = -31.5197,
+},
+{ .is_ngc = FALSE,
+  .id = 3016,
+  .ra = 182.327,
+  .dec = 11.4294,
+},
+{ .is_ngc = FALSE,
+  .id = 3017,
+  .ra = 182.345,
+  .dec = 13.6185,
+},
+{ .is_ngc = FALSE,
+  .id = 3018,
+  .ra = 182.353,
+  .dec = 13.5746,
+},
+{ .is_ngc = FALSE,
+  .id = 3019,
+  .ra = 182.343,
+  .dec = 13.9921,
+},
+{ .is_ngc = FALSE,
+  .id = 3020,
+  .ra = 182.364,
+  .dec = 14.2244,
+},
+{ .is_ngc = FALSE,
+  .id = 3021,
+  .ra = 182.477,
+  .dec = 13.0501,
+},
+{ .is_ngc = FALSE,
+  .id = 3022,
+  .ra = 182.51,
+  .dec = 38.7399,
+},
+{ .is_ngc = FALSE,
+  .id = 3023,
+  .ra = 182.508,
+  .dec = 14.3655,
+},
+{ .is_ngc = FALSE,
+  .id = 3024,
+  .ra = 182.549,
+  .dec = 12.3251,
+},
+{ .is_ngc = FALSE,
+  .id = 3025,
+  .ra = 182.595,
+  .dec = 10.1881,
+},
+{ .is_ngc = FALSE,
+  .id = 3026,
+  .ra = 182.642,
+  .dec = -29.9178,
+},
+{ .is_ngc = FALSE,
+  .id = 3027,
+  .ra = 182.625,
+  .dec = 14.185,
+},
+{ .is_ngc = FALSE,
+  .id = 3028,
+  .ra = 182.649,
+  .dec = 11.7614,
+},
+{ .is_ngc = FALSE,
+  .id = 3029,
+  .ra = 182.675,
+  .dec = 13.331,
+},
+{ .is_ngc = FALSE,
+  .id = 3030,
+  .ra = 182.775,
+  .dec = 14.135,
+},
+{ .is_ngc = FALSE,
+  .id = 3031,
+  .ra = 182.768,
+  .dec = 13.3083,
+},
+{ .is_ngc = FALSE,
+  .id = 3032,
+  .ra = 182.781,
+  .dec = 14.2742,
+},
+{ .is_ngc = FALSE,
+  .id = 3033,
+  .ra = 182.791,
+  .dec = 13.5874,
+},
+{ .is_ngc = FALSE,
+  .id = 3034,
+  .ra = 182.95,
+  .dec = 14.2,
+},
+{ .is_ngc = FALSE,
+  .id = 3036,
+  .ra = 183.063,
+  .dec = 12.4879,
+},
+{ .is_ngc = FALSE,
+  .id = 3037,
+  .ra = 183.085,
+  .dec = 9.98556,
+},
+{ .is_ngc = FALSE,
+  .id = 3038,
+  .ra = 183.135,
+  .dec = 11.3522,
+},
+{ .is_ngc = FALSE,
+  .id = 3039,
+  .ra = 183.135,
+  .dec = 12.3095,
+},
+{ .is_ngc = FALSE,
+  .id = 3040,
+  .ra = 183.143,
+  .dec = 11.0747,
+},
+{ .is_ngc = FALSE,
+  .id = 3041,
+  .ra = 183.178,
+  .dec = 12.7628,
+},
+{ .is_ngc = FALSE,
+  .id = 3043,
+  .ra = 183.197,
+  .dec = 10.01,
+},
+{ .is_ngc = FALSE,
+  .id = 3044,
+  .ra = 183.202,
+  .dec = 13.9759,
+},
+{ .is_ngc = FALSE,
+  .id = 3045,
+  .ra = 183.249,
+  .dec = 12.7794,
+},
+{ .is_ngc = FALSE,
+  .id = 3046,
+  .ra = 183.284,
+  .dec = 12.9182,
+},
+{ .is_ngc = FALSE,
+  .id = 3047,
+  .ra = 183.312,
+  .dec = 12.9972,
+},
+{ .is_ngc = FALSE,
+  .id = 3048,
+  .ra = 183.339,
+  .dec = 13.069,
+},
+{ .is_ngc = FALSE,
+  .id = 3049,
+  .ra = 183.383,
+  .dec = 14.4689,
+},
+{ .is_ngc = FALSE,
+  .id = 3052,
+  .ra = 183.452,
+  .dec = 12.6897,
+},
+{ .is_ngc = FALSE,
+  .id = 3053,
+  .ra = 183.466,
+  .dec = 14.2217,
+},
+{ .is_ngc = FALSE,
+  .id = 3054,
+  .ra = 183.56,
+  .dec = 13.5421,
+},
+{ .is_ngc = FALSE,
+  .id = 3055,
+  .ra = 183.593,
+  .dec = 12.0914,
+},
+{ .is_ngc = FALSE,
+  .id = 3056,
+  .ra = 183.657,
+  .dec = 12.8131,
+},
+{ .is_ngc = FALSE,
+  .id = 3057,
+  .ra = 183.758,
+  .dec = -44.4678,
+},
+{ .is_ngc = FALSE,
+  .id = 3057,
+  .ra = 183.902,
+  .dec = -44.4539,
+},
+{ .is_ngc = FALSE,
+  .id = 3058,
+  .ra = 183.699,
+  .dec = 14.0942,
+},
+{ .is_ngc = FALSE,
+  .id = 3059,
+  .ra = 183.73,
+  .dec = 13.4599,
+},
+{ .is_ngc = FALSE,
+  .id = 3060,
+  .ra = 183.759,
+  .dec = 12.547,
+},
+{ .is_ngc = FALSE,
+  .id = 3061,
+  .ra = 183.768,
+  .dec = 14.0288,
+},
+{ .is_ngc = FALSE,
+  .id = 3062,
+  .ra = 183.772,
+  .dec = 13.5944,
+},
+{ .is_ngc = FALSE,
+  .id = 3063,
+  .ra = 183.778,
+  .dec = 12.0163,
+},
+{ .is_ngc = FALSE,
+  .id = 3065,
+  .ra = 183.802,
+  .dec = 14.433,
+},
+{ .is_ngc = FALSE,
+  .id = 3066,
+  .ra = 183.818,
+  .dec = 13.4739,
+},
+{ .is_ngc = FALSE,
+  .id = 3068,
+  .ra = 183.848,
+  .dec = 11.5106,
+},
+{ .is_ngc = FALSE,
+  .id = 3069,
+  .ra = 183.832,
+  .dec = 10.1606,
+},
+{ .is_ngc = FALSE,
+  .id = 3070,
+  .ra = 183.853,
+  .dec = 13.0392,
+},
+{ .is_ngc = FALSE,
+  .id = 3071,
+  .ra = 183.882,
+  .dec = 9.54592,
+},
+{ .is_ngc = FALSE,
+  .id = 3072,
+  .ra = 183.909,
+  .dec = 9.55653,
+},
+{ .is_ngc = FALSE,
+  .id = 3073,
+  .ra = 183.899,
+  .dec = 13.6193,
+},
+{ .is_ngc = FALSE,
+  .id = 3074,
+  .ra = 183.942,
+  .dec = 10.6983,
+},
+{ .is_ngc = FALSE,
+  .id = 3075,
+  .ra = 183.979,
+  .dec = 23.5955,
+},
+{ .is_ngc = FALSE,
+  .id = 3076,
+  .ra = 184.016,
+  .dec = 9.07986,
+},
+{ .is_ngc = FALSE,
+  .id = 3077,
+  .ra = 183.985,
+  .dec = 14.4328,
+},
+{ .is_ngc = FALSE,
+  .id = 3078,
+  .ra = 184,
+  .dec = 12.6872,
+},
+{ .is_ngc = FALSE,
+  .id = 3079,
+  .ra = 184.017,
+  .dec = 11.5342,
+},
+{ .is_ngc = FALSE,
+  .id = 3080,
+  .ra = 184.011,
+  .dec = 14.1892,
+},
+{ .is_ngc = FALSE,
+  .id = 3081,
+  .ra = 184.037,
+  .dec = 12.6908,
+},
+{ .is_ngc = FALSE,
+  .id = 3082,
+  .ra = 184.05,
+  .dec = 23.8416,
+},
+{ .is_ngc = FALSE,
+  .id = 3083,
+  .ra = 184.088,
+  .dec = 12.5273,
+},
+{ .is_ngc = FALSE,
+  .id = 3084,
+  .ra = 184.098,
+  .dec = 23.9176,
+},
+{ .is_ngc = FALSE,
+  .id = 3085,
+  .ra = 184.108,
+  .dec = 9.46931,
+},
+{ .is_ngc = FALSE,
+  .id = 3086,
+  .ra = 184.116,
+  .dec = 9.00861,
+},
+{ .is_ngc = FALSE,
+  .id = 3087,
+  .ra = 184.11,
+  .dec = 13.2878,
+},
+{ .is_ngc = FALSE,
+  .id = 3088,
+  .ra = 184.118,
+  .dec = 9.45975,
+},
+{ .is_ngc = FALSE,
+  .id = 3089,
+  .ra = 184.124,
+  .dec = 23.8276,
+},
+{ .is_ngc = FALSE,
+  .id = 3090,
+  .ra = 184.132,
+  .dec = 9.43944,
+},
+{ .is_ngc = FALSE,
+  .id = 3091,
+  .ra = 184.122,
+  .dec = 14.0119,
+},
+{ .is_ngc = FALSE,
+  .id = 3092,
+  .ra = 184.135,
+  .dec = 10.0461,
+},
+{ .is_ngc = FALSE,
+  .id = 3093,
+  .ra = 184.176,
+  .dec = 14.2776,
+},
+{ .is_ngc = FALSE,
+  .id = 3094,
+  .ra = 184.233,
+  .dec = 13.6253,
+},
+{ .is_ngc = FALSE,
+  .id = 3095,
+  .ra = 184.231,
+  .dec = 23.9585,
+},
+{ .is_ngc = FALSE,
+  .id = 3096,
+  .ra = 184.218,
+  .dec = 14.515,
+},
+{ .is_ngc = FALSE,
+  .id = 3097,
+  .ra = 184.254,
+  .dec = 9.4075,
+},
+{ .is_ngc = FALSE,
+  .id = 3099,
+  .ra = 184.289,
+  .dec = 12.4534,
+},
+{ .is_ngc = FALSE,
+  .id = 3100,
+  .ra = 184.273,
+  .dec = 12.2891,
+},
+{ .is_ngc = FALSE,
+  .id = 3101,
+  .ra = 184.331,
+  .dec = 11.9431,
+},
+{ .is_ngc = FALSE,
+  .id = 3103,
+  .ra = 184.368,
+  .dec = 9.36036,
+},
+{ .is_ngc = FALSE,
+  .id = 3104,
+  .ra = 184.69,
+  .dec = -79.7265,
+},
+{ .is_ngc = FALSE,
+  .id = 3105,
+  .ra = 184.39,
+  .dec = 12.3871,
+},
+{ .is_ngc = FALSE,
+  .id = 3106,
+  .ra = 184.441,
+  .dec = 9.61358,
+},
+{ .is_ngc = FALSE,
+  .id = 3107,
+  .ra = 184.446,
+  .dec = 10.8445,
+},
+{ .is_ngc = FALSE,
+  .id = 3108,
+  .ra = 184.428,
+  .dec = 13.3796,
+},
+{ .is_ngc = FALSE,
+  .id = 3109,
+  .ra = 184.433,
+  .dec = 13.1706,
+},
+{ .is_ngc = FALSE,
+  .id = 3110,
+  .ra = 184.437,
+  .dec = 37.3999,
+},
+{ .is_ngc = FALSE,
+  .id = 3111,
+  .ra = 184.462,
+  .dec = 8.43042,
+},
+{ .is_ngc = FALSE,
+  .id = 3112,
+  .ra = 184.452,
+  .dec = 26.0302,
+},
+{ .is_ngc = FALSE,
+  .id = 3114,
+  .ra = 184.486,
+  .dec = 9.13561,
+},
+{ .is_ngc = FALSE,
+  .id = 3116,
+  .ra = 184.488,
+  .dec = 25.0753,
+},
+{ .is_ngc = FALSE,
+  .id = 3117,
+  .ra = 184.52,
+  .dec = 9.07639,
+},
+{ .is_ngc = FALSE,
+  .id = 3118,
+  .ra = 184.546,
+  .dec = 9.49994,
+},
+{ .is_ngc = FALSE,
+  .id = 3119,
+  .ra = 184.535,
+  .dec = 24.6882,
+},
+{ .is_ngc = FALSE,
+  .id = 3120,
+  .ra = 184.565,
+  .dec = 13.7469,
+},
+{ .is_ngc = FALSE,
+  .id = 3121,
+  .ra = 184.573,
+  .dec = 13.2575,
+},
+{ .is_ngc = FALSE,
+  .id = 3122,
+  .ra = 184.589,
+  .dec = 25.2168,
+},
+{ .is_ngc = FALSE,
+  .id = 3123,
+  .ra = 184.615,
+  .dec = 8.06394,
+},
+{ .is_ngc = FALSE,
+  .id = 3124,
+  .ra = 184.614,
+  .dec = 9.58844,
+},
+{ .is_ngc = FALSE,
+  .id = 3125,
+  .ra = 184.606,
+  .dec = 24.3656,
+},
+{ .is_ngc = FALSE,
+  .id = 3126,
+  .ra = 184.655,
+  .dec = 13.8138,
+},
+{ .is_ngc = FALSE,
+  .id = 3127,
+  .ra = 184.645,
+  .dec = 11.87,
+},
+{ .is_ngc = FALSE,
+  .id = 3128,
+  .ra = 184.675,
+  .dec = 11.7306,
+},
+{ .is_ngc = FALSE,
+  .id = 3129,
+  .ra = 184.686,
+  .dec = 9.59169,
+},
+{ .is_ngc = FALSE,
+  .id = 3130,
+  .ra = 184.707,
+  .dec = 8.23306,
+},
+{ .is_ngc = FALSE,
+  .id = 3131,
+  .ra = 184.711,
+  .dec = 7.86194,
+},
+{ .is_ngc = FALSE,
+  .id = 3132,
+  .ra = 184.714,
+  .dec = 7.86194,
+},
+{ .is_ngc = FALSE,
+  .id = 3133,
+  .ra = 184.728,
+  .dec = 7.63944,
+},
+{ .is_ngc = FALSE,
+  .id = 3134,
+  .ra = 184.734,
+  .dec = 8.96188,
+},
+{ .is_ngc = FALSE,
+  .id = 3135,
+  .ra = 184.718,
+  .dec = 27.4936,
+},
+{ .is_ngc = FALSE,
+  .id = 3136,
+  .ra = 184.739,
+  .dec = 6.18414,
+},
+{ .is_ngc = FALSE,
+  .id = 3137,
+  .ra = 184.728,
+  .dec = 12.4695,
+},
+{ .is_ngc = FALSE,
+  .id = 3139,
+  .ra = 184.753,
+  .dec = 9.127,
+},
+{ .is_ngc = FALSE,
+  .id = 3140,
+  .ra = 184.741,
+  .dec = 27.1298,
+},
+{ .is_ngc = FALSE,
+  .id = 3141,
+  .ra = 184.744,
+  .dec = 24.1856,
+},
+{ .is_ngc = FALSE,
+  .id = 3142,
+  .ra = 184.771,
+  .dec = 13.9806,
+},
+{ .is_ngc = FALSE,
+  .id = 3143,
+  .ra = 184.772,
+  .dec = 27.2978,
+},
+{ .is_ngc = FALSE,
+  .id = 3144,
+  .ra = 184.791,
+  .dec = 25.297,
+},
+{ .is_ngc = FALSE,
+  .id = 3145,
+  .ra = 184.794,
+  .dec = 24.2936,
+},
+{ .is_ngc = FALSE,
+  .id = 3146,
+  .ra = 184.802,
+  .dec = 25.7139,
+},
+{ .is_ngc = FALSE,
+  .id = 3147,
+  .ra = 184.825,
+  .dec = 12.0169,
+},
+{ .is_ngc = FALSE,
+  .id = 3147,
+  .ra = 184.821,
+  .dec = 12.0162,
+},
+{ .is_ngc = FALSE,
+  .id = 3148,
+  .ra = 184.841,
+  .dec = 7.87025,
+},
+{ .is_ngc = FALSE,
+  .id = 3149,
+  .ra = 184.85,
+  .dec = 12.3006,
+},
+{ .is_ngc = FALSE,
+  .id = 3150,
+  .ra = 184.87,
+  .dec = 7.79791,
+},
+{ .is_ngc = FALSE,
+  .id = 3151,
+  .ra = 184.887,
+  .dec = 9.41483,
+},
+{ .is_ngc = FALSE,
+  .id = 3152,
+  .ra = 184.9,
+  .dec = -26.1453,
+},
+{ .is_ngc = FALSE,
+  .id = 3153,
+  .ra = 184.904,
+  .dec = 5.39778,
+},
+{ .is_ngc = FALSE,
+  .id = 3154,
+  .ra = 184.892,
+  .dec = 25.5858,
+},
+{ .is_ngc = FALSE,
+  .id = 3155,
+  .ra = 184.939,
+  .dec = 6.00643,
+},
+{ .is_ngc = FALSE,
+  .id = 3156,
+  .ra = 184.934,
+  .dec = 9.14833,
+},
+{ .is_ngc = FALSE,
+  .id = 3157,
+  .ra = 184.949,
+  .dec = 12.4211,
+},
+{ .is_ngc = FALSE,
+  .id = 3158,
+  .ra = 184.953,
+  .dec = 9.29167,
+},
+{ .is_ngc = FALSE,
+  .id = 3158,
+  .ra = 184.958,
+  .dec = 9.28958,
+},
+{ .is_ngc = FALSE,
+  .id = 3158,
+  .ra = 184.957,
+  .dec = 9.30194,
+},
+{ .is_ngc = FALSE,
+  .id = 3159,
+  .ra = 184.971,
+  .dec = 11.6743,
+},
+{ .is_ngc = FALSE,
+  .id = 3160,
+  .ra = 185,
+  .dec = 9.10144,
+},
+{ .is_ngc = FALSE,
+  .id = 3161,
+  .ra = 185.005,
+  .dec = 8.99897,
+},
+{ .is_ngc = FALSE,
+  .id = 3162,
+  .ra = 185.013,
+  .dec = 8.99708,
+},
+{ .is_ngc = FALSE,
+  .id = 3163,
+  .ra = 185.015,
+  .dec = 9.25667,
+},
+{ .is_ngc = FALSE,
+  .id = 3163,
+  .ra = 185.024,
+  .dec = 9.25556,
+},
+{ .is_ngc = FALSE,
+  .id = 3164,
+  .ra = 185.02,
+  .dec = 24.9558,
+},
+{ .is_ngc = FALSE,
+  .id = 3165,
+  .ra = 185.02,
+  .dec = 27.9749,
+},
+{ .is_ngc = FALSE,
+  .id = 3166,
+  .ra = 184.975,
+  .dec = 60.6853,
+},
+{ .is_ngc = FALSE,
+  .id = 3167,
+  .ra = 185.078,
+  .dec = 9.545,
+},
+{ .is_ngc = FALSE,
+  .id = 3168,
+  .ra = 185.077,
+  .dec = 27.9198,
+},
+{ .is_ngc = FALSE,
+  .id = 3169,
+  .ra = 185.089,
+  .dec = 25.5996,
+},
+{ .is_ngc = FALSE,
+  .id = 3170,
+  .ra = 185.111,
+  .dec = 9.42389,
+},
+{ .is_ngc = FALSE,
+  .id = 3171,
+  .ra = 185.1,
+  .dec = 25.5603,
+},
+{ .is_ngc = FALSE,
+  .id = 3172,
+  .ra = 185.102,
+  .dec = 27.8183,
+},
+{ .is_ngc = FALSE,
+  .id = 3173,
+  .ra = 185.126,
+  .dec = 11.3407,
+},
+{ .is_ngc = FALSE,
+  .id = 3174,
+  .ra = 185.123,
+  .dec = 10.2452,
+},
+{ .is_ngc = FALSE,
+  .id = 3175,
+  .ra = 185.139,
+  .dec = 9.8535,
+},
+{ .is_ngc = FALSE,
+  .id = 3176,
+  .ra = 185.125,
+  .dec = 25.5144,
+},
+{ .is_ngc = FALSE,
+  .id = 3177,
+  .ra = 185.142,
+  .dec = 14.1186,
+},
+{ .is_ngc = FALSE,
+  .id = 3178,
+  .ra = 185.146,
+  .dec = 26.1696,
+},
+{ .is_ngc = FALSE,
+  .id = 3179,
+  .ra = 185.157,
+  .dec = 26.1651,
+},
+{ .is_ngc = FALSE,
+  .id = 3180,
+  .ra = 185.096,
+  .dec = 60.6853,
+},
+{ .is_ngc = FALSE,
+  .id = 3182,
+  .ra = 185.2,
+  .dec = 12.7286,
+},
+{ .is_ngc = FALSE,
+  .id = 3183,
+  .ra = 185.204,
+  .dec = 6.68631,
+},
+{ .is_ngc = FALSE,
+  .id = 3184,
+  .ra = 185.195,
+  .dec = 24.9154,
+},
+{ .is_ngc = FALSE,
+  .id = 3185,
+  .ra = 185.219,
+  .dec = 25.4286,
+},
+{ .is_ngc = FALSE,
+  .id = 3186,
+  .ra = 185.233,
+  .dec = 24.6683,
+},
+{ .is_ngc = FALSE,
+  .id = 3187,
+  .ra = 185.228,
+  .dec = 11.1611,
+},
+{ .is_ngc = FALSE,
+  .id = 3188,
+  .ra = 185.229,
+  .dec = 11.0086,
+},
+{ .is_ngc = FALSE,
+  .id = 3189,
+  .ra = 185.234,
+  .dec = 25.4256,
+},
+{ .is_ngc = FALSE,
+  .id = 3190,
+  .ra = 185.26,
+  .dec = 9.56975,
+},
+{ .is_ngc = FALSE,
+  .id = 3191,
+  .ra = 185.272,
+  .dec = 7.70461,
+},
+{ .is_ngc = FALSE,
+  .id = 3192,
+  .ra = 185.27,
+  .dec = 11.7539,
+},
+{ .is_ngc = FALSE,
+  .id = 3193,
+  .ra = 185.255,
+  .dec = 27.8983,
+},
+{ .is_ngc = FALSE,
+  .id = 3194,
+  .ra = 185.288,
+  .dec = 25.1328,
+},
+{ .is_ngc = FALSE,
+  .id = 3195,
+  .ra = 185.323,
+  .dec = 25.8072,
+},
+{ .is_ngc = FALSE,
+  .id = 3196,
+  .ra = 185.361,
+  .dec = 11.7575,
+},
+{ .is_ngc = FALSE,
+  .id = 3197,
+  .ra = 185.358,
+  .dec = 25.4443,
+},
+{ .is_ngc = FALSE,
+  .id = 3198,
+  .ra = 185.38,
+  .dec = 26.3661,
+},
+{ .is_ngc = FALSE,
+  .id = 3199,
+  .ra = 185.44,
+  .dec = 10.5955,
+},
+{ .is_ngc = FALSE,
+  .id = 3200,
+  .ra = 185.405,
+  .dec = 26.76,
+},
+{ .is_ngc = FALSE,
+  .id = 3201,
+  .ra = 185.418,
+  .dec = 25.7256,
+},
+{ .is_ngc = FALSE,
+  .id = 3202,
+  .ra = 185.435,
+  .dec = 27.0571,
+},
+{ .is_ngc = FALSE,
+  .id = 3203,
+  .ra = 185.441,
+  .dec = 25.8841,
+},
+{ .is_ngc = FALSE,
+  .id = 3204,
+  .ra = 185.46,
+  .dec = 24.2481,
+},
+{ .is_ngc = FALSE,
+  .id = 3205,
+  .ra = 185.462,
+  .dec = 26.3411,
+},
+{ .is_ngc = FALSE,
+  .id = 3206,
+  .ra = 185.464,
+  .dec = 26.3639,
+},
+{ .is_ngc = FALSE,
+  .id = 3207,
+  .ra = 185.469,
+  .dec = 24.3536,
+},
+{ .is_ngc = FALSE,
+  .id = 3208,
+  .ra = 185.482,
+  .dec = 11.9669,
+},
+{ .is_ngc = FALSE,
+  .id = 3209,
+  .ra = 185.526,
+  .dec = 11.7549,
+},
+{ .is_ngc = FALSE,
+  .id = 3210,
+  .ra = 185.504,
+  .dec = 28.4306,
+},
+{ .is_ngc = FALSE,
+  .id = 3212,
+  .ra = 185.514,
+  .dec = 28.1856,
+},
+{ .is_ngc = FALSE,
+  .id = 3213,
+  .ra = 185.532,
+  .dec = 23.8689,
+},
+{ .is_ngc = FALSE,
+  .id = 3214,
+  .ra = 185.538,
+  .dec = 27.2357,
+},
+{ .is_ngc = FALSE,
+  .id = 3215,
+  .ra = 185.543,
+  .dec = 26.0504,
+},
+{ .is_ngc = FALSE,
+  .id = 3216,
+  .ra = 185.549,
+  .dec = 25.2858,
+},
+{ .is_ngc = FALSE,
+  .id = 3217,
+  .ra = 185.555,
+  .dec = 26.3867,
+},
+{ .is_ngc = FALSE,
+  .id = 3218,
+  .ra = 185.582,
+  .dec = 6.93111,
+},
+{ .is_ngc = FALSE,
+  .id = 3219,
+  .ra = 185.562,
+  .dec = 25.9503,
+},
+{ .is_ngc = FALSE,
+  .id = 3220,
+  .ra = 185.59,
+  .dec = 10.6006,
+},
+{ .is_ngc = FALSE,
+  .id = 3221,
+  .ra = 185.584,
+  .dec = 25.2825,
+},
+{ .is_ngc = FALSE,
+  .id = 3222,
+  .ra = 185.581,
+  .dec = 28.8309,
+},
+{ .is_ngc = FALSE,
+  .id = 3223,
+  .ra = 185.627,
+  .dec = 9.48722,
+},
+{ .is_ngc = FALSE,
+  .id = 3223,
+  .ra = 185.622,
+  .dec = 9.49089,
+},
+{ .is_ngc = FALSE,
+  .id = 3224,
+  .ra = 185.648,
+  .dec = 12.1581,
+},
+{ .is_ngc = FALSE,
+  .id = 3225,
+  .ra = 185.663,
+  .dec = 6.67683,
+},
+{ .is_ngc = FALSE,
+  .id = 3226,
+  .ra = 185.646,
+  .dec = 26.0673,
+},
+{ .is_ngc = FALSE,
+  .id = 3227,
+  .ra = 185.649,
+  .dec = 24.0851,
+},
+{ .is_ngc = FALSE,
+  .id = 3228,
+  .ra = 185.664,
+  .dec = 24.3292,
+},
+{ .is_ngc = FALSE,
+  .id = 3229,
+  .ra = 185.72,
+  .dec = 6.67947,
+},
+{ .is_ngc = FALSE,
+  .id = 3230,
+  .ra = 185.665,
+  .dec = 27.7467,
+},
+{ .is_ngc = FALSE,
+  .id = 3231,
+  .ra = 185.682,
+  .dec = 24.8197,
+},
+{ .is_ngc = FALSE,
+  .id = 3232,
+  .ra = 185.699,
+  .dec = 24.4254,
+},
+{ .is_ngc = FALSE,
+  .id = 3233,
+  .ra = 185.729,
+  .dec = 12.5664,
+},
+{ .is_ngc = FALSE,
+  .id = 3234,
+  .ra = 185.717,
+  .dec = 28.1119,
+},
+{ .is_ngc = FALSE,
+  .id = 3235,
+  .ra = 185.741,
+  .dec = 13.5459,
+},
+{ .is_ngc = FALSE,
+  .id = 3237,
+  .ra = 185.742,
+  .dec = 28.4931,
+},
+{ .is_ngc = FALSE,
+  .id = 3238,
+  .ra = 185.776,
+  .dec = 14.4581,
+},
+{ .is_ngc = FALSE,
+  .id = 3239,
+  .ra = 185.79,
+  .dec = 11.7262,
+},
+{ .is_ngc = FALSE,
+  .id = 3240,
+  .ra = 185.78,
+  .dec = 10.3624,
+},
+{ .is_ngc = FALSE,
+  .id = 3241,
+  .ra = 185.785,
+  .dec = 26.9052,
+},
+{ .is_ngc = FALSE,
+  .id = 3242,
+  .ra = 185.793,
+  .dec = 26.2486,
+},
+{ .is_ngc = FALSE,
+  .id = 3243,
+  .ra = 185.797,
+  .dec = 27.765,
+},
+{ .is_ngc = FALSE,
+  .id = 3244,
+  .ra = 185.801,
+  .dec = 14.3881,
+},
+{ .is_ngc = FALSE,
+  .id = 3245,
+  .ra = 185.821,
+  .dec = 9.11889,
+},
+{ .is_ngc = FALSE,
+  .id = 3246,
+  .ra = 185.821,
+  .dec = 13.052,
+},
+{ .is_ngc = FALSE,
+  .id = 3247,
+  .ra = 185.808,
+  .dec = 28.8929,
+},
+{ .is_ngc = FALSE,
+  .id = 3248,
+  .ra = 185.82,
+  .dec = 25.5517,
+},
+{ .is_ngc = FALSE,
+  .id = 3249,
+  .ra = 185.824,
+  .dec = 25.444,
+},
+{ .is_ngc = FALSE,
+  .id = 3250,
+  .ra = 185.824,
+  .dec = 25.6284,
+},
+{ .is_ngc = FALSE,
+  .id = 3251,
+  .ra = 185.829,
+  .dec = 25.6529,
+},
+{ .is_ngc = FALSE,
+  .id = 3252,
+  .ra = 185.854,
+  .dec = 28.6181,
+},
+{ .is_ngc = FALSE,
+  .id = 3253,
+  .ra = 185.938,
+  .dec = -34.6219,
+},
+{ .is_ngc = FALSE,
+  .id = 3255,
+  .ra = 185.895,
+  .dec = 9.64861,
+},
+{ .is_ngc = FALSE,
+  .id = 3257,
+  .ra = 185.936,
+  .dec = 7.25361,
+},
+{ .is_ngc = FALSE,
+  .id = 3258,
+  .ra = 185.935,
+  .dec = 12.4782,
+},
+{ .is_ngc = FALSE,
+  .id = 3259,
+  .ra = 185.953,
+  .dec = 7.18664,
+},
+{ .is_ngc = FALSE,
+  .id = 3261,
+  .ra = 185.969,
+  .dec = 11.4809,
+},
+{ .is_ngc = FALSE,
+  .id = 3261,
+  .ra = 185.977,
+  .dec = 11.4909,
+},
+{ .is_ngc = FALSE,
+  .id = 3262,
+  .ra = 185.951,
+  .dec = 27.3939,
+},
+{ .is_ngc = FALSE,
+  .id = 3263,
+  .ra = 185.961,
+  .dec = 28.1991,
+},
+{ .is_ngc = FALSE,
+  .id = 3264,
+  .ra = 185.966,
+  .dec = 25.5561,
+},
+{ .is_ngc = FALSE,
+  .id = 3265,
+  .ra = 185.995,
+  .dec = 7.80367,
+},
+{ .is_ngc = FALSE,
+  .id = 3267,
+  .ra = 186.023,
+  .dec = 7.04111,
+},
+{ .is_ngc = FALSE,
+  .id = 3268,
+  .ra = 186.031,
+  .dec = 6.60717,
+},
+{ .is_ngc = FALSE,
+  .id = 3269,
+  .ra = 186.018,
+  .dec = 27.4336,
+},
+{ .is_ngc = FALSE,
+  .id = 3270,
+  .ra = 186.024,
+  .dec = 27.5767,
+},
+{ .is_ngc = FALSE,
+  .id = 3271,
+  .ra = 186.058,
+  .dec = 7.95289,
+},
+{ .is_ngc = FALSE,
+  .id = 3272,
+  .ra = 186.039,
+  .dec = 23.2847,
+},
+{ .is_ngc = FALSE,
+  .id = 3275,
+  .ra = 186.081,
+  .dec = 10.4463,
+},
+{ .is_ngc = FALSE,
+  .id = 3276,
+  .ra = 186.058,
+  .dec = 25.8175,
+},
+{ .is_ngc = FALSE,
+  .id = 3277,
+  .ra = 186.065,
+  .dec = 25.5628,
+},
+{ .is_ngc = FALSE,
+  .id = 3278,
+  .ra = 186.062,
+  .dec = 27.4214,
+},
+{ .is_ngc = FALSE,
+  .id = 3279,
+  .ra = 186.098,
+  .dec = 12.8522,
+},
+{ .is_ngc = FALSE,
+  .id = 3280,
+  .ra = 186.111,
+  .dec = 13.2332,
+},
+{ .is_ngc = FALSE,
+  .id = 3281,
+  .ra = 186.116,
+  .dec = 7.81889,
+},
+{ .is_ngc = FALSE,
+  .id = 3281,
+  .ra = 186.101,
+  .dec = 7.84472,
+},
+{ .is_ngc = FALSE,
+  .id = 3282,
+  .ra = 186.116,
+  .dec = 25.67,
+},
+{ .is_ngc = FALSE,
+  .id = 3283,
+  .ra = 186.117,
+  .dec = 27.2108,
+},
+{ .is_ngc = FALSE,
+  .id = 3284,
+  .ra = 186.156,
+  .dec = 10.8381,
+},
+{ .is_ngc = FALSE,
+  .id = 3285,
+  .ra = 186.139,
+  .dec = 24.86,
+},
+{ .is_ngc = FALSE,
+  .id = 3286,
+  .ra = 186.144,
+  .dec = 23.7469,
+},
+{ .is_ngc = FALSE,
+  .id = 3287,
+  .ra = 186.154,
+  .dec = 24.5936,
+},
+{ .is_ngc = FALSE,
+  .id = 3288,
+  .ra = 186.164,
+  .dec = 24.9483,
+},
+{ .is_ngc = FALSE,
+  .id = 3289,
+  .ra = 186.238,
+  .dec = -26.0303,
+},
+{ .is_ngc = FALSE,
+  .id = 3290,
+  .ra = 186.288,
+  .dec = -39.7756,
+},
+{ .is_ngc = FALSE,
+  .id = 3291,
+  .ra = 186.202,
+  .dec = 12.0185,
+},
+{ .is_ngc = FALSE,
+  .id = 3292,
+  .ra = 186.202,
+  .dec = 18.195,
+},
+{ .is_ngc = FALSE,
+  .id = 3293,
+  .ra = 186.223,
+  .dec = 17.4322,
+},
+{ .is_ngc = FALSE,
+  .id = 3294,
+  .ra = 186.207,
+  .dec = 25.5956,
+},
+{ .is_ngc = FALSE,
+  .id = 3295,
+  .ra = 186.204,
+  .dec = 28.7078,
+},
+{ .is_ngc = FALSE,
+  .id = 3296,
+  .ra = 186.241,
+  .dec = 24.3822,
+},
+{ .is_ngc = FALSE,
+  .id = 3297,
+  .ra = 186.242,
+  .dec = 26.7714,
+},
+{ .is_ngc = FALSE,
+  .id = 3297,
+  .ra = 186.262,
+  .dec = 26.7642,
+},
+{ .is_ngc = FALSE,
+  .id = 3298,
+  .ra = 186.266,
+  .dec = 17.015,
+},
+{ .is_ngc = FALSE,
+  .id = 3299,
+  .ra = 186.263,
+  .dec = 27.3744,
+},
+{ .is_ngc = FALSE,
+  .id = 3300,
+  .ra = 186.27,
+  .dec = 25.9571,
+},
+{ .is_ngc = FALSE,
+  .id = 3302,
+  .ra = 186.293,
+  .dec = 25.8778,
+},
+{ .is_ngc = FALSE,
+  .id = 3303,
+  .ra = 186.313,
+  .dec = 12.7144,
+},
+{ .is_ngc = FALSE,
+  .id = 3304,
+  .ra = 186.299,
+  .dec = 25.4228,
+},
+{ .is_ngc = FALSE,
+  .id = 3305,
+  .ra = 186.31,
+  .dec = 11.8493,
+},
+{ .is_ngc = FALSE,
+  .id = 3306,
+  .ra = 186.302,
+  .dec = 27.4019,
+},
+{ .is_ngc = FALSE,
+  .id = 3308,
+  .ra = 186.325,
+  .dec = 26.715,
+},
+{ .is_ngc = FALSE,
+  .id = 3309,
+  .ra = 186.334,
+  .dec = 28.3808,
+},
+{ .is_ngc = FALSE,
+  .id = 3310,
+  .ra = 186.48,
+  .dec = 15.6805,
+},
+{ .is_ngc = FALSE,
+  .id = 3311,
+  .ra = 186.388,
+  .dec = 12.26,
+},
+{ .is_ngc = FALSE,
+  .id = 3312,
+  .ra = 186.374,
+  .dec = 23.5806,
+},
+{ .is_ngc = FALSE,
+  .id = 3313,
+  .ra = 186.405,
+  .dec = 15.8319,
+},
+{ .is_ngc = FALSE,
+  .id = 3314,
+  .ra = 186.381,
+  .dec = 23.591,
+},
+{ .is_ngc = FALSE,
+  .id = 3315,
+  .ra = 186.412,
+  .dec = 12.3139,
+},
+{ .is_ngc = FALSE,
+  .id = 3316,
+  .ra = 186.4,
+  .dec = 26.1619,
+},
+{ .is_ngc = FALSE,
+  .id = 3317,
+  .ra = 186.412,
+  .dec = 25.3425,
+},
+{ .is_ngc = FALSE,
+  .id = 3318,
+  .ra = 186.457,
+  .dec = 9.763,
+},
+{ .is_ngc = FALSE,
+  .id = 3319,
+  .ra = 186.462,
+  .dec = 10.3908,
+},
+{ .is_ngc = FALSE,
+  .id = 3321,
+  .ra = 186.442,
+  .dec = 26.0811,
+},
+{ .is_ngc = FALSE,
+  .id = 3322,
+  .ra = 186.476,
+  .dec = 7.55433,
+},
+{ .is_ngc = FALSE,
+  .id = 3323,
+  .ra = 186.45,
+  .dec = 27.543,
+},
+{ .is_ngc = FALSE,
+  .id = 3324,
+  .ra = 186.454,
+  .dec = 26.7395,
+},
+{ .is_ngc = FALSE,
+  .id = 3325,
+  .ra = 186.464,
+  .dec = 23.895,
+},
+{ .is_ngc = FALSE,
+  .id = 3326,
+  .ra = 186.47,
+  .dec = 23.7675,
+},
+{ .is_ngc = FALSE,
+  .id = 3327,
+  .ra = 186.512,
+  .dec = 14.8803,
+},
+{ .is_ngc = FALSE,
+  .id = 3328,
+  .ra = 186.491,
+  .dec = 10.0533,
+},
+{ .is_ngc = FALSE,
+  .id = 3329,
+  .ra = 186.483,
+  .dec = 27.5645,
+},
+{ .is_ngc = FALSE,
+  .id = 3330,
+  .ra = 186.485,
+  .dec = 30.8432,
+},
+{ .is_ngc = FALSE,
+  .id = 3331,
+  .ra = 186.522,
+  .dec = 11.812,
+},
+{ .is_ngc = FALSE,
+  .id = 3332,
+  .ra = 186.521,
+  .dec = 25.2786,
+},
+{ .is_ngc = FALSE,
+  .id = 3333,
+  .ra = 186.537,
+  .dec = 13.1325,
+},
+{ .is_ngc = FALSE,
+  .id = 3334,
+  .ra = 186.54,
+  .dec = 28.465,
+},
+{ .is_ngc = FALSE,
+  .id = 3335,
+  .ra = 186.58,
+  .dec = 26.1286,
+},
+{ .is_ngc = FALSE,
+  .id = 3336,
+  .ra = 186.583,
+  .dec = 26.8381,
+},
+{ .is_ngc = FALSE,
+  .id = 3337,
+  .ra = 186.589,
+  .dec = 25.31,
+},
+{ .is_ngc = FALSE,
+  .id = 3338,
+  .ra = 186.592,
+  .dec = 25.885,
+},
+{ .is_ngc = FALSE,
+  .id = 3340,
+  .ra = 186.636,
+  .dec = 16.8443,
+},
+{ .is_ngc = FALSE,
+  .id = 3341,
+  .ra = 186.597,
+  .dec = 27.7453,
+},
+{ .is_ngc = FALSE,
+  .id = 3342,
+  .ra = 186.613,
+  .dec = 27.1391,
+},
+{ .is_ngc = FALSE,
+  .id = 3343,
+  .ra = 186.646,
+  .dec = 8.87428,
+},
+{ .is_ngc = FALSE,
+  .id = 3344,
+  .ra = 186.635,
+  .dec = 13.5787,
+},
+{ .is_ngc = FALSE,
+  .id = 3345,
+  .ra = 186.639,
+  .dec = 24.3681,
+},
+{ .is_ngc = FALSE,
+  .id = 3346,
+  .ra = 186.685,
+  .dec = 11.3798,
+},
+{ .is_ngc = FALSE,
+  .id = 3347,
+  .ra = 186.685,
+  .dec = 10.9187,
+},
+{ .is_ngc = FALSE,
+  .id = 3348,
+  .ra = 186.658,
+  .dec = 25.6233,
+},
+{ .is_ngc = FALSE,
+  .id = 3349,
+  .ra = 186.696,
+  .dec = 12.4531,
+},
+{ .is_ngc = FALSE,
+  .id = 3350,
+  .ra = 186.694,
+  .dec = 9.44236,
+},
+{ .is_ngc = FALSE,
+  .id = 3351,
+  .ra = 186.671,
+  .dec = 27.6061,
+},
+{ .is_ngc = FALSE,
+  .id = 3352,
+  .ra = 186.699,
+  .dec = 8.7575,
+},
+{ .is_ngc = FALSE,
+  .id = 3352,
+  .ra = 186.674,
+  .dec = 8.74167,
+},
+{ .is_ngc = FALSE,
+  .id = 3353,
+  .ra = 186.687,
+  .dec = 27.9119,
+},
+{ .is_ngc = FALSE,
+  .id = 3354,
+  .ra = 186.715,
+  .dec = 12.0967,
+},
+{ .is_ngc = FALSE,
+  .id = 3355,
+  .ra = 186.713,
+  .dec = 13.1762,
+},
+{ .is_ngc = FALSE,
+  .id = 3356,
+  .ra = 186.712,
+  .dec = 11.5581,
+},
+{ .is_ngc = FALSE,
+  .id = 3357,
+  .ra = 186.714,
+  .dec = 9.77694,
+},
+{ .is_ngc = FALSE,
+  .id = 3358,
+  .ra = 186.726,
+  .dec = 11.6645,
+},
+{ .is_ngc = FALSE,
+  .id = 3359,
+  .ra = 186.714,
+  .dec = 23.4981,
+},
+{ .is_ngc = FALSE,
+  .id = 3360,
+  .ra = 186.712,
+  .dec = 26.0465,
+},
+{ .is_ngc = FALSE,
+  .id = 3361,
+  .ra = 186.742,
+  .dec = 10.6356,
+},
+{ .is_ngc = FALSE,
+  .id = 3361,
+  .ra = 186.727,
+  .dec = 10.6655,
+},
+{ .is_ngc = FALSE,
+  .id = 3362,
+  .ra = 186.727,
+  .dec = 26.69,
+},
+{ .is_ngc = FALSE,
+  .id = 3363,
+  .ra = 186.762,
+  .dec = 12.56,
+},
+{ .is_ngc = FALSE,
+  .id = 3364,
+  .ra = 186.769,
+  .dec = 25.5632,
+},
+{ .is_ngc = FALSE,
+  .id = 3365,
+  .ra = 186.798,
+  .dec = 15.8972,
+},
+{ .is_ngc = FALSE,
+  .id = 3366,
+  .ra = 186.8,
+  .dec = 9.41019,
+},
+{ .is_ngc = FALSE,
+  .id = 3367,
+  .ra = 186.792,
+  .dec = 26.9575,
+},
+{ .is_ngc = FALSE,
+  .id = 3368,
+  .ra = 186.835,
+  .dec = 16.4276,
+},
+{ .is_ngc = FALSE,
+  .id = 3369,
+  .ra = 186.82,
+  .dec = 16.0244,
+},
+{ .is_ngc = FALSE,
+  .id = 3370,
+  .ra = 186.905,
+  .dec = -39.3381,
+},
+{ .is_ngc = FALSE,
+  .id = 3371,
+  .ra = 186.843,
+  .dec = 10.8663,
+},
+{ .is_ngc = FALSE,
+  .id = 3372,
+  .ra = 186.851,
+  .dec = 25.2872,
+},
+{ .is_ngc = FALSE,
+  .id = 3373,
+  .ra = 186.865,
+  .dec = 25.4522,
+},
+{ .is_ngc = FALSE,
+  .id = 3374,
+  .ra = 186.887,
+  .dec = 10.0022,
+},
+{ .is_ngc = FALSE,
+  .id = 3375,
+  .ra = 186.918,
+  .dec = 27.3653,
+},
+{ .is_ngc = FALSE,
+  .id = 3376,
+  .ra = 186.96,
+  .dec = 26.9935,
+},
+{ .is_ngc = FALSE,
+  .id = 3377,
+  .ra = 186.966,
+  .dec = 24.9421,
+},
+{ .is_ngc = FALSE,
+  .id = 3378,
+  .ra = 187.006,
+  .dec = 17.2961,
+},
+{ .is_ngc = FALSE,
+  .id = 3379,
+  .ra = 187.018,
+  .dec = 17.306,
+},
+{ .is_ngc = FALSE,
+  .id = 3380,
+  .ra = 187.023,
+  .dec = 26.6727,
+},
+{ .is_ngc = FALSE,
+  .id = 3381,
+  .ra = 187.062,
+  .dec = 11.7893,
+},
+{ .is_ngc = FALSE,
+  .id = 3382,
+  .ra = 187.057,
+  .dec = 13.5704,
+},
+{ .is_ngc = FALSE,
+  .id = 3383,
+  .ra = 187.052,
+  .dec = 10.2975,
+},
+{ .is_ngc = FALSE,
+  .id = 3384,
+  .ra = 187.052,
+  .dec = 25.0889,
+},
+{ .is_ngc = FALSE,
+  .id = 3385,
+  .ra = 187.063,
+  .dec = 25.4311,
+},
+{ .is_ngc = FALSE,
+  .id = 3386,
+  .ra = 187.099,
+  .dec = 13.1954,
+},
+{ .is_ngc = FALSE,
+  .id = 3387,
+  .ra = 187.078,
+  .dec = 27.9956,
+},
+{ .is_ngc = FALSE,
+  .id = 3388,
+  .ra = 187.117,
+  .dec = 12.8235,
+},
+{ .is_ngc = FALSE,
+  .id = 3389,
+  .ra = 187.098,
+  .dec = 27.8442,
+},
+{ .is_ngc = FALSE,
+  .id = 3390,
+  .ra = 187.12,
+  .dec = 24.8081,
+},
+{ .is_ngc = FALSE,
+  .id = 3391,
+  .ra = 187.114,
+  .dec = 18.4152,
+},
+{ .is_ngc = FALSE,
+  .id = 3392,
+  .ra = 187.18,
+  .dec = 14.999,
+},
+{ .is_ngc = FALSE,
+  .id = 3393,
+  .ra = 187.174,
+  .dec = 12.9158,
+},
+{ .is_ngc = FALSE,
+  .id = 3394,
+  .ra = 187.172,
+  .dec = 26.7987,
+},
+{ .is_ngc = FALSE,
+  .id = 3395,
+  .ra = 187.186,
+  .dec = 25.0342,
+},
+{ .is_ngc = FALSE,
+  .id = 3396,
+  .ra = 187.188,
+  .dec = 25.0489,
+},
+{ .is_ngc = FALSE,
+  .id = 3397,
+  .ra = 187.194,
+  .dec = 25.7312,
+},
+{ .is_ngc = FALSE,
+  .id = 3398,
+  .ra = 187.242,
+  .dec = 13.5649,
+},
+{ .is_ngc = FALSE,
+  .id = 3399,
+  .ra = 187.234,
+  .dec = 25.6953,
+},
+{ .is_ngc = FALSE,
+  .id = 3400,
+  .ra = 187.262,
+  .dec = 9.4065,
+},
+{ .is_ngc = FALSE,
+  .id = 3401,
+  .ra = 187.245,
+  .dec = 26.46,
+},
+{ .is_ngc = FALSE,
+  .id = 3402,
+  .ra = 187.247,
+  .dec = 28.8618,
+},
+{ .is_ngc = FALSE,
+  .id = 3403,
+  .ra = 187.257,
+  .dec = 24.6319,
+},
+{ .is_ngc = FALSE,
+  .id = 3404,
+  .ra = 187.295,
+  .dec = 7.15389,
+},
+{ .is_ngc = FALSE,
+  .id = 3405,
+  .ra = 187.248,
+  .dec = 37.73,
+},
+{ .is_ngc = FALSE,
+  .id = 3406,
+  .ra = 187.261,
+  .dec = 27.6403,
+},
+{ .is_ngc = FALSE,
+  .id = 3407,
+  .ra = 187.266,
+  .dec = 27.7786,
+},
+{ .is_ngc = FALSE,
+  .id = 3408,
+  .ra = 187.316,
+  .dec = 11.8755,
+},
+{ .is_ngc = FALSE,
+  .id = 3409,
+  .ra = 187.338,
+  .dec = 14.7886,
+},
+{ .is_ngc = FALSE,
+  .id = 3410,
+  .ra = 187.276,
+  .dec = 19.0046,
+},
+{ .is_ngc = FALSE,
+  .id = 3411,
+  .ra = 187.302,
+  .dec = 24.5831,
+},
+{ .is_ngc = FALSE,
+  .id = 3412,
+  .ra = 187.344,
+  .dec = 9.98722,
+},
+{ .is_ngc = FALSE,
+  .id = 3413,
+  .ra = 187.345,
+  .dec = 11.4329,
+},
+{ .is_ngc = FALSE,
+  .id = 3414,
+  .ra = 187.371,
+  .dec = 6.77014,
+},
+{ .is_ngc = FALSE,
+  .id = 3415,
+  .ra = 187.341,
+  .dec = 26.7668,
+},
+{ .is_ngc = FALSE,
+  .id = 3416,
+  .ra = 187.396,
+  .dec = 10.7931,
+},
+{ .is_ngc = FALSE,
+  .id = 3417,
+  .ra = 187.413,
+  .dec = 7.86192,
+},
+{ .is_ngc = FALSE,
+  .id = 3418,
+  .ra = 187.433,
+  .dec = 11.4035,
+},
+{ .is_ngc = FALSE,
+  .id = 3419,
+  .ra = 187.436,
+  .dec = 15.0242,
+},
+{ .is_ngc = FALSE,
+  .id = 3420,
+  .ra = 187.428,
+  .dec = 13.4461,
+},
+{ .is_ngc = FALSE,
+  .id = 3421,
+  .ra = 187.411,
+  .dec = 26.2308,
+},
+{ .is_ngc = FALSE,
+  .id = 3422,
+  .ra = 187.477,
+  .dec = 14.6881,
+},
+{ .is_ngc = FALSE,
+  .id = 3423,
+  .ra = 187.444,
+  .dec = 13.6594,
+},
+{ .is_ngc = FALSE,
+  .id = 3424,
+  .ra = 187.437,
+  .dec = 24.4075,
+},
+{ .is_ngc = FALSE,
+  .id = 3425,
+  .ra = 187.485,
+  .dec = 10.6151,
+},
+{ .is_ngc = FALSE,
+  .id = 3426,
+  .ra = 187.506,
+  .dec = 13.598,
+},
+{ .is_ngc = FALSE,
+  .id = 3428,
+  .ra = 187.531,
+  .dec = 23.6752,
+},
+{ .is_ngc = FALSE,
+  .id = 3429,
+  .ra = 187.533,
+  .dec = 23.5447,
+},
+{ .is_ngc = FALSE,
+  .id = 3430,
+  .ra = 187.571,
+  .dec = 9.08456,
+},
+{ .is_ngc = FALSE,
+  .id = 3431,
+  .ra = 187.6,
+  .dec = 11.6146,
+},
+{ .is_ngc = FALSE,
+  .id = 3432,
+  .ra = 187.615,
+  .dec = 14.1599,
+},
+{ .is_ngc = FALSE,
+  .id = 3433,
+  .ra = 187.618,
+  .dec = 17.3092,
+},
+{ .is_ngc = FALSE,
+  .id = 3434,
+  .ra = 187.613,
+  .dec = 18.8089,
+},
+{ .is_ngc = FALSE,
+  .id = 3435,
+  .ra = 187.667,
+  .dec = 15.1289,
+},
+{ .is_ngc = FALSE,
+  .id = 3436,
+  .ra = 187.625,
+  .dec = 19.6727,
+},
+{ .is_ngc = FALSE,
+  .id = 3437,
+  .ra = 187.691,
+  .dec = 11.3419,
+},
+{ .is_ngc = FALSE,
+  .id = 3439,
+  .ra = 187.748,
+  .dec = 25.5606,
+},
+{ .is_ngc = FALSE,
+  .id = 3440,
+  .ra = 187.771,
+  .dec = 12.0299,
+},
+{ .is_ngc = FALSE,
+  .id = 3441,
+  .ra = 187.768,
+  .dec = 28.8528,
+},
+{ .is_ngc = FALSE,
+  .id = 3442,
+  .ra = 187.834,
+  .dec = 14.1144,
+},
+{ .is_ngc = FALSE,
+  .id = 3443,
+  .ra = 187.815,
+  .dec = 12.3318,
+},
+{ .is_ngc = FALSE,
+  .id = 3444,
+  .ra = 187.808,
+  .dec = 27.5498,
+},
+{ .is_ngc = FALSE,
+  .id = 3445,
+  .ra = 187.83,
+  .dec = 12.7384,
+},
+{ .is_ngc = FALSE,
+  .id = 3446,
+  .ra = 187.846,
+  .dec = 11.4921,
+},
+{ .is_ngc = FALSE,
+  .id = 3447,
+  .ra = 187.824,
+  .dec = 10.6801,
+},
+{ .is_ngc = FALSE,
+  .id = 3448,
+  .ra = 187.846,
+  .dec = 17.2058,
+},
+{ .is_ngc = FALSE,
+  .id = 3449,
+  .ra = 187.846,
+  .dec = 25.9138,
+},
+{ .is_ngc = FALSE,
+  .id = 3450,
+  .ra = 187.854,
+  .dec = 26.7956,
+},
+{ .is_ngc = FALSE,
+  .id = 3451,
+  .ra = 187.85,
+  .dec = 28.8551,
+},
+{ .is_ngc = FALSE,
+  .id = 3453,
+  .ra = 187.907,
+  .dec = 14.8604,
+},
+{ .is_ngc = FALSE,
+  .id = 3454,
+  .ra = 187.912,
+  .dec = 27.4961,
+},
+{ .is_ngc = FALSE,
+  .id = 3455,
+  .ra = 187.936,
+  .dec = 25.7844,
+},
+{ .is_ngc = FALSE,
+  .id = 3456,
+  .ra = 187.932,
+  .dec = 28.3569,
+},
+{ .is_ngc = FALSE,
+  .id = 3457,
+  .ra = 187.964,
+  .dec = 12.657,
+},
+{ .is_ngc = FALSE,
+  .id = 3458,
+  .ra = 187.933,
+  .dec = 28.1464,
+},
+{ .is_ngc = FALSE,
+  .id = 3459,
+  .ra = 187.983,
+  .dec = 12.1741,
+},
+{ .is_ngc = FALSE,
+  .id = 3460,
+  .ra = 187.96,
+  .dec = 27.3864,
+},
+{ .is_ngc = FALSE,
+  .id = 3461,
+  .ra = 188.011,
+  .dec = 11.8897,
+},
+{ .is_ngc = FALSE,
+  .id = 3462,
+  .ra = 188.04,
+  .dec = 15.3008,
+},
+{ .is_ngc = FALSE,
+  .id = 3463,
+  .ra = 188.02,
+  .dec = 12.3192,
+},
+{ .is_ngc = FALSE,
+  .id = 3464,
+  .ra = 188.002,
+  .dec = 26.005,
+},
+{ .is_ngc = FALSE,
+  .id = 3465,
+  .ra = 188.051,
+  .dec = 12.0611,
+},
+{ .is_ngc = FALSE,
+  .id = 3466,
+  .ra = 188.023,
+  .dec = 11.8169,
+},
+{ .is_ngc = FALSE,
+  .id = 3467,
+  .ra = 188.102,
+  .dec = 11.7869,
+},
+{ .is_ngc = FALSE,
+  .id = 3468,
+  .ra = 188.059,
+  .dec = 10.2513,
+},
+{ .is_ngc = FALSE,
+  .id = 3469,
+  .ra = 188.046,
+  .dec = 25.8029,
+},
+{ .is_ngc = FALSE,
+  .id = 3470,
+  .ra = 188.097,
+  .dec = 11.2628,
+},
+{ .is_ngc = FALSE,
+  .id = 3471,
+  .ra = 188.093,
+  .dec = 16.0192,
+},
+{ .is_ngc = FALSE,
+  .id = 3472,
+  .ra = 188.078,
+  .dec = 24.7272,
+},
+{ .is_ngc = FALSE,
+  .id = 3473,
+  .ra = 188.08,
+  .dec = 18.2445,
+},
+{ .is_ngc = FALSE,
+  .id = 3474,
+  .ra = 188.153,
+  .dec = 2.66169,
+},
+{ .is_ngc = FALSE,
+  .id = 3475,
+  .ra = 188.17,
+  .dec = 12.7708,
+},
+{ .is_ngc = FALSE,
+  .id = 3476,
+  .ra = 188.175,
+  .dec = 14.0499,
+},
+{ .is_ngc = FALSE,
+  .id = 3477,
+  .ra = 188.159,
+  .dec = 26.0378,
+},
+{ .is_ngc = FALSE,
+  .id = 3478,
+  .ra = 188.184,
+  .dec = 14.1959,
+},
+{ .is_ngc = FALSE,
+  .id = 3479,
+  .ra = 188.171,
+  .dec = 25.4053,
+},
+{ .is_ngc = FALSE,
+  .id = 3480,
+  .ra = 188.172,
+  .dec = 26.8289,
+},
+{ .is_ngc = FALSE,
+  .id = 3481,
+  .ra = 188.218,
+  .dec = 11.4043,
+},
+{ .is_ngc = FALSE,
+  .id = 3482,
+  .ra = 188.254,
+  .dec = 27.8297,
+},
+{ .is_ngc = FALSE,
+  .id = 3483,
+  .ra = 188.292,
+  .dec = 11.3471,
+},
+{ .is_ngc = FALSE,
+  .id = 3484,
+  .ra = 188.272,
+  .dec = 17.4031,
+},
+{ .is_ngc = FALSE,
+  .id = 3485,
+  .ra = 188.297,
+  .dec = 9.21797,
+},
+{ .is_ngc = FALSE,
+  .id = 3486,
+  .ra = 188.308,
+  .dec = 12.8572,
+},
+{ .is_ngc = FALSE,
+  .id = 3487,
+  .ra = 188.306,
+  .dec = 9.39756,
+},
+{ .is_ngc = FALSE,
+  .id = 3488,
+  .ra = 188.286,
+  .dec = 26.3494,
+},
+{ .is_ngc = FALSE,
+  .id = 3489,
+  .ra = 188.307,
+  .dec = 12.2467,
+},
+{ .is_ngc = FALSE,
+  .id = 3490,
+  .ra = 188.308,
+  .dec = 10.9281,
+},
+{ .is_ngc = FALSE,
+  .id = 3491,
+  .ra = 188.287,
+  .dec = 27.0939,
+},
+{ .is_ngc = FALSE,
+  .id = 3492,
+  .ra = 188.332,
+  .dec = 12.8534,
+},
+{ .is_ngc = FALSE,
+  .id = 3493,
+  .ra = 188.328,
+  .dec = 9.39344,
+},
+{ .is_ngc = FALSE,
+  .id = 3494,
+  .ra = 188.308,
+  .dec = 27.584,
+},
+{ .is_ngc = FALSE,
+  .id = 3495,
+  .ra = 188.318,
+  .dec = 26.8096,
+},
+{ .is_ngc = FALSE,
+  .id = 3496,
+  .ra = 188.329,
+  .dec = 26.7558,
+},
+{ .is_ngc = FALSE,
+  .id = 3497,
+  .ra = 188.369,
+  .dec = 25.4887,
+},
+{ .is_ngc = FALSE,
+  .id = 3498,
+  .ra = 188.37,
+  .dec = 26.7381,
+},
+{ .is_ngc = FALSE,
+  .id = 3499,
+  .ra = 188.438,
+  .dec = 10.9954,
+},
+{ .is_ngc = FALSE,
+  .id = 3500,
+  .ra = 188.456,
+  .dec = 13.9625,
+},
+{ .is_ngc = FALSE,
+  .id = 3501,
+  .ra = 188.465,
+  .dec = 13.3222,
+},
+{ .is_ngc = FALSE,
+  .id = 3502,
+  .ra = 188.428,
+  .dec = 26.6125,
+},
+{ .is_ngc = FALSE,
+  .id = 3503,
+  .ra = 188.451,
+  .dec = 37.7887,
+},
+{ .is_ngc = FALSE,
+  .id = 3504,
+  .ra = 188.533,
+  .dec = 6.88628,
+},
+{ .is_ngc = FALSE,
+  .id = 3505,
+  .ra = 188.543,
+  .dec = 15.9678,
+},
+{ .is_ngc = FALSE,
+  .id = 3506,
+  .ra = 188.528,
+  .dec = 12.7419,
+},
+{ .is_ngc = FALSE,
+  .id = 3507,
+  .ra = 188.518,
+  .dec = 25.3628,
+},
+{ .is_ngc = FALSE,
+  .id = 3508,
+  .ra = 188.529,
+  .dec = 26.6708,
+},
+{ .is_ngc = FALSE,
+  .id = 3509,
+  .ra = 188.548,
+  .dec = 12.0493,
+},
+{ .is_ngc = FALSE,
+  .id = 3510,
+  .ra = 188.562,
+  .dec = 11.0713,
+},
+{ .is_ngc = FALSE,
+  .id = 3511,
+  .ra = 188.54,
+  .dec = 27.3479,
+},
+{ .is_ngc = FALSE,
+  .id = 3512,
+  .ra = 188.54,
+  .dec = 27.3614,
+},
+{ .is_ngc = FALSE,
+  .id = 3513,
+  .ra = 188.549,
+  .dec = 27.3303,
+},
+{ .is_ngc = FALSE,
+  .id = 3514,
+  .ra = 188.566,
+  .dec = 26.7008,
+},
+{ .is_ngc = FALSE,
+  .id = 3515,
+  .ra = 188.567,
+  .dec = 27.8611,
+},
+{ .is_ngc = FALSE,
+  .id = 3516,
+  .ra = 188.572,
+  .dec = 27.4518,
+},
+{ .is_ngc = FALSE,
+  .id = 3517,
+  .ra = 188.628,
+  .dec = 9.15517,
+},
+{ .is_ngc = FALSE,
+  .id = 3518,
+  .ra = 188.63,
+  .dec = 9.62294,
+},
+{ .is_ngc = FALSE,
+  .id = 3519,
+  .ra = 188.662,
+  .dec = 15.6036,
+},
+{ .is_ngc = FALSE,
+  .id = 3520,
+  .ra = 188.632,
+  .dec = 13.5034,
+},
+{ .is_ngc = FALSE,
+  .id = 3521,
+  .ra = 188.665,
+  .dec = 7.16003,
+},
+{ .is_ngc = FALSE,
+  .id = 3522,
+  .ra = 188.691,
+  .dec = 15.2207,
+},
+{ .is_ngc = FALSE,
+  .id = 3523,
+  .ra = 188.664,
+  .dec = 14.0161,
+},
+{ .is_ngc = FALSE,
+  .id = 3524,
+  .ra = 188.679,
+  .dec = 14.2443,
+},
+{ .is_ngc = FALSE,
+  .id = 3525,
+  .ra = 188.694,
+  .dec = 10.1758,
+},
+{ .is_ngc = FALSE,
+  .id = 3526,
+  .ra = 188.669,
+  .dec = 25.6839,
+},
+{ .is_ngc = FALSE,
+  .id = 3527,
+  .ra = 188.676,
+  .dec = 26.1539,
+},
+{ .is_ngc = FALSE,
+  .id = 3528,
+  .ra = 188.733,
+  .dec = 15.5662,
+},
+{ .is_ngc = FALSE,
+  .id = 3529,
+  .ra = 188.707,
+  .dec = 25.6983,
+},
+{ .is_ngc = FALSE,
+  .id = 3530,
+  .ra = 188.706,
+  .dec = 17.8139,
+},
+{ .is_ngc = FALSE,
+  .id = 3531,
+  .ra = 188.736,
+  .dec = 26.6261,
+},
+{ .is_ngc = FALSE,
+  .id = 3532,
+  .ra = 188.74,
+  .dec = 25.8801,
+},
+{ .is_ngc = FALSE,
+  .id = 3533,
+  .ra = 188.755,
+  .dec = 25.7797,
+},
+{ .is_ngc = FALSE,
+  .id = 3534,
+  .ra = 188.717,
+  .dec = 14.9779,
+},
+{ .is_ngc = FALSE,
+  .id = 3535,
+  .ra = 188.795,
+  .dec = 25.732,
+},
+{ .is_ngc = FALSE,
+  .id = 3536,
+  .ra = 188.802,
+  .dec = 26.5331,
+},
+{ .is_ngc = FALSE,
+  .id = 3537,
+  .ra = 188.843,
+  .dec = 7.65331,
+},
+{ .is_ngc = FALSE,
+  .id = 3538,
+  .ra = 188.815,
+  .dec = 26.235,
+},
+{ .is_ngc = FALSE,
+  .id = 3539,
+  .ra = 188.834,
+  .dec = 23.9829,
+},
+{ .is_ngc = FALSE,
+  .id = 3540,
+  .ra = 188.864,
+  .dec = 12.7501,
+},
+{ .is_ngc = FALSE,
+  .id = 3541,
+  .ra = 188.84,
+  .dec = 23.9754,
+},
+{ .is_ngc = FALSE,
+  .id = 3542,
+  .ra = 188.923,
+  .dec = 11.6667,
+},
+{ .is_ngc = FALSE,
+  .id = 3544,
+  .ra = 188.948,
+  .dec = 14.3006,
+},
+{ .is_ngc = FALSE,
+  .id = 3547,
+  .ra = 188.954,
+  .dec = 26.3293,
+},
+{ .is_ngc = FALSE,
+  .id = 3548,
+  .ra = 188.986,
+  .dec = 10.9353,
+},
+{ .is_ngc = FALSE,
+  .id = 3549,
+  .ra = 188.962,
+  .dec = 26.3952,
+},
+{ .is_ngc = FALSE,
+  .id = 3551,
+  .ra = 188.974,
+  .dec = 27.9638,
+},
+{ .is_ngc = FALSE,
+  .id = 3552,
+  .ra = 188.975,
+  .dec = 27.9935,
+},
+{ .is_ngc = FALSE,
+  .id = 3553,
+  .ra = 188.983,
+  .dec = 26.1929,
+},
+{ .is_ngc = FALSE,
+  .id = 3554,
+  .ra = 188.98,
+  .dec = 27.9273,
+},
+{ .is_ngc = FALSE,
+  .id = 3555,
+  .ra = 188.984,
+  .dec = 27.9896,
+},
+{ .is_ngc = FALSE,
+  .id = 3556,
+  .ra = 188.994,
+  .dec = 26.9655,
+},
+{ .is_ngc = FALSE,
+  .id = 3557,
+  .ra = 189.033,
+  .dec = 16.6418,
+},
+{ .is_ngc = FALSE,
+  .id = 3558,
+  .ra = 189.012,
+  .dec = 11.8509,
+},
+{ .is_ngc = FALSE,
+  .id = 3559,
+  .ra = 189.014,
+  .dec = 26.9864,
+},
+{ .is_ngc = FALSE,
+  .id = 3560,
+  .ra = 189.017,
+  .dec = 27.0778,
+},
+{ .is_ngc = FALSE,
+  .id = 3561,
+  .ra = 189.02,
+  .dec = 26.8994,
+},
+{ .is_ngc = FALSE,
+  .id = 3562,
+  .ra = 189.044,
+  .dec = 9.92258,
+},
+{ .is_ngc = FALSE,
+  .id = 3563,
+  .ra = 189.03,
+  .dec = 27.9265,
+},
+{ .is_ngc = FALSE,
+  .id = 3564,
+  .ra = 189.033,
+  .dec = 27.9279,
+},
+{ .is_ngc = FALSE,
+  .id = 3565,
+  .ra = 189.052,
+  .dec = 26.7556,
+},
+{ .is_ngc = FALSE,
+  .id = 3566,
+  .ra = 189.088,
+  .dec = 11.1525,
+},
+{ .is_ngc = FALSE,
+  .id = 3567,
+  .ra = 189.094,
+  .dec = 13.6033,
+},
+{ .is_ngc = FALSE,
+  .id = 3568,
+  .ra = 188.279,
+  .dec = 82.5636,
+},
+{ .is_ngc = FALSE,
+  .id = 3570,
+  .ra = 189.076,
+  .dec = 24.0782,
+},
+{ .is_ngc = FALSE,
+  .id = 3571,
+  .ra = 189.084,
+  .dec = 26.0831,
+},
+{ .is_ngc = FALSE,
+  .id = 3572,
+  .ra = 189.117,
+  .dec = 11.6183,
+},
+{ .is_ngc = FALSE,
+  .id = 3573,
+  .ra = 189.114,
+  .dec = 11.7595,
+},
+{ .is_ngc = FALSE,
+  .id = 3574,
+  .ra = 189.116,
+  .dec = 12.405,
+},
+{ .is_ngc = FALSE,
+  .id = 3575,
+  .ra = 189.135,
+  .dec = 13.749,
+},
+{ .is_ngc = FALSE,
+  .id = 3576,
+  .ra = 189.157,
+  .dec = 6.62106,
+},
+{ .is_ngc = FALSE,
+  .id = 3577,
+  .ra = 189.151,
+  .dec = 11.8969,
+},
+{ .is_ngc = FALSE,
+  .id = 3578,
+  .ra = 189.165,
+  .dec = 11.1013,
+},
+{ .is_ngc = FALSE,
+  .id = 3579,
+  .ra = 189.137,
+  .dec = 26.1039,
+},
+{ .is_ngc = FALSE,
+  .id = 3580,
+  .ra = 189.122,
+  .dec = 18.2999,
+},
+{ .is_ngc = FALSE,
+  .id = 3581,
+  .ra = 189.158,
+  .dec = 24.4284,
+},
+{ .is_ngc = FALSE,
+  .id = 3582,
+  .ra = 189.153,
+  .dec = 26.2352,
+},
+{ .is_ngc = FALSE,
+  .id = 3583,
+  .ra = 189.182,
+  .dec = 13.2581,
+},
+{ .is_ngc = FALSE,
+  .id = 3584,
+  .ra = 189.188,
+  .dec = 12.2326,
+},
+{ .is_ngc = FALSE,
+  .id = 3585,
+  .ra = 189.167,
+  .dec = 26.8296,
+},
+{ .is_ngc = FALSE,
+  .id = 3586,
+  .ra = 189.229,
+  .dec = 12.5197,
+},
+{ .is_ngc = FALSE,
+  .id = 3587,
+  .ra = 189.201,
+  .dec = 27.5487,
+},
+{ .is_ngc = FALSE,
+  .id = 3589,
+  .ra = 189.255,
+  .dec = 6.93694,
+},
+{ .is_ngc = FALSE,
+  .id = 3590,
+  .ra = 189.211,
+  .dec = 27.2778,
+},
+{ .is_ngc = FALSE,
+  .id = 3591,
+  .ra = 189.262,
+  .dec = 6.927,
+},
+{ .is_ngc = FALSE,
+  .id = 3594,
+  .ra = 189.235,
+  .dec = 26.1154,
+},
+{ .is_ngc = FALSE,
+  .id = 3595,
+  .ra = 189.276,
+  .dec = 23.7861,
+},
+{ .is_ngc = FALSE,
+  .id = 3596,
+  .ra = 189.329,
+  .dec = 26.5208,
+},
+{ .is_ngc = FALSE,
+  .id = 3597,
+  .ra = 189.352,
+  .dec = 23.8628,
+},
+{ .is_ngc = FALSE,
+  .id = 3598,
+  .ra = 189.338,
+  .dec = 28.2079,
+},
+{ .is_ngc = FALSE,
+  .id = 3599,
+  .ra = 189.422,
+  .dec = 26.7073,
+},
+{ .is_ngc = FALSE,
+  .id = 3600,
+  .ra = 189.421,
+  .dec = 27.1288,
+},
+{ .is_ngc = FALSE,
+  .id = 3601,
+  .ra = 189.474,
+  .dec = 15.2246,
+},
+{ .is_ngc = FALSE,
+  .id = 3602,
+  .ra = 189.576,
+  .dec = 10.0732,
+},
+{ .is_ngc = FALSE,
+  .id = 3602,
+  .ra = 189.528,
+  .dec = 10.082,
+},
+{ .is_ngc = FALSE,
+  .id = 3603,
+  .ra = 189.567,
+  .dec = 15.57,
+},
+{ .is_ngc = FALSE,
+  .id = 3604,
+  .ra = 189.586,
+  .dec = 11.7304,
+},
+{ .is_ngc = FALSE,
+  .id = 3605,
+  .ra = 189.587,
+  .dec = 19.5411,
+},
+{ .is_ngc = FALSE,
+  .id = 3606,
+  .ra = 189.605,
+  .dec = 12.6109,
+},
+{ .is_ngc = FALSE,
+  .id = 3607,
+  .ra = 189.634,
+  .dec = 10.3763,
+},
+{ .is_ngc = FALSE,
+  .id = 3608,
+  .ra = 189.656,
+  .dec = 10.4754,
+},
+{ .is_ngc = FALSE,
+  .id = 3609,
+  .ra = 189.644,
+  .dec = 14.3526,
+},
+{ .is_ngc = FALSE,
+  .id = 3610,
+  .ra = 189.693,
+  .dec = 26.8728,
+},
+{ .is_ngc = FALSE,
+  .id = 3611,
+  .ra = 189.767,
+  .dec = 13.3634,
+},
+{ .is_ngc = FALSE,
+  .id = 3613,
+  .ra = 189.77,
+  .dec = 13.7585,
+},
+{ .is_ngc = FALSE,
+  .id = 3614,
+  .ra = 189.756,
+  .dec = 26.3003,
+},
+{ .is_ngc = FALSE,
+  .id = 3615,
+  .ra = 189.757,
+  .dec = 18.2004,
+},
+{ .is_ngc = FALSE,
+  .id = 3617,
+  .ra = 189.854,
+  .dec = 7.96519,
+},
+{ .is_ngc = FALSE,
+  .id = 3618,
+  .ra = 189.822,
+  .dec = 26.6777,
+},
+{ .is_ngc = FALSE,
+  .id = 3619,
+  .ra = 189.828,
+  .dec = 24.1422,
+},
+{ .is_ngc = FALSE,
+  .id = 3620,
+  .ra = 189.825,
+  .dec = 27.9086,
+},
+{ .is_ngc = FALSE,
+  .id = 3621,
+  .ra = 189.89,
+  .dec = 15.5027,
+},
+{ .is_ngc = FALSE,
+  .id = 3622,
+  .ra = 189.885,
+  .dec = 15.4319,
+},
+{ .is_ngc = FALSE,
+  .id = 3623,
+  .ra = 189.865,
+  .dec = 27.1024,
+},
+{ .is_ngc = FALSE,
+  .id = 3624,
+  .ra = 189.894,
+  .dec = 11.9819,
+},
+{ .is_ngc = FALSE,
+  .id = 3625,
+  .ra = 189.889,
+  .dec = 10.9676,
+},
+{ .is_ngc = FALSE,
+  .id = 3626,
+  .ra = 189.882,
+  .dec = 25.6764,
+},
+{ .is_ngc = FALSE,
+  .id = 3627,
+  .ra = 189.883,
+  .dec = 27.4974,
+},
+{ .is_ngc = FALSE,
+  .id = 3628,
+  .ra = 189.912,
+  .dec = 26.239,
+},
+{ .is_ngc = FALSE,
+  .id = 3629,
+  .ra = 189.945,
+  .dec = 13.5325,
+},
+{ .is_ngc = FALSE,
+  .id = 3630,
+  .ra = 189.944,
+  .dec = 25.4327,
+},
+{ .is_ngc = FALSE,
+  .id = 3631,
+  .ra = 189.95,
+  .dec = 12.9738,
+},
+{ .is_ngc = FALSE,
+  .id = 3632,
+  .ra = 189.999,
+  .dec = 26.6821,
+},
+{ .is_ngc = FALSE,
+  .id = 3633,
+  .ra = 190.046,
+  .dec = 9.89596,
+},
+{ .is_ngc = FALSE,
+  .id = 3634,
+  .ra = 190.047,
+  .dec = 9.84711,
+},
+{ .is_ngc = FALSE,
+  .id = 3635,
+  .ra = 190.056,
+  .dec = 12.8743,
+},
+{ .is_ngc = FALSE,
+  .id = 3636,
+  .ra = 190.064,
+  .dec = 22.0744,
+},
+{ .is_ngc = FALSE,
+  .id = 3637,
+  .ra = 190.081,
+  .dec = 14.7149,
+},
+{ .is_ngc = FALSE,
+  .id = 3638,
+  .ra = 190.069,
+  .dec = 10.5183,
+},
+{ .is_ngc = FALSE,
+  .id = 3639,
+  .ra = 190.221,
+  .dec = -36.7566,
+},
+{ .is_ngc = FALSE,
+  .id = 3640,
+  .ra = 190.105,
+  .dec = 26.5244,
+},
+{ .is_ngc = FALSE,
+  .id = 3641,
+  .ra = 190.112,
+  .dec = 26.5214,
+},
+{ .is_ngc = FALSE,
+  .id = 3642,
+  .ra = 190.108,
+  .dec = 26.7317,
+},
+{ .is_ngc = FALSE,
+  .id = 3643,
+  .ra = 190.17,
+  .dec = 12.4065,
+},
+{ .is_ngc = FALSE,
+  .id = 3644,
+  .ra = 190.15,
+  .dec = 26.5048,
+},
+{ .is_ngc = FALSE,
+  .id = 3645,
+  .ra = 190.156,
+  .dec = 26.541,
+},
+{ .is_ngc = FALSE,
+  .id = 3646,
+  .ra = 190.161,
+  .dec = 26.526,
+},
+{ .is_ngc = FALSE,
+  .id = 3647,
+  .ra = 190.221,
+  .dec = 10.4757,
+},
+{ .is_ngc = FALSE,
+  .id = 3648,
+  .ra = 190.217,
+  .dec = 12.985,
+},
+{ .is_ngc = FALSE,
+  .id = 3649,
+  .ra = 190.207,
+  .dec = 21.1036,
+},
+{ .is_ngc = FALSE,
+  .id = 3650,
+  .ra = 190.202,
+  .dec = 26.4728,
+},
+{ .is_ngc = FALSE,
+  .id = 3651,
+  .ra = 190.22,
+  .dec = 26.728,
+},
+{ .is_ngc = FALSE,
+  .id = 3652,
+  .ra = 190.244,
+  .dec = 11.1841,
+},
+{ .is_ngc = FALSE,
+  .id = 3653,
+  .ra = 190.315,
+  .dec = 11.3872,
+},
+{ .is_ngc = FALSE,
+  .id = 3654,
+  .ra = 190.302,
+  .dec = 22.5892,
+},
+{ .is_ngc = FALSE,
+  .id = 3655,
+  .ra = 190.31,
+  .dec = 20.6661,
+},
+{ .is_ngc = FALSE,
+  .id = 3656,
+  .ra = 190.308,
+  .dec = 22.5944,
+},
+{ .is_ngc = FALSE,
+  .id = 3657,
+  .ra = 190.329,
+  .dec = 21.6753,
+},
+{ .is_ngc = FALSE,
+  .id = 3658,
+  .ra = 190.336,
+  .dec = 14.7003,
+},
+{ .is_ngc = FALSE,
+  .id = 3659,
+  .ra = 190.365,
+  .dec = 22.93,
+},
+{ .is_ngc = FALSE,
+  .id = 3660,
+  .ra = 190.403,
+  .dec = 21.0929,
+},
+{ .is_ngc = FALSE,
+  .id = 3661,
+  .ra = 190.398,
+  .dec = 22.4942,
+},
+{ .is_ngc = FALSE,
+  .id = 3662,
+  .ra = 190.401,
+  .dec = 23.4247,
+},
+{ .is_ngc = FALSE,
+  .id = 3663,
+  .ra = 190.414,
+  .dec = 12.2473,
+},
+{ .is_ngc = FALSE,
+  .id = 3664,
+  .ra = 190.423,
+  .dec = 19.9443,
+},
+{ .is_ngc = FALSE,
+  .id = 3665,
+  .ra = 190.444,
+  .dec = 11.488,
+},
+{ .is_ngc = FALSE,
+  .id = 3666,
+  .ra = 190.472,
+  .dec = 7.84483,
+},
+{ .is_ngc = FALSE,
+  .id = 3668,
+  .ra = 190.388,
+  .dec = 41.1242,
+},
+{ .is_ngc = FALSE,
+  .id = 3669,
+  .ra = 190.4,
+  .dec = 41.1364,
+},
+{ .is_ngc = FALSE,
+  .id = 3670,
+  .ra = 190.479,
+  .dec = 11.7739,
+},
+{ .is_ngc = FALSE,
+  .id = 3671,
+  .ra = 190.464,
+  .dec = 23.5101,
+},
+{ .is_ngc = FALSE,
+  .id = 3672,
+  .ra = 190.536,
+  .dec = 11.7541,
+},
+{ .is_ngc = FALSE,
+  .id = 3673,
+  .ra = 190.518,
+  .dec = 21.1383,
+},
+{ .is_ngc = FALSE,
+  .id = 3674,
+  .ra = 190.522,
+  .dec = 22.5103,
+},
+{ .is_ngc = FALSE,
+  .id = 3676,
+  .ra = 190.551,
+  .dec = 13.5594,
+},
+{ .is_ngc = FALSE,
+  .id = 3677,
+  .ra = 190.549,
+  .dec = 20.885,
+},
+{ .is_ngc = FALSE,
+  .id = 3678,
+  .ra = 190.552,
+  .dec = 20.8801,
+},
+{ .is_ngc = FALSE,
+  .id = 3679,
+  .ra = 190.547,
+  .dec = 22.8178,
+},
+{ .is_ngc = FALSE,
+  .id = 3680,
+  .ra = 190.503,
+  .dec = 39.1049,
+},
+{ .is_ngc = FALSE,
+  .id = 3681,
+  .ra = 190.507,
+  .dec = 39.0838,
+},
+{ .is_ngc = FALSE,
+  .id = 3682,
+  .ra = 190.581,
+  .dec = 20.8646,
+},
+{ .is_ngc = FALSE,
+  .id = 3683,
+  .ra = 190.586,
+  .dec = 20.8714,
+},
+{ .is_ngc = FALSE,
+  .id = 3684,
+  .ra = 190.611,
+  .dec = 11.7397,
+},
+{ .is_ngc = FALSE,
+  .id = 3685,
+  .ra = 190.634,
+  .dec = 6.871,
+},
+{ .is_ngc = FALSE,
+  .id = 3686,
+  .ra = 190.65,
+  .dec = 10.5649,
+},
+{ .is_ngc = FALSE,
+  .id = 3687,
+  .ra = 190.563,
+  .dec = 38.5027,
+},
+{ .is_ngc = FALSE,
+  .id = 3689,
+  .ra = 190.654,
+  .dec = 20.8502,
+},
+{ .is_ngc = FALSE,
+  .id = 3690,
+  .ra = 190.705,
+  .dec = 10.3576,
+},
+{ .is_ngc = FALSE,
+  .id = 3691,
+  .ra = 190.705,
+  .dec = 22.7719,
+},
+{ .is_ngc = FALSE,
+  .id = 3692,
+  .ra = 190.725,
+  .dec = 20.9893,
+},
+{ .is_ngc = FALSE,
+  .id = 3693,
+  .ra = 190.742,
+  .dec = 10.6811,
+},
+{ .is_ngc = FALSE,
+  .id = 3694,
+  .ra = 190.78,
+  .dec = 11.2116,
+},
+{ .is_ngc = FALSE,
+  .id = 3695,
+  .ra = 190.778,
+  .dec = 22.7421,
+},
+{ .is_ngc = FALSE,
+  .id = 3696,
+  .ra = 190.788,
+  .dec = 19.9278,
+},
+{ .is_ngc = FALSE,
+  .id = 3697,
+  .ra = 190.745,
+  .dec = 39.8454,
+},
+{ .is_ngc = FALSE,
+  .id = 3698,
+  .ra = 190.822,
+  .dec = 11.2112,
+},
+{ .is_ngc = FALSE,
+  .id = 3699,
+  .ra = 190.821,
+  .dec = 19,
+},
+{ .is_ngc = FALSE,
+  .id = 3700,
+  .ra = 190.835,
+  .dec = 19.265,
+},
+{ .is_ngc = FALSE,
+  .id = 3701,
+  .ra = 190.879,
+  .dec = 11.0467,
+},
+{ .is_ngc = FALSE,
+  .id = 3702,
+  .ra = 190.868,
+  .dec = 10.8736,
+},
+{ .is_ngc = FALSE,
+  .id = 3703,
+  .ra = 190.842,
+  .dec = 37.9746,
+},
+{ .is_ngc = FALSE,
+  .id = 3704,
+  .ra = 190.94,
+  .dec = 10.7696,
+},
+{ .is_ngc = FALSE,
+  .id = 3705,
+  .ra = 190.923,
+  .dec = 19.3247,
+},
+{ .is_ngc = FALSE,
+  .id = 3706,
+  .ra = 190.95,
+  .dec = 9.22889,
+},
+{ .is_ngc = FALSE,
+  .id = 3707,
+  .ra = 190.869,
+  .dec = 37.9824,
+},
+{ .is_ngc = FALSE,
+  .id = 3708,
+  .ra = 190.969,
+  .dec = 13.1375,
+},
+{ .is_ngc = FALSE,
+  .id = 3709,
+  .ra = 191.017,
+  .dec = 9.06278,
+},
+{ .is_ngc = FALSE,
+  .id = 3710,
+  .ra = 191.04,
+  .dec = 12.1152,
+},
+{ .is_ngc = FALSE,
+  .id = 3711,
+  .ra = 191.04,
+  .dec = 11.1764,
+},
+{ .is_ngc = FALSE,
+  .id = 3712,
+  .ra = 191.069,
+  .dec = 10.3744,
+},
+{ .is_ngc = FALSE,
+  .id = 3713,
+  .ra = 191.013,
+  .dec = 41.1688,
+},
+{ .is_ngc = FALSE,
+  .id = 3714,
+  .ra = 191.095,
+  .dec = 10.1881,
+},
+{ .is_ngc = FALSE,
+  .id = 3715,
+  .ra = 191.089,
+  .dec = 20.0242,
+},
+{ .is_ngc = FALSE,
+  .id = 3716,
+  .ra = 191.188,
+  .dec = 8.10194,
+},
+{ .is_ngc = FALSE,
+  .id = 3717,
+  .ra = 191.096,
+  .dec = 39.5214,
+},
+{ .is_ngc = FALSE,
+  .id = 3718,
+  .ra = 191.189,
+  .dec = 12.3506,
+},
+{ .is_ngc = FALSE,
+  .id = 3719,
+  .ra = 191.199,
+  .dec = 8.1075,
+},
+{ .is_ngc = FALSE,
+  .id = 3720,
+  .ra = 191.198,
+  .dec = 12.0642,
+},
+{ .is_ngc = FALSE,
+  .id = 3722,
+  .ra = 191.212,
+  .dec = 11.7783,
+},
+{ .is_ngc = FALSE,
+  .id = 3723,
+  .ra = 191.127,
+  .dec = 40.7364,
+},
+{ .is_ngc = FALSE,
+  .id = 3724,
+  .ra = 191.223,
+  .dec = 10.2822,
+},
+{ .is_ngc = FALSE,
+  .id = 3726,
+  .ra = 191.178,
+  .dec = 40.6784,
+},
+{ .is_ngc = FALSE,
+  .id = 3727,
+  .ra = 191.273,
+  .dec = 10.9005,
+},
+{ .is_ngc = FALSE,
+  .id = 3728,
+  .ra = 191.263,
+  .dec = 20.9731,
+},
+{ .is_ngc = FALSE,
+  .id = 3729,
+  .ra = 191.221,
+  .dec = 39.3506,
+},
+{ .is_ngc = FALSE,
+  .id = 3730,
+  .ra = 191.278,
+  .dec = 21.1695,
+},
+{ .is_ngc = FALSE,
+  .id = 3731,
+  .ra = 191.272,
+  .dec = 12.4456,
+},
+{ .is_ngc = FALSE,
+  .id = 3732,
+  .ra = 191.299,
+  .dec = 10.3241,
+},
+{ .is_ngc = FALSE,
+  .id = 3733,
+  .ra = 191.32,
+  .dec = 6.95689,
+},
+{ .is_ngc = FALSE,
+  .id = 3734,
+  .ra = 191.288,
+  .dec = 23.0387,
+},
+{ .is_ngc = FALSE,
+  .id = 3735,
+  .ra = 191.335,
+  .dec = 13.6924,
+},
+{ .is_ngc = FALSE,
+  .id = 3736,
+  .ra = 191.328,
+  .dec = 21.535,
+},
+{ .is_ngc = FALSE,
+  .id = 3737,
+  .ra = 191.333,
+  .dec = 21.9581,
+},
+{ .is_ngc = FALSE,
+  .id = 3738,
+  .ra = 191.356,
+  .dec = 19.2283,
+},
+{ .is_ngc = FALSE,
+  .id = 3739,
+  .ra = 191.385,
+  .dec = 12.9972,
+},
+{ .is_ngc = FALSE,
+  .id = 3740,
+  .ra = 191.377,
+  .dec = 20.8157,
+},
+{ .is_ngc = FALSE,
+  .id = 3741,
+  .ra = 191.388,
+  .dec = 19.2037,
+},
+{ .is_ngc = FALSE,
+  .id = 3742,
+  .ra = 191.383,
+  .dec = 13.3318,
+},
+{ .is_ngc = FALSE,
+  .id = 3743,
+  .ra = 191.422,
+  .dec = 11.1008,
+},
+{ .is_ngc = FALSE,
+  .id = 3744,
+  .ra = 191.423,
+  .dec = 19.5003,
+},
+{ .is_ngc = FALSE,
+  .id = 3745,
+  .ra = 191.437,
+  .dec = 19.1771,
+},
+{ .is_ngc = FALSE,
+  .id = 3746,
+  .ra = 191.383,
+  .dec = 37.8233,
+},
+{ .is_ngc = FALSE,
+  .id = 3747,
+  .ra = 191.394,
+  .dec = 37.9685,
+},
+{ .is_ngc = FALSE,
+  .id = 3748,
+  .ra = 191.462,
+  .dec = 19.4297,
+},
+{ .is_ngc = FALSE,
+  .id = 3749,
+  .ra = 191.464,
+  .dec = 19.5359,
+},
+{ .is_ngc = FALSE,
+  .id = 3750,
+  .ra = 191.488,
+  .dec = 19.1043,
+},
+{ .is_ngc = FALSE,
+  .id = 3751,
+  .ra = 191.438,
+  .dec = 37.8232,
+},
+{ .is_ngc = FALSE,
+  .id = 3752,
+  .ra = 191.517,
+  .dec = 19.0117,
+},
+{ .is_ngc = FALSE,
+  .id = 3753,
+  .ra = 191.518,
+  .dec = 19.1209,
+},
+{ .is_ngc = FALSE,
+  .id = 3754,
+  .ra = 191.565,
+  .dec = 8.34828,
+},
+{ .is_ngc = FALSE,
+  .id = 3755,
+  .ra = 191.539,
+  .dec = 19.1569,
+},
+{ .is_ngc = FALSE,
+  .id = 3756,
+  .ra = 191.542,
+  .dec = 11.9146,
+},
+{ .is_ngc = FALSE,
+  .id = 3757,
+  .ra = 191.499,
+  .dec = 38.5142,
+},
+{ .is_ngc = FALSE,
+  .id = 3758,
+  .ra = 191.499,
+  .dec = 40.7748,
+},
+{ .is_ngc = FALSE,
+  .id = 3759,
+  .ra = 191.574,
+  .dec = 20.7825,
+},
+{ .is_ngc = FALSE,
+  .id = 3760,
+  .ra = 191.576,
+  .dec = 11.8735,
+},
+{ .is_ngc = FALSE,
+  .id = 3761,
+  .ra = 191.614,
+  .dec = 20.289,
+},
+{ .is_ngc = FALSE,
+  .id = 3762,
+  .ra = 191.657,
+  .dec = 22.245,
+},
+{ .is_ngc = FALSE,
+  .id = 3763,
+  .ra = 191.692,
+  .dec = 21.9847,
+},
+{ .is_ngc = FALSE,
+  .id = 3765,
+  .ra = 191.646,
+  .dec = 38.5741,
+},
+{ .is_ngc = FALSE,
+  .id = 3766,
+  .ra = 191.723,
+  .dec = 19.1106,
+},
+{ .is_ngc = FALSE,
+  .id = 3767,
+  .ra = 191.731,
+  .dec = 10.1814,
+},
+{ .is_ngc = FALSE,
+  .id = 3768,
+  .ra = 191.67,
+  .dec = 40.5973,
+},
+{ .is_ngc = FALSE,
+  .id = 3769,
+  .ra = 191.7,
+  .dec = 40.4701,
+},
+{ .is_ngc = FALSE,
+  .id = 3770,
+  .ra = 191.815,
+  .dec = 9.19978,
+},
+{ .is_ngc = FALSE,
+  .id = 3771,
+  .ra = 191.719,
+  .dec = 39.173,
+},
+{ .is_ngc = FALSE,
+  .id = 3772,
+  .ra = 191.734,
+  .dec = 36.531,
+},
+{ .is_ngc = FALSE,
+  .id = 3773,
+  .ra = 191.814,
+  .dec = 10.2035,
+},
+{ .is_ngc = FALSE,
+  .id = 3774,
+  .ra = 191.755,
+  .dec = 36.288,
+},
+{ .is_ngc = FALSE,
+  .id = 3775,
+  .ra = 191.817,
+  .dec = 11.76,
+},
+{ .is_ngc = FALSE,
+  .id = 3776,
+  .ra = 191.8,
+  .dec = 22.4833,
+},
+{ .is_ngc = FALSE,
+  .id = 3777,
+  .ra = 191.856,
+  .dec = 9.14422,
+},
+{ .is_ngc = FALSE,
+  .id = 3778,
+  .ra = 191.758,
+  .dec = 40.5965,
+},
+{ .is_ngc = FALSE,
+  .id = 3779,
+  .ra = 191.836,
+  .dec = 12.1656,
+},
+{ .is_ngc = FALSE,
+  .id = 3780,
+  .ra = 191.784,
+  .dec = 40.2359,
+},
+{ .is_ngc = FALSE,
+  .id = 3781,
+  .ra = 191.852,
+  .dec = 22.5692,
+},
+{ .is_ngc = FALSE,
+  .id = 3782,
+  .ra = 191.815,
+  .dec = 40.3685,
+},
+{ .is_ngc = FALSE,
+  .id = 3783,
+  .ra = 191.866,
+  .dec = 40.5665,
+},
+{ .is_ngc = FALSE,
+  .id = 3784,
+  .ra = 191.961,
+  .dec = 19.384,
+},
+{ .is_ngc = FALSE,
+  .id = 3785,
+  .ra = 191.968,
+  .dec = 19.2742,
+},
+{ .is_ngc = FALSE,
+  .id = 3786,
+  .ra = 191.904,
+  .dec = 39.0459,
+},
+{ .is_ngc = FALSE,
+  .id = 3787,
+  .ra = 191.927,
+  .dec = 40.6234,
+},
+{ .is_ngc = FALSE,
+  .id = 3788,
+  .ra = 192.03,
+  .dec = 18.8672,
+},
+{ .is_ngc = FALSE,
+  .id = 3789,
+  .ra = 192.029,
+  .dec = 20.1938,
+},
+{ .is_ngc = FALSE,
+  .id = 3790,
+  .ra = 192.061,
+  .dec = 11.1081,
+},
+{ .is_ngc = FALSE,
+  .id = 3792,
+  .ra = 192.061,
+  .dec = 11.0806,
+},
+{ .is_ngc = FALSE,
+  .id = 3793,
+  .ra = 192.049,
+  .dec = 19.1508,
+},
+{ .is_ngc = FALSE,
+  .id = 3794,
+  .ra = 192.089,
+  .dec = 19.1698,
+},
+{ .is_ngc = FALSE,
+  .id = 3795,
+  .ra = 192.021,
+  .dec = 40.7187,
+},
+{ .is_ngc = FALSE,
+  .id = 3796,
+  .ra = 192.113,
+  .dec = 20.0369,
+},
+{ .is_ngc = FALSE,
+  .id = 3797,
+  .ra = 192.145,
+  .dec = 11.5978,
+},
+{ .is_ngc = FALSE,
+  .id = 3798,
+  .ra = 192.179,
+  .dec = 9.24097,
+},
+{ .is_ngc = FALSE,
+  .id = 3799,
+  .ra = 192.248,
+  .dec = -14.3992,
+},
+{ .is_ngc = FALSE,
+  .id = 3800,
+  .ra = 192.112,
+  .dec = 36.5758,
+},
+{ .is_ngc = FALSE,
+  .id = 3801,
+  .ra = 192.252,
+  .dec = 10.9558,
+},
+{ .is_ngc = FALSE,
+  .id = 3802,
+  .ra = 192.177,
+  .dec = 38.2468,
+},
+{ .is_ngc = FALSE,
+  .id = 3803,
+  .ra = 192.268,
+  .dec = 10.6319,
+},
+{ .is_ngc = FALSE,
+  .id = 3805,
+  .ra = 192.177,
+  .dec = 38.2533,
+},
+{ .is_ngc = FALSE,
+  .id = 3806,
+  .ra = 192.231,
+  .dec = 14.9074,
+},
+{ .is_ngc = FALSE,
+  .id = 3807,
+  .ra = 192.371,
+  .dec = -4.40028,
+},
+{ .is_ngc = FALSE,
+  .id = 3808,
+  .ra = 192.245,
+  .dec = 40.596,
+},
+{ .is_ngc = FALSE,
+  .id = 3809,
+  .ra = 192.269,
+  .dec = 36.489,
+},
+{ .is_ngc = FALSE,
+  .id = 3810,
+  .ra = 192.263,
+  .dec = 40.6463,
+},
+{ .is_ngc = FALSE,
+  .id = 3811,
+  .ra = 192.357,
+  .dec = 21.4622,
+},
+{ .is_ngc = FALSE,
+  .id = 3812,
+  .ra = 192.474,
+  .dec = -6.71781,
+},
+{ .is_ngc = FALSE,
+  .id = 3813,
+  .ra = 192.51,
+  .dec = -25.9203,
+},
+{ .is_ngc = FALSE,
+  .id = 3814,
+  .ra = 192.384,
+  .dec = 20.0492,
+},
+{ .is_ngc = FALSE,
+  .id = 3815,
+  .ra = 192.41,
+  .dec = 19.2739,
+},
+{ .is_ngc = FALSE,
+  .id = 3816,
+  .ra = 192.369,
+  .dec = 37.2299,
+},
+{ .is_ngc = FALSE,
+  .id = 3817,
+  .ra = 192.431,
+  .dec = 22.8313,
+},
+{ .is_ngc = FALSE,
+  .id = 3818,
+  .ra = 192.445,
+  .dec = 21.7511,
+},
+{ .is_ngc = FALSE,
+  .id = 3819,
+  .ra = 192.568,
+  .dec = -14.3807,
+},
+{ .is_ngc = FALSE,
+  .id = 3820,
+  .ra = 192.412,
+  .dec = 37.117,
+},
+{ .is_ngc = FALSE,
+  .id = 3821,
+  .ra = 192.49,
+  .dec = 20.9688,
+},
+{ .is_ngc = FALSE,
+  .id = 3822,
+  .ra = 192.594,
+  .dec = -14.3225,
+},
+{ .is_ngc = FALSE,
+  .id = 3823,
+  .ra = 192.433,
+  .dec = 40.8837,
+},
+{ .is_ngc = FALSE,
+  .id = 3824,
+  .ra = 192.627,
+  .dec = -14.4258,
+},
+{ .is_ngc = FALSE,
+  .id = 3825,
+  .ra = 192.654,
+  .dec = -14.4827,
+},
+{ .is_ngc = FALSE,
+  .id = 3826,
+  .ra = 192.666,
+  .dec = -9.03167,
+},
+{ .is_ngc = FALSE,
+  .id = 3828,
+  .ra = 192.586,
+  .dec = 37.9488,
+},
+{ .is_ngc = FALSE,
+  .id = 3829,
+  .ra = 193.055,
+  .dec = -29.841,
+},
+{ .is_ngc = FALSE,
+  .id = 3830,
+  .ra = 192.714,
+  .dec = 19.8371,
+},
+{ .is_ngc = FALSE,
+  .id = 3831,
+  .ra = 192.827,
+  .dec = -14.5737,
+},
+{ .is_ngc = FALSE,
+  .id = 3832,
+  .ra = 192.704,
+  .dec = 39.8092,
+},
+{ .is_ngc = FALSE,
+  .id = 3834,
+  .ra = 192.885,
+  .dec = -14.2212,
+},
+{ .is_ngc = FALSE,
+  .id = 3835,
+  .ra = 192.733,
+  .dec = 40.1863,
+},
+{ .is_ngc = FALSE,
+  .id = 3836,
+  .ra = 192.766,
+  .dec = 40.1839,
+},
+{ .is_ngc = FALSE,
+  .id = 3837,
+  .ra = 192.887,
+  .dec = 19.7222,
+},
+{ .is_ngc = FALSE,
+  .id = 3839,
+  .ra = 192.942,
+  .dec = 20.4218,
+},
+{ .is_ngc = FALSE,
+  .id = 3840,
+  .ra = 192.942,
+  .dec = 21.735,
+},
+{ .is_ngc = FALSE,
+  .id = 3841,
+  .ra = 192.961,
+  .dec = 22.3439,
+},
+{ .is_ngc = FALSE,
+  .id = 3842,
+  .ra = 192.9,
+  .dec = 40.3714,
+},
+{ .is_ngc = FALSE,
+  .id = 3843,
+  .ra = 192.912,
+  .dec = 39,
+},
+{ .is_ngc = FALSE,
+  .id = 3844,
+  .ra = 193.028,
+  .dec = 39.8179,
+},
+{ .is_ngc = FALSE,
+  .id = 3845,
+  .ra = 193.036,
+  .dec = 38.619,
+},
+{ .is_ngc = FALSE,
+  .id = 3846,
+  .ra = 193.163,
+  .dec = 13.6469,
+},
+{ .is_ngc = FALSE,
+  .id = 3847,
+  .ra = 193.141,
+  .dec = 22.0644,
+},
+{ .is_ngc = FALSE,
+  .id = 3848,
+  .ra = 193.168,
+  .dec = 21.4139,
+},
+{ .is_ngc = FALSE,
+  .id = 3849,
+  .ra = 193.154,
+  .dec = 40.772,
+},
+{ .is_ngc = FALSE,
+  .id = 3850,
+  .ra = 193.165,
+  .dec = 40.1022,
+},
+{ .is_ngc = FALSE,
+  .id = 3851,
+  .ra = 193.269,
+  .dec = 21.9092,
+},
+{ .is_ngc = FALSE,
+  .id = 3852,
+  .ra = 193.263,
+  .dec = 35.7725,
+},
+{ .is_ngc = FALSE,
+  .id = 3853,
+  .ra = 193.294,
+  .dec = 38.8286,
+},
+{ .is_ngc = FALSE,
+  .id = 3854,
+  .ra = 193.311,
+  .dec = 40.8482,
+},
+{ .is_ngc = FALSE,
+  .id = 3855,
+  .ra = 193.345,
+  .dec = 36.7859,
+},
+{ .is_ngc = FALSE,
+  .id = 3856,
+  .ra = 193.438,
+  .dec = 20.0925,
+},
+{ .is_ngc = FALSE,
+  .id = 3857,
+  .ra = 193.484,
+  .dec = 19.6061,
+},
+{ .is_ngc = FALSE,
+  .id = 3858,
+  .ra = 193.482,
+  .dec = 20.7886,
+},
+{ .is_ngc = FALSE,
+  .id = 3859,
+  .ra = 193.583,
+  .dec = -9.11764,
+},
+{ .is_ngc = FALSE,
+  .id = 3860,
+  .ra = 193.527,
+  .dec = 19.3007,
+},
+{ .is_ngc = FALSE,
+  .id = 3861,
+  .ra = 193.462,
+  .dec = 38.2797,
+},
+{ .is_ngc = FALSE,
+  .id = 3862,
+  .ra = 193.472,
+  .dec = 36.0858,
+},
+{ .is_ngc = FALSE,
+  .id = 3863,
+  .ra = 193.475,
+  .dec = 38.4806,
+},
+{ .is_ngc = FALSE,
+  .id = 3864,
+  .ra = 193.551,
+  .dec = 18.9511,
+},
+{ .is_ngc = FALSE,
+  .id = 3865,
+  .ra = 193.559,
+  .dec = 18.8678,
+},
+{ .is_ngc = FALSE,
+  .id = 3866,
+  .ra = 193.566,
+  .dec = 22.3594,
+},
+{ .is_ngc = FALSE,
+  .id = 3867,
+  .ra = 193.582,
+  .dec = 18.9416,
+},
+{ .is_ngc = FALSE,
+  .id = 3868,
+  .ra = 193.587,
+  .dec = 18.9897,
+},
+{ .is_ngc = FALSE,
+  .id = 3869,
+  .ra = 193.588,
+  .dec = 18.9708,
+},
+{ .is_ngc = FALSE,
+  .id = 3870,
+  .ra = 193.59,
+  .dec = 22.3803,
+},
+{ .is_ngc = FALSE,
+  .id = 3871,
+  .ra = 193.608,
+  .dec = 18.9281,
+},
+{ .is_ngc = FALSE,
+  .id = 3872,
+  .ra = 193.627,
+  .dec = 18.9619,
+},
+{ .is_ngc = FALSE,
+  .id = 3873,
+  .ra = 193.632,
+  .dec = 18.8817,
+},
+{ .is_ngc = FALSE,
+  .id = 3874,
+  .ra = 193.643,
+  .dec = 18.9569,
+},
+{ .is_ngc = FALSE,
+  .id = 3875,
+  .ra = 193.655,
+  .dec = 22.035,
+},
+{ .is_ngc = FALSE,
+  .id = 3876,
+  .ra = 193.701,
+  .dec = 19.016,
+},
+{ .is_ngc = FALSE,
+  .id = 3877,
+  .ra = 193.703,
+  .dec = 19.1766,
+},
+{ .is_ngc = FALSE,
+  .id = 3878,
+  .ra = 193.623,
+  .dec = 40.0698,
+},
+{ .is_ngc = FALSE,
+  .id = 3879,
+  .ra = 193.633,
+  .dec = 38.6283,
+},
+{ .is_ngc = FALSE,
+  .id = 3880,
+  .ra = 193.7,
+  .dec = 22.5022,
+},
+{ .is_ngc = FALSE,
+  .id = 3881,
+  .ra = 193.725,
+  .dec = 19.1175,
+},
+{ .is_ngc = FALSE,
+  .id = 3882,
+  .ra = 193.724,
+  .dec = 22.5742,
+},
+{ .is_ngc = FALSE,
+  .id = 3883,
+  .ra = 193.806,
+  .dec = -8.12003,
+},
+{ .is_ngc = FALSE,
+  .id = 3884,
+  .ra = 193.741,
+  .dec = 19.6812,
+},
+{ .is_ngc = FALSE,
+  .id = 3885,
+  .ra = 193.678,
+  .dec = 37.1536,
+},
+{ .is_ngc = FALSE,
+  .id = 3886,
+  .ra = 193.751,
+  .dec = 19.0124,
+},
+{ .is_ngc = FALSE,
+  .id = 3887,
+  .ra = 193.682,
+  .dec = 40.305,
+},
+{ .is_ngc = FALSE,
+  .id = 3888,
+  .ra = 193.694,
+  .dec = 39.5711,
+},
+{ .is_ngc = FALSE,
+  .id = 3889,
+  .ra = 193.712,
+  .dec = 36.017,
+},
+{ .is_ngc = FALSE,
+  .id = 3890,
+  .ra = 193.709,
+  .dec = 37.1844,
+},
+{ .is_ngc = FALSE,
+  .id = 3891,
+  .ra = 193.743,
+  .dec = 36.0524,
+},
+{ .is_ngc = FALSE,
+  .id = 3892,
+  .ra = 193.775,
+  .dec = 39.2221,
+},
+{ .is_ngc = FALSE,
+  .id = 3893,
+  .ra = 193.781,
+  .dec = 38.6233,
+},
+{ .is_ngc = FALSE,
+  .id = 3894,
+  .ra = 193.864,
+  .dec = 19.0683,
+},
+{ .is_ngc = FALSE,
+  .id = 3895,
+  .ra = 193.789,
+  .dec = 39.2032,
+},
+{ .is_ngc = FALSE,
+  .id = 3896,
+  .ra = 194.181,
+  .dec = -50.3464,
+},
+{ .is_ngc = FALSE,
+  .id = 3897,
+  .ra = 193.83,
+  .dec = 39.6726,
+},
+{ .is_ngc = FALSE,
+  .id = 3898,
+  .ra = 193.849,
+  .dec = 37.5827,
+},
+{ .is_ngc = FALSE,
+  .id = 3899,
+  .ra = 193.919,
+  .dec = 20.6363,
+},
+{ .is_ngc = FALSE,
+  .id = 3900,
+  .ra = 193.923,
+  .dec = 27.2504,
+},
+{ .is_ngc = FALSE,
+  .id = 3901,
+  .ra = 193.96,
+  .dec = 21.9391,
+},
+{ .is_ngc = FALSE,
+  .id = 3902,
+  .ra = 193.911,
+  .dec = 35.9958,
+},
+{ .is_ngc = FALSE,
+  .id = 3903,
+  .ra = 193.911,
+  .dec = 40.3997,
+},
+{ .is_ngc = FALSE,
+  .id = 3904,
+  .ra = 193.94,
+  .dec = 36.2931,
+},
+{ .is_ngc = FALSE,
+  .id = 3905,
+  .ra = 194.036,
+  .dec = 19.8519,
+},
+{ .is_ngc = FALSE,
+  .id = 3906,
+  .ra = 193.963,
+  .dec = 40.4639,
+},
+{ .is_ngc = FALSE,
+  .id = 3907,
+  .ra = 194.076,
+  .dec = 18.7833,
+},
+{ .is_ngc = FALSE,
+  .id = 3908,
+  .ra = 194.168,
+  .dec = -7.56031,
+},
+{ .is_ngc = FALSE,
+  .id = 3909,
+  .ra = 194.011,
+  .dec = 40.3844,
+},
+{ .is_ngc = FALSE,
+  .id = 3910,
+  .ra = 194.02,
+  .dec = 39.7197,
+},
+{ .is_ngc = FALSE,
+  .id = 3911,
+  .ra = 194.04,
+  .dec = 35.6358,
+},
+{ .is_ngc = FALSE,
+  .id = 3912,
+  .ra = 194.031,
+  .dec = 39.911,
+},
+{ .is_ngc = FALSE,
+  .id = 3913,
+  .ra = 194.119,
+  .dec = 27.2911,
+},
+{ .is_ngc = FALSE,
+  .id = 3914,
+  .ra = 194.095,
+  .dec = 36.3597,
+},
+{ .is_ngc = FALSE,
+  .id = 3915,
+  .ra = 194.162,
+  .dec = 20.2919,
+},
+{ .is_ngc = FALSE,
+  .id = 3916,
+  .ra = 194.13,
+  .dec = 38.6136,
+},
+{ .is_ngc = FALSE,
+  .id = 3917,
+  .ra = 194.216,
+  .dec = 22.0047,
+},
+{ .is_ngc = FALSE,
+  .id = 3918,
+  .ra = 194.223,
+  .dec = 22.3737,
+},
+{ .is_ngc = FALSE,
+  .id = 3919,
+  .ra = 194.203,
+  .dec = 38.5892,
+},
+{ .is_ngc = FALSE,
+  .id = 3920,
+  .ra = 194.209,
+  .dec = 39.9587,
+},
+{ .is_ngc = FALSE,
+  .id = 3921,
+  .ra = 194.236,
+  .dec = 38.6395,
+},
+{ .is_ngc = FALSE,
+  .id = 3922,
+  .ra = 194.24,
+  .dec = 38.4782,
+},
+{ .is_ngc = FALSE,
+  .id = 3923,
+  .ra = 194.254,
+  .dec = 37.9556,
+},
+{ .is_ngc = FALSE,
+  .id = 3924,
+  .ra = 194.354,
+  .dec = 18.7808,
+},
+{ .is_ngc = FALSE,
+  .id = 3925,
+  .ra = 194.313,
+  .dec = 36.4219,
+},
+{ .is_ngc = FALSE,
+  .id = 3926,
+  .ra = 194.377,
+  .dec = 22.8122,
+},
+{ .is_ngc = FALSE,
+  .id = 3927,
+  .ra = 194.544,
+  .dec = -22.8764,
+},
+{ .is_ngc = FALSE,
+  .id = 3928,
+  .ra = 194.326,
+  .dec = 40.4414,
+},
+{ .is_ngc = FALSE,
+  .id = 3929,
+  .ra = 194.421,
+  .dec = 20.3969,
+},
+{ .is_ngc = FALSE,
+  .id = 3930,
+  .ra = 194.343,
+  .dec = 38.7639,
+},
+{ .is_ngc = FALSE,
+  .id = 3931,
+  .ra = 194.488,
+  .dec = 19.6173,
+},
+{ .is_ngc = FALSE,
+  .id = 3932,
+  .ra = 194.522,
+  .dec = 19.5841,
+},
+{ .is_ngc = FALSE,
+  .id = 3933,
+  .ra = 194.488,
+  .dec = 36.6454,
+},
+{ .is_ngc = FALSE,
+  .id = 3934,
+  .ra = 194.573,
+  .dec = 18.825,
+},
+{ .is_ngc = FALSE,
+  .id = 3936,
+  .ra = 194.584,
+  .dec = 19.0575,
+},
+{ .is_ngc = FALSE,
+  .id = 3937,
+  .ra = 194.603,
+  .dec = 18.8184,
+},
+{ .is_ngc = FALSE,
+  .id = 3938,
+  .ra = 194.605,
+  .dec = 18.7528,
+},
+{ .is_ngc = FALSE,
+  .id = 3939,
+  .ra = 194.616,
+  .dec = 18.7521,
+},
+{ .is_ngc = FALSE,
+  .id = 3940,
+  .ra = 194.568,
+  .dec = 35.839,
+},
+{ .is_ngc = FALSE,
+  .id = 3941,
+  .ra = 194.558,
+  .dec = 39.7729,
+},
+{ .is_ngc = FALSE,
+  .id = 3942,
+  .ra = 194.582,
+  .dec = 36.1096,
+},
+{ .is_ngc = FALSE,
+  .id = 3943,
+  .ra = 194.652,
+  .dec = 28.1131,
+},
+{ .is_ngc = FALSE,
+  .id = 3944,
+  .ra = 194.686,
+  .dec = 23.7809,
+},
+{ .is_ngc = FALSE,
+  .id = 3945,
+  .ra = 194.624,
+  .dec = 39.9347,
+},
+{ .is_ngc = FALSE,
+  .id = 3946,
+  .ra = 194.704,
+  .dec = 27.8098,
+},
+{ .is_ngc = FALSE,
+  .id = 3947,
+  .ra = 194.717,
+  .dec = 27.7845,
+},
+{ .is_ngc = FALSE,
+  .id = 3948,
+  .ra = 194.742,
+  .dec = 24.0611,
+},
+{ .is_ngc = FALSE,
+  .id = 3949,
+  .ra = 194.733,
+  .dec = 27.833,
+},
+{ .is_ngc = FALSE,
+  .id = 3950,
+  .ra = 194.775,
+  .dec = 18.7355,
+},
+{ .is_ngc = FALSE,
+  .id = 3951,
+  .ra = 194.792,
+  .dec = 18.7642,
+},
+{ .is_ngc = FALSE,
+  .id = 3952,
+  .ra = 194.717,
+  .dec = 38.8689,
+},
+{ .is_ngc = FALSE,
+  .id = 3953,
+  .ra = 194.787,
+  .dec = 23.0831,
+},
+{ .is_ngc = FALSE,
+  .id = 3954,
+  .ra = 194.803,
+  .dec = 19.2717,
+},
+{ .is_ngc = FALSE,
+  .id = 3955,
+  .ra = 194.775,
+  .dec = 27.9963,
+},
+{ .is_ngc = FALSE,
+  .id = 3956,
+  .ra = 194.735,
+  .dec = 37.398,
+},
+{ .is_ngc = FALSE,
+  .id = 3957,
+  .ra = 194.781,
+  .dec = 27.7672,
+},
+{ .is_ngc = FALSE,
+  .id = 3958,
+  .ra = 194.797,
+  .dec = 24.0221,
+},
+{ .is_ngc = FALSE,
+  .id = 3959,
+  .ra = 194.784,
+  .dec = 27.7838,
+},
+{ .is_ngc = FALSE,
+  .id = 3960,
+  .ra = 194.783,
+  .dec = 27.8546,
+},
+{ .is_ngc = FALSE,
+  .id = 3962,
+  .ra = 194.812,
+  .dec = 23.6675,
+},
+{ .is_ngc = FALSE,
+  .id = 3963,
+  .ra = 194.806,
+  .dec = 27.774,
+},
+{ .is_ngc = FALSE,
+  .id = 3964,
+  .ra = 194.807,
+  .dec = 27.8508,
+},
+{ .is_ngc = FALSE,
+  .id = 3965,
+  .ra = 194.845,
+  .dec = 18.8422,
+},
+{ .is_ngc = FALSE,
+  .id = 3966,
+  .ra = 194.805,
+  .dec = 35.8544,
+},
+{ .is_ngc = FALSE,
+  .id = 3967,
+  .ra = 194.804,
+  .dec = 36.1292,
+},
+{ .is_ngc = FALSE,
+  .id = 3968,
+  .ra = 194.857,
+  .dec = 27.9724,
+},
+{ .is_ngc = FALSE,
+  .id = 3969,
+  .ra = 194.887,
+  .dec = 19.6533,
+},
+{ .is_ngc = FALSE,
+  .id = 3970,
+  .ra = 194.798,
+  .dec = 40.4023,
+},
+{ .is_ngc = FALSE,
+  .id = 3970,
+  .ra = 194.8,
+  .dec = 40.4011,
+},
+{ .is_ngc = FALSE,
+  .id = 3971,
+  .ra = 194.882,
+  .dec = 22.8447,
+},
+{ .is_ngc = FALSE,
+  .id = 3972,
+  .ra = 194.821,
+  .dec = 37.28,
+},
+{ .is_ngc = FALSE,
+  .id = 3973,
+  .ra = 194.878,
+  .dec = 27.8838,
+},
+{ .is_ngc = FALSE,
+  .id = 3975,
+  .ra = 194.815,
+  .dec = 38.8825,
+},
+{ .is_ngc = FALSE,
+  .id = 3976,
+  .ra = 194.872,
+  .dec = 27.8496,
+},
+{ .is_ngc = FALSE,
+  .id = 3977,
+  .ra = 194.832,
+  .dec = 36.7981,
+},
+{ .is_ngc = FALSE,
+  .id = 3978,
+  .ra = 194.906,
+  .dec = 19.6224,
+},
+{ .is_ngc = FALSE,
+  .id = 3979,
+  .ra = 194.838,
+  .dec = 36.3261,
+},
+{ .is_ngc = FALSE,
+  .id = 3980,
+  .ra = 194.827,
+  .dec = 39.1503,
+},
+{ .is_ngc = FALSE,
+  .id = 3981,
+  .ra = 194.839,
+  .dec = 37.2278,
+},
+{ .is_ngc = FALSE,
+  .id = 3982,
+  .ra = 194.827,
+  .dec = 40.0806,
+},
+{ .is_ngc = FALSE,
+  .id = 3983,
+  .ra = 194.836,
+  .dec = 39.2472,
+},
+{ .is_ngc = FALSE,
+  .id = 3984,
+  .ra = 194.926,
+  .dec = 19.6261,
+},
+{ .is_ngc = FALSE,
+  .id = 3985,
+  .ra = 194.929,
+  .dec = 19.5908,
+},
+{ .is_ngc = FALSE,
+  .id = 3986,
+  .ra = 195.384,
+  .dec = -32.2911,
+},
+{ .is_ngc = FALSE,
+  .id = 3987,
+  .ra = 194.854,
+  .dec = 38.7334,
+},
+{ .is_ngc = FALSE,
+  .id = 3988,
+  .ra = 194.862,
+  .dec = 37.2447,
+},
+{ .is_ngc = FALSE,
+  .id = 3989,
+  .ra = 194.869,
+  .dec = 36.7569,
+},
+{ .is_ngc = FALSE,
+  .id = 3990,
+  .ra = 194.913,
+  .dec = 28.8954,
+},
+{ .is_ngc = FALSE,
+  .id = 3991,
+  .ra = 194.916,
+  .dec = 28.9262,
+},
+{ .is_ngc = FALSE,
+  .id = 3992,
+  .ra = 194.889,
+  .dec = 36.7719,
+},
+{ .is_ngc = FALSE,
+  .id = 3993,
+  .ra = 194.877,
+  .dec = 40.6017,
+},
+{ .is_ngc = FALSE,
+  .id = 3994,
+  .ra = 194.961,
+  .dec = 22.7153,
+},
+{ .is_ngc = FALSE,
+  .id = 3995,
+  .ra = 194.891,
+  .dec = 39.0402,
+},
+{ .is_ngc = FALSE,
+  .id = 3996,
+  .ra = 194.881,
+  .dec = 40.4671,
+},
+{ .is_ngc = FALSE,
+  .id = 3997,
+  .ra = 194.904,
+  .dec = 36.6944,
+},
+{ .is_ngc = FALSE,
+  .id = 3998,
+  .ra = 194.945,
+  .dec = 27.9733,
+},
+{ .is_ngc = FALSE,
+  .id = 4000,
+  .ra = 194.902,
+  .dec = 39.5869,
+},
+{ .is_ngc = FALSE,
+  .id = 4001,
+  .ra = 194.908,
+  .dec = 38.8696,
+},
+{ .is_ngc = FALSE,
+  .id = 4002,
+  .ra = 194.92,
+  .dec = 36.7638,
+},
+{ .is_ngc = FALSE,
+  .id = 4003,
+  .ra = 194.914,
+  .dec = 38.8155,
+},
+{ .is_ngc = FALSE,
+  .id = 4004,
+  .ra = 194.928,
+  .dec = 38.8111,
+},
+{ .is_ngc = FALSE,
+  .id = 4005,
+  .ra = 195.011,
+  .dec = 22.6394,
+},
+{ .is_ngc = FALSE,
+  .id = 4006,
+  .ra = 194.956,
+  .dec = 37.0089,
+},
+{ .is_ngc = FALSE,
+  .id = 4007,
+  .ra = 195.029,
+  .dec = 19.9633,
+},
+{ .is_ngc = FALSE,
+  .id = 4008,
+  .ra = 195.025,
+  .dec = 22.35,
+},
+{ .is_ngc = FALSE,
+  .id = 4009,
+  .ra = 194.97,
+  .dec = 36.6606,
+},
+{ .is_ngc = FALSE,
+  .id = 4010,
+  .ra = 194.975,
+  .dec = 37.8588,
+},
+{ .is_ngc = FALSE,
+  .id = 4011,
+  .ra = 195.027,
+  .dec = 28.0032,
+},
+{ .is_ngc = FALSE,
+  .id = 4012,
+  .ra = 195.033,
+  .dec = 28.0779,
+},
+{ .is_ngc = FALSE,
+  .id = 4013,
+  .ra = 194.991,
+  .dec = 37.1983,
+},
+{ .is_ngc = FALSE,
+  .id = 4014,
+  .ra = 195.058,
+  .dec = 22.4983,
+},
+{ .is_ngc = FALSE,
+  .id = 4017,
+  .ra = 195.066,
+  .dec = 22.5547,
+},
+{ .is_ngc = FALSE,
+  .id = 4018,
+  .ra = 194.99,
+  .dec = 40.4858,
+},
+{ .is_ngc = FALSE,
+  .id = 4019,
+  .ra = 195.073,
+  .dec = 23.7206,
+},
+{ .is_ngc = FALSE,
+  .id = 4020,
+  .ra = 195.014,
+  .dec = 38.6089,
+},
+{ .is_ngc = FALSE,
+  .id = 4021,
+  .ra = 195.061,
+  .dec = 28.0401,
+},
+{ .is_ngc = FALSE,
+  .id = 4022,
+  .ra = 195.02,
+  .dec = 38.4795,
+},
+{ .is_ngc = FALSE,
+  .id = 4023,
+  .ra = 195.11,
+  .dec = 19.0966,
+},
+{ .is_ngc = FALSE,
+  .id = 4024,
+  .ra = 195.016,
+  .dec = 40.5081,
+},
+{ .is_ngc = FALSE,
+  .id = 4025,
+  .ra = 195.118,
+  .dec = 19.1052,
+},
+{ .is_ngc = FALSE,
+  .id = 4026,
+  .ra = 195.092,
+  .dec = 28.0464,
+},
+{ .is_ngc = FALSE,
+  .id = 4027,
+  .ra = 195.058,
+  .dec = 37.1403,
+},
+{ .is_ngc = FALSE,
+  .id = 4028,
+  .ra = 195.067,
+  .dec = 36.2536,
+},
+{ .is_ngc = FALSE,
+  .id = 4029,
+  .ra = 195.059,
+  .dec = 38.7589,
+},
+{ .is_ngc = FALSE,
+  .id = 4030,
+  .ra = 195.116,
+  .dec = 27.9549,
+},
+{ .is_ngc = FALSE,
+  .id = 4031,
+  .ra = 195.065,
+  .dec = 39.1442,
+},
+{ .is_ngc = FALSE,
+  .id = 4032,
+  .ra = 195.107,
+  .dec = 28.8676,
+},
+{ .is_ngc = FALSE,
+  .id = 4033,
+  .ra = 195.119,
+  .dec = 27.9719,
+},
+{ .is_ngc = FALSE,
+  .id = 4034,
+  .ra = 195.082,
+  .dec = 37.0462,
+},
+{ .is_ngc = FALSE,
+  .id = 4035,
+  .ra = 195.072,
+  .dec = 40.3014,
+},
+{ .is_ngc = FALSE,
+  .id = 4036,
+  .ra = 195.085,
+  .dec = 36.9096,
+},
+{ .is_ngc = FALSE,
+  .id = 4037,
+  .ra = 195.081,
+  .dec = 39.0014,
+},
+{ .is_ngc = FALSE,
+  .id = 4038,
+  .ra = 195.09,
+  .dec = 37.0395,
+},
+{ .is_ngc = FALSE,
+  .id = 4039,
+  .ra = 195.164,
+  .dec = 21.6916,
+},
+{ .is_ngc = FALSE,
+  .id = 4040,
+  .ra = 195.158,
+  .dec = 28.0571,
+},
+{ .is_ngc = FALSE,
+  .id = 4041,
+  .ra = 195.17,
+  .dec = 27.996,
+},
+{ .is_ngc = FALSE,
+  .id = 4042,
+  .ra = 195.178,
+  .dec = 27.971,
+},
+{ .is_ngc = FALSE,
+  .id = 4043,
+  .ra = 195.145,
+  .dec = 37.0714,
+},
+{ .is_ngc = FALSE,
+  .id = 4044,
+  .ra = 195.198,
+  .dec = 27.9214,
+},
+{ .is_ngc = FALSE,
+  .id = 4045,
+  .ra = 195.202,
+  .dec = 28.09,
+},
+{ .is_ngc = FALSE,
+  .id = 4046,
+  .ra = 195.165,
+  .dec = 36.6856,
+},
+{ .is_ngc = FALSE,
+  .id = 4047,
+  .ra = 195.24,
+  .dec = 19.687,
+},
+{ .is_ngc = FALSE,
+  .id = 4048,
+  .ra = 195.159,
+  .dec = 39.83,
+},
+{ .is_ngc = FALSE,
+  .id = 4049,
+  .ra = 195.178,
+  .dec = 36.3453,
+},
+{ .is_ngc = FALSE,
+  .id = 4050,
+  .ra = 195.183,
+  .dec = 36.7386,
+},
+{ .is_ngc = FALSE,
+  .id = 4051,
+  .ra = 195.215,
+  .dec = 28.0427,
+},
+{ .is_ngc = FALSE,
+  .id = 4052,
+  .ra = 195.174,
+  .dec = 39.6681,
+},
+{ .is_ngc = FALSE,
+  .id = 4053,
+  .ra = 195.255,
+  .dec = 22.9243,
+},
+{ .is_ngc = FALSE,
+  .id = 4054,
+  .ra = 195.255,
+  .dec = 22.9046,
+},
+{ .is_ngc = FALSE,
+  .id = 4055,
+  .ra = 195.261,
+  .dec = 22.9083,
+},
+{ .is_ngc = FALSE,
+  .id = 4056,
+  .ra = 195.184,
+  .dec = 39.7539,
+},
+{ .is_ngc = FALSE,
+  .id = 4057,
+  .ra = 195.272,
+  .dec = 23.1599,
+},
+{ .is_ngc = FALSE,
+  .id = 4058,
+  .ra = 195.289,
+  .dec = 19.4931,
+},
+{ .is_ngc = FALSE,
+  .id = 4059,
+  .ra = 195.314,
+  .dec = 19.2722,
+},
+{ .is_ngc = FALSE,
+  .id = 4060,
+  .ra = 195.218,
+  .dec = 40.5836,
+},
+{ .is_ngc = FALSE,
+  .id = 4061,
+  .ra = 195.24,
+  .dec = 39.5828,
+},
+{ .is_ngc = FALSE,
+  .id = 4062,
+  .ra = 195.244,
+  .dec = 39.8581,
+},
+{ .is_ngc = FALSE,
+  .id = 4063,
+  .ra = 195.277,
+  .dec = 39.2448,
+},
+{ .is_ngc = FALSE,
+  .id = 4064,
+  .ra = 195.278,
+  .dec = 39.8411,
+},
+{ .is_ngc = FALSE,
+  .id = 4065,
+  .ra = 195.296,
+  .dec = 39.7441,
+},
+{ .is_ngc = FALSE,
+  .id = 4066,
+  .ra = 195.417,
+  .dec = 19.2717,
+},
+{ .is_ngc = FALSE,
+  .id = 4067,
+  .ra = 195.334,
+  .dec = 39.9404,
+},
+{ .is_ngc = FALSE,
+  .id = 4068,
+  .ra = 195.334,
+  .dec = 39.8987,
+},
+{ .is_ngc = FALSE,
+  .id = 4069,
+  .ra = 195.353,
+  .dec = 36.1119,
+},
+{ .is_ngc = FALSE,
+  .id = 4070,
+  .ra = 195.43,
+  .dec = 19.3008,
+},
+{ .is_ngc = FALSE,
+  .id = 4071,
+  .ra = 195.516,
+  .dec = -7.60303,
+},
+{ .is_ngc = FALSE,
+  .id = 4072,
+  .ra = 195.358,
+  .dec = 37.3536,
+},
+{ .is_ngc = FALSE,
+  .id = 4073,
+  .ra = 195.357,
+  .dec = 39.9141,
+},
+{ .is_ngc = FALSE,
+  .id = 4074,
+  .ra = 195.453,
+  .dec = 19.0078,
+},
+{ .is_ngc = FALSE,
+  .id = 4075,
+  .ra = 195.453,
+  .dec = 19.9639,
+},
+{ .is_ngc = FALSE,
+  .id = 4076,
+  .ra = 195.452,
+  .dec = 23.389,
+},
+{ .is_ngc = FALSE,
+  .id = 4077,
+  .ra = 195.392,
+  .dec = 37.3862,
+},
+{ .is_ngc = FALSE,
+  .id = 4078,
+  .ra = 195.398,
+  .dec = 36.5939,
+},
+{ .is_ngc = FALSE,
+  .id = 4079,
+  .ra = 195.484,
+  .dec = 19.2506,
+},
+{ .is_ngc = FALSE,
+  .id = 4080,
+  .ra = 195.491,
+  .dec = 19.2542,
+},
+{ .is_ngc = FALSE,
+  .id = 4081,
+  .ra = 195.48,
+  .dec = 22.771,
+},
+{ .is_ngc = FALSE,
+  .id = 4082,
+  .ra = 195.414,
+  .dec = 37.34,
+},
+{ .is_ngc = FALSE,
+  .id = 4083,
+  .ra = 195.411,
+  .dec = 38.1421,
+},
+{ .is_ngc = FALSE,
+  .id = 4084,
+  .ra = 195.421,
+  .dec = 36.9658,
+},
+{ .is_ngc = FALSE,
+  .id = 4085,
+  .ra = 195.409,
+  .dec = 39.7027,
+},
+{ .is_ngc = FALSE,
+  .id = 4086,
+  .ra = 195.428,
+  .dec = 36.6481,
+},
+{ .is_ngc = FALSE,
+  .id = 4087,
+  .ra = 195.502,
+  .dec = 19.9933,
+},
+{ .is_ngc = FALSE,
+  .id = 4088,
+  .ra = 195.431,
+  .dec = 29.0444,
+},
+{ .is_ngc = FALSE,
+  .id = 4089,
+  .ra = 195.507,
+  .dec = 19.5019,
+},
+{ .is_ngc = FALSE,
+  .id = 4090,
+  .ra = 195.443,
+  .dec = 36.8369,
+},
+{ .is_ngc = FALSE,
+  .id = 4091,
+  .ra = 195.553,
+  .dec = 19.8919,
+},
+{ .is_ngc = FALSE,
+  .id = 4092,
+  .ra = 195.557,
+  .dec = 19.1835,
+},
+{ .is_ngc = FALSE,
+  .id = 4093,
+  .ra = 195.512,
+  .dec = 28.9853,
+},
+{ .is_ngc = FALSE,
+  .id = 4094,
+  .ra = 195.494,
+  .dec = 37.7948,
+},
+{ .is_ngc = FALSE,
+  .id = 4095,
+  .ra = 195.585,
+  .dec = 19.0997,
+},
+{ .is_ngc = FALSE,
+  .id = 4096,
+  .ra = 195.571,
+  .dec = 24.0108,
+},
+{ .is_ngc = FALSE,
+  .id = 4097,
+  .ra = 195.52,
+  .dec = 36.6052,
+},
+{ .is_ngc = FALSE,
+  .id = 4098,
+  .ra = 195.517,
+  .dec = 37.9792,
+},
+{ .is_ngc = FALSE,
+  .id = 4099,
+  .ra = 195.597,
+  .dec = 24.0291,
+},
+{ .is_ngc = FALSE,
+  .id = 4100,
+  .ra = 195.52,
+  .dec = 40.408,
+},
+{ .is_ngc = FALSE,
+  .id = 4101,
+  .ra = 195.557,
+  .dec = 39.9403,
+},
+{ .is_ngc = FALSE,
+  .id = 4102,
+  .ra = 195.575,
+  .dec = 36.1517,
+},
+{ .is_ngc = FALSE,
+  .id = 4103,
+  .ra = 195.579,
+  .dec = 38.0161,
+},
+{ .is_ngc = FALSE,
+  .id = 4104,
+  .ra = 195.576,
+  .dec = 38.5914,
+},
+{ .is_ngc = FALSE,
+  .id = 4105,
+  .ra = 195.579,
+  .dec = 38.2703,
+},
+{ .is_ngc = FALSE,
+  .id = 4106,
+  .ra = 195.66,
+  .dec = 28.114,
+},
+{ .is_ngc = FALSE,
+  .id = 4107,
+  .ra = 195.673,
+  .dec = 21.9976,
+},
+{ .is_ngc = FALSE,
+  .id = 4108,
+  .ra = 195.632,
+  .dec = 38.4785,
+},
+{ .is_ngc = FALSE,
+  .id = 4109,
+  .ra = 195.741,
+  .dec = 19.0037,
+},
+{ .is_ngc = FALSE,
+  .id = 4110,
+  .ra = 195.743,
+  .dec = 19.2253,
+},
+{ .is_ngc = FALSE,
+  .id = 4111,
+  .ra = 195.736,
+  .dec = 28.0701,
+},
+{ .is_ngc = FALSE,
+  .id = 4112,
+  .ra = 195.689,
+  .dec = 37.2119,
+},
+{ .is_ngc = FALSE,
+  .id = 4113,
+  .ra = 195.764,
+  .dec = 20.4722,
+},
+{ .is_ngc = FALSE,
+  .id = 4114,
+  .ra = 195.675,
+  .dec = 40.1039,
+},
+{ .is_ngc = FALSE,
+  .id = 4115,
+  .ra = 195.703,
+  .dec = 37.2226,
+},
+{ .is_ngc = FALSE,
+  .id = 4116,
+  .ra = 195.792,
+  .dec = 19.0834,
+},
+{ .is_ngc = FALSE,
+  .id = 4117,
+  .ra = 195.702,
+  .dec = 40.5252,
+},
+{ .is_ngc = FALSE,
+  .id = 4118,
+  .ra = 195.715,
+  .dec = 38.2929,
+},
+{ .is_ngc = FALSE,
+  .id = 4119,
+  .ra = 195.813,
+  .dec = 19.2353,
+},
+{ .is_ngc = FALSE,
+  .id = 4120,
+  .ra = 195.756,
+  .dec = 37.0827,
+},
+{ .is_ngc = FALSE,
+  .id = 4121,
+  .ra = 195.839,
+  .dec = 19.2818,
+},
+{ .is_ngc = FALSE,
+  .id = 4122,
+  .ra = 195.852,
+  .dec = 20.1963,
+},
+{ .is_ngc = FALSE,
+  .id = 4123,
+  .ra = 195.774,
+  .dec = 38.3145,
+},
+{ .is_ngc = FALSE,
+  .id = 4124,
+  .ra = 195.88,
+  .dec = 22.8472,
+},
+{ .is_ngc = FALSE,
+  .id = 4125,
+  .ra = 195.896,
+  .dec = 18.8033,
+},
+{ .is_ngc = FALSE,
+  .id = 4126,
+  .ra = 195.902,
+  .dec = 19.3225,
+},
+{ .is_ngc = FALSE,
+  .id = 4127,
+  .ra = 195.823,
+  .dec = 38.0453,
+},
+{ .is_ngc = FALSE,
+  .id = 4128,
+  .ra = 195.922,
+  .dec = 20.2168,
+},
+{ .is_ngc = FALSE,
+  .id = 4129,
+  .ra = 195.935,
+  .dec = 18.8775,
+},
+{ .is_ngc = FALSE,
+  .id = 4130,
+  .ra = 195.944,
+  .dec = 19.2709,
+},
+{ .is_ngc = FALSE,
+  .id = 4131,
+  .ra = 195.856,
+  .dec = 38.9514,
+},
+{ .is_ngc = FALSE,
+  .id = 4132,
+  .ra = 195.891,
+  .dec = 38.3779,
+},
+{ .is_ngc = FALSE,
+  .id = 4133,
+  .ra = 195.962,
+  .dec = 27.9878,
+},
+{ .is_ngc = FALSE,
+  .id = 4135,
+  .ra = 195.905,
+  .dec = 40.2486,
+},
+{ .is_ngc = FALSE,
+  .id = 4137,
+  .ra = 195.997,
+  .dec = 22.74,
+},
+{ .is_ngc = FALSE,
+  .id = 4138,
+  .ra = 196.008,
+  .dec = 20.6644,
+},
+{ .is_ngc = FALSE,
+  .id = 4139,
+  .ra = 196.017,
+  .dec = 19.2949,
+},
+{ .is_ngc = FALSE,
+  .id = 4140,
+  .ra = 196.025,
+  .dec = 20.0962,
+},
+{ .is_ngc = FALSE,
+  .id = 4141,
+  .ra = 196.032,
+  .dec = 19.2097,
+},
+{ .is_ngc = FALSE,
+  .id = 4142,
+  .ra = 195.947,
+  .dec = 38.1951,
+},
+{ .is_ngc = FALSE,
+  .id = 4143,
+  .ra = 195.941,
+  .dec = 40.2072,
+},
+{ .is_ngc = FALSE,
+  .id = 4144,
+  .ra = 195.959,
+  .dec = 36.9425,
+},
+{ .is_ngc = FALSE,
+  .id = 4145,
+  .ra = 195.958,
+  .dec = 38.2856,
+},
+{ .is_ngc = FALSE,
+  .id = 4146,
+  .ra = 196.043,
+  .dec = 19.2772,
+},
+{ .is_ngc = FALSE,
+  .id = 4147,
+  .ra = 196.04,
+  .dec = 20.2494,
+},
+{ .is_ngc = FALSE,
+  .id = 4148,
+  .ra = 196.044,
+  .dec = 19.2583,
+},
+{ .is_ngc = FALSE,
+  .id = 4149,
+  .ra = 196.045,
+  .dec = 22.2894,
+},
+{ .is_ngc = FALSE,
+  .id = 4150,
+  .ra = 196.054,
+  .dec = 21.987,
+},
+{ .is_ngc = FALSE,
+  .id = 4151,
+  .ra = 195.996,
+  .dec = 36.8569,
+},
+{ .is_ngc = FALSE,
+  .id = 4152,
+  .ra = 195.993,
+  .dec = 38.1988,
+},
+{ .is_ngc = FALSE,
+  .id = 4153,
+  .ra = 196.11,
+  .dec = 19.0445,
+},
+{ .is_ngc = FALSE,
+  .id = 4154,
+  .ra = 196.118,
+  .dec = 23.5744,
+},
+{ .is_ngc = FALSE,
+  .id = 4155,
+  .ra = 196.037,
+  .dec = 40.016,
+},
+{ .is_ngc = FALSE,
+  .id = 4157,
+  .ra = 196.077,
+  .dec = 38.6647,
+},
+{ .is_ngc = FALSE,
+  .id = 4158,
+  .ra = 196.103,
+  .dec = 36.4799,
+},
+{ .is_ngc = FALSE,
+  .id = 4159,
+  .ra = 196.191,
+  .dec = 22.2408,
+},
+{ .is_ngc = FALSE,
+  .id = 4160,
+  .ra = 196.2,
+  .dec = 22.8924,
+},
+{ .is_ngc = FALSE,
+  .id = 4161,
+  .ra = 196.147,
+  .dec = 39.977,
+},
+{ .is_ngc = FALSE,
+  .id = 4162,
+  .ra = 196.262,
+  .dec = 20.5536,
+},
+{ .is_ngc = FALSE,
+  .id = 4163,
+  .ra = 196.283,
+  .dec = 20.7704,
+},
+{ .is_ngc = FALSE,
+  .id = 4164,
+  .ra = 196.31,
+  .dec = 20.5461,
+},
+{ .is_ngc = FALSE,
+  .id = 4165,
+  .ra = 196.238,
+  .dec = 39.9245,
+},
+{ .is_ngc = FALSE,
+  .id = 4166,
+  .ra = 196.327,
+  .dec = 31.4423,
+},
+{ .is_ngc = FALSE,
+  .id = 4167,
+  .ra = 196.378,
+  .dec = 21.91,
+},
+{ .is_ngc = FALSE,
+  .id = 4168,
+  .ra = 196.295,
+  .dec = 40.0496,
+},
+{ .is_ngc = FALSE,
+  .id = 4169,
+  .ra = 196.301,
+  .dec = 38.7719,
+},
+{ .is_ngc = FALSE,
+  .id = 4170,
+  .ra = 196.395,
+  .dec = 21.1347,
+},
+{ .is_ngc = FALSE,
+  .id = 4171,
+  .ra = 196.328,
+  .dec = 36.1023,
+},
+{ .is_ngc = FALSE,
+  .id = 4172,
+  .ra = 196.639,
+  .dec = 22.8506,
+},
+{ .is_ngc = FALSE,
+  .id = 4174,
+  .ra = 196.37,
+  .dec = 36.3989,
+},
+{ .is_ngc = FALSE,
+  .id = 4175,
+  .ra = 196.448,
+  .dec = 20.3733,
+},
+{ .is_ngc = FALSE,
+  .id = 4177,
+  .ra = 196.621,
+  .dec = -13.5713,
+},
+{ .is_ngc = FALSE,
+  .id = 4178,
+  .ra = 196.423,
+  .dec = 36.0177,
+},
+{ .is_ngc = FALSE,
+  .id = 4179,
+  .ra = 196.441,
+  .dec = 37.1987,
+},
+{ .is_ngc = FALSE,
+  .id = 4180,
+  .ra = 196.735,
+  .dec = -23.9173,
+},
+{ .is_ngc = FALSE,
+  .id = 4181,
+  .ra = 196.526,
+  .dec = 21.4935,
+},
+{ .is_ngc = FALSE,
+  .id = 4182,
+  .ra = 196.456,
+  .dec = 37.6058,
+},
+{ .is_ngc = FALSE,
+  .id = 4183,
+  .ra = 196.548,
+  .dec = 21.5044,
+},
+{ .is_ngc = FALSE,
+  .id = 4184,
+  .ra = 196.466,
+  .dec = 38.8375,
+},
+{ .is_ngc = FALSE,
+  .id = 4185,
+  .ra = 196.553,
+  .dec = 21.7725,
+},
+{ .is_ngc = FALSE,
+  .id = 4186,
+  .ra = 196.49,
+  .dec = 36.9853,
+},
+{ .is_ngc = FALSE,
+  .id = 4187,
+  .ra = 196.498,
+  .dec = 36.2981,
+},
+{ .is_ngc = FALSE,
+  .id = 4188,
+  .ra = 196.509,
+  .dec = 36.3278,
+},
+{ .is_ngc = FALSE,
+  .id = 4189,
+  .ra = 196.515,
+  .dec = 35.9801,
+},
+{ .is_ngc = FALSE,
+  .id = 4190,
+  .ra = 196.526,
+  .dec = 37.6108,
+},
+{ .is_ngc = FALSE,
+  .id = 4191,
+  .ra = 197.199,
+  .dec = -67.6433,
+},
+{ .is_ngc = FALSE,
+  .id = 4192,
+  .ra = 196.536,
+  .dec = 37.6053,
+},
+{ .is_ngc = FALSE,
+  .id = 4193,
+  .ra = 196.526,
+  .dec = 39.4232,
+},
+{ .is_ngc = FALSE,
+  .id = 4194,
+  .ra = 196.532,
+  .dec = 38.8732,
+},
+{ .is_ngc = FALSE,
+  .id = 4195,
+  .ra = 196.563,
+  .dec = 37.0404,
+},
+{ .is_ngc = FALSE,
+  .id = 4197,
+  .ra = 197.018,
+  .dec = -23.797,
+},
+{ .is_ngc = FALSE,
+  .id = 4199,
+  .ra = 196.886,
+  .dec = 35.8604,
+},
+{ .is_ngc = FALSE,
+  .id = 4200,
+  .ra = 197.395,
+  .dec = -51.9683,
+},
+{ .is_ngc = FALSE,
+  .id = 4201,
+  .ra = 196.963,
+  .dec = 35.8345,
+},
+{ .is_ngc = FALSE,
+  .id = 4202,
+  .ra = 197.132,
+  .dec = 24.7005,
+},
+{ .is_ngc = FALSE,
+  .id = 4203,
+  .ra = 197.079,
+  .dec = 40.4277,
+},
+{ .is_ngc = FALSE,
+  .id = 4204,
+  .ra = 197.09,
+  .dec = 39.4605,
+},
+{ .is_ngc = FALSE,
+  .id = 4206,
+  .ra = 197.341,
+  .dec = 39.0223,
+},
+{ .is_ngc = FALSE,
+  .id = 4207,
+  .ra = 197.363,
+  .dec = 37.8219,
+},
+{ .is_ngc = FALSE,
+  .id = 4208,
+  .ra = 197.408,
+  .dec = 37.2565,
+},
+{ .is_ngc = FALSE,
+  .id = 4209,
+  .ra = 197.594,
+  .dec = -7.17111,
+},
+{ .is_ngc = FALSE,
+  .id = 4211,
+  .ra = 197.736,
+  .dec = 37.1762,
+},
+{ .is_ngc = FALSE,
+  .id = 4212,
+  .ra = 198.012,
+  .dec = -6.99303,
+},
+{ .is_ngc = FALSE,
+  .id = 4213,
+  .ra = 198.047,
+  .dec = 35.6714,
+},
+{ .is_ngc = FALSE,
+  .id = 4214,
+  .ra = 199.429,
+  .dec = -32.1014,
+},
+{ .is_ngc = FALSE,
+  .id = 4215,
+  .ra = 199.07,
+  .dec = 25.405,
+},
+{ .is_ngc = FALSE,
+  .id = 4216,
+  .ra = 199.258,
+  .dec = -10.7704,
+},
+{ .is_ngc = FALSE,
+  .id = 4217,
+  .ra = 199.305,
+  .dec = -13.1556,
+},
+{ .is_ngc = FALSE,
+  .id = 4218,
+  .ra = 199.265,
+  .dec = -2.26166,
+},
+{ .is_ngc = FALSE,
+  .id = 4219,
+  .ra = 199.623,
+  .dec = -31.6311,
+},
+{ .is_ngc = FALSE,
+  .id = 4220,
+  .ra = 199.476,
+  .dec = -13.6058,
+},
+{ .is_ngc = FALSE,
+  .id = 4221,
+  .ra = 199.627,
+  .dec = -14.6089,
+},
+{ .is_ngc = FALSE,
+  .id = 4223,
+  .ra = 199.73,
+  .dec = 7.79531,
+},
+{ .is_ngc = FALSE,
+  .id = 4224,
+  .ra = 199.77,
+  .dec = -2.51569,
+},
+{ .is_ngc = FALSE,
+  .id = 4225,
+  .ra = 200.004,
+  .dec = 31.981,
+},
+{ .is_ngc = FALSE,
+  .id = 4226,
+  .ra = 200.127,
+  .dec = 32.0035,
+},
+{ .is_ngc = FALSE,
+  .id = 4227,
+  .ra = 200.223,
+  .dec = 32.1904,
+},
+{ .is_ngc = FALSE,
+  .id = 4228,
+  .ra = 200.392,
+  .dec = 25.5156,
+},
+{ .is_ngc = FALSE,
+  .id = 4229,
+  .ra = 200.609,
+  .dec = -2.41867,
+},
+{ .is_ngc = FALSE,
+  .id = 4230,
+  .ra = 200.497,
+  .dec = 26.7337,
+},
+{ .is_ngc = FALSE,
+  .id = 4231,
+  .ra = 200.805,
+  .dec = -26.3006,
+},
+{ .is_ngc = FALSE,
+  .id = 4232,
+  .ra = 200.843,
+  .dec = -26.1102,
+},
+{ .is_ngc = FALSE,
+  .id = 4234,
+  .ra = 200.75,
+  .dec = 27.1161,
+},
+{ .is_ngc = FALSE,
+  .id = 4235,
+  .ra = 200.971,
+  .dec = -12.7429,
+},
+{ .is_ngc = FALSE,
+  .id = 4237,
+  .ra = 201.137,
+  .dec = -21.1372,
+},
+{ .is_ngc = FALSE,
+  .id = 4238,
+  .ra = 201,
+  .dec = 30.932,
+},
+{ .is_ngc = FALSE,
+  .id = 4239,
+  .ra = 201.106,
+  .dec = 30.9592,
+},
+{ .is_ngc = FALSE,
+  .id = 4240,
+  .ra = 201.115,
+  .dec = 30.9777,
+},
+{ .is_ngc = FALSE,
+  .id = 4241,
+  .ra = 201.194,
+  .dec = 26.7381,
+},
+{ .is_ngc = FALSE,
+  .id = 4242,
+  .ra = 201.171,
+  .dec = 31.026,
+},
+{ .is_ngc = FALSE,
+  .id = 4243,
+  .ra = 201.463,
+  .dec = -27.6267,
+},
+{ .is_ngc = FALSE,
+  .id = 4244,
+  .ra = 201.234,
+  .dec = 26.4635,
+},
+{ .is_ngc = FALSE,
+  .id = 4245,
+  .ra = 201.496,
+  .dec = -26.6779,
+},
+{ .is_ngc = FALSE,
+  .id = 4246,
+  .ra = 201.501,
+  .dec = -26.6782,
+},
+{ .is_ngc = FALSE,
+  .id = 4247,
+  .ra = 201.686,
+  .dec = -30.3625,
+},
+{ .is_ngc = FALSE,
+  .id = 4248,
+  .ra = 201.697,
+  .dec = -29.8819,
+},
+{ .is_ngc = FALSE,
+  .id = 4249,
+  .ra = 201.777,
+  .dec = -27.9564,
+},
+{ .is_ngc = FALSE,
+  .id = 4250,
+  .ra = 201.538,
+  .dec = 26.4771,
+},
+{ .is_ngc = FALSE,
+  .id = 4251,
+  .ra = 201.851,
+  .dec = -29.4444,
+},
+{ .is_ngc = FALSE,
+  .id = 4252,
+  .ra = 201.868,
+  .dec = -27.3244,
+},
+{ .is_ngc = FALSE,
+  .id = 4253,
+  .ra = 201.885,
+  .dec = -27.8717,
+},
+{ .is_ngc = FALSE,
+  .id = 4254,
+  .ra = 201.939,
+  .dec = -27.2214,
+},
+{ .is_ngc = FALSE,
+  .id = 4255,
+  .ra = 202.001,
+  .dec = -27.3539,
+},
+{ .is_ngc = FALSE,
+  .id = 4256,
+  .ra = 201.763,
+  .dec = 30.9761,
+},
+{ .is_ngc = FALSE,
+  .id = 4257,
+  .ra = 201.835,
+  .dec = 46.8669,
+},
+{ .is_ngc = FALSE,
+  .id = 4257,
+  .ra = 201.837,
+  .dec = 46.9311,
+},
+{ .is_ngc = FALSE,
+  .id = 4258,
+  .ra = 201.972,
+  .dec = 28.5081,
+},
+{ .is_ngc = FALSE,
+  .id = 4259,
+  .ra = 202.368,
+  .dec = -30.1344,
+},
+{ .is_ngc = FALSE,
+  .id = 4260,
+  .ra = 202.418,
+  .dec = -28.2656,
+},
+{ .is_ngc = FALSE,
+  .id = 4261,
+  .ra = 202.449,
+  .dec = -28.0064,
+},
+{ .is_ngc = FALSE,
+  .id = 4262,
+  .ra = 202.597,
+  .dec = -28.2708,
+},
+{ .is_ngc = FALSE,
+  .id = 4263,
+  .ra = 202.139,
+  .dec = 46.9267,
+},
+{ .is_ngc = FALSE,
+  .id = 4264,
+  .ra = 202.574,
+  .dec = -27.9283,
+},
+{ .is_ngc = FALSE,
+  .id = 4265,
+  .ra = 202.595,
+  .dec = -25.7658,
+},
+{ .is_ngc = FALSE,
+  .id = 4266,
+  .ra = 202.274,
+  .dec = 37.6113,
+},
+{ .is_ngc = FALSE,
+  .id = 4267,
+  .ra = 202.65,
+  .dec = -26.2561,
+},
+{ .is_ngc = FALSE,
+  .id = 4268,
+  .ra = 202.301,
+  .dec = 37.6604,
+},
+{ .is_ngc = FALSE,
+  .id = 4269,
+  .ra = 202.337,
+  .dec = 37.6229,
+},
+{ .is_ngc = FALSE,
+  .id = 4270,
+  .ra = 202.704,
+  .dec = -25.3339,
+},
+{ .is_ngc = FALSE,
+  .id = 4272,
+  .ra = 202.818,
+  .dec = -29.9569,
+},
+{ .is_ngc = FALSE,
+  .id = 4273,
+  .ra = 202.874,
+  .dec = -28.8939,
+},
+{ .is_ngc = FALSE,
+  .id = 4275,
+  .ra = 202.964,
+  .dec = -29.7331,
+},
+{ .is_ngc = FALSE,
+  .id = 4276,
+  .ra = 203.026,
+  .dec = -28.1567,
+},
+{ .is_ngc = FALSE,
+  .id = 4277,
+  .ra = 202.569,
+  .dec = 47.3141,
+},
+{ .is_ngc = FALSE,
+  .id = 4278,
+  .ra = 202.614,
+  .dec = 47.2467,
+},
+{ .is_ngc = FALSE,
+  .id = 4279,
+  .ra = 203.129,
+  .dec = -27.1272,
+},
+{ .is_ngc = FALSE,
+  .id = 4280,
+  .ra = 203.225,
+  .dec = -24.2078,
+},
+{ .is_ngc = FALSE,
+  .id = 4281,
+  .ra = 203.16,
+  .dec = -27.1697,
+},
+{ .is_ngc = FALSE,
+  .id = 4282,
+  .ra = 202.832,
+  .dec = 47.1837,
+},
+{ .is_ngc = FALSE,
+  .id = 4283,
+  .ra = 203.045,
+  .dec = 28.3892,
+},
+{ .is_ngc = FALSE,
+  .id = 4284,
+  .ra = 202.883,
+  .dec = 46.7942,
+},
+{ .is_ngc = FALSE,
+  .id = 4285,
+  .ra = 202.94,
+  .dec = 46.8208,
+},
+{ .is_ngc = FALSE,
+  .id = 4286,
+  .ra = 203.4,
+  .dec = -27.6308,
+},
+{ .is_ngc = FALSE,
+  .id = 4288,
+  .ra = 203.626,
+  .dec = -27.3044,
+},
+{ .is_ngc = FALSE,
+  .id = 4289,
+  .ra = 203.7,
+  .dec = -27.1269,
+},
+{ .is_ngc = FALSE,
+  .id = 4290,
+  .ra = 203.832,
+  .dec = -28.0219,
+},
+{ .is_ngc = FALSE,
+  .id = 4291,
+  .ra = 204.234,
+  .dec = -62.0928,
+},
+{ .is_ngc = FALSE,
+  .id = 4292,
+  .ra = 203.945,
+  .dec = -27.6744,
+},
+{ .is_ngc = FALSE,
+  .id = 4293,
+  .ra = 204.008,
+  .dec = -25.8819,
+},
+{ .is_ngc = FALSE,
+  .id = 4294,
+  .ra = 204.13,
+  .dec = -28.7822,
+},
+{ .is_ngc = FALSE,
+  .id = 4295,
+  .ra = 204.144,
+  .dec = -29.0903,
+},
+{ .is_ngc = FALSE,
+  .id = 4296,
+  .ra = 204.162,
+  .dec = -33.9662,
+},
+{ .is_ngc = FALSE,
+  .id = 4297,
+  .ra = 203.83,
+  .dec = 26.4246,
+},
+{ .is_ngc = FALSE,
+  .id = 4298,
+  .ra = 204.145,
+  .dec = -26.5536,
+},
+{ .is_ngc = FALSE,
+  .id = 4299,
+  .ra = 204.198,
+  .dec = -34.0661,
+},
+{ .is_ngc = FALSE,
+  .id = 4300,
+  .ra = 203.855,
+  .dec = 33.4194,
+},
+{ .is_ngc = FALSE,
+  .id = 4301,
+  .ra = 203.899,
+  .dec = 33.3743,
+},
+{ .is_ngc = FALSE,
+  .id = 4302,
+  .ra = 203.9,
+  .dec = 33.4791,
+},
+{ .is_ngc = FALSE,
+  .id = 4303,
+  .ra = 204.327,
+  .dec = -28.6586,
+},
+{ .is_ngc = FALSE,
+  .id = 4304,
+  .ra = 203.991,
+  .dec = 33.4299,
+},
+{ .is_ngc = FALSE,
+  .id = 4305,
+  .ra = 203.993,
+  .dec = 33.4739,
+},
+{ .is_ngc = FALSE,
+  .id = 4306,
+  .ra = 204.082,
+  .dec = 33.4236,
+},
+{ .is_ngc = FALSE,
+  .id = 4307,
+  .ra = 204.151,
+  .dec = 27.2423,
+},
+{ .is_ngc = FALSE,
+  .id = 4308,
+  .ra = 204.218,
+  .dec = 32.7333,
+},
+{ .is_ngc = FALSE,
+  .id = 4309,
+  .ra = 204.709,
+  .dec = -29.6633,
+},
+{ .is_ngc = FALSE,
+  .id = 4310,
+  .ra = 204.737,
+  .dec = -25.8456,
+},
+{ .is_ngc = FALSE,
+  .id = 4311,
+  .ra = 205.033,
+  .dec = -51.0364,
+},
+{ .is_ngc = FALSE,
+  .id = 4312,
+  .ra = 205.129,
+  .dec = -51.0714,
+},
+{ .is_ngc = FALSE,
+  .id = 4313,
+  .ra = 204.586,
+  .dec = 26.7599,
+},
+{ .is_ngc = FALSE,
+  .id = 4314,
+  .ra = 204.604,
+  .dec = 26.7426,
+},
+{ .is_ngc = FALSE,
+  .id = 4315,
+  .ra = 205.012,
+  .dec = -25.475,
+},
+{ .is_ngc = FALSE,
+  .id = 4316,
+  .ra = 205.076,
+  .dec = -28.8933,
+},
+{ .is_ngc = FALSE,
+  .id = 4317,
+  .ra = 205.441,
+  .dec = 27.1064,
+},
+{ .is_ngc = FALSE,
+  .id = 4318,
+  .ra = 205.845,
+  .dec = -28.9683,
+},
+{ .is_ngc = FALSE,
+  .id = 4319,
+  .ra = 205.86,
+  .dec = -29.8042,
+},
+{ .is_ngc = FALSE,
+  .id = 4320,
+  .ra = 206.015,
+  .dec = -27.2314,
+},
+{ .is_ngc = FALSE,
+  .id = 4321,
+  .ra = 206.13,
+  .dec = -30.1403,
+},
+{ .is_ngc = FALSE,
+  .id = 4322,
+  .ra = 205.933,
+  .dec = 25.3916,
+},
+{ .is_ngc = FALSE,
+  .id = 4323,
+  .ra = 206.278,
+  .dec = -28.6519,
+},
+{ .is_ngc = FALSE,
+  .id = 4324,
+  .ra = 206.362,
+  .dec = -30.2281,
+},
+{ .is_ngc = FALSE,
+  .id = 4325,
+  .ra = 206.915,
+  .dec = -29.4344,
+},
+{ .is_ngc = FALSE,
+  .id = 4326,
+  .ra = 207.09,
+  .dec = -29.6267,
+},
+{ .is_ngc = FALSE,
+  .id = 4327,
+  .ra = 207.184,
+  .dec = -30.2181,
+},
+{ .is_ngc = FALSE,
+  .id = 4328,
+  .ra = 207.262,
+  .dec = -29.9378,
+},
+{ .is_ngc = FALSE,
+  .id = 4329,
+  .ra = 207.272,
+  .dec = -30.2967,
+},
+{ .is_ngc = FALSE,
+  .id = 4330,
+  .ra = 206.812,
+  .dec = -28.3317,
+},
+{ .is_ngc = FALSE,
+  .id = 4331,
+  .ra = 207.353,
+  .dec = 25.154,
+},
+{ .is_ngc = FALSE,
+  .id = 4332,
+  .ra = 207.469,
+  .dec = 25.19,
+},
+{ .is_ngc = FALSE,
+  .id = 4333,
+  .ra = 211.332,
+  .dec = -84.2731,
+},
+{ .is_ngc = FALSE,
+  .id = 4334,
+  .ra = 207.451,
+  .dec = 29.6936,
+},
+{ .is_ngc = FALSE,
+  .id = 4335,
+  .ra = 207.438,
+  .dec = 33.6731,
+},
+{ .is_ngc = FALSE,
+  .id = 4336,
+  .ra = 207.68,
+  .dec = 39.7066,
+},
+{ .is_ngc = FALSE,
+  .id = 4337,
+  .ra = 208.08,
+  .dec = 14.2718,
+},
+{ .is_ngc = FALSE,
+  .id = 4339,
+  .ra = 208.371,
+  .dec = 37.5386,
+},
+{ .is_ngc = FALSE,
+  .id = 4340,
+  .ra = 208.39,
+  .dec = 37.3866,
+},
+{ .is_ngc = FALSE,
+  .id = 4341,
+  .ra = 208.393,
+  .dec = 37.5218,
+},
+{ .is_ngc = FALSE,
+  .id = 4342,
+  .ra = 208.592,
+  .dec = 25.1525,
+},
+{ .is_ngc = FALSE,
+  .id = 4343,
+  .ra = 208.732,
+  .dec = 25.1223,
+},
+{ .is_ngc = FALSE,
+  .id = 4344,
+  .ra = 208.803,
+  .dec = 25.0211,
+},
+{ .is_ngc = FALSE,
+  .id = 4345,
+  .ra = 208.806,
+  .dec = 25.0514,
+},
+{ .is_ngc = FALSE,
+  .id = 4346,
+  .ra = 208.919,
+  .dec = 25.1526,
+},
+{ .is_ngc = FALSE,
+  .id = 4348,
+  .ra = 208.938,
+  .dec = 25.2031,
+},
+{ .is_ngc = FALSE,
+  .id = 4349,
+  .ra = 208.943,
+  .dec = 25.1517,
+},
+{ .is_ngc = FALSE,
+  .id = 4350,
+  .ra = 209.308,
+  .dec = -25.2456,
+},
+{ .is_ngc = FALSE,
+  .id = 4351,
+  .ra = 209.475,
+  .dec = -29.3153,
+},
+{ .is_ngc = FALSE,
+  .id = 4352,
+  .ra = 209.605,
+  .dec = -34.5175,
+},
+{ .is_ngc = FALSE,
+  .id = 4353,
+  .ra = 209.265,
+  .dec = 37.7289,
+},
+{ .is_ngc = FALSE,
+  .id = 4353,
+  .ra = 209.237,
+  .dec = 37.7394,
+},
+{ .is_ngc = FALSE,
+  .id = 4354,
+  .ra = 209.628,
+  .dec = -12.6053,
+},
+{ .is_ngc = FALSE,
+  .id = 4355,
+  .ra = 209.525,
+  .dec = 28.4219,
+},
+{ .is_ngc = FALSE,
+  .id = 4356,
+  .ra = 209.688,
+  .dec = 37.4904,
+},
+{ .is_ngc = FALSE,
+  .id = 4357,
+  .ra = 210.182,
+  .dec = 31.8938,
+},
+{ .is_ngc = FALSE,
+  .id = 4358,
+  .ra = 210.893,
+  .dec = -10.1515,
+},
+{ .is_ngc = FALSE,
+  .id = 4359,
+  .ra = 211.347,
+  .dec = -45.2694,
+},
+{ .is_ngc = FALSE,
+  .id = 4360,
+  .ra = 211.089,
+  .dec = -11.4249,
+},
+{ .is_ngc = FALSE,
+  .id = 4361,
+  .ra = 211.031,
+  .dec = -9.76878,
+},
+{ .is_ngc = FALSE,
+  .id = 4362,
+  .ra = 211.343,
+  .dec = -41.8192,
+},
+{ .is_ngc = FALSE,
+  .id = 4363,
+  .ra = 211.051,
+  .dec = -9.64147,
+},
+{ .is_ngc = FALSE,
+  .id = 4364,
+  .ra = 211.082,
+  .dec = -9.99342,
+},
+{ .is_ngc = FALSE,
+  .id = 4366,
+  .ra = 211.298,
+  .dec = -33.7608,
+},
+{ .is_ngc = FALSE,
+  .id = 4367,
+  .ra = 211.402,
+  .dec = -39.2028,
+},
+{ .is_ngc = FALSE,
+  .id = 4368,
+  .ra = 211.193,
+  .dec = -9.96212,
+},
+{ .is_ngc = FALSE,
+  .id = 4369,
+  .ra = 211.025,
+  .dec = 33.3203,
+},
+{ .is_ngc = FALSE,
+  .id = 4370,
+  .ra = 211.041,
+  .dec = 33.3458,
+},
+{ .is_ngc = FALSE,
+  .id = 4371,
+  .ra = 211.046,
+  .dec = 33.3075,
+},
+{ .is_ngc = FALSE,
+  .id = 4372,
+  .ra = 211.442,
+  .dec = -10.9,
+},
+{ .is_ngc = FALSE,
+  .id = 4373,
+  .ra = 211.43,
+  .dec = 25.2313,
+},
+{ .is_ngc = FALSE,
+  .id = 4374,
+  .ra = 211.874,
+  .dec = -27.0181,
+},
+{ .is_ngc = FALSE,
+  .id = 4376,
+  .ra = 212.71,
+  .dec = -30.7931,
+},
+{ .is_ngc = FALSE,
+  .id = 4377,
+  .ra = 214.245,
+  .dec = -75.6467,
+},
+{ .is_ngc = FALSE,
+  .id = 4378,
+  .ra = 213.041,
+  .dec = -34.2656,
+},
+{ .is_ngc = FALSE,
+  .id = 4379,
+  .ra = 213.042,
+  .dec = -34.2719,
+},
+{ .is_ngc = FALSE,
+  .id = 4380,
+  .ra = 212.509,
+  .dec = 37.5505,
+},
+{ .is_ngc = FALSE,
+  .id = 4382,
+  .ra = 212.76,
+  .dec = 25.5192,
+},
+{ .is_ngc = FALSE,
+  .id = 4384,
+  .ra = 212.984,
+  .dec = 27.1139,
+},
+{ .is_ngc = FALSE,
+  .id = 4385,
+  .ra = 213.632,
+  .dec = -42.3236,
+},
+{ .is_ngc = FALSE,
+  .id = 4386,
+  .ra = 213.761,
+  .dec = -43.9619,
+},
+{ .is_ngc = FALSE,
+  .id = 4387,
+  .ra = 213.757,
+  .dec = -43.9911,
+},
+{ .is_ngc = FALSE,
+  .id = 4388,
+  .ra = 214.015,
+  .dec = -31.7525,
+},
+{ .is_ngc = FALSE,
+  .id = 4389,
+  .ra = 214.193,
+  .dec = -40.5531,
+},
+{ .is_ngc = FALSE,
+  .id = 4390,
+  .ra = 214.248,
+  .dec = -44.9786,
+},
+{ .is_ngc = FALSE,
+  .id = 4391,
+  .ra = 214.114,
+  .dec = -31.6842,
+},
+{ .is_ngc = FALSE,
+  .id = 4392,
+  .ra = 213.972,
+  .dec = -13.0511,
+},
+{ .is_ngc = FALSE,
+  .id = 4393,
+  .ra = 214.455,
+  .dec = -31.3486,
+},
+{ .is_ngc = FALSE,
+  .id = 4394,
+  .ra = 214.093,
+  .dec = 39.6975,
+},
+{ .is_ngc = FALSE,
+  .id = 4395,
+  .ra = 214.337,
+  .dec = 26.8575,
+},
+{ .is_ngc = FALSE,
+  .id = 4396,
+  .ra = 214.376,
+  .dec = 28.7994,
+},
+{ .is_ngc = FALSE,
+  .id = 4397,
+  .ra = 214.495,
+  .dec = 26.4133,
+},
+{ .is_ngc = FALSE,
+  .id = 4398,
+  .ra = 214.515,
+  .dec = 28.8658,
+},
+{ .is_ngc = FALSE,
+  .id = 4399,
+  .ra = 214.6,
+  .dec = 26.3856,
+},
+{ .is_ngc = FALSE,
+  .id = 4400,
+  .ra = 215.557,
+  .dec = -60.5694,
+},
+{ .is_ngc = FALSE,
+  .id = 4401,
+  .ra = 214.855,
+  .dec = -4.48969,
+},
+{ .is_ngc = FALSE,
+  .id = 4402,
+  .ra = 215.305,
+  .dec = -46.2983,
+},
+{ .is_ngc = FALSE,
+  .id = 4403,
+  .ra = 214.57,
+  .dec = 31.6536,
+},
+{ .is_ngc = FALSE,
+  .id = 4404,
+  .ra = 212.463,
+  .dec = 78.6278,
+},
+{ .is_ngc = FALSE,
+  .id = 4405,
+  .ra = 214.819,
+  .dec = 26.2982,
+},
+{ .is_ngc = FALSE,
+  .id = 4406,
+  .ra = 215.609,
+  .dec = -44.1511,
+},
+{ .is_ngc = FALSE,
+  .id = 4407,
+  .ra = 215.904,
+  .dec = -5.98208,
+},
+{ .is_ngc = FALSE,
+  .id = 4408,
+  .ra = 215.305,
+  .dec = 29.9934,
+},
+{ .is_ngc = FALSE,
+  .id = 4409,
+  .ra = 215.389,
+  .dec = 31.5856,
+},
+{ .is_ngc = FALSE,
+  .id = 4410,
+  .ra = 215.558,
+  .dec = 17.3967,
+},
+{ .is_ngc = FALSE,
+  .id = 4411,
+  .ra = 216.254,
+  .dec = -35.0172,
+},
+{ .is_ngc = FALSE,
+  .id = 4413,
+  .ra = 215.739,
+  .dec = 37.5274,
+},
+{ .is_ngc = FALSE,
+  .id = 4415,
+  .ra = 216.111,
+  .dec = 16.6391,
+},
+{ .is_ngc = FALSE,
+  .id = 4416,
+  .ra = 216.073,
+  .dec = 29.6358,
+},
+{ .is_ngc = FALSE,
+  .id = 4417,
+  .ra = 216.224,
+  .dec = 17.0379,
+},
+{ .is_ngc = FALSE,
+  .id = 4418,
+  .ra = 216.364,
+  .dec = 25.5263,
+},
+{ .is_ngc = FALSE,
+  .id = 4419,
+  .ra = 216.478,
+  .dec = 16.6319,
+},
+{ .is_ngc = FALSE,
+  .id = 4420,
+  .ra = 216.414,
+  .dec = 25.3781,
+},
+{ .is_ngc = FALSE,
+  .id = 4421,
+  .ra = 217.13,
+  .dec = -37.5833,
+},
+{ .is_ngc = FALSE,
+  .id = 4422,
+  .ra = 216.496,
+  .dec = 30.4737,
+},
+{ .is_ngc = FALSE,
+  .id = 4423,
+  .ra = 216.574,
+  .dec = 26.2456,
+},
+{ .is_ngc = FALSE,
+  .id = 4425,
+  .ra = 216.684,
+  .dec = 27.1892,
+},
+{ .is_ngc = FALSE,
+  .id = 4426,
+  .ra = 216.821,
+  .dec = 16.8313,
+},
+{ .is_ngc = FALSE,
+  .id = 4427,
+  .ra = 216.748,
+  .dec = 26.8636,
+},
+{ .is_ngc = FALSE,
+  .id = 4428,
+  .ra = 216.857,
+  .dec = 16.1906,
+},
+{ .is_ngc = FALSE,
+  .id = 4429,
+  .ra = 216.905,
+  .dec = 16.8999,
+},
+{ .is_ngc = FALSE,
+  .id = 4430,
+  .ra = 217.33,
+  .dec = -33.455,
+},
+{ .is_ngc = FALSE,
+  .id = 4432,
+  .ra = 217.207,
+  .dec = -39.5517,
+},
+{ .is_ngc = FALSE,
+  .id = 4433,
+  .ra = 216.972,
+  .dec = 16.1953,
+},
+{ .is_ngc = FALSE,
+  .id = 4434,
+  .ra = 216.978,
+  .dec = 16.207,
+},
+{ .is_ngc = FALSE,
+  .id = 4435,
+  .ra = 216.851,
+  .dec = 37.4714,
+},
+{ .is_ngc = FALSE,
+  .id = 4436,
+  .ra = 216.993,
+  .dec = 26.5042,
+},
+{ .is_ngc = FALSE,
+  .id = 4437,
+  .ra = 216.854,
+  .dec = 41.4839,
+},
+{ .is_ngc = FALSE,
+  .id = 4437,
+  .ra = 216.883,
+  .dec = 41.5023,
+},
+{ .is_ngc = FALSE,
+  .id = 4438,
+  .ra = 217.144,
+  .dec = 17.3341,
+},
+{ .is_ngc = FALSE,
+  .id = 4439,
+  .ra = 217.167,
+  .dec = 17.0245,
+},
+{ .is_ngc = FALSE,
+  .id = 4440,
+  .ra = 217.246,
+  .dec = 17.3205,
+},
+{ .is_ngc = FALSE,
+  .id = 4442,
+  .ra = 217.189,
+  .dec = 28.9644,
+},
+{ .is_ngc = FALSE,
+  .id = 4443,
+  .ra = 217.323,
+  .dec = 16.1812,
+},
+{ .is_ngc = FALSE,
+  .id = 4445,
+  .ra = 217.977,
+  .dec = -46.0347,
+},
+{ .is_ngc = FALSE,
+  .id = 4446,
+  .ra = 217.256,
+  .dec = 37.4632,
+},
+{ .is_ngc = FALSE,
+  .id = 4447,
+  .ra = 217.325,
+  .dec = 30.832,
+},
+{ .is_ngc = FALSE,
+  .id = 4448,
+  .ra = 220.116,
+  .dec = -78.8099,
+},
+{ .is_ngc = FALSE,
+  .id = 4449,
+  .ra = 217.84,
+  .dec = 15.2404,
+},
+{ .is_ngc = FALSE,
+  .id = 4450,
+  .ra = 218.052,
+  .dec = 28.5568,
+},
+{ .is_ngc = FALSE,
+  .id = 4451,
+  .ra = 218.655,
+  .dec = -36.2858,
+},
+{ .is_ngc = FALSE,
+  .id = 4452,
+  .ra = 218.115,
+  .dec = 27.4269,
+},
+{ .is_ngc = FALSE,
+  .id = 4453,
+  .ra = 218.62,
+  .dec = -27.5183,
+},
+{ .is_ngc = FALSE,
+  .id = 4454,
+  .ra = 218.319,
+  .dec = 17.712,
+},
+{ .is_ngc = FALSE,
+  .id = 4456,
+  .ra = 218.538,
+  .dec = 16.1838,
+},
+{ .is_ngc = FALSE,
+  .id = 4457,
+  .ra = 218.62,
+  .dec = 18.2245,
+},
+{ .is_ngc = FALSE,
+  .id = 4458,
+  .ra = 219.524,
+  .dec = -39.5061,
+},
+{ .is_ngc = FALSE,
+  .id = 4459,
+  .ra = 218.634,
+  .dec = 30.9739,
+},
+{ .is_ngc = FALSE,
+  .id = 4460,
+  .ra = 218.653,
+  .dec = 30.2792,
+},
+{ .is_ngc = FALSE,
+  .id = 4461,
+  .ra = 218.758,
+  .dec = 26.544,
+},
+{ .is_ngc = FALSE,
+  .id = 4462,
+  .ra = 218.768,
+  .dec = 26.5407,
+},
+{ .is_ngc = FALSE,
+  .id = 4463,
+  .ra = 218.954,
+  .dec = 16.0189,
+},
+{ .is_ngc = FALSE,
+  .id = 4464,
+  .ra = 219.454,
+  .dec = -36.8781,
+},
+{ .is_ngc = FALSE,
+  .id = 4465,
+  .ra = 218.963,
+  .dec = 15.5729,
+},
+{ .is_ngc = FALSE,
+  .id = 4466,
+  .ra = 219.199,
+  .dec = 18.3428,
+},
+{ .is_ngc = FALSE,
+  .id = 4467,
+  .ra = 219.224,
+  .dec = 18.3706,
+},
+{ .is_ngc = FALSE,
+  .id = 4468,
+  .ra = 219.612,
+  .dec = -22.3672,
+},
+{ .is_ngc = FALSE,
+  .id = 4469,
+  .ra = 219.336,
+  .dec = 18.2486,
+},
+{ .is_ngc = FALSE,
+  .id = 4470,
+  .ra = 217.095,
+  .dec = 78.8852,
+},
+{ .is_ngc = FALSE,
+  .id = 4472,
+  .ra = 220.045,
+  .dec = -44.3158,
+},
+{ .is_ngc = FALSE,
+  .id = 4473,
+  .ra = 219.475,
+  .dec = 15.8617,
+},
+{ .is_ngc = FALSE,
+  .id = 4474,
+  .ra = 219.593,
+  .dec = 23.4286,
+},
+{ .is_ngc = FALSE,
+  .id = 4475,
+  .ra = 219.597,
+  .dec = 23.3332,
+},
+{ .is_ngc = FALSE,
+  .id = 4476,
+  .ra = 219.966,
+  .dec = -16.2449,
+},
+{ .is_ngc = FALSE,
+  .id = 4477,
+  .ra = 219.647,
+  .dec = 28.4586,
+},
+{ .is_ngc = FALSE,
+  .id = 4478,
+  .ra = 219.803,
+  .dec = 15.8775,
+},
+{ .is_ngc = FALSE,
+  .id = 4479,
+  .ra = 219.691,
+  .dec = 28.5053,
+},
+{ .is_ngc = FALSE,
+  .id = 4480,
+  .ra = 219.94,
+  .dec = 18.4919,
+},
+{ .is_ngc = FALSE,
+  .id = 4481,
+  .ra = 220.042,
+  .dec = 16.1414,
+},
+{ .is_ngc = FALSE,
+  .id = 4482,
+  .ra = 220.052,
+  .dec = 18.9431,
+},
+{ .is_ngc = FALSE,
+  .id = 4483,
+  .ra = 220.081,
+  .dec = 16.6849,
+},
+{ .is_ngc = FALSE,
+  .id = 4484,
+  .ra = 221.933,
+  .dec = -73.3064,
+},
+{ .is_ngc = FALSE,
+  .id = 4485,
+  .ra = 220.131,
+  .dec = 28.6687,
+},
+{ .is_ngc = FALSE,
+  .id = 4486,
+  .ra = 220.42,
+  .dec = 18.5569,
+},
+{ .is_ngc = FALSE,
+  .id = 4487,
+  .ra = 220.467,
+  .dec = 18.5764,
+},
+{ .is_ngc = FALSE,
+  .id = 4488,
+  .ra = 220.719,
+  .dec = 18.6201,
+},
+{ .is_ngc = FALSE,
+  .id = 4489,
+  .ra = 220.817,
+  .dec = 18.5283,
+},
+{ .is_ngc = FALSE,
+  .id = 4490,
+  .ra = 221.34,
+  .dec = -36.1733,
+},
+{ .is_ngc = FALSE,
+  .id = 4492,
+  .ra = 220.641,
+  .dec = 37.4524,
+},
+{ .is_ngc = FALSE,
+  .id = 4494,
+  .ra = 221.107,
+  .dec = 15.5514,
+},
+{ .is_ngc = FALSE,
+  .id = 4495,
+  .ra = 221.061,
+  .dec = 23.5583,
+},
+{ .is_ngc = FALSE,
+  .id = 4496,
+  .ra = 220.977,
+  .dec = 33.4065,
+},
+{ .is_ngc = FALSE,
+  .id = 4497,
+  .ra = 221.087,
+  .dec = 28.5504,
+},
+{ .is_ngc = FALSE,
+  .id = 4498,
+  .ra = 221.253,
+  .dec = 26.3,
+},
+{ .is_ngc = FALSE,
+  .id = 4499,
+  .ra = 225.079,
+  .dec = -82.2136,
+},
+{ .is_ngc = FALSE,
+  .id = 4500,
+  .ra = 221.149,
+  .dec = 37.4824,
+},
+{ .is_ngc = FALSE,
+  .id = 4501,
+  .ra = 221.855,
+  .dec = -22.4064,
+},
+{ .is_ngc = FALSE,
+  .id = 4502,
+  .ra = 221.315,
+  .dec = 37.2996,
+},
+{ .is_ngc = FALSE,
+  .id = 4503,
+  .ra = 221.665,
+  .dec = 16.1461,
+},
+{ .is_ngc = FALSE,
+  .id = 4504,
+  .ra = 221.654,
+  .dec = 31.6991,
+},
+{ .is_ngc = FALSE,
+  .id = 4505,
+  .ra = 221.639,
+  .dec = 33.4083,
+},
+{ .is_ngc = FALSE,
+  .id = 4506,
+  .ra = 221.666,
+  .dec = 33.4009,
+},
+{ .is_ngc = FALSE,
+  .id = 4507,
+  .ra = 221.926,
+  .dec = 18.455,
+},
+{ .is_ngc = FALSE,
+  .id = 4508,
+  .ra = 221.962,
+  .dec = 31.7648,
+},
+{ .is_ngc = FALSE,
+  .id = 4509,
+  .ra = 222.113,
+  .dec = 31.7913,
+},
+{ .is_ngc = FALSE,
+  .id = 4510,
+  .ra = 222.667,
+  .dec = -20.7192,
+},
+{ .is_ngc = FALSE,
+  .id = 4511,
+  .ra = 223.021,
+  .dec = -40.4853,
+},
+{ .is_ngc = FALSE,
+  .id = 4512,
+  .ra = 222.476,
+  .dec = 27.7004,
+},
+{ .is_ngc = FALSE,
+  .id = 4513,
+  .ra = 223.067,
+  .dec = -20.7186,
+},
+{ .is_ngc = FALSE,
+  .id = 4514,
+  .ra = 222.731,
+  .dec = 27.5783,
+},
+{ .is_ngc = FALSE,
+  .id = 4515,
+  .ra = 222.778,
+  .dec = 37.4947,
+},
+{ .is_ngc = FALSE,
+  .id = 4516,
+  .ra = 223.598,
+  .dec = 16.3551,
+},
+{ .is_ngc = FALSE,
+  .id = 4517,
+  .ra = 223.646,
+  .dec = 23.6428,
+},
+{ .is_ngc = FALSE,
+  .id = 4519,
+  .ra = 223.686,
+  .dec = 37.4126,
+},
+{ .is_ngc = FALSE,
+  .id = 4520,
+  .ra = 223.779,
+  .dec = 33.7242,
+},
+{ .is_ngc = FALSE,
+  .id = 4521,
+  .ra = 224.864,
+  .dec = 25.5831,
+},
+{ .is_ngc = FALSE,
+  .id = 4522,
+  .ra = 227.872,
+  .dec = -75.8592,
+},
+{ .is_ngc = FALSE,
+  .id = 4523,
+  .ra = 226.293,
+  .dec = -43.5094,
+},
+{ .is_ngc = FALSE,
+  .id = 4524,
+  .ra = 225.526,
+  .dec = 25.6006,
+},
+{ .is_ngc = FALSE,
+  .id = 4525,
+  .ra = 225.603,
+  .dec = 25.6377,
+},
+{ .is_ngc = FALSE,
+  .id = 4526,
+  .ra = 225.66,
+  .dec = 23.3493,
+},
+{ .is_ngc = FALSE,
+  .id = 4527,
+  .ra = 226.42,
+  .dec = -42.4486,
+},
+{ .is_ngc = FALSE,
+  .id = 4528,
+  .ra = 225.389,
+  .dec = 49.1122,
+},
+{ .is_ngc = FALSE,
+  .id = 4529,
+  .ra = 226.607,
+  .dec = -43.2339,
+},
+{ .is_ngc = FALSE,
+  .id = 4530,
+  .ra = 225.939,
+  .dec = 26.1002,
+},
+{ .is_ngc = FALSE,
+  .id = 4531,
+  .ra = 226.111,
+  .dec = 23.4148,
+},
+{ .is_ngc = FALSE,
+  .id = 4532,
+  .ra = 226.225,
+  .dec = 23.2571,
+},
+{ .is_ngc = FALSE,
+  .id = 4533,
+  .ra = 226.127,
+  .dec = 27.7928,
+},
+{ .is_ngc = FALSE,
+  .id = 4534,
+  .ra = 226.674,
+  .dec = 23.6418,
+},
+{ .is_ngc = FALSE,
+  .id = 4535,
+  .ra = 227.173,
+  .dec = 37.5704,
+},
+{ .is_ngc = FALSE,
+  .id = 4536,
+  .ra = 228.322,
+  .dec = -18.1376,
+},
+{ .is_ngc = FALSE,
+  .id = 4537,
+  .ra = 229.385,
+  .dec = 2.04688,
+},
+{ .is_ngc = FALSE,
+  .id = 4538,
+  .ra = 230.297,
+  .dec = -23.6581,
+},
+{ .is_ngc = FALSE,
+  .id = 4539,
+  .ra = 229.629,
+  .dec = 32.3925,
+},
+{ .is_ngc = FALSE,
+  .id = 4540,
+  .ra = 230.012,
+  .dec = 1.78389,
+},
+{ .is_ngc = FALSE,
+  .id = 4540,
+  .ra = 229.831,
+  .dec = 1.83833,
+},
+{ .is_ngc = FALSE,
+  .id = 4541,
+  .ra = 232.483,
+  .dec = -70.5839,
+},
+{ .is_ngc = FALSE,
+  .id = 4544,
+  .ra = 232.354,
+  .dec = -50.5689,
+},
+{ .is_ngc = FALSE,
+  .id = 4545,
+  .ra = 235.368,
+  .dec = -81.6261,
+},
+{ .is_ngc = FALSE,
+  .id = 4546,
+  .ra = 231.743,
+  .dec = 28.8519,
+},
+{ .is_ngc = FALSE,
+  .id = 4547,
+  .ra = 231.813,
+  .dec = 28.7887,
+},
+{ .is_ngc = FALSE,
+  .id = 4548,
+  .ra = 231.85,
+  .dec = 28.8498,
+},
+{ .is_ngc = FALSE,
+  .id = 4549,
+  .ra = 232.311,
+  .dec = 32.8253,
+},
+{ .is_ngc = FALSE,
+  .id = 4552,
+  .ra = 234.729,
+  .dec = 4.58281,
+},
+{ .is_ngc = FALSE,
+  .id = 4554,
+  .ra = 233.77,
+  .dec = 23.4792,
+},
+{ .is_ngc = FALSE,
+  .id = 4555,
+  .ra = 237.063,
+  .dec = -78.18,
+},
+{ .is_ngc = FALSE,
+  .id = 4556,
+  .ra = 233.844,
+  .dec = 25.2969,
+},
+{ .is_ngc = FALSE,
+  .id = 4557,
+  .ra = 233.654,
+  .dec = 39.7287,
+},
+{ .is_ngc = FALSE,
+  .id = 4558,
+  .ra = 233.942,
+  .dec = 25.3452,
+},
+{ .is_ngc = FALSE,
+  .id = 4559,
+  .ra = 233.973,
+  .dec = 25.3411,
+},
+{ .is_ngc = FALSE,
+  .id = 4560,
+  .ra = 233.975,
+  .dec = 39.8143,
+},
+{ .is_ngc = FALSE,
+  .id = 4561,
+  .ra = 234.196,
+  .dec = 25.4164,
+},
+{ .is_ngc = FALSE,
+  .id = 4562,
+  .ra = 233.988,
+  .dec = 43.4933,
+},
+{ .is_ngc = FALSE,
+  .id = 4563,
+  .ra = 234.015,
+  .dec = 39.8313,
+},
+{ .is_ngc = FALSE,
+  .id = 4564,
+  .ra = 234.112,
+  .dec = 43.5186,
+},
+{ .is_ngc = FALSE,
+  .id = 4565,
+  .ra = 234.147,
+  .dec = 43.4247,
+},
+{ .is_ngc = FALSE,
+  .id = 4566,
+  .ra = 234.176,
+  .dec = 43.5393,
+},
+{ .is_ngc = FALSE,
+  .id = 4567,
+  .ra = 234.306,
+  .dec = 43.2978,
+},
+{ .is_ngc = FALSE,
+  .id = 4568,
+  .ra = 235.032,
+  .dec = 28.1517,
+},
+{ .is_ngc = FALSE,
+  .id = 4569,
+  .ra = 235.202,
+  .dec = 28.2921,
+},
+{ .is_ngc = FALSE,
+  .id = 4570,
+  .ra = 235.344,
+  .dec = 28.2296,
+},
+{ .is_ngc = FALSE,
+  .id = 4571,
+  .ra = 237.215,
+  .dec = -67.3236,
+},
+{ .is_ngc = FALSE,
+  .id = 4572,
+  .ra = 235.476,
+  .dec = 28.1337,
+},
+{ .is_ngc = FALSE,
+  .id = 4573,
+  .ra = 235.551,
+  .dec = 23.7997,
+},
+{ .is_ngc = FALSE,
+  .id = 4574,
+  .ra = 235.497,
+  .dec = 28.24,
+},
+{ .is_ngc = FALSE,
+  .id = 4575,
+  .ra = 235.582,
+  .dec = 23.8076,
+},
+{ .is_ngc = FALSE,
+  .id = 4576,
+  .ra = 235.648,
+  .dec = 23.67,
+},
+{ .is_ngc = FALSE,
+  .id = 4577,
+  .ra = 235.69,
+  .dec = 23.7926,
+},
+{ .is_ngc = FALSE,
+  .id = 4578,
+  .ra = 238.298,
+  .dec = -74.8258,
+},
+{ .is_ngc = FALSE,
+  .id = 4579,
+  .ra = 235.715,
+  .dec = 23.773,
+},
+{ .is_ngc = FALSE,
+  .id = 4580,
+  .ra = 235.81,
+  .dec = 28.3566,
+},
+{ .is_ngc = FALSE,
+  .id = 4581,
+  .ra = 236.006,
+  .dec = 28.2767,
+},
+{ .is_ngc = FALSE,
+  .id = 4582,
+  .ra = 236.414,
+  .dec = 28.0885,
+},
+{ .is_ngc = FALSE,
+  .id = 4583,
+  .ra = 236.591,
+  .dec = 23.8083,
+},
+{ .is_ngc = FALSE,
+  .id = 4584,
+  .ra = 240.051,
+  .dec = -66.3828,
+},
+{ .is_ngc = FALSE,
+  .id = 4585,
+  .ra = 240.07,
+  .dec = -66.3228,
+},
+{ .is_ngc = FALSE,
+  .id = 4587,
+  .ra = 239.965,
+  .dec = 25.9408,
+},
+{ .is_ngc = FALSE,
+  .id = 4588,
+  .ra = 241.267,
+  .dec = 23.9166,
+},
+{ .is_ngc = FALSE,
+  .id = 4589,
+  .ra = 241.852,
+  .dec = -6.38531,
+},
+{ .is_ngc = FALSE,
+  .id = 4590,
+  .ra = 242.088,
+  .dec = 28.4784,
+},
+{ .is_ngc = FALSE,
+  .id = 4591,
+  .ra = 243.075,
+  .dec = -27.9183,
+},
+{ .is_ngc = FALSE,
+  .id = 4592,
+  .ra = 242.996,
+  .dec = -19.4511,
+},
+{ .is_ngc = FALSE,
+  .id = 4593,
+  .ra = 242.935,
+  .dec = 12.0719,
+},
+{ .is_ngc = FALSE,
+  .id = 4595,
+  .ra = 245.184,
+  .dec = -70.1426,
+},
+{ .is_ngc = FALSE,
+  .id = 4596,
+  .ra = 244.015,
+  .dec = -22.6251,
+},
+{ .is_ngc = FALSE,
+  .id = 4598,
+  .ra = 244.555,
+  .dec = -31.4422,
+},
+{ .is_ngc = FALSE,
+  .id = 4599,
+  .ra = 244.847,
+  .dec = -42.2601,
+},
+{ .is_ngc = FALSE,
+  .id = 4600,
+  .ra = 244.562,
+  .dec = -22.7689,
+},
+{ .is_ngc = FALSE,
+  .id = 4600,
+  .ra = 244.536,
+  .dec = -22.7853,
+},
+{ .is_ngc = FALSE,
+  .id = 4600,
+  .ra = 244.022,
+  .dec = -22.7832,
+},
+{ .is_ngc = FALSE,
+  .id = 4601,
+  .ra = 245.075,
+  .dec = -20.0692,
+},
+{ .is_ngc = FALSE,
+  .id = 4603,
+  .ra = 246.35,
+  .dec = -24.4667,
+},
+{ .is_ngc = FALSE,
+  .id = 4604,
+  .ra = 246.387,
+  .dec = -23.435,
+},
+{ .is_ngc = FALSE,
+  .id = 4605,
+  .ra = 247.55,
+  .dec = -25.1025,
+},
+{ .is_ngc = FALSE,
+  .id = 4606,
+  .ra = 247.887,
+  .dec = -26.0511,
+},
+{ .is_ngc = FALSE,
+  .id = 4607,
+  .ra = 247.566,
+  .dec = 24.5745,
+},
+{ .is_ngc = FALSE,
+  .id = 4608,
+  .ra = 251.725,
+  .dec = -77.4897,
+},
+{ .is_ngc = FALSE,
+  .id = 4609,
+  .ra = 248.257,
+  .dec = 22.7974,
+},
+{ .is_ngc = FALSE,
+  .id = 4610,
+  .ra = 248.413,
+  .dec = 39.2572,
+},
+{ .is_ngc = FALSE,
+  .id = 4611,
+  .ra = 248.426,
+  .dec = 39.185,
+},
+{ .is_ngc = FALSE,
+  .id = 4612,
+  .ra = 248.457,
+  .dec = 39.263,
+},
+{ .is_ngc = FALSE,
+  .id = 4613,
+  .ra = 249.292,
+  .dec = 36.1189,
+},
+{ .is_ngc = FALSE,
+  .id = 4614,
+  .ra = 249.447,
+  .dec = 36.1148,
+},
+{ .is_ngc = FALSE,
+  .id = 4617,
+  .ra = 250.534,
+  .dec = 36.6837,
+},
+{ .is_ngc = FALSE,
+  .id = 4618,
+  .ra = 254.461,
+  .dec = -76.9922,
+},
+{ .is_ngc = FALSE,
+  .id = 4619,
+  .ra = 251.046,
+  .dec = 17.7586,
+},
+{ .is_ngc = FALSE,
+  .id = 4620,
+  .ra = 252.125,
+  .dec = 19.3051,
+},
+{ .is_ngc = FALSE,
+  .id = 4621,
+  .ra = 252.713,
+  .dec = 8.78382,
+},
+{ .is_ngc = FALSE,
+  .id = 4622,
+  .ra = 253.033,
+  .dec = -16.2339,
+},
+{ .is_ngc = FALSE,
+  .id = 4623,
+  .ra = 252.773,
+  .dec = 22.5272,
+},
+{ .is_ngc = FALSE,
+  .id = 4624,
+  .ra = 252.889,
+  .dec = 17.4486,
+},
+{ .is_ngc = FALSE,
+  .id = 4626,
+  .ra = 253.339,
+  .dec = 2.33861,
+},
+{ .is_ngc = FALSE,
+  .id = 4627,
+  .ra = 253.536,
+  .dec = -7.63578,
+},
+{ .is_ngc = FALSE,
+  .id = 4628,
+  .ra = 254.242,
+  .dec = -40.4511,
+},
+{ .is_ngc = FALSE,
+  .id = 4629,
+  .ra = 254.038,
+  .dec = -16.7017,
+},
+{ .is_ngc = FALSE,
+  .id = 4630,
+  .ra = 253.79,
+  .dec = 26.6626,
+},
+{ .is_ngc = FALSE,
+  .id = 4631,
+  .ra = 257.75,
+  .dec = -77.6006,
+},
+{ .is_ngc = FALSE,
+  .id = 4632,
+  .ra = 254.634,
+  .dec = 22.9156,
+},
+{ .is_ngc = FALSE,
+  .id = 4632,
+  .ra = 254.648,
+  .dec = 22.9121,
+},
+{ .is_ngc = FALSE,
+  .id = 4633,
+  .ra = 258.447,
+  .dec = -77.5356,
+},
+{ .is_ngc = FALSE,
+  .id = 4634,
+  .ra = 255.39,
+  .dec = -21.8259,
+},
+{ .is_ngc = FALSE,
+  .id = 4635,
+  .ra = 258.917,
+  .dec = -77.4894,
+},
+{ .is_ngc = FALSE,
+  .id = 4636,
+  .ra = 254.778,
+  .dec = 47.1958,
+},
+{ .is_ngc = FALSE,
+  .id = 4637,
+  .ra = 256.293,
+  .dec = -40.8854,
+},
+{ .is_ngc = FALSE,
+  .id = 4638,
+  .ra = 255.307,
+  .dec = 33.5133,
+},
+{ .is_ngc = FALSE,
+  .id = 4639,
+  .ra = 255.729,
+  .dec = 22.9301,
+},
+{ .is_ngc = FALSE,
+  .id = 4640,
+  .ra = 260.988,
+  .dec = -80.0636,
+},
+{ .is_ngc = FALSE,
+  .id = 4641,
+  .ra = 261.043,
+  .dec = -80.1472,
+},
+{ .is_ngc = FALSE,
+  .id = 4642,
+  .ra = 257.939,
+  .dec = -55.4,
+},
+{ .is_ngc = FALSE,
+  .id = 4644,
+  .ra = 261.15,
+  .dec = -73.9386,
+},
+{ .is_ngc = FALSE,
+  .id = 4645,
+  .ra = 258.679,
+  .dec = 43.1035,
+},
+{ .is_ngc = FALSE,
+  .id = 4646,
+  .ra = 260.973,
+  .dec = -60,
+},
+{ .is_ngc = FALSE,
+  .id = 4647,
+  .ra = 261.513,
+  .dec = -80.195,
+},
+{ .is_ngc = FALSE,
+  .id = 4648,
+  .ra = 259.042,
+  .dec = 43.8625,
+},
+{ .is_ngc = FALSE,
+  .id = 4650,
+  .ra = 258.947,
+  .dec = 57.3021,
+},
+{ .is_ngc = FALSE,
+  .id = 4651,
+  .ra = 261.217,
+  .dec = -49.935,
+},
+{ .is_ngc = FALSE,
+  .id = 4652,
+  .ra = 261.611,
+  .dec = -59.7284,
+},
+{ .is_ngc = FALSE,
+  .id = 4653,
+  .ra = 261.78,
+  .dec = -60.88,
+},
+{ .is_ngc = FALSE,
+  .id = 4654,
+  .ra = 264.283,
+  .dec = -74.3811,
+},
+{ .is_ngc = FALSE,
+  .id = 4655,
+  .ra = 263.649,
+  .dec = -60.7214,
+},
+{ .is_ngc = FALSE,
+  .id = 4656,
+  .ra = 264.432,
+  .dec = -63.7292,
+},
+{ .is_ngc = FALSE,
+  .id = 4657,
+  .ra = 263.175,
+  .dec = -17.5181,
+},
+{ .is_ngc = FALSE,
+  .id = 4658,
+  .ra = 264.042,
+  .dec = -59.5836,
+},
+{ .is_ngc = FALSE,
+  .id = 4658,
+  .ra = 264.414,
+  .dec = -59.9407,
+},
+{ .is_ngc = FALSE,
+  .id = 4659,
+  .ra = 263.55,
+  .dec = -17.9186,
+},
+{ .is_ngc = FALSE,
+  .id = 4660,
+  .ra = 260.438,
+  .dec = 75.8477,
+},
+{ .is_ngc = FALSE,
+  .id = 4661,
+  .ra = 267.761,
+  .dec = -74.0322,
+},
+{ .is_ngc = FALSE,
+  .id = 4662,
+  .ra = 266.786,
+  .dec = -64.642,
+},
+{ .is_ngc = FALSE,
+  .id = 4663,
+  .ra = 266.369,
+  .dec = -44.9045,
+},
+{ .is_ngc = FALSE,
+  .id = 4664,
+  .ra = 267.245,
+  .dec = -63.2544,
+},
+{ .is_ngc = FALSE,
+  .id = 4665,
+  .ra = 266.521,
+  .dec = 5.65,
+},
+{ .is_ngc = FALSE,
+  .id = 4666,
+  .ra = 266.509,
+  .dec = 55.776,
+},
+{ .is_ngc = FALSE,
+  .id = 4667,
+  .ra = 266.579,
+  .dec = 55.8756,
+},
+{ .is_ngc = FALSE,
+  .id = 4668,
+  .ra = 266.747,
+  .dec = 57.4,
+},
+{ .is_ngc = FALSE,
+  .id = 4669,
+  .ra = 266.803,
+  .dec = 61.4337,
+},
+{ .is_ngc = FALSE,
+  .id = 4670,
+  .ra = 268.779,
+  .dec = -21.7444,
+},
+{ .is_ngc = FALSE,
+  .id = 4671,
+  .ra = 268.779,
+  .dec = -10.2839,
+},
+{ .is_ngc = FALSE,
+  .id = 4672,
+  .ra = 270.56,
+  .dec = -62.8322,
+},
+{ .is_ngc = FALSE,
+  .id = 4673,
+  .ra = 270.826,
+  .dec = -27.106,
+},
+{ .is_ngc = FALSE,
+  .id = 4674,
+  .ra = 272.056,
+  .dec = -62.3947,
+},
+{ .is_ngc = FALSE,
+  .id = 4675,
+  .ra = 270.792,
+  .dec = -9.25167,
+},
+{ .is_ngc = FALSE,
+  .id = 4676,
+  .ra = 270.721,
+  .dec = 11.8225,
+},
+{ .is_ngc = FALSE,
+  .id = 4677,
+  .ra = 269.565,
+  .dec = 66.6337,
+},
+{ .is_ngc = FALSE,
+  .id = 4678,
+  .ra = 271.64,
+  .dec = -23.9544,
+},
+{ .is_ngc = FALSE,
+  .id = 4679,
+  .ra = 272.85,
+  .dec = -56.2536,
+},
+{ .is_ngc = FALSE,
+  .id = 4680,
+  .ra = 273.374,
+  .dec = -64.4764,
+},
+{ .is_ngc = FALSE,
+  .id = 4681,
+  .ra = 272.083,
+  .dec = -23.4319,
+},
+{ .is_ngc = FALSE,
+  .id = 4681,
+  .ra = 272.066,
+  .dec = -23.4011,
+},
+{ .is_ngc = FALSE,
+  .id = 4682,
+  .ra = 274.107,
+  .dec = -71.5811,
+},
+{ .is_ngc = FALSE,
+  .id = 4683,
+  .ra = 272.25,
+  .dec = -26.0667,
+},
+{ .is_ngc = FALSE,
+  .id = 4684,
+  .ra = 272.285,
+  .dec = -23.4358,
+},
+{ .is_ngc = FALSE,
+  .id = 4685,
+  .ra = 272.323,
+  .dec = -23.9878,
+},
+{ .is_ngc = FALSE,
+  .id = 4686,
+  .ra = 273.411,
+  .dec = -57.7325,
+},
+{ .is_ngc = FALSE,
+  .id = 4687,
+  .ra = 273.414,
+  .dec = -57.7258,
+},
+{ .is_ngc = FALSE,
+  .id = 4688,
+  .ra = 272.05,
+  .dec = 11.7119,
+},
+{ .is_ngc = FALSE,
+  .id = 4689,
+  .ra = 273.418,
+  .dec = -57.7489,
+},
+{ .is_ngc = FALSE,
+  .id = 4691,
+  .ra = 272.19,
+  .dec = 11.8289,
+},
+{ .is_ngc = FALSE,
+  .id = 4692,
+  .ra = 273.708,
+  .dec = -58.6944,
+},
+{ .is_ngc = FALSE,
+  .id = 4693,
+  .ra = 272.295,
+  .dec = 17.3472,
+},
+{ .is_ngc = FALSE,
+  .id = 4694,
+  .ra = 273.862,
+  .dec = -58.2086,
+},
+{ .is_ngc = FALSE,
+  .id = 4695,
+  .ra = 274.348,
+  .dec = -58.9244,
+},
+{ .is_ngc = FALSE,
+  .id = 4696,
+  .ra = 275.075,
+  .dec = -64.7331,
+},
+{ .is_ngc = FALSE,
+  .id = 4697,
+  .ra = 273.112,
+  .dec = 25.4271,
+},
+{ .is_ngc = FALSE,
+  .id = 4698,
+  .ra = 275.251,
+  .dec = -63.3469,
+},
+{ .is_ngc = FALSE,
+  .id = 4699,
+  .ra = 274.633,
+  .dec = -45.9838,
+},
+{ .is_ngc = FALSE,
+  .id = 4701,
+  .ra = 274.025,
+  .dec = -16.6333,
+},
+{ .is_ngc = FALSE,
+  .id = 4702,
+  .ra = 275.766,
+  .dec = -59.2386,
+},
+{ .is_ngc = FALSE,
+  .id = 4703,
+  .ra = 274.538,
+  .dec = -13.8333,
+},
+{ .is_ngc = FALSE,
+  .id = 4704,
+  .ra = 276.978,
+  .dec = -71.6094,
+},
+{ .is_ngc = FALSE,
+  .id = 4705,
+  .ra = 277.044,
+  .dec = -71.6939,
+},
+{ .is_ngc = FALSE,
+  .id = 4706,
+  .ra = 274.9,
+  .dec = -16.0192,
+},
+{ .is_ngc = FALSE,
+  .id = 4707,
+  .ra = 274.971,
+  .dec = -16.0017,
+},
+{ .is_ngc = FALSE,
+  .id = 4708,
+  .ra = 273.443,
+  .dec = 61.1567,
+},
+{ .is_ngc = FALSE,
+  .id = 4709,
+  .ra = 276.08,
+  .dec = -56.3692,
+},
+{ .is_ngc = FALSE,
+  .id = 4710,
+  .ra = 277.16,
+  .dec = -66.9825,
+},
+{ .is_ngc = FALSE,
+  .id = 4711,
+  .ra = 277.028,
+  .dec = -64.9442,
+},
+{ .is_ngc = FALSE,
+  .id = 4712,
+  .ra = 277.78,
+  .dec = -71.6933,
+},
+{ .is_ngc = FALSE,
+  .id = 4713,
+  .ra = 277.495,
+  .dec = -67.2242,
+},
+{ .is_ngc = FALSE,
+  .id = 4714,
+  .ra = 277.732,
+  .dec = -66.6525,
+},
+{ .is_ngc = FALSE,
+  .id = 4715,
+  .ra = 274.033,
+  .dec = -18.55,
+},
+{ .is_ngc = FALSE,
+  .id = 4716,
+  .ra = 278.187,
+  .dec = -56.9625,
+},
+{ .is_ngc = FALSE,
+  .id = 4717,
+  .ra = 278.322,
+  .dec = -57.9744,
+},
+{ .is_ngc = FALSE,
+  .id = 4718,
+  .ra = 278.459,
+  .dec = -60.1286,
+},
+{ .is_ngc = FALSE,
+  .id = 4719,
+  .ra = 278.299,
+  .dec = -56.7328,
+},
+{ .is_ngc = FALSE,
+  .id = 4720,
+  .ra = 278.386,
+  .dec = -58.405,
+},
+{ .is_ngc = FALSE,
+  .id = 4721,
+  .ra = 278.603,
+  .dec = -58.4968,
+},
+{ .is_ngc = FALSE,
+  .id = 4722,
+  .ra = 278.632,
+  .dec = -57.7931,
+},
+{ .is_ngc = FALSE,
+  .id = 4723,
+  .ra = 278.983,
+  .dec = -63.3764,
+},
+{ .is_ngc = FALSE,
+  .id = 4724,
+  .ra = 279.669,
+  .dec = -70.1261,
+},
+{ .is_ngc = FALSE,
+  .id = 4725,
+  .ra = 277.95,
+  .dec = -19.1022,
+},
+{ .is_ngc = FALSE,
+  .id = 4726,
+  .ra = 279.246,
+  .dec = -62.8544,
+},
+{ .is_ngc = FALSE,
+  .id = 4727,
+  .ra = 279.485,
+  .dec = -62.7003,
+},
+{ .is_ngc = FALSE,
+  .id = 4728,
+  .ra = 279.487,
+  .dec = -62.5297,
+},
+{ .is_ngc = FALSE,
+  .id = 4729,
+  .ra = 279.987,
+  .dec = -67.4258,
+},
+{ .is_ngc = FALSE,
+  .id = 4730,
+  .ra = 279.71,
+  .dec = -63.3506,
+},
+{ .is_ngc = FALSE,
+  .id = 4731,
+  .ra = 279.679,
+  .dec = -62.9431,
+},
+{ .is_ngc = FALSE,
+  .id = 4732,
+  .ra = 278.477,
+  .dec = -22.6447,
+},
+{ .is_ngc = FALSE,
+  .id = 4733,
+  .ra = 276.659,
+  .dec = 64.9669,
+},
+{ .is_ngc = FALSE,
+  .id = 4734,
+  .ra = 279.606,
+  .dec = -57.4908,
+},
+{ .is_ngc = FALSE,
+  .id = 4735,
+  .ra = 279.958,
+  .dec = -62.9561,
+},
+{ .is_ngc = FALSE,
+  .id = 4736,
+  .ra = 279.665,
+  .dec = -57.8933,
+},
+{ .is_ngc = FALSE,
+  .id = 4737,
+  .ra = 279.995,
+  .dec = -62.5975,
+},
+{ .is_ngc = FALSE,
+  .id = 4738,
+  .ra = 280.114,
+  .dec = -61.9019,
+},
+{ .is_ngc = FALSE,
+  .id = 4739,
+  .ra = 280.215,
+  .dec = -61.9014,
+},
+{ .is_ngc = FALSE,
+  .id = 4740,
+  .ra = 280.752,
+  .dec = -68.3597,
+},
+{ .is_ngc = FALSE,
+  .id = 4741,
+  .ra = 280.432,
+  .dec = -63.9483,
+},
+{ .is_ngc = FALSE,
+  .id = 4742,
+  .ra = 280.469,
+  .dec = -63.8617,
+},
+{ .is_ngc = FALSE,
+  .id = 4743,
+  .ra = 280.372,
+  .dec = -61.7722,
+},
+{ .is_ngc = FALSE,
+  .id = 4744,
+  .ra = 280.478,
+  .dec = -63.2236,
+},
+{ .is_ngc = FALSE,
+  .id = 4745,
+  .ra = 280.648,
+  .dec = -64.9431,
+},
+{ .is_ngc = FALSE,
+  .id = 4746,
+  .ra = 281.478,
+  .dec = -72.6697,
+},
+{ .is_ngc = FALSE,
+  .id = 4747,
+  .ra = 281.489,
+  .dec = -72.6281,
+},
+{ .is_ngc = FALSE,
+  .id = 4748,
+  .ra = 280.692,
+  .dec = -64.0733,
+},
+{ .is_ngc = FALSE,
+  .id = 4749,
+  .ra = 280.707,
+  .dec = -63.2088,
+},
+{ .is_ngc = FALSE,
+  .id = 4750,
+  .ra = 280.761,
+  .dec = -62.9708,
+},
+{ .is_ngc = FALSE,
+  .id = 4751,
+  .ra = 280.833,
+  .dec = -62.1119,
+},
+{ .is_ngc = FALSE,
+  .id = 4752,
+  .ra = 280.949,
+  .dec = -64.0825,
+},
+{ .is_ngc = FALSE,
+  .id = 4753,
+  .ra = 280.888,
+  .dec = -62.1075,
+},
+{ .is_ngc = FALSE,
+  .id = 4754,
+  .ra = 281.002,
+  .dec = -61.9894,
+},
+{ .is_ngc = FALSE,
+  .id = 4755,
+  .ra = 281.255,
+  .dec = -63.6925,
+},
+{ .is_ngc = FALSE,
+  .id = 4756,
+  .ra = 279.538,
+  .dec = 5.45,
+},
+{ .is_ngc = FALSE,
+  .id = 4757,
+  .ra = 280.983,
+  .dec = -57.1669,
+},
+{ .is_ngc = FALSE,
+  .id = 4758,
+  .ra = 281.575,
+  .dec = -65.7569,
+},
+{ .is_ngc = FALSE,
+  .id = 4759,
+  .ra = 281.421,
+  .dec = -63.0861,
+},
+{ .is_ngc = FALSE,
+  .id = 4760,
+  .ra = 281.442,
+  .dec = -62.9578,
+},
+{ .is_ngc = FALSE,
+  .id = 4761,
+  .ra = 280.981,
+  .dec = -52.8525,
+},
+{ .is_ngc = FALSE,
+  .id = 4762,
+  .ra = 278.119,
+  .dec = 67.8578,
+},
+{ .is_ngc = FALSE,
+  .id = 4764,
+  .ra = 281.781,
+  .dec = -63.4845,
+},
+{ .is_ngc = FALSE,
+  .id = 4765,
+  .ra = 281.826,
+  .dec = -63.3319,
+},
+{ .is_ngc = FALSE,
+  .id = 4766,
+  .ra = 281.9,
+  .dec = -63.2931,
+},
+{ .is_ngc = FALSE,
+  .id = 4767,
+  .ra = 281.924,
+  .dec = -63.4053,
+},
+{ .is_ngc = FALSE,
+  .id = 4768,
+  .ra = 280.438,
+  .dec = -5.51778,
+},
+{ .is_ngc = FALSE,
+  .id = 4769,
+  .ra = 281.932,
+  .dec = -63.1581,
+},
+{ .is_ngc = FALSE,
+  .id = 4770,
+  .ra = 282.044,
+  .dec = -63.3842,
+},
+{ .is_ngc = FALSE,
+  .id = 4771,
+  .ra = 282.1,
+  .dec = -63.2486,
+},
+{ .is_ngc = FALSE,
+  .id = 4772,
+  .ra = 279.985,
+  .dec = 40.0263,
+},
+{ .is_ngc = FALSE,
+  .id = 4773,
+  .ra = 282.839,
+  .dec = -69.9256,
+},
+{ .is_ngc = FALSE,
+  .id = 4774,
+  .ra = 282.043,
+  .dec = -57.9358,
+},
+{ .is_ngc = FALSE,
+  .id = 4775,
+  .ra = 282.11,
+  .dec = -57.1839,
+},
+{ .is_ngc = FALSE,
+  .id = 4776,
+  .ra = 281.462,
+  .dec = -33.3433,
+},
+{ .is_ngc = FALSE,
+  .id = 4777,
+  .ra = 282.047,
+  .dec = -53.1472,
+},
+{ .is_ngc = FALSE,
+  .id = 4778,
+  .ra = 282.502,
+  .dec = -61.7192,
+},
+{ .is_ngc = FALSE,
+  .id = 4779,
+  .ra = 282.626,
+  .dec = -63.0133,
+},
+{ .is_ngc = FALSE,
+  .id = 4780,
+  .ra = 282.486,
+  .dec = -59.2539,
+},
+{ .is_ngc = FALSE,
+  .id = 4781,
+  .ra = 282.908,
+  .dec = -62.7925,
+},
+{ .is_ngc = FALSE,
+  .id = 4782,
+  .ra = 282.725,
+  .dec = -55.4911,
+},
+{ .is_ngc = FALSE,
+  .id = 4783,
+  .ra = 282.888,
+  .dec = -58.8136,
+},
+{ .is_ngc = FALSE,
+  .id = 4784,
+  .ra = 283.201,
+  .dec = -63.2599,
+},
+{ .is_ngc = FALSE,
+  .id = 4785,
+  .ra = 283.231,
+  .dec = -59.2553,
+},
+{ .is_ngc = FALSE,
+  .id = 4786,
+  .ra = 283.185,
+  .dec = -56.6944,
+},
+{ .is_ngc = FALSE,
+  .id = 4787,
+  .ra = 284.018,
+  .dec = -68.6825,
+},
+{ .is_ngc = FALSE,
+  .id = 4788,
+  .ra = 283.671,
+  .dec = -63.4531,
+},
+{ .is_ngc = FALSE,
+  .id = 4789,
+  .ra = 284.077,
+  .dec = -68.5681,
+},
+{ .is_ngc = FALSE,
+  .id = 4790,
+  .ra = 284.133,
+  .dec = -64.9283,
+},
+{ .is_ngc = FALSE,
+  .id = 4791,
+  .ra = 282.255,
+  .dec = 19.331,
+},
+{ .is_ngc = FALSE,
+  .id = 4792,
+  .ra = 283.925,
+  .dec = -56.4039,
+},
+{ .is_ngc = FALSE,
+  .id = 4793,
+  .ra = 284.233,
+  .dec = -61.4003,
+},
+{ .is_ngc = FALSE,
+  .id = 4794,
+  .ra = 284.29,
+  .dec = -62.0906,
+},
+{ .is_ngc = FALSE,
+  .id = 4795,
+  .ra = 284.318,
+  .dec = -61.6097,
+},
+{ .is_ngc = FALSE,
+  .id = 4796,
+  .ra = 284.118,
+  .dec = -54.2139,
+},
+{ .is_ngc = FALSE,
+  .id = 4797,
+  .ra = 284.127,
+  .dec = -54.3056,
+},
+{ .is_ngc = FALSE,
+  .id = 4798,
+  .ra = 284.587,
+  .dec = -62.1186,
+},
+{ .is_ngc = FALSE,
+  .id = 4799,
+  .ra = 284.736,
+  .dec = -63.9314,
+},
+{ .is_ngc = FALSE,
+  .id = 4800,
+  .ra = 284.68,
+  .dec = -63.1392,
+},
+{ .is_ngc = FALSE,
+  .id = 4801,
+  .ra = 284.911,
+  .dec = -64.6747,
+},
+{ .is_ngc = FALSE,
+  .id = 4802,
+  .ra = 283.78,
+  .dec = -22.6981,
+},
+{ .is_ngc = FALSE,
+  .id = 4803,
+  .ra = 285.164,
+  .dec = -62.0651,
+},
+{ .is_ngc = FALSE,
+  .id = 4804,
+  .ra = 285.28,
+  .dec = -61.8331,
+},
+{ .is_ngc = FALSE,
+  .id = 4805,
+  .ra = 285.505,
+  .dec = -63.0472,
+},
+{ .is_ngc = FALSE,
+  .id = 4806,
+  .ra = 285.377,
+  .dec = -57.5322,
+},
+{ .is_ngc = FALSE,
+  .id = 4807,
+  .ra = 285.573,
+  .dec = -56.9306,
+},
+{ .is_ngc = FALSE,
+  .id = 4808,
+  .ra = 285.281,
+  .dec = -45.3142,
+},
+{ .is_ngc = FALSE,
+  .id = 4809,
+  .ra = 286.024,
+  .dec = -62.1942,
+},
+{ .is_ngc = FALSE,
+  .id = 4810,
+  .ra = 285.748,
+  .dec = -56.1594,
+},
+{ .is_ngc = FALSE,
+  .id = 4811,
+  .ra = 286.436,
+  .dec = -67.1342,
+},
+{ .is_ngc = FALSE,
+  .id = 4812,
+  .ra = 285.265,
+  .dec = -37.0606,
+},
+{ .is_ngc = FALSE,
+  .id = 4813,
+  .ra = 286.425,
+  .dec = -66.5228,
+},
+{ .is_ngc = FALSE,
+  .id = 4814,
+  .ra = 286.247,
+  .dec = -58.5797,
+},
+{ .is_ngc = FALSE,
+  .id = 4815,
+  .ra = 286.713,
+  .dec = -61.7011,
+},
+{ .is_ngc = FALSE,
+  .id = 4816,
+  .ra = 285.461,
+  .dec = -13.1618,
+},
+{ .is_ngc = FALSE,
+  .id = 4817,
+  .ra = 286.551,
+  .dec = -56.1592,
+},
+{ .is_ngc = FALSE,
+  .id = 4818,
+  .ra = 286.512,
+  .dec = -55.1364,
+},
+{ .is_ngc = FALSE,
+  .id = 4819,
+  .ra = 286.778,
+  .dec = -59.4664,
+},
+{ .is_ngc = FALSE,
+  .id = 4820,
+  .ra = 287.304,
+  .dec = -63.4653,
+},
+{ .is_ngc = FALSE,
+  .id = 4821,
+  .ra = 287.384,
+  .dec = -55.0161,
+},
+{ .is_ngc = FALSE,
+  .id = 4822,
+  .ra = 288.687,
+  .dec = -72.4403,
+},
+{ .is_ngc = FALSE,
+  .id = 4823,
+  .ra = 288.058,
+  .dec = -63.9689,
+},
+{ .is_ngc = FALSE,
+  .id = 4824,
+  .ra = 288.309,
+  .dec = -62.0886,
+},
+{ .is_ngc = FALSE,
+  .id = 4825,
+  .ra = 289.315,
+  .dec = -72.7486,
+},
+{ .is_ngc = FALSE,
+  .id = 4826,
+  .ra = 288.088,
+  .dec = -57.2019,
+},
+{ .is_ngc = FALSE,
+  .id = 4827,
+  .ra = 288.338,
+  .dec = -60.86,
+},
+{ .is_ngc = FALSE,
+  .id = 4828,
+  .ra = 288.42,
+  .dec = -62.0821,
+},
+{ .is_ngc = FALSE,
+  .id = 4829,
+  .ra = 288.14,
+  .dec = -56.5397,
+},
+{ .is_ngc = FALSE,
+  .id = 4830,
+  .ra = 288.453,
+  .dec = -59.2944,
+},
+{ .is_ngc = FALSE,
+  .id = 4831,
+  .ra = 288.683,
+  .dec = -62.2721,
+},
+{ .is_ngc = FALSE,
+  .id = 4832,
+  .ra = 288.515,
+  .dec = -56.6094,
+},
+{ .is_ngc = FALSE,
+  .id = 4833,
+  .ra = 288.923,
+  .dec = -62.3293,
+},
+{ .is_ngc = FALSE,
+  .id = 4834,
+  .ra = 289.129,
+  .dec = -64.0064,
+},
+{ .is_ngc = FALSE,
+  .id = 4835,
+  .ra = 288.864,
+  .dec = -58.2367,
+},
+{ .is_ngc = FALSE,
+  .id = 4836,
+  .ra = 289.075,
+  .dec = -60.2,
+},
+{ .is_ngc = FALSE,
+  .id = 4837,
+  .ra = 288.811,
+  .dec = -54.6626,
+},
+{ .is_ngc = FALSE,
+  .id = 4838,
+  .ra = 289.193,
+  .dec = -61.6142,
+},
+{ .is_ngc = FALSE,
+  .id = 4839,
+  .ra = 288.892,
+  .dec = -54.6263,
+},
+{ .is_ngc = FALSE,
+  .id = 4840,
+  .ra = 288.965,
+  .dec = -56.2086,
+},
+{ .is_ngc = FALSE,
+  .id = 4841,
+  .ra = 290.179,
+  .dec = -72.2261,
+},
+{ .is_ngc = FALSE,
+  .id = 4842,
+  .ra = 289.852,
+  .dec = -60.6445,
+},
+{ .is_ngc = FALSE,
+  .id = 4843,
+  .ra = 289.839,
+  .dec = -59.3092,
+},
+{ .is_ngc = FALSE,
+  .id = 4844,
+  .ra = 289.761,
+  .dec = -56.0269,
+},
+{ .is_ngc = FALSE,
+  .id = 4845,
+  .ra = 290.094,
+  .dec = -60.3897,
+},
+{ .is_ngc = FALSE,
+  .id = 4846,
+  .ra = 289.118,
+  .dec = -9.04397,
+},
+{ .is_ngc = FALSE,
+  .id = 4847,
+  .ra = 290.884,
+  .dec = -65.5067,
+},
+{ .is_ngc = FALSE,
+  .id = 4848,
+  .ra = 290.725,
+  .dec = -56.7806,
+},
+{ .is_ngc = FALSE,
+  .id = 4849,
+  .ra = 291.4,
+  .dec = -62.9328,
+},
+{ .is_ngc = FALSE,
+  .id = 4850,
+  .ra = 290.1,
+  .dec = -0.133667,
+},
+{ .is_ngc = FALSE,
+  .id = 4851,
+  .ra = 291.372,
+  .dec = -57.6711,
+},
+{ .is_ngc = FALSE,
+  .id = 4852,
+  .ra = 291.607,
+  .dec = -60.3364,
+},
+{ .is_ngc = FALSE,
+  .id = 4853,
+  .ra = 292.698,
+  .dec = -71.0697,
+},
+{ .is_ngc = FALSE,
+  .id = 4856,
+  .ra = 291.877,
+  .dec = -54.9086,
+},
+{ .is_ngc = FALSE,
+  .id = 4859,
+  .ra = 292.696,
+  .dec = -66.3153,
+},
+{ .is_ngc = FALSE,
+  .id = 4860,
+  .ra = 292.866,
+  .dec = -67.3689,
+},
+{ .is_ngc = FALSE,
+  .id = 4861,
+  .ra = 292.319,
+  .dec = -57.5764,
+},
+{ .is_ngc = FALSE,
+  .id = 4862,
+  .ra = 292.917,
+  .dec = -67.3236,
+},
+{ .is_ngc = FALSE,
+  .id = 4863,
+  .ra = 291.965,
+  .dec = -36.2167,
+},
+{ .is_ngc = FALSE,
+  .id = 4864,
+  .ra = 295.026,
+  .dec = -77.5569,
+},
+{ .is_ngc = FALSE,
+  .id = 4865,
+  .ra = 292.71,
+  .dec = -46.6983,
+},
+{ .is_ngc = FALSE,
+  .id = 4866,
+  .ra = 293.645,
+  .dec = -61.1458,
+},
+{ .is_ngc = FALSE,
+  .id = 4868,
+  .ra = 293.389,
+  .dec = -45.8922,
+},
+{ .is_ngc = FALSE,
+  .id = 4869,
+  .ra = 294.011,
+  .dec = -61.0278,
+},
+{ .is_ngc = FALSE,
+  .id = 4870,
+  .ra = 294.408,
+  .dec = -65.8117,
+},
+{ .is_ngc = FALSE,
+  .id = 4873,
+  .ra = 293.728,
+  .dec = -46.1358,
+},
+{ .is_ngc = FALSE,
+  .id = 4874,
+  .ra = 294.089,
+  .dec = -47.2656,
+},
+{ .is_ngc = FALSE,
+  .id = 4875,
+  .ra = 294.413,
+  .dec = -52.0744,
+},
+{ .is_ngc = FALSE,
+  .id = 4876,
+  .ra = 294.429,
+  .dec = -52.8425,
+},
+{ .is_ngc = FALSE,
+  .id = 4877,
+  .ra = 294.483,
+  .dec = -51.9908,
+},
+{ .is_ngc = FALSE,
+  .id = 4878,
+  .ra = 294.707,
+  .dec = -58.2275,
+},
+{ .is_ngc = FALSE,
+  .id = 4879,
+  .ra = 294.903,
+  .dec = -52.3686,
+},
+{ .is_ngc = FALSE,
+  .id = 4880,
+  .ra = 295.128,
+  .dec = -56.4094,
+},
+{ .is_ngc = FALSE,
+  .id = 4881,
+  .ra = 295.108,
+  .dec = -55.8575,
+},
+{ .is_ngc = FALSE,
+  .id = 4882,
+  .ra = 295.097,
+  .dec = -55.1969,
+},
+{ .is_ngc = FALSE,
+  .id = 4883,
+  .ra = 295.502,
+  .dec = -55.5447,
+},
+{ .is_ngc = FALSE,
+  .id = 4884,
+  .ra = 295.672,
+  .dec = -58.1286,
+},
+{ .is_ngc = FALSE,
+  .id = 4885,
+  .ra = 295.965,
+  .dec = -60.6511,
+},
+{ .is_ngc = FALSE,
+  .id = 4886,
+  .ra = 295.811,
+  .dec = -51.8076,
+},
+{ .is_ngc = FALSE,
+  .id = 4887,
+  .ra = 297.087,
+  .dec = -69.5867,
+},
+{ .is_ngc = FALSE,
+  .id = 4888,
+  .ra = 296.218,
+  .dec = -54.4561,
+},
+{ .is_ngc = FALSE,
+  .id = 4890,
+  .ra = 296.397,
+  .dec = -56.545,
+},
+{ .is_ngc = FALSE,
+  .id = 4892,
+  .ra = 297.381,
+  .dec = -70.2269,
+},
+{ .is_ngc = FALSE,
+  .id = 4893,
+  .ra = 297.637,
+  .dec = -72.5094,
+},
+{ .is_ngc = FALSE,
+  .id = 4894,
+  .ra = 296.746,
+  .dec = -51.8468,
+},
+{ .is_ngc = FALSE,
+  .id = 4896,
+  .ra = 297.271,
+  .dec = -58.9814,
+},
+{ .is_ngc = FALSE,
+  .id = 4897,
+  .ra = 297.333,
+  .dec = -51.8686,
+},
+{ .is_ngc = FALSE,
+  .id = 4898,
+  .ra = 296.942,
+  .dec = -33.3172,
+},
+{ .is_ngc = FALSE,
+  .id = 4899,
+  .ra = 298.612,
+  .dec = -70.5893,
+},
+{ .is_ngc = FALSE,
+  .id = 4900,
+  .ra = 297.592,
+  .dec = -51.3461,
+},
+{ .is_ngc = FALSE,
+  .id = 4901,
+  .ra = 298.597,
+  .dec = -58.7136,
+},
+{ .is_ngc = FALSE,
+  .id = 4902,
+  .ra = 298.6,
+  .dec = -56.3783,
+},
+{ .is_ngc = FALSE,
+  .id = 4903,
+  .ra = 299.556,
+  .dec = -70.4536,
+},
+{ .is_ngc = FALSE,
+  .id = 4904,
+  .ra = 299.662,
+  .dec = -70.1839,
+},
+{ .is_ngc = FALSE,
+  .id = 4905,
+  .ra = 299.025,
+  .dec = -61.2208,
+},
+{ .is_ngc = FALSE,
+  .id = 4906,
+  .ra = 299.199,
+  .dec = -60.4683,
+},
+{ .is_ngc = FALSE,
+  .id = 4907,
+  .ra = 299.053,
+  .dec = -52.4528,
+},
+{ .is_ngc = FALSE,
+  .id = 4908,
+  .ra = 299.235,
+  .dec = -55.7911,
+},
+{ .is_ngc = FALSE,
+  .id = 4909,
+  .ra = 299.188,
+  .dec = -50.055,
+},
+{ .is_ngc = FALSE,
+  .id = 4910,
+  .ra = 299.445,
+  .dec = -56.8628,
+},
+{ .is_ngc = FALSE,
+  .id = 4911,
+  .ra = 299.424,
+  .dec = -51.9858,
+},
+{ .is_ngc = FALSE,
+  .id = 4912,
+  .ra = 301.708,
+  .dec = -77.3567,
+},
+{ .is_ngc = FALSE,
+  .id = 4913,
+  .ra = 299.197,
+  .dec = -37.3289,
+},
+{ .is_ngc = FALSE,
+  .id = 4914,
+  .ra = 299.484,
+  .dec = -50.1314,
+},
+{ .is_ngc = FALSE,
+  .id = 4915,
+  .ra = 299.634,
+  .dec = -52.6419,
+},
+{ .is_ngc = FALSE,
+  .id = 4916,
+  .ra = 299.58,
+  .dec = -50.2717,
+},
+{ .is_ngc = FALSE,
+  .id = 4917,
+  .ra = 299.73,
+  .dec = -52.2728,
+},
+{ .is_ngc = FALSE,
+  .id = 4918,
+  .ra = 299.805,
+  .dec = -52.2744,
+},
+{ .is_ngc = FALSE,
+  .id = 4919,
+  .ra = 300.038,
+  .dec = -55.3742,
+},
+{ .is_ngc = FALSE,
+  .id = 4920,
+  .ra = 300.038,
+  .dec = -53.3836,
+},
+{ .is_ngc = FALSE,
+  .id = 4921,
+  .ra = 300.83,
+  .dec = -67.8253,
+},
+{ .is_ngc = FALSE,
+  .id = 4922,
+  .ra = 299.871,
+  .dec = -40.3522,
+},
+{ .is_ngc = FALSE,
+  .id = 4923,
+  .ra = 300.24,
+  .dec = -52.6319,
+},
+{ .is_ngc = FALSE,
+  .id = 4924,
+  .ra = 299.963,
+  .dec = -41.5356,
+},
+{ .is_ngc = FALSE,
+  .id = 4925,
+  .ra = 300.291,
+  .dec = -52.866,
+},
+{ .is_ngc = FALSE,
+  .id = 4926,
+  .ra = 300.051,
+  .dec = -38.5778,
+},
+{ .is_ngc = FALSE,
+  .id = 4927,
+  .ra = 300.456,
+  .dec = -53.9181,
+},
+{ .is_ngc = FALSE,
+  .id = 4928,
+  .ra = 302.55,
+  .dec = -77.3089,
+},
+{ .is_ngc = FALSE,
+  .id = 4929,
+  .ra = 301.674,
+  .dec = -71.6828,
+},
+{ .is_ngc = FALSE,
+  .id = 4930,
+  .ra = 300.608,
+  .dec = -54.3014,
+},
+{ .is_ngc = FALSE,
+  .id = 4931,
+  .ra = 300.209,
+  .dec = -38.575,
+},
+{ .is_ngc = FALSE,
+  .id = 4932,
+  .ra = 300.564,
+  .dec = -52.8461,
+},
+{ .is_ngc = FALSE,
+  .id = 4933,
+  .ra = 300.871,
+  .dec = -54.9797,
+},
+{ .is_ngc = FALSE,
+  .id = 4934,
+  .ra = 301.812,
+  .dec = -69.4797,
+},
+{ .is_ngc = FALSE,
+  .id = 4935,
+  .ra = 301.142,
+  .dec = -57.5981,
+},
+{ .is_ngc = FALSE,
+  .id = 4936,
+  .ra = 301.468,
+  .dec = -61.4278,
+},
+{ .is_ngc = FALSE,
+  .id = 4937,
+  .ra = 301.324,
+  .dec = -56.2558,
+},
+{ .is_ngc = FALSE,
+  .id = 4938,
+  .ra = 301.548,
+  .dec = -60.2108,
+},
+{ .is_ngc = FALSE,
+  .id = 4939,
+  .ra = 301.796,
+  .dec = -60.7386,
+},
+{ .is_ngc = FALSE,
+  .id = 4940,
+  .ra = 301.429,
+  .dec = -44.7,
+},
+{ .is_ngc = FALSE,
+  .id = 4941,
+  .ra = 301.744,
+  .dec = -53.6525,
+},
+{ .is_ngc = FALSE,
+  .id = 4942,
+  .ra = 301.706,
+  .dec = -52.6097,
+},
+{ .is_ngc = FALSE,
+  .id = 4943,
+  .ra = 301.618,
+  .dec = -48.3753,
+},
+{ .is_ngc = FALSE,
+  .id = 4944,
+  .ra = 301.788,
+  .dec = -54.4469,
+},
+{ .is_ngc = FALSE,
+  .id = 4946,
+  .ra = 305.99,
+  .dec = -43.9958,
+},
+{ .is_ngc = FALSE,
+  .id = 4947,
+  .ra = 301.883,
+  .dec = -53.1422,
+},
+{ .is_ngc = FALSE,
+  .id = 4950,
+  .ra = 302.113,
+  .dec = -56.1614,
+},
+{ .is_ngc = FALSE,
+  .id = 4951,
+  .ra = 302.381,
+  .dec = -61.8483,
+},
+{ .is_ngc = FALSE,
+  .id = 4952,
+  .ra = 302.157,
+  .dec = -55.4536,
+},
+{ .is_ngc = FALSE,
+  .id = 4953,
+  .ra = 302.499,
+  .dec = -62.7917,
+},
+{ .is_ngc = FALSE,
+  .id = 4954,
+  .ra = 301.188,
+  .dec = 29.2528,
+},
+{ .is_ngc = FALSE,
+  .id = 4955,
+  .ra = 301.219,
+  .dec = 29.1926,
+},
+{ .is_ngc = FALSE,
+  .id = 4956,
+  .ra = 302.879,
+  .dec = -45.5927,
+},
+{ .is_ngc = FALSE,
+  .id = 4957,
+  .ra = 302.398,
+  .dec = -55.7092,
+},
+{ .is_ngc = FALSE,
+  .id = 4958,
+  .ra = 303.897,
+  .dec = -72.7111,
+},
+{ .is_ngc = FALSE,
+  .id = 4959,
+  .ra = 302.738,
+  .dec = -53.0844,
+},
+{ .is_ngc = FALSE,
+  .id = 4960,
+  .ra = 303.85,
+  .dec = -70.5375,
+},
+{ .is_ngc = FALSE,
+  .id = 4962,
+  .ra = 304.176,
+  .dec = -71.1297,
+},
+{ .is_ngc = FALSE,
+  .id = 4963,
+  .ra = 303.022,
+  .dec = -55.2456,
+},
+{ .is_ngc = FALSE,
+  .id = 4964,
+  .ra = 304.351,
+  .dec = -73.8856,
+},
+{ .is_ngc = FALSE,
+  .id = 4965,
+  .ra = 303.113,
+  .dec = -56.8264,
+},
+{ .is_ngc = FALSE,
+  .id = 4966,
+  .ra = 303.068,
+  .dec = -53.6192,
+},
+{ .is_ngc = FALSE,
+  .id = 4967,
+  .ra = 304.097,
+  .dec = -70.5644,
+},
+{ .is_ngc = FALSE,
+  .id = 4968,
+  .ra = 303.708,
+  .dec = -64.7981,
+},
+{ .is_ngc = FALSE,
+  .id = 4969,
+  .ra = 303.232,
+  .dec = -53.9208,
+},
+{ .is_ngc = FALSE,
+  .id = 4970,
+  .ra = 304.238,
+  .dec = -70.7497,
+},
+{ .is_ngc = FALSE,
+  .id = 4971,
+  .ra = 304.264,
+  .dec = -70.6206,
+},
+{ .is_ngc = FALSE,
+  .id = 4972,
+  .ra = 304.43,
+  .dec = -70.9144,
+},
+{ .is_ngc = FALSE,
+  .id = 4973,
+  .ra = 303.642,
+  .dec = -58.3714,
+},
+{ .is_ngc = FALSE,
+  .id = 4975,
+  .ra = 303.511,
+  .dec = -52.7219,
+},
+{ .is_ngc = FALSE,
+  .id = 4976,
+  .ra = 303.921,
+  .dec = -61.8746,
+},
+{ .is_ngc = FALSE,
+  .id = 4977,
+  .ra = 302.971,
+  .dec = -21.6339,
+},
+{ .is_ngc = FALSE,
+  .id = 4978,
+  .ra = 303.656,
+  .dec = -54.4222,
+},
+{ .is_ngc = FALSE,
+  .id = 4979,
+  .ra = 303.674,
+  .dec = -53.4589,
+},
+{ .is_ngc = FALSE,
+  .id = 4980,
+  .ra = 303.869,
+  .dec = -57.9122,
+},
+{ .is_ngc = FALSE,
+  .id = 4981,
+  .ra = 304.914,
+  .dec = -70.8483,
+},
+{ .is_ngc = FALSE,
+  .id = 4982,
+  .ra = 305.089,
+  .dec = -71.0072,
+},
+{ .is_ngc = FALSE,
+  .id = 4983,
+  .ra = 304.025,
+  .dec = -52.0875,
+},
+{ .is_ngc = FALSE,
+  .id = 4984,
+  .ra = 304.072,
+  .dec = -52.7031,
+},
+{ .is_ngc = FALSE,
+  .id = 4985,
+  .ra = 305.186,
+  .dec = -70.9869,
+},
+{ .is_ngc = FALSE,
+  .id = 4986,
+  .ra = 304.298,
+  .dec = -55.0356,
+},
+{ .is_ngc = FALSE,
+  .id = 4987,
+  .ra = 304.331,
+  .dec = -52.2797,
+},
+{ .is_ngc = FALSE,
+  .id = 4988,
+  .ra = 305.442,
+  .dec = -69.3842,
+},
+{ .is_ngc = FALSE,
+  .id = 4988,
+  .ra = 305.441,
+  .dec = -69.3874,
+},
+{ .is_ngc = FALSE,
+  .id = 4989,
+  .ra = 304.848,
+  .dec = -58.5514,
+},
+{ .is_ngc = FALSE,
+  .id = 4990,
+  .ra = 305.357,
+  .dec = -66.8908,
+},
+{ .is_ngc = FALSE,
+  .id = 4991,
+  .ra = 304.597,
+  .dec = -41.05,
+},
+{ .is_ngc = FALSE,
+  .id = 4992,
+  .ra = 305.865,
+  .dec = -71.565,
+},
+{ .is_ngc = FALSE,
+  .id = 4993,
+  .ra = 305.485,
+  .dec = -66.9856,
+},
+{ .is_ngc = FALSE,
+  .id = 4994,
+  .ra = 304.935,
+  .dec = -53.4472,
+},
+{ .is_ngc = FALSE,
+  .id = 4995,
+  .ra = 304.996,
+  .dec = -52.6219,
+},
+{ .is_ngc = FALSE,
+  .id = 4996,
+  .ra = 304.025,
+  .dec = 37.55,
+},
+{ .is_ngc = FALSE,
+  .id = 4997,
+  .ra = 305.036,
+  .dec = 16.7318,
+},
+{ .is_ngc = FALSE,
+  .id = 4999,
+  .ra = 305.985,
+  .dec = -26.0147,
+},
+{ .is_ngc = FALSE,
+  .id = 5001,
+  .ra = 306.583,
+  .dec = -54.7753,
+},
+{ .is_ngc = FALSE,
+  .id = 5002,
+  .ra = 306.665,
+  .dec = -54.8,
+},
+{ .is_ngc = FALSE,
+  .id = 5005,
+  .ra = 306.333,
+  .dec = -25.8286,
+},
+{ .is_ngc = FALSE,
+  .id = 5006,
+  .ra = 305.945,
+  .dec = 6.44889,
+},
+{ .is_ngc = FALSE,
+  .id = 5008,
+  .ra = 308.187,
+  .dec = -72.695,
+},
+{ .is_ngc = FALSE,
+  .id = 5009,
+  .ra = 308.143,
+  .dec = -72.1667,
+},
+{ .is_ngc = FALSE,
+  .id = 5010,
+  .ra = 307.611,
+  .dec = -66.0975,
+},
+{ .is_ngc = FALSE,
+  .id = 5012,
+  .ra = 307.385,
+  .dec = -56.7431,
+},
+{ .is_ngc = FALSE,
+  .id = 5014,
+  .ra = 308.815,
+  .dec = -73.4528,
+},
+{ .is_ngc = FALSE,
+  .id = 5016,
+  .ra = 308.904,
+  .dec = -72.9114,
+},
+{ .is_ngc = FALSE,
+  .id = 5017,
+  .ra = 308.015,
+  .dec = -57.5881,
+},
+{ .is_ngc = FALSE,
+  .id = 5019,
+  .ra = 307.696,
+  .dec = -36.0767,
+},
+{ .is_ngc = FALSE,
+  .id = 5020,
+  .ra = 307.659,
+  .dec = -33.4853,
+},
+{ .is_ngc = FALSE,
+  .id = 5021,
+  .ra = 308.394,
+  .dec = -54.5211,
+},
+{ .is_ngc = FALSE,
+  .id = 5022,
+  .ra = 310.276,
+  .dec = -76.4497,
+},
+{ .is_ngc = FALSE,
+  .id = 5023,
+  .ra = 309.545,
+  .dec = -67.1847,
+},
+{ .is_ngc = FALSE,
+  .id = 5024,
+  .ra = 310.04,
+  .dec = -71.1083,
+},
+{ .is_ngc = FALSE,
+  .id = 5025,
+  .ra = 311.25,
+  .dec = -76.9844,
+},
+{ .is_ngc = FALSE,
+  .id = 5026,
+  .ra = 312.116,
+  .dec = -78.0692,
+},
+{ .is_ngc = FALSE,
+  .id = 5027,
+  .ra = 310.287,
+  .dec = -55.4722,
+},
+{ .is_ngc = FALSE,
+  .id = 5028,
+  .ra = 310.841,
+  .dec = -65.6469,
+},
+{ .is_ngc = FALSE,
+  .id = 5031,
+  .ra = 311.334,
+  .dec = -67.5391,
+},
+{ .is_ngc = FALSE,
+  .id = 5032,
+  .ra = 311.341,
+  .dec = -67.5516,
+},
+{ .is_ngc = FALSE,
+  .id = 5033,
+  .ra = 310.98,
+  .dec = -57.3353,
+},
+{ .is_ngc = FALSE,
+  .id = 5034,
+  .ra = 310.923,
+  .dec = -57.0306,
+},
+{ .is_ngc = FALSE,
+  .id = 5035,
+  .ra = 311.06,
+  .dec = -57.1275,
+},
+{ .is_ngc = FALSE,
+  .id = 5036,
+  .ra = 311.155,
+  .dec = -57.6267,
+},
+{ .is_ngc = FALSE,
+  .id = 5037,
+  .ra = 311.414,
+  .dec = -58.4494,
+},
+{ .is_ngc = FALSE,
+  .id = 5038,
+  .ra = 311.714,
+  .dec = -65.0167,
+},
+{ .is_ngc = FALSE,
+  .id = 5040,
+  .ra = 313.083,
+  .dec = -76.6861,
+},
+{ .is_ngc = FALSE,
+  .id = 5042,
+  .ra = 311.942,
+  .dec = -65.0847,
+},
+{ .is_ngc = FALSE,
+  .id = 5043,
+  .ra = 311.66,
+  .dec = -56.9844,
+},
+{ .is_ngc = FALSE,
+  .id = 5044,
+  .ra = 312.673,
+  .dec = -71.8981,
+},
+{ .is_ngc = FALSE,
+  .id = 5045,
+  .ra = 312.712,
+  .dec = -71.9092,
+},
+{ .is_ngc = FALSE,
+  .id = 5048,
+  .ra = 312.92,
+  .dec = -71.8008,
+},
+{ .is_ngc = FALSE,
+  .id = 5049,
+  .ra = 311.846,
+  .dec = -38.4025,
+},
+{ .is_ngc = FALSE,
+  .id = 5050,
+  .ra = 311.312,
+  .dec = -5.62294,
+},
+{ .is_ngc = FALSE,
+  .id = 5051,
+  .ra = 313.097,
+  .dec = -71.7889,
+},
+{ .is_ngc = FALSE,
+  .id = 5052,
+  .ra = 313.028,
+  .dec = -69.2042,
+},
+{ .is_ngc = FALSE,
+  .id = 5053,
+  .ra = 313.4,
+  .dec = -71.1406,
+},
+{ .is_ngc = FALSE,
+  .id = 5054,
+  .ra = 313.438,
+  .dec = -71.0244,
+},
+{ .is_ngc = FALSE,
+  .id = 5055,
+  .ra = 313.238,
+  .dec = -68.4447,
+},
+{ .is_ngc = FALSE,
+  .id = 5056,
+  .ra = 312.246,
+  .dec = -39.1692,
+},
+{ .is_ngc = FALSE,
+  .id = 5057,
+  .ra = 311.806,
+  .dec = 0.322028,
+},
+{ .is_ngc = FALSE,
+  .id = 5059,
+  .ra = 312.805,
+  .dec = -57.6889,
+},
+{ .is_ngc = FALSE,
+  .id = 5060,
+  .ra = 313.694,
+  .dec = -71.6369,
+},
+{ .is_ngc = FALSE,
+  .id = 5061,
+  .ra = 311.905,
+  .dec = 0.335806,
+},
+{ .is_ngc = FALSE,
+  .id = 5062,
+  .ra = 312.043,
+  .dec = -8.35972,
+},
+{ .is_ngc = FALSE,
+  .id = 5063,
+  .ra = 313.008,
+  .dec = -57.0697,
+},
+{ .is_ngc = FALSE,
+  .id = 5064,
+  .ra = 313.159,
+  .dec = -57.2319,
+},
+{ .is_ngc = FALSE,
+  .id = 5065,
+  .ra = 312.941,
+  .dec = -29.8477,
+},
+{ .is_ngc = FALSE,
+  .id = 5066,
+  .ra = 314.262,
+  .dec = -73.1478,
+},
+{ .is_ngc = FALSE,
+  .id = 5067,
+  .ra = 311.958,
+  .dec = 44.3667,
+},
+{ .is_ngc = FALSE,
+  .id = 5067,
+  .ra = 311.9,
+  .dec = 42.9006,
+},
+{ .is_ngc = FALSE,
+  .id = 5068,
+  .ra = 312.621,
+  .dec = 42.4686,
+},
+{ .is_ngc = FALSE,
+  .id = 5069,
+  .ra = 315.043,
+  .dec = -71.8105,
+},
+{ .is_ngc = FALSE,
+  .id = 5070,
+  .ra = 312.75,
+  .dec = 44.4003,
+},
+{ .is_ngc = FALSE,
+  .id = 5071,
+  .ra = 315.332,
+  .dec = -72.6428,
+},
+{ .is_ngc = FALSE,
+  .id = 5072,
+  .ra = 315.485,
+  .dec = -72.9883,
+},
+{ .is_ngc = FALSE,
+  .id = 5073,
+  .ra = 315.833,
+  .dec = -72.6878,
+},
+{ .is_ngc = FALSE,
+  .id = 5074,
+  .ra = 315.255,
+  .dec = -63.1536,
+},
+{ .is_ngc = FALSE,
+  .id = 5075,
+  .ra = 316.158,
+  .dec = -71.8681,
+},
+{ .is_ngc = FALSE,
+  .id = 5076,
+  .ra = 313.887,
+  .dec = 47.3853,
+},
+{ .is_ngc = FALSE,
+  .id = 5077,
+  .ra = 317.224,
+  .dec = -73.6408,
+},
+{ .is_ngc = FALSE,
+  .id = 5078,
+  .ra = 315.631,
+  .dec = -16.8175,
+},
+{ .is_ngc = FALSE,
+  .id = 5079,
+  .ra = 316.375,
+  .dec = -56.2358,
+},
+{ .is_ngc = FALSE,
+  .id = 5079,
+  .ra = 316.433,
+  .dec = -56.2303,
+},
+{ .is_ngc = FALSE,
+  .id = 5080,
+  .ra = 315.638,
+  .dec = 19.2136,
+},
+{ .is_ngc = FALSE,
+  .id = 5081,
+  .ra = 315.755,
+  .dec = 19.189,
+},
+{ .is_ngc = FALSE,
+  .id = 5083,
+  .ra = 315.965,
+  .dec = 11.7633,
+},
+{ .is_ngc = FALSE,
+  .id = 5084,
+  .ra = 317.31,
+  .dec = -63.29,
+},
+{ .is_ngc = FALSE,
+  .id = 5085,
+  .ra = 318.365,
+  .dec = -74.1028,
+},
+{ .is_ngc = FALSE,
+  .id = 5086,
+  .ra = 317.133,
+  .dec = -29.769,
+},
+{ .is_ngc = FALSE,
+  .id = 5087,
+  .ra = 318.59,
+  .dec = -73.7737,
+},
+{ .is_ngc = FALSE,
+  .id = 5088,
+  .ra = 317.361,
+  .dec = -22.8786,
+},
+{ .is_ngc = FALSE,
+  .id = 5089,
+  .ra = 317.727,
+  .dec = -3.86279,
+},
+{ .is_ngc = FALSE,
+  .id = 5090,
+  .ra = 317.877,
+  .dec = -2.03194,
+},
+{ .is_ngc = FALSE,
+  .id = 5091,
+  .ra = 319.405,
+  .dec = -70.6525,
+},
+{ .is_ngc = FALSE,
+  .id = 5092,
+  .ra = 319.058,
+  .dec = -64.465,
+},
+{ .is_ngc = FALSE,
+  .id = 5093,
+  .ra = 319.692,
+  .dec = -70.6228,
+},
+{ .is_ngc = FALSE,
+  .id = 5094,
+  .ra = 319.455,
+  .dec = -66.4281,
+},
+{ .is_ngc = FALSE,
+  .id = 5095,
+  .ra = 319.342,
+  .dec = -59.9472,
+},
+{ .is_ngc = FALSE,
+  .id = 5096,
+  .ra = 319.59,
+  .dec = -63.7611,
+},
+{ .is_ngc = FALSE,
+  .id = 5097,
+  .ra = 318.742,
+  .dec = 4.46722,
+},
+{ .is_ngc = FALSE,
+  .id = 5097,
+  .ra = 318.741,
+  .dec = 4.48389,
+},
+{ .is_ngc = FALSE,
+  .id = 5097,
+  .ra = 318.744,
+  .dec = 4.47014,
+},
+{ .is_ngc = FALSE,
+  .id = 5098,
+  .ra = 318.75,
+  .dec = 4.50028,
+},
+{ .is_ngc = FALSE,
+  .id = 5098,
+  .ra = 318.756,
+  .dec = 4.49444,
+},
+{ .is_ngc = FALSE,
+  .id = 5099,
+  .ra = 320.455,
+  .dec = -70.9825,
+},
+{ .is_ngc = FALSE,
+  .id = 5100,
+  .ra = 320.432,
+  .dec = -65.9333,
+},
+{ .is_ngc = FALSE,
+  .id = 5101,
+  .ra = 320.482,
+  .dec = -65.8366,
+},
+{ .is_ngc = FALSE,
+  .id = 5102,
+  .ra = 321.558,
+  .dec = -73.3103,
+},
+{ .is_ngc = FALSE,
+  .id = 5103,
+  .ra = 322.305,
+  .dec = -74.0697,
+},
+{ .is_ngc = FALSE,
+  .id = 5104,
+  .ra = 320.372,
+  .dec = 21.2412,
+},
+{ .is_ngc = FALSE,
+  .id = 5105,
+  .ra = 321.092,
+  .dec = -40.5372,
+},
+{ .is_ngc = FALSE,
+  .id = 5106,
+  .ra = 322.158,
+  .dec = -70.835,
+},
+{ .is_ngc = FALSE,
+  .id = 5107,
+  .ra = 322.063,
+  .dec = -65.7353,
+},
+{ .is_ngc = FALSE,
+  .id = 5108,
+  .ra = 323.214,
+  .dec = -72.6606,
+},
+{ .is_ngc = FALSE,
+  .id = 5109,
+  .ra = 323.428,
+  .dec = -74.1125,
+},
+{ .is_ngc = FALSE,
+  .id = 5110,
+  .ra = 322.68,
+  .dec = -60.0019,
+},
+{ .is_ngc = FALSE,
+  .id = 5111,
+  .ra = 322.045,
+  .dec = 2.47361,
+},
+{ .is_ngc = FALSE,
+  .id = 5112,
+  .ra = 322.373,
+  .dec = 6.78194,
+},
+{ .is_ngc = FALSE,
+  .id = 5112,
+  .ra = 322.372,
+  .dec = 6.78531,
+},
+{ .is_ngc = FALSE,
+  .id = 5112,
+  .ra = 322.367,
+  .dec = 6.79903,
+},
+{ .is_ngc = FALSE,
+  .id = 5113,
+  .ra = 322.419,
+  .dec = 6.81917,
+},
+{ .is_ngc = FALSE,
+  .id = 5113,
+  .ra = 322.415,
+  .dec = 6.81786,
+},
+{ .is_ngc = FALSE,
+  .id = 5113,
+  .ra = 322.418,
+  .dec = 6.81258,
+},
+{ .is_ngc = FALSE,
+  .id = 5115,
+  .ra = 322.738,
+  .dec = 11.7628,
+},
+{ .is_ngc = FALSE,
+  .id = 5116,
+  .ra = 324.272,
+  .dec = -70.9828,
+},
+{ .is_ngc = FALSE,
+  .id = 5117,
+  .ra = 323.129,
+  .dec = 44.5967,
+},
+{ .is_ngc = FALSE,
+  .id = 5118,
+  .ra = 325.557,
+  .dec = -71.3831,
+},
+{ .is_ngc = FALSE,
+  .id = 5119,
+  .ra = 323.483,
+  .dec = 21.8374,
+},
+{ .is_ngc = FALSE,
+  .id = 5122,
+  .ra = 324.941,
+  .dec = -22.4064,
+},
+{ .is_ngc = FALSE,
+  .id = 5123,
+  .ra = 326.206,
+  .dec = -72.4211,
+},
+{ .is_ngc = FALSE,
+  .id = 5124,
+  .ra = 324.979,
+  .dec = -22.4267,
+},
+{ .is_ngc = FALSE,
+  .id = 5125,
+  .ra = 325.46,
+  .dec = -52.7725,
+},
+{ .is_ngc = FALSE,
+  .id = 5126,
+  .ra = 325.119,
+  .dec = -6.34522,
+},
+{ .is_ngc = FALSE,
+  .id = 5127,
+  .ra = 324.954,
+  .dec = 6.28556,
+},
+{ .is_ngc = FALSE,
+  .id = 5128,
+  .ra = 325.798,
+  .dec = -38.9678,
+},
+{ .is_ngc = FALSE,
+  .id = 5129,
+  .ra = 326.945,
+  .dec = -65.3878,
+},
+{ .is_ngc = FALSE,
+  .id = 5130,
+  .ra = 327.6,
+  .dec = -73.9978,
+},
+{ .is_ngc = FALSE,
+  .id = 5131,
+  .ra = 326.856,
+  .dec = -34.8844,
+},
+{ .is_ngc = FALSE,
+  .id = 5132,
+  .ra = 325.668,
+  .dec = 66.1684,
+},
+{ .is_ngc = FALSE,
+  .id = 5133,
+  .ra = 325.696,
+  .dec = 66.1811,
+},
+{ .is_ngc = FALSE,
+  .id = 5134,
+  .ra = 325.744,
+  .dec = 66.1023,
+},
+{ .is_ngc = FALSE,
+  .id = 5137,
+  .ra = 327.904,
+  .dec = -65.5833,
+},
+{ .is_ngc = FALSE,
+  .id = 5138,
+  .ra = 328.34,
+  .dec = -68.9536,
+},
+{ .is_ngc = FALSE,
+  .id = 5139,
+  .ra = 327.607,
+  .dec = -30.9947,
+},
+{ .is_ngc = FALSE,
+  .id = 5140,
+  .ra = 328.566,
+  .dec = -67.3308,
+},
+{ .is_ngc = FALSE,
+  .id = 5141,
+  .ra = 328.322,
+  .dec = -59.4936,
+},
+{ .is_ngc = FALSE,
+  .id = 5142,
+  .ra = 328.834,
+  .dec = -65.51,
+},
+{ .is_ngc = FALSE,
+  .id = 5144,
+  .ra = 328.539,
+  .dec = 15.0365,
+},
+{ .is_ngc = FALSE,
+  .id = 5145,
+  .ra = 328.596,
+  .dec = 15.1564,
+},
+{ .is_ngc = FALSE,
+  .id = 5146,
+  .ra = 328.37,
+  .dec = 47.2669,
+},
+{ .is_ngc = FALSE,
+  .id = 5147,
+  .ra = 329.858,
+  .dec = -65.45,
+},
+{ .is_ngc = FALSE,
+  .id = 5149,
+  .ra = 329.745,
+  .dec = -27.4142,
+},
+{ .is_ngc = FALSE,
+  .id = 5151,
+  .ra = 329.72,
+  .dec = 3.76181,
+},
+{ .is_ngc = FALSE,
+  .id = 5152,
+  .ra = 330.673,
+  .dec = -51.2962,
+},
+{ .is_ngc = FALSE,
+  .id = 5153,
+  .ra = 330.098,
+  .dec = 17.8628,
+},
+{ .is_ngc = FALSE,
+  .id = 5154,
+  .ra = 331.125,
+  .dec = -66.115,
+},
+{ .is_ngc = FALSE,
+  .id = 5155,
+  .ra = 330.526,
+  .dec = 0.488056,
+},
+{ .is_ngc = FALSE,
+  .id = 5156,
+  .ra = 330.811,
+  .dec = -33.8375,
+},
+{ .is_ngc = FALSE,
+  .id = 5157,
+  .ra = 330.862,
+  .dec = -34.9414,
+},
+{ .is_ngc = FALSE,
+  .id = 5158,
+  .ra = 331.604,
+  .dec = -67.5178,
+},
+{ .is_ngc = FALSE,
+  .id = 5159,
+  .ra = 330.666,
+  .dec = 0.3195,
+},
+{ .is_ngc = FALSE,
+  .id = 5160,
+  .ra = 330.77,
+  .dec = 10.9248,
+},
+{ .is_ngc = FALSE,
+  .id = 5161,
+  .ra = 331.412,
+  .dec = 9.6399,
+},
+{ .is_ngc = FALSE,
+  .id = 5162,
+  .ra = 332.014,
+  .dec = -52.7136,
+},
+{ .is_ngc = FALSE,
+  .id = 5163,
+  .ra = 331.446,
+  .dec = 27.0836,
+},
+{ .is_ngc = FALSE,
+  .id = 5164,
+  .ra = 331.493,
+  .dec = 27.0471,
+},
+{ .is_ngc = FALSE,
+  .id = 5165,
+  .ra = 332.529,
+  .dec = -64.5778,
+},
+{ .is_ngc = FALSE,
+  .id = 5166,
+  .ra = 331.529,
+  .dec = 27.068,
+},
+{ .is_ngc = FALSE,
+  .id = 5167,
+  .ra = 331.882,
+  .dec = -8.12236,
+},
+{ .is_ngc = FALSE,
+  .id = 5168,
+  .ra = 332.19,
+  .dec = -27.8564,
+},
+{ .is_ngc = FALSE,
+  .id = 5169,
+  .ra = 332.541,
+  .dec = -36.0889,
+},
+{ .is_ngc = FALSE,
+  .id = 5170,
+  .ra = 333.124,
+  .dec = -47.2219,
+},
+{ .is_ngc = FALSE,
+  .id = 5171,
+  .ra = 332.735,
+  .dec = -46.0819,
+},
+{ .is_ngc = FALSE,
+  .id = 5172,
+  .ra = 332.481,
+  .dec = 12.8172,
+},
+{ .is_ngc = FALSE,
+  .id = 5173,
+  .ra = 333.688,
+  .dec = -69.3525,
+},
+{ .is_ngc = FALSE,
+  .id = 5174,
+  .ra = 333.186,
+  .dec = -38.1719,
+},
+{ .is_ngc = FALSE,
+  .id = 5175,
+  .ra = 333.2,
+  .dec = -38.1272,
+},
+{ .is_ngc = FALSE,
+  .id = 5176,
+  .ra = 333.728,
+  .dec = -66.8492,
+},
+{ .is_ngc = FALSE,
+  .id = 5177,
+  .ra = 332.893,
+  .dec = 11.7954,
+},
+{ .is_ngc = FALSE,
+  .id = 5178,
+  .ra = 333.137,
+  .dec = -22.9553,
+},
+{ .is_ngc = FALSE,
+  .id = 5180,
+  .ra = 332.8,
+  .dec = 38.9271,
+},
+{ .is_ngc = FALSE,
+  .id = 5181,
+  .ra = 333.339,
+  .dec = -46.0183,
+},
+{ .is_ngc = FALSE,
+  .id = 5182,
+  .ra = 334.021,
+  .dec = -65.4553,
+},
+{ .is_ngc = FALSE,
+  .id = 5185,
+  .ra = 334.432,
+  .dec = -65.8578,
+},
+{ .is_ngc = FALSE,
+  .id = 5186,
+  .ra = 334.694,
+  .dec = -36.8012,
+},
+{ .is_ngc = FALSE,
+  .id = 5187,
+  .ra = 334.575,
+  .dec = -59.6076,
+},
+{ .is_ngc = FALSE,
+  .id = 5188,
+  .ra = 334.608,
+  .dec = -59.6407,
+},
+{ .is_ngc = FALSE,
+  .id = 5189,
+  .ra = 334.059,
+  .dec = -5.00469,
+},
+{ .is_ngc = FALSE,
+  .id = 5190,
+  .ra = 334.754,
+  .dec = -59.8825,
+},
+{ .is_ngc = FALSE,
+  .id = 5191,
+  .ra = 333.761,
+  .dec = 37.3002,
+},
+{ .is_ngc = FALSE,
+  .id = 5192,
+  .ra = 333.81,
+  .dec = 37.2722,
+},
+{ .is_ngc = FALSE,
+  .id = 5193,
+  .ra = 333.932,
+  .dec = 37.2431,
+},
+{ .is_ngc = FALSE,
+  .id = 5194,
+  .ra = 334.284,
+  .dec = -15.9456,
+},
+{ .is_ngc = FALSE,
+  .id = 5195,
+  .ra = 333.924,
+  .dec = 37.3031,
+},
+{ .is_ngc = FALSE,
+  .id = 5196,
+  .ra = 335.048,
+  .dec = -65.4048,
+},
+{ .is_ngc = FALSE,
+  .id = 5197,
+  .ra = 334.957,
+  .dec = -60.1367,
+},
+{ .is_ngc = FALSE,
+  .id = 5199,
+  .ra = 334.887,
+  .dec = -37.5336,
+},
+{ .is_ngc = FALSE,
+  .id = 5200,
+  .ra = 335.563,
+  .dec = -65.7661,
+},
+{ .is_ngc = FALSE,
+  .id = 5201,
+  .ra = 335.239,
+  .dec = -46.0353,
+},
+{ .is_ngc = FALSE,
+  .id = 5202,
+  .ra = 335.728,
+  .dec = -65.8022,
+},
+{ .is_ngc = FALSE,
+  .id = 5203,
+  .ra = 335.645,
+  .dec = -59.7736,
+},
+{ .is_ngc = FALSE,
+  .id = 5205,
+  .ra = 335.7,
+  .dec = -59.7869,
+},
+{ .is_ngc = FALSE,
+  .id = 5206,
+  .ra = 336.018,
+  .dec = -66.8581,
+},
+{ .is_ngc = FALSE,
+  .id = 5207,
+  .ra = 335.872,
+  .dec = -60.5653,
+},
+{ .is_ngc = FALSE,
+  .id = 5208,
+  .ra = 336.141,
+  .dec = -65.2278,
+},
+{ .is_ngc = FALSE,
+  .id = 5209,
+  .ra = 335.787,
+  .dec = -37.9944,
+},
+{ .is_ngc = FALSE,
+  .id = 5210,
+  .ra = 335.63,
+  .dec = -18.8697,
+},
+{ .is_ngc = FALSE,
+  .id = 5211,
+  .ra = 335.68,
+  .dec = -18.88,
+},
+{ .is_ngc = FALSE,
+  .id = 5212,
+  .ra = 335.877,
+  .dec = -38.0381,
+},
+{ .is_ngc = FALSE,
+  .id = 5213,
+  .ra = 336.271,
+  .dec = -60.4769,
+},
+{ .is_ngc = FALSE,
+  .id = 5214,
+  .ra = 335.925,
+  .dec = -27.4672,
+},
+{ .is_ngc = FALSE,
+  .id = 5215,
+  .ra = 336.743,
+  .dec = -65.9831,
+},
+{ .is_ngc = FALSE,
+  .id = 5216,
+  .ra = 336.183,
+  .dec = -18.0842,
+},
+{ .is_ngc = FALSE,
+  .id = 5217,
+  .ra = 335.982,
+  .dec = 50.9668,
+},
+{ .is_ngc = FALSE,
+  .id = 5218,
+  .ra = 337.026,
+  .dec = -60.3947,
+},
+{ .is_ngc = FALSE,
+  .id = 5219,
+  .ra = 337.182,
+  .dec = -65.8939,
+},
+{ .is_ngc = FALSE,
+  .id = 5220,
+  .ra = 337.01,
+  .dec = -59.7228,
+},
+{ .is_ngc = FALSE,
+  .id = 5221,
+  .ra = 337.241,
+  .dec = -65.905,
+},
+{ .is_ngc = FALSE,
+  .id = 5222,
+  .ra = 337.476,
+  .dec = -65.6617,
+},
+{ .is_ngc = FALSE,
+  .id = 5223,
+  .ra = 337.437,
+  .dec = 7.98874,
+},
+{ .is_ngc = FALSE,
+  .id = 5224,
+  .ra = 337.624,
+  .dec = -45.9944,
+},
+{ .is_ngc = FALSE,
+  .id = 5226,
+  .ra = 338.125,
+  .dec = -25.6621,
+},
+{ .is_ngc = FALSE,
+  .id = 5227,
+  .ra = 338.515,
+  .dec = -64.6981,
+},
+{ .is_ngc = FALSE,
+  .id = 5229,
+  .ra = 338.71,
+  .dec = -61.3822,
+},
+{ .is_ngc = FALSE,
+  .id = 5230,
+  .ra = 338.918,
+  .dec = -61.5475,
+},
+{ .is_ngc = FALSE,
+  .id = 5231,
+  .ra = 338.503,
+  .dec = 23.3383,
+},
+{ .is_ngc = FALSE,
+  .id = 5232,
+  .ra = 339.41,
+  .dec = -68.8717,
+},
+{ .is_ngc = FALSE,
+  .id = 5233,
+  .ra = 339.137,
+  .dec = 25.763,
+},
+{ .is_ngc = FALSE,
+  .id = 5234,
+  .ra = 340.047,
+  .dec = -65.8244,
+},
+{ .is_ngc = FALSE,
+  .id = 5235,
+  .ra = 340.355,
+  .dec = -66.5803,
+},
+{ .is_ngc = FALSE,
+  .id = 5236,
+  .ra = 340.376,
+  .dec = -66.6172,
+},
+{ .is_ngc = FALSE,
+  .id = 5238,
+  .ra = 340.373,
+  .dec = -60.7581,
+},
+{ .is_ngc = FALSE,
+  .id = 5239,
+  .ra = 337.779,
+  .dec = -38.0266,
+},
+{ .is_ngc = FALSE,
+  .id = 5240,
+  .ra = 340.468,
+  .dec = -44.7675,
+},
+{ .is_ngc = FALSE,
+  .id = 5241,
+  .ra = 340.411,
+  .dec = 2.63919,
+},
+{ .is_ngc = FALSE,
+  .id = 5242,
+  .ra = 340.313,
+  .dec = 23.4067,
+},
+{ .is_ngc = FALSE,
+  .id = 5243,
+  .ra = 340.352,
+  .dec = 23.3755,
+},
+{ .is_ngc = FALSE,
+  .id = 5244,
+  .ra = 341.056,
+  .dec = -64.0428,
+},
+{ .is_ngc = FALSE,
+  .id = 5245,
+  .ra = 341.234,
+  .dec = -65.358,
+},
+{ .is_ngc = FALSE,
+  .id = 5246,
+  .ra = 341.663,
+  .dec = -64.8972,
+},
+{ .is_ngc = FALSE,
+  .id = 5247,
+  .ra = 341.707,
+  .dec = -65.2742,
+},
+{ .is_ngc = FALSE,
+  .id = 5248,
+  .ra = 341.178,
+  .dec = -0.339444,
+},
+{ .is_ngc = FALSE,
+  .id = 5249,
+  .ra = 341.777,
+  .dec = -64.8308,
+},
+{ .is_ngc = FALSE,
+  .id = 5250,
+  .ra = 341.829,
+  .dec = -65.0514,
+},
+{ .is_ngc = FALSE,
+  .id = 5251,
+  .ra = 341.295,
+  .dec = 11.1578,
+},
+{ .is_ngc = FALSE,
+  .id = 5252,
+  .ra = 342.037,
+  .dec = -68.9028,
+},
+{ .is_ngc = FALSE,
+  .id = 5253,
+  .ra = 341.371,
+  .dec = 21.8078,
+},
+{ .is_ngc = FALSE,
+  .id = 5254,
+  .ra = 341.501,
+  .dec = 21.125,
+},
+{ .is_ngc = FALSE,
+  .id = 5255,
+  .ra = 341.442,
+  .dec = 36.2183,
+},
+{ .is_ngc = FALSE,
+  .id = 5256,
+  .ra = 342.44,
+  .dec = -68.6911,
+},
+{ .is_ngc = FALSE,
+  .id = 5257,
+  .ra = 343.067,
+  .dec = -67.4192,
+},
+{ .is_ngc = FALSE,
+  .id = 5258,
+  .ra = 342.882,
+  .dec = 23.0806,
+},
+{ .is_ngc = FALSE,
+  .id = 5259,
+  .ra = 343.811,
+  .dec = 36.6717,
+},
+{ .is_ngc = FALSE,
+  .id = 5261,
+  .ra = 343.605,
+  .dec = -20.3633,
+},
+{ .is_ngc = FALSE,
+  .id = 5262,
+  .ra = 343.833,
+  .dec = -33.8847,
+},
+{ .is_ngc = FALSE,
+  .id = 5263,
+  .ra = 344.557,
+  .dec = -69.0526,
+},
+{ .is_ngc = FALSE,
+  .id = 5264,
+  .ra = 344.219,
+  .dec = -36.5545,
+},
+{ .is_ngc = FALSE,
+  .id = 5266,
+  .ra = 344.586,
+  .dec = -65.1292,
+},
+{ .is_ngc = FALSE,
+  .id = 5267,
+  .ra = 344.306,
+  .dec = -43.3964,
+},
+{ .is_ngc = FALSE,
+  .id = 5268,
+  .ra = 344.05,
+  .dec = 36.5856,
+},
+{ .is_ngc = FALSE,
+  .id = 5268,
+  .ra = 344.075,
+  .dec = 36.5997,
+},
+{ .is_ngc = FALSE,
+  .id = 5269,
+  .ra = 344.431,
+  .dec = -36.0264,
+},
+{ .is_ngc = FALSE,
+  .id = 5270,
+  .ra = 344.479,
+  .dec = -35.8579,
+},
+{ .is_ngc = FALSE,
+  .id = 5271,
+  .ra = 344.507,
+  .dec = -33.7422,
+},
+{ .is_ngc = FALSE,
+  .id = 5272,
+  .ra = 344.88,
+  .dec = -65.1932,
+},
+{ .is_ngc = FALSE,
+  .id = 5273,
+  .ra = 344.86,
+  .dec = -37.705,
+},
+{ .is_ngc = FALSE,
+  .id = 5274,
+  .ra = 344.615,
+  .dec = 18.9186,
+},
+{ .is_ngc = FALSE,
+  .id = 5275,
+  .ra = 344.664,
+  .dec = 18.8619,
+},
+{ .is_ngc = FALSE,
+  .id = 5276,
+  .ra = 344.666,
+  .dec = 18.8197,
+},
+{ .is_ngc = FALSE,
+  .id = 5277,
+  .ra = 345.497,
+  .dec = -65.1978,
+},
+{ .is_ngc = FALSE,
+  .id = 5278,
+  .ra = 345.066,
+  .dec = -8.17903,
+},
+{ .is_ngc = FALSE,
+  .id = 5279,
+  .ra = 345.76,
+  .dec = -69.2103,
+},
+{ .is_ngc = FALSE,
+  .id = 5280,
+  .ra = 345.959,
+  .dec = -65.2081,
+},
+{ .is_ngc = FALSE,
+  .id = 5281,
+  .ra = 345.598,
+  .dec = 27.0064,
+},
+{ .is_ngc = FALSE,
+  .id = 5282,
+  .ra = 345.701,
+  .dec = 21.8738,
+},
+{ .is_ngc = FALSE,
+  .id = 5283,
+  .ra = 345.825,
+  .dec = 8.89306,
+},
+{ .is_ngc = FALSE,
+  .id = 5284,
+  .ra = 346.693,
+  .dec = 19.1217,
+},
+{ .is_ngc = FALSE,
+  .id = 5285,
+  .ra = 346.745,
+  .dec = 22.9364,
+},
+{ .is_ngc = FALSE,
+  .id = 5286,
+  .ra = 347.484,
+  .dec = -68.2544,
+},
+{ .is_ngc = FALSE,
+  .id = 5287,
+  .ra = 347.335,
+  .dec = 0.75625,
+},
+{ .is_ngc = FALSE,
+  .id = 5288,
+  .ra = 347.934,
+  .dec = -68.0944,
+},
+{ .is_ngc = FALSE,
+  .id = 5289,
+  .ra = 347.821,
+  .dec = -32.4522,
+},
+{ .is_ngc = FALSE,
+  .id = 5291,
+  .ra = 348.415,
+  .dec = 9.24131,
+},
+{ .is_ngc = FALSE,
+  .id = 5292,
+  .ra = 348.446,
+  .dec = 13.6867,
+},
+{ .is_ngc = FALSE,
+  .id = 5293,
+  .ra = 348.686,
+  .dec = 25.1405,
+},
+{ .is_ngc = FALSE,
+  .id = 5295,
+  .ra = 348.871,
+  .dec = 25.1205,
+},
+{ .is_ngc = FALSE,
+  .id = 5296,
+  .ra = 348.933,
+  .dec = 25.0943,
+},
+{ .is_ngc = FALSE,
+  .id = 5297,
+  .ra = 348.993,
+  .dec = 25.0254,
+},
+{ .is_ngc = FALSE,
+  .id = 5298,
+  .ra = 349.003,
+  .dec = 25.5567,
+},
+{ .is_ngc = FALSE,
+  .id = 5299,
+  .ra = 349.08,
+  .dec = 20.8559,
+},
+{ .is_ngc = FALSE,
+  .id = 5300,
+  .ra = 349.142,
+  .dec = 20.8284,
+},
+{ .is_ngc = FALSE,
+  .id = 5301,
+  .ra = 349.746,
+  .dec = -69.5628,
+},
+{ .is_ngc = FALSE,
+  .id = 5302,
+  .ra = 349.902,
+  .dec = -64.5692,
+},
+{ .is_ngc = FALSE,
+  .id = 5303,
+  .ra = 349.478,
+  .dec = 0.264167,
+},
+{ .is_ngc = FALSE,
+  .id = 5304,
+  .ra = 349.719,
+  .dec = -10.2596,
+},
+{ .is_ngc = FALSE,
+  .id = 5305,
+  .ra = 349.526,
+  .dec = 10.2997,
+},
+{ .is_ngc = FALSE,
+  .id = 5306,
+  .ra = 349.547,
+  .dec = 10.2456,
+},
+{ .is_ngc = FALSE,
+  .id = 5307,
+  .ra = 349.592,
+  .dec = 10.2357,
+},
+{ .is_ngc = FALSE,
+  .id = 5309,
+  .ra = 349.799,
+  .dec = 8.10922,
+},
+{ .is_ngc = FALSE,
+  .id = 5310,
+  .ra = 350.199,
+  .dec = -22.1493,
+},
+{ .is_ngc = FALSE,
+  .id = 5311,
+  .ra = 350.14,
+  .dec = 17.2656,
+},
+{ .is_ngc = FALSE,
+  .id = 5311,
+  .ra = 350.158,
+  .dec = 17.2738,
+},
+{ .is_ngc = FALSE,
+  .id = 5311,
+  .ra = 350.14,
+  .dec = 17.2579,
+},
+{ .is_ngc = FALSE,
+  .id = 5312,
+  .ra = 350.243,
+  .dec = 19.3179,
+},
+{ .is_ngc = FALSE,
+  .id = 5314,
+  .ra = 350.286,
+  .dec = 19.3111,
+},
+{ .is_ngc = FALSE,
+  .id = 5315,
+  .ra = 350.326,
+  .dec = 25.3853,
+},
+{ .is_ngc = FALSE,
+  .id = 5316,
+  .ra = 350.475,
+  .dec = 21.2025,
+},
+{ .is_ngc = FALSE,
+  .id = 5317,
+  .ra = 350.87,
+  .dec = 21.1631,
+},
+{ .is_ngc = FALSE,
+  .id = 5319,
+  .ra = 351.204,
+  .dec = 13.9965,
+},
+{ .is_ngc = FALSE,
+  .id = 5320,
+  .ra = 352.09,
+  .dec = -67.7599,
+},
+{ .is_ngc = FALSE,
+  .id = 5321,
+  .ra = 351.584,
+  .dec = -17.9561,
+},
+{ .is_ngc = FALSE,
+  .id = 5322,
+  .ra = 352.128,
+  .dec = -67.7609,
+},
+{ .is_ngc = FALSE,
+  .id = 5323,
+  .ra = 351.903,
+  .dec = -67.815,
+},
+{ .is_ngc = FALSE,
+  .id = 5324,
+  .ra = 352.072,
+  .dec = -67.8212,
+},
+{ .is_ngc = FALSE,
+  .id = 5325,
+  .ra = 352.18,
+  .dec = -41.3334,
+},
+{ .is_ngc = FALSE,
+  .id = 5326,
+  .ra = 352.396,
+  .dec = -28.8311,
+},
+{ .is_ngc = FALSE,
+  .id = 5328,
+  .ra = 353.319,
+  .dec = -45.0163,
+},
+{ .is_ngc = FALSE,
+  .id = 5329,
+  .ra = 353.29,
+  .dec = 21.2369,
+},
+{ .is_ngc = FALSE,
+  .id = 5330,
+  .ra = 353.36,
+  .dec = -2.88314,
+},
+{ .is_ngc = FALSE,
+  .id = 5331,
+  .ra = 353.353,
+  .dec = 21.1298,
+},
+{ .is_ngc = FALSE,
+  .id = 5332,
+  .ra = 353.614,
+  .dec = -36.1012,
+},
+{ .is_ngc = FALSE,
+  .id = 5334,
+  .ra = 353.652,
+  .dec = -4.53389,
+},
+{ .is_ngc = FALSE,
+  .id = 5335,
+  .ra = 353.946,
+  .dec = -67.3958,
+},
+{ .is_ngc = FALSE,
+  .id = 5337,
+  .ra = 354.105,
+  .dec = 21.1505,
+},
+{ .is_ngc = FALSE,
+  .id = 5338,
+  .ra = 354.127,
+  .dec = 21.1455,
+},
+{ .is_ngc = FALSE,
+  .id = 5339,
+  .ra = 354.522,
+  .dec = -68.4425,
+},
+{ .is_ngc = FALSE,
+  .id = 5340,
+  .ra = 354.633,
+  .dec = -4.85083,
+},
+{ .is_ngc = FALSE,
+  .id = 5341,
+  .ra = 354.612,
+  .dec = 26.9852,
+},
+{ .is_ngc = FALSE,
+  .id = 5342,
+  .ra = 354.662,
+  .dec = 27.0113,
+},
+{ .is_ngc = FALSE,
+  .id = 5343,
+  .ra = 354.843,
+  .dec = -22.4975,
+},
+{ .is_ngc = FALSE,
+  .id = 5344,
+  .ra = 354.816,
+  .dec = -4.96667,
+},
+{ .is_ngc = FALSE,
+  .id = 5345,
+  .ra = 354.885,
+  .dec = -22.4139,
+},
+{ .is_ngc = FALSE,
+  .id = 5346,
+  .ra = 355.276,
+  .dec = 24.95,
+},
+{ .is_ngc = FALSE,
+  .id = 5347,
+  .ra = 355.403,
+  .dec = 24.8859,
+},
+{ .is_ngc = FALSE,
+  .id = 5349,
+  .ra = 356.595,
+  .dec = -28.0131,
+},
+{ .is_ngc = FALSE,
+  .id = 5350,
+  .ra = 356.812,
+  .dec = -27.9575,
+},
+{ .is_ngc = FALSE,
+  .id = 5351,
+  .ra = 356.829,
+  .dec = -2.31381,
+},
+{ .is_ngc = FALSE,
+  .id = 5352,
+  .ra = 356.833,
+  .dec = -2.28128,
+},
+{ .is_ngc = FALSE,
+  .id = 5353,
+  .ra = 356.87,
+  .dec = -28.109,
+},
+{ .is_ngc = FALSE,
+  .id = 5355,
+  .ra = 356.814,
+  .dec = 32.7827,
+},
+{ .is_ngc = FALSE,
+  .id = 5356,
+  .ra = 356.849,
+  .dec = -2.3515,
+},
+{ .is_ngc = FALSE,
+  .id = 5357,
+  .ra = 356.846,
+  .dec = -2.30089,
+},
+{ .is_ngc = FALSE,
+  .id = 5358,
+  .ra = 356.938,
+  .dec = -28.1412,
+},
+{ .is_ngc = FALSE,
+  .id = 5359,
+  .ra = 356.908,
+  .dec = -2.31742,
+},
+{ .is_ngc = FALSE,
+  .id = 5360,
+  .ra = 356.971,
+  .dec = -37.0514,
+},
+{ .is_ngc = FALSE,
+  .id = 5364,
+  .ra = 359.103,
+  .dec = -29.0231,
+},
+{ .is_ngc = FALSE,
+  .id = 5365,
+  .ra = 359.392,
+  .dec = -37.0181,
+},
+{ .is_ngc = FALSE,
+  .id = 5366,
+  .ra = 359.417,
+  .dec = 52.7847,
+},
+{ .is_ngc = FALSE,
+  .id = 5366,
+  .ra = 359.279,
+  .dec = 50.7833,
+},
+{ .is_ngc = FALSE,
+  .id = 5367,
+  .ra = 359.662,
+  .dec = 22.4491,
+},
+{ .is_ngc = FALSE,
+  .id = 5369,
+  .ra = 359.961,
+  .dec = 32.7021,
+},
+{ .is_ngc = FALSE,
+  .id = 5370,
+  .ra = 0.038125,
+  .dec = 32.7385,
+},
+{ .is_ngc = FALSE,
+  .id = 5371,
+  .ra = 0.06125,
+  .dec = 32.8317,
+},
+{ .is_ngc = FALSE,
+  .id = 5372,
+  .ra = 0.0676625,
+  .dec = 32.7925,
+},
+{ .is_ngc = FALSE,
+  .id = 5373,
+  .ra = 0.120833,
+  .dec = 32.7821,
+},
+{ .is_ngc = FALSE,
+  .id = 5374,
+  .ra = 0.268917,
+  .dec = 4.50031,
+},
+{ .is_ngc = FALSE,
+  .id = 5375,
+  .ra = 0.270125,
+  .dec = 4.54189,
+},
+{ .is_ngc = FALSE,
+  .id = 5376,
+  .ra = 0.332792,
+  .dec = 34.5255,
+},
+{ .is_ngc = FALSE,
+  .id = 5377,
+  .ra = 0.522667,
+  .dec = 16.5901,
+},
+{ .is_ngc = FALSE,
+  .id = 5379,
+  .ra = 0.669583,
+  .dec = 16.5997,
+},
+{ .is_ngc = FALSE,
+  .id = 5380,
+  .ra = 0.704583,
+  .dec = -66.1867,
+},
+{ .is_ngc = FALSE,
+  .id = 5381,
+  .ra = 0.796958,
+  .dec = 15.9652,
+},
+{ .is_ngc = FALSE,
+  .id = 5382,
+  .ra = 0.859583,
+  .dec = -65.1967,
+},
+{ .is_ngc = FALSE,
+  .id = 5383,
+  .ra = 0.953333,
+  .dec = 16.0142,
+},
+{ .is_ngc = FALSE,
+  .id = 5385,
+  .ra = 1.59583,
+  .dec = -0.0683333,
+},
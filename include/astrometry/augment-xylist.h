@@ -135,6 +135,10 @@ struct augment_xylist_s {
 	anbool verify_uniformize;
 	anbool verify_dedup;
 
+	// quick check before verification; -1: the engine's default
+	int preverify_nref;
+	int preverify_min_match;
+
     // try to verify FITS input images?
     anbool try_verify;
 
@@ -58,6 +58,13 @@ struct blind_params {
     // Indexes to use (index_t objects)
     pl* indexes;
 
+    // Optional, when not running the indexes in parallel: called just
+    // before and after each of "indexes" is searched, eg. to load it on
+    // demand.  A non-zero return from "index_acquire" is fatal.
+    int (*index_acquire)(index_t* index, void* token);
+    void (*index_release)(index_t* index, void* token);
+    void* index_token;
+
     int index_options;
 
     // Quad size fraction: select indexes that contain quads of size fraction
@@ -50,6 +50,19 @@ void ctmf(
         int r, int channels, unsigned long memsize
         );
 
+/**
+ * \brief Like ctmf(), but with the work split among \a nthreads threads.
+ *
+ * The result is identical to ctmf()'s.
+ */
+void ctmf_threads(
+        const unsigned char* src, unsigned char* dst,
+        int width, int height,
+        int src_step_row, int dst_step_row,
+        int r, int channels, unsigned long memsize,
+        int nthreads
+        );
+
 #ifdef __cplusplus
 }
 #endif
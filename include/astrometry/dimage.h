@@ -16,6 +16,23 @@ dimage_label_t collapsing_find_minlabel(dimage_label_t label, dimage_label_t *eq
 int dfind2(const int* image, int nx, int ny, int* objectimg, int* p_nobjects);
 int dfind2_u8(const unsigned char* image, int nx, int ny, int* objectimg, int* p_nobjects);
 
+/**
+ Runs func(arg, lo, hi) over "nthreads" contiguous slices of [0, N),
+ each in its own thread (the first in the caller's), and waits for
+ them all.  With nthreads <= 1 it's just func(arg, 0, N).
+ */
+typedef void (*dparallel_func)(void* arg, int lo, int hi);
+void dparallel(int nthreads, int N, dparallel_func func, void* arg);
+// The number of slices dparallel() will use.
+int dparallel_nslices(int nthreads, int N);
+
+/*
+ The "_threads" versions of the simplexy stages split the work across
+ "nthreads" threads; their results are identical to the serial ones.
+ */
+int dfind2_u8_threads(const unsigned char* image, int nx, int ny,
+                      int* objectimg, int* p_nobjects, int nthreads);
+
 float dselip(unsigned long k, unsigned long n, const float *arr);
 void dselip_cleanup(void);
 
@@ -24,12 +41,44 @@ int dsmooth(float *image, int nx, int ny, float sigma, float *smooth);
 void dsmooth2(float *image, int nx, int ny, float sigma, float *smooth);
 void dsmooth2_u8(uint8_t *image, int nx, int ny, float sigma, float *smooth);
 void dsmooth2_i16(int16_t *image, int nx, int ny, float sigma, float *smooth);
+void dsmooth2_threads(float *image, int nx, int ny, float sigma, float *smooth,
+                      int nthreads);
+void dsmooth2_u8_threads(uint8_t *image, int nx, int ny, float sigma,
+                         float *smooth, int nthreads);
+void dsmooth2_i16_threads(int16_t *image, int nx, int ny, float sigma,
+                          float *smooth, int nthreads);
+
+/*
+ The row and column passes of dsmooth2 have vectorized kernels, chosen
+ at runtime from what the CPU supports.  They add up the same products
+ in the same order as the scalar loops, but may fuse the multiply-adds
+ differently, so the results agree only to float rounding.  The same
+ kernel is used for every thread, so the threaded versions still match
+ the serial ones exactly.
+ */
+enum dsmooth_kernel {
+	DSMOOTH_SCALAR = 0,
+	DSMOOTH_SSE2   = 1,
+	DSMOOTH_AVX2   = 2,
+};
+
+// The best kernel this CPU supports.
+int dsmooth2_best_kernel(void);
+
+// The kernel currently in use (the best one, unless overridden).
+int dsmooth2_kernel(void);
+
+// Override the kernel choice, for testing and benchmarking; -1 goes back
+// to automatic selection.  Not thread-safe.
+void dsmooth2_set_kernel(int kernel);
 
 int dobjects(float *image, int nx, int ny, float limit,
 			 float dpsf, int *objects);
 
 int dmask(float *image, int nx, int ny, float limit,
 		  float dpsf, uint8_t* mask);
+int dmask_threads(float *image, int nx, int ny, float limit,
+                  float dpsf, uint8_t* mask, int nthreads);
 
 int dpeaks(float *image, int nx, int ny, int *npeaks, int *xcen,
            int *ycen, float sigma, float dlim, float saddle, int maxnpeaks,
@@ -42,6 +91,25 @@ int dsigma_u8(uint8_t *image, int nx, int ny, int sp, int gridsize, float *sigma
 
 int dmedsmooth(const float *image, const uint8_t *masked,
                int nx, int ny, int halfbox, float *smooth);
+int dmedsmooth_threads(const float *image, const uint8_t *masked,
+                       int nx, int ny, int halfbox, float *smooth,
+                       int nthreads);
+
+/*
+ How dmedsmooth finds the median of each grid box.  DMEDSMOOTH_BINNED
+ histograms the box's pixels within one standard deviation of their
+ mean; its answer is within (standard deviation of the box's pixels) /
+ DMEDSMOOTH_NBINS of the exact median, and it is several times faster.
+ */
+enum dmedsmooth_method {
+    DMEDSMOOTH_EXACT = 0,
+    DMEDSMOOTH_BINNED = 1,
+};
+#define DMEDSMOOTH_NBINS 1000
+
+int dmedsmooth_method_threads(const float *image, const uint8_t *masked,
+                              int nx, int ny, int halfbox, int method,
+                              float *smooth, int nthreads);
 
 int dallpeaks(float *image, int nx, int ny, int *objects, float *xcen,
               float *ycen, int *npeaks, float dpsf, float sigma,
@@ -56,4 +124,61 @@ int dallpeaks_i16(int16_t *image, int nx, int ny, int *objects, float *xcen,
 				  float dlim, float saddle,
 				  int maxper, int maxnpeaks, float minpeak, int maxsize);
 
+// "nobjects" is the number of labels in "objects", as from dfind2.
+int dallpeaks_threads(float *image, int nx, int ny, int *objects,
+                      int nobjects, float *xcen, float *ycen, int *npeaks,
+                      float dpsf, float sigma, float dlim, float saddle,
+                      int maxper, int maxnpeaks, float minpeak, int maxsize,
+                      int nthreads);
+int dallpeaks_u8_threads(uint8_t *image, int nx, int ny, int *objects,
+                         int nobjects, float *xcen, float *ycen, int *npeaks,
+                         float dpsf, float sigma, float dlim, float saddle,
+                         int maxper, int maxnpeaks, float minpeak,
+                         int maxsize, int nthreads);
+int dallpeaks_i16_threads(int16_t *image, int nx, int ny, int *objects,
+                          int nobjects, float *xcen, float *ycen, int *npeaks,
+                          float dpsf, float sigma, float dlim, float saddle,
+                          int maxper, int maxnpeaks, float minpeak,
+                          int maxsize, int nthreads);
+
+/*
+ Pieces of the simplexy stages for callers that only hold a band of
+ the image's rows at a time (see simplexy_run_stream()).  Row numbers
+ are those of the whole image.
+ */
+int dmedsmooth_gridpoints(int nx, int halfbox, int* p_nxgrid, int** p_xgrid,
+                          int** p_xlo, int** p_xhi);
+// Computes rows [jlo, jhi) of the grid of medians.  "image" holds the
+// image rows from y0 on, covering ylo[jlo] to yhi[jhi-1].
+void dmedsmooth_grid_rows(const float* image, int y0, int nx, int halfbox,
+                          int nxgrid, const int* xlo, const int* xhi,
+                          const int* ylo, const int* yhi,
+                          int jlo, int jhi, float* grid, int method,
+                          int nthreads);
+// Interpolates the grid over image rows [rlo, rhi), into "smooth",
+// which holds just those rows.
+void dmedsmooth_interpolate_rows(const float* grid, int nx, int ny,
+                                 int nxgrid, int nygrid,
+                                 const int* xgrid, const int* ygrid,
+                                 int halfbox, int rlo, int rhi,
+                                 float* smooth, int nthreads);
+// Fills in mask rows [jlo, jhi), into "mask", which holds just those
+// rows.  Only the rows of "image" within 3*dpsf of them are looked at.
+// Returns whether any of those pixels was significant.
+int dmask_rows_threads(const float *image, int nx, int ny, float limit,
+                       float dpsf, int jlo, int jhi, uint8_t* mask,
+                       int nthreads);
+// dsigma()'s estimate from the pixel differences it samples (which get
+// reordered).
+int dsigma_diffs(float* diff, int ndiff, float* sigma);
+// The peaks of one object, as dallpeaks() finds them.  "image" and
+// "object" are cutouts of the object's bounding box, and its pixels are
+// those with object == label.  Returns the number of peaks (at most
+// nmax), or 0 if the object is too small or too big.
+int dallpeaks_object(float *image, const int *object, int label,
+                     int xmin, int xmax, int ymin, int ymax,
+                     float dpsf, float sigma, float dlim, float saddle,
+                     int maxper, float minpeak, int maxsize, int nmax,
+                     float *xcen, float *ycen);
+
 #endif
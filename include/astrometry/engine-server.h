@@ -0,0 +1,58 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+*/
+
+#ifndef ENGINE_SERVER_H
+#define ENGINE_SERVER_H
+
+#include <stdio.h>
+
+#include "astrometry/engine.h"
+#include "astrometry/bl.h"
+
+/**
+ A long-running astrometry-engine: the config file is parsed and the
+ indexes are loaded once, then jobs are accepted over a UNIX-domain
+ socket.  Each connection is one request, handled in a forked child
+ (which shares the parent's mapped indexes), and at most "maxjobs"
+ requests run at once.
+
+ A request is a series of text lines, ending with "solve":
+
+   cwd <directory>       resolve relative paths (in the request and in
+                         the axy headers) from here
+   dir <directory>       place output files in this directory, like -d
+   verbose <level>       log level for this request
+   axy <filename>        an augmented xylist to solve; may be repeated
+   axy-data <nbytes>     followed by the bytes of an augmented xylist
+   solve
+
+ The engine's log messages for the request are streamed back over the
+ connection as they are produced, then a final line
+ "ENGINE-DONE <n>", where <n> is the number of jobs that failed to run.
+ */
+
+/*
+ Anyone who can connect to the socket can run jobs as the server's
+ user, and through "cwd", "dir" and the axy files' output names, have
+ them read and write files wherever that user can.  So the socket gets
+ permissions "socketmode" whatever the umask: ENGINE_SOCKET_MODE lets
+ only the server's user connect.
+ */
+#define ENGINE_SOCKET_MODE 0600
+
+// Serves jobs until SIGINT or SIGTERM.  Returns 0 on a clean shutdown.
+int engine_serve(engine_t* engine, const char* socketpath, int maxjobs,
+				 int socketmode);
+
+/**
+ Client side: asks the engine listening at "socketpath" to solve the
+ augmented xylists "axyfns", copying its log messages to "fout".
+ Returns the number of jobs that failed, or -1 if the engine couldn't
+ be reached.
+ */
+int engine_client_solve(const char* socketpath, const sl* axyfns,
+						int loglevel, FILE* fout);
+
+#endif
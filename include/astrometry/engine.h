@@ -18,8 +18,8 @@ struct engine {
 	sl* index_paths;
 
     // contains "index_t" objects.
-	// if "inparallel" is not set, they will be "metadata-only" until
-	// they need to be loaded.
+	// if "inparallel" and "keep_indexes_loaded" are not set, they will
+	// be "metadata-only" until they need to be loaded.
     pl* indexes;
 
 	// indexes that need to be freed
@@ -33,6 +33,38 @@ struct engine {
 	double sizesmallest;
 	double sizebiggest;
 	anbool inparallel;
+	// load the indexes once and keep them (for a long-running engine)
+	anbool keep_indexes_loaded;
+	// number of threads each solver_run() may use (0 or 1: single-threaded)
+	int nthreads;
+	// memory limit for each solver_run()'s AB-pair cache, in MB (0: default)
+	int pquadmem;
+	// reference-star sets each solver_run() keeps for verification (0:
+	// default, off; see solver_t)
+	int verify_cache_size;
+	// quick check before verification, for jobs that don't set it: test
+	// this many reference stars, requiring this many more matches than
+	// chance (see solver_t)
+	int preverify_nref;
+	int preverify_min_match;
+	// INDEX_PREFETCH_* flags: parts of each index to pre-fault when loaded
+	int index_prefetch;
+	// if not "inparallel" or "keep_indexes_loaded": keep up to this many
+	// MB of indexes loaded between uses, unloading the least-recently-used
+	// ones (0: load each index every time it's used, and unload it after)
+	int indexmem;
+	// index catalog file: metadata of the indexes, so that they don't all
+	// have to be read at startup
+	char* indexcatfn;
+	index_catalog_t* indexcat;
+	// (internal) lookup of the indexes by scale band and healpix, for
+	// jobs with an RA,Dec hint; built for the first "index_bands_n" indexes
+	bl* index_bands;
+	int index_bands_n;
+	// (internal) residency of the indexes under "indexmem"
+	bl* residency;
+	size_t resident_bytes;
+	unsigned int residency_clock;
 	double minwidth;
 	double maxwidth;
     float cpulimit;
@@ -62,7 +94,37 @@ int engine_add_index(engine_t* engine, char* path);
 int engine_autoindex_search_paths(engine_t* engine);
 int engine_parse_config_file_stream(engine_t* engine, FILE* fconf);
 int engine_parse_config_file(engine_t* engine, const char* fn);
+
+/*
+ Looks for "astrometry.cfg" where astrometry-engine (living in
+ directory "mydir") expects it.  Returns a newly-allocated filename,
+ or NULL if there is none.
+ */
+char* engine_find_config_file(const char* mydir);
+
+/*
+ Call after reading the config file(s) and adding indexes: checks that
+ there's something to solve with and fills in the default depths.
+ "configfn" is for the error messages.
+ */
+int engine_finish_config(engine_t* engine, const char* configfn);
 int engine_run_job(engine_t* engine, job_t* job);
+
+/*
+ Appends to "indexlist" the positions (in engine->indexes) of the
+ indexes whose quads overlap [fmin, fmax] and that are within "radius"
+ degrees of "ra","dec" (in the same sense as index_overlaps_scale_range
+ and index_is_within_range), in increasing order.  Returns the number of
+ indexes that overlap the scale range, in range or not.
+ */
+int engine_find_indexes_near(engine_t* engine, double fmin, double fmax,
+							 double ra, double dec, double radius,
+							 il* indexlist);
+
+// Reads the job file (an augmented xylist) and runs it, writing its
+// outputs in "outdir" if non-NULL.  Returns 0 if it ran, solved or not.
+int engine_run_job_file(engine_t* engine, const char* jobfn,
+						const char* outdir);
 void engine_free(engine_t* engine);
 
 job_t* engine_read_job_file(engine_t* engine, const char* jobfn);
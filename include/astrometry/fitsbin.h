@@ -202,6 +202,15 @@ fitsbin_chunk_t* fitsbin_add_chunk(fitsbin_t* fb, fitsbin_chunk_t* chunk);
  */
 int fitsbin_read_chunk(fitsbin_t* fb, fitsbin_chunk_t* chunk);
 
+/**
+ Pre-faults the memory-mapped data of a chunk that has been read, so
+ that later accesses don't take page faults: advises the kernel that
+ the whole mapping will be needed (MADV_WILLNEED), then reads one byte
+ of each page, in order from the start of the table.  Returns the
+ number of bytes made resident; 0 if the chunk isn't mmapped.
+ */
+size_t fitsbin_prefetch_chunk(const fitsbin_chunk_t* chunk);
+
 FILE* fitsbin_get_fid(fitsbin_t* fb);
 
 int fitsbin_close(fitsbin_t* fb);
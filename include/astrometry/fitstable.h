@@ -154,6 +154,25 @@ struct fitstable_t {
 };
 typedef struct fitstable_t fitstable_t;
 
+/**
+ A column of a FITS table, mapped from the file without copying: item
+ j of row i is at data + i*stride + j*fits_get_atom_size(type).  The
+ items are as stored in the file (big-endian), so they can be used
+ directly only if "native" is set.  Valid until
+ fitstable_unmap_column().
+ */
+struct fitstable_column_view {
+	const char* data;
+	int stride;
+	int nrows;
+	int arraysize;
+	tfits_type type;
+	anbool native;
+	// private
+	char* mapaddr;
+	size_t mapsize;
+};
+typedef struct fitstable_column_view fitstable_column_view_t;
 
 // Returns the FITS type of "int" on this machine.
 tfits_type fitscolumn_int_type(void);
@@ -362,6 +381,15 @@ void* fitstable_read_column_offset(const fitstable_t* tab,
                                    const char* colname, tfits_type ctype,
                                    int offset, int N);
 
+/**
+ Maps column "colname" of a table being read from a file; see
+ fitstable_column_view_t.  Returns 0 on success.
+ */
+int fitstable_map_column(const fitstable_t* tab, const char* colname,
+						 fitstable_column_view_t* view);
+
+void fitstable_unmap_column(fitstable_column_view_t* view);
+
 // NOTE NOTE NOTE, you must call this with *pointers* to the data to write.
 int fitstable_write_row(fitstable_t* table, ...);
 
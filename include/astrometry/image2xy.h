@@ -9,8 +9,14 @@
 #include <stdint.h>
 
 #include "astrometry/simplexy.h"
+#include "astrometry/anqfits.h"
 
 int image2xy_run(simplexy_t* s,
 				 int downsample, int downsample_as_required);
 
+// Runs simplexy_run_stream() on image extension "ext" (plane "plane"
+// of a data cube) of a FITS file, reading it in bands of rows.
+int image2xy_run_stream(simplexy_t* s, const anqfits_t* anq, int ext,
+						int plane);
+
 #endif
@@ -73,6 +73,10 @@ typedef struct {
     int dimquads;
     int nstars;
     int nquads;
+
+	// INDEX_PREFETCH_* flags from index_load(), applied again by
+	// index_reload().
+	int prefetch;
 } index_t;
 
 /**
@@ -113,6 +117,22 @@ char* index_get_qidx_filename(const char* indexname);
 
 #define INDEX_ONLY_LOAD_METADATA 2
 
+/*
+ index_load() flags: pre-fault these parts of the index's mmapped tables
+ when it is loaded (and whenever it is re-loaded), so that the first
+ searches don't take a page fault per node.  "Nodes" are the kdtree's
+ bounding boxes, split values and the like; "data" are its points,
+ permutation and (for the star tree) sweep numbers.
+ */
+#define INDEX_PREFETCH_CODEKD_NODES   4
+#define INDEX_PREFETCH_CODEKD_DATA    8
+#define INDEX_PREFETCH_STARKD_NODES  16
+#define INDEX_PREFETCH_STARKD_DATA   32
+#define INDEX_PREFETCH_QUADS         64
+#define INDEX_PREFETCH_ALL (INDEX_PREFETCH_CODEKD_NODES | INDEX_PREFETCH_CODEKD_DATA | \
+							INDEX_PREFETCH_STARKD_NODES | INDEX_PREFETCH_STARKD_DATA | \
+							INDEX_PREFETCH_QUADS)
+
 int index_get_quad_dim(const index_t* index);
 
 int index_get_code_dim(const index_t* index);
@@ -156,6 +176,19 @@ void index_unload(index_t* index);
 
 int index_reload(index_t* index);
 
+/**
+ Pre-faults the parts of a loaded index selected by "which"
+ (INDEX_PREFETCH_* flags): the tree nodes first, then the tree data,
+ then the quads.  Returns the number of bytes made resident.
+ */
+size_t index_prefetch(index_t* index, int which);
+
+/**
+ Returns the number of bytes of the index's files that are mmapped (0
+ if only its metadata is loaded).
+ */
+size_t index_get_mapped_size(index_t* index);
+
 /**
  Closes the FILE*s in this index.  Once you have index_reload()ed,
  you can call this function and the index will remain valid.
@@ -173,6 +206,31 @@ void index_close(index_t* index);
  */
 void index_free(index_t* index);
 
+/**
+ An index catalog is a text file holding the metadata of many indexes,
+ so that a program that uses them (eg, astrometry-engine) can start up
+ without reading each index's headers.  An entry is only used while the
+ total size and latest modification time of its index's files match.
+ */
+typedef struct index_catalog index_catalog_t;
+
+// Reads the catalog from "fn"; if it doesn't exist, returns an empty one.
+index_catalog_t* index_catalog_open(const char* fn);
+
+/**
+ Like index_load(indexname, flags, NULL); if "flags" includes
+ INDEX_ONLY_LOAD_METADATA, the metadata is taken from the catalog if it
+ has a current entry for "indexname", and otherwise the index is read
+ and the catalog entry is added or updated.
+ */
+index_t* index_catalog_load(index_catalog_t* cat, const char* indexname,
+							int flags);
+
+// Writes the catalog back to its file, if it has been modified.
+int index_catalog_write(index_catalog_t* cat);
+
+void index_catalog_free(index_catalog_t* cat);
+
 int index_get_missing_cut_params(int indexid, int* hpnside, int* nsweep,
 								 double* dedup, int* margin, char** band);
 
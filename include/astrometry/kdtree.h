@@ -58,6 +58,9 @@ enum kd_build_options {
     KD_BUILD_LINEAR_LR     = 0x10,
     // DEBUG
     KD_BUILD_FORCE_SORT    = 0x20,
+    /* Store the bounding boxes and split planes in van Emde Boas order
+     rather than heap order; see kdtree_set_veb_layout(). */
+    KD_BUILD_VEB_LAYOUT    = 0x40,
     
 };
 
@@ -139,6 +142,7 @@ struct kdtree_funcs {
 
     void  (*nearest_neighbour_internal)(const kdtree_t* kd, const void* query, double* bestd2, int* pbest);
 	kdtree_qres_t* (*rangesearch)(const kdtree_t* kd, kdtree_qres_t* res, const void* pt, double maxd2, int options);
+	int (*rangesearch_batch)(const kdtree_t* kd, kdtree_qres_t** res, const void* pts, int N, double maxd2, int options);
 
     void (*nodes_contained)(const kdtree_t* kd,
                             const void* querylow, const void* queryhi,
@@ -203,6 +207,12 @@ struct kdtree {
 	/* Split dimension for floating-point types (x ninterior) */
 	u8* splitdim;
 
+	/* For trees stored in van Emde Boas order: the slot in "bb" of each
+	   node (x nnodes), and the slot in "split" and "splitdim" of each
+	   interior node (x ninterior).  NULL for the usual heap order. */
+	u32* nodemap;
+	u32* splitmap;
+
 	/* bitmasks for the split dimension and location. */
 	u8 dimbits;
 	u32 dimmask;
@@ -463,6 +473,24 @@ int kdtree_check(const kdtree_t* t);
 
 void kdtree_fix_bounding_boxes(kdtree_t* kd);
 
+/*
+ Rearranges the bounding boxes, split planes and split dimensions of a
+ heap-ordered tree into van Emde Boas order: each subtree of about
+ sqrt(N) nodes is stored contiguously, so a root-to-leaf walk touches
+ O(log_B N) cache lines (and pages) for any block size B.  Node ids are
+ unchanged; the tree's arrays must be writable.  Returns 0 on success.
+ */
+int kdtree_set_veb_layout(kdtree_t* kd);
+
+// Is this tree stored in van Emde Boas order?
+int kdtree_has_veb_layout(const kdtree_t* kd);
+
+/*
+ Computes the node-to-slot maps of a van Emde Boas tree from its shape,
+ without touching its arrays.  Used when reading a tree from disk.
+ */
+int kdtree_compute_veb_maps(kdtree_t* kd);
+
 #if 0
 /* Range seach using callback */
 void kdtree_rangesearch_callback(kdtree_t *kd, real *pt, real maxdistsquared,
@@ -586,6 +614,26 @@ kdtree_qres_t* KDFUNC(kdtree_rangesearch_options)(const kdtree_t *kd, const void
  */
 kdtree_qres_t* KDFUNC(kdtree_rangesearch_options_reuse)(const kdtree_t *kd, kdtree_qres_t* res, const void *pt, double maxd2, int options);
 
+/*
+ Range search for "N" query points at once, all with the same radius.
+ The tree is walked once, sharing the node visits and bounding-box
+ (or splitting-plane) checks among the queries whose paths overlap.
+
+ pts: N query points, stored contiguously (N x D, in the tree's
+ external type).
+
+ res: array of N results.  As in kdtree_rangesearch_options_reuse(),
+ non-NULL entries are reused; NULL entries are allocated and filled
+ in.  Either way, free them with kdtree_free_query().
+
+ The set of points found for each query is the same as
+ kdtree_rangesearch_options() would return, but unless
+ KD_OPTIONS_SORT_DISTS is given, the order may differ.
+
+ Returns 0 on success, -1 on error.
+ */
+int KDFUNC(kdtree_rangesearch_batch)(const kdtree_t *kd, kdtree_qres_t** res, const void *pts, int N, double maxd2, int options);
+
 #if !defined(KD_DIM)
 #undef KD_DIM_GENERIC
 #endif
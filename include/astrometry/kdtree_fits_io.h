@@ -125,6 +125,12 @@ int kdtree_fits_append_tree_flipped(kdtree_fits_t* io, const kdtree_t* kd,
 #define KD_STR_SPLITDIM  "kdtree_splitdim"
 #define KD_STR_DATA      "kdtree_data"
 #define KD_STR_RANGE     "kdtree_range"
+// the node arrays of a tree in van Emde Boas order (KDT_VEB = T): they
+// have their own names so that readers that don't know about that
+// order refuse the tree rather than searching it as a heap-order one.
+#define KD_STR_BB_VEB       "kdtree_bb_veb"
+#define KD_STR_SPLIT_VEB    "kdtree_split_veb"
+#define KD_STR_SPLITDIM_VEB "kdtree_splitdim_veb"
 
 // is the given column name one of the above strings?
 int kdtree_fits_column_is_kdtree(char* columnname);
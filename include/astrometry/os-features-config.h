@@ -0,0 +1,5 @@
+#define NEED_CANONICALIZE_FILE_NAME 0
+#define NEED_DECLARE_QSORT_R 0
+#define NEED_QSORT_R 0
+#define NEED_SWAP_QSORT_R 1
+#define HAVE_NETPBM 0
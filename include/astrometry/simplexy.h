@@ -15,10 +15,13 @@
 #define SIMPLEXY_DEFAULT_MAXSIZE    2000
 #define SIMPLEXY_DEFAULT_HALFBOX     100
 #define SIMPLEXY_DEFAULT_MAXNPEAKS 10000
+#define SIMPLEXY_DEFAULT_BANDROWS    256
 
 #define SIMPLEXY_U8_DEFAULT_PLIM     4.0
 #define SIMPLEXY_U8_DEFAULT_SADDLE   2.0
 
+typedef struct simplexy_workspace simplexy_workspace_t;
+
 struct simplexy_t {
     /******
      Inputs
@@ -57,6 +60,24 @@ struct simplexy_t {
 	// otherwise a value will be estimated.
     float sigma;
 
+	// How the background's grid of medians is found, for float images:
+	// DMEDSMOOTH_EXACT (0) or the faster DMEDSMOOTH_BINNED (see dimage.h).
+	int bgmedian;
+
+	// Number of threads to run the extraction stages on (0 or 1: just
+	// this one).  The results don't depend on it.
+	int nthreads;
+
+	// Rows of the image to hold at a time in simplexy_run_stream()
+	// (0: SIMPLEXY_DEFAULT_BANDROWS).  image2xy streams the image if
+	// this is set.
+	int bandrows;
+
+	// If set, simplexy_run() keeps its intermediate images here instead
+	// of allocating them for this image alone; see
+	// simplexy_workspace_new().  Not freed by simplexy_free_contents().
+	simplexy_workspace_t* workspace;
+
     /******
      Outputs
      ******/
@@ -95,6 +116,39 @@ void simplexy_fill_in_defaults_u8(simplexy_t* s);
 
 int simplexy_run(simplexy_t* s);
 
+/**
+ Buffers for simplexy_run()'s intermediate images (background,
+ background-subtracted, smoothed, mask and connected-components
+ images), to be reused across a series of images: point
+ simplexy_t.workspace at one and the buffers are allocated for the
+ first image and only grown after that.  A workspace must only be used
+ by one simplexy_run() at a time.
+ */
+simplexy_workspace_t* simplexy_workspace_new(void);
+void simplexy_workspace_free(simplexy_workspace_t* ws);
+
+/*
+ Reads "nrows" rows of the image, starting at row "y0", into "rows"
+ (nx * nrows floats).  Returns 0 on success.
+ */
+typedef int (*simplexy_read_rows_func)(void* token, int y0, int nrows,
+									   float* rows);
+
+/**
+ Like simplexy_run() on a float image, but the image (s->nx by s->ny;
+ s->image must be NULL) is read through "readrows" a band of
+ s->bandrows rows at a time, so that the whole image never has to be
+ in memory.  It is read twice: once to estimate the background and
+ noise, and again to find the sources.  Rows are kept beyond the band
+ as long as an object that crosses it still needs them, so memory use
+ grows with the height of the tallest object (up to s->maxsize) as well
+ as with the band.  The intermediate images aren't written.
+
+ Returns 0 on success, -1 if reading the image fails.
+ */
+int simplexy_run_stream(simplexy_t* s, simplexy_read_rows_func readrows,
+						void* token);
+
 void simplexy_free_contents(simplexy_t* s);
 
 void simplexy_clean_cache();
@@ -34,8 +34,20 @@ enum {
 #define DEFAULT_DISTRACTOR_RATIO 0.25
 #define DEFAULT_VERIFY_PIX 1.0
 #define DEFAULT_BAIL_THRESHOLD 1e-100
+#define DEFAULT_PQUAD_MEM_MAX ((size_t)1024 * 1024 * 1024)
+// Off: on a field of noise, the kd-tree searches it saves take less
+// time than filling the cache (see verify_refcache_new).
+#define DEFAULT_VERIFY_CACHE_SIZE 0
+// On a field of noise, these reject 85% of the false matches before
+// full verification (1 extra match: 54%); on test fields missing up to
+// their 80 brightest stars, no true match is rejected (3, or 5 stars,
+// delay some solves).
+#define DEFAULT_PREVERIFY_NREF 10
+#define DEFAULT_PREVERIFY_MIN_MATCH 2
 
 struct verify_field_t;
+struct verify_refcache;
+struct pquad_arena;
 struct solver_t {
 
 	// FIELDS REQUIRED FROM THE CALLER BEFORE CALLING SOLVER_RUN
@@ -100,6 +112,33 @@ struct solver_t {
 	int startobj;
 	int endobj;
 
+	// Memory limit, in bytes, for the cache of AB pairs that solver_run()
+	// builds quads from.  Each pair takes about 16 bytes per field object
+	// searched so far (rounded up to a power of two, at least 64).
+	// When it's full, pairs whose star B is far back in the field are
+	// dropped, so deep fields only build quads from nearby stars.
+	// Default DEFAULT_PQUAD_MEM_MAX.
+	size_t pquad_mem_max;
+
+	// Number of reference-star sets (one per index and patch of sky)
+	// that verification keeps for reuse by later hypotheses; 0 to
+	// search the index every time.  The sets are dropped by
+	// solver_clear_indexes(), so they are only reused while the same
+	// indexes are loaded: within one job, never across jobs.
+	// Default DEFAULT_VERIFY_CACHE_SIZE.
+	int verify_cache_size;
+
+	// Before running the full verification on a match, check the
+	// "preverify_nref" brightest reference stars in the image that are
+	// no brighter than the quad's (by sweep number): unless at
+	// least "preverify_min_match" more of them than expected by chance
+	// (or all of them) have a field star nearby, reject the match right
+	// away.  If there are no such stars, the match goes on to the full
+	// verification.  "preverify_nref" 0 turns the check off.  Defaults
+	// DEFAULT_PREVERIFY_NREF and DEFAULT_PREVERIFY_MIN_MATCH.
+	int preverify_nref;
+	int preverify_min_match;
+
 	// One of PARITY_NORMAL, PARITY_FLIP, or PARITY_BOTH.  Are the X and Y axes of
 	// the image flipped?  Default PARITY_BOTH.
 	int parity;
@@ -123,6 +162,15 @@ struct solver_t {
 	// Number of quad matches to try or zero for no limit.
 	int maxmatches;
 
+	// Number of worker threads to use in solver_run(); the AB pairs for
+	// each new field object are shared out among them.  Zero or one
+	// means run single-threaded (the original, deterministic order).
+	int nthreads;
+	// If there are several indexes, instead give each index its own
+	// solver instance (up to "nthreads" at once); the first one to find
+	// a solution cancels the others.
+	anbool thread_per_index;
+
 	// Force CRPIX to be the given point "crpix", or the center of the image?
 	anbool set_crpix;
 	anbool set_crpix_center;
@@ -139,7 +187,8 @@ struct solver_t {
 	// FIELDS THAT AFFECT THE RUNNING SOLVER ON CALLBACK
 	// =================================================
 
-	// Bail out ASAP.
+	// Bail out ASAP.  With threads (nthreads > 1) this is read while
+	// the solver runs, so set it with solver_set_quit().
 	anbool quit_now;
 
 	// SOLVER OUTPUTS
@@ -161,6 +210,10 @@ struct solver_t {
 	int num_abscale_skipped;
 	// The number of times we ran verification on a quad.
 	int num_verified;
+	// number of matches rejected by the quick check before verification,
+	int num_preverify_rejected;
+	// and by the full verification.
+	int num_verify_rejected;
 
 	// INTERNAL PARAMETERS; DO NOT MODIFY
 	// ==================================
@@ -204,6 +257,32 @@ struct solver_t {
 
 	// Cached data about this field, for verify_hit().
 	verify_field_t* vf;
+
+	// Reference stars recently used by verify_hit(), kept across fields
+	// until the indexes are cleared.  Shared with the worker threads.
+	struct verify_refcache* refcache;
+
+	// Code-tree search results, reused from quad to quad while
+	// solver_run() is searching (each worker thread has its own).
+	kdtree_qres_t** coderesults;
+
+	// Storage for the "pquad" table and its per-AB-pair arrays, kept
+	// from one solver_run() to the next.  Freed by solver_cleanup().
+	struct pquad_arena* pqarena;
+
+	// When running multi-threaded, each worker thread gets a shallow copy
+	// of the solver; this points back at the solver_t the caller passed
+	// to solver_run().
+	struct solver_t* parent;
+
+	// With one solver instance per index (thread_per_index), maxquads
+	// and maxmatches apply to all the instances together: each adds its
+	// quads tried and matched to its parent's shared_* totals as it
+	// goes; synced_* are how much of its own counts it has added.
+	int shared_numtries;
+	int shared_nummatches;
+	int synced_numtries;
+	int synced_nummatches;
 };
 typedef struct solver_t solver_t;
 
@@ -376,6 +455,9 @@ void solver_verify_sip_wcs(solver_t* solver, sip_t* sip); //, MatchObj* mo);
 
 void solver_run(solver_t* solver);
 
+// Asks solver_run() to bail out; may be called from any thread.
+void solver_set_quit(solver_t* solver);
+
 #define SOLVER_TWEAK2_AVAILABLE 1
 void solver_tweak2(solver_t* solver, MatchObj* mo, int order, sip_t* verifysip);
 
@@ -14,6 +14,16 @@
 #include "astrometry/bl.h"
 #include "astrometry/starxy.h"
 
+/*
+ A bounded (LRU) cache of the reference stars of each index around
+ recently-verified field centres, kept sorted by sweep number, so that
+ verifying another hypothesis for a nearby field centre only has to
+ reproject them.  It may be shared between threads.
+ */
+typedef struct verify_refcache verify_refcache_t;
+
+struct verify_field_grid;
+
 struct verify_field_t {
     const starxy_t* field;
 	// this copy is normal.
@@ -28,6 +38,12 @@ struct verify_field_t {
 	anbool do_dedup;
 	// apply radius-of-relevance filtering
 	anbool do_ror;
+
+	// if non-NULL, look up the reference stars through this cache.
+	verify_refcache_t* refcache;
+
+	// grid over the field stars, for verify_quick_check().
+	struct verify_field_grid* grid;
 };
 typedef struct verify_field_t verify_field_t;
 
@@ -46,8 +62,35 @@ verify_field_t* verify_field_preprocess(const starxy_t* fieldxy);
  */
 void verify_field_free(verify_field_t* vf);
 
+// Keeps at most "maxentries" reference-star sets.
+verify_refcache_t* verify_refcache_new(int maxentries);
+
+// Forgets all the cached stars; call this when their indexes are closed.
+void verify_refcache_clear(verify_refcache_t* cache);
 
+void verify_refcache_free(verify_refcache_t* cache);
 
+void verify_refcache_get_counts(verify_refcache_t* cache,
+								int* p_nhit, int* p_nmiss);
+
+
+
+
+/*
+ A cheap test to run before verify_hit(): takes the "nref" brightest
+ (lowest sweep number) reference stars that mo's WCS puts inside the
+ image, other than the stars of the quad, and counts how many of them
+ have a field star within "nsigma" sigmas (with verify_hit()'s
+ positional variance) of where they land.  "p_ntested" gets the number
+ of reference stars tested, which can be less than "nref", and
+ "p_nchance" the number of them expected to have a field star nearby
+ by chance, given the density of field stars.
+ */
+int verify_quick_check(const startree_t* skdt, const MatchObj* mo,
+					   const verify_field_t* vf, double verify_pix2,
+					   anbool distance_from_quad_bonus,
+					   int nref, double nsigma,
+					   int* p_ntested, double* p_nchance);
 
 void verify_count_hits(int* theta, int besti, int* p_nmatch, int* p_nconflict, int* p_ndistractor);
 
@@ -0,0 +1,150 @@
+/*
+# This file is part of libkd.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+
+/*
+ Benchmark for the van Emde Boas node layout: builds a large 3-D tree
+ of points on the unit sphere (like a star tree), runs the same range
+ searches and nearest-neighbour queries on it in heap order and again
+ after kdtree_set_veb_layout(), and reports the times.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "kdtree.h"
+#include "tic.h"
+
+static const char* OPTIONS = "hn:q:r:l:t:b";
+
+static void printHelp(char* progname) {
+	printf("Usage: %s\n"
+		   "   [-n <number of points>] (default 8000000)\n"
+		   "   [-q <number of queries>] (default 500000)\n"
+		   "   [-r <search radius>] (default 0.002)\n"
+		   "   [-l <points per leaf>] (default 8)\n"
+		   "   [-t <tree type>]: ddd, duu or dss (default duu)\n"
+		   "   [-b]: bounding boxes only (default: split planes too)\n"
+		   "\n", progname);
+}
+
+static void random_unit_vectors(double* xyz, int N) {
+	int i;
+	for (i=0; i<N; i++) {
+		double z = 2.0 * rand() / (double)RAND_MAX - 1.0;
+		double phi = 2.0 * M_PI * rand() / (double)RAND_MAX;
+		double r = sqrt(1.0 - z*z);
+		xyz[3*i + 0] = r * cos(phi);
+		xyz[3*i + 1] = r * sin(phi);
+		xyz[3*i + 2] = z;
+	}
+}
+
+static void run(const kdtree_t* kd, const double* queries, int Q, double radius,
+				const char* name) {
+	kdtree_qres_t* res = NULL;
+	double t0, dt;
+	long nres = 0;
+	double sumd2 = 0.0;
+	int q;
+	int options = KD_OPTIONS_SMALL_RADIUS | KD_OPTIONS_COMPUTE_DISTS |
+		KD_OPTIONS_NO_RESIZE_RESULTS | KD_OPTIONS_USE_SPLIT;
+
+	t0 = timenow();
+	for (q=0; q<Q; q++) {
+		res = kdtree_rangesearch_options_reuse(kd, res, queries + 3*q,
+											   radius*radius, options);
+		nres += res->nres;
+	}
+	dt = timenow() - t0;
+	printf("  %-5s rangesearch: %8.3f s, %li results\n", name, dt, nres);
+	kdtree_free_query(res);
+
+	t0 = timenow();
+	for (q=0; q<Q; q++) {
+		double d2;
+		kdtree_nearest_neighbour(kd, queries + 3*q, &d2);
+		sumd2 += d2;
+	}
+	dt = timenow() - t0;
+	printf("  %-5s nearest:     %8.3f s, sum of dist2 %g\n", name, dt, sumd2);
+}
+
+int main(int argc, char** argv) {
+	int argchar;
+	int N = 8000000;
+	int Q = 500000;
+	int Nleaf = 8;
+	double radius = 0.002;
+	int treetype = KDTT_DUU;
+	int buildopts = KD_BUILD_SPLIT | KD_BUILD_BBOX;
+	double* data;
+	double* queries;
+	kdtree_t* kd;
+	double t0;
+
+	while ((argchar = getopt(argc, argv, OPTIONS)) != -1)
+		switch (argchar) {
+		case 'n':
+			N = atoi(optarg);
+			break;
+		case 'q':
+			Q = atoi(optarg);
+			break;
+		case 'r':
+			radius = atof(optarg);
+			break;
+		case 'l':
+			Nleaf = atoi(optarg);
+			break;
+		case 't':
+			if (!strcmp(optarg, "ddd"))
+				treetype = KDTT_DOUBLE;
+			else if (!strcmp(optarg, "duu"))
+				treetype = KDTT_DUU;
+			else if (!strcmp(optarg, "dss"))
+				treetype = KDTT_DSS;
+			else {
+				printHelp(argv[0]);
+				exit(-1);
+			}
+			break;
+		case 'b':
+			buildopts = KD_BUILD_BBOX;
+			break;
+		case 'h':
+		default:
+			printHelp(argv[0]);
+			exit(-1);
+		}
+
+	srand(0);
+	data = malloc((size_t)N * 3 * sizeof(double));
+	random_unit_vectors(data, N);
+	queries = malloc((size_t)Q * 3 * sizeof(double));
+	random_unit_vectors(queries, Q);
+
+	printf("%i points, %i queries, radius %g, %i points per leaf.\n",
+		   N, Q, radius, Nleaf);
+	kd = kdtree_build(NULL, data, N, 3, Nleaf, treetype, buildopts);
+	printf("%i nodes, %i levels.\n", kd->nnodes, kd->nlevels);
+
+	run(kd, queries, Q, radius, "heap");
+
+	t0 = timenow();
+	if (kdtree_set_veb_layout(kd)) {
+		fprintf(stderr, "Failed to rearrange the tree\n");
+		exit(-1);
+	}
+	printf("Rearranged into vEB order in %.3f s.\n", timenow() - t0);
+
+	run(kd, queries, Q, radius, "vEB");
+
+	kdtree_free(kd);
+	free(data);
+	free(queries);
+	return 0;
+}
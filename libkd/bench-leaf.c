@@ -0,0 +1,126 @@
+/*
+# This file is part of libkd.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+
+/*
+ Micro-benchmark for the vectorized leaf-scan kernels: runs the same
+ range searches on 4-D trees (like the index code trees) with each
+ kernel the CPU supports, and reports the time and the speedup over
+ the plain scalar loop.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kdtree.h"
+#include "kdtree_leaf.h"
+#include "tic.h"
+
+static const char* OPTIONS = "hn:q:r:l:";
+
+static void printHelp(char* progname) {
+	printf("Usage: %s\n"
+		   "   [-n <number of points>] (default 1000000)\n"
+		   "   [-q <number of queries>] (default 200000)\n"
+		   "   [-r <search radius>] (default 0.01)\n"
+		   "   [-l <points per leaf>] (default 16)\n"
+		   "\n", progname);
+}
+
+static const char* kernel_name(int k) {
+	switch (k) {
+	case KD_LEAF_SCALAR: return "scalar";
+	case KD_LEAF_SSE2:   return "sse2";
+	case KD_LEAF_AVX2:   return "avx2";
+	}
+	return "?";
+}
+
+int main(int argc, char** argv) {
+	int argchar;
+	int N = 1000000;
+	int Q = 200000;
+	int Nleaf = 16;
+	double radius = 0.01;
+	int D = 4;
+	int treetypes[] = { KDTT_DSS, KDTT_DUU, KDTT_DOUBLE };
+	const char* treenames[] = { "dss", "duu", "ddd" };
+	double* data;
+	double* queries;
+	int t, i;
+	int options = KD_OPTIONS_SMALL_RADIUS | KD_OPTIONS_COMPUTE_DISTS |
+		KD_OPTIONS_NO_RESIZE_RESULTS | KD_OPTIONS_USE_SPLIT;
+
+	while ((argchar = getopt(argc, argv, OPTIONS)) != -1)
+		switch (argchar) {
+		case 'n':
+			N = atoi(optarg);
+			break;
+		case 'q':
+			Q = atoi(optarg);
+			break;
+		case 'r':
+			radius = atof(optarg);
+			break;
+		case 'l':
+			Nleaf = atoi(optarg);
+			break;
+		case 'h':
+		default:
+			printHelp(argv[0]);
+			exit(-1);
+		}
+
+	srand(0);
+	data = malloc((size_t)N * D * sizeof(double));
+	for (i=0; i<N*D; i++)
+		data[i] = rand() / (double)RAND_MAX;
+	queries = malloc((size_t)Q * D * sizeof(double));
+	for (i=0; i<Q*D; i++)
+		queries[i] = rand() / (double)RAND_MAX;
+
+	printf("%i points, %i queries, radius %g, %i points per leaf.\n",
+		   N, Q, radius, Nleaf);
+	printf("Best kernel on this CPU: %s\n",
+		   kernel_name(kdtree_leaf_best_kernel()));
+
+	for (t=0; t<sizeof(treetypes)/sizeof(int); t++) {
+		kdtree_t* kd;
+		double* treedata;
+		double scalartime = 0.0;
+		int k;
+
+		treedata = malloc((size_t)N * D * sizeof(double));
+		memcpy(treedata, data, (size_t)N * D * sizeof(double));
+		kd = kdtree_build(NULL, treedata, N, D, Nleaf, treetypes[t],
+						  KD_BUILD_SPLIT | KD_BUILD_BBOX);
+
+		for (k=KD_LEAF_SCALAR; k<=kdtree_leaf_best_kernel(); k++) {
+			kdtree_qres_t* res = NULL;
+			double t0, dt;
+			long nres = 0;
+			int q;
+			kdtree_leaf_set_kernel(k);
+			t0 = timenow();
+			for (q=0; q<Q; q++) {
+				res = kdtree_rangesearch_options_reuse(kd, res, queries + q*D,
+													   radius*radius, options);
+				nres += res->nres;
+			}
+			dt = timenow() - t0;
+			if (k == KD_LEAF_SCALAR)
+				scalartime = dt;
+			printf("  %s tree, %-6s: %8.3f s, %li results, speedup %.2f\n",
+				   treenames[t], kernel_name(k), dt, nres, scalartime / dt);
+			kdtree_free_query(res);
+		}
+		kdtree_leaf_set_kernel(-1);
+		kdtree_free(kd);
+		free(treedata);
+	}
+	free(data);
+	free(queries);
+	return 0;
+}
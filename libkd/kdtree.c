@@ -208,15 +208,16 @@ int kdtree_get_level(const kdtree_t* kd, int nodeid) {
 
 int kdtree_get_splitdim(const kdtree_t* kd, int nodeid) {
     u32 tmpsplit;
+    u32 slot = (kd->splitmap ? kd->splitmap[nodeid] : (u32)nodeid);
     if (kd->splitdim)
-        return kd->splitdim[nodeid];
+        return kd->splitdim[slot];
 
     switch (kdtree_treetype(kd)) {
     case KDT_TREE_U32:
-        tmpsplit = kd->split.u[nodeid];
+        tmpsplit = kd->split.u[slot];
         break;
     case KDT_TREE_U16:
-        tmpsplit = kd->split.s[nodeid];
+        tmpsplit = kd->split.s[slot];
         break;
     default:
         return -1;
@@ -296,12 +297,13 @@ void kdtree_inverse_permutation(const kdtree_t* tree, int* invperm) {
 
 const char* kdtree_build_options_to_string(int opts) {
     static char buf[256];
-    sprintf(buf, "%s%s%s%s%s",
+    sprintf(buf, "%s%s%s%s%s%s",
             (opts & KD_BUILD_BBOX) ? "BBOX ":"",
             (opts & KD_BUILD_SPLIT) ? "SPLIT ":"",
             (opts & KD_BUILD_SPLITDIM) ? "SPLITDIM ":"",
             (opts & KD_BUILD_NO_LR) ? "NOLR ":"",
-            (opts & KD_BUILD_LINEAR_LR) ? "LINEARLR ":"");
+            (opts & KD_BUILD_LINEAR_LR) ? "LINEARLR ":"",
+            (opts & KD_BUILD_VEB_LAYOUT) ? "VEB ":"");
     return buf;
 }
 
@@ -538,6 +540,8 @@ void kdtree_free(kdtree_t *kd) {
 	FREE(kd->bb.any);
 	FREE(kd->split.any);
 	FREE(kd->splitdim);
+	FREE(kd->nodemap);
+	FREE(kd->splitmap);
 	if (kd->free_data)
 		FREE(kd->data.any);
 	FREE(kd->minval);
@@ -546,6 +550,110 @@ void kdtree_free(kdtree_t *kd) {
 	FREE(kd);
 }
 
+/*
+ Lays out the complete subtree of the given height below "root": first
+ its top half, then each of the subtrees hanging off the bottom of the
+ top half, left to right, each one laid out the same way.
+ */
+static void veb_assign(u32* nodemap, int root, int height, u32* next) {
+    int top, bottom, first, n, i;
+    if (height == 1) {
+        nodemap[root] = (*next)++;
+        return;
+    }
+    top = height / 2;
+    bottom = height - top;
+    veb_assign(nodemap, root, top, next);
+    first = ((root + 1) << top) - 1;
+    n = 1 << top;
+    for (i=0; i<n; i++)
+        veb_assign(nodemap, first + i, bottom, next);
+}
+
+int kdtree_compute_veb_maps(kdtree_t* kd) {
+    u32* order;
+    u32 next = 0;
+    int i, k;
+
+    FREE(kd->nodemap);
+    FREE(kd->splitmap);
+    kd->nodemap = kd->splitmap = NULL;
+    if (kd->nnodes != (1 << kd->nlevels) - 1) {
+        ERROR("kdtree has %i nodes, which isn't a complete tree of %i levels",
+              kd->nnodes, kd->nlevels);
+        return -1;
+    }
+    kd->nodemap = MALLOC(kd->nnodes * sizeof(u32));
+    kd->splitmap = MALLOC((kd->ninterior ? kd->ninterior : 1) * sizeof(u32));
+    order = MALLOC(kd->nnodes * sizeof(u32));
+    if (!kd->nodemap || !kd->splitmap || !order) {
+        SYSERROR("Failed to allocate van Emde Boas maps for %i nodes", kd->nnodes);
+        FREE(order);
+        FREE(kd->nodemap);
+        FREE(kd->splitmap);
+        kd->nodemap = kd->splitmap = NULL;
+        return -1;
+    }
+    veb_assign(kd->nodemap, 0, kd->nlevels, &next);
+    assert(next == kd->nnodes);
+
+    // The split arrays hold the interior nodes in the same order, with
+    // the leaves squeezed out.
+    for (i=0; i<kd->nnodes; i++)
+        order[kd->nodemap[i]] = i;
+    k = 0;
+    for (i=0; i<kd->nnodes; i++)
+        if (order[i] < kd->ninterior)
+            kd->splitmap[order[i]] = k++;
+    assert(k == kd->ninterior);
+    FREE(order);
+    return 0;
+}
+
+int kdtree_has_veb_layout(const kdtree_t* kd) {
+    return kd->nodemap != NULL;
+}
+
+// Moves item i of "arr" to slot map[i].
+static int permute_items(void* arr, const u32* map, int N, size_t itemsize) {
+    char* tmp;
+    int i;
+    tmp = MALLOC((size_t)N * itemsize);
+    if (!tmp) {
+        SYSERROR("Failed to allocate temp array for %i items", N);
+        return -1;
+    }
+    for (i=0; i<N; i++)
+        memcpy(tmp + (size_t)map[i] * itemsize,
+               (char*)arr + (size_t)i * itemsize, itemsize);
+    memcpy(arr, tmp, (size_t)N * itemsize);
+    FREE(tmp);
+    return 0;
+}
+
+int kdtree_set_veb_layout(kdtree_t* kd) {
+    int tsz = get_tree_size(kd->treetype);
+    if (kdtree_has_veb_layout(kd))
+        return 0;
+    if (kd->bb.any && kdtree_has_old_bb(kd)) {
+        ERROR("kdtree has an old-style bounding-box array; run fix-bb first");
+        return -1;
+    }
+    if (kdtree_compute_veb_maps(kd))
+        return -1;
+    if ((kd->bb.any &&
+         permute_items(kd->bb.any, kd->nodemap, kd->nnodes, 2 * kd->ndim * tsz)) ||
+        (kd->split.any &&
+         permute_items(kd->split.any, kd->splitmap, kd->ninterior, tsz)) ||
+        (kd->splitdim &&
+         permute_items(kd->splitdim, kd->splitmap, kd->ninterior, sizeof(u8)))) {
+        ERROR("Failed to rearrange kdtree into van Emde Boas order; "
+              "the tree is no longer usable");
+        return -1;
+    }
+    return 0;
+}
+
 int kdtree_nearest_neighbour(const kdtree_t* kd, const void* pt, double* p_mindist2) {
 	return kdtree_nearest_neighbour_within(kd, pt, HUGE_VAL, p_mindist2);
 }
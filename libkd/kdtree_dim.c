@@ -50,4 +50,9 @@ kdtree_qres_t* KDFUNC(kdtree_rangesearch_options_reuse)
     return kd->fun.rangesearch(kd, res, pt, maxd2, options);
 }
 
+int KDFUNC(kdtree_rangesearch_batch)
+	 (const kdtree_t *kd, kdtree_qres_t** res, const void *pts, int N, double maxd2, int options) {
+    assert(kd->fun.rangesearch_batch);
+    return kd->fun.rangesearch_batch(kd, res, pts, N, maxd2, options);
+}
 
@@ -252,6 +252,7 @@ kdtree_t* kdtree_fits_read_tree(kdtree_fits_t* io, const char* treename,
                                 qfits_header** p_hdr) {
     int ndim, ndata, nnodes;
 	unsigned int tt;
+	int veb;
 	kdtree_t* kd = NULL;
     fitsbin_t* fb = kdtree_fits_get_fitsbin(io);
 	qfits_header* header;
@@ -278,6 +279,7 @@ kdtree_t* kdtree_fits_read_tree(kdtree_fits_t* io, const char* treename,
     }
 
     kd->has_linear_lr = qfits_header_getboolean(header, "KDT_LINL", 0);
+    veb = qfits_header_getboolean(header, "KDT_VEB", 0);
 
     if (p_hdr)
         *p_hdr = header;
@@ -292,11 +294,22 @@ kdtree_t* kdtree_fits_read_tree(kdtree_fits_t* io, const char* treename,
     kd->nlevels = kdtree_nnodes_to_nlevels(nnodes);
 	kd->treetype = tt;
 
+    // The node order is a function of the tree's shape, so it isn't stored;
+    // it also tells kdtree_read_fits which tables to read.
+    if (veb && kdtree_compute_veb_maps(kd)) {
+        ERROR("Failed to compute van Emde Boas node order for kdtree in file %s", fn);
+        FREE(kd->name);
+        FREE(kd);
+        return NULL;
+    }
+
 	//t0 = timenow();
 	KD_DISPATCH(kdtree_read_fits, tt, rtn = , (io, kd));
 	//debug("kdtree_read_fits(%s) took %g ms\n", fn, 1000. * (timenow() - t0));
 
     if (rtn) {
+        FREE(kd->nodemap);
+        FREE(kd->splitmap);
         FREE(kd->name);
         FREE(kd);
         return NULL;
@@ -398,6 +411,8 @@ int kdtree_fits_close(kdtree_t* kd) {
 	if (kd->io)
         kdtree_fits_io_close(kd->io);
     FREE(kd->name);
+    FREE(kd->nodemap);
+    FREE(kd->splitmap);
 	FREE(kd);
     return 0;
 }
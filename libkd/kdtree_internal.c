@@ -12,10 +12,13 @@
 #include "kdtree.h"
 #include "kdtree_internal.h"
 #include "kdtree_mem.h"
+#include "kdtree_leaf.h"
 #include "keywords.h"
 #include "errors.h"
 
 #define KDTREE_MAX_RESULTS 1000
+// how many leaf points the vectorized kernels handle per call.
+#define KDTREE_LEAF_BLOCK 256
 #define KDTREE_MAX_DIM 100
 
 #define WARNING(x, ...) fprintf(stderr, x, ## __VA_ARGS__)
@@ -129,14 +132,24 @@
 // Which function do we use for rounding?
 #define KD_ROUND rint
 
+// Where node 'i' lives in the bb array (heap order unless the tree has a
+// van Emde Boas layout; see kdtree_set_veb_layout()).
+#define KD_NODE_SLOT(kd, i)  ((kd)->nodemap  ? (kd)->nodemap[i]  : (u32)(i))
+
+// Where interior node 'i' lives in the split and splitdim arrays.
+#define KD_SPLIT_SLOT(kd, i) ((kd)->splitmap ? (kd)->splitmap[i] : (u32)(i))
+
 // Get the low corner of the bounding box
-#define LOW_HR( kd, D, i) ((kd)->bb.TTYPE + (2*(i)*(D)))
+#define LOW_HR( kd, D, i) ((kd)->bb.TTYPE + (2*(size_t)KD_NODE_SLOT(kd, i)*(D)))
 
 // Get the high corner of the bounding box
-#define HIGH_HR(kd, D, i) ((kd)->bb.TTYPE + ((2*(i)+1)*(D)))
+#define HIGH_HR(kd, D, i) ((kd)->bb.TTYPE + ((2*(size_t)KD_NODE_SLOT(kd, i)+1)*(D)))
 
 // Get the splitting-plane position
-#define KD_SPLIT(kd, i) ((kd)->split.TTYPE + (i))
+#define KD_SPLIT(kd, i) ((kd)->split.TTYPE + KD_SPLIT_SLOT(kd, i))
+
+// Get the splitting dimension (for trees with a splitdim array)
+#define KD_SPLITDIM(kd, i) ((kd)->splitdim[KD_SPLIT_SLOT(kd, i)])
 
 // Get a pointer to the 'i'-th data point.
 #define KD_DATA(kd, D, i) ((kd)->data.DTYPE + ((D)*(i)))
@@ -186,7 +199,7 @@ typedef u32 bigint;
  static void split_dim_and_value(kdtree_t* kd, int node,
  uint8_t* splitdim, ttype* splitval) {
  if (kd->splitdim) {
- *splitdim = kd->splitdim[node];
+ *splitdim = KD_SPLITDIM(kd, node);
  *splitval = *KD_SPLIT(kd, node);
  } else {
  bigint tmpsplit = *KD_SPLIT(kd, node);
@@ -532,6 +545,59 @@ anbool add_result(const kdtree_t* kd, kdtree_qres_t* res, double sdist,
 	return TRUE;
 }
 
+/*
+ Squared distances from "query" to the N leaf points starting at index
+ L, using the vectorized kernels in kdtree_leaf.c.  Returns FALSE if
+ there is no kernel for this tree type and dimensionality.
+ */
+static anbool leaf_dist2s(const kdtree_t* kd, const etype* query, int D,
+						  int L, int N, double* d2) {
+	if (ETYPE_INTEGER || sizeof(etype) != sizeof(double) || D != 4)
+		return FALSE;
+	switch (DTYPE_KDT_DATA) {
+	case KDT_DATA_DOUBLE:
+		return (kdtree_leaf_dist2_d((const double*)KD_DATA(kd, D, L), N, D,
+									(const double*)query, d2) == 0);
+	case KDT_DATA_U32:
+		return (kdtree_leaf_dist2_u32((const uint32_t*)KD_DATA(kd, D, L), N, D,
+									  (const double*)query, kd->minval,
+									  kd->invscale, d2) == 0);
+	case KDT_DATA_U16:
+		return (kdtree_leaf_dist2_u16((const uint16_t*)KD_DATA(kd, D, L), N, D,
+									  (const double*)query, kd->minval,
+									  kd->invscale, d2) == 0);
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ Adds the points of leaf [L, R] that are within range of "query" to
+ "res", a block at a time with the vectorized kernels.  Returns 1 if
+ there is no kernel for this tree (and nothing was done), 0 on
+ success, -1 on error.
+ */
+static int leaf_rangesearch(const kdtree_t* kd, kdtree_qres_t* res,
+							const etype* query, int D, int L, int R,
+							double maxd2, anbool do_dists, anbool do_points) {
+	double d2[KDTREE_LEAF_BLOCK];
+	while (L <= R) {
+		int i, N = MIN(R - L + 1, KDTREE_LEAF_BLOCK);
+		if (!leaf_dist2s(kd, query, D, L, N, d2))
+			return 1;
+		for (i=0; i<N; i++) {
+			if (d2[i] > maxd2)
+				continue;
+			if (!add_result(kd, res, do_dists ? d2[i] : HUGE_VAL,
+							KD_PERM(kd, L + i), KD_DATA(kd, D, L + i),
+							D, do_dists, do_points))
+				return -1;
+		}
+		L += N;
+	}
+	return 0;
+}
+
 /*
   Can the query be represented as a ttype?
 
@@ -560,7 +626,7 @@ double MANGLE(kdtree_get_splitval)(const kdtree_t* kd, int nodeid) {
         dim = tmpsplit & kd->dimmask;
         return POINT_TE(kd, dim, tmpsplit & kd->splitmask);
     } else {
-        dim = kd->splitdim[nodeid];
+        dim = KD_SPLITDIM(kd, nodeid);
     }
     return POINT_TE(kd, dim, split);
 }
@@ -825,7 +891,7 @@ static void kdtree_nn_int_split(const kdtree_t* kd, const etype* query,
         split = *KD_SPLIT(kd, nodeid);
 
 		if (kd->splitdim)
-			dim = kd->splitdim[nodeid];
+			dim = KD_SPLITDIM(kd, nodeid);
         else {
             bigint tmpsplit;
             tmpsplit = split;
@@ -978,7 +1044,7 @@ void MANGLE(kdtree_nn)(const kdtree_t* kd, const void* vquery,
         // split/dim trees
         split = *KD_SPLIT(kd, nodeid);
         if (kd->splitdim) {
-            dim = kd->splitdim[nodeid];
+            dim = KD_SPLITDIM(kd, nodeid);
         } else {
             // packed int
             bigint tmpsplit = split;
@@ -1186,9 +1252,17 @@ kdtree_qres_t* MANGLE(kdtree_rangesearch_options)
 
 		if (KD_IS_LEAF(kd, nodeid)) {
 			dtype* data;
+			int rtn;
 			L = kdtree_left(kd, nodeid);
 			R = kdtree_right(kd, nodeid);
 
+			rtn = leaf_rangesearch(kd, res, query, D, L, R, maxd2,
+								   do_dists, do_points);
+			if (rtn == -1)
+				return NULL;
+			if (rtn == 0)
+				continue;
+
 			if (do_dists) {
 				for (i=L; i<=R; i++) {
 					anbool bailedout = FALSE;
@@ -1219,7 +1293,7 @@ kdtree_qres_t* MANGLE(kdtree_rangesearch_options)
 		}
 
 		if (kd->splitdim)
-			dim = kd->splitdim[nodeid];
+			dim = KD_SPLITDIM(kd, nodeid);
 
 		if (use_bboxes) {
 			anbool wholenode = FALSE;
@@ -1233,9 +1307,9 @@ kdtree_qres_t* MANGLE(kdtree_rangesearch_options)
 				int pdim;
 				anbool cut;
 				if (kd->splitdim)
-					pdim = kd->splitdim[KD_PARENT(nodeid)];
+					pdim = KD_SPLITDIM(kd, KD_PARENT(nodeid));
 				else {
-					pdim = kd->split.TTYPE[KD_PARENT(nodeid)];
+					pdim = *KD_SPLIT(kd, KD_PARENT(nodeid));
 					pdim &= kd->dimmask;
 				}
 				if (TTYPE_INTEGER && use_tquery) {
@@ -1361,7 +1435,7 @@ kdtree_qres_t* MANGLE(kdtree_rangesearch_options)
 					}
 				}
 			} else {
-				dtype rsplit = POINT_TE(kd, dim, split);
+				etype rsplit = POINT_TE(kd, dim, split);
 				if (query[dim] < rsplit) {
 					// query is on the "left" side of the split.
 					stackpos++;
@@ -1404,6 +1478,252 @@ kdtree_qres_t* MANGLE(kdtree_rangesearch_options)
 }
 
 
+/*
+ Range search for a batch of query points sharing the same radius.  We
+ walk the tree once, carrying along the list of queries that are still
+ live at each node; a query drops out of a subtree as soon as the
+ bounding box (or splitting plane) rules it out.  Since the walk is
+ depth-first, the live list for a node can be kept in a per-level
+ array: a node at level L reads the list at L and writes its own at
+ L+1, and nothing below it touches level L or L+1 again until its
+ sibling is visited.
+ */
+int MANGLE(kdtree_rangesearch_batch)
+     (const kdtree_t* kd, kdtree_qres_t** results, const void* vqueries,
+      int N, double maxd2, int options)
+{
+	int nodestack[100];
+	int levelstack[100];
+	int stackpos = 0;
+	int D = (kd ? kd->ndim : 0);
+	anbool do_dists;
+	anbool do_points = TRUE;
+	anbool do_wholenode_check;
+	anbool use_bboxes = FALSE;
+	double maxdist;
+	// small batches (the common case) don't need to malloc their lists.
+	int livebuf[1024];
+	int nlivebuf[64];
+	int* live = NULL;
+	int* nlive = NULL;
+	size_t nlists;
+	int q;
+	int rtn = -1;
+	const etype* queries = vqueries;
+
+	if (!kd || !results || N < 0 || (N && !queries))
+		return -1;
+	if (N == 0)
+		return 0;
+#if defined(KD_DIM)
+	assert(kd->ndim == KD_DIM);
+	D = KD_DIM;
+#else
+	D = kd->ndim;
+#endif
+
+	if (options & KD_OPTIONS_SORT_DISTS)
+		options |= KD_OPTIONS_COMPUTE_DISTS;
+	do_dists = options & KD_OPTIONS_COMPUTE_DISTS;
+	do_wholenode_check = !(options & KD_OPTIONS_SMALL_RADIUS);
+
+	if (!kd->split.any) {
+		assert(kd->bb.any);
+		use_bboxes = TRUE;
+	} else if (kd->bb.any && !(options & KD_OPTIONS_USE_SPLIT)) {
+		use_bboxes = TRUE;
+	} else {
+		assert(kd->splitdim || TTYPE_INTEGER);
+	}
+	maxdist = sqrt(maxd2);
+
+	for (q=0; q<N; q++) {
+		kdtree_qres_t* res = results[q];
+		if (res) {
+			resize_results(res, res->capacity ? res->capacity : KDTREE_MAX_RESULTS,
+						   D, do_dists, do_points);
+			res->nres = 0;
+		} else {
+			res = CALLOC(1, sizeof(kdtree_qres_t));
+			if (!res) {
+				SYSERROR("Failed to allocate kdtree_qres_t struct");
+				return -1;
+			}
+			resize_results(res, KDTREE_MAX_RESULTS, D, do_dists, do_points);
+			results[q] = res;
+		}
+	}
+
+	nlists = (size_t)MAX(kd->nlevels, 0) + 1;
+	if (nlists <= sizeof(nlivebuf)/sizeof(int) &&
+		nlists * N <= sizeof(livebuf)/sizeof(int)) {
+		live = livebuf;
+		nlive = nlivebuf;
+	} else {
+		live = MALLOC(nlists * (size_t)N * sizeof(int));
+		nlive = MALLOC(nlists * sizeof(int));
+	}
+	if (!live || !nlive) {
+		SYSERROR("Failed to allocate query lists for batched rangesearch");
+		goto bailout;
+	}
+	for (q=0; q<N; q++)
+		live[q] = q;
+	nlive[0] = N;
+
+	// queue root.
+	nodestack[0] = 0;
+	levelstack[0] = 0;
+
+	while (stackpos >= 0) {
+		int nodeid = nodestack[stackpos];
+		int level = levelstack[stackpos];
+		const int* parentlist = live + (size_t)level * N;
+		int nparent = nlive[level];
+		int* list = live + (size_t)(level + 1) * N;
+		int n = 0;
+		int i, j, L, R;
+		stackpos--;
+
+		if (use_bboxes) {
+			ttype *tlo=NULL, *thi=NULL;
+			etype bblo[D], bbhi[D];
+			int d;
+			bboxes(kd, nodeid, &tlo, &thi, D);
+			assert(tlo && thi);
+			// convert the box once, and share it among all the queries.
+			for (d=0; d<D; d++) {
+				bblo[d] = POINT_TE(kd, d, tlo[d]);
+				bbhi[d] = POINT_TE(kd, d, thi[d]);
+			}
+			for (j=0; j<nparent; j++) {
+				const etype* query;
+				q = parentlist[j];
+				query = queries + (size_t)q * D;
+				if (bb_point_mindist2_exceeds(bblo, bbhi, query, D, maxd2))
+					continue;
+				if (do_wholenode_check &&
+					!bb_point_maxdist2_exceeds(bblo, bbhi, query, D, maxd2)) {
+					L = kdtree_left(kd, nodeid);
+					R = kdtree_right(kd, nodeid);
+					for (i=L; i<=R; i++) {
+						double dsqd = HUGE_VAL;
+						if (do_dists)
+							dsqd = dist2(kd, query, KD_DATA(kd, D, i), D);
+						if (!add_result(kd, results[q], dsqd, KD_PERM(kd, i),
+										KD_DATA(kd, D, i), D,
+										do_dists, do_points))
+							goto bailout;
+					}
+					continue;
+				}
+				list[n++] = q;
+			}
+		} else if (nodeid) {
+			// use_splits: check against our parent's splitting plane.
+			int parent = KD_PARENT(nodeid);
+			anbool isleftchild = KD_IS_LEFT_CHILD(nodeid);
+			ttype split = *KD_SPLIT(kd, parent);
+			int dim;
+			etype rsplit;
+			if (kd->splitdim)
+				dim = KD_SPLITDIM(kd, parent);
+			else {
+				bigint tmpsplit = split;
+				dim = tmpsplit & kd->dimmask;
+				split = tmpsplit & kd->splitmask;
+			}
+			rsplit = POINT_TE(kd, dim, split);
+			for (j=0; j<nparent; j++) {
+				etype qd;
+				q = parentlist[j];
+				qd = queries[(size_t)q * D + dim];
+				if (isleftchild ? (qd - rsplit > maxdist)
+					: (rsplit - qd > maxdist))
+					continue;
+				list[n++] = q;
+			}
+		} else {
+			memcpy(list, parentlist, nparent * sizeof(int));
+			n = nparent;
+		}
+
+		if (!n)
+			continue;
+
+		if (KD_IS_LEAF(kd, nodeid)) {
+			int rtn = 1;
+			L = kdtree_left(kd, nodeid);
+			R = kdtree_right(kd, nodeid);
+			// vectorized kernels, if we have them, go a query at a time...
+			for (j=0; j<n; j++) {
+				q = list[j];
+				rtn = leaf_rangesearch(kd, results[q], queries + (size_t)q * D,
+									   D, L, R, maxd2, do_dists, do_points);
+				if (rtn == -1)
+					goto bailout;
+				if (rtn == 1)
+					break;
+			}
+			if (rtn == 0)
+				continue;
+			// ...otherwise each data point is fetched once for all the
+			// live queries.
+			for (i=L; i<=R; i++) {
+				dtype* data = KD_DATA(kd, D, i);
+				for (j=0; j<n; j++) {
+					const etype* query;
+					q = list[j];
+					query = queries + (size_t)q * D;
+					if (do_dists) {
+						anbool bailedout = FALSE;
+						double dsqd;
+						dist2_bailout(kd, query, data, D, maxd2, &bailedout, &dsqd);
+						if (bailedout)
+							continue;
+						if (!add_result(kd, results[q], dsqd, KD_PERM(kd, i),
+										data, D, do_dists, do_points))
+							goto bailout;
+					} else {
+						if (dist2_exceeds(kd, query, data, D, maxd2))
+							continue;
+						if (!add_result(kd, results[q], HUGE_VAL, KD_PERM(kd, i),
+										data, D, do_dists, do_points))
+							goto bailout;
+					}
+				}
+			}
+			continue;
+		}
+
+		nlive[level + 1] = n;
+		// push right then left, so the left subtree is explored first.
+		stackpos++;
+		nodestack[stackpos] = KD_CHILD_RIGHT(nodeid);
+		levelstack[stackpos] = level + 1;
+		stackpos++;
+		nodestack[stackpos] = KD_CHILD_LEFT(nodeid);
+		levelstack[stackpos] = level + 1;
+	}
+
+	for (q=0; q<N; q++) {
+		kdtree_qres_t* res = results[q];
+		if (!(options & KD_OPTIONS_NO_RESIZE_RESULTS))
+			resize_results(res, res->nres, D, do_dists, do_points);
+		if (options & KD_OPTIONS_SORT_DISTS)
+			kdtree_qsort_results(res, kd->ndim);
+	}
+	rtn = 0;
+
+ bailout:
+	if (live != livebuf) {
+		FREE(live);
+		FREE(nlive);
+	}
+	return rtn;
+}
+
+
 static void* get_data(const kdtree_t* kd, int i) {
 	return KD_DATA(kd, kd->ndim, i);
 }
@@ -1916,7 +2236,7 @@ static int kdtree_check_node(const kdtree_t* kd, int nodeid) {
 
 			split = *KD_SPLIT(kd, nodeid);
 			if (kd->splitdim)
-				dim = kd->splitdim[nodeid];
+				dim = KD_SPLITDIM(kd, nodeid);
 			else {
 				if (TTYPE_INTEGER) {
 					bigint tmpsplit;
@@ -2288,7 +2608,7 @@ kdtree_t* MANGLE(kdtree_build_2)
 			if (options & KD_BUILD_BBOX)
 				save_bb(kd, i, nullbb, nullbb);
 			if (kd->splitdim)
-				kd->splitdim[i] = 0;
+				KD_SPLITDIM(kd, i) = 0;
 			c = 2*i;
 			if (level == maxlevel - 2)
 				c -= kd->ninterior;
@@ -2424,7 +2744,7 @@ kdtree_t* MANGLE(kdtree_build_2)
 			}
 		}
 		if (kd->splitdim)
-			kd->splitdim[i] = dim;
+			KD_SPLITDIM(kd, i) = dim;
 
 		/* Store the R pointers for each child */
 		c = 2*i;
@@ -2480,6 +2800,13 @@ kdtree_t* MANGLE(kdtree_build_2)
         kd->lr = NULL;
     }
 
+    // The tree is built in heap order; rearrange it if requested.
+    if ((options & KD_BUILD_VEB_LAYOUT) && kdtree_set_veb_layout(kd)) {
+        ERROR("Failed to put kdtree into van Emde Boas order");
+        kdtree_free(kd);
+        return NULL;
+    }
+
     // set function table pointers.
     MANGLE(kdtree_update_funcs)(kd);
 
@@ -2896,6 +3223,7 @@ void MANGLE(kdtree_update_funcs)(kdtree_t* kd) {
     kd->fun.fix_bounding_boxes = MANGLE(kdtree_fix_bounding_boxes);
 	kd->fun.nearest_neighbour_internal = MANGLE(kdtree_nn);
 	kd->fun.rangesearch = MANGLE(kdtree_rangesearch_options);
+	kd->fun.rangesearch_batch = MANGLE(kdtree_rangesearch_batch);
     kd->fun.nodes_contained = MANGLE(kdtree_nodes_contained);
 }
 
@@ -24,6 +24,7 @@ static char* get_table_name(const char* treename, const char* tabname) {
 
 int MANGLE(kdtree_read_fits)(kdtree_fits_t* io, kdtree_t* kd) {
     fitsbin_chunk_t chunk;
+    anbool veb = kdtree_has_veb_layout(kd);
 
     fitsbin_chunk_init(&chunk);
 
@@ -48,7 +49,7 @@ int MANGLE(kdtree_read_fits)(kdtree_fits_t* io, kdtree_t* kd) {
     free(chunk.tablename);
 
 	// kd->bb
-    chunk.tablename = get_table_name(kd->name, KD_STR_BB);
+    chunk.tablename = get_table_name(kd->name, veb ? KD_STR_BB_VEB : KD_STR_BB);
     chunk.itemsize = sizeof(ttype) * kd->ndim * 2;
     chunk.nrows = 0;
     chunk.required = FALSE;
@@ -77,7 +78,7 @@ int MANGLE(kdtree_read_fits)(kdtree_fits_t* io, kdtree_t* kd) {
     free(chunk.tablename);
 
 	// kd->split
-    chunk.tablename = get_table_name(kd->name, KD_STR_SPLIT);
+    chunk.tablename = get_table_name(kd->name, veb ? KD_STR_SPLIT_VEB : KD_STR_SPLIT);
     chunk.itemsize = sizeof(ttype);
     chunk.nrows = kd->ninterior;
     chunk.required = FALSE;
@@ -87,7 +88,7 @@ int MANGLE(kdtree_read_fits)(kdtree_fits_t* io, kdtree_t* kd) {
     free(chunk.tablename);
 
 	// kd->splitdim
-    chunk.tablename = get_table_name(kd->name, KD_STR_SPLITDIM);
+    chunk.tablename = get_table_name(kd->name, veb ? KD_STR_SPLITDIM_VEB : KD_STR_SPLITDIM);
     chunk.itemsize = sizeof(u8);
     chunk.nrows = kd->ninterior;
     chunk.required = FALSE;
@@ -169,6 +170,7 @@ int MANGLE(kdtree_write_fits)(kdtree_fits_t* io, const kdtree_t* kd,
     fitsbin_t* fb = kdtree_fits_get_fitsbin(io);
     qfits_header* hdr;
     int wordsize = 0;
+    anbool veb = kdtree_has_veb_layout(kd);
 
 	// haven't bothered to support this.
 	assert(!(flip_endian && fid));
@@ -193,6 +195,7 @@ int MANGLE(kdtree_write_fits)(kdtree_fits_t* io, const kdtree_t* kd,
     qfits_header_add(hdr, "KDT_INT",  (char*)kdtree_kdtype_to_string(kdtree_treetype(kd)), "kdtree: type of the tree's structures", NULL);
     qfits_header_add(hdr, "KDT_DATA", (char*)kdtree_kdtype_to_string(kdtree_datatype(kd)), "kdtree: type of the data", NULL);
     qfits_header_add(hdr, "KDT_LINL", (kd->has_linear_lr ? "T" : "F"), "kdtree: has_linear_lr", NULL);
+    qfits_header_add(hdr, "KDT_VEB",  (kdtree_has_veb_layout(kd) ? "T" : "F"), "kdtree: van Emde Boas node order", NULL);
     WRITE_CHUNK();
     free(chunk.tablename);
     fitsbin_chunk_reset(&chunk);
@@ -234,7 +237,7 @@ int MANGLE(kdtree_write_fits)(kdtree_fits_t* io, const kdtree_t* kd,
         fitsbin_chunk_reset(&chunk);
 	}
 	if (kd->bb.any) {
-        chunk.tablename = get_table_name(kd->name, KD_STR_BB);
+        chunk.tablename = get_table_name(kd->name, veb ? KD_STR_BB_VEB : KD_STR_BB);
         chunk.itemsize = sizeof(ttype) * kd->ndim * 2;
         chunk.nrows = kd->nnodes;
         chunk.data = kd->bb.any;
@@ -249,12 +252,14 @@ int MANGLE(kdtree_write_fits)(kdtree_fits_t* io, const kdtree_t* kd,
 			 chunk.tablename, (unsigned int)kd->ndim,
              (unsigned int)sizeof(ttype),
 			 kdtree_kdtype_to_string(kdtree_treetype(kd)));
+        if (veb)
+            fits_add_long_comment(hdr, "The nodes are in van Emde Boas order, not heap order.");
         WRITE_CHUNK();
         free(chunk.tablename);
         fitsbin_chunk_reset(&chunk);
 	}
 	if (kd->split.any) {
-        chunk.tablename = get_table_name(kd->name, KD_STR_SPLIT);
+        chunk.tablename = get_table_name(kd->name, veb ? KD_STR_SPLIT_VEB : KD_STR_SPLIT);
         chunk.itemsize = sizeof(ttype);
         chunk.nrows = kd->ninterior;
         chunk.data = kd->split.any;
@@ -286,12 +291,14 @@ int MANGLE(kdtree_write_fits)(kdtree_fits_t* io, const kdtree_t* kd,
 				 chunk.tablename, chunk.itemsize,
 				 kdtree_kdtype_to_string(kdtree_treetype(kd)));
 		}
+        if (veb)
+            fits_add_long_comment(hdr, "The nodes are in van Emde Boas order, not heap order.");
         WRITE_CHUNK();
         free(chunk.tablename);
         fitsbin_chunk_reset(&chunk);
 	}
 	if (kd->splitdim) {
-        chunk.tablename = get_table_name(kd->name, KD_STR_SPLITDIM);
+        chunk.tablename = get_table_name(kd->name, veb ? KD_STR_SPLITDIM_VEB : KD_STR_SPLITDIM);
         chunk.itemsize = sizeof(u8);
         chunk.nrows = kd->ninterior;
         chunk.data = kd->splitdim;
@@ -307,6 +314,8 @@ int MANGLE(kdtree_write_fits)(kdtree_fits_t* io, const kdtree_t* kd,
 			 "low side of the splitting plane, and the right child contains "
 			 "data points on the high side of the plane.",
 			 chunk.tablename, chunk.itemsize);
+        if (veb)
+            fits_add_long_comment(hdr, "The nodes are in van Emde Boas order, not heap order.");
         WRITE_CHUNK();
         free(chunk.tablename);
         fitsbin_chunk_reset(&chunk);
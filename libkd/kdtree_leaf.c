@@ -0,0 +1,261 @@
+/*
+# This file is part of libkd.
+# Licensed under a 3-clause BSD style license - see LICENSE
+*/
+
+#include <stdint.h>
+
+#include "kdtree_leaf.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KD_LEAF_X86 1
+#include <immintrin.h>
+#define SSE2_FUNC __attribute__((target("sse2")))
+#define AVX2_FUNC __attribute__((target("avx2")))
+#else
+#define KD_LEAF_X86 0
+#endif
+
+enum leaf_data_kind {
+	LEAF_DATA_D,
+	LEAF_DATA_U32,
+	LEAF_DATA_U16,
+};
+
+static int forced_kernel = -1;
+
+// The CPU check is done once; every leaf scan asks which kernel to use.
+static int best_kernel = -1;
+
+static int detect_best_kernel(void) {
+#if KD_LEAF_X86
+	if (__builtin_cpu_supports("avx2"))
+		return KD_LEAF_AVX2;
+	if (__builtin_cpu_supports("sse2"))
+		return KD_LEAF_SSE2;
+#endif
+	return KD_LEAF_SCALAR;
+}
+
+int kdtree_leaf_best_kernel(void) {
+	// (threads racing here all store the same value.)
+	int best = __atomic_load_n(&best_kernel, __ATOMIC_RELAXED);
+	if (best < 0) {
+		best = detect_best_kernel();
+		__atomic_store_n(&best_kernel, best, __ATOMIC_RELAXED);
+	}
+	return best;
+}
+
+int kdtree_leaf_kernel(void) {
+	int best = kdtree_leaf_best_kernel();
+	if (forced_kernel >= 0 && forced_kernel <= best)
+		return forced_kernel;
+	return best;
+}
+
+void kdtree_leaf_set_kernel(int kernel) {
+	forced_kernel = kernel;
+}
+
+// One point, the plain way; for the leftovers at the end of a block.
+static double scalar_dist2(int kind, const void* data, int i,
+						   const double* query, const double* minval,
+						   double invscale) {
+	double d2 = 0.0;
+	int d;
+	for (d=0; d<4; d++) {
+		double p, delta;
+		switch (kind) {
+		case LEAF_DATA_U32:
+			p = ((const uint32_t*)data)[4*i + d] * invscale + minval[d];
+			break;
+		case LEAF_DATA_U16:
+			p = ((const uint16_t*)data)[4*i + d] * invscale + minval[d];
+			break;
+		default:
+			p = ((const double*)data)[4*i + d];
+			break;
+		}
+		delta = query[d] - p;
+		d2 += delta * delta;
+	}
+	return d2;
+}
+
+#if KD_LEAF_X86
+
+/*
+ SSE2: each point is held in two registers, (x0,x1) and (x2,x3); two
+ points are finished at a time.
+ */
+static inline SSE2_FUNC void sse2_load_d(const void* data, int i,
+										 __m128d* lo, __m128d* hi) {
+	const double* p = (const double*)data + 4*i;
+	*lo = _mm_loadu_pd(p);
+	*hi = _mm_loadu_pd(p + 2);
+}
+
+static inline SSE2_FUNC void sse2_load_u32(const void* data, int i,
+										   __m128d* lo, __m128d* hi) {
+	const __m128i* p = (const __m128i*)((const uint32_t*)data + 4*i);
+	// no unsigned conversion in SSE2: flip the sign bit and add it back.
+	const __m128d bias = _mm_set1_pd(2147483648.0);
+	__m128i x = _mm_xor_si128(_mm_loadu_si128(p), _mm_set1_epi32(INT32_MIN));
+	*lo = _mm_add_pd(_mm_cvtepi32_pd(x), bias);
+	*hi = _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(x, _MM_SHUFFLE(3,2,3,2))),
+					 bias);
+}
+
+static inline SSE2_FUNC void sse2_load_u16(const void* data, int i,
+										   __m128d* lo, __m128d* hi) {
+	const __m128i* p = (const __m128i*)((const uint16_t*)data + 4*i);
+	__m128i x = _mm_unpacklo_epi16(_mm_loadl_epi64(p), _mm_setzero_si128());
+	*lo = _mm_cvtepi32_pd(x);
+	*hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(x, _MM_SHUFFLE(3,2,3,2)));
+}
+
+#define SSE2_POINT(LOAD, i, s)											\
+	do {																\
+		__m128d lo, hi, dlo, dhi;										\
+		LOAD(data, i, &lo, &hi);										\
+		dlo = _mm_sub_pd(qlo, _mm_add_pd(_mm_mul_pd(lo, scale), mlo));	\
+		dhi = _mm_sub_pd(qhi, _mm_add_pd(_mm_mul_pd(hi, scale), mhi));	\
+		s = _mm_add_pd(_mm_mul_pd(dlo, dlo), _mm_mul_pd(dhi, dhi));		\
+	} while (0)
+
+#define DEFINE_SSE2_KERNEL(NAME, LOAD, KIND)							\
+	static SSE2_FUNC void NAME(const void* data, int N,					\
+							   const double* query,						\
+							   const double* minval, double invscale,	\
+							   double* d2) {							\
+		const __m128d qlo = _mm_loadu_pd(query);						\
+		const __m128d qhi = _mm_loadu_pd(query + 2);					\
+		const __m128d mlo = _mm_loadu_pd(minval);						\
+		const __m128d mhi = _mm_loadu_pd(minval + 2);					\
+		const __m128d scale = _mm_set1_pd(invscale);					\
+		int i = 0;														\
+		for (; i+2 <= N; i+=2) {										\
+			__m128d s0, s1;												\
+			SSE2_POINT(LOAD, i,   s0);									\
+			SSE2_POINT(LOAD, i+1, s1);									\
+			_mm_storeu_pd(d2 + i, _mm_add_pd(_mm_unpacklo_pd(s0, s1),	\
+											 _mm_unpackhi_pd(s0, s1)));	\
+		}																\
+		for (; i<N; i++)												\
+			d2[i] = scalar_dist2(KIND, data, i, query, minval, invscale); \
+	}
+
+DEFINE_SSE2_KERNEL(sse2_dist2_d,   sse2_load_d,   LEAF_DATA_D)
+DEFINE_SSE2_KERNEL(sse2_dist2_u32, sse2_load_u32, LEAF_DATA_U32)
+DEFINE_SSE2_KERNEL(sse2_dist2_u16, sse2_load_u16, LEAF_DATA_U16)
+
+/*
+ AVX2: one point per register; four points are reduced together with
+ two horizontal adds and a cross-lane shuffle.
+ */
+static inline AVX2_FUNC __m256d avx2_load_d(const void* data, int i) {
+	return _mm256_loadu_pd((const double*)data + 4*i);
+}
+
+static inline AVX2_FUNC __m256d avx2_load_u32(const void* data, int i) {
+	const __m128i* p = (const __m128i*)((const uint32_t*)data + 4*i);
+	__m128i x = _mm_xor_si128(_mm_loadu_si128(p), _mm_set1_epi32(INT32_MIN));
+	return _mm256_add_pd(_mm256_cvtepi32_pd(x), _mm256_set1_pd(2147483648.0));
+}
+
+static inline AVX2_FUNC __m256d avx2_load_u16(const void* data, int i) {
+	const __m128i* p = (const __m128i*)((const uint16_t*)data + 4*i);
+	return _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_loadl_epi64(p)));
+}
+
+#define AVX2_POINT(LOAD, i)												\
+	({																	\
+		__m256d delta = _mm256_sub_pd(q, _mm256_add_pd(					\
+			_mm256_mul_pd(LOAD(data, i), scale), m));					\
+		_mm256_mul_pd(delta, delta);									\
+	})
+
+#define DEFINE_AVX2_KERNEL(NAME, LOAD, KIND)							\
+	static AVX2_FUNC void NAME(const void* data, int N,					\
+							   const double* query,						\
+							   const double* minval, double invscale,	\
+							   double* d2) {							\
+		const __m256d q = _mm256_loadu_pd(query);						\
+		const __m256d m = _mm256_loadu_pd(minval);						\
+		const __m256d scale = _mm256_set1_pd(invscale);					\
+		int i = 0;														\
+		for (; i+4 <= N; i+=4) {										\
+			__m256d h01 = _mm256_hadd_pd(AVX2_POINT(LOAD, i),			\
+										 AVX2_POINT(LOAD, i+1));		\
+			__m256d h23 = _mm256_hadd_pd(AVX2_POINT(LOAD, i+2),			\
+										 AVX2_POINT(LOAD, i+3));		\
+			_mm256_storeu_pd(d2 + i, _mm256_add_pd(						\
+				_mm256_permute2f128_pd(h01, h23, 0x20),					\
+				_mm256_permute2f128_pd(h01, h23, 0x31)));				\
+		}																\
+		for (; i<N; i++)												\
+			d2[i] = scalar_dist2(KIND, data, i, query, minval, invscale); \
+	}
+
+DEFINE_AVX2_KERNEL(avx2_dist2_d,   avx2_load_d,   LEAF_DATA_D)
+DEFINE_AVX2_KERNEL(avx2_dist2_u32, avx2_load_u32, LEAF_DATA_U32)
+DEFINE_AVX2_KERNEL(avx2_dist2_u16, avx2_load_u16, LEAF_DATA_U16)
+
+#endif
+
+static int leaf_dist2(int kind, const void* data, int N, int D,
+					  const double* query, const double* minval,
+					  double invscale, double* d2) {
+#if KD_LEAF_X86
+	int kernel;
+	if (D != 4)
+		return -1;
+	kernel = kdtree_leaf_kernel();
+	if (kernel == KD_LEAF_AVX2) {
+		switch (kind) {
+		case LEAF_DATA_D:
+			avx2_dist2_d(data, N, query, minval, invscale, d2);
+			return 0;
+		case LEAF_DATA_U32:
+			avx2_dist2_u32(data, N, query, minval, invscale, d2);
+			return 0;
+		case LEAF_DATA_U16:
+			avx2_dist2_u16(data, N, query, minval, invscale, d2);
+			return 0;
+		}
+	} else if (kernel == KD_LEAF_SSE2) {
+		switch (kind) {
+		case LEAF_DATA_D:
+			sse2_dist2_d(data, N, query, minval, invscale, d2);
+			return 0;
+		case LEAF_DATA_U32:
+			sse2_dist2_u32(data, N, query, minval, invscale, d2);
+			return 0;
+		case LEAF_DATA_U16:
+			sse2_dist2_u16(data, N, query, minval, invscale, d2);
+			return 0;
+		}
+	}
+#endif
+	return -1;
+}
+
+int kdtree_leaf_dist2_d(const double* data, int N, int D,
+						const double* query, double* d2) {
+	// raw doubles: the same arithmetic as the integer kernels, but exact.
+	const double zero[4] = { 0.0, 0.0, 0.0, 0.0 };
+	return leaf_dist2(LEAF_DATA_D, data, N, D, query, zero, 1.0, d2);
+}
+
+int kdtree_leaf_dist2_u32(const uint32_t* data, int N, int D,
+						  const double* query, const double* minval,
+						  double invscale, double* d2) {
+	return leaf_dist2(LEAF_DATA_U32, data, N, D, query, minval, invscale, d2);
+}
+
+int kdtree_leaf_dist2_u16(const uint16_t* data, int N, int D,
+						  const double* query, const double* minval,
+						  double invscale, double* d2) {
+	return leaf_dist2(LEAF_DATA_U16, data, N, D, query, minval, invscale, d2);
+}
@@ -0,0 +1,60 @@
+/*
+# This file is part of libkd.
+# Licensed under a 3-clause BSD style license - see LICENSE
+*/
+
+#ifndef KDTREE_LEAF_H
+#define KDTREE_LEAF_H
+
+#include <stdint.h>
+
+/*
+ Vectorized kernels for scanning the points in a kd-tree leaf: they
+ compute the squared distances from a query point to a contiguous block
+ of data points.  Only 4-dimensional points (ie, quad codes) have SIMD
+ kernels; for anything else the caller falls back to its scalar loop.
+
+ The integer versions convert the data to the external (double) space
+ as  x * invscale + minval[d],  just like POINT_INVSCALE().
+
+ The kernel is chosen at runtime from what the CPU supports.
+ */
+
+enum kd_leaf_kernel {
+	// no vectorized kernel: use the plain one-point-at-a-time loop.
+	KD_LEAF_SCALAR = 0,
+	KD_LEAF_SSE2   = 1,
+	KD_LEAF_AVX2   = 2,
+};
+
+// The best kernel this CPU supports.
+int kdtree_leaf_best_kernel(void);
+
+// The kernel currently in use (the best one, unless overridden).
+int kdtree_leaf_kernel(void);
+
+/*
+ Override the kernel choice, for testing and benchmarking.  Pass -1 to
+ go back to automatic selection.  Kernels the CPU doesn't support are
+ ignored.  Not thread-safe: call it before starting any searches.
+ */
+void kdtree_leaf_set_kernel(int kernel);
+
+/*
+ Each of these computes d2[i] for the N points starting at "data",
+ with D dimensions.  They return 0 on success, or -1 if there is no
+ vectorized kernel for this D (or the scalar kernel is selected), in
+ which case "d2" is untouched.
+ */
+int kdtree_leaf_dist2_d(const double* data, int N, int D,
+						const double* query, double* d2);
+
+int kdtree_leaf_dist2_u32(const uint32_t* data, int N, int D,
+						  const double* query, const double* minval,
+						  double invscale, double* d2);
+
+int kdtree_leaf_dist2_u16(const uint16_t* data, int N, int D,
+						  const double* query, const double* minval,
+						  double invscale, double* d2);
+
+#endif
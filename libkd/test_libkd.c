@@ -16,6 +16,7 @@
 #include "kdtree.h"
 #include "mathutil.h"
 #include "an-fls.h"
+#include "kdtree_leaf.h"
 
 #include "test_libkd_common.c"
 
@@ -325,8 +326,12 @@ static void run_test_nn(CuTest* tc, int treetype, int treeopts,
     free(origdata);
 }
 
-static void run_test_rs_ND(CuTest* tc, int treetype, int treeopts,
-                           double eps, int N, int D) {
+/*
+ Queries are drawn from [-margin, 1+margin]^D; the data from [0,1]^D, so
+ with a margin some queries fall outside the range of integer trees.
+ */
+static void run_test_rs_margin(CuTest* tc, int treetype, int treeopts,
+                               double eps, int N, int D, double margin) {
     int Nleaf = 10;
     int Q = 10;
     double rad2 = 0.01;
@@ -353,7 +358,7 @@ static void run_test_rs_ND(CuTest* tc, int treetype, int treeopts,
         kdtree_qres_t* res;
 
         for (d=0; d<D; d++)
-            query[d] = rand() / (double)RAND_MAX;
+            query[d] = -margin + (1.0 + 2.0*margin) * rand() / (double)RAND_MAX;
 
         res = kdtree_rangesearch(kd, query, rad2);
 
@@ -400,6 +405,11 @@ static void run_test_rs_ND(CuTest* tc, int treetype, int treeopts,
     free(origdata);
 }
 
+static void run_test_rs_ND(CuTest* tc, int treetype, int treeopts,
+                           double eps, int N, int D) {
+    run_test_rs_margin(tc, treetype, treeopts, eps, N, D, 0.0);
+}
+
 static void run_test_rs(CuTest* tc, int treetype, int treeopts,
                         double eps) {
     int N = 1000;
@@ -444,9 +454,265 @@ void test_rs_split_dss(CuTest* tc) {
     run_test_rs(tc, KDTT_DSS, KD_BUILD_SPLIT, 1e-5);
 }
 
+// queries outside the tree's range can't be converted to integers, so
+// the integer trees compare them against the splits in floating point.
+void test_rs_split_duu_outside(CuTest* tc) {
+    run_test_rs_margin(tc, KDTT_DUU, KD_BUILD_SPLIT, 1e-9, 1000, 3, 0.1);
+}
+void test_rs_split_dss_outside(CuTest* tc) {
+    run_test_rs_margin(tc, KDTT_DSS, KD_BUILD_SPLIT, 1e-5, 1000, 3, 0.1);
+}
+
+void test_rs_both_duu_veb(CuTest* tc) {
+    run_test_rs(tc, KDTT_DUU, KD_BUILD_BBOX | KD_BUILD_SPLIT | KD_BUILD_VEB_LAYOUT, 1e-9);
+}
+void test_rs_split_dss_veb(CuTest* tc) {
+    run_test_rs(tc, KDTT_DSS, KD_BUILD_SPLIT | KD_BUILD_VEB_LAYOUT, 1e-5);
+}
+
+/*
+ Builds the same tree in heap and van Emde Boas order and checks that
+ the node accessors and searches agree.
+ */
+static void run_test_veb(CuTest* tc, int treetype, int treeopts) {
+    int N = 3000;
+    int D = 3;
+    int Nleaf = 7;
+    int Q = 50;
+    double rad2 = 0.005;
+    double* data1;
+    double* data2;
+    double* queries;
+    kdtree_t* kd1;
+    kdtree_t* kd2;
+    int i, q;
+    int options = KD_OPTIONS_COMPUTE_DISTS | KD_OPTIONS_SORT_DISTS;
+
+    srand(0);
+    data1 = random_points_d(N, D);
+    data2 = malloc(N * D * sizeof(double));
+    memcpy(data2, data1, N * D * sizeof(double));
+    queries = random_points_d(Q, D);
+    kd1 = build_tree(tc, data1, N, D, Nleaf, treetype, treeopts);
+    kd2 = build_tree(tc, data2, N, D, Nleaf, treetype,
+                     treeopts | KD_BUILD_VEB_LAYOUT);
+    CuAssert(tc, "kd1", kd1 != NULL);
+    CuAssert(tc, "kd2", kd2 != NULL);
+    CuAssert(tc, "heap", !kdtree_has_veb_layout(kd1));
+    CuAssert(tc, "veb", kdtree_has_veb_layout(kd2));
+
+    if (kd1->split.any) {
+        for (i=0; i<kd1->ninterior; i++) {
+            CuAssertIntEquals(tc, kdtree_get_splitdim(kd1, i),
+                              kdtree_get_splitdim(kd2, i));
+            CuAssertDblEquals(tc, kdtree_get_splitval(kd1, i),
+                              kdtree_get_splitval(kd2, i), 0.0);
+        }
+    }
+    if (kd1->bb.any) {
+        for (i=0; i<kd1->nnodes; i++) {
+            double lo1[D], hi1[D], lo2[D], hi2[D];
+            kdtree_get_bboxes(kd1, i, lo1, hi1);
+            kdtree_get_bboxes(kd2, i, lo2, hi2);
+            CuAssert(tc, "bb lo", memcmp(lo1, lo2, sizeof(lo1)) == 0);
+            CuAssert(tc, "bb hi", memcmp(hi1, hi2, sizeof(hi1)) == 0);
+        }
+    }
+
+    for (q=0; q<Q; q++) {
+        kdtree_qres_t* r1;
+        kdtree_qres_t* r2;
+        double d1, d2;
+        r1 = kdtree_rangesearch_options(kd1, queries + q*D, rad2, options);
+        r2 = kdtree_rangesearch_options(kd2, queries + q*D, rad2, options);
+        CuAssertIntEquals(tc, r1->nres, r2->nres);
+        for (i=0; i<r1->nres; i++) {
+            CuAssertIntEquals(tc, r1->inds[i], r2->inds[i]);
+            CuAssertDblEquals(tc, r1->sdists[i], r2->sdists[i], 0.0);
+        }
+        kdtree_free_query(r1);
+        kdtree_free_query(r2);
+
+        CuAssertIntEquals(tc, kdtree_nearest_neighbour(kd1, queries + q*D, &d1),
+                          kdtree_nearest_neighbour(kd2, queries + q*D, &d2));
+        CuAssertDblEquals(tc, d1, d2, 0.0);
+    }
+
+    kdtree_free(kd1);
+    kdtree_free(kd2);
+    free(data1);
+    free(data2);
+    free(queries);
+}
+
+void test_veb_both_ddd(CuTest* tc) {
+    run_test_veb(tc, KDTT_DOUBLE, KD_BUILD_BBOX | KD_BUILD_SPLIT);
+}
+void test_veb_split_duu(CuTest* tc) {
+    run_test_veb(tc, KDTT_DUU, KD_BUILD_SPLIT);
+}
+void test_veb_splitdim_dss(CuTest* tc) {
+    run_test_veb(tc, KDTT_DSS, KD_BUILD_SPLIT | KD_BUILD_SPLITDIM);
+}
+void test_veb_bb_dss(CuTest* tc) {
+    run_test_veb(tc, KDTT_DSS, KD_BUILD_BBOX);
+}
+
+static int compare_ints(const void* v1, const void* v2) {
+    int i1 = *(const int*)v1;
+    int i2 = *(const int*)v2;
+    return (i1 < i2) ? -1 : ((i1 > i2) ? 1 : 0);
+}
+
+/*
+ Checks that kdtree_rangesearch_batch() finds the same points as
+ running kdtree_rangesearch_options() on each query in turn.  Queries
+ are drawn from [-margin, 1+margin]^D.
+ */
+static void run_test_rs_batch(CuTest* tc, int treetype, int treeopts,
+                              int options, double margin) {
+    int N = 1000;
+    int D = 3;
+    int Nleaf = 10;
+    int Q = 20;
+    double rad2 = 0.01;
+    double* data;
+    double* queries;
+    kdtree_t* kd;
+    kdtree_qres_t* res[Q];
+    int i, q;
+
+    srand(0);
+    data = random_points_d(N, D);
+    queries = random_points_d(Q, D);
+    for (i=0; i<Q*D; i++)
+        queries[i] = -margin + (1.0 + 2.0*margin) * queries[i];
+    kd = build_tree(tc, data, N, D, Nleaf, treetype, treeopts);
+    CuAssert(tc, "kd", kd != NULL);
+
+    for (q=0; q<Q; q++)
+        res[q] = NULL;
+    // reuse one of the results, as the solver does.
+    res[1] = kdtree_rangesearch(kd, queries, rad2);
+
+    CuAssertIntEquals(tc, 0, kdtree_rangesearch_batch(kd, res, queries, Q,
+                                                      rad2, options));
+    for (q=0; q<Q; q++) {
+        kdtree_qres_t* single;
+        int inds1[N], inds2[N];
+        single = kdtree_rangesearch_options(kd, queries + q*D, rad2, options);
+        CuAssert(tc, "res", res[q] != NULL);
+        CuAssertIntEquals(tc, single->nres, res[q]->nres);
+        for (i=0; i<single->nres; i++) {
+            inds1[i] = single->inds[i];
+            inds2[i] = res[q]->inds[i];
+        }
+        qsort(inds1, single->nres, sizeof(int), compare_ints);
+        qsort(inds2, single->nres, sizeof(int), compare_ints);
+        for (i=0; i<single->nres; i++)
+            CuAssertIntEquals(tc, inds1[i], inds2[i]);
+        kdtree_free_query(single);
+        kdtree_free_query(res[q]);
+    }
+
+    kdtree_free(kd);
+    free(data);
+    free(queries);
+}
+
+void test_rs_batch_bb_ddd(CuTest* tc) {
+    run_test_rs_batch(tc, KDTT_DOUBLE, KD_BUILD_BBOX, KD_OPTIONS_COMPUTE_DISTS,
+                      0.0);
+}
+void test_rs_batch_split_ddd(CuTest* tc) {
+    run_test_rs_batch(tc, KDTT_DOUBLE, KD_BUILD_SPLIT, KD_OPTIONS_SORT_DISTS,
+                      0.0);
+}
+void test_rs_batch_bb_duu(CuTest* tc) {
+    run_test_rs_batch(tc, KDTT_DUU, KD_BUILD_BBOX, 0, 0.0);
+}
+void test_rs_batch_both_dss(CuTest* tc) {
+    // the options the solver uses for code searches.
+    run_test_rs_batch(tc, KDTT_DSS, KD_BUILD_BBOX | KD_BUILD_SPLIT,
+                      KD_OPTIONS_SMALL_RADIUS | KD_OPTIONS_COMPUTE_DISTS |
+                      KD_OPTIONS_NO_RESIZE_RESULTS | KD_OPTIONS_USE_SPLIT, 0.0);
+}
+// codes can fall just outside [0,1], and so outside an integer code
+// tree's range.
+void test_rs_batch_split_dss_outside(CuTest* tc) {
+    run_test_rs_batch(tc, KDTT_DSS, KD_BUILD_BBOX | KD_BUILD_SPLIT,
+                      KD_OPTIONS_SMALL_RADIUS | KD_OPTIONS_COMPUTE_DISTS |
+                      KD_OPTIONS_NO_RESIZE_RESULTS | KD_OPTIONS_USE_SPLIT, 0.1);
+}
+void test_rs_batch_split_duu_outside(CuTest* tc) {
+    run_test_rs_batch(tc, KDTT_DUU, KD_BUILD_SPLIT, KD_OPTIONS_COMPUTE_DISTS,
+                      0.1);
+}
+void test_rs_batch_bb_duu_outside(CuTest* tc) {
+    run_test_rs_batch(tc, KDTT_DUU, KD_BUILD_BBOX, 0, 0.1);
+}
 
 
 
+
+/*
+ Checks that each vectorized leaf kernel finds the same points as the
+ plain scalar loop, on 4-D trees (where the kernels kick in).
+ */
+static void run_test_rs_leaf(CuTest* tc, int treetype) {
+    int N = 5000;
+    int D = 4;
+    int Nleaf = 13;
+    int Q = 50;
+    double rad2 = 0.01;
+    double* data;
+    double* queries;
+    kdtree_t* kd;
+    int k, i, q;
+    int options = KD_OPTIONS_COMPUTE_DISTS | KD_OPTIONS_USE_SPLIT;
+
+    srand(0);
+    data = random_points_d(N, D);
+    queries = random_points_d(Q, D);
+    kd = build_tree(tc, data, N, D, Nleaf, treetype,
+                    KD_BUILD_BBOX | KD_BUILD_SPLIT);
+    CuAssert(tc, "kd", kd != NULL);
+
+    for (k=KD_LEAF_SSE2; k<=kdtree_leaf_best_kernel(); k++) {
+        for (q=0; q<Q; q++) {
+            kdtree_qres_t* r1;
+            kdtree_qres_t* r2;
+            kdtree_leaf_set_kernel(KD_LEAF_SCALAR);
+            r1 = kdtree_rangesearch_options(kd, queries + q*D, rad2, options);
+            kdtree_leaf_set_kernel(k);
+            r2 = kdtree_rangesearch_options(kd, queries + q*D, rad2, options);
+            CuAssertIntEquals(tc, r1->nres, r2->nres);
+            // same tree walk, so the same order.
+            for (i=0; i<r1->nres; i++) {
+                CuAssertIntEquals(tc, r1->inds[i], r2->inds[i]);
+                CuAssertDblEquals(tc, r1->sdists[i], r2->sdists[i], 1e-12);
+            }
+            kdtree_free_query(r1);
+            kdtree_free_query(r2);
+        }
+    }
+    kdtree_leaf_set_kernel(-1);
+
+    kdtree_free(kd);
+    free(data);
+    free(queries);
+}
+
+void test_rs_leaf_dss(CuTest* tc) {
+    run_test_rs_leaf(tc, KDTT_DSS);
+}
+void test_rs_leaf_duu(CuTest* tc) {
+    run_test_rs_leaf(tc, KDTT_DUU);
+}
+void test_rs_leaf_ddd(CuTest* tc) {
+    run_test_rs_leaf(tc, KDTT_DOUBLE);
+}
+
 void test_nn_bb_ddd(CuTest* tc) {
     run_test_nn(tc, KDTT_DOUBLE, KD_BUILD_BBOX, 1e-9);
 }
@@ -495,6 +761,13 @@ void test_nn_split_dss_linearlr(CuTest* tc) {
     run_test_nn(tc, KDTT_DSS, KD_BUILD_SPLIT | KD_BUILD_SPLITDIM | KD_BUILD_NO_LR | KD_BUILD_LINEAR_LR, 1e-5);
 }
 
+void test_nn_both_ddd_veb(CuTest* tc) {
+    run_test_nn(tc, KDTT_DOUBLE, KD_BUILD_SPLIT | KD_BUILD_BBOX | KD_BUILD_VEB_LAYOUT, 1e-9);
+}
+void test_nn_split_duu_linearlr_veb(CuTest* tc) {
+    run_test_nn(tc, KDTT_DUU, KD_BUILD_SPLIT | KD_BUILD_SPLITDIM | KD_BUILD_NO_LR | KD_BUILD_LINEAR_LR | KD_BUILD_VEB_LAYOUT, 1e-9);
+}
+
 void run_test_lr(CuTest* tc, int D, int Nleaf, int treetype, int treeopts) {
     int i;
     kdtree_t* kd;
@@ -0,0 +1,49 @@
+
+
+/* This is auto-generated code. Edit at your own peril. */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "cutest.h"
+
+
+extern void test_read_write_single_tree_unnamed(CuTest*);
+extern void test_read_write_single_tree_named(CuTest*);
+extern void test_read_write_two_trees(CuTest*);
+extern void test_read_write_veb_tree(CuTest*);
+extern void test_veb_tree_refused_by_old_readers(CuTest*);
+
+
+void RunAllTests(void) 
+{
+    CuString *output = CuStringNew();
+    CuSuite* suite = CuSuiteNew();
+
+
+    SUITE_ADD_TEST(suite, test_read_write_single_tree_unnamed);
+    SUITE_ADD_TEST(suite, test_read_write_single_tree_named);
+    SUITE_ADD_TEST(suite, test_read_write_two_trees);
+    SUITE_ADD_TEST(suite, test_read_write_veb_tree);
+    SUITE_ADD_TEST(suite, test_veb_tree_refused_by_old_readers);
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+
+    printf("%s\n", output->buffer);
+
+    CuSuiteFree(suite);
+    CuStringFree(output);
+}
+
+int main(int argc, char** args)
+{
+    if (argc > 1 && !strcmp(args[1], "-d")) {
+        printf("Setting die on fail.\n");
+        CuDieOnFail();
+    }
+    RunAllTests();
+    return 0;
+}
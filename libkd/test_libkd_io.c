@@ -38,6 +38,13 @@ static void assert_kdtrees_equal(CuTest* ct, const kdtree_t* kd, const kdtree_t*
     CuAssertIntEquals(ct, kd->ninterior, kd2->ninterior);
     CuAssertIntEquals(ct, kd->nlevels, kd2->nlevels);
     CuAssertIntEquals(ct, kd->has_linear_lr, kd2->has_linear_lr);
+    CuAssertIntEquals(ct, kdtree_has_veb_layout(kd), kdtree_has_veb_layout(kd2));
+    if (kdtree_has_veb_layout(kd)) {
+        CuAssert(ct, "nodemap equal", memcmp(kd->nodemap, kd2->nodemap,
+                                             kd->nnodes * sizeof(u32)) == 0);
+        CuAssert(ct, "splitmap equal", memcmp(kd->splitmap, kd2->splitmap,
+                                              kd->ninterior * sizeof(u32)) == 0);
+    }
     CuAssertDblEquals(ct, kd->scale,    kd2->scale,    del);
     CuAssertDblEquals(ct, kd->invscale, kd2->invscale, del);
 
@@ -285,3 +292,110 @@ void test_read_write_two_trees(CuTest* ct) {
     kdtree_free(kdB);
 }
 
+
+void test_read_write_veb_tree(CuTest* ct) {
+    kdtree_t* kd;
+    double * data;
+    int N = 1000;
+    int Nleaf = 5;
+    int D = 3;
+    char fn[1024];
+    int rtn;
+    kdtree_t* kd2;
+    int fd;
+    int q;
+
+    data = random_points_d(N, D);
+    kd = build_tree(ct, data, N, D, Nleaf, KDTT_DUU,
+                    KD_BUILD_SPLIT | KD_BUILD_BBOX | KD_BUILD_VEB_LAYOUT);
+    kd->name = strdup("cobweb");
+    CuAssert(ct, "veb", kdtree_has_veb_layout(kd));
+
+    sprintf(fn, "/tmp/test_libkd_io_veb_tree.XXXXXX");
+    fd = mkstemp(fn);
+    if (fd == -1) {
+        fprintf(stderr, "Failed to generate a temp filename: %s\n", strerror(errno));
+        CuFail(ct, "mkstemp");
+    }
+    close(fd);
+    printf("vEB tree: writing to file %s.\n", fn);
+
+    rtn = kdtree_fits_write(kd, fn, NULL);
+    CuAssertIntEquals(ct, 0, rtn);
+
+    kd2 = kdtree_fits_read(fn, "cobweb", NULL);
+    assert_kdtrees_equal(ct, kd, kd2);
+    CuAssertIntEquals(ct, 0, kdtree_check(kd2));
+
+    for (q=0; q<20; q++) {
+        double query[3];
+        double d1, d2;
+        int d;
+        for (d=0; d<D; d++)
+            query[d] = rand() / (double)RAND_MAX;
+        CuAssertIntEquals(ct, kdtree_nearest_neighbour(kd, query, &d1),
+                          kdtree_nearest_neighbour(kd2, query, &d2));
+        CuAssertDblEquals(ct, d1, d2, 0.0);
+    }
+
+    free(data);
+    kdtree_free(kd);
+    kdtree_fits_close(kd2);
+}
+
+// Readers from before vEB order ignore the KDT_VEB card: they must not
+// find heap-order tables in a vEB tree's file.
+void test_veb_tree_refused_by_old_readers(CuTest* ct) {
+    kdtree_t* kd;
+    double * data;
+    int N = 1000;
+    int D = 3;
+    char fn[1024];
+    int fd;
+    FILE* f;
+    char* buf;
+    long sz;
+    long i;
+    int nfound = 0;
+
+    data = random_points_d(N, D);
+    kd = build_tree(ct, data, N, D, 5, KDTT_DUU,
+                    KD_BUILD_SPLIT | KD_BUILD_BBOX | KD_BUILD_VEB_LAYOUT);
+    kd->name = strdup("cobweb");
+
+    sprintf(fn, "/tmp/test_libkd_io_veb_old.XXXXXX");
+    fd = mkstemp(fn);
+    if (fd == -1) {
+        fprintf(stderr, "Failed to generate a temp filename: %s\n", strerror(errno));
+        CuFail(ct, "mkstemp");
+    }
+    close(fd);
+    CuAssertIntEquals(ct, 0, kdtree_fits_write(kd, fn, NULL));
+
+    // read it as an old reader would: as though KDT_VEB were F.
+    f = fopen(fn, "r+b");
+    CuAssertPtrNotNull(ct, f);
+    fseek(f, 0, SEEK_END);
+    sz = ftell(f);
+    buf = malloc(sz);
+    fseek(f, 0, SEEK_SET);
+    CuAssertIntEquals(ct, 1, fread(buf, sz, 1, f));
+    for (i=0; i+80<=sz; i+=80) {
+        if (strncmp(buf + i, "KDT_VEB =", 9))
+            continue;
+        CuAssertIntEquals(ct, 'T', buf[i + 29]);
+        buf[i + 29] = 'F';
+        nfound++;
+    }
+    CuAssertIntEquals(ct, 1, nfound);
+    fseek(f, 0, SEEK_SET);
+    CuAssertIntEquals(ct, 1, fwrite(buf, sz, 1, f));
+    CuAssertIntEquals(ct, 0, fclose(f));
+    free(buf);
+
+    CuAssertPtrEquals(ct, NULL, kdtree_fits_read(fn, "cobweb", NULL));
+
+    unlink(fn);
+    free(data);
+    kdtree_free(kd);
+}
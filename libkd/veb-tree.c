@@ -0,0 +1,218 @@
+/*
+# This file is part of libkd.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+
+/*
+ Rewrites the kdtrees in a FITS file (eg, an index file, which holds a
+ star tree and a code tree) in van Emde Boas node order.  Extensions
+ that aren't part of a kdtree are copied verbatim.  The rewritten node
+ tables have new names (KD_STR_BB_VEB etc), so versions of libkd that
+ predate this order can't read the output.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kdtree.h"
+#include "kdtree_fits_io.h"
+#include "ioutils.h"
+#include "fitsioutils.h"
+#include "errors.h"
+#include "anqfits.h"
+
+static void printHelp(char* progname) {
+	printf("\nUsage: %s [-v] <input> <output>\n"
+		   "\n", progname);
+}
+
+static const char* OPTIONS = "hv";
+
+// Replaces a (possibly mmapped, read-only) array by a private copy.
+static void* copy_array(const void* arr, size_t sz) {
+    void* copy;
+    if (!arr)
+        return NULL;
+    copy = malloc(sz);
+    if (!copy) {
+        SYSERROR("Failed to allocate %zu bytes", sz);
+        exit(-1);
+    }
+    memcpy(copy, arr, sz);
+    return copy;
+}
+
+static int convert_tree(kdtree_fits_t* io, const char* treename, FILE* fout,
+                        anbool verbose) {
+    kdtree_t* kd;
+    qfits_header* hdr;
+    qfits_header* outhdr;
+    void *bb, *split, *splitdim;
+    int i;
+
+    kd = kdtree_fits_read_tree(io, treename, &hdr);
+    if (!kd) {
+        ERROR("Failed to read kdtree \"%s\"", treename ? treename : "");
+        return -1;
+    }
+    if (verbose)
+        printf("Tree \"%s\": %i points, %i dims, %i nodes%s\n",
+               treename ? treename : "", kd->ndata, kd->ndim, kd->nnodes,
+               kdtree_has_veb_layout(kd) ? " (already in vEB order)" : "");
+
+    if (kd->bb.any && kdtree_has_old_bb(kd)) {
+        ERROR("kdtree \"%s\" has an old-style bounding-box array; run fix-bb first",
+              treename ? treename : "");
+        return -1;
+    }
+
+    bb       = kd->bb.any = copy_array(kd->bb.any, 2 * kdtree_sizeof_bb(kd));
+    split    = kd->split.any = copy_array(kd->split.any, kdtree_sizeof_split(kd));
+    splitdim = kd->splitdim = copy_array(kd->splitdim, kdtree_sizeof_splitdim(kd));
+
+    if (kdtree_set_veb_layout(kd)) {
+        ERROR("Failed to rearrange kdtree \"%s\"", treename ? treename : "");
+        return -1;
+    }
+    if (kdtree_check(kd)) {
+        ERROR("kdtree_check failed for rearranged tree \"%s\"",
+              treename ? treename : "");
+        return -1;
+    }
+
+    // keep the non-kdtree cards; the kdtree writer adds its own.
+    outhdr = qfits_header_new();
+    for (i=0; i<qfits_header_n(hdr); i++) {
+        char key[FITS_LINESZ+1];
+        char val[FITS_LINESZ+1];
+        char com[FITS_LINESZ+1];
+        qfits_header_getitem(hdr, i, key, val, com, NULL);
+        if (fits_is_primary_header(key) || fits_is_table_header(key) ||
+            starts_with(key, "KDT_") || !strcmp(key, "ENDIAN"))
+            continue;
+        qfits_header_append(outhdr, key, val, com, NULL);
+    }
+    if (kdtree_fits_append_tree_to(kd, outhdr, fout) ||
+        fits_pad_file(fout)) {
+        ERROR("Failed to write kdtree \"%s\"", treename ? treename : "");
+        return -1;
+    }
+    qfits_header_destroy(outhdr);
+    qfits_header_destroy(hdr);
+
+    free(bb);
+    free(split);
+    free(splitdim);
+    // the io handle is shared with the other trees in the file.
+    free(kd->name);
+    free(kd->nodemap);
+    free(kd->splitmap);
+    free(kd);
+    return 0;
+}
+
+int main(int argc, char** args) {
+    int argchar;
+	char* progname = args[0];
+	char* infn;
+	char* outfn;
+    FILE* fin;
+    FILE* fout;
+    anqfits_t* anq;
+    kdtree_fits_t* io;
+    anbool verbose = FALSE;
+    int ext, Next;
+    int ntrees = 0;
+
+    while ((argchar = getopt(argc, args, OPTIONS)) != -1)
+        switch (argchar) {
+        case 'v':
+            verbose = TRUE;
+            break;
+		case 'h':
+		default:
+			printHelp(progname);
+			exit(-1);
+		}
+
+    if (optind != argc - 2) {
+        printHelp(progname);
+        exit(-1);
+    }
+    infn = args[optind];
+    outfn = args[optind+1];
+
+    if (!strcmp(infn, outfn)) {
+        printf("Sorry, in-place modification of files is not supported.\n");
+        exit(-1);
+    }
+
+    anq = anqfits_open(infn);
+    if (!anq) {
+        ERROR("Failed to open input file %s", infn);
+        exit(-1);
+    }
+    io = kdtree_fits_open(infn);
+    if (!io) {
+        ERROR("Failed to open input file %s for reading kdtrees", infn);
+        exit(-1);
+    }
+    fin = fopen(infn, "rb");
+    if (!fin) {
+        SYSERROR("Failed to open input file %s", infn);
+        exit(-1);
+    }
+    fout = fopen(outfn, "wb");
+    if (!fout) {
+        SYSERROR("Failed to open output file %s", outfn);
+        exit(-1);
+    }
+
+    Next = anqfits_n_ext(anq);
+    for (ext=0; ext<Next; ext++) {
+        if (ext > 0 && anqfits_is_table(anq, ext)) {
+            const qfits_table* table = anqfits_get_table_const(anq, ext);
+            if (table && (table->nc == 1) &&
+                kdtree_fits_column_is_kdtree((char*)table->col[0].tlabel)) {
+                const char* label = table->col[0].tlabel;
+                const char* treename = NULL;
+                // every tree is written where its header chunk was; its
+                // other chunks are skipped.
+                if (!starts_with(label, KD_STR_HEADER))
+                    continue;
+                if (label[strlen(KD_STR_HEADER)] == '_')
+                    treename = label + strlen(KD_STR_HEADER) + 1;
+                if (convert_tree(io, treename, fout, verbose))
+                    exit(-1);
+                ntrees++;
+                continue;
+            }
+        }
+        if (verbose)
+            printf("Extension %i is not part of a kdtree.  Copying it verbatim.\n", ext);
+        if (pipe_file_offset(fin, anqfits_header_start(anq, ext),
+                             anqfits_header_size(anq, ext), fout) ||
+            pipe_file_offset(fin, anqfits_data_start(anq, ext),
+                             anqfits_data_size(anq, ext), fout)) {
+            ERROR("Failed to write extension %i verbatim", ext);
+            exit(-1);
+        }
+    }
+
+    fclose(fin);
+    if (fclose(fout)) {
+        SYSERROR("Failed to close output file %s", outfn);
+        exit(-1);
+    }
+    kdtree_fits_io_close(io);
+    anqfits_close(anq);
+
+    if (!ntrees) {
+        ERROR("No kdtrees found in %s", infn);
+        exit(-1);
+    }
+    printf("Rearranged %i kdtree%s into %s\n", ntrees, (ntrees == 1 ? "" : "s"),
+           outfn);
+	return 0;
+}
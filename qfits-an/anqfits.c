@@ -67,6 +67,39 @@ int fits_get_atom_size(tfits_type type) {
 	return atomsize;
 }
 
+// Unscaled conversion between numeric types, one loop per pair of
+// types so that the compiler can keep each loop tight.
+#define CONVERT_LOOP(ST, DT)                                        \
+    for (i=0; i<N; i++) {                                           \
+        for (j=0; j<arraysize; j++) {                               \
+            ST sv;                                                  \
+            DT dv;                                                  \
+            memcpy(&sv, src + j * sizeof(ST), sizeof(ST));          \
+            dv = sv;                                                \
+            memcpy(dest + j * sizeof(DT), &dv, sizeof(DT));         \
+        }                                                           \
+        dest += deststride;                                         \
+        src  +=  srcstride;                                         \
+    }                                                               \
+    return 0
+
+#define CONVERT_FROM(ST)                                            \
+    switch (desttype) {                                             \
+    case TFITS_BIN_TYPE_I: CONVERT_LOOP(ST, int16_t);               \
+    case TFITS_BIN_TYPE_J: CONVERT_LOOP(ST, int32_t);               \
+    case TFITS_BIN_TYPE_K: CONVERT_LOOP(ST, int64_t);               \
+    case TFITS_BIN_TYPE_E: CONVERT_LOOP(ST, float);                 \
+    case TFITS_BIN_TYPE_D: CONVERT_LOOP(ST, double);                \
+    default: break;                                                 \
+    }                                                               \
+    break
+
+static int is_numeric_type(tfits_type t) {
+    return (t == TFITS_BIN_TYPE_I || t == TFITS_BIN_TYPE_J ||
+            t == TFITS_BIN_TYPE_K || t == TFITS_BIN_TYPE_E ||
+            t == TFITS_BIN_TYPE_D);
+}
+
 int fits_convert_data_2(void* vdest, int deststride, tfits_type desttype,
                         const void* vsrc, int srcstride, tfits_type srctype,
                         int arraysize, size_t N,
@@ -79,6 +112,17 @@ int fits_convert_data_2(void* vdest, int deststride, tfits_type desttype,
     int srcatomsize = fits_get_atom_size(srctype);
     anbool scaling = (bzero != 0.0) || (bscale != 1.0);
 
+    if (!scaling && is_numeric_type(srctype) && is_numeric_type(desttype)) {
+        switch (srctype) {
+        case TFITS_BIN_TYPE_I: CONVERT_FROM(int16_t);
+        case TFITS_BIN_TYPE_J: CONVERT_FROM(int32_t);
+        case TFITS_BIN_TYPE_K: CONVERT_FROM(int64_t);
+        case TFITS_BIN_TYPE_E: CONVERT_FROM(float);
+        case TFITS_BIN_TYPE_D: CONVERT_FROM(double);
+        default: break;
+        }
+    }
+
     // this loop is over rows of data
     for (i=0; i<N; i++) {
         // store local pointers so we can stride over the array, without
@@ -176,6 +220,8 @@ int fits_convert_data_2(void* vdest, int deststride, tfits_type desttype,
     }
     return 0;
 }
+#undef CONVERT_FROM
+#undef CONVERT_LOOP
 
 
 int fits_convert_data(void* vdest, int deststride, tfits_type desttype,
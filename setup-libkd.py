@@ -9,7 +9,7 @@ inc = ['include', 'include/astrometry', 'util', 'qfits-an']
 libkd_srcs = [
     'pyspherematch.c',
     'dualtree.c', 'dualtree_rangesearch.c', 'dualtree_nearestneighbour.c',
-    'kdtree.c', 'kdtree_dim.c', 'kdtree_mem.c',
+    'kdtree.c', 'kdtree_dim.c', 'kdtree_mem.c', 'kdtree_leaf.c',
     'kdtree_fits_io.c',
     'kdint_ddd.c',
     'kdint_fff.c',
@@ -0,0 +1,136 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+*/
+
+/*
+ Benchmark for the vectorized dsmooth2 kernels: smooths random float
+ and int16 images of a few sizes with a few PSF widths, with each
+ kernel the CPU supports, and reports the time, the speedup over the
+ scalar loops (ie, the original dsmooth2), and the largest difference
+ from the scalar result.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "os-features.h"
+#include "dimage.h"
+#include "tic.h"
+
+static const char* OPTIONS = "hs:p:r:t:";
+
+static void printHelp(char* progname) {
+	printf("Usage: %s\n"
+		   "   [-s <image width and height, pixels>] (default: 512, 2048 and 4096)\n"
+		   "   [-p <dpsf, pixels>] (default: 1, 2 and 4)\n"
+		   "   [-r <repeats>] (default 3; the best time is reported)\n"
+		   "   [-t <threads>] (default 1)\n"
+		   "\n", progname);
+}
+
+static const char* kernel_name(int k) {
+	switch (k) {
+	case DSMOOTH_SCALAR: return "scalar";
+	case DSMOOTH_SSE2:   return "sse2";
+	case DSMOOTH_AVX2:   return "avx2";
+	}
+	return "?";
+}
+
+static double run(int kernel, float* img, int16_t* img16,
+				  int N, float sigma, int nthreads, int repeats, float* smooth) {
+	double best = 1e30;
+	int r;
+	dsmooth2_set_kernel(kernel);
+	for (r=0; r<repeats; r++) {
+		double t0 = timenow();
+		if (img16)
+			dsmooth2_i16_threads(img16, N, N, sigma, smooth, nthreads);
+		else
+			dsmooth2_threads(img, N, N, sigma, smooth, nthreads);
+		best = MIN(best, timenow() - t0);
+	}
+	return best;
+}
+
+int main(int argc, char** argv) {
+	int argchar;
+	int sizes[] = { 512, 2048, 4096 };
+	float dpsfs[] = { 1.0, 2.0, 4.0 };
+	int nsizes = sizeof(sizes) / sizeof(int);
+	int ndpsfs = sizeof(dpsfs) / sizeof(float);
+	int repeats = 3;
+	int nthreads = 1;
+	int best = dsmooth2_best_kernel();
+	int s, p, t, k;
+	size_t i;
+
+	while ((argchar = getopt(argc, argv, OPTIONS)) != -1)
+		switch (argchar) {
+		case 's':
+			sizes[0] = atoi(optarg);
+			nsizes = 1;
+			break;
+		case 'p':
+			dpsfs[0] = atof(optarg);
+			ndpsfs = 1;
+			break;
+		case 'r':
+			repeats = atoi(optarg);
+			break;
+		case 't':
+			nthreads = atoi(optarg);
+			break;
+		case 'h':
+		default:
+			printHelp(argv[0]);
+			exit(-1);
+		}
+
+	printf("Best kernel: %s; %i thread%s.\n", kernel_name(best), nthreads,
+		   (nthreads == 1) ? "" : "s");
+	srand(0);
+	for (s=0; s<nsizes; s++) {
+		int N = sizes[s];
+		size_t npix = (size_t)N * N;
+		float* img = malloc(npix * sizeof(float));
+		int16_t* img16 = malloc(npix * sizeof(int16_t));
+		float* ref = malloc(npix * sizeof(float));
+		float* smooth = malloc(npix * sizeof(float));
+		for (i=0; i<npix; i++) {
+			img16[i] = (rand() % 4000) - 1000;
+			img[i] = img16[i] + rand() / (float)RAND_MAX;
+		}
+		for (p=0; p<ndpsfs; p++) {
+			for (t=0; t<2; t++) {
+				int16_t* in16 = (t ? img16 : NULL);
+				double tscalar;
+				printf("%5i x %-5i dpsf %4.1f %-5s:", N, N, dpsfs[p],
+					   t ? "int16" : "float");
+				tscalar = run(DSMOOTH_SCALAR, img, in16, N, dpsfs[p], nthreads,
+							  repeats, ref);
+				printf("  scalar %7.3f s", tscalar);
+				for (k=DSMOOTH_SCALAR+1; k<=best; k++) {
+					double tk = run(k, img, in16, N, dpsfs[p], nthreads,
+									repeats, smooth);
+					float maxdiff = 0.0;
+					for (i=0; i<npix; i++)
+						maxdiff = MAX(maxdiff, fabsf(ref[i] - smooth[i]));
+					printf("  %s %7.3f s (x%.2f, diff %.2g)", kernel_name(k), tk,
+						   tscalar / tk, maxdiff);
+				}
+				printf("\n");
+			}
+		}
+		free(img);
+		free(img16);
+		free(ref);
+		free(smooth);
+	}
+	dsmooth2_set_kernel(-1);
+	return 0;
+}
@@ -37,6 +37,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "ctmf.h"
+#include "dimage.h"
+
 /* Type declarations */
 #ifdef _MSC_VER
 #include <basetsd.h>
@@ -409,3 +412,91 @@ void ctmf(
         }
     }
 }
+
+struct ctmf_stripes_args {
+    const unsigned char* src;
+    unsigned char* dst;
+    int height, src_step, dst_step, r, cn;
+    const int* start;
+    const int* width;
+    int last;
+};
+
+static void ctmf_stripes( void* varg, int lo, int hi )
+{
+    struct ctmf_stripes_args* a = varg;
+    int k;
+    for ( k = lo; k < hi; ++k ) {
+        ctmf_helper( a->src + a->cn*a->start[k], a->dst + a->cn*a->start[k],
+                a->width[k], a->height, a->src_step, a->dst_step, a->r, a->cn,
+                k == 0, k == a->last );
+    }
+}
+
+void ctmf_threads(
+        const unsigned char* const src, unsigned char* const dst,
+        const int width, const int height,
+        const int src_step, const int dst_step,
+        const int r, const int cn, const long unsigned int memsize,
+        const int nthreads
+        )
+{
+    /*
+     * Same as ctmf(), but the stripes are handed out to threads.  Each
+     * stripe only writes the columns whose whole kernel lies inside it
+     * (or that are at the image edge), and computes exactly the median
+     * there, so the result doesn't depend on the stripe layout.  If
+     * there are fewer stripes than threads, the stripes are narrowed
+     * (as long as they stay wide compared with the kernel).
+     */
+    struct ctmf_stripes_args args;
+    int stripes = (int) ceil( (double) (width - 2*r) / (memsize / sizeof(Histogram) - 2*r) );
+    int stripe_size = (int) ceil( (double) ( width + stripes*2*r - 2*r ) / stripes );
+    int* starts;
+    int* widths;
+    int n = 0;
+    int i;
+
+    if ( nthreads <= 1 ) {
+        ctmf( src, dst, width, height, src_step, dst_step, r, cn, memsize );
+        return;
+    }
+    if ( stripes < nthreads ) {
+        int size = (int) ceil( (double) ( width + nthreads*2*r - 2*r ) / nthreads );
+        if ( size >= 6*r + 3 ) {
+            stripes = nthreads;
+            stripe_size = size;
+        }
+    }
+
+    starts = (int*) malloc( (stripes + 1) * sizeof(int) );
+    widths = (int*) malloc( (stripes + 1) * sizeof(int) );
+    for ( i = 0; i < width; i += stripe_size - 2*r ) {
+        int stripe = stripe_size;
+        /* Make sure that the filter kernel fits into one stripe. */
+        if ( i + stripe_size - 2*r >= width || width - (i + stripe_size - 2*r) < 2*r+1 ) {
+            stripe = width - i;
+        }
+        starts[n] = i;
+        widths[n] = stripe;
+        n++;
+        if ( stripe == width - i ) {
+            break;
+        }
+    }
+
+    args.src = src;
+    args.dst = dst;
+    args.height = height;
+    args.src_step = src_step;
+    args.dst_step = dst_step;
+    args.r = r;
+    args.cn = cn;
+    args.start = starts;
+    args.width = widths;
+    args.last = n - 1;
+    dparallel( nthreads, n, ctmf_stripes, &args );
+
+    free( starts );
+    free( widths );
+}
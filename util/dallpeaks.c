@@ -15,6 +15,7 @@
 #include "simplexy-common.h"
 #include "log.h"
 #include "mathutil.h"
+#include "bl.h"
 
 /*
  * dallpeaks.c
@@ -119,12 +120,44 @@ static int max_gaussian(float* image, int W, int H, float sigma,
 }
 
 
+// cutout and peak buffers, reused from object to object.
+struct dallpeaks_scratch {
+	float* oimage;
+	float* simage;
+	int npix;
+	int* xc;
+	int* yc;
+};
+
 #define IMGTYPE float
 #define SUFFIX
 #include "dallpeaks.inc"
 #undef SUFFIX
 #undef IMGTYPE
 
+int dallpeaks_object(float *image, const int *object, int label,
+					 int xmin, int xmax, int ymin, int ymax,
+					 float dpsf, float sigma, float dlim, float saddle,
+					 int maxper, float minpeak, int maxsize, int nmax,
+					 float *xcen, float *ycen) {
+	struct dallpeaks_scratch scratch;
+	int n;
+
+	if (!object_size_ok(label, xmin, xmax, ymin, ymax, maxsize))
+		return 0;
+	memset(&scratch, 0, sizeof(scratch));
+	scratch.xc = malloc(sizeof(int) * maxper);
+	scratch.yc = malloc(sizeof(int) * maxper);
+	n = object_peaks(image, xmax - xmin + 1, xmin, ymin, object, label,
+					 xmin, xmax, ymin, ymax, dpsf, sigma, dlim, saddle,
+					 maxper, minpeak, nmax, xcen, ycen, &scratch);
+	FREEVEC(scratch.oimage);
+	FREEVEC(scratch.simage);
+	FREEVEC(scratch.xc);
+	FREEVEC(scratch.yc);
+	return n;
+}
+
 #define IMGTYPE uint8_t
 #define SUFFIX _u8
 #include "dallpeaks.inc"
@@ -11,7 +11,6 @@
 
 #include "simplexy-common.h"
 #include "dimage.h"
-#include "bl.h"
 
 /*
  * dfind.c
@@ -80,30 +79,22 @@ dimage_label_t collapsing_find_minlabel(dimage_label_t label,
 	return min;
 }
 
-static dimage_label_t relabel_image(il* on_pixels,
-                             int maxlabel,
-                             dimage_label_t* equivs,
-                             int* object) {
-    int i;
-	dimage_label_t maxcontiguouslabel = 0;
-	dimage_label_t *number;
-	number = malloc(sizeof(dimage_label_t) * maxlabel);
-	assert(number);
-	for (i = 0; i < maxlabel; i++)
-		number[i] = LABEL_MAX;
-	for (i=0; i<il_size(on_pixels); i++) {
-        int onpix;
-		int minlabel;
-        onpix = il_get(on_pixels, i);
-        minlabel = collapsing_find_minlabel(object[onpix], equivs);
-		if (number[minlabel] == LABEL_MAX)
-			number[minlabel] = maxcontiguouslabel++;
-        object[onpix] = number[minlabel];
+// Union-find root, halving the path as it goes.
+static int dfind_root(int* parent, int g) {
+	while (parent[g] != g) {
+		parent[g] = parent[parent[g]];
+		g = parent[g];
 	}
-	free(number);
-    return maxcontiguouslabel;
+	return g;
 }
 
+// A run of 'on' pixels in a row, [xlo, xhi], and its provisional label.
+struct dfind_run {
+	int xlo;
+	int xhi;
+	int label;
+};
+
 // Yummy preprocessor templating goodness!
 
 #define DFIND2 dfind2
@@ -118,3 +109,133 @@ static dimage_label_t relabel_image(il* on_pixels,
 #undef DFIND2
 #undef IMGTYPE
 
+
+/*
+ Threaded connected components: each slice of rows is labelled on its
+ own with dfind2_u8(), then the labels that touch across the seams
+ between slices are merged.  A slice's labels are numbered in order of
+ their first pixel, and the slices are in order, so taking the merged
+ groups in order of their smallest (slice, label) gives exactly the
+ numbering that dfind2_u8() produces for the whole image.
+ */
+struct dfind_slices_args {
+	const unsigned char* image;
+	int nx;
+	int* object;
+	// row at which each slice starts; nslices+1 entries.
+	const int* rows;
+	// labels used in each slice.
+	int* counts;
+	// label offset of each slice.
+	const int* offsets;
+	// final label for each (offset) slice label.
+	const int* number;
+};
+
+static void dfind_label_slices(void* varg, int lo, int hi) {
+	struct dfind_slices_args* args = varg;
+	int k;
+	for (k=lo; k<hi; k++) {
+		int r0 = args->rows[k];
+		int r1 = args->rows[k+1];
+		dfind2_u8(args->image + (size_t)r0 * args->nx, args->nx, r1 - r0,
+				  args->object + (size_t)r0 * args->nx, args->counts + k);
+	}
+}
+
+static void dfind_relabel_slices(void* varg, int lo, int hi) {
+	struct dfind_slices_args* args = varg;
+	int k;
+	size_t i;
+	for (k=lo; k<hi; k++) {
+		const int* number = args->number + args->offsets[k];
+		for (i = (size_t)args->rows[k] * args->nx;
+			 i < (size_t)args->rows[k+1] * args->nx; i++)
+			if (args->object[i] != -1)
+				args->object[i] = number[args->object[i]];
+	}
+}
+
+int dfind2_u8_threads(const unsigned char* image,
+					  int nx,
+					  int ny,
+					  int* object,
+					  int* pnobjects,
+					  int nthreads) {
+	struct dfind_slices_args args;
+	int nslices = dparallel_nslices(nthreads, ny);
+	int *rows, *counts, *offsets, *parent, *number;
+	int k, ix, i, g, total, nobj;
+
+	if (nslices == 1)
+		return dfind2_u8(image, nx, ny, object, pnobjects);
+
+	rows = malloc((nslices + 1) * sizeof(int));
+	counts = malloc(nslices * sizeof(int));
+	offsets = malloc(nslices * sizeof(int));
+	for (k=0; k<=nslices; k++)
+		rows[k] = (int)((long)ny * k / nslices);
+
+	args.image = image;
+	args.nx = nx;
+	args.object = object;
+	args.rows = rows;
+	args.counts = counts;
+	args.offsets = offsets;
+	dparallel(nslices, nslices, dfind_label_slices, &args);
+
+	total = 0;
+	for (k=0; k<nslices; k++) {
+		offsets[k] = total;
+		total += counts[k];
+	}
+
+	// union-find over all the slices' labels, keeping the smallest as root.
+	parent = malloc(MAX(1, total) * sizeof(int));
+	for (g=0; g<total; g++)
+		parent[g] = g;
+	for (k=1; k<nslices; k++) {
+		int r = rows[k];
+		for (ix=0; ix<nx; ix++) {
+			int a;
+			if (!image[(size_t)r*nx + ix])
+				continue;
+			a = offsets[k] + object[(size_t)r*nx + ix];
+			for (i = MAX(0, ix - 1); i <= MIN(ix + 1, nx - 1); i++) {
+				int b, ra, rb;
+				if (!image[(size_t)(r-1)*nx + i])
+					continue;
+				b = offsets[k-1] + object[(size_t)(r-1)*nx + i];
+				ra = dfind_root(parent, a);
+				rb = dfind_root(parent, b);
+				if (ra < rb)
+					parent[rb] = ra;
+				else if (rb < ra)
+					parent[ra] = rb;
+			}
+		}
+	}
+	// number the groups in order of their roots (a root comes before
+	// the rest of its group).
+	number = malloc(MAX(1, total) * sizeof(int));
+	nobj = 0;
+	for (g=0; g<total; g++) {
+		int root = dfind_root(parent, g);
+		if (root == g)
+			number[g] = nobj++;
+		else
+			number[g] = number[root];
+	}
+
+	args.number = number;
+	dparallel(nslices, nslices, dfind_relabel_slices, &args);
+	if (pnobjects)
+		*pnobjects = nobj;
+
+	free(number);
+	free(parent);
+	free(offsets);
+	free(counts);
+	free(rows);
+	return 1;
+}
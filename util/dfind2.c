@@ -12,99 +12,128 @@
 #include "errors.h"
 #include "log.h"
 
+/*
+ Two passes over runs of 'on' pixels.  The first finds each row's runs,
+ gives each run a provisional label and merges it (union-find) with the
+ runs it touches in the row above; a group's root is its smallest
+ label, which is that of its first run.  The second numbers the groups
+ in order of their roots -- the raster order of their first pixels --
+ and writes the object image a row at a time.
+ */
 int DFIND2(const IMGTYPE* image,
            int nx,
            int ny,
            int* object,
 		   int* pnobjects) {
-	int ix, iy, i;
-	int maxgroups = initial_max_groups;
-	dimage_label_t *equivs = malloc(sizeof(dimage_label_t) * maxgroups);
-	int maxlabel = 0;
-
-	/* Keep track of 'on' pixels to avoid later rescanning */
-    il* on_pixels = il_new(256);
+	int ix, iy;
+	int maxgroups = MAX(1, initial_max_groups);
+	// union-find parent of each provisional label.
+	int* parent = malloc(sizeof(int) * maxgroups);
+	int nlabels = 0;
+	struct dfind_run* runs;
+	size_t nruns = 0;
+	size_t maxruns = 256;
+	// where each row's runs start; ny+1 entries.
+	size_t* rowruns = malloc(sizeof(size_t) * (ny + 1));
+	int* number;
+	int g, nobj;
+	size_t r;
+
+	runs = malloc(sizeof(struct dfind_run) * maxruns);
 
-	/* Find blobs and track equivalences */
 	for (iy = 0; iy < ny; iy++) {
-		for (ix = 0; ix < nx; ix++) {
-			int thislabel, thislabelmin;
-
-			object[nx*iy+ix] = -1;
-			if (!image[nx*iy+ix])
-				continue;
-
-			/* Store location of each 'on' pixel. */
-            il_append(on_pixels, nx * iy + ix);
-
-            /* If the pixel to the left [exists and] is on, this pixel
-             joins its group. */
-			if (ix && image[nx*iy+ix-1]) {
-				/* Old group */
-				object[nx*iy+ix] = object[nx*iy+ix-1];
-
-			} else {
+		const IMGTYPE* row = image + (size_t)nx * iy;
+		// runs of the row above.
+		size_t p = (iy ? rowruns[iy-1] : 0);
+		size_t pend = nruns;
+		rowruns[iy] = nruns;
+		ix = 0;
+		while (ix < nx) {
+			int xa, label;
+			size_t q;
+			if (sizeof(IMGTYPE) == 1) {
+				// skip blank stretches of a mask a word at a time.
+				uint64_t word;
+				while (ix + 8 <= nx) {
+					memcpy(&word, row + ix, 8);
+					if (word)
+						break;
+					ix += 8;
+				}
+			}
+			while (ix < nx && !row[ix])
+				ix++;
+			if (ix == nx)
+				break;
+			xa = ix;
+			while (ix < nx && row[ix])
+				ix++;
+			// this run is [xa, ix-1]; runs above it that touch it,
+			// diagonals included, overlap [xa-1, ix].
+			label = -1;
+			while (p < pend && runs[p].xhi < xa - 1)
+				p++;
+			for (q = p; q < pend && runs[q].xlo <= ix; q++) {
+				int other = dfind_root(parent, runs[q].label);
+				if (label == -1)
+					label = other;
+				else if (other < label) {
+					parent[label] = other;
+					label = other;
+				} else if (other > label)
+					parent[other] = label;
+			}
+			if (label == -1) {
 				/* New blob */
-				// FIXME this part should become uf_new_group()
-				if (maxlabel >= maxgroups) {
+				if (nlabels >= maxgroups) {
 					maxgroups *= 2;
-					equivs = realloc(equivs, sizeof(dimage_label_t) * maxgroups);
-					assert(equivs);
-				}
-				object[nx*iy+ix] = maxlabel;
-				equivs[maxlabel] = maxlabel;
-				maxlabel++;
-
-				if (maxlabel == LABEL_MAX) {
-                    logverb("Ran out of labels.  Relabelling...\n");
-                    maxlabel = relabel_image(on_pixels, maxlabel, equivs, object);
-                    logverb("After relabelling, we need %i labels\n", maxlabel);
-                    if (maxlabel == LABEL_MAX) {
-                        ERROR("Ran out of labels.");
-                        exit(-1);
-                    }
+					parent = realloc(parent, sizeof(int) * maxgroups);
+					assert(parent);
 				}
+				parent[nlabels] = nlabels;
+				label = nlabels++;
 			}
-
-			thislabel  = object[nx*iy + ix];
-
-			/* Compute minimum equivalence label for this pixel */
-			thislabelmin = collapsing_find_minlabel(thislabel, equivs);
-
-			if (iy == 0)
-				continue;
-
-			/* Check three pixels above this one which are 'neighbours' */
-			for (i = MAX(0, ix - 1); i <= MIN(ix + 1, nx - 1); i++) {
-				if (image[nx*(iy-1)+i]) {
-					int otherlabel = object[nx*(iy-1) + i];
-
-					/* Find min of the other */
-					int otherlabelmin = collapsing_find_minlabel(otherlabel, equivs);
-
-					/* Merge groups if necessary */
-					if (thislabelmin != otherlabelmin) {
-						int oldlabelmin = MAX(thislabelmin, otherlabelmin);
-						int newlabelmin = MIN(thislabelmin, otherlabelmin);
-						thislabelmin = newlabelmin;
-						equivs[oldlabelmin] = newlabelmin;
-						equivs[thislabel] = newlabelmin;
-						/* Update other pixel too */
-						object[nx*(iy-1) + i] = newlabelmin;
-					} 
-				}
+			if (nruns == maxruns) {
+				maxruns *= 2;
+				runs = realloc(runs, sizeof(struct dfind_run) * maxruns);
+				assert(runs);
 			}
-			object[nx*iy + ix] = thislabelmin;
+			runs[nruns].xlo = xa;
+			runs[nruns].xhi = ix - 1;
+			runs[nruns].label = label;
+			nruns++;
 		}
 	}
+	rowruns[ny] = nruns;
+
+	/* Number the groups in order of their roots (a root comes before
+	 the rest of its group) */
+	number = malloc(sizeof(int) * MAX(1, nlabels));
+	nobj = 0;
+	for (g = 0; g < nlabels; g++) {
+		int root = dfind_root(parent, g);
+		if (root == g)
+			number[g] = nobj++;
+		else
+			number[g] = number[root];
+	}
 
-	/* Re-label the groups before returning */
-    maxlabel = relabel_image(on_pixels, maxlabel, equivs, object);
-    //logverb("After final relabelling, %i labels were used.\n", maxlabel);
+	for (iy = 0; iy < ny; iy++) {
+		int* orow = object + (size_t)nx * iy;
+		for (ix = 0; ix < nx; ix++)
+			orow[ix] = -1;
+		for (r = rowruns[iy]; r < rowruns[iy+1]; r++) {
+			int lab = number[runs[r].label];
+			for (ix = runs[r].xlo; ix <= runs[r].xhi; ix++)
+				orow[ix] = lab;
+		}
+	}
 	if (pnobjects)
-		*pnobjects = maxlabel;
+		*pnobjects = nobj;
 
-	free(equivs);
-	il_free(on_pixels);
+	free(number);
+	free(rowruns);
+	free(runs);
+	free(parent);
 	return 1;
 }
@@ -11,6 +11,7 @@
 
 #include "os-features.h"
 #include "simplexy-common.h"
+#include "dimage.h"
 
 /*
  * dmedsmooth.c
@@ -22,9 +23,6 @@
  * 1/2006 */
 
 
-float dselip(unsigned long k, unsigned long n, float *arr);
-
-
 int dmedsmooth_gridpoints(int nx, int halfbox, int* p_nxgrid, int** p_xgrid,
                           int** p_xlo, int** p_xhi) {
     int nxgrid;
@@ -54,56 +52,157 @@ int dmedsmooth_gridpoints(int nx, int halfbox, int* p_nxgrid, int** p_xgrid,
     return 0;
 }
 
-int dmedsmooth_grid(const float* image,
-                    const uint8_t *masked,
-                    int nx,
-                    int ny,
-                    int halfbox,
-                    float **p_grid, int** p_xgrid, int** p_ygrid,
-                    int* p_nxgrid, int* p_nygrid) {
-    float* arr = NULL;
-    float* grid = NULL;
-    int *xlo = NULL;
-    int *xhi = NULL;
-    int *ylo = NULL;
-    int *yhi = NULL;
-    int nxgrid, nygrid;
-    int i, j, nb, jp, ip, nm;
+/*
+ The k-th smallest of arr[0..n-1] -- arr[k] after sorting it, which is
+ what dselip() returns -- by partitioning (arr gets reordered).
+ */
+static float select_kth(float* arr, int n, int k) {
+    int lo = 0, hi = n - 1;
+    while (hi > lo + 1) {
+        int mid = (lo + hi) / 2;
+        int i, j;
+        float pivot, t;
+#define SWAPF(a, b) { t = (a); (a) = (b); (b) = t; }
+        // median of arr[lo], arr[mid], arr[hi] as the pivot, in arr[lo+1].
+        SWAPF(arr[mid], arr[lo+1]);
+        if (arr[lo] > arr[hi])
+            SWAPF(arr[lo], arr[hi]);
+        if (arr[lo+1] > arr[hi])
+            SWAPF(arr[lo+1], arr[hi]);
+        if (arr[lo] > arr[lo+1])
+            SWAPF(arr[lo], arr[lo+1]);
+        pivot = arr[lo+1];
+        i = lo + 1;
+        j = hi;
+        for (;;) {
+            do i++; while (arr[i] < pivot);
+            do j--; while (arr[j] > pivot);
+            if (j < i)
+                break;
+            SWAPF(arr[i], arr[j]);
+        }
+        arr[lo+1] = arr[j];
+        arr[j] = pivot;
+        if (j >= k)
+            hi = j - 1;
+        if (j <= k)
+            lo = i;
+    }
+    if (hi == lo + 1 && arr[hi] < arr[lo]) {
+        float t;
+        SWAPF(arr[lo], arr[hi]);
+    }
+#undef SWAPF
+    return arr[k];
+}
 
-    if (dmedsmooth_gridpoints(nx, halfbox, &nxgrid, p_xgrid, &xlo, &xhi)) {
-        return 1;
+/*
+ Tibshirani's "binapprox": the median lies within one standard
+ deviation of the mean, so the values in that range are counted into
+ DMEDSMOOTH_NBINS bins and the center of the bin holding arr[n/2]
+ (sorted) is returned.  "hist" has DMEDSMOOTH_NBINS entries.
+ */
+static float binned_median(const float* arr, int n, int* hist) {
+    // sums of the values minus the first one, to keep the variance
+    // from cancelling away.
+    float x0 = arr[0];
+    // (four sums each, so they can be added up in parallel)
+    double sum[4] = {0, 0, 0, 0};
+    double sumsq[4] = {0, 0, 0, 0};
+    double mean, var, sd, lo, scale;
+    float flo, fscale;
+    int nbelow = 0;
+    int i, k, b, cum;
+
+    for (i=0; i+4<=n; i+=4) {
+        for (k=0; k<4; k++) {
+            double d = arr[i+k] - x0;
+            sum[k] += d;
+            sumsq[k] += d*d;
+        }
     }
-    if (dmedsmooth_gridpoints(ny, halfbox, &nygrid, p_ygrid, &ylo, &yhi)) {
-        FREEVEC(xlo);
-        FREEVEC(xhi);
-        FREEVEC(*p_xgrid);
-        return 1;
+    for (; i<n; i++) {
+        double d = arr[i] - x0;
+        sum[0] += d;
+        sumsq[0] += d*d;
     }
-    *p_nxgrid = nxgrid;
-    *p_nygrid = nygrid;
+    mean = (sum[0] + sum[1] + sum[2] + sum[3]) / n;
+    var = (sumsq[0] + sumsq[1] + sumsq[2] + sumsq[3]) / n - mean*mean;
+    mean += x0;
+    if (var <= 0)
+        return mean;
+    sd = sqrt(var);
+    lo = mean - sd;
+    scale = DMEDSMOOTH_NBINS / (2.0 * sd);
+    flo = lo;
+    fscale = scale;
+    memset(hist, 0, DMEDSMOOTH_NBINS * sizeof(int));
+    for (i=0; i<n; i++) {
+        float d = (arr[i] - flo) * fscale;
+        if (d < 0)
+            nbelow++;
+        else if (d < DMEDSMOOTH_NBINS)
+            hist[(int)d]++;
+        else if (arr[i] <= mean + sd)
+            hist[DMEDSMOOTH_NBINS - 1]++;
+    }
+    k = n / 2;
+    cum = nbelow;
+    for (b=0; b<DMEDSMOOTH_NBINS-1; b++) {
+        cum += hist[b];
+        if (cum > k)
+            break;
+    }
+    return lo + (b + 0.5) / scale;
+}
 
-    /*
-     for (i=0; i<nxgrid; i++)
-     printf("xgrid %i, xlo %i, xhi %i\n", (*p_xgrid)[i], xlo[i], xhi[i]);
-     for (i=0; i<nygrid; i++)
-     printf("ygrid %i, ylo %i, yhi %i\n", (*p_ygrid)[i], ylo[i], yhi[i]);
-     */
+struct medsmooth_grid_args {
+    // image (and mask) rows, starting with row y0.
+    const float* image;
+    const uint8_t* masked;
+    int y0;
+    int nx;
+    int halfbox;
+    // DMEDSMOOTH_EXACT or DMEDSMOOTH_BINNED
+    int method;
+    int nxgrid;
+    const int* xlo;
+    const int* xhi;
+    const int* ylo;
+    const int* yhi;
+    float* grid;
+};
 
-    // the median-filtered image (subsampled on a grid).
-    *p_grid = grid = (float *) malloc((size_t)(nxgrid * nygrid) *
-                                      sizeof(float));
+// Computes rows [jlo, jhi) of the grid of medians.
+static void medsmooth_grid_rows(void* varg, int jlo, int jhi) {
+    struct medsmooth_grid_args* args = varg;
+    const float* image = args->image;
+    const uint8_t* masked = args->masked;
+    const int* xlo = args->xlo;
+    const int* xhi = args->xhi;
+    const int* ylo = args->ylo;
+    const int* yhi = args->yhi;
+    int nx = args->nx;
+    int y0 = args->y0;
+    int nxgrid = args->nxgrid;
+    float* grid = args->grid;
+    float* arr;
+    int* hist = NULL;
+    int i, j, nb, jp, ip, nm;
 
-    arr = (float *) malloc((size_t)((halfbox * 2 + 5) *
-                                    (halfbox * 2 + 5)) * sizeof(float));
+    arr = (float *) malloc((size_t)((args->halfbox * 2 + 5) *
+                                    (args->halfbox * 2 + 5)) * sizeof(float));
+    if (args->method == DMEDSMOOTH_BINNED)
+        hist = malloc(DMEDSMOOTH_NBINS * sizeof(int));
 
-    for (j=0; j<nygrid; j++) {
+    for (j=jlo; j<jhi; j++) {
         for (i=0; i<nxgrid; i++) {
             nb = 0;
             for (jp=ylo[j]; jp<=yhi[j]; jp++) {
-                const float* imageptr = image + xlo[i] + jp * nx;
+                const float* imageptr = image + xlo[i] + (size_t)(jp - y0) * nx;
                 float f;
                 if (masked) {
-                    const uint8_t* maskptr = masked + xlo[i] + jp * nx;
+                    const uint8_t* maskptr = masked + xlo[i] + (size_t)(jp - y0) * nx;
                     for (ip=xlo[i]; ip<=xhi[i]; ip++, imageptr++, maskptr++) {
                         if (*maskptr)
                             continue;
@@ -125,35 +224,160 @@ int dmedsmooth_grid(const float* image,
             }
             if (nb > 1) {
                 nm = nb / 2;
-                grid[i + j*nxgrid] = dselip(nm, nb, arr);
+                if (hist)
+                    grid[i + j*nxgrid] = binned_median(arr, nb, hist);
+                else
+                    // (what dselip() does, but with this thread's own buffer)
+                    grid[i + j*nxgrid] = select_kth(arr, nb, nm);
             } else {
                 //grid[i + j*nxgrid] = image[(long)xlo[i] + ((long)ylo[j]) * nx];
                 grid[i + j*nxgrid] = 0.0;
             }
         }
     }
+    FREEVEC(arr);
+    FREEVEC(hist);
+}
+
+static int medsmooth_grid(const float* image,
+                          const uint8_t *masked,
+                          int nx,
+                          int ny,
+                          int halfbox, int method,
+                          float **p_grid, int** p_xgrid, int** p_ygrid,
+                          int* p_nxgrid, int* p_nygrid, int nthreads) {
+    struct medsmooth_grid_args args;
+    int *xlo = NULL;
+    int *xhi = NULL;
+    int *ylo = NULL;
+    int *yhi = NULL;
+    int nxgrid, nygrid;
+
+    if (dmedsmooth_gridpoints(nx, halfbox, &nxgrid, p_xgrid, &xlo, &xhi)) {
+        return 1;
+    }
+    if (dmedsmooth_gridpoints(ny, halfbox, &nygrid, p_ygrid, &ylo, &yhi)) {
+        FREEVEC(xlo);
+        FREEVEC(xhi);
+        FREEVEC(*p_xgrid);
+        return 1;
+    }
+    *p_nxgrid = nxgrid;
+    *p_nygrid = nygrid;
+
+    /*
+     for (i=0; i<nxgrid; i++)
+     printf("xgrid %i, xlo %i, xhi %i\n", (*p_xgrid)[i], xlo[i], xhi[i]);
+     for (i=0; i<nygrid; i++)
+     printf("ygrid %i, ylo %i, yhi %i\n", (*p_ygrid)[i], ylo[i], yhi[i]);
+     */
+
+    // the median-filtered image (subsampled on a grid).
+    *p_grid = (float *) malloc((size_t)(nxgrid * nygrid) * sizeof(float));
+
+    args.image = image;
+    args.masked = masked;
+    args.y0 = 0;
+    args.nx = nx;
+    args.halfbox = halfbox;
+    args.method = method;
+    args.nxgrid = nxgrid;
+    args.xlo = xlo;
+    args.xhi = xhi;
+    args.ylo = ylo;
+    args.yhi = yhi;
+    args.grid = *p_grid;
+    dparallel(nthreads, nygrid, medsmooth_grid_rows, &args);
+
     FREEVEC(xlo);
     FREEVEC(ylo);
     FREEVEC(xhi);
     FREEVEC(yhi);
-    FREEVEC(arr);
     return 0;
 }
 
-int dmedsmooth_interpolate(const float* grid,
-                           int nx, int ny,
-                           int nxgrid, int nygrid,
-                           const int* xgrid, const int* ygrid,
-                           int halfbox,
-                           float* smooth) {
+int dmedsmooth_grid(const float* image,
+                    const uint8_t *masked,
+                    int nx,
+                    int ny,
+                    int halfbox,
+                    float **p_grid, int** p_xgrid, int** p_ygrid,
+                    int* p_nxgrid, int* p_nygrid) {
+    return medsmooth_grid(image, masked, nx, ny, halfbox, DMEDSMOOTH_EXACT,
+                          p_grid, p_xgrid, p_ygrid, p_nxgrid, p_nygrid, 1);
+}
+
+struct medsmooth_grid_band_args {
+    struct medsmooth_grid_args* args;
+    int jlo;
+};
+
+static void medsmooth_grid_band_rows(void* varg, int lo, int hi) {
+    struct medsmooth_grid_band_args* band = varg;
+    medsmooth_grid_rows(band->args, band->jlo + lo, band->jlo + hi);
+}
+
+void dmedsmooth_grid_rows(const float* image, int y0, int nx, int halfbox,
+                          int nxgrid, const int* xlo, const int* xhi,
+                          const int* ylo, const int* yhi,
+                          int jlo, int jhi, float* grid, int method,
+                          int nthreads) {
+    struct medsmooth_grid_args args;
+    struct medsmooth_grid_band_args band;
+    args.image = image;
+    args.masked = NULL;
+    args.y0 = y0;
+    args.nx = nx;
+    args.halfbox = halfbox;
+    args.method = method;
+    args.nxgrid = nxgrid;
+    args.xlo = xlo;
+    args.xhi = xhi;
+    args.ylo = ylo;
+    args.yhi = yhi;
+    args.grid = grid;
+    band.args = &args;
+    band.jlo = jlo;
+    dparallel(nthreads, jhi - jlo, medsmooth_grid_band_rows, &band);
+}
+
+struct medsmooth_interp_args {
+    const float* grid;
+    int nx, ny;
+    int nxgrid, nygrid;
+    const int* xgrid;
+    const int* ygrid;
+    int halfbox;
+    // output rows, starting with row y0.
+    float* smooth;
+    int y0;
+};
+
+/*
+ Computes output rows [rlo, rhi).  Each pixel sums the contributions
+ of the grid points in the same order as for the whole image, so the
+ result doesn't depend on how the rows are split up.
+ */
+static void medsmooth_interp_rows(void* varg, int rlo, int rhi) {
+    struct medsmooth_interp_args* args = varg;
+    const float* grid = args->grid;
+    const int* xgrid = args->xgrid;
+    const int* ygrid = args->ygrid;
+    int nx = args->nx;
+    int ny = args->ny;
+    int nxgrid = args->nxgrid;
+    int nygrid = args->nygrid;
+    int halfbox = args->halfbox;
+    float* smooth = args->smooth;
+    int y0 = args->y0;
     int i, j;
     int jst, jnd, ist, ind;
     int ypsize, ymsize, xpsize, xmsize;
     int jp, ip;
 
-    for (j = 0;j < ny;j++)
+    for (j = rlo;j < rhi;j++)
         for (i = 0;i < nx;i++)
-            smooth[i + j*nx] = 0.;
+            smooth[i + (j - y0)*nx] = 0.;
     for (j = 0;j < nygrid;j++) {
         jst = (int) ( (float) ygrid[j] - halfbox * 1.5);
         jnd = (int) ( (float) ygrid[j] + halfbox * 1.5);
@@ -161,6 +385,10 @@ int dmedsmooth_interpolate(const float* grid,
             jst = 0;
         if (jnd > ny - 1)
             jnd = ny - 1;
+        jst = MAX(jst, rlo);
+        jnd = MIN(jnd, rhi - 1);
+        if (jst > jnd)
+            continue;
         ypsize = halfbox;
         ymsize = halfbox;
         if (j == 0)
@@ -227,14 +455,77 @@ int dmedsmooth_interpolate(const float* grid,
                     else
                         // xkernel = 0
                         continue;
-                    smooth[ip + jp*nx] += xkernel * ykernel * grid[i + j * nxgrid];
+                    smooth[ip + (jp - y0)*nx] += xkernel * ykernel * grid[i + j * nxgrid];
                 }
             }
         }
     }
+}
+
+static int medsmooth_interpolate(const float* grid,
+                                 int nx, int ny,
+                                 int nxgrid, int nygrid,
+                                 const int* xgrid, const int* ygrid,
+                                 int halfbox,
+                                 float* smooth, int nthreads) {
+    struct medsmooth_interp_args args;
+    args.grid = grid;
+    args.nx = nx;
+    args.ny = ny;
+    args.nxgrid = nxgrid;
+    args.nygrid = nygrid;
+    args.xgrid = xgrid;
+    args.ygrid = ygrid;
+    args.halfbox = halfbox;
+    args.smooth = smooth;
+    args.y0 = 0;
+    dparallel(nthreads, ny, medsmooth_interp_rows, &args);
     return 0;
 }
 
+struct medsmooth_interp_band_args {
+    struct medsmooth_interp_args* args;
+    int rlo;
+};
+
+static void medsmooth_interp_band_rows(void* varg, int lo, int hi) {
+    struct medsmooth_interp_band_args* band = varg;
+    medsmooth_interp_rows(band->args, band->rlo + lo, band->rlo + hi);
+}
+
+void dmedsmooth_interpolate_rows(const float* grid,
+                                 int nx, int ny,
+                                 int nxgrid, int nygrid,
+                                 const int* xgrid, const int* ygrid,
+                                 int halfbox, int rlo, int rhi,
+                                 float* smooth, int nthreads) {
+    struct medsmooth_interp_args args;
+    struct medsmooth_interp_band_args band;
+    args.grid = grid;
+    args.nx = nx;
+    args.ny = ny;
+    args.nxgrid = nxgrid;
+    args.nygrid = nygrid;
+    args.xgrid = xgrid;
+    args.ygrid = ygrid;
+    args.halfbox = halfbox;
+    args.smooth = smooth;
+    args.y0 = rlo;
+    band.args = &args;
+    band.rlo = rlo;
+    dparallel(nthreads, rhi - rlo, medsmooth_interp_band_rows, &band);
+}
+
+int dmedsmooth_interpolate(const float* grid,
+                           int nx, int ny,
+                           int nxgrid, int nygrid,
+                           const int* xgrid, const int* ygrid,
+                           int halfbox,
+                           float* smooth) {
+    return medsmooth_interpolate(grid, nx, ny, nxgrid, nygrid, xgrid, ygrid,
+                                 halfbox, smooth, 1);
+}
+
 
 int dmedsmooth(const float *image,
                const uint8_t *masked,
@@ -242,18 +533,42 @@ int dmedsmooth(const float *image,
                int ny,
                int halfbox,
                float *smooth)
+{
+    return dmedsmooth_threads(image, masked, nx, ny, halfbox, smooth, 1);
+}
+
+int dmedsmooth_threads(const float *image,
+                       const uint8_t *masked,
+                       int nx,
+                       int ny,
+                       int halfbox,
+                       float *smooth,
+                       int nthreads)
+{
+    return dmedsmooth_method_threads(image, masked, nx, ny, halfbox,
+                                     DMEDSMOOTH_EXACT, smooth, nthreads);
+}
+
+int dmedsmooth_method_threads(const float *image,
+                              const uint8_t *masked,
+                              int nx,
+                              int ny,
+                              int halfbox,
+                              int method,
+                              float *smooth,
+                              int nthreads)
 {
     float *grid = NULL;
     int *xgrid = NULL;
     int *ygrid = NULL;
     int nxgrid, nygrid;
 
-    if (dmedsmooth_grid(image, masked, nx, ny, halfbox,
-                        &grid, &xgrid, &ygrid, &nxgrid, &nygrid)) {
+    if (medsmooth_grid(image, masked, nx, ny, halfbox, method,
+                       &grid, &xgrid, &ygrid, &nxgrid, &nygrid, nthreads)) {
         return 0;
     }
-    if (dmedsmooth_interpolate(grid, nx, ny, nxgrid, nygrid,
-                               xgrid, ygrid, halfbox, smooth)) {
+    if (medsmooth_interpolate(grid, nx, ny, nxgrid, nygrid,
+                              xgrid, ygrid, halfbox, smooth, nthreads)) {
         return 0;
     }
 
@@ -23,21 +23,45 @@
 
 typedef unsigned char u8;
 
-int dmask(float *image, int nx, int ny, float limit,
-		  float dpsf, uint8_t* mask) {
-	int i, j, ip, jp, ilo, ihi, jlo, jhi;
+struct dmask_args {
+	const float* image;
+	int nx;
+	int ny;
+	float limit;
+	int boxsize;
+	// mask rows, starting with row j0.
+	uint8_t* mask;
+	int j0;
+	// set by any slice that finds a significant pixel.
+	int flagged_one;
+};
+
+/*
+ Fills in rows [j0 + jlo, j0 + jhi) of the mask.  Pixels up to
+ "boxsize" rows outside the slice can flag boxes that reach into it, so
+ they're scanned too (but only the slice's own rows are written).
+ */
+static void dmask_rows(void* varg, int jlo, int jhi) {
+	struct dmask_args* args = varg;
+	const float* image = args->image;
+	int nx = args->nx;
+	int boxsize = args->boxsize;
+	int j0 = args->j0;
+	uint8_t* mask = args->mask;
+	int i, j, ip, jp, ilo, ihi, blo, bhi;
     int flagged_one = 0;
-	int boxsize = 3 * dpsf;
-    
-	memset(mask, 0, nx*ny);
+
+	jlo += j0;
+	jhi += j0;
+	memset(mask + (size_t)(jlo - j0)*nx, 0, (size_t)(jhi - jlo) * nx);
 
 	/* This makes a mask which dfind uses when looking at the pixels; dfind
 	 * ignores any pixels the mask flagged as uninteresting. */
-	for (j=0; j<ny; j++) {
-		jlo = MAX(0,    j - boxsize);
-		jhi = MIN(ny-1, j + boxsize);
+	for (j=MAX(0, jlo - boxsize); j<MIN(args->ny, jhi + boxsize); j++) {
+		blo = MAX(jlo,    j - boxsize);
+		bhi = MIN(jhi-1,  j + boxsize);
 		for (i=0; i<nx; i++) {
-			if (image[i + j*nx] < limit)
+			if (image[i + j*nx] < args->limit)
                 continue;
 			/* this pixel is significant. */
             flagged_one = 1;
@@ -46,13 +70,37 @@ int dmask(float *image, int nx, int ny, float limit,
             /* now that we found a single interesting pixel, flag a box
              * around it so the object finding code will be able to
              * accurately estimate the center. */
-            for (jp=jlo; jp<=jhi; jp++)
+            for (jp=blo; jp<=bhi; jp++)
                 for (ip=ilo; ip<=ihi; ip++)
-                    mask[jp*nx + ip] = 1;
+                    mask[(size_t)(jp - j0)*nx + ip] = 1;
         }
 	}
+	// (only ever set, never cleared, so no lock is needed)
+	if (flagged_one)
+		args->flagged_one = 1;
+}
 
-    if (!flagged_one) {
+int dmask(float *image, int nx, int ny, float limit,
+		  float dpsf, uint8_t* mask) {
+	return dmask_threads(image, nx, ny, limit, dpsf, mask, 1);
+}
+
+int dmask_threads(float *image, int nx, int ny, float limit,
+				  float dpsf, uint8_t* mask, int nthreads) {
+	struct dmask_args args;
+	int i;
+
+	args.image = image;
+	args.nx = nx;
+	args.ny = ny;
+	args.limit = limit;
+	args.boxsize = 3 * dpsf;
+	args.mask = mask;
+	args.j0 = 0;
+	args.flagged_one = 0;
+	dparallel(nthreads, ny, dmask_rows, &args);
+
+    if (!args.flagged_one) {
         /* no pixels were masked - what parameter settings would cause at
          least one pixel to be masked? */
         float maxval = -HUGE_VAL;
@@ -68,6 +116,22 @@ int dmask(float *image, int nx, int ny, float limit,
 	return 1;
 }
 
+int dmask_rows_threads(const float *image, int nx, int ny, float limit,
+					   float dpsf, int jlo, int jhi, uint8_t* mask,
+					   int nthreads) {
+	struct dmask_args args;
+	args.image = image;
+	args.nx = nx;
+	args.ny = ny;
+	args.limit = limit;
+	args.boxsize = 3 * dpsf;
+	args.mask = mask;
+	args.j0 = jlo;
+	args.flagged_one = 0;
+	dparallel(nthreads, jhi - jlo, dmask_rows, &args);
+	return args.flagged_one;
+}
+
 int dobjects(float *smooth,
              int nx,
              int ny,
@@ -0,0 +1,74 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "os-features.h"
+#include "an-bool.h"
+#include "dimage.h"
+
+/*
+ * dparallel.c
+ *
+ * Splits a range of rows (or columns, or objects) into contiguous
+ * slices and runs a function on each slice in its own thread.  This is
+ * what the threaded versions of the simplexy stages are built on; each
+ * of them arranges for the slices to produce exactly what the serial
+ * code would.
+ */
+
+struct dparallel_slice {
+	dparallel_func func;
+	void* arg;
+	int lo;
+	int hi;
+	pthread_t thread;
+};
+
+static void* dparallel_main(void* varg) {
+	struct dparallel_slice* s = varg;
+	s->func(s->arg, s->lo, s->hi);
+	return NULL;
+}
+
+int dparallel_nslices(int nthreads, int N) {
+	if (nthreads < 1)
+		nthreads = 1;
+	return MAX(1, MIN(nthreads, N));
+}
+
+void dparallel(int nthreads, int N, dparallel_func func, void* arg) {
+	struct dparallel_slice* slices;
+	anbool* started;
+	int n, i;
+
+	n = dparallel_nslices(nthreads, N);
+	if (n == 1) {
+		func(arg, 0, N);
+		return;
+	}
+	slices = malloc(n * sizeof(struct dparallel_slice));
+	started = calloc(n, sizeof(anbool));
+	for (i=0; i<n; i++) {
+		slices[i].func = func;
+		slices[i].arg = arg;
+		slices[i].lo = (int)((long)N * i / n);
+		slices[i].hi = (int)((long)N * (i+1) / n);
+	}
+	// the calling thread does the first slice; if a thread can't be
+	// started, its slice is done here too.
+	for (i=1; i<n; i++)
+		started[i] = (pthread_create(&slices[i].thread, NULL, dparallel_main,
+									 slices + i) == 0);
+	for (i=0; i<n; i++)
+		if (!started[i])
+			func(arg, slices[i].lo, slices[i].hi);
+	for (i=1; i<n; i++)
+		if (started[i])
+			pthread_join(slices[i].thread, NULL);
+	free(started);
+	free(slices);
+}
@@ -22,6 +22,52 @@
  * 1/2006 */
 
 
+int dsigma_diffs(float* diff, int ndiff, float* sigma) {
+	float tot;
+	int i;
+
+	if (ndiff <= 10) {
+		tot = 0.;
+		for (i = 0; i < ndiff; i++)
+			tot += diff[i] * diff[i];
+		*sigma = sqrt(tot / (float) ndiff);
+		return 0;
+	}
+
+	/*
+	 estimate sigma in a clever way to avoid having our estimate
+	 biased by outliers. outliers come into the diff list when we
+	 sampled a point where the upper point was on a source, but the
+	 lower one was not (or vice versa).  Since the sample variance
+	 involves squaring the already-large outliers, they drastically
+	 affect the final sigma estimate. by sorting, the outliers go to
+	 the top and only affect the final value very slightly, because
+	 they are a small fraction of the total entries in diff (or so we
+	 hope!)
+	 */
+
+    {
+		double Nsigma=0.7;
+		double s = 0.0;
+		// Sample the sorted list of squared differences at different
+		// percentiles (starting at ~50th)
+		while (s == 0.0) {
+			int k = (int)floor(ndiff * erf(Nsigma / M_SQRT2));
+			if (k >=  ndiff) {
+				logerr("Failed to estimate the image noise.  Setting sigma=1.  Expect the worst.\n");
+				// FIXME - Could try a finer grid of sample points...
+				s = 1.0;
+				break;
+			}
+			s = dselip(k, ndiff, diff) / (Nsigma * M_SQRT2);
+			logverb("Nsigma=%g, s=%g\n", Nsigma, s);
+			Nsigma += 0.1;
+		}
+		*sigma = s;
+    }
+    return 1;
+}
+
 #define IMGTYPE float
 #define DSIGMA_SUFF
 #include "dsigma.inc"
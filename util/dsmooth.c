@@ -11,6 +11,7 @@
 
 #include "os-features.h"
 #include "simplexy-common.h"
+#include "dimage.h"
 
 /*
  * dsmooth.c
@@ -21,6 +22,227 @@
  * 1/2006 
  */
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DSMOOTH_X86 1
+#include <immintrin.h>
+#define SSE2_FUNC __attribute__((target("sse2")))
+#define AVX2_FUNC __attribute__((target("avx2")))
+// Fused multiply-adds when the build allows them (as it does for the
+// scalar loops).
+#ifdef __FMA__
+#define MADD128(acc, x, k) _mm_fmadd_ps(x, k, acc)
+#define MADD256(acc, x, k) _mm256_fmadd_ps(x, k, acc)
+#else
+#define MADD128(acc, x, k) _mm_add_ps(acc, _mm_mul_ps(x, k))
+#define MADD256(acc, x, k) _mm256_add_ps(acc, _mm256_mul_ps(x, k))
+#endif
+#else
+#define DSMOOTH_X86 0
+#endif
+
+// Columns per block in the vectorized y pass.
+#define DSMOOTH_COLBLOCK 64
+// The y pass is split among threads in groups of this many columns, so
+// that which columns go through the vectorized kernel (and which through
+// the scalar loop, at the right edge) doesn't depend on the split.
+#define DSMOOTH_COLGROUP 8
+
+static int forced_kernel = -1;
+
+int dsmooth2_best_kernel(void) {
+#if DSMOOTH_X86
+	if (__builtin_cpu_supports("avx2"))
+		return DSMOOTH_AVX2;
+	if (__builtin_cpu_supports("sse2"))
+		return DSMOOTH_SSE2;
+#endif
+	return DSMOOTH_SCALAR;
+}
+
+int dsmooth2_kernel(void) {
+	int best = dsmooth2_best_kernel();
+	if (forced_kernel >= 0 && forced_kernel <= best)
+		return forced_kernel;
+	return best;
+}
+
+void dsmooth2_set_kernel(int kernel) {
+	forced_kernel = kernel;
+}
+
+// x pass over output pixels [ilo, ihi) of one row.
+static void smooth_row_scalar(const float* in, int nx, const float* kernel_shifted,
+							  int half, float* out, int ilo, int ihi) {
+	int i, start, end, sample;
+	float sum;
+	for (i=ilo; i<ihi; i++) {
+		start = MAX(0, i - half);
+		end = MIN(nx-1, i + half);
+		sum = 0.0;
+		for (sample=start; sample <= end; sample++)
+			sum += in[sample] * kernel_shifted[sample - i];
+		out[i] = sum;
+	}
+}
+
+// y pass over columns [ilo, ihi) of "img", in place; "temp" holds ny floats.
+static void smooth_cols_scalar(float* img, int nx, int ny,
+							   const float* kernel_shifted, int half,
+							   int ilo, int ihi, float* temp) {
+	int i, j, start, end, sample;
+	float sum;
+	for (i=ilo; i<ihi; i++) {
+		float* imagecol = img + i;
+		for (j=0; j<ny; j++) {
+			start = MAX(0, j - half);
+			end = MIN(ny-1, j + half);
+			sum = 0.0;
+			for (sample=start; sample<=end; sample++)
+				sum += imagecol[sample*nx] * kernel_shifted[sample - j];
+			temp[j] = sum;
+		}
+		for (j=0; j<ny; j++)
+			img[i + j*nx] = temp[j];
+	}
+}
+
+#if DSMOOTH_X86
+
+/*
+ The x pass does 4 (or 8) adjacent output pixels at a time, where the
+ whole kernel fits inside the row; the pixels near the ends of the row
+ go through the scalar loop.
+ */
+static SSE2_FUNC void smooth_row_sse2(const float* in, int nx,
+									  const float* kernel_shifted, int half,
+									  float* out) {
+	int i, k;
+	int ilo = MIN(half, nx);
+	int ihi = nx - half;
+	for (i=ilo; i+4 <= ihi; i+=4) {
+		__m128 acc = _mm_setzero_ps();
+		for (k=-half; k<=half; k++)
+			acc = MADD128(acc, _mm_loadu_ps(in + i + k),
+						  _mm_set1_ps(kernel_shifted[k]));
+		_mm_storeu_ps(out + i, acc);
+	}
+	smooth_row_scalar(in, nx, kernel_shifted, half, out, 0, ilo);
+	smooth_row_scalar(in, nx, kernel_shifted, half, out, i, nx);
+}
+
+static AVX2_FUNC void smooth_row_avx2(const float* in, int nx,
+									  const float* kernel_shifted, int half,
+									  float* out) {
+	int i, k;
+	int ilo = MIN(half, nx);
+	int ihi = nx - half;
+	for (i=ilo; i+8 <= ihi; i+=8) {
+		__m256 acc = _mm256_setzero_ps();
+		for (k=-half; k<=half; k++)
+			acc = MADD256(acc, _mm256_loadu_ps(in + i + k),
+						  _mm256_set1_ps(kernel_shifted[k]));
+		_mm256_storeu_ps(out + i, acc);
+	}
+	smooth_row_scalar(in, nx, kernel_shifted, half, out, 0, ilo);
+	smooth_row_scalar(in, nx, kernel_shifted, half, out, i, nx);
+}
+
+/*
+ The y pass works on blocks of DSMOOTH_COLBLOCK columns: the block is
+ copied out into "strip" (ny rows of "w" floats), then each output row
+ of the block is summed from the strip rows above and below it, 4 (or
+ 8) columns at a time.  Memory is only ever walked along rows, and the
+ rows a block needs stay in cache.  The clipping of the kernel at the
+ top and bottom depends only on the row, so every column is vectorized
+ except a ragged few at the right end of the range.
+ */
+static SSE2_FUNC void smooth_block_sse2(float* img, int nx, int ny,
+										const float* kernel_shifted, int half,
+										int i0, int w, float* strip) {
+	int j, c, start, end, sample;
+	for (j=0; j<ny; j++)
+		memcpy(strip + (size_t)j*w, img + (size_t)j*nx + i0, w * sizeof(float));
+	for (j=0; j<ny; j++) {
+		float* outrow = img + (size_t)j*nx + i0;
+		start = MAX(0, j - half);
+		end = MIN(ny-1, j + half);
+		for (c=0; c<w; c+=4) {
+			__m128 acc = _mm_setzero_ps();
+			for (sample=start; sample<=end; sample++)
+				acc = MADD128(acc, _mm_loadu_ps(strip + (size_t)sample*w + c),
+							  _mm_set1_ps(kernel_shifted[sample - j]));
+			_mm_storeu_ps(outrow + c, acc);
+		}
+	}
+}
+
+static AVX2_FUNC void smooth_block_avx2(float* img, int nx, int ny,
+										const float* kernel_shifted, int half,
+										int i0, int w, float* strip) {
+	int j, c, start, end, sample;
+	for (j=0; j<ny; j++)
+		memcpy(strip + (size_t)j*w, img + (size_t)j*nx + i0, w * sizeof(float));
+	for (j=0; j<ny; j++) {
+		float* outrow = img + (size_t)j*nx + i0;
+		start = MAX(0, j - half);
+		end = MIN(ny-1, j + half);
+		for (c=0; c<w; c+=8) {
+			__m256 acc = _mm256_setzero_ps();
+			for (sample=start; sample<=end; sample++)
+				acc = MADD256(acc, _mm256_loadu_ps(strip + (size_t)sample*w + c),
+							  _mm256_set1_ps(kernel_shifted[sample - j]));
+			_mm256_storeu_ps(outrow + c, acc);
+		}
+	}
+}
+
+#endif
+
+// x pass of one row (already converted to float) with the given kernel.
+static void smooth_row(int kernel, const float* in, int nx,
+					   const float* kernel_shifted, int half, float* out) {
+#if DSMOOTH_X86
+	if (kernel == DSMOOTH_AVX2) {
+		smooth_row_avx2(in, nx, kernel_shifted, half, out);
+		return;
+	}
+	if (kernel == DSMOOTH_SSE2) {
+		smooth_row_sse2(in, nx, kernel_shifted, half, out);
+		return;
+	}
+#endif
+	smooth_row_scalar(in, nx, kernel_shifted, half, out, 0, nx);
+}
+
+// y pass over columns [ilo, ihi) with the given kernel.
+static void smooth_cols(int kernel, float* img, int nx, int ny,
+						const float* kernel_shifted, int half,
+						int ilo, int ihi) {
+	float* temp;
+	int i = ilo;
+#if DSMOOTH_X86
+	if (kernel == DSMOOTH_SSE2 || kernel == DSMOOTH_AVX2) {
+		int vec = (kernel == DSMOOTH_AVX2) ? 8 : 4;
+		float* strip = malloc((size_t)ny * DSMOOTH_COLBLOCK * sizeof(float));
+		while (i + vec <= ihi) {
+			int w = MIN(DSMOOTH_COLBLOCK, ihi - i);
+			w -= (w % vec);
+			if (kernel == DSMOOTH_AVX2)
+				smooth_block_avx2(img, nx, ny, kernel_shifted, half, i, w, strip);
+			else
+				smooth_block_sse2(img, nx, ny, kernel_shifted, half, i, w, strip);
+			i += w;
+		}
+		FREEVEC(strip);
+	}
+#endif
+	if (i == ihi)
+		return;
+	temp = malloc(sizeof(float) * ny);
+	smooth_cols_scalar(img, nx, ny, kernel_shifted, half, i, ihi, temp);
+	FREEVEC(temp);
+}
+
 #define IMGTYPE float
 #define SUFFIX
 #include "dsmooth.inc"
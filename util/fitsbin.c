@@ -9,6 +9,8 @@
 #include <sys/mman.h>
 #include <string.h>
 #include <assert.h>
+#include <errno.h>
+#include <unistd.h>
 
 #include "keywords.h"
 #include "fitsbin.h"
@@ -516,6 +518,28 @@ int fitsbin_read_chunk(fitsbin_t* fb, fitsbin_chunk_t* chunk) {
     return 0;
 }
 
+size_t fitsbin_prefetch_chunk(const fitsbin_chunk_t* chunk) {
+	volatile char sink;
+	size_t pagesize;
+	size_t i;
+
+	if (!chunk->map)
+		return 0;
+	pagesize = getpagesize();
+#ifdef MADV_WILLNEED
+	// start read-ahead of the whole table...
+	if (madvise(chunk->map, chunk->mapsize, MADV_WILLNEED))
+		debug("madvise(MADV_WILLNEED) failed for table \"%s\": %s\n",
+			  chunk->tablename, strerror(errno));
+#endif
+	// ... and fault the pages in from the front, so that the top of a
+	// kdtree arrives first.
+	for (i=0; i<chunk->mapsize; i+=pagesize)
+		sink = chunk->map[i];
+	(void)sink;
+	return chunk->mapsize;
+}
+
 int fitsbin_read(fitsbin_t* fb) {
     int i;
 
@@ -15,6 +15,7 @@
 #include "ioutils.h"
 #include "an-endian.h"
 #include "anqfits.h"
+#include "qfits_memory.h"
 
 #include "log.h"
 
@@ -75,6 +76,178 @@ static off_t get_row_offset(const fitstable_t* table, int row) {
 	return table->end_table_offset + (off_t)(table->table->tab_w) * (off_t)(row);
 }
 
+static anbool in_memory(const fitstable_t* t) {
+	return t->inmemory;
+}
+
+static inline uint16_t swap16(uint16_t v) {
+	return (v >> 8) | (v << 8);
+}
+static inline uint32_t swap32(uint32_t v) {
+	return ((v >> 24) | ((v >> 8) & 0xff00) | ((v & 0xff00) << 8) | (v << 24));
+}
+static inline uint64_t swap64(uint64_t v) {
+	return ((uint64_t)swap32((uint32_t)v) << 32) | swap32((uint32_t)(v >> 32));
+}
+
+#define SWAP_ROWS(T, SWAP)											\
+	for (i=0; i<nrows; i++) {										\
+		const char* s = src + (size_t)(inds ? inds[i] - ind0 : i) * srcstride; \
+		char* d = dest + (size_t)i * deststride;					\
+		for (j=0; j<natoms; j++) {									\
+			T v;													\
+			memcpy(&v, s + j * sizeof(T), sizeof(T));				\
+			v = SWAP(v);											\
+			memcpy(d + j * sizeof(T), &v, sizeof(T));				\
+		}															\
+	}
+
+/*
+ Copies "nrows" rows of "natoms" items of "size" bytes: row i from
+ src + (inds ? inds[i] - ind0 : i) * srcstride to dest + i * deststride,
+ reversing the bytes of each item if "flip".  The fixed-size loops
+ compile to byte-swap instructions, and to vector shuffles where the
+ rows are packed.  "dest" may be "src".
+ */
+static void copy_swap_rows(char* dest, int deststride,
+						   const char* src, int srcstride,
+						   const int* inds, int ind0,
+						   int size, int natoms, size_t nrows, anbool flip) {
+	size_t i;
+	int j;
+	if (!flip || size == 1) {
+		for (i=0; i<nrows; i++)
+			memmove(dest + (size_t)i * deststride,
+					src + (size_t)(inds ? inds[i] - ind0 : i) * srcstride,
+					(size_t)size * natoms);
+		return;
+	}
+	switch (size) {
+	case 2:
+		SWAP_ROWS(uint16_t, swap16);
+		break;
+	case 4:
+		SWAP_ROWS(uint32_t, swap32);
+		break;
+	case 8:
+		SWAP_ROWS(uint64_t, swap64);
+		break;
+	default:
+		for (i=0; i<nrows; i++) {
+			char* d = dest + (size_t)i * deststride;
+			memmove(d, src + (size_t)(inds ? inds[i] - ind0 : i) * srcstride,
+					(size_t)size * natoms);
+			for (j=0; j<natoms; j++)
+				endian_swap(d + j * size, size);
+		}
+		break;
+	}
+}
+#undef SWAP_ROWS
+
+// Maps rows "row0" to "row1" (inclusive) of FITS column "colnum".
+static int map_column_rows(const fitstable_t* tab, int colnum, int row0,
+						   int row1, fitstable_column_view_t* view) {
+	const qfits_table* t = tab->table;
+	const qfits_col* col = t->col + colnum;
+	size_t start, len;
+
+	memset(view, 0, sizeof(fitstable_column_view_t));
+	if (in_memory(tab) || t->tab_t != QFITS_BINTABLE) {
+		ERROR("Column \"%s\" can't be mapped: not a binary table in a file", col->tlabel);
+		return -1;
+	}
+	assert(row0 >= 0);
+	assert(row1 < t->nr);
+	assert(row0 <= row1);
+	view->type = col->atom_type;
+	view->arraysize = col->atom_nb;
+	view->stride = t->tab_w;
+	view->nrows = row1 - row0 + 1;
+	view->native = (col->atom_size == 1 || !need_endian_flip());
+	// (the mapping ends at the last row's item, not the end of its row.)
+	start = (size_t)col->off_beg + (size_t)t->tab_w * (size_t)row0;
+	len = (size_t)t->tab_w * (size_t)(row1 - row0) +
+		(size_t)col->atom_size * (size_t)col->atom_nb;
+	view->data = qfits_falloc2(t->filename, start, len,
+							   &view->mapaddr, &view->mapsize);
+	if (!view->data) {
+		ERROR("Failed to map column \"%s\" of FITS table %s", col->tlabel, t->filename);
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ Reads rows [row0, row0+N) -- or, if "inds" is non-NULL, rows "inds" --
+ of FITS column "colnum" of a table in a file, into "dest", "stride"
+ bytes apart, in native byte order.
+ */
+static int read_column_rows(const fitstable_t* tab, int colnum, int row0,
+							const int* inds, int N, void* dest, int stride) {
+	const qfits_col* col = tab->table->col + colnum;
+	fitstable_column_view_t view;
+	int lo, hi;
+	int i;
+
+	if (N <= 0)
+		return 0;
+	if (tab->table->tab_t != QFITS_BINTABLE) {
+		if (inds)
+			return qfits_query_column_seq_to_array_inds(tab->table, colnum, inds, N,
+														dest, stride);
+		return qfits_query_column_seq_to_array(tab->table, colnum, row0, N,
+											   dest, stride);
+	}
+	if (inds) {
+		lo = hi = inds[0];
+		for (i=1; i<N; i++) {
+			lo = MIN(lo, inds[i]);
+			hi = MAX(hi, inds[i]);
+		}
+	} else {
+		lo = row0;
+		hi = row0 + N - 1;
+	}
+	if (lo < 0 || hi >= tab->table->nr) {
+		ERROR("Rows %i to %i requested from a FITS table with %i rows", lo, hi,
+			  tab->table->nr);
+		return -1;
+	}
+	if (map_column_rows(tab, colnum, lo, hi, &view))
+		return -1;
+	copy_swap_rows(dest, stride, view.data, view.stride, inds, lo,
+				   col->atom_size, col->atom_nb, N, !view.native);
+	fitstable_unmap_column(&view);
+	return 0;
+}
+
+int fitstable_map_column(const fitstable_t* tab, const char* colname,
+						 fitstable_column_view_t* view) {
+	int colnum;
+	memset(view, 0, sizeof(fitstable_column_view_t));
+	colnum = fits_find_column(tab->table, colname);
+	if (colnum == -1) {
+		ERROR("Column \"%s\" not found in FITS table %s", colname, tab->fn);
+		return -1;
+	}
+	if (tab->table->nr == 0) {
+		const qfits_col* col = tab->table->col + colnum;
+		view->type = col->atom_type;
+		view->arraysize = col->atom_nb;
+		view->stride = tab->table->tab_w;
+		view->native = TRUE;
+		return 0;
+	}
+	return map_column_rows(tab, colnum, 0, tab->table->nr - 1, view);
+}
+
+void fitstable_unmap_column(fitstable_column_view_t* view) {
+	if (view->mapaddr)
+		qfits_fdealloc2(view->mapaddr, view->mapsize);
+	memset(view, 0, sizeof(fitstable_column_view_t));
+}
+
 int fitstable_n_extensions(const fitstable_t* t) {
 	assert(t);
     assert(t->anq);
@@ -115,10 +288,6 @@ static void ensure_row_list_exists(fitstable_t* table) {
 	}
 }
 
-static anbool in_memory(const fitstable_t* t) {
-	return t->inmemory;
-}
-
 tfits_type fitscolumn_int_type() {
     switch (sizeof(int)) {
     case 2:
@@ -259,29 +428,87 @@ void fitstable_endian_flip_row_data(fitstable_t* table, void* data) {
 	}
 }
 
-static int write_row_data(fitstable_t* table, void* data, int R) {
+// Writes "N" consecutive rows of "R" bytes each.
+static int write_rows_data(fitstable_t* table, void* data, int R, int N) {
 	assert(table);
 	assert(data);
 	if (in_memory(table)) {
+		int i;
 		ensure_row_list_exists(table);
-		bl_append(table->rows, data);
+		for (i=0; i<N; i++)
+			bl_append(table->rows, (char*)data + (size_t)i * R);
 		// ?
-		table->table->nr++;
+		table->table->nr += N;
 		return 0;
 	}
 	if (R == 0)
 		R = fitstable_row_size(table);
-	if (fwrite(data, 1, R, table->fid) != R) {
+	if (fwrite(data, R, N, table->fid) != N) {
 		SYSERROR("Failed to write a row to %s", table->fn);
 		return -1;
 	}
 	assert(table->table);
-    table->table->nr++;
+    table->table->nr += N;
 	return 0;
 }
 
 int fitstable_write_row_data(fitstable_t* table, void* data) {
-	return write_row_data(table, data, 0);
+	return write_rows_data(table, data, 0, 1);
+}
+
+// Copies rows from a table in a file: they're gathered, through a
+// mapping of the file, into chunks that are written at once.
+static int copy_rows_from_file(fitstable_t* intable, int* rows, int N,
+							   fitstable_t* outtable, anbool flip) {
+	int R = fitstable_row_size(intable);
+	int lo, hi;
+	int i, k, chunk;
+	char* buf;
+	const char* data;
+	char* mapaddr;
+	size_t mapsize;
+
+	if (rows) {
+		lo = hi = rows[0];
+		for (i=1; i<N; i++) {
+			lo = MIN(lo, rows[i]);
+			hi = MAX(hi, rows[i]);
+		}
+	} else {
+		lo = 0;
+		hi = N - 1;
+	}
+	if (lo < 0 || hi >= fitstable_nrows(intable)) {
+		ERROR("Rows %i to %i requested from a FITS table with %i rows", lo, hi,
+			  fitstable_nrows(intable));
+		return -1;
+	}
+	data = qfits_falloc2(intable->fn, (size_t)anqfits_data_start(intable->anq, intable->extension) +
+						 (size_t)lo * R, (size_t)(hi - lo + 1) * R,
+						 &mapaddr, &mapsize);
+	if (!data) {
+		ERROR("Failed to map rows of FITS table %s", intable->fn);
+		return -1;
+	}
+	chunk = MAX(1, MIN(N, 65536 / MAX(1, R)));
+	buf = malloc((size_t)chunk * R);
+	for (i=0; i<N; i+=chunk) {
+		int n = MIN(chunk, N - i);
+		copy_swap_rows(buf, R, rows ? data : data + (size_t)i * R, R,
+					   rows ? rows + i : NULL, lo, 1, R, n, FALSE);
+		if (flip)
+			for (k=0; k<n; k++)
+				fitstable_endian_flip_row_data(outtable, buf + (size_t)k * R);
+		if (write_rows_data(outtable, buf, R, n)) {
+			ERROR("Failed to write data to output table");
+			free(buf);
+			qfits_fdealloc2(mapaddr, mapsize);
+			return -1;
+		}
+	}
+	free(buf);
+	qfits_fdealloc2(mapaddr, mapsize);
+	return 0;
 }
 
 int fitstable_copy_rows_data(fitstable_t* intable, int* rows, int N, fitstable_t* outtable) {
@@ -290,6 +517,10 @@ int fitstable_copy_rows_data(fitstable_t* intable, int* rows, int N, fitstable_t
 	int i;
 	// We need to endian-flip if we're going from FITS file <--> memory.
 	anbool flip = need_endian_flip() && (in_memory(intable) != in_memory(outtable));
+	if (N <= 0)
+		return 0;
+	if (!in_memory(intable) && intable->table->tab_t == QFITS_BINTABLE)
+		return copy_rows_from_file(intable, rows, N, outtable, flip);
 	R = fitstable_row_size(intable);
 	buf = malloc(R);
 	for (i=0; i<N; i++) {
@@ -305,7 +536,7 @@ int fitstable_copy_rows_data(fitstable_t* intable, int* rows, int N, fitstable_t
 				fitstable_endian_flip_row_data(outtable, buf);
 		}
 
-		if (write_row_data(outtable, buf, R)) {
+		if (write_rows_data(outtable, buf, R, 1)) {
 			ERROR("Failed to write data to output table");
 			return -1;
 		}
@@ -652,7 +883,10 @@ int fitstable_read_structs(fitstable_t* tab, void* struc,
 					   sz);
 		} else {
 			// Read from FITS file...
-			qfits_query_column_seq_to_array(tab->table, col->col, offset, N, dest, stride);
+			if (read_column_rows(tab, col->col, offset, NULL, N, dest, stride)) {
+				free(tempdata);
+				return -1;
+			}
 		}
 
         if (col->fitstype != col->ctype) {
@@ -673,27 +907,47 @@ int fitstable_read_struct(fitstable_t* tab, int offset, void* struc) {
     return fitstable_read_structs(tab, struc, 0, offset, 1);
 }
 
+// Puts one row's worth of column "col" from "data" into FITS format.
+static void pack_column(const fitscol_t* col, const void* data, anbool swap,
+						char* dest) {
+	if (col->fitstype != col->ctype) {
+		fits_convert_data(dest, col->fitssize, col->fitstype,
+						  data, col->csize, col->ctype,
+						  col->arraysize, 1);
+		data = dest;
+	}
+	copy_swap_rows(dest, 0, data, 0, NULL, 0, col->fitssize, col->arraysize,
+				   1, swap);
+}
+
 // One of "struc" or "ap" should be non-null.
 static int write_one(fitstable_t* table, const void* struc, anbool flip,
 					 va_list* ap) {
     int i;
-    char* buf = NULL;
-    int Nbuf = 0;
 	int ret = 0;
 	int nc = ncols(table);
-
-	char* thisrow = NULL;
+	int rowsize = offset_of_column(table, nc);
+	anbool swap = flip && need_endian_flip() && !in_memory(table);
+	char rowbuf[1024];
+	char* thisrow = rowbuf;
+	// bytes of "thisrow" not yet written to the file.
 	int rowoff = 0;
 
 	if (in_memory(table)) {
 		ensure_row_list_exists(table);
-		thisrow = calloc(1, bl_datasize(table->rows));
+		rowsize = MAX(rowsize, bl_datasize(table->rows));
+		memset(rowbuf, 0, MIN(rowsize, sizeof(rowbuf)));
 	}
+	if (rowsize > sizeof(rowbuf))
+		thisrow = calloc(1, rowsize);
 
+	// The row is built up in "thisrow" and written at once.
     for (i=0; i<nc; i++) {
         fitscol_t* col;
         const char* columndata;
+		int nb;
         col = getcol(table, i);
+		nb = fitscolumn_get_size(col);
 		if (col->in_struct) {
 			if (struc)
 				columndata = struc + col->coffset;
@@ -705,41 +959,39 @@ static int write_one(fitstable_t* table, const void* struc, anbool flip,
 			else
 				columndata = va_arg(*ap, void *);
 		}
-		// If "columndata" is NULL, fits_write_data_array
-		// skips the required number of bytes.
+		// If "columndata" is NULL, the required number of bytes are
+		// skipped in the file.
 		// This allows both structs and normal columns to coexist
 		// (in theory -- is this ever used?)
 		// (yes, by blind.c when writing rdls and correspondence files
 		//  with tag-along data...)
-
-        if (columndata && col->fitstype != col->ctype) {
-            int sz = MAX(256, MAX(col->csize, col->fitssize) * col->arraysize);
-            if (sz > Nbuf) {
-                free(buf);
-                buf = malloc(sz);
-            }
-
-            fits_convert_data(buf, col->fitssize, col->fitstype,
-                              columndata, col->csize, col->ctype,
-                              col->arraysize, 1);
-            columndata = buf;
-        }
-		
-		if (in_memory(table)) {
-			int nb = fitscolumn_get_size(col);
-			memcpy(thisrow + rowoff, columndata, nb);
-			rowoff += nb;
-		} else {
-			ret = fits_write_data_array(table->fid, columndata,
-										col->fitstype, col->arraysize, flip);
-			if (ret)
+		if (!columndata) {
+			if (in_memory(table)) {
+				memset(thisrow + rowoff, 0, nb);
+				rowoff += nb;
+				continue;
+			}
+			if ((rowoff && fwrite(thisrow, 1, rowoff, table->fid) != rowoff) ||
+				fseeko(table->fid, nb, SEEK_CUR)) {
+				SYSERROR("Failed to write a row to %s", table->fn);
+				ret = -1;
 				break;
+			}
+			rowoff = 0;
+			continue;
 		}
+		pack_column(col, columndata, swap, thisrow + rowoff);
+		rowoff += nb;
     }
-    free(buf);
 	if (in_memory(table))
 		bl_append(table->rows, thisrow);
-	free(thisrow);
+	else if (!ret && rowoff &&
+			 fwrite(thisrow, 1, rowoff, table->fid) != rowoff) {
+		SYSERROR("Failed to write a row to %s", table->fn);
+		ret = -1;
+	}
+	if (thisrow != rowbuf)
+		free(thisrow);
     table->table->nr++;
     return ret;
 }
@@ -755,14 +1007,52 @@ int fitstable_write_struct_noflip(fitstable_t* table, const void* struc) {
 
 
 int fitstable_write_structs(fitstable_t* table, const void* struc, int stride, int N) {
-	int i;
-	char* s = (char*)struc;
-	for (i=0; i<N; i++) {
-		if (fitstable_write_struct(table, s)) {
+	int i, j;
+	const char* s = (const char*)struc;
+	int nc = ncols(table);
+	int rowsize;
+	int chunk;
+	char* buf;
+	anbool swap;
+
+	for (j=0; j<nc; j++)
+		if (!getcol(table, j)->in_struct)
+			break;
+	if (in_memory(table) || j < nc) {
+		// (columns not in the struct are skipped over, row by row.)
+		for (i=0; i<N; i++) {
+			if (fitstable_write_struct(table, s)) {
+				return -1;
+			}
+			s += stride;
+		}
+		return 0;
+	}
+
+	// Pack rows into a buffer and write them out a chunk at a time.
+	rowsize = offset_of_column(table, nc);
+	chunk = MAX(1, MIN(N, 65536 / MAX(1, rowsize)));
+	buf = malloc((size_t)chunk * rowsize);
+	swap = need_endian_flip();
+	for (i=0; i<N; i+=chunk) {
+		int k, n = MIN(chunk, N - i);
+		for (k=0; k<n; k++) {
+			char* row = buf + (size_t)k * rowsize;
+			for (j=0; j<nc; j++) {
+				fitscol_t* col = getcol(table, j);
+				pack_column(col, s + col->coffset, swap, row);
+				row += fitscolumn_get_size(col);
+			}
+			s += stride;
+		}
+		if (fwrite(buf, rowsize, n, table->fid) != n) {
+			SYSERROR("Failed to write rows to %s", table->fn);
+			free(buf);
 			return -1;
 		}
-		s += stride;
+		table->table->nr += n;
 	}
+	free(buf);
 	return 0;
 }
 
@@ -922,8 +1212,13 @@ static void* read_array_into(const fitstable_t* tab,
 		cstride = csize * arraysize;
 
 	fitsstride = fitssize * arraysize;
-	if (csize < fitssize) {
-		// Need to allocate a bigger temp array and down-convert the data.
+	if (fitstype == ctype)
+		// no conversion: read straight into place.
+		fitsstride = cstride;
+	if (csize < fitssize ||
+		(fitstype != ctype && cstride != csize * arraysize)) {
+		// Need to allocate a bigger temp array and down-convert the data
+		// (or convert it into a strided destination).
 		// HACK - could set data=tempdata and realloc after (if 'dest' is NULL)
 		tempdata = calloc(Nread * arraysize, fitssize);
 		fitsdata = tempdata;
@@ -958,15 +1253,8 @@ static void* read_array_into(const fitstable_t* tab,
 					   sz);
 		}
 	} else {
-		int res;
-		if (inds) {
-			res = qfits_query_column_seq_to_array_inds(tab->table, colnum, inds, Nread,
-													   (unsigned char*)fitsdata, fitsstride);
-		} else {
-			res = qfits_query_column_seq_to_array(tab->table, colnum, offset, Nread,
-												  (unsigned char*)fitsdata, fitsstride);
-		}
-		if (res) {
+		if (read_column_rows(tab, colnum, offset, inds, Nread,
+							 fitsdata, fitsstride)) {
 			ERROR("Failed to read column from FITS file");
 			// MEMLEAK!
 			return NULL;
@@ -974,7 +1262,7 @@ static void* read_array_into(const fitstable_t* tab,
 	}
 
 	if (fitstype != ctype) {
-		if (csize <= fitssize) {
+		if (tempdata || csize <= fitssize) {
 			// work forward
 			fits_convert_data(cdata, cstride, ctype,
 							  fitsdata, fitsstride, fitstype,
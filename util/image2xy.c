@@ -115,3 +115,45 @@ int image2xy_run(simplexy_t* s,
 	return rtn;
 }
 
+
+struct image2xy_fits_rows {
+	const anqfits_t* anq;
+	int ext;
+	int plane;
+};
+
+static int read_fits_rows(void* token, int y0, int nrows, float* rows) {
+	struct image2xy_fits_rows* f = token;
+	if (!anqfits_readpix(f->anq, f->ext, 0, 0, y0, y0 + nrows, f->plane,
+						 PTYPE_FLOAT, rows, NULL, NULL))
+		return -1;
+	return 0;
+}
+
+int image2xy_run_stream(simplexy_t* s, const anqfits_t* anq, int ext,
+						int plane) {
+	const anqfits_image_t* img;
+	struct image2xy_fits_rows f;
+	int jj;
+
+	img = anqfits_get_image_const(anq, ext);
+	if (!img) {
+		ERROR("Failed to read image size from FITS extension %i", ext);
+		return -1;
+	}
+	s->nx = img->width;
+	s->ny = img->height;
+	f.anq = anq;
+	f.ext = ext;
+	f.plane = plane;
+	if (simplexy_run_stream(s, read_fits_rows, &f))
+		return -1;
+
+	for (jj=0; jj<s->npeaks; jj++) {
+		// FITS standard: center of the lower-left pixel is (1,1).
+		(s->x)[jj] += 1.0;
+		(s->y)[jj] += 1.0;
+	}
+	dselip_cleanup();
+	return 0;
+}
@@ -3,7 +3,12 @@
 # Licensed under a 3-clause BSD style license - see LICENSE
 */
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "index.h"
+#include "kdtree_fits_io.h"
+#include "fitsbin.h"
 #include "log.h"
 #include "errors.h"
 #include "ioutils.h"
@@ -373,12 +378,14 @@ index_t* index_load(const char* indexname, int flags, index_t* dest) {
         goto bailout;
 	}
 
+	dest->prefetch = flags & INDEX_PREFETCH_ALL;
 	if (flags & INDEX_ONLY_LOAD_METADATA) {
 		index_unload(dest);
         // If we're using anqfits_t (dest->fits), keep that open for
         // fast reopening.  anqfits_t doesn't keep a FILE* or anything
         // open, so that's fine.
-	}
+	} else if (dest->prefetch)
+		index_prefetch(dest, dest->prefetch);
 
 	return dest;
 
@@ -389,8 +396,21 @@ index_t* index_load(const char* indexname, int flags, index_t* dest) {
 }
 
 int index_reload(index_t* index) {
+	anbool opened = FALSE;
+
+	// a single-file index whose metadata came from an index catalog.
+	if (!index->fits && index->quadfn && index->codefn &&
+		streq(index->quadfn, index->codefn)) {
+		index->fits = anqfits_open(index->quadfn);
+		if (!index->fits) {
+			ERROR("Failed to open FITS file %s", index->quadfn);
+			goto bailout;
+		}
+	}
+
 	// Read .skdt file...
 	if (!index->starkd) {
+		opened = TRUE;
 		if (index->fits)
 			index->starkd = startree_open_fits(index->fits);
 		else {
@@ -405,6 +425,7 @@ int index_reload(index_t* index) {
 
 	// Read .quad file...
 	if (!index->quads) {
+		opened = TRUE;
 		if (index->fits)
 			index->quads = quadfile_open_fits(index->fits);
 		else {
@@ -419,6 +440,7 @@ int index_reload(index_t* index) {
 
 	// Read .ckdt file...
 	if (!index->codekd) {
+		opened = TRUE;
 		if (index->fits)
 			index->codekd = codetree_open_fits(index->fits);
 		else {
@@ -430,12 +452,74 @@ int index_reload(index_t* index) {
 			}
 		}
 	}
+	if (opened && index->prefetch)
+		index_prefetch(index, index->prefetch);
 	return 0;
 
  bailout:
 	return -1;
 }
 
+static anbool is_kdtree_node_table(const char* tablename) {
+	// (KD_STR_SPLIT also matches the splitdim table)
+	return (starts_with(tablename, KD_STR_HEADER) ||
+			starts_with(tablename, KD_STR_LR) ||
+			starts_with(tablename, KD_STR_BB) ||
+			starts_with(tablename, KD_STR_SPLIT) ||
+			starts_with(tablename, KD_STR_RANGE));
+}
+
+static size_t prefetch_tables(fitsbin_t* fb, anbool nodes) {
+	size_t nbytes = 0;
+	int i;
+	for (i=0; i<fitsbin_n_chunks(fb); i++) {
+		fitsbin_chunk_t* chunk = fitsbin_get_chunk(fb, i);
+		if (is_kdtree_node_table(chunk->tablename) != nodes)
+			continue;
+		nbytes += fitsbin_prefetch_chunk(chunk);
+	}
+	return nbytes;
+}
+
+static size_t mapped_size(fitsbin_t* fb) {
+	size_t nbytes = 0;
+	int i;
+	for (i=0; i<fitsbin_n_chunks(fb); i++)
+		nbytes += fitsbin_get_chunk(fb, i)->mapsize;
+	return nbytes;
+}
+
+size_t index_get_mapped_size(index_t* index) {
+	size_t nbytes = 0;
+	if (index->codekd)
+		nbytes += mapped_size(index->codekd->tree->io);
+	if (index->starkd)
+		nbytes += mapped_size(index->starkd->tree->io);
+	if (index->quads)
+		nbytes += mapped_size(index->quads->fb);
+	return nbytes;
+}
+
+size_t index_prefetch(index_t* index, int which) {
+	size_t nbytes = 0;
+	double t0 = timenow();
+
+	if (index->codekd && (which & INDEX_PREFETCH_CODEKD_NODES))
+		nbytes += prefetch_tables(index->codekd->tree->io, TRUE);
+	if (index->starkd && (which & INDEX_PREFETCH_STARKD_NODES))
+		nbytes += prefetch_tables(index->starkd->tree->io, TRUE);
+	if (index->codekd && (which & INDEX_PREFETCH_CODEKD_DATA))
+		nbytes += prefetch_tables(index->codekd->tree->io, FALSE);
+	if (index->starkd && (which & INDEX_PREFETCH_STARKD_DATA))
+		nbytes += prefetch_tables(index->starkd->tree->io, FALSE);
+	if (index->quads && (which & INDEX_PREFETCH_QUADS))
+		nbytes += prefetch_tables(index->quads->fb, FALSE);
+
+	logverb("Prefetched %.1f MB of index %s in %g s\n",
+			nbytes * 1e-6, index->indexname, timenow() - t0);
+	return nbytes;
+}
+
 void index_unload(index_t* index) {
 	if (index->starkd) {
 		startree_close(index->starkd);
@@ -497,3 +581,265 @@ void index_free(index_t* index) {
 	index_close(index);
 	free(index);
 }
+
+/*
+ Index catalog file: a header line, then one line per index, with
+ tab-separated fields:
+
+   name  size mtime  indexname  indexid healpix hpnside dimquads nstars
+   nquads circle cxdx meanx  scale_lower scale_upper jitter  cutnside
+   cutnsweep cutdedup cutmargin cutband
+
+ where "name" is the name the index was loaded by, "size" and "mtime"
+ are the total size and latest modification time of its files, and the
+ rest is its metadata.
+ */
+#define INDEX_CATALOG_HEADER "# Astrometry.net index catalog, version 1"
+
+struct index_catalog_entry {
+	char* name;
+	off_t size;
+	time_t mtime;
+	// metadata only.
+	index_t meta;
+};
+
+struct index_catalog {
+	char* fn;
+	// struct index_catalog_entry
+	bl* entries;
+	anbool modified;
+};
+
+static void catalog_entry_free(struct index_catalog_entry* e) {
+	free(e->name);
+	free(e->meta.indexname);
+	free(e->meta.cutband);
+}
+
+// Total size and latest modification time of an index's files.
+static int get_file_signature(const char* indexname, off_t* size,
+							  time_t* mtime) {
+	char* fns[3];
+	anbool singlefile;
+	int i;
+	int rtn = 0;
+
+	get_filenames(indexname, fns, fns+1, fns+2, &singlefile);
+	*size = 0;
+	*mtime = 0;
+	for (i=0; i<(singlefile ? 1 : 3); i++) {
+		struct stat st;
+		if (stat(fns[i], &st)) {
+			rtn = -1;
+			break;
+		}
+		*size += st.st_size;
+		*mtime = MAX(*mtime, st.st_mtime);
+	}
+	for (i=0; i<3; i++)
+		free(fns[i]);
+	return rtn;
+}
+
+static anbool parse_catalog_line(const char* line,
+								 struct index_catalog_entry* e) {
+	sl* words = sl_split(NULL, line, "\t");
+	index_t* m = &(e->meta);
+	long long size, mtime;
+	int circle, cxdx, meanx;
+	char* band;
+	anbool ok = FALSE;
+
+	memset(e, 0, sizeof(struct index_catalog_entry));
+	if (sl_size(words) != 21)
+		goto finish;
+	if (sscanf(sl_get(words, 1), "%lld", &size) != 1 ||
+		sscanf(sl_get(words, 2), "%lld", &mtime) != 1 ||
+		sscanf(sl_get(words, 4), "%i", &m->indexid) != 1 ||
+		sscanf(sl_get(words, 5), "%i", &m->healpix) != 1 ||
+		sscanf(sl_get(words, 6), "%i", &m->hpnside) != 1 ||
+		sscanf(sl_get(words, 7), "%i", &m->dimquads) != 1 ||
+		sscanf(sl_get(words, 8), "%i", &m->nstars) != 1 ||
+		sscanf(sl_get(words, 9), "%i", &m->nquads) != 1 ||
+		sscanf(sl_get(words, 10), "%i", &circle) != 1 ||
+		sscanf(sl_get(words, 11), "%i", &cxdx) != 1 ||
+		sscanf(sl_get(words, 12), "%i", &meanx) != 1 ||
+		sscanf(sl_get(words, 13), "%lg", &m->index_scale_lower) != 1 ||
+		sscanf(sl_get(words, 14), "%lg", &m->index_scale_upper) != 1 ||
+		sscanf(sl_get(words, 15), "%lg", &m->index_jitter) != 1 ||
+		sscanf(sl_get(words, 16), "%i", &m->cutnside) != 1 ||
+		sscanf(sl_get(words, 17), "%i", &m->cutnsweep) != 1 ||
+		sscanf(sl_get(words, 18), "%lg", &m->cutdedup) != 1 ||
+		sscanf(sl_get(words, 19), "%i", &m->cutmargin) != 1)
+		goto finish;
+	e->size = size;
+	e->mtime = mtime;
+	m->circle = circle;
+	m->cx_less_than_dx = cxdx;
+	m->meanx_less_than_half = meanx;
+	band = sl_get(words, 20);
+	m->cutband = streq(band, "-") ? NULL : strdup(band);
+	m->indexname = strdup(sl_get(words, 3));
+	e->name = strdup(sl_get(words, 0));
+	ok = TRUE;
+ finish:
+	sl_free2(words);
+	return ok;
+}
+
+index_catalog_t* index_catalog_open(const char* fn) {
+	index_catalog_t* cat = calloc(1, sizeof(index_catalog_t));
+	sl* lines;
+	int i;
+
+	cat->fn = strdup(fn);
+	cat->entries = bl_new(256, sizeof(struct index_catalog_entry));
+	if (!file_exists(fn)) {
+		logverb("Index catalog %s does not exist yet\n", fn);
+		return cat;
+	}
+	lines = file_get_lines(fn, FALSE);
+	if (!lines) {
+		ERROR("Failed to read index catalog %s", fn);
+		return cat;
+	}
+	if (!sl_size(lines) || !streq(sl_get(lines, 0), INDEX_CATALOG_HEADER)) {
+		logmsg("Index catalog %s has the wrong format; ignoring it\n", fn);
+		cat->modified = TRUE;
+	} else {
+		for (i=1; i<sl_size(lines); i++) {
+			struct index_catalog_entry e;
+			if (!parse_catalog_line(sl_get(lines, i), &e)) {
+				logverb("Ignoring bad line %i in index catalog %s\n", i+1, fn);
+				catalog_entry_free(&e);
+				cat->modified = TRUE;
+				continue;
+			}
+			bl_append(cat->entries, &e);
+		}
+	}
+	sl_free2(lines);
+	logverb("Read %zu entries from index catalog %s\n",
+			bl_size(cat->entries), fn);
+	return cat;
+}
+
+static struct index_catalog_entry* catalog_find(index_catalog_t* cat,
+												const char* name) {
+	size_t i;
+	for (i=0; i<bl_size(cat->entries); i++) {
+		struct index_catalog_entry* e = bl_access(cat->entries, i);
+		if (streq(e->name, name))
+			return e;
+	}
+	return NULL;
+}
+
+index_t* index_catalog_load(index_catalog_t* cat, const char* indexname,
+							int flags) {
+	struct index_catalog_entry* e;
+	index_t* ind;
+	off_t size;
+	time_t mtime;
+	anbool singlefile;
+
+	if (!(flags & INDEX_ONLY_LOAD_METADATA) ||
+		get_file_signature(indexname, &size, &mtime))
+		return index_load(indexname, flags, NULL);
+
+	e = catalog_find(cat, indexname);
+	if (e && e->size == size && e->mtime == mtime) {
+		ind = calloc(1, sizeof(index_t));
+		*ind = e->meta;
+		ind->indexname = strdup(e->meta.indexname);
+		ind->cutband = strdup_safe(e->meta.cutband);
+		get_filenames(indexname, &(ind->quadfn), &(ind->codefn),
+					  &(ind->starfn), &singlefile);
+		ind->prefetch = flags & INDEX_PREFETCH_ALL;
+		debug("Index %s: metadata from catalog\n", indexname);
+		return ind;
+	}
+
+	ind = index_load(indexname, flags, NULL);
+	if (!ind)
+		return NULL;
+	if (e) {
+		logverb("Index %s has changed; updating its catalog entry\n", indexname);
+		catalog_entry_free(e);
+	} else {
+		struct index_catalog_entry newentry;
+		e = bl_append(cat->entries, &newentry);
+	}
+	memset(e, 0, sizeof(struct index_catalog_entry));
+	e->name = strdup(indexname);
+	e->size = size;
+	e->mtime = mtime;
+	e->meta = *ind;
+	e->meta.codekd = NULL;
+	e->meta.quads = NULL;
+	e->meta.starkd = NULL;
+	e->meta.fits = NULL;
+	e->meta.codefn = e->meta.quadfn = e->meta.starfn = NULL;
+	e->meta.indexname = strdup(ind->indexname);
+	e->meta.cutband = strdup_safe(ind->cutband);
+	cat->modified = TRUE;
+	return ind;
+}
+
+int index_catalog_write(index_catalog_t* cat) {
+	char* tmpfn;
+	FILE* fid;
+	size_t i;
+
+	if (!cat->modified)
+		return 0;
+	asprintf_safe(&tmpfn, "%s.tmp", cat->fn);
+	fid = fopen(tmpfn, "w");
+	if (!fid) {
+		SYSERROR("Failed to open index catalog %s for writing", tmpfn);
+		free(tmpfn);
+		return -1;
+	}
+	fprintf(fid, "%s\n", INDEX_CATALOG_HEADER);
+	for (i=0; i<bl_size(cat->entries); i++) {
+		struct index_catalog_entry* e = bl_access(cat->entries, i);
+		index_t* m = &(e->meta);
+		fprintf(fid, "%s\t%lld\t%lld\t%s\t%i\t%i\t%i\t%i\t%i\t%i\t%i\t%i\t%i\t"
+				"%.17g\t%.17g\t%.17g\t%i\t%i\t%.17g\t%i\t%s\n",
+				e->name, (long long)e->size, (long long)e->mtime, m->indexname,
+				m->indexid, m->healpix, m->hpnside, m->dimquads, m->nstars,
+				m->nquads, (int)m->circle, (int)m->cx_less_than_dx,
+				(int)m->meanx_less_than_half, m->index_scale_lower,
+				m->index_scale_upper, m->index_jitter, m->cutnside,
+				m->cutnsweep, m->cutdedup, m->cutmargin,
+				(m->cutband && strlen(m->cutband)) ? m->cutband : "-");
+	}
+	if (fclose(fid)) {
+		SYSERROR("Failed to close index catalog %s", tmpfn);
+		free(tmpfn);
+		return -1;
+	}
+	// replace the old catalog atomically.
+	if (rename(tmpfn, cat->fn)) {
+		SYSERROR("Failed to rename %s to %s", tmpfn, cat->fn);
+		free(tmpfn);
+		return -1;
+	}
+	free(tmpfn);
+	logverb("Wrote %zu entries to index catalog %s\n", bl_size(cat->entries),
+			cat->fn);
+	cat->modified = FALSE;
+	return 0;
+}
+
+void index_catalog_free(index_catalog_t* cat) {
+	size_t i;
+	if (!cat)
+		return;
+	for (i=0; i<bl_size(cat->entries); i++)
+		catalog_entry_free(bl_access(cat->entries, i));
+	bl_free(cat->entries);
+	free(cat->fn);
+	free(cat);
+}
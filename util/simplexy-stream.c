@@ -0,0 +1,675 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <assert.h>
+
+#include "os-features.h"
+#include "simplexy.h"
+#include "dimage.h"
+#include "simplexy-common.h"
+#include "resample.h"
+#include "bl.h"
+#include "bl-sort.h"
+#include "log.h"
+#include "errors.h"
+
+/*
+ * simplexy-stream.c
+ *
+ * simplexy_run_stream(): the simplexy pipeline for float images, run
+ * over an image that is read a band of rows at a time.
+ *
+ * The first pass over the image computes the grid of medians that the
+ * background is interpolated from, and samples the noise.  The second
+ * pass reads the image again, band by band: the background is
+ * subtracted, and the band is smoothed and masked, with enough rows on
+ * either side that the results are exactly those for the whole image.
+ * Connected components are tracked from row to row as runs of masked
+ * pixels; when one ends, it is relabelled within its bounding box and
+ * its peaks are found.  Only the rows that a component still in
+ * progress might need are kept.
+ *
+ * The sources found are the same as simplexy_run()'s, in the same order.
+ */
+
+// A window of consecutive image rows, [y0, y1).
+struct rowbuf {
+	char* data;
+	size_t rowbytes;
+	int y0, y1;
+	// rows allocated.
+	int cap;
+	// most rows held at once.
+	int maxrows;
+};
+
+// A connected component, as seen so far.
+struct comp {
+	int parent;
+	int xmin, xmax, ymin, ymax;
+	// raster index of its first pixel: dfind2() numbers components in
+	// this order, and dallpeaks() visits them in it.
+	int64_t first;
+	// last row it had pixels in.
+	int lastrow;
+};
+
+// A run of masked pixels in one row.
+struct run {
+	int xlo, xhi;
+	int comp;
+};
+
+struct peak {
+	int64_t first;
+	int rank;
+	float x, y, flux, background, fluxL, backgroundL;
+};
+
+struct stream {
+	simplexy_t* s;
+	simplexy_read_rows_func readrows;
+	void* token;
+	int nx, ny;
+	int nthreads;
+
+	// median grid.
+	int nxgrid, nygrid;
+	int *xgrid, *ygrid, *xlo, *xhi, *ylo, *yhi;
+	float* grid;
+
+	struct rowbuf img;
+	// background-subtracted image; (shares "img" if s->nobgsub)
+	struct rowbuf bgbuf;
+	struct rowbuf* bg;
+	struct rowbuf mask;
+
+	struct comp* comps;
+	int ncomps, capcomps;
+	il* freecomps;
+	// components joined to another in the current row.
+	il* merged;
+	il* completed;
+	struct run* prev;
+	struct run* cur;
+	int nprev;
+	int nblobs;
+
+	// scratch for relabelling a component.
+	uint8_t* mcut;
+	float* icut;
+	int* ocut;
+	size_t ncut;
+	float* px;
+	float* py;
+
+	bl* peaks;
+};
+
+static void* rowbuf_row(const struct rowbuf* rb, int y) {
+	assert(y >= rb->y0 && y < rb->y1);
+	return rb->data + (size_t)(y - rb->y0) * rb->rowbytes;
+}
+
+/*
+ Extends the window to end at row "yhi", forgetting the rows before
+ "keep" if it has to make room.  Returns where the new rows go.
+ */
+static void* rowbuf_extend(struct rowbuf* rb, int keep, int yhi) {
+	int y1 = rb->y1;
+	if (yhi <= y1)
+		return NULL;
+	if (yhi - rb->y0 > rb->cap) {
+		keep = MIN(keep, y1);
+		if (keep > rb->y0) {
+			memmove(rb->data, rb->data + (size_t)(keep - rb->y0) * rb->rowbytes,
+					(size_t)(y1 - keep) * rb->rowbytes);
+			rb->y0 = keep;
+		}
+	}
+	if (yhi - rb->y0 > rb->cap) {
+		rb->cap = yhi - rb->y0;
+		rb->data = realloc(rb->data, (size_t)rb->cap * rb->rowbytes);
+	}
+	rb->y1 = yhi;
+	rb->maxrows = MAX(rb->maxrows, yhi - rb->y0);
+	return rowbuf_row(rb, y1);
+}
+
+static int read_rows(struct stream* st, int y0, int nrows, float* rows) {
+	int i;
+	if (st->readrows(st->token, y0, nrows, rows)) {
+		ERROR("Failed to read image rows %i to %i", y0, y0 + nrows - 1);
+		return -1;
+	}
+	if (st->s->invert)
+		for (i=0; i<nrows * st->nx; i++)
+			rows[i] = -rows[i];
+	return 0;
+}
+
+// Reads image rows up to "yhi" (keeping those from "keep" on).
+static int load_image_rows(struct stream* st, int keep, int yhi) {
+	int y1 = st->img.y1;
+	float* rows = rowbuf_extend(&st->img, keep, yhi);
+	if (!rows)
+		return 0;
+	return read_rows(st, y1, yhi - y1, rows);
+}
+
+// Reads image rows up to "yhi", and subtracts their background.
+static int load_rows(struct stream* st, int keep, int yhi) {
+	int y1 = st->img.y1;
+	float* bg;
+	const float* img;
+	size_t i, n;
+
+	if (load_image_rows(st, keep, yhi))
+		return -1;
+	if (st->s->nobgsub || yhi <= y1)
+		return 0;
+	assert(st->bgbuf.y1 == y1);
+	bg = rowbuf_extend(&st->bgbuf, keep, yhi);
+	dmedsmooth_interpolate_rows(st->grid, st->nx, st->ny, st->nxgrid, st->nygrid,
+								st->xgrid, st->ygrid, st->s->halfbox, y1, yhi,
+								bg, st->nthreads);
+	img = rowbuf_row(&st->img, y1);
+	n = (size_t)(yhi - y1) * st->nx;
+	for (i=0; i<n; i++)
+		bg[i] = img[i] - bg[i];
+	return 0;
+}
+
+// The grid of medians, from bands of rows.
+static int median_grid(struct stream* st) {
+	int halfbox = st->s->halfbox;
+	int ja, jb;
+
+	dmedsmooth_gridpoints(st->nx, halfbox, &st->nxgrid, &st->xgrid,
+						  &st->xlo, &st->xhi);
+	dmedsmooth_gridpoints(st->ny, halfbox, &st->nygrid, &st->ygrid,
+						  &st->ylo, &st->yhi);
+	st->grid = malloc((size_t)st->nxgrid * st->nygrid * sizeof(float));
+	for (ja=0; ja<st->nygrid; ja=jb) {
+		// as many grid rows as fit in a band (but at least one).
+		for (jb=ja+1; jb<st->nygrid; jb++)
+			if (st->yhi[jb] + 1 - st->ylo[ja] >
+				MAX(st->s->bandrows, 2*halfbox + 1))
+				break;
+		if (load_image_rows(st, st->ylo[ja], st->yhi[jb-1] + 1))
+			return -1;
+		dmedsmooth_grid_rows(rowbuf_row(&st->img, st->img.y0), st->img.y0,
+							 st->nx, halfbox, st->nxgrid, st->xlo, st->xhi,
+							 st->ylo, st->yhi, ja, jb, st->grid, st->s->bgmedian,
+							 st->nthreads);
+	}
+	return 0;
+}
+
+// dsigma(), reading just the pairs of rows it samples.
+static int sample_sigma(struct stream* st, float* sigma) {
+	int nx = st->nx, ny = st->ny;
+	int sp = 5;
+	int gridsize = 20;
+	int i, j, n, dx, dy, ndiff;
+	float *diff, *a, *b;
+	int rtn = -1;
+
+	*sigma = 0.;
+	if (nx == 1 && ny == 1)
+		return 0;
+	dx = MIN(gridsize, nx / 4);
+	if (dx <= 0)
+		dx = 1;
+	dy = MIN(gridsize, ny / 4);
+	if (dy <= 0)
+		dy = 1;
+	ndiff = ((nx-sp + dx-1)/dx) * ((ny-sp + dy-1)/dy);
+	if (ndiff <= 1)
+		return 0;
+
+	logverb("Sampling sigma at %i points\n", ndiff);
+	diff = malloc(ndiff * sizeof(float));
+	a = malloc(2 * nx * sizeof(float));
+	b = a + nx;
+	n = 0;
+	for (j = 0; j < ny-sp; j += dy) {
+		if (read_rows(st, j, 1, a) || read_rows(st, j + sp, 1, b))
+			goto bailout;
+		for (i = 0; i < nx-sp; i += dx) {
+			diff[n] = fabs(a[i] - b[i + sp]);
+			n++;
+		}
+	}
+	dsigma_diffs(diff, ndiff, sigma);
+	rtn = 0;
+ bailout:
+	free(a);
+	free(diff);
+	return rtn;
+}
+
+static int comp_find(struct stream* st, int c) {
+	while (st->comps[c].parent != c)
+		c = st->comps[c].parent;
+	return c;
+}
+
+static int comp_new(struct stream* st, int x, int y) {
+	struct comp* C;
+	int c;
+	if (il_size(st->freecomps))
+		c = il_pop(st->freecomps);
+	else {
+		if (st->ncomps == st->capcomps) {
+			st->capcomps = MAX(256, 2 * st->capcomps);
+			st->comps = realloc(st->comps, st->capcomps * sizeof(struct comp));
+		}
+		c = st->ncomps++;
+	}
+	C = st->comps + c;
+	C->parent = c;
+	C->xmin = C->xmax = x;
+	C->ymin = C->ymax = y;
+	C->first = (int64_t)y * st->nx + x;
+	C->lastrow = -1;
+	st->nblobs++;
+	return c;
+}
+
+// Joins two components; the one that started first stays the root.
+static int comp_union(struct stream* st, int a, int b) {
+	struct comp *A, *B;
+	if (st->comps[b].first < st->comps[a].first) {
+		int t = a;
+		a = b;
+		b = t;
+	}
+	A = st->comps + a;
+	B = st->comps + b;
+	B->parent = a;
+	A->xmin = MIN(A->xmin, B->xmin);
+	A->xmax = MAX(A->xmax, B->xmax);
+	A->ymin = MIN(A->ymin, B->ymin);
+	A->ymax = MAX(A->ymax, B->ymax);
+	il_append(st->merged, b);
+	st->nblobs--;
+	return a;
+}
+
+static anbool comp_too_big(const struct stream* st, const struct comp* C) {
+	return (C->xmax - C->xmin + 1 > st->s->maxsize ||
+			C->ymax - C->ymin + 1 > st->s->maxsize);
+}
+
+static void queue_completed(struct stream* st, int y) {
+	int i;
+	for (i=0; i<st->nprev; i++) {
+		int c = comp_find(st, st->prev[i].comp);
+		if (st->comps[c].lastrow == y)
+			continue;
+		st->comps[c].lastrow = y;
+		il_append(st->completed, c);
+	}
+}
+
+// Runs of row "y" of the mask, joined to the components above them.
+static void track_row(struct stream* st, int y) {
+	const uint8_t* m = rowbuf_row(&st->mask, y);
+	struct run* tmp;
+	int nx = st->nx;
+	int ncur = 0;
+	int p = 0;
+	int i, x;
+
+	for (x=0; x<nx;) {
+		int xa, xb, q;
+		int c = -1;
+		struct comp* C;
+		if (!m[x]) {
+			x++;
+			continue;
+		}
+		xa = x;
+		while (x < nx && m[x])
+			x++;
+		xb = x - 1;
+		// runs in the row above that touch this one (diagonals count).
+		while (p < st->nprev && st->prev[p].xhi < xa - 1)
+			p++;
+		for (q=p; q<st->nprev && st->prev[q].xlo <= xb + 1; q++) {
+			int r = comp_find(st, st->prev[q].comp);
+			if (c == -1)
+				c = r;
+			else if (r != c)
+				c = comp_union(st, c, r);
+		}
+		if (c == -1)
+			c = comp_new(st, xa, y);
+		C = st->comps + c;
+		C->xmin = MIN(C->xmin, xa);
+		C->xmax = MAX(C->xmax, xb);
+		C->ymax = y;
+		st->cur[ncur].xlo = xa;
+		st->cur[ncur].xhi = xb;
+		st->cur[ncur].comp = c;
+		ncur++;
+	}
+
+	for (i=0; i<ncur; i++) {
+		st->cur[i].comp = comp_find(st, st->cur[i].comp);
+		st->comps[st->cur[i].comp].lastrow = y;
+	}
+	// components in the row above with nothing in this row are done.
+	queue_completed(st, y);
+	for (i=0; i<il_size(st->merged); i++)
+		il_append(st->freecomps, il_get(st->merged, i));
+	il_remove_all(st->merged);
+
+	tmp = st->prev;
+	st->prev = st->cur;
+	st->cur = tmp;
+	st->nprev = ncur;
+}
+
+static void measure_peak(struct stream* st, struct peak* pk) {
+	simplexy_t* s = st->s;
+	int ix = (int)(pk->x + 0.5);
+	int iy = (int)(pk->y + 0.5);
+	const float* bgrow = rowbuf_row(st->bg, iy);
+	const float* imgrow = rowbuf_row(&st->img, iy);
+
+	assert(ix >= 0 && ix < st->nx);
+	pk->flux = bgrow[ix];
+	pk->background = imgrow[ix] - pk->flux;
+	pk->flux -= s->globalbg;
+	pk->background += s->globalbg;
+
+	if (s->Lorder) {
+		lanczos_args_t L;
+		double fL, iL;
+		// the window holds at least Lorder + 1 rows beyond the peak,
+		// or reaches the image edge.
+		int wy0 = st->bg->y0;
+		memset(&L, 0, sizeof(lanczos_args_t));
+		L.order = s->Lorder;
+		fL = lanczos_resample_unw_sep_f(pk->x, (double)pk->y - wy0,
+										rowbuf_row(st->bg, wy0), st->nx,
+										st->bg->y1 - wy0, &L);
+		iL = lanczos_resample_unw_sep_f(pk->x, (double)pk->y - wy0,
+										rowbuf_row(&st->img, wy0), st->nx,
+										st->img.y1 - wy0, &L);
+		pk->fluxL = fL;
+		pk->backgroundL = iL - fL;
+		pk->fluxL -= s->globalbg;
+		pk->backgroundL += s->globalbg;
+	}
+}
+
+// Finds the peaks of a finished component.
+static void process_comp(struct stream* st, int c) {
+	simplexy_t* s = st->s;
+	struct comp C = st->comps[c];
+	int onx = C.xmax - C.xmin + 1;
+	int ony = C.ymax - C.ymin + 1;
+	int fx = (int)(C.first % st->nx);
+	int fy = (int)(C.first / st->nx);
+	int nmax = MIN(s->maxper, s->maxnpeaks);
+	int j, k, n, label;
+
+	il_append(st->freecomps, c);
+	if (comp_too_big(st, &C)) {
+		logverb("Skipping object at (%i, %i): too big, %ix%i (x %i:%i, y %i:%i)\n",
+				fx, fy, onx, ony, C.xmin, C.xmax, C.ymin, C.ymax);
+		return;
+	}
+	if (onx < 3 || ony < 3) {
+		logverb("Skipping object at (%i, %i): too small, %ix%i (x %i:%i, y %i:%i)\n",
+				fx, fy, onx, ony, C.xmin, C.xmax, C.ymin, C.ymax);
+		return;
+	}
+
+	if ((size_t)onx * ony > st->ncut) {
+		st->ncut = (size_t)onx * ony;
+		st->mcut = realloc(st->mcut, st->ncut);
+		st->icut = realloc(st->icut, st->ncut * sizeof(float));
+		st->ocut = realloc(st->ocut, st->ncut * sizeof(int));
+	}
+	for (j=0; j<ony; j++) {
+		const uint8_t* m = rowbuf_row(&st->mask, C.ymin + j);
+		const float* b = rowbuf_row(st->bg, C.ymin + j);
+		memcpy(st->mcut + (size_t)j * onx, m + C.xmin, onx);
+		memcpy(st->icut + (size_t)j * onx, b + C.xmin, onx * sizeof(float));
+	}
+	// other components can reach into the bounding box; this one is the
+	// one holding the first pixel.
+	dfind2_u8(st->mcut, onx, ony, st->ocut, NULL);
+	label = st->ocut[(fy - C.ymin) * onx + (fx - C.xmin)];
+
+	n = dallpeaks_object(st->icut, st->ocut, label, C.xmin, C.xmax, C.ymin,
+						 C.ymax, s->dpsf, s->sigma, s->dlim, s->saddle,
+						 s->maxper, s->sigma, s->maxsize, nmax, st->px, st->py);
+	for (k=0; k<n; k++) {
+		struct peak pk;
+		memset(&pk, 0, sizeof(struct peak));
+		pk.first = C.first;
+		pk.rank = k;
+		pk.x = st->px[k];
+		pk.y = st->py[k];
+		measure_peak(st, &pk);
+		bl_append(st->peaks, &pk);
+	}
+}
+
+static void process_completed(struct stream* st) {
+	int i;
+	for (i=0; i<il_size(st->completed); i++)
+		process_comp(st, il_get(st->completed, i));
+	il_remove_all(st->completed);
+}
+
+// The first row that components still in progress might need.
+static int rows_needed_from(struct stream* st, int y) {
+	int i;
+	for (i=0; i<st->nprev; i++) {
+		const struct comp* C = st->comps + comp_find(st, st->prev[i].comp);
+		if (!comp_too_big(st, C))
+			y = MIN(y, C->ymin - (st->s->Lorder + 3));
+	}
+	return MAX(0, y);
+}
+
+static int compare_peaks(const void* v1, const void* v2) {
+	const struct peak* p1 = v1;
+	const struct peak* p2 = v2;
+	if (p1->first != p2->first)
+		return (p1->first < p2->first) ? -1 : 1;
+	return p1->rank - p2->rank;
+}
+
+static void stream_free(struct stream* st) {
+	free(st->xgrid);
+	free(st->ygrid);
+	free(st->xlo);
+	free(st->xhi);
+	free(st->ylo);
+	free(st->yhi);
+	free(st->grid);
+	free(st->img.data);
+	free(st->bgbuf.data);
+	free(st->mask.data);
+	free(st->comps);
+	il_free(st->freecomps);
+	il_free(st->merged);
+	il_free(st->completed);
+	free(st->prev);
+	free(st->cur);
+	free(st->mcut);
+	free(st->icut);
+	free(st->ocut);
+	free(st->px);
+	free(st->py);
+	bl_free(st->peaks);
+}
+
+int simplexy_run_stream(simplexy_t* s, simplexy_read_rows_func readrows,
+						void* token) {
+	struct stream st;
+	int nx = s->nx;
+	int ny = s->ny;
+	int bandrows;
+	// half-widths of the smoothing kernel and of the mask box.
+	int hs, hm;
+	// rows beyond a band that have to be loaded with it.
+	int ahead;
+	float limit;
+	float* smoothed = NULL;
+	anbool flagged = FALSE;
+	int b0, b1, i, N;
+	int rtn = -1;
+
+	assert(!s->image && !s->image_u8);
+	if (s->bandrows <= 0)
+		s->bandrows = SIMPLEXY_DEFAULT_BANDROWS;
+	bandrows = s->bandrows;
+
+	memset(&st, 0, sizeof(struct stream));
+	st.s = s;
+	st.readrows = readrows;
+	st.token = token;
+	st.nx = nx;
+	st.ny = ny;
+	st.nthreads = MAX(1, s->nthreads);
+	st.img.rowbytes = nx * sizeof(float);
+	st.bgbuf.rowbytes = nx * sizeof(float);
+	st.mask.rowbytes = nx;
+	st.bg = (s->nobgsub ? &st.img : &st.bgbuf);
+	st.freecomps = il_new(256);
+	st.merged = il_new(256);
+	st.completed = il_new(256);
+	st.prev = malloc((nx/2 + 1) * sizeof(struct run));
+	st.cur  = malloc((nx/2 + 1) * sizeof(struct run));
+	st.px = malloc(s->maxper * sizeof(float));
+	st.py = malloc(s->maxper * sizeof(float));
+	st.peaks = bl_new(1024, sizeof(struct peak));
+
+	logverb("simplexy: nx=%d, ny=%d, in bands of %d rows\n", nx, ny, bandrows);
+	logverb("simplexy: dpsf=%f, plim=%f, dlim=%f, saddle=%f\n",
+			s->dpsf, s->plim, s->dlim, s->saddle);
+	logverb("simplexy: maxper=%d, maxnpeaks=%d, maxsize=%d, halfbox=%d\n",
+			s->maxper, s->maxnpeaks, s->maxsize, s->halfbox);
+	if (st.nthreads > 1)
+		logverb("simplexy: using %i threads\n", st.nthreads);
+	if (s->bgimgfn || s->maskimgfn || s->blobimgfn || s->bgsubimgfn ||
+		s->smoothimgfn)
+		logmsg("simplexy: not writing intermediate images: the image is read in bands\n");
+
+	if (!s->nobgsub) {
+		logverb("simplexy: median smoothing...\n");
+		if (median_grid(&st))
+			goto bailout;
+	}
+
+	if (s->sigma == 0.0) {
+		logverb("simplexy: measuring image noise (sigma)...\n");
+		if (sample_sigma(&st, &(s->sigma)))
+			goto bailout;
+		logverb("simplexy: found sigma=%g.\n", s->sigma);
+	} else {
+		logverb("simplexy: assuming sigma=%g.\n", s->sigma);
+	}
+
+	logverb("simplexy: finding objects...\n");
+	limit = (s->sigma / (2.0 * sqrt(M_PI) * s->dpsf)) * s->plim;
+	if (s->globalbg != 0.0) {
+		limit += s->globalbg;
+		logverb("Increased detection limit by %g to %g to compensate for global background level\n", s->globalbg, limit);
+	}
+
+	hs = (s->dpsf > 0) ? (int)ceilf(3.0 * s->dpsf) : 0;
+	hm = 3 * s->dpsf;
+	ahead = MAX(hs + hm, s->Lorder + 3);
+	if (s->dpsf > 0.0)
+		smoothed = malloc((size_t)(bandrows + 2*(hs + hm)) * nx * sizeof(float));
+
+	// forget the first pass's rows.
+	st.img.y0 = st.img.y1 = 0;
+
+	for (b0=0; b0<ny; b0=b1) {
+		int sa, sc, keep;
+		const float* sm;
+		uint8_t* mrows;
+		b1 = MIN(ny, b0 + bandrows);
+		// rows needed to smooth and mask this band...
+		sa = MAX(0, b0 - hm - hs);
+		sc = MIN(ny, b1 + hm + hs);
+		// ...and by components still in progress, or starting in it.
+		keep = rows_needed_from(&st, MIN(sa, b0 - (s->Lorder + 3)));
+		if (load_rows(&st, keep, MIN(ny, b1 + ahead)))
+			goto bailout;
+		if (s->dpsf > 0.0) {
+			dsmooth2_threads(rowbuf_row(st.bg, sa), nx, sc - sa, s->dpsf,
+							 smoothed, st.nthreads);
+			sm = smoothed;
+		} else
+			sm = rowbuf_row(st.bg, sa);
+		mrows = rowbuf_extend(&st.mask, keep, b1);
+		if (dmask_rows_threads(sm, nx, sc - sa, limit, s->dpsf, b0 - sa, b1 - sa,
+							   mrows, st.nthreads))
+			flagged = TRUE;
+		for (i=b0; i<b1; i++)
+			track_row(&st, i);
+		process_completed(&st);
+	}
+	// everything left ends at the last row.
+	queue_completed(&st, ny);
+	process_completed(&st);
+
+	logverb("simplexy: kept at most %i image rows, %i mask rows\n",
+			st.img.maxrows, st.mask.maxrows);
+	if (!flagged) {
+		logverb("No pixels were marked as significant.\n"
+				"  significance threshold = %g\n", limit);
+		s->npeaks = 0;
+		rtn = 0;
+		goto bailout;
+	}
+	logverb("simplexy: found %i blobs\n", st.nblobs);
+
+	bl_sort(st.peaks, compare_peaks);
+	N = MIN(bl_size(st.peaks), s->maxnpeaks);
+	s->npeaks = N;
+	logmsg("simplexy: found %i sources.\n", N);
+	s->x          = malloc(N * sizeof(float));
+	s->y          = malloc(N * sizeof(float));
+	s->flux       = malloc(N * sizeof(float));
+	s->background = malloc(N * sizeof(float));
+	if (s->Lorder) {
+		s->fluxL       = malloc(N * sizeof(float));
+		s->backgroundL = malloc(N * sizeof(float));
+	}
+	for (i=0; i<N; i++) {
+		const struct peak* pk = bl_access(st.peaks, i);
+		s->x[i] = pk->x;
+		s->y[i] = pk->y;
+		s->flux[i] = pk->flux;
+		s->background[i] = pk->background;
+		if (s->Lorder) {
+			s->fluxL[i] = pk->fluxL;
+			s->backgroundL[i] = pk->backgroundL;
+		}
+	}
+	rtn = 0;
+
+ bailout:
+	free(smoothed);
+	stream_free(&st);
+	return rtn;
+}
@@ -153,6 +153,66 @@ void simplexy_set_defaults(simplexy_t* s) {
     simplexy_fill_in_defaults(s);
 }
 
+/*
+ The intermediate images of simplexy_run(), kept between calls so that
+ a series of images doesn't have to allocate (and fault in) them afresh
+ each time.  Buffers only grow.
+ */
+enum {
+	WS_BGSUB,
+	WS_BGSUB_I16,
+	WS_MEDIAN_U8,
+	WS_SMOOTHED,
+	WS_MASK,
+	WS_CCIMG,
+	WS_NBUFFERS
+};
+
+struct simplexy_workspace {
+	void* buf[WS_NBUFFERS];
+	size_t size[WS_NBUFFERS];
+};
+
+simplexy_workspace_t* simplexy_workspace_new(void) {
+	return calloc(1, sizeof(simplexy_workspace_t));
+}
+
+void simplexy_workspace_free(simplexy_workspace_t* ws) {
+	int i;
+	if (!ws)
+		return;
+	for (i=0; i<WS_NBUFFERS; i++)
+		free(ws->buf[i]);
+	free(ws);
+}
+
+// Returns buffer "which", at least "nbytes" long; its contents are junk.
+static void* ws_buffer(simplexy_workspace_t* ws, int which, size_t nbytes) {
+	if (nbytes > ws->size[which]) {
+		// no realloc(): the old contents aren't wanted.
+		free(ws->buf[which]);
+		ws->buf[which] = malloc(nbytes);
+		if (!ws->buf[which]) {
+			SYSERROR("Failed to allocate %zu bytes for simplexy", nbytes);
+			ws->size[which] = 0;
+			return NULL;
+		}
+		ws->size[which] = nbytes;
+	}
+	return ws->buf[which];
+}
+
+// Frees buffer "which" once it's no longer needed, if "ws" is only for
+// this call; otherwise, it's kept for the next image.
+static void ws_done(simplexy_workspace_t* ws, simplexy_workspace_t* wsfree,
+					int which) {
+	if (ws != wsfree)
+		return;
+	free(ws->buf[which]);
+	ws->buf[which] = NULL;
+	ws->size[which] = 0;
+}
+
 void simplexy_free_contents(simplexy_t* s) {
 	free(s->image);
 	s->image = NULL;
@@ -180,15 +240,16 @@ int simplexy_run(simplexy_t* s) {
 	// background-subtracted image.
 	float* bgsub = NULL;
 	int16_t* bgsub_i16 = NULL;
-	// malloc'd background image to free.
-	void* bgfree = NULL;
 	// PSF-smoothed image.
 	float* smoothed = NULL;
-	// malloc'd smoothed image to free.
-	void* smoothfree = NULL;
 	// Connected-components image.
 	int* ccimg = NULL;
 	int nblobs;
+	int nthreads = MAX(1, s->nthreads);
+	size_t npix = (size_t)nx * ny;
+	simplexy_workspace_t* ws = s->workspace;
+	// workspace to free, if the caller didn't give one.
+	simplexy_workspace_t* wsfree = NULL;
  
     /* Exactly one of s->image and s->image_u8 should be non-NULL.*/
     assert(s->image || s->image_u8);
@@ -199,6 +260,8 @@ int simplexy_run(simplexy_t* s) {
             s->dpsf, s->plim, s->dlim, s->saddle);
     logverb("simplexy: maxper=%d, maxnpeaks=%d, maxsize=%d, halfbox=%d\n",
             s->maxper, s->maxnpeaks, s->maxsize, s->halfbox);
+	if (nthreads > 1)
+		logverb("simplexy: using %i threads\n", nthreads);
 
 	if (s->invert) {
 		if (s->image) {
@@ -210,12 +273,14 @@ int simplexy_run(simplexy_t* s) {
 		}
 	}
 
+	if (!ws)
+		ws = wsfree = simplexy_workspace_new();
+
 	if (s->nobgsub) {
 		if (s->image)
 			bgsub = s->image;
 		else {
-			bgsub_i16 = malloc(nx * ny * sizeof(int16_t));
-			bgfree = bgsub_i16;
+			bgsub_i16 = ws_buffer(ws, WS_BGSUB_I16, npix * sizeof(int16_t));
 			for (i=0; i<nx*ny; i++)
 				bgsub_i16[i] = s->image_u8[i];
 		}
@@ -226,9 +291,11 @@ int simplexy_run(simplexy_t* s) {
 
 		if (s->image) {
 			float* medianfiltered;
-			medianfiltered = malloc(nx * ny * sizeof(float));
-			bgfree = medianfiltered;
-			dmedsmooth(s->image, NULL, nx, ny, s->halfbox, medianfiltered);
+			medianfiltered = ws_buffer(ws, WS_BGSUB, npix * sizeof(float));
+			if (s->bgmedian == DMEDSMOOTH_BINNED)
+				logverb("simplexy: (using binned medians)\n");
+			dmedsmooth_method_threads(s->image, NULL, nx, ny, s->halfbox,
+									  s->bgmedian, medianfiltered, nthreads);
 
 			if (s->bgimgfn) {
 				logverb("Writing background (median-filtered) image \"%s\"\n", s->bgimgfn);
@@ -249,8 +316,9 @@ int simplexy_run(simplexy_t* s) {
 				s->halfbox = floor(((float)MIN(nx,ny) - 1.0) / 2.0);
 			assert(MIN(nx,ny) >= 2*s->halfbox+1);
 
-			medianfiltered_u8 = malloc(nx * ny * sizeof(unsigned char));
-			ctmf(s->image_u8, medianfiltered_u8, nx, ny, nx, nx, s->halfbox, 1, 512*1024);
+			medianfiltered_u8 = ws_buffer(ws, WS_MEDIAN_U8, npix);
+			ctmf_threads(s->image_u8, medianfiltered_u8, nx, ny, nx, nx, s->halfbox, 1,
+						 512*1024, nthreads);
 
 			if (s->bgimgfn) {
 				logverb("Writing background (median-filtered) image \"%s\"\n", s->bgimgfn);
@@ -258,12 +326,11 @@ int simplexy_run(simplexy_t* s) {
 			}
 
 			// Background-subtracted image.
-			bgsub_i16 = malloc(nx * ny * sizeof(int16_t));
-			bgfree = bgsub_i16;
+			bgsub_i16 = ws_buffer(ws, WS_BGSUB_I16, npix * sizeof(int16_t));
 			for (i=0; i<nx*ny; i++)
 				//bgsub_i16[i] = (int16_t)s->image_u8[i] - (int16_t)medianfiltered_u8[i];
 				bgsub_i16[i] = s->image_u8[i] - medianfiltered_u8[i];
-			free(medianfiltered_u8);
+			ws_done(ws, wsfree, WS_MEDIAN_U8);
 		}
 
 		if (s->bgsubimgfn) {
@@ -276,20 +343,18 @@ int simplexy_run(simplexy_t* s) {
 	}
 
 	if (s->dpsf > 0.0) {
-		smoothed = malloc(nx * ny * sizeof(float));
-		smoothfree = smoothed;
+		smoothed = ws_buffer(ws, WS_SMOOTHED, npix * sizeof(float));
 		/* smooth by the point spread function (the optimal detection
 		 filter, since we assume a symmetric Gaussian PSF) */
 		if (bgsub)
-			dsmooth2(bgsub, nx, ny, s->dpsf, smoothed);
+			dsmooth2_threads(bgsub, nx, ny, s->dpsf, smoothed, nthreads);
 		else
-			dsmooth2_i16(bgsub_i16, nx, ny, s->dpsf, smoothed);
+			dsmooth2_i16_threads(bgsub_i16, nx, ny, s->dpsf, smoothed, nthreads);
 	} else {
 		if (bgsub)
 			smoothed = bgsub;
 		else {
-			smoothed = malloc(nx * ny * sizeof(float));
-			smoothfree = smoothed;
+			smoothed = ws_buffer(ws, WS_SMOOTHED, npix * sizeof(float));
 			for (i=0; i<(nx*ny); i++)
 				smoothed[i] = bgsub_i16[i];
 		}
@@ -328,12 +393,12 @@ int simplexy_run(simplexy_t* s) {
 	}
 
 	/* find pixels above the noise level, and flag a box of pixels around each one. */
-	mask = malloc(nx*ny);
-	if (!dmask(smoothed, nx, ny, limit, s->dpsf, mask)) {
-		FREEVEC(smoothfree);
+	mask = ws_buffer(ws, WS_MASK, npix);
+	if (!dmask_threads(smoothed, nx, ny, limit, s->dpsf, mask, nthreads)) {
+		simplexy_workspace_free(wsfree);
 		return 0;
 	}
-	FREEVEC(smoothfree);
+	ws_done(ws, wsfree, WS_SMOOTHED);
 
 	/* save the mask image, if requested. */
 	if (s->maskimgfn) {
@@ -354,10 +419,10 @@ int simplexy_run(simplexy_t* s) {
 	}
 
 	/* find connected-components in the mask image. */
-	ccimg = malloc(nx * ny * sizeof(int));
-	dfind2_u8(mask, nx, ny, ccimg, &nblobs);
-	FREEVEC(mask);
+	ccimg = ws_buffer(ws, WS_CCIMG, npix * sizeof(int));
+	dfind2_u8_threads(mask, nx, ny, ccimg, &nblobs, nthreads);
 	logverb("simplexy: found %i blobs\n", nblobs);
+	ws_done(ws, wsfree, WS_MASK);
 
 	if (s->blobimgfn) {
 		int j;
@@ -392,13 +457,16 @@ int simplexy_run(simplexy_t* s) {
 	/* find all peaks within each object */
     logverb("simplexy: finding peaks...\n");
 	if (bgsub)
-		dallpeaks(bgsub, nx, ny, ccimg, s->x, s->y, &(s->npeaks), s->dpsf,
-				  s->sigma, s->dlim, s->saddle, s->maxper, s->maxnpeaks, s->sigma, s->maxsize);
+		dallpeaks_threads(bgsub, nx, ny, ccimg, nblobs, s->x, s->y, &(s->npeaks),
+						  s->dpsf, s->sigma, s->dlim, s->saddle, s->maxper,
+						  s->maxnpeaks, s->sigma, s->maxsize, nthreads);
 	else
-		dallpeaks_i16(bgsub_i16, nx, ny, ccimg, s->x, s->y, &(s->npeaks), s->dpsf,
-					  s->sigma, s->dlim, s->saddle, s->maxper, s->maxnpeaks, s->sigma, s->maxsize);
+		dallpeaks_i16_threads(bgsub_i16, nx, ny, ccimg, nblobs, s->x, s->y,
+							  &(s->npeaks), s->dpsf, s->sigma, s->dlim,
+							  s->saddle, s->maxper, s->maxnpeaks, s->sigma,
+							  s->maxsize, nthreads);
+	ws_done(ws, wsfree, WS_CCIMG);
     logmsg("simplexy: found %i sources.\n", s->npeaks);
-	FREEVEC(ccimg);
 
     s->x   = realloc(s->x, s->npeaks * sizeof(float));
     s->y   = realloc(s->y, s->npeaks * sizeof(float));
@@ -438,6 +506,7 @@ int simplexy_run(simplexy_t* s) {
 		if (s->Lorder) {
 			lanczos_args_t L;
 			double fL, iL;
+			memset(&L, 0, sizeof(lanczos_args_t));
 			L.order = s->Lorder;
 			if (bgsub) {
 				/*
@@ -453,7 +522,9 @@ int simplexy_run(simplexy_t* s) {
 
 			} else {
 				int N = 2*L.order+1;
-				float* tempimg = malloc(N*N*sizeof(float));
+				// (zeroed: near the image edges, only part of it is
+				// filled, and the rest must not contribute.)
+				float* tempimg = calloc(N*N, sizeof(float));
 				int xlo,xhi,ylo,yhi;
 				int j,k;
 				xlo = MAX(0, ix-L.order);
@@ -486,7 +557,7 @@ int simplexy_run(simplexy_t* s) {
 
     }
 
-	FREEVEC(bgfree);
+	simplexy_workspace_free(wsfree);
 
 	return 1;
 }
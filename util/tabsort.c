@@ -26,6 +26,7 @@ int tabsort(const char* infn, const char* outfn, const char* colname,
     int* perm = NULL;
     unsigned char* map = NULL;
     size_t mapsize = 0;
+    unsigned char* rowbuf = NULL;
     anqfits_t* anq = NULL;
 
     fin = fopen(infn, "rb");
@@ -68,6 +69,7 @@ int tabsort(const char* infn, const char* outfn, const char* colname,
 		unsigned char* tablehdr;
 		off_t hdrstart, hdrsize, datsize, datstart;
 		int i;
+		int chunk;
 
         hdrstart = anqfits_header_start(anq, ext);
         hdrsize  = anqfits_header_size (anq, ext);
@@ -146,12 +148,18 @@ int tabsort(const char* infn, const char* outfn, const char* colname,
             goto bailout;
 		}
 
-		for (i=0; i<table->nr; i++) {
-			unsigned char* rowptr;
-            if (i % 100000 == 0)
+		// Gather the rows into a buffer and write it out a chunk at a time.
+		chunk = MAX(1, 65536 / table->tab_w);
+		rowbuf = realloc(rowbuf, (size_t)chunk * table->tab_w);
+		for (i=0; i<table->nr; i+=chunk) {
+			int j, n = MIN(chunk, table->nr - i);
+            if (i == 0 || i / 100000 != (i + n) / 100000)
                 printf("Writing row %i\n", i);
-			rowptr = tabledata + (off_t)(perm[i]) * (off_t)table->tab_w;
-			if (fwrite(rowptr, 1, table->tab_w, fout) != table->tab_w) {
+			for (j=0; j<n; j++)
+				memcpy(rowbuf + (size_t)j * table->tab_w,
+					   tabledata + (off_t)(perm[i+j]) * (off_t)table->tab_w,
+					   table->tab_w);
+			if (fwrite(rowbuf, table->tab_w, n, fout) != n) {
 				SYSERROR("Failed to write FITS table row");
                 goto bailout;
 			}
@@ -170,6 +178,7 @@ int tabsort(const char* infn, const char* outfn, const char* colname,
         qfits_table_close(table);
 	}
 	free(data);
+	free(rowbuf);
 
 	if (fclose(fout)) {
 		SYSERROR("Error closing output file");
@@ -183,6 +192,7 @@ int tabsort(const char* infn, const char* outfn, const char* colname,
 
  bailout:
     free(data);
+    free(rowbuf);
     free(perm);
     if (fout)
         fclose(fout);
@@ -0,0 +1,303 @@
+
+
+/* This is auto-generated code. Edit at your own peril. */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "cutest.h"
+
+
+extern void test_big_list(CuTest*);
+extern void test_il_sorted(CuTest*);
+extern void test_ll_sorted_contains_1(CuTest*);
+extern void test_ll_sorted_index_of_1(CuTest*);
+extern void test_il_remove_index_range_1(CuTest*);
+extern void test_sl_split_1(CuTest*);
+extern void test_sl_split_2(CuTest*);
+extern void test_sl_split_3(CuTest*);
+extern void test_il_new(CuTest*);
+extern void test_il_size(CuTest*);
+extern void test_il_get_push(CuTest*);
+extern void test_il_push_pop(CuTest*);
+extern void test_il_push_pop2(CuTest*);
+extern void test_il(CuTest*);
+extern void test_il_remove_value(CuTest*);
+extern void test_il_contains(CuTest*);
+extern void test_il_insert_ascending(CuTest*);
+extern void test_il_insert_descending(CuTest*);
+extern void test_il_insert_unique_ascending(CuTest*);
+extern void test_il_copy(CuTest*);
+extern void test_il_dupe(CuTest*);
+extern void test_delete(CuTest*);
+extern void test_delete_2(CuTest*);
+extern void test_delete_3(CuTest*);
+extern void test_set(CuTest*);
+extern void test_delete_4(CuTest*);
+extern void test_dl_push(CuTest*);
+extern void test_bl_extend(CuTest*);
+extern void test_sl_join(CuTest*);
+extern void test_bt_1(CuTest*);
+extern void test_bt_many(CuTest*);
+extern void test_endian(CuTest*);
+extern void test_copy_rows_file_to_memory(CuTest*);
+extern void test_copy_rows_inmemory(CuTest*);
+extern void test_one_column_write_read(CuTest*);
+extern void test_headers(CuTest*);
+extern void test_multi_headers(CuTest*);
+extern void test_one_int_column_write_read(CuTest*);
+extern void test_two_columns_with_conversion(CuTest*);
+extern void test_arrays(CuTest*);
+extern void test_conversion(CuTest*);
+extern void test_struct_1(CuTest*);
+extern void test_bulk_read_write(CuTest*);
+extern void test_struct_2(CuTest*);
+extern void test_inmemory_one_column_write_read(CuTest*);
+extern void test_inmemory_headers(CuTest*);
+extern void test_inmemory_one_int_column_write_read(CuTest*);
+extern void test_inmemory_two_columns_with_conversion(CuTest*);
+extern void test_inmemory_struct_2(CuTest*);
+extern void test_inmemory_arrays(CuTest*);
+extern void test_inmemory_conversion(CuTest*);
+extern void test_inmemory_struct_1(CuTest*);
+extern void test_tagalong(CuTest*);
+extern void test_simple_xy(CuTest*);
+extern void test_read_write_xy(CuTest*);
+extern void test_simple(CuTest*);
+extern void test_read_write(CuTest*);
+extern void test_side_length(CuTest*);
+extern void test_make_map(CuTest*);
+extern void test_healpix_distance_to_radec(CuTest*);
+extern void test_healpix_neighbours(CuTest*);
+extern void test_big_nside(CuTest*);
+extern void test_distortion_at_pole(CuTest*);
+extern void test_from_paper_1(CuTest*);
+extern void test_from_paper_2(CuTest*);
+extern void test_from_paper_page1_3(CuTest*);
+extern void test_from_paper_page1_5(CuTest*);
+extern void test_from_paper_page1_5b(CuTest*);
+extern void test_from_paper_page2_1(CuTest*);
+extern void test_from_paper_page2_notes(CuTest*);
+extern void test_write_long_string(CuTest*);
+extern void test_fitsbin_1(CuTest*);
+extern void test_fitsbin_2(CuTest*);
+extern void test_inmemory_fitsbin_1(CuTest*);
+extern void test_inmemory_fitsbin_2(CuTest*);
+extern void test_log_ts(CuTest*);
+extern void test_log_func(CuTest*);
+extern void test_scampcat_1(CuTest*);
+extern void test_scampref_2(CuTest*);
+extern void test_ra2hmsstring(CuTest*);
+extern void test_hammer_aitoff(CuTest*);
+extern void test_atora(CuTest*);
+extern void test_atodec(CuTest*);
+extern void test_xtodistsq(CuTest*);
+extern void test_nullspace_gsl(CuTest*);
+extern void test_run_command_1(CuTest*);
+extern void test_run_command(CuTest*);
+extern void test_split_long_string(CuTest*);
+extern void test_streq_1(CuTest*);
+extern void test_canon_1(CuTest*);
+extern void test_canon_2(CuTest*);
+extern void test_canon_2b(CuTest*);
+extern void test_canon_2c(CuTest*);
+extern void test_canon_3(CuTest*);
+extern void test_canon_3b(CuTest*);
+extern void test_canon_4(CuTest*);
+extern void test_canon_4b(CuTest*);
+extern void test_canon_4c(CuTest*);
+extern void test_canon_5(CuTest*);
+extern void test_mercator_2(CuTest*);
+extern void test_walk_outline(CuTest*);
+extern void test_discontinuity(CuTest*);
+extern void test_wcslib_equals_tan(CuTest*);
+extern void test_compute_inverse(CuTest*);
+extern void test_err_func(CuTest*);
+extern void test_multiindex(CuTest*);
+extern void test_conv_1(CuTest*);
+extern void test_qsort_r(CuTest*);
+extern void test_tan1(CuTest*);
+extern void test_big_table(CuTest*);
+extern void test_empty(CuTest*);
+extern void test_medium(CuTest*);
+extern void test_tricky(CuTest*);
+extern void test_nasty(CuTest*);
+extern void test_very_nasty(CuTest*);
+extern void test_random_masks(CuTest*);
+extern void test_collapsing_find_simple(CuTest*);
+extern void test_simple_median(CuTest*);
+extern void test_dsmooth_vs_dsmooth2(CuTest*);
+extern void test_dsmooth2_inplace(CuTest*);
+extern void test_dsmooth2_kernels(CuTest*);
+extern void test_dcen3x3_1(CuTest*);
+extern void test_dcen3x3_2(CuTest*);
+extern void test_dcen3x3_3(CuTest*);
+extern void test_simplexy_1(CuTest*);
+extern void test_simplexy_threads(CuTest*);
+extern void test_simplexy_workspace(CuTest*);
+extern void test_simplexy_stream(CuTest*);
+extern void test_dmedsmooth_binned(CuTest*);
+extern void test_wcs_shift(CuTest*);
+extern void test_index_prefetch(CuTest*);
+extern void test_index_catalog(CuTest*);
+
+
+void RunAllTests(void) 
+{
+    CuString *output = CuStringNew();
+    CuSuite* suite = CuSuiteNew();
+
+
+    SUITE_ADD_TEST(suite, test_big_list);
+    SUITE_ADD_TEST(suite, test_il_sorted);
+    SUITE_ADD_TEST(suite, test_ll_sorted_contains_1);
+    SUITE_ADD_TEST(suite, test_ll_sorted_index_of_1);
+    SUITE_ADD_TEST(suite, test_il_remove_index_range_1);
+    SUITE_ADD_TEST(suite, test_sl_split_1);
+    SUITE_ADD_TEST(suite, test_sl_split_2);
+    SUITE_ADD_TEST(suite, test_sl_split_3);
+    SUITE_ADD_TEST(suite, test_il_new);
+    SUITE_ADD_TEST(suite, test_il_size);
+    SUITE_ADD_TEST(suite, test_il_get_push);
+    SUITE_ADD_TEST(suite, test_il_push_pop);
+    SUITE_ADD_TEST(suite, test_il_push_pop2);
+    SUITE_ADD_TEST(suite, test_il);
+    SUITE_ADD_TEST(suite, test_il_remove_value);
+    SUITE_ADD_TEST(suite, test_il_contains);
+    SUITE_ADD_TEST(suite, test_il_insert_ascending);
+    SUITE_ADD_TEST(suite, test_il_insert_descending);
+    SUITE_ADD_TEST(suite, test_il_insert_unique_ascending);
+    SUITE_ADD_TEST(suite, test_il_copy);
+    SUITE_ADD_TEST(suite, test_il_dupe);
+    SUITE_ADD_TEST(suite, test_delete);
+    SUITE_ADD_TEST(suite, test_delete_2);
+    SUITE_ADD_TEST(suite, test_delete_3);
+    SUITE_ADD_TEST(suite, test_set);
+    SUITE_ADD_TEST(suite, test_delete_4);
+    SUITE_ADD_TEST(suite, test_dl_push);
+    SUITE_ADD_TEST(suite, test_bl_extend);
+    SUITE_ADD_TEST(suite, test_sl_join);
+    SUITE_ADD_TEST(suite, test_bt_1);
+    SUITE_ADD_TEST(suite, test_bt_many);
+    SUITE_ADD_TEST(suite, test_endian);
+    SUITE_ADD_TEST(suite, test_copy_rows_file_to_memory);
+    SUITE_ADD_TEST(suite, test_copy_rows_inmemory);
+    SUITE_ADD_TEST(suite, test_one_column_write_read);
+    SUITE_ADD_TEST(suite, test_headers);
+    SUITE_ADD_TEST(suite, test_multi_headers);
+    SUITE_ADD_TEST(suite, test_one_int_column_write_read);
+    SUITE_ADD_TEST(suite, test_two_columns_with_conversion);
+    SUITE_ADD_TEST(suite, test_arrays);
+    SUITE_ADD_TEST(suite, test_conversion);
+    SUITE_ADD_TEST(suite, test_struct_1);
+    SUITE_ADD_TEST(suite, test_bulk_read_write);
+    SUITE_ADD_TEST(suite, test_struct_2);
+    SUITE_ADD_TEST(suite, test_inmemory_one_column_write_read);
+    SUITE_ADD_TEST(suite, test_inmemory_headers);
+    SUITE_ADD_TEST(suite, test_inmemory_one_int_column_write_read);
+    SUITE_ADD_TEST(suite, test_inmemory_two_columns_with_conversion);
+    SUITE_ADD_TEST(suite, test_inmemory_struct_2);
+    SUITE_ADD_TEST(suite, test_inmemory_arrays);
+    SUITE_ADD_TEST(suite, test_inmemory_conversion);
+    SUITE_ADD_TEST(suite, test_inmemory_struct_1);
+    SUITE_ADD_TEST(suite, test_tagalong);
+    SUITE_ADD_TEST(suite, test_simple_xy);
+    SUITE_ADD_TEST(suite, test_read_write_xy);
+    SUITE_ADD_TEST(suite, test_simple);
+    SUITE_ADD_TEST(suite, test_read_write);
+    SUITE_ADD_TEST(suite, test_side_length);
+    SUITE_ADD_TEST(suite, test_make_map);
+    SUITE_ADD_TEST(suite, test_healpix_distance_to_radec);
+    SUITE_ADD_TEST(suite, test_healpix_neighbours);
+    SUITE_ADD_TEST(suite, test_big_nside);
+    SUITE_ADD_TEST(suite, test_distortion_at_pole);
+    SUITE_ADD_TEST(suite, test_from_paper_1);
+    SUITE_ADD_TEST(suite, test_from_paper_2);
+    SUITE_ADD_TEST(suite, test_from_paper_page1_3);
+    SUITE_ADD_TEST(suite, test_from_paper_page1_5);
+    SUITE_ADD_TEST(suite, test_from_paper_page1_5b);
+    SUITE_ADD_TEST(suite, test_from_paper_page2_1);
+    SUITE_ADD_TEST(suite, test_from_paper_page2_notes);
+    SUITE_ADD_TEST(suite, test_write_long_string);
+    SUITE_ADD_TEST(suite, test_fitsbin_1);
+    SUITE_ADD_TEST(suite, test_fitsbin_2);
+    SUITE_ADD_TEST(suite, test_inmemory_fitsbin_1);
+    SUITE_ADD_TEST(suite, test_inmemory_fitsbin_2);
+    SUITE_ADD_TEST(suite, test_log_ts);
+    SUITE_ADD_TEST(suite, test_log_func);
+    SUITE_ADD_TEST(suite, test_scampcat_1);
+    SUITE_ADD_TEST(suite, test_scampref_2);
+    SUITE_ADD_TEST(suite, test_ra2hmsstring);
+    SUITE_ADD_TEST(suite, test_hammer_aitoff);
+    SUITE_ADD_TEST(suite, test_atora);
+    SUITE_ADD_TEST(suite, test_atodec);
+    SUITE_ADD_TEST(suite, test_xtodistsq);
+    SUITE_ADD_TEST(suite, test_nullspace_gsl);
+    SUITE_ADD_TEST(suite, test_run_command_1);
+    SUITE_ADD_TEST(suite, test_run_command);
+    SUITE_ADD_TEST(suite, test_split_long_string);
+    SUITE_ADD_TEST(suite, test_streq_1);
+    SUITE_ADD_TEST(suite, test_canon_1);
+    SUITE_ADD_TEST(suite, test_canon_2);
+    SUITE_ADD_TEST(suite, test_canon_2b);
+    SUITE_ADD_TEST(suite, test_canon_2c);
+    SUITE_ADD_TEST(suite, test_canon_3);
+    SUITE_ADD_TEST(suite, test_canon_3b);
+    SUITE_ADD_TEST(suite, test_canon_4);
+    SUITE_ADD_TEST(suite, test_canon_4b);
+    SUITE_ADD_TEST(suite, test_canon_4c);
+    SUITE_ADD_TEST(suite, test_canon_5);
+    SUITE_ADD_TEST(suite, test_mercator_2);
+    SUITE_ADD_TEST(suite, test_walk_outline);
+    SUITE_ADD_TEST(suite, test_discontinuity);
+    SUITE_ADD_TEST(suite, test_wcslib_equals_tan);
+    SUITE_ADD_TEST(suite, test_compute_inverse);
+    SUITE_ADD_TEST(suite, test_err_func);
+    SUITE_ADD_TEST(suite, test_multiindex);
+    SUITE_ADD_TEST(suite, test_conv_1);
+    SUITE_ADD_TEST(suite, test_qsort_r);
+    SUITE_ADD_TEST(suite, test_tan1);
+    SUITE_ADD_TEST(suite, test_big_table);
+    SUITE_ADD_TEST(suite, test_empty);
+    SUITE_ADD_TEST(suite, test_medium);
+    SUITE_ADD_TEST(suite, test_tricky);
+    SUITE_ADD_TEST(suite, test_nasty);
+    SUITE_ADD_TEST(suite, test_very_nasty);
+    SUITE_ADD_TEST(suite, test_random_masks);
+    SUITE_ADD_TEST(suite, test_collapsing_find_simple);
+    SUITE_ADD_TEST(suite, test_simple_median);
+    SUITE_ADD_TEST(suite, test_dsmooth_vs_dsmooth2);
+    SUITE_ADD_TEST(suite, test_dsmooth2_inplace);
+    SUITE_ADD_TEST(suite, test_dsmooth2_kernels);
+    SUITE_ADD_TEST(suite, test_dcen3x3_1);
+    SUITE_ADD_TEST(suite, test_dcen3x3_2);
+    SUITE_ADD_TEST(suite, test_dcen3x3_3);
+    SUITE_ADD_TEST(suite, test_simplexy_1);
+    SUITE_ADD_TEST(suite, test_simplexy_threads);
+    SUITE_ADD_TEST(suite, test_simplexy_workspace);
+    SUITE_ADD_TEST(suite, test_simplexy_stream);
+    SUITE_ADD_TEST(suite, test_dmedsmooth_binned);
+    SUITE_ADD_TEST(suite, test_wcs_shift);
+    SUITE_ADD_TEST(suite, test_index_prefetch);
+    SUITE_ADD_TEST(suite, test_index_catalog);
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+
+    printf("%s\n", output->buffer);
+
+    CuSuiteFree(suite);
+    CuStringFree(output);
+}
+
+int main(int argc, char** args)
+{
+    if (argc > 1 && !strcmp(args[1], "-d")) {
+        printf("Setting die on fail.\n");
+        CuDieOnFail();
+    }
+    RunAllTests();
+    return 0;
+}
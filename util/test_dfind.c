@@ -155,6 +155,7 @@ int compare_inputs(int *test_data, int nx, int ny) {
 	int *test_outs_keir = calloc(nx*ny, sizeof(int));
 	int *test_outs_blanton = calloc(nx*ny, sizeof(int));
 	int *test_outs_u8 = calloc(nx*ny, sizeof(int));
+	int *test_outs_threads = calloc(nx*ny, sizeof(int));
 	int fail = 0;
 	int ix, iy, i;
 	unsigned char* u8img;
@@ -166,6 +167,8 @@ int compare_inputs(int *test_data, int nx, int ny) {
 	for (i=0; i<(nx*ny); i++)
 		u8img[i] = test_data[i];
 	dfind2_u8(u8img, nx, ny, test_outs_u8, NULL);
+	// three slices of rows, merged across the seams.
+	dfind2_u8_threads(u8img, nx, ny, test_outs_threads, NULL, 3);
 
 	for(iy=0; iy<ny; iy++) {
 		for (ix=0; ix<nx; ix++) {
@@ -179,6 +182,11 @@ int compare_inputs(int *test_data, int nx, int ny) {
 						test_outs_keir[nx*iy+ix], test_outs_u8[nx*iy+ix]);
 				fail++;
 			}
+			if (!(test_outs_keir[nx*iy+ix] == test_outs_threads[nx*iy+ix])) {
+				printf("failure -- k:%d != threads:%d\n",
+						test_outs_keir[nx*iy+ix], test_outs_threads[nx*iy+ix]);
+				fail++;
+			}
 		}
 	}
 
@@ -186,6 +194,7 @@ int compare_inputs(int *test_data, int nx, int ny) {
     free(test_outs_keir);
     free(test_outs_blanton);
     free(test_outs_u8);
+    free(test_outs_threads);
 
 	return fail;
 }
@@ -261,6 +270,23 @@ void test_very_nasty(CuTest* tc) {
 	CuAssertIntEquals(tc, compare_inputs(test_data, 11, 9),0);
 }
 
+void test_random_masks(CuTest* tc) {
+	int k, i;
+	srand(7);
+	initial_max_groups = 1;
+	for (k=0; k<40; k++) {
+		// widths that aren't multiples of 8, and long blank stretches.
+		int nx = 1 + rand() % 70;
+		int ny = 1 + rand() % 40;
+		int density = rand() % 60;
+		int* test_data = malloc(nx * ny * sizeof(int));
+		for (i=0; i<nx*ny; i++)
+			test_data[i] = (rand() % 100 < density);
+		CuAssertIntEquals(tc, 0, compare_inputs(test_data, nx, ny));
+		free(test_data);
+	}
+}
+
 void test_collapsing_find_simple(CuTest* tc) {
     dimage_label_t equivs[] = {0, 0, 1, 2};
     /* 0  1  2  3 */
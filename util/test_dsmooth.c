@@ -9,9 +9,7 @@
 #include <math.h>
 
 #include "cutest.h"
-
-int dsmooth(float* image, int nx, int ny, float sigma, float* smooth);
-void dsmooth2(float* image, int nx, int ny, float sigma, float* smooth);
+#include "dimage.h"
 
 int compare_images(float *i1, float* i2, int nx, int ny, float eps) {
     int i, j;
@@ -114,3 +112,56 @@ void test_dsmooth2_inplace(CuTest* tc) {
     free(smooth1);
     free(smooth2);
 }
+
+void test_dsmooth2_kernels(CuTest* tc) {
+    // wide enough for a full column block plus a ragged end.
+    int nx = 150, ny = 41;
+    float sigmas[] = { 0.8, 2.0, 9.0 };
+    int npix = nx * ny;
+    float* img;
+    int16_t* img16;
+    float* ref;
+    float* ref16;
+    float* serial;
+    float* smooth;
+    int i, s, k;
+
+    img = random_image(nx, ny);
+    img16 = malloc(npix * sizeof(int16_t));
+    for (i=0; i<npix; i++)
+        img16[i] = (rand() % 2000) - 1000;
+    ref = malloc(npix * sizeof(float));
+    ref16 = malloc(npix * sizeof(float));
+    serial = malloc(npix * sizeof(float));
+    smooth = malloc(npix * sizeof(float));
+
+    for (s=0; s<sizeof(sigmas)/sizeof(float); s++) {
+        dsmooth2_set_kernel(DSMOOTH_SCALAR);
+        dsmooth2(img, nx, ny, sigmas[s], ref);
+        dsmooth2_i16(img16, nx, ny, sigmas[s], ref16);
+        // every kernel agrees with the scalar loops, up to rounding
+        for (k=DSMOOTH_SCALAR; k<=dsmooth2_best_kernel(); k++) {
+            dsmooth2_set_kernel(k);
+            dsmooth2(img, nx, ny, sigmas[s], serial);
+            CuAssertIntEquals(tc, 0, compare_images(ref, serial, nx, ny, 1e-6));
+            // ...and doesn't depend on the number of threads at all
+            dsmooth2_threads(img, nx, ny, sigmas[s], smooth, 3);
+            CuAssertIntEquals(tc, 0, compare_images(serial, smooth, nx, ny, 0.0));
+            dsmooth2_threads(img, nx, ny, sigmas[s], smooth, 7);
+            CuAssertIntEquals(tc, 0, compare_images(serial, smooth, nx, ny, 0.0));
+            dsmooth2_i16(img16, nx, ny, sigmas[s], smooth);
+            CuAssertIntEquals(tc, 0, compare_images(ref16, smooth, nx, ny, 1e-3));
+            memcpy(smooth, img, npix * sizeof(float));
+            dsmooth2(smooth, nx, ny, sigmas[s], smooth);
+            CuAssertIntEquals(tc, 0, compare_images(ref, smooth, nx, ny, 1e-6));
+        }
+    }
+    dsmooth2_set_kernel(-1);
+
+    free(img);
+    free(img16);
+    free(ref);
+    free(ref16);
+    free(serial);
+    free(smooth);
+}
@@ -840,6 +840,123 @@ void test_struct_1(CuTest* ct) {
 }
 
 
+static void write_ts1(CuTest* ct, const char* fn, ts1* x, int N, anbool bulk) {
+    tfits_type i16 = TFITS_BIN_TYPE_I;
+    tfits_type itype = fitscolumn_int_type();
+    tfits_type dubl = fitscolumn_double_type();
+    tfits_type flt = fitscolumn_float_type();
+    fitstable_t* outtab;
+    int i;
+
+    outtab = fitstable_open_for_writing(fn);
+    CuAssertPtrNotNull(ct, outtab);
+    CuAssertIntEquals(ct, 0, fitstable_write_primary_header(outtab));
+    fitstable_add_write_column_struct(outtab, itype, 1, offsetof(ts1, x1),
+                                      itype, "X1", "x1units");
+    fitstable_add_write_column_struct(outtab, itype, 3, offsetof(ts1, x2),
+                                      i16, "X2", "x2units");
+    fitstable_add_write_column_struct(outtab, dubl, 1, offsetof(ts1, x3),
+                                      dubl, "X3", "x3units");
+    fitstable_add_write_column_struct(outtab, dubl, 1, offsetof(ts1, x4),
+                                      flt, "X4", "x4units");
+    CuAssertIntEquals(ct, 0, fitstable_write_header(outtab));
+    if (bulk)
+        CuAssertIntEquals(ct, 0, fitstable_write_structs(outtab, x, sizeof(ts1), N));
+    else
+        for (i=0; i<N; i++)
+            CuAssertIntEquals(ct, 0, fitstable_write_struct(outtab, x+i));
+    CuAssertIntEquals(ct, 0, fitstable_fix_header(outtab));
+    CuAssertIntEquals(ct, 0, fitstable_close(outtab));
+}
+
+void test_bulk_read_write(CuTest* ct) {
+    fitstable_t* tab1, *tab2;
+    tfits_type i16 = TFITS_BIN_TYPE_I;
+    tfits_type dubl = fitscolumn_double_type();
+    char* fn1;
+    char* fn2;
+    int i, N = 5000;
+    int Nind = 100;
+    ts1* x;
+    ts2* y;
+    int inds[100];
+    double* d1;
+    double* d2;
+    fitstable_column_view_t view;
+
+    x = malloc(N * sizeof(ts1));
+    y = calloc(N, sizeof(ts2));
+    for (i=0; i<N; i++) {
+        x[i].x1 = i;
+        x[i].x2[0] = 1000 + i;
+        x[i].x2[1] = -i;
+        x[i].x2[2] = 3000 + i;
+        x[i].x3 = i * 1000.0;
+        x[i].x4 = i * 0.5;
+    }
+    fn1 = strdup(get_tmpfile(9));
+    fn2 = strdup(get_tmpfile(10));
+    write_ts1(ct, fn1, x, N, FALSE);
+    write_ts1(ct, fn2, x, N, TRUE);
+
+    tab1 = fitstable_open(fn1);
+    tab2 = fitstable_open(fn2);
+    CuAssertPtrNotNull(ct, tab1);
+    CuAssertPtrNotNull(ct, tab2);
+    CuAssertIntEquals(ct, N, fitstable_nrows(tab2));
+
+    // the bulk writer produces the same table as the row writer.
+    d1 = fitstable_read_column(tab1, "X4", dubl);
+    d2 = fitstable_read_column(tab2, "X4", dubl);
+    CuAssertPtrNotNull(ct, d2);
+    CuAssertIntEquals(ct, 0, memcmp(d1, d2, N * sizeof(double)));
+    for (i=0; i<N; i++)
+        CuAssertDblEquals(ct, x[i].x4, d2[i], 1e-10);
+    free(d1);
+    free(d2);
+
+    // read into strided destinations, with and without conversion.
+    CuAssertIntEquals(ct, 0, fitstable_read_column_into(tab2, "X3", dubl,
+                                                        &(y[0].x1), sizeof(ts2)));
+    CuAssertIntEquals(ct, 0, fitstable_read_column_array_inds_into
+                      (tab2, "X2", i16, &(y[0].x2), sizeof(ts2), 3, NULL, N));
+    for (i=0; i<N; i++) {
+        CuAssertDblEquals(ct, x[i].x3, y[i].x1, 1e-10);
+        CuAssertIntEquals(ct, x[i].x2[0], y[i].x2[0]);
+        CuAssertIntEquals(ct, x[i].x2[1], y[i].x2[1]);
+        CuAssertIntEquals(ct, x[i].x2[2], y[i].x2[2]);
+    }
+
+    // scattered rows, read as another type.
+    for (i=0; i<Nind; i++)
+        inds[i] = (i * 7919) % N;
+    memset(y, 0, N * sizeof(ts2));
+    CuAssertIntEquals(ct, 0, fitstable_read_column_inds_into
+                      (tab2, "X1", TFITS_BIN_TYPE_D, &(y[0].x1), sizeof(ts2),
+                       inds, Nind));
+    for (i=0; i<Nind; i++)
+        CuAssertDblEquals(ct, x[inds[i]].x1, y[i].x1, 1e-10);
+
+    // a mapped view holds the file's big-endian values.
+    CuAssertIntEquals(ct, 0, fitstable_map_column(tab2, "X2", &view));
+    CuAssertIntEquals(ct, N, view.nrows);
+    CuAssertIntEquals(ct, 3, view.arraysize);
+    CuAssertIntEquals(ct, i16, view.type);
+    for (i=0; i<N; i++) {
+        const unsigned char* p = (const unsigned char*)view.data +
+            (size_t)i * view.stride + sizeof(int16_t);
+        CuAssertIntEquals(ct, x[i].x2[1], (int16_t)((p[0] << 8) | p[1]));
+    }
+    fitstable_unmap_column(&view);
+
+    CuAssertIntEquals(ct, 0, fitstable_close(tab1));
+    CuAssertIntEquals(ct, 0, fitstable_close(tab2));
+    free(fn1);
+    free(fn2);
+    free(x);
+    free(y);
+}
+
 struct ts3 {
     double x1;
     int16_t x2[3];
@@ -0,0 +1,240 @@
+/*
+# This file is part of the Astrometry.net suite.
+# Licensed under a 3-clause BSD style license - see LICENSE
+ */
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+
+#include "cutest.h"
+#include "index.h"
+#include "anqfits.h"
+#include "ioutils.h"
+#include "bl.h"
+#include "log.h"
+
+/*
+ Uses the index files made for test_multiindex (see there), put back
+ together into a single-file index.
+ */
+
+static char* make_index(CuTest* ct, const char* dir) {
+	anqfits_t* fits;
+	char* fn;
+	char* ind;
+	char* skdt;
+	size_t nind, nskdt;
+	off_t start;
+	FILE* f;
+
+	// t10.ind, then the star kdtree extensions of t10.skdt.
+	fits = anqfits_open("t10.skdt");
+	CuAssertPtrNotNull(ct, fits);
+	start = anqfits_header_start(fits, 1);
+	anqfits_close(fits);
+	CuAssertTrue(ct, start > 0);
+	ind = file_get_contents("t10.ind", &nind, FALSE);
+	skdt = file_get_contents("t10.skdt", &nskdt, FALSE);
+	CuAssertPtrNotNull(ct, ind);
+	CuAssertPtrNotNull(ct, skdt);
+
+	asprintf_safe(&fn, "%s/t10.fits", dir);
+	f = fopen(fn, "wb");
+	CuAssertPtrNotNull(ct, f);
+	CuAssertIntEquals(ct, 1, fwrite(ind, nind, 1, f));
+	CuAssertIntEquals(ct, 1, fwrite(skdt + start, nskdt - start, 1, f));
+	CuAssertIntEquals(ct, 0, fclose(f));
+	free(ind);
+	free(skdt);
+	return fn;
+}
+
+static void assert_same_metadata(CuTest* ct, index_t* a, index_t* b) {
+	CuAssertIntEquals(ct, a->indexid, b->indexid);
+	CuAssertIntEquals(ct, a->healpix, b->healpix);
+	CuAssertIntEquals(ct, a->hpnside, b->hpnside);
+	CuAssertIntEquals(ct, a->dimquads, b->dimquads);
+	CuAssertIntEquals(ct, a->nstars, b->nstars);
+	CuAssertIntEquals(ct, a->nquads, b->nquads);
+	CuAssertIntEquals(ct, a->circle, b->circle);
+	CuAssertIntEquals(ct, a->cx_less_than_dx, b->cx_less_than_dx);
+	CuAssertIntEquals(ct, a->meanx_less_than_half, b->meanx_less_than_half);
+	CuAssertDblEquals(ct, a->index_scale_lower, b->index_scale_lower, 0);
+	CuAssertDblEquals(ct, a->index_scale_upper, b->index_scale_upper, 0);
+	CuAssertDblEquals(ct, a->index_jitter, b->index_jitter, 0);
+	CuAssertIntEquals(ct, a->cutnside, b->cutnside);
+	CuAssertIntEquals(ct, a->cutnsweep, b->cutnsweep);
+	CuAssertDblEquals(ct, a->cutdedup, b->cutdedup, 0);
+	CuAssertIntEquals(ct, a->cutmargin, b->cutmargin);
+	CuAssertStrEquals(ct, a->indexname, b->indexname);
+}
+
+void test_index_prefetch(CuTest* ct) {
+	char* dir;
+	char* fn;
+	index_t* ind;
+	size_t mapped, total;
+	int flags[] = { INDEX_PREFETCH_CODEKD_NODES, INDEX_PREFETCH_CODEKD_DATA,
+					INDEX_PREFETCH_STARKD_NODES, INDEX_PREFETCH_STARKD_DATA,
+					INDEX_PREFETCH_QUADS };
+	int i;
+
+	log_init(LOG_MSG);
+	dir = create_temp_dir("test-index", NULL);
+	CuAssertPtrNotNull(ct, dir);
+	fn = make_index(ct, dir);
+
+	// nothing is mapped until the index is loaded.
+	ind = index_load(fn, INDEX_ONLY_LOAD_METADATA, NULL);
+	CuAssertPtrNotNull(ct, ind);
+	CuAssertIntEquals(ct, 0, index_get_mapped_size(ind));
+	CuAssertIntEquals(ct, 0, index_prefetch(ind, INDEX_PREFETCH_ALL));
+
+	CuAssertIntEquals(ct, 0, index_reload(ind));
+	mapped = index_get_mapped_size(ind);
+	CuAssertTrue(ct, mapped > 0);
+	// each part of the index is read once, and together they are all of it.
+	total = 0;
+	for (i=0; i<sizeof(flags)/sizeof(int); i++) {
+		size_t n = index_prefetch(ind, flags[i]);
+		CuAssertTrue(ct, n > 0);
+		total += n;
+	}
+	CuAssertIntEquals(ct, mapped, total);
+	CuAssertIntEquals(ct, mapped, index_prefetch(ind, INDEX_PREFETCH_ALL));
+
+	index_unload(ind);
+	CuAssertIntEquals(ct, 0, index_get_mapped_size(ind));
+	index_free(ind);
+
+	// the flags passed to index_load() are applied when it is loaded.
+	ind = index_load(fn, INDEX_PREFETCH_ALL, NULL);
+	CuAssertPtrNotNull(ct, ind);
+	CuAssertIntEquals(ct, INDEX_PREFETCH_ALL, ind->prefetch);
+	CuAssertIntEquals(ct, mapped, index_get_mapped_size(ind));
+	index_free(ind);
+
+	unlink(fn);
+	rmdir(dir);
+	free(fn);
+	free(dir);
+}
+
+// Replaces field "k" of the catalog's entry (its second line).
+static void edit_catalog_entry(CuTest* ct, const char* catfn, int k,
+							   const char* val) {
+	sl* lines;
+	sl* words;
+	char* line;
+	char* txt;
+
+	lines = file_get_lines(catfn, FALSE);
+	CuAssertPtrNotNull(ct, lines);
+	CuAssertIntEquals(ct, 2, sl_size(lines));
+	words = sl_split(NULL, sl_get(lines, 1), "\t");
+	CuAssertIntEquals(ct, 21, sl_size(words));
+	sl_set(words, k, val);
+	line = sl_join(words, "\t");
+	sl_set(lines, 1, line);
+	txt = sl_join(lines, "\n");
+	CuAssertIntEquals(ct, 0, write_file(catfn, txt, strlen(txt)));
+	free(txt);
+	free(line);
+	sl_free2(words);
+	sl_free2(lines);
+}
+
+static index_t* load_from_catalog(CuTest* ct, const char* catfn,
+								  const char* fn) {
+	index_catalog_t* cat;
+	index_t* ind;
+	cat = index_catalog_open(catfn);
+	CuAssertPtrNotNull(ct, cat);
+	ind = index_catalog_load(cat, fn, INDEX_ONLY_LOAD_METADATA);
+	CuAssertPtrNotNull(ct, ind);
+	CuAssertIntEquals(ct, 0, index_catalog_write(cat));
+	index_catalog_free(cat);
+	return ind;
+}
+
+void test_index_catalog(CuTest* ct) {
+	char* dir;
+	char* fn;
+	char* catfn;
+	index_t* ref;
+	index_t* ind;
+	sl* lines;
+	struct stat st;
+	struct utimbuf ut;
+
+	log_init(LOG_MSG);
+	dir = create_temp_dir("test-index", NULL);
+	CuAssertPtrNotNull(ct, dir);
+	fn = make_index(ct, dir);
+	asprintf_safe(&catfn, "%s/index-catalog", dir);
+	ref = index_load(fn, INDEX_ONLY_LOAD_METADATA, NULL);
+	CuAssertPtrNotNull(ct, ref);
+
+	// a new catalog: the metadata is read from the file, and saved.
+	ind = load_from_catalog(ct, catfn, fn);
+	assert_same_metadata(ct, ref, ind);
+	index_free(ind);
+	lines = file_get_lines(catfn, FALSE);
+	CuAssertPtrNotNull(ct, lines);
+	CuAssertIntEquals(ct, 2, sl_size(lines));
+	CuAssertStrEquals(ct, "# Astrometry.net index catalog, version 1",
+					  sl_get(lines, 0));
+	sl_free2(lines);
+
+	// the saved metadata is read back the same, and the index loads.
+	ind = load_from_catalog(ct, catfn, fn);
+	assert_same_metadata(ct, ref, ind);
+	CuAssertPtrEquals(ct, NULL, ind->starkd);
+	CuAssertIntEquals(ct, 0, index_reload(ind));
+	CuAssertIntEquals(ct, ref->nstars, index_nstars(ind));
+	CuAssertIntEquals(ct, ref->nquads, index_nquads(ind));
+	index_free(ind);
+
+	// it is taken from the catalog, not the file...
+	edit_catalog_entry(ct, catfn, 14, "1234.5");
+	ind = load_from_catalog(ct, catfn, fn);
+	CuAssertDblEquals(ct, 1234.5, ind->index_scale_upper, 0);
+	index_free(ind);
+
+	// ... until the file changes.
+	CuAssertIntEquals(ct, 0, stat(fn, &st));
+	ut.actime = st.st_atime;
+	ut.modtime = st.st_mtime + 10;
+	CuAssertIntEquals(ct, 0, utime(fn, &ut));
+	ind = load_from_catalog(ct, catfn, fn);
+	assert_same_metadata(ct, ref, ind);
+	index_free(ind);
+	ind = load_from_catalog(ct, catfn, fn);
+	assert_same_metadata(ct, ref, ind);
+	index_free(ind);
+
+	// bad lines, and catalogs with the wrong header, are ignored and
+	// replaced.
+	edit_catalog_entry(ct, catfn, 5, "not-a-number");
+	ind = load_from_catalog(ct, catfn, fn);
+	assert_same_metadata(ct, ref, ind);
+	index_free(ind);
+	CuAssertIntEquals(ct, 0, write_file(catfn, "garbage\n", 8));
+	ind = load_from_catalog(ct, catfn, fn);
+	assert_same_metadata(ct, ref, ind);
+	index_free(ind);
+	lines = file_get_lines(catfn, FALSE);
+	CuAssertPtrNotNull(ct, lines);
+	CuAssertIntEquals(ct, 2, sl_size(lines));
+	sl_free2(lines);
+
+	index_free(ref);
+	unlink(catfn);
+	unlink(fn);
+	rmdir(dir);
+	free(catfn);
+	free(fn);
+	free(dir);
+}
@@ -5,12 +5,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "cutest.h"
 #include "dimage.h"
 #include "simplexy.h"
 #include "log.h"
+#include "os-features.h"
 
 /**
 > python -c "from pylab import *; I=imread('test_dcen3x3_1.pgm'); print ','.join(['%i'%x for x in I.ravel()]); print I.shape"
@@ -51,3 +53,225 @@ void test_simplexy_1(CuTest* tc) {
 	CuAssertIntEquals(tc, 1, rtn);
 	CuAssertIntEquals(tc, 1, N);
 }
+
+static void fake_stars(float* image, int W, int H) {
+	int i, j, k;
+	srand(42);
+	for (i=0; i<W*H; i++)
+		image[i] = 100.0 + 0.05 * (i % W) + 10.0 * rand() / (float)RAND_MAX;
+	for (k=0; k<60; k++) {
+		float cx = W * (rand() / (float)RAND_MAX);
+		float cy = H * (rand() / (float)RAND_MAX);
+		float flux = 50.0 + 500.0 * rand() / (float)RAND_MAX;
+		for (j=MAX(0, (int)cy-6); j<MIN(H, (int)cy+7); j++)
+			for (i=MAX(0, (int)cx-6); i<MIN(W, (int)cx+7); i++)
+				image[j*W + i] += flux * exp(-((i-cx)*(i-cx) + (j-cy)*(j-cy)) / 4.0);
+	}
+}
+
+static void run_simplexy(float* image, anbool u8, int W, int H, int nthreads,
+						 simplexy_t* s) {
+	int i;
+	simplexy_set_defaults(s);
+	if (u8) {
+		simplexy_set_u8_defaults(s);
+		s->image_u8 = malloc(W*H);
+		for (i=0; i<W*H; i++)
+			s->image_u8[i] = MIN(255, image[i]);
+	} else {
+		s->image = malloc(W*H*sizeof(float));
+		memcpy(s->image, image, W*H*sizeof(float));
+	}
+	s->nx = W;
+	s->ny = H;
+	s->halfbox = 20;
+	s->nthreads = nthreads;
+	simplexy_run(s);
+}
+
+void test_simplexy_threads(CuTest* tc) {
+	int W = 301;
+	int H = 203;
+	float* image = malloc(W*H*sizeof(float));
+	int u8;
+
+	log_init(LOG_MSG);
+	fake_stars(image, W, H);
+	for (u8=0; u8<2; u8++) {
+		simplexy_t s1, s4;
+		run_simplexy(image, u8, W, H, 1, &s1);
+		run_simplexy(image, u8, W, H, 4, &s4);
+		CuAssertTrue(tc, s1.npeaks > 10);
+		CuAssertIntEquals(tc, s1.npeaks, s4.npeaks);
+		CuAssertTrue(tc, !memcmp(s1.x, s4.x, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.y, s4.y, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.flux, s4.flux, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.background, s4.background,
+								 s1.npeaks * sizeof(float)));
+		simplexy_free_contents(&s1);
+		simplexy_free_contents(&s4);
+	}
+	free(image);
+}
+
+void test_simplexy_workspace(CuTest* tc) {
+	// image sizes in turn: the buffers grow, then get reused.
+	int sizes[] = { 151, 101, 301, 203, 120, 80 };
+	simplexy_workspace_t* ws = simplexy_workspace_new();
+	int k, u8;
+
+	log_init(LOG_MSG);
+	for (u8=0; u8<2; u8++) {
+		for (k=0; k<sizeof(sizes)/sizeof(int); k+=2) {
+			int W = sizes[k];
+			int H = sizes[k+1];
+			float* image = malloc(W*H*sizeof(float));
+			simplexy_t s1, s2;
+			fake_stars(image, W, H);
+			run_simplexy(image, u8, W, H, 1, &s1);
+
+			simplexy_set_defaults(&s2);
+			if (u8)
+				simplexy_set_u8_defaults(&s2);
+			s2.image = s1.image;
+			s2.image_u8 = s1.image_u8;
+			s1.image = NULL;
+			s1.image_u8 = NULL;
+			s2.nx = W;
+			s2.ny = H;
+			s2.halfbox = 20;
+			s2.workspace = ws;
+			simplexy_run(&s2);
+			CuAssertIntEquals(tc, s1.npeaks, s2.npeaks);
+			CuAssertTrue(tc, !memcmp(s1.x, s2.x, s1.npeaks * sizeof(float)));
+			CuAssertTrue(tc, !memcmp(s1.y, s2.y, s1.npeaks * sizeof(float)));
+			CuAssertTrue(tc, !memcmp(s1.flux, s2.flux, s1.npeaks * sizeof(float)));
+			CuAssertTrue(tc, !memcmp(s1.background, s2.background,
+									 s1.npeaks * sizeof(float)));
+			simplexy_free_contents(&s1);
+			simplexy_free_contents(&s2);
+			free(image);
+		}
+	}
+	simplexy_workspace_free(ws);
+}
+
+struct image_rows {
+	const float* image;
+	int W;
+};
+
+static int read_image_rows(void* token, int y0, int nrows, float* rows) {
+	struct image_rows* r = token;
+	memcpy(rows, r->image + (size_t)y0 * r->W, (size_t)nrows * r->W * sizeof(float));
+	return 0;
+}
+
+void test_simplexy_stream(CuTest* tc) {
+	int W = 301;
+	int H = 203;
+	float* image = malloc(W*H*sizeof(float));
+	int bands[] = { 7, 16, 50, 1000 };
+	struct image_rows rows;
+	simplexy_t s1;
+	int i;
+
+	log_init(LOG_MSG);
+	fake_stars(image, W, H);
+	run_simplexy(image, FALSE, W, H, 1, &s1);
+	CuAssertTrue(tc, s1.npeaks > 10);
+	// again with Lanczos fluxes.
+	simplexy_free_contents(&s1);
+	simplexy_set_defaults(&s1);
+	s1.image = malloc(W*H*sizeof(float));
+	memcpy(s1.image, image, W*H*sizeof(float));
+	s1.nx = W;
+	s1.ny = H;
+	s1.halfbox = 20;
+	s1.Lorder = 3;
+	simplexy_run(&s1);
+
+	rows.image = image;
+	rows.W = W;
+	for (i=0; i<sizeof(bands)/sizeof(int); i++) {
+		simplexy_t s2;
+		simplexy_set_defaults(&s2);
+		s2.nx = W;
+		s2.ny = H;
+		s2.halfbox = 20;
+		s2.Lorder = 3;
+		s2.bandrows = bands[i];
+		s2.nthreads = 1 + (i % 2);
+		CuAssertIntEquals(tc, 0, simplexy_run_stream(&s2, read_image_rows, &rows));
+		CuAssertIntEquals(tc, s1.npeaks, s2.npeaks);
+		CuAssertTrue(tc, s1.sigma == s2.sigma);
+		CuAssertTrue(tc, !memcmp(s1.x, s2.x, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.y, s2.y, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.flux, s2.flux, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.background, s2.background,
+								 s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.fluxL, s2.fluxL, s1.npeaks * sizeof(float)));
+		CuAssertTrue(tc, !memcmp(s1.backgroundL, s2.backgroundL,
+								 s1.npeaks * sizeof(float)));
+		simplexy_free_contents(&s2);
+	}
+	simplexy_free_contents(&s1);
+	free(image);
+}
+
+static int cmp_float(const void* v1, const void* v2) {
+	float f1 = *(const float*)v1;
+	float f2 = *(const float*)v2;
+	return (f1 < f2) ? -1 : ((f1 > f2) ? 1 : 0);
+}
+
+void test_dmedsmooth_binned(CuTest* tc) {
+	int W = 157;
+	int H = 121;
+	int halfbox = 12;
+	float* image = malloc(W*H*sizeof(float));
+	float* box = malloc((2*halfbox+1)*(2*halfbox+1)*sizeof(float));
+	int nxgrid, nygrid;
+	int *xgrid, *xlo, *xhi, *ygrid, *ylo, *yhi;
+	float *exact, *binned;
+	int i, j, ip, jp;
+
+	fake_stars(image, W, H);
+	dmedsmooth_gridpoints(W, halfbox, &nxgrid, &xgrid, &xlo, &xhi);
+	dmedsmooth_gridpoints(H, halfbox, &nygrid, &ygrid, &ylo, &yhi);
+	exact = malloc(nxgrid*nygrid*sizeof(float));
+	binned = malloc(nxgrid*nygrid*sizeof(float));
+	dmedsmooth_grid_rows(image, 0, W, halfbox, nxgrid, xlo, xhi, ylo, yhi,
+						 0, nygrid, exact, DMEDSMOOTH_EXACT, 1);
+	dmedsmooth_grid_rows(image, 0, W, halfbox, nxgrid, xlo, xhi, ylo, yhi,
+						 0, nygrid, binned, DMEDSMOOTH_BINNED, 2);
+	for (j=0; j<nygrid; j++) {
+		for (i=0; i<nxgrid; i++) {
+			int n = 0;
+			double mean = 0, var = 0;
+			for (jp=ylo[j]; jp<=yhi[j]; jp++)
+				for (ip=xlo[i]; ip<=xhi[i]; ip++)
+					box[n++] = image[jp*W + ip];
+			qsort(box, n, sizeof(float), cmp_float);
+			CuAssertTrue(tc, exact[j*nxgrid + i] == box[n/2]);
+			for (ip=0; ip<n; ip++)
+				mean += box[ip];
+			mean /= n;
+			for (ip=0; ip<n; ip++)
+				var += (box[ip] - mean) * (box[ip] - mean);
+			var /= n;
+			CuAssertTrue(tc, fabs(binned[j*nxgrid + i] - box[n/2]) <=
+						 1.001 * sqrt(var) / DMEDSMOOTH_NBINS);
+		}
+	}
+	free(exact);
+	free(binned);
+	free(xgrid);
+	free(xlo);
+	free(xhi);
+	free(ygrid);
+	free(ylo);
+	free(yhi);
+	free(box);
+	free(image);
+}